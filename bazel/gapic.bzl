@@ -35,6 +35,10 @@ def cc_gapic_library(name, service_dirs = [], googleapis_deps = [], additional_d
     ]]
 
     sources_glob = [d + "internal/*_sources.cc" for d in service_dirs]
+    tests_glob = [d + f for d in service_dirs for f in [
+        "*_test.cc",
+        "internal/*_test.cc",
+    ]]
 
     native.filegroup(
         name = "srcs",
@@ -43,7 +47,10 @@ def cc_gapic_library(name, service_dirs = [], googleapis_deps = [], additional_d
 
     native.filegroup(
         name = "hdrs",
-        srcs = native.glob(include = code_glob, exclude = sources_glob),
+        srcs = native.glob(
+            include = code_glob,
+            exclude = sources_glob + tests_glob,
+        ),
     )
 
     native.filegroup(
@@ -101,11 +101,11 @@ GoldenKitchenSinkRestMetadata::ExplicitRouting1(
       {[](google::test::admin::database::v1::ExplicitRoutingRequest const& request) -> std::string const& {
         return request.table_name();
       },
-      std::regex{"(regions/[^/]+/zones/[^/]+)/tables/[^/]+", std::regex::optimize}},
+      internal::RoutingPathTemplate("{regions/*/zones/*}/tables/*")},
       {[](google::test::admin::database::v1::ExplicitRoutingRequest const& request) -> std::string const& {
         return request.table_name();
       },
-      std::regex{"projects/[^/]+/(instances/[^/]+)/tables/[^/]+", std::regex::optimize}},
+      internal::RoutingPathTemplate("projects/*/{instances/*}/tables/*")},
       }};
   }();
   table_location_matcher->AppendParam(request, params);
@@ -116,7 +116,7 @@ GoldenKitchenSinkRestMetadata::ExplicitRouting1(
       {[](google::test::admin::database::v1::ExplicitRoutingRequest const& request) -> std::string const& {
         return request.app_profile_id();
       },
-      std::regex{"profiles/([^/]+)", std::regex::optimize}},
+      internal::RoutingPathTemplate("profiles/{*}")},
       {[](google::test::admin::database::v1::ExplicitRoutingRequest const& request) -> std::string const& {
         return request.app_profile_id();
       },
@@ -124,7 +124,7 @@ GoldenKitchenSinkRestMetadata::ExplicitRouting1(
       {[](google::test::admin::database::v1::ExplicitRoutingRequest const& request) -> std::string const& {
         return request.table_name();
       },
-      std::regex{"(projects/[^/]+)/.*", std::regex::optimize}},
+      internal::RoutingPathTemplate("{projects/*}/**")},
       }};
   }();
   routing_id_matcher->AppendParam(request, params);
@@ -118,7 +118,7 @@ GoldenThingAdminMetadata::DropDatabase(
       {[](google::test::admin::database::v1::DropDatabaseRequest const& request) -> std::string const& {
         return request.database();
       },
-      std::regex{"(projects/[^/]+)/instances/[^/]+/databases/[^/]+", std::regex::optimize}},
+      internal::RoutingPathTemplate("{projects/*}/instances/*/databases/*")},
       }};
   }();
   project_matcher->AppendParam(request, params);
@@ -129,7 +129,7 @@ GoldenThingAdminMetadata::DropDatabase(
       {[](google::test::admin::database::v1::DropDatabaseRequest const& request) -> std::string const& {
         return request.database();
       },
-      std::regex{"projects/[^/]+/(instances/[^/]+)/databases/[^/]+", std::regex::optimize}},
+      internal::RoutingPathTemplate("projects/*/{instances/*}/databases/*")},
       }};
   }();
   instance_matcher->AppendParam(request, params);
@@ -140,7 +140,7 @@ GoldenThingAdminMetadata::DropDatabase(
       {[](google::test::admin::database::v1::DropDatabaseRequest const& request) -> std::string const& {
         return request.database();
       },
-      std::regex{"projects/[^/]+/instances/[^/]+/(databases/[^/]+)", std::regex::optimize}},
+      internal::RoutingPathTemplate("projects/*/instances/*/{databases/*}")},
       }};
   }();
   database_matcher->AppendParam(request, params);
@@ -347,7 +347,7 @@ GoldenThingAdminMetadata::AsyncDropDatabase(
       {[](google::test::admin::database::v1::DropDatabaseRequest const& request) -> std::string const& {
         return request.database();
       },
-      std::regex{"(projects/[^/]+)/instances/[^/]+/databases/[^/]+", std::regex::optimize}},
+      internal::RoutingPathTemplate("{projects/*}/instances/*/databases/*")},
       }};
   }();
   project_matcher->AppendParam(request, params);
@@ -358,7 +358,7 @@ GoldenThingAdminMetadata::AsyncDropDatabase(
       {[](google::test::admin::database::v1::DropDatabaseRequest const& request) -> std::string const& {
         return request.database();
       },
-      std::regex{"projects/[^/]+/(instances/[^/]+)/databases/[^/]+", std::regex::optimize}},
+      internal::RoutingPathTemplate("projects/*/{instances/*}/databases/*")},
       }};
   }();
   instance_matcher->AppendParam(request, params);
@@ -369,7 +369,7 @@ GoldenThingAdminMetadata::AsyncDropDatabase(
       {[](google::test::admin::database::v1::DropDatabaseRequest const& request) -> std::string const& {
         return request.database();
       },
-      std::regex{"projects/[^/]+/instances/[^/]+/(databases/[^/]+)", std::regex::optimize}},
+      internal::RoutingPathTemplate("projects/*/instances/*/{databases/*}")},
       }};
   }();
   database_matcher->AppendParam(request, params);
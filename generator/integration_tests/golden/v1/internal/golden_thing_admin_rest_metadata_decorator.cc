@@ -107,7 +107,7 @@ GoldenThingAdminRestMetadata::DropDatabase(
       {[](google::test::admin::database::v1::DropDatabaseRequest const& request) -> std::string const& {
         return request.database();
       },
-      std::regex{"(projects/[^/]+)/instances/[^/]+/databases/[^/]+", std::regex::optimize}},
+      internal::RoutingPathTemplate("{projects/*}/instances/*/databases/*")},
       }};
   }();
   project_matcher->AppendParam(request, params);
@@ -118,7 +118,7 @@ GoldenThingAdminRestMetadata::DropDatabase(
       {[](google::test::admin::database::v1::DropDatabaseRequest const& request) -> std::string const& {
         return request.database();
       },
-      std::regex{"projects/[^/]+/(instances/[^/]+)/databases/[^/]+", std::regex::optimize}},
+      internal::RoutingPathTemplate("projects/*/{instances/*}/databases/*")},
       }};
   }();
   instance_matcher->AppendParam(request, params);
@@ -129,7 +129,7 @@ GoldenThingAdminRestMetadata::DropDatabase(
       {[](google::test::admin::database::v1::DropDatabaseRequest const& request) -> std::string const& {
         return request.database();
       },
-      std::regex{"projects/[^/]+/instances/[^/]+/(databases/[^/]+)", std::regex::optimize}},
+      internal::RoutingPathTemplate("projects/*/instances/*/{databases/*}")},
       }};
   }();
   database_matcher->AppendParam(request, params);
@@ -299,7 +299,7 @@ GoldenThingAdminRestMetadata::AsyncDropDatabase(
       {[](google::test::admin::database::v1::DropDatabaseRequest const& request) -> std::string const& {
         return request.database();
       },
-      std::regex{"(projects/[^/]+)/instances/[^/]+/databases/[^/]+", std::regex::optimize}},
+      internal::RoutingPathTemplate("{projects/*}/instances/*/databases/*")},
       }};
   }();
   project_matcher->AppendParam(request, params);
@@ -310,7 +310,7 @@ GoldenThingAdminRestMetadata::AsyncDropDatabase(
       {[](google::test::admin::database::v1::DropDatabaseRequest const& request) -> std::string const& {
         return request.database();
       },
-      std::regex{"projects/[^/]+/(instances/[^/]+)/databases/[^/]+", std::regex::optimize}},
+      internal::RoutingPathTemplate("projects/*/{instances/*}/databases/*")},
       }};
   }();
   instance_matcher->AppendParam(request, params);
@@ -321,7 +321,7 @@ GoldenThingAdminRestMetadata::AsyncDropDatabase(
       {[](google::test::admin::database::v1::DropDatabaseRequest const& request) -> std::string const& {
         return request.database();
       },
-      std::regex{"projects/[^/]+/instances/[^/]+/(databases/[^/]+)", std::regex::optimize}},
+      internal::RoutingPathTemplate("projects/*/instances/*/{databases/*}")},
       }};
   }();
   database_matcher->AppendParam(request, params);
@@ -81,7 +81,7 @@ RequestIdServiceMetadata::AsyncRenameFoo(
       {[](google::test::requestid::v1::RenameFooRequest const& request) -> std::string const& {
         return request.name();
       },
-      std::regex{"(projects/[^/]+/parents/[^/]+)/.*", std::regex::optimize}},
+      internal::RoutingPathTemplate("{projects/*/parents/*}/**")},
       }};
   }();
   parent_matcher->AppendParam(request, params);
@@ -109,7 +109,7 @@ RequestIdServiceMetadata::RenameFoo(
       {[](google::test::requestid::v1::RenameFooRequest const& request) -> std::string const& {
         return request.name();
       },
-      std::regex{"(projects/[^/]+/parents/[^/]+)/.*", std::regex::optimize}},
+      internal::RoutingPathTemplate("{projects/*/parents/*}/**")},
       }};
   }();
   parent_matcher->AppendParam(request, params);
@@ -48,12 +48,12 @@ std::string SetMetadataText(google::protobuf::MethodDescriptor const& method,
   text += "  std::vector<std::string> params;\n";
   text += "  params.reserve(" + std::to_string(info.size()) + ");\n\n";
   for (auto const& kv : info) {
-    // In the simplest (and probably most common) cases where no regular
-    // expression matching is needed for a given routing parameter key, we skip
+    // In the simplest (and probably most common) cases where no path template
+    // matching is needed for a given routing parameter key, we skip
     // the static loading of `RoutingMatcher`s and simply use if statements.
     if (std::all_of(
             kv.second.begin(), kv.second.end(),
-            [](RoutingParameter const& rp) { return rp.pattern == "(.*)"; })) {
+            [](RoutingParameter const& rp) { return rp.pattern == "{**}"; })) {
       auto const* sep = "  ";
       for (auto const& rp : kv.second){
         text += sep;
@@ -72,11 +72,11 @@ std::string SetMetadataText(google::protobuf::MethodDescriptor const& method,
       text += "      {[]($request_type$ const& request) -> std::string const& {\n";
       text += "        return request." + rp.field_name + "();\n";
       text += "      },\n";
-      // In the special match-all case, we do not bother to set a regex.
-      if (rp.pattern == "(.*)") {
+      // In the special match-all case, we do not bother to set a template.
+      if (rp.pattern == "{**}") {
         text += "      absl::nullopt},\n";
       } else {
-        text += "      std::regex{\"" + rp.pattern + "\", std::regex::optimize}},\n";
+        text += "      internal::RoutingPathTemplate(\"" + rp.pattern + "\")},\n";
       }
     }
     text += "      }};\n";
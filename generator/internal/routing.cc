@@ -14,7 +14,7 @@
 
 #include "generator/internal/routing.h"
 #include "google/cloud/internal/absl_str_join_quiet.h"
-#include "google/cloud/internal/absl_str_replace_quiet.h"
+#include "google/cloud/internal/absl_str_cat_quiet.h"
 #include "google/cloud/log.h"
 #include "absl/strings/str_split.h"
 #include <google/api/routing.pb.h>
@@ -49,18 +49,18 @@ ExplicitRoutingInfo ParseExplicitRoutingHeader(
     // When a path_template is not supplied, we use the field name as the
     // routing parameter key. The pattern matches the whole value of the field.
     if (path_template.empty()) {
-      info[it->field()].push_back({std::move(field_name), "(.*)"});
+      info[it->field()].push_back({std::move(field_name), "{**}"});
       continue;
     }
-    // When a path_template is supplied, we convert the pattern from the proto
-    // into a std::regex. We extract the routing parameter key and set up a
-    // single capture group. For example:
+    // When a path_template is supplied, we extract the routing parameter key
+    // and keep the rest of the template, marking the captured part with
+    // braces. For example:
     //
     // Input :
     //   - path_template = "projects/*/{foo=instances/*}:**"
     // Output:
     //   - param         = "foo"
-    //   - pattern       = "projects/[^/]+/(instances/[^:]+):.*"
+    //   - pattern       = "projects/*/{instances/*}:**"
     static std::regex const kPatternRegex(R"((.*)\{(.*)=(.*)\}(.*))");
     std::smatch match;
     if (!std::regex_match(path_template, match, kPatternRegex)) {
@@ -69,10 +69,7 @@ ExplicitRoutingInfo ParseExplicitRoutingHeader(
                      << path_template;
     }
     auto pattern =
-        absl::StrCat(match[1].str(), "(", match[3].str(), ")", match[4].str());
-    pattern = absl::StrReplaceAll(
-        pattern,
-        {{"**", ".*"}, {"*):", "[^:]+):"}, {"*:", "[^:]+:"}, {"*", "[^/]+"}});
+        absl::StrCat(match[1].str(), "{", match[3].str(), "}", match[4].str());
     info[match[2].str()].push_back({std::move(field_name), std::move(pattern)});
   }
   return info;
@@ -40,12 +40,12 @@ struct RoutingParameter {
   /**
    * A processed `path_template` string from a `RoutingParameter` proto.
    *
-   * It is translated for use as a `std::regex`. We make the following
-   * substitutions, simultaneously:
-   *   - "**"    => ".*"
-   *   - "*"     => "[^/]+"
-   *   - "{foo=" => "("
-   *   - "}"     => ")"
+   * It is translated for use as an `internal::RoutingPathTemplate` by removing
+   * the routing parameter key:
+   *   - "{foo=" => "{"
+   *
+   * A missing `path_template` is represented as "{**}", which captures the
+   * whole field.
    *
    * Note that we do not store the routing parameter key ("foo" in this example)
    * in this struct. It is instead stored as a key in the `ExplicitRoutingInfo`
@@ -104,7 +104,7 @@ service Service0 {
   });
 }
 
-TEST(ParseExplicitRoutingHeaderTest, Regex) {
+TEST(ParseExplicitRoutingHeaderTest, PathTemplate) {
   auto constexpr kProto = R"""(
 message Foo {
   string foo = 1;
@@ -134,10 +134,9 @@ service Service0 {
         info,
         UnorderedElementsAre(
             Pair("routing_key",
-                 ElementsAre(RP("foo", "projects/[^/]+/(instances/[^/]+)/.*"))),
+                 ElementsAre(RP("foo", "projects/*/{instances/*}/**"))),
             Pair("handles_colon",
-                 ElementsAre(
-                     RP("foo", "projects/[^:]+:(instances/[^:]+):.*")))));
+                 ElementsAre(RP("foo", "projects/*:{instances/*}:**")))));
   });
 }
 
@@ -163,10 +162,10 @@ service Service0 {
     auto const& method = *fd->service(0)->method(0);
     auto info = ParseExplicitRoutingHeader(method);
     // When the path template is not present, we should use the field name as
-    // the routing parameter key, and our regex should have one capture group
-    // that matches all.
+    // the routing parameter key, and our template should capture the whole
+    // field.
     EXPECT_THAT(info, UnorderedElementsAre(
-                          Pair("foo", ElementsAre(RP("foo", "(.*)")))));
+                          Pair("foo", ElementsAre(RP("foo", "{**}")))));
   });
 }
 
@@ -202,9 +201,9 @@ service Service0 {
     auto info = ParseExplicitRoutingHeader(method);
     EXPECT_THAT(
         info, UnorderedElementsAre(
-                  Pair("routing_key", ElementsAre(RP("foo", "(foo-path-3)"),
-                                                  RP("bar", "(bar-path-2)"),
-                                                  RP("foo", "(foo-path-1)")))));
+                  Pair("routing_key", ElementsAre(RP("foo", "{foo-path-3}"),
+                                                  RP("bar", "{bar-path-2}"),
+                                                  RP("foo", "{foo-path-1}")))));
   });
 }
 
@@ -245,10 +244,10 @@ service Service0 {
     EXPECT_THAT(
         info,
         UnorderedElementsAre(
-            Pair("routing_key1", ElementsAre(RP("bar", "(bar-path-3)"),
-                                             RP("foo", "(foo-path-1)"))),
-            Pair("routing_key2", ElementsAre(RP("bar", "(bar-path-4)"),
-                                             RP("foo", "(foo-path-2)")))));
+            Pair("routing_key1", ElementsAre(RP("bar", "{bar-path-3}"),
+                                             RP("foo", "{foo-path-1}"))),
+            Pair("routing_key2", ElementsAre(RP("bar", "{bar-path-4}"),
+                                             RP("foo", "{foo-path-2}")))));
   });
 }
 
@@ -275,7 +274,7 @@ service Service0 {
     // Note that while the field name has been modified so that it does not
     // conflict with the C++ keyword, the routing key must not change.
     EXPECT_THAT(info, UnorderedElementsAre(Pair(
-                          "namespace", ElementsAre(RP("namespace_", "(.*)")))));
+                          "namespace", ElementsAre(RP("namespace_", "{**}")))));
   });
 }
 
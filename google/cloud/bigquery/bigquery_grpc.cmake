@@ -47,10 +47,46 @@ if (GOOGLE_CLOUD_CPP_ENABLE_EXAMPLES)
                          PROPERTIES LABELS "integration-test;quickstart")
 endif ()
 
-# BigQuery has a handwritten sample that demonstrates mocking. The executable is
-# added by `google_cloud_cpp_add_gapic_library()`. We need to manually link it
+# BigQuery has handwritten samples that demonstrate mocking. The executables are
+# added by `google_cloud_cpp_add_gapic_library()`. We need to manually link them
 # against Google Mock.
 if (BUILD_TESTING AND GOOGLE_CLOUD_CPP_ENABLE_CXX_EXCEPTIONS)
     target_link_libraries(bigquery_samples_mock_bigquery_read
                           PRIVATE GTest::gmock_main)
+    target_link_libraries(
+        bigquery_samples_mock_parallel_read PRIVATE GTest::gmock_main
+                                                    google-cloud-cpp::mocks)
+    target_link_libraries(
+        bigquery_samples_mock_stream_appender PRIVATE GTest::gmock_main
+                                                      google-cloud-cpp::mocks)
+endif ()
+
+# BigQuery also has handwritten unit tests for the storage helpers.
+if (BUILD_TESTING)
+    set(bigquery_unit_tests
+        # cmake-format: sort
+        storage/v1/internal/stream_appender_impl_test.cc
+        storage/v1/parallel_read_test.cc)
+
+    # Export the list of unit tests to a .bzl file so we do not need to maintain
+    # the list in two places.
+    export_list_to_bazel("bigquery_unit_tests.bzl" "bigquery_unit_tests" YEAR
+                         "2025")
+
+    # Generate a target for each unit test.
+    foreach (fname ${bigquery_unit_tests})
+        google_cloud_cpp_add_executable(target "bigquery" "${fname}")
+        target_link_libraries(
+            ${target}
+            PRIVATE google_cloud_cpp_testing
+                    google_cloud_cpp_testing_grpc
+                    google-cloud-cpp::bigquery
+                    google-cloud-cpp::bigquery_mocks
+                    google-cloud-cpp::mocks
+                    GTest::gmock_main
+                    GTest::gmock
+                    GTest::gtest)
+        google_cloud_cpp_add_common_options(${target})
+        add_test(NAME ${target} COMMAND ${target})
+    endforeach ()
 endif ()
@@ -13,6 +13,7 @@
 // limitations under the License.
 
 #include "google/cloud/bigquery/storage/v1/bigquery_read_client.h"
+#include "google/cloud/bigquery/storage/v1/parallel_read.h"
 #include "google/cloud/internal/getenv.h"
 #include "google/cloud/internal/random.h"
 #include "google/cloud/testing_util/example_driver.h"
@@ -161,6 +162,48 @@ void SplitReadStream(std::vector<std::string> const& argv) {
   (argv.at(0), argv.at(1), argv.at(2));
 }
 
+void ParallelReadRows(std::vector<std::string> const& argv) {
+  if (argv.size() < 2) {
+    throw google::cloud::testing_util::Usage(
+        "parallel-read-rows <project-id> <table-name> [<row-restriction>]");
+  }
+  //! [bigquery-parallel-read-rows]
+  namespace bigquery = ::google::cloud::bigquery_storage_v1;
+  [](std::string const& project_id, std::string const& table_name,
+     std::string const& row_restriction) {
+    int max_stream_count = 4;
+    google::cloud::bigquery::storage::v1::CreateReadSessionRequest request;
+    request.set_parent("projects/" + project_id);
+    request.set_max_stream_count(max_stream_count);
+    request.mutable_read_session()->set_table(table_name);
+    request.mutable_read_session()->set_data_format(
+        google::cloud::bigquery::storage::v1::DataFormat::ARROW);
+    request.mutable_read_session()->mutable_read_options()->set_row_restriction(
+        row_restriction);
+
+    std::mutex mu;
+    std::int64_t row_count = 0;
+    std::size_t byte_count = 0;
+    auto status = bigquery::ParallelReadRows(
+        bigquery::MakeBigQueryReadConnection(), request,
+        [&](bigquery::ReadStreamBlock block) {
+          // `block.data` contains a serialized Arrow record batch, which can
+          // be decoded using `block.session->arrow_schema()`.
+          std::lock_guard<std::mutex> lk(mu);
+          row_count += block.row_count;
+          byte_count += block.data.size();
+          return google::cloud::Status{};
+        });
+    if (!status.ok()) throw std::move(status);
+
+    std::cout << "ParallelReadRows successfully read " << row_count
+              << " rows (" << byte_count << " bytes) from " << table_name
+              << ".\n";
+  }
+  //! [bigquery-parallel-read-rows]
+  (argv.at(0), argv.at(1), argv.at(2));
+}
+
 void AutoRun(std::vector<std::string> const& argv) {
   namespace examples = ::google::cloud::testing_util;
   if (!argv.empty()) throw examples::Usage{"auto"};
@@ -181,6 +224,7 @@ void AutoRun(std::vector<std::string> const& argv) {
   CreateReadSession({project_id, table_name});
   ReadRows({project_id, table_name, R"(state = "WA")"});
   SplitReadStream({project_id, table_name, R"(state = "WA")"});
+  ParallelReadRows({project_id, table_name, R"(state = "WA")"});
 
   std::cout << "\nAutoRun done" << std::endl;
 }
@@ -193,6 +237,7 @@ int main(int argc, char* argv[]) {  // NOLINT(bugprone-exception-escape)
        {"create-read-session", CreateReadSession},
        {"read-rows", ReadRows},
        {"split-read-stream", SplitReadStream},
+       {"parallel-read-rows", ParallelReadRows},
        {"auto", AutoRun}});
   return example.Run(argc, argv);
 }
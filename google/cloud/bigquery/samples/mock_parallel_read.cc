@@ -0,0 +1,171 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/bigquery/storage/v1/mocks/mock_bigquery_read_connection.h"
+#include "google/cloud/bigquery/storage/v1/parallel_read.h"
+#include "google/cloud/mocks/mock_stream_range.h"
+#include <gmock/gmock.h>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace {
+
+using ::google::cloud::bigquery_storage_v1_mocks::MockBigQueryReadConnection;
+using ::testing::ElementsAre;
+using ::testing::UnorderedElementsAre;
+namespace bigquery = ::google::cloud::bigquery_storage_v1;
+namespace v1 = ::google::cloud::bigquery::storage::v1;
+
+// Each block contains a single row, whose contents are the block value.
+using FakeStreams = std::map<std::string, std::vector<std::string>>;
+
+google::cloud::StreamRange<v1::ReadRowsResponse> FakeReadRows(
+    FakeStreams const& streams, v1::ReadRowsRequest const& request) {
+  auto const& rows = streams.at(request.read_stream());
+  auto const offset = static_cast<std::size_t>(request.offset());
+  if (offset > rows.size()) {
+    return google::cloud::mocks::MakeStreamRange<v1::ReadRowsResponse>(
+        {}, google::cloud::Status(google::cloud::StatusCode::kOutOfRange,
+                                  "offset past end of stream"));
+  }
+  std::vector<v1::ReadRowsResponse> responses;
+  for (auto i = offset; i != rows.size(); ++i) {
+    v1::ReadRowsResponse r;
+    r.set_row_count(1);
+    r.mutable_arrow_record_batch()->set_serialized_record_batch(rows[i]);
+    r.mutable_stats()->mutable_progress()->set_at_response_end(
+        static_cast<double>(i + 1) / static_cast<double>(rows.size()));
+    responses.push_back(std::move(r));
+  }
+  return google::cloud::mocks::MakeStreamRange(std::move(responses));
+}
+
+v1::ReadSession MakeSession(std::vector<std::string> const& names) {
+  v1::ReadSession session;
+  session.set_name("test-session");
+  for (auto const& n : names) session.add_streams()->set_name(n);
+  return session;
+}
+
+TEST(MockParallelReadExample, ReadsAllStreams) {
+  auto const streams = FakeStreams{{"s0", {"a0", "a1"}},
+                                   {"s1", {"b0", "b1", "b2"}},
+                                   {"s2", {}}};
+  auto mock = std::make_shared<MockBigQueryReadConnection>();
+  EXPECT_CALL(*mock, ReadRows).Times(3).WillRepeatedly(
+      [&](v1::ReadRowsRequest const& r) { return FakeReadRows(streams, r); });
+  EXPECT_CALL(*mock, SplitReadStream).Times(0);
+
+  std::mutex mu;
+  std::map<std::string, std::vector<std::string>> received;
+  auto status = bigquery::ParallelReadRows(
+      mock, MakeSession({"s0", "s1", "s2"}),
+      [&](bigquery::ReadStreamBlock block) {
+        EXPECT_EQ(block.session->name(), "test-session");
+        EXPECT_EQ(block.row_count, 1);
+        std::lock_guard<std::mutex> lk(mu);
+        auto& rows = received[block.stream_name];
+        EXPECT_EQ(block.offset, static_cast<std::int64_t>(rows.size()));
+        rows.push_back(std::string(block.data));
+        return google::cloud::Status{};
+      });
+  ASSERT_TRUE(status.ok()) << status;
+  EXPECT_THAT(received["s0"], ElementsAre("a0", "a1"));
+  EXPECT_THAT(received["s1"], ElementsAre("b0", "b1", "b2"));
+  EXPECT_THAT(received["s2"], ElementsAre());
+}
+
+TEST(MockParallelReadExample, CreateSession) {
+  auto const streams = FakeStreams{{"s0", {"a0"}}};
+  auto mock = std::make_shared<MockBigQueryReadConnection>();
+  EXPECT_CALL(*mock, CreateReadSession)
+      .WillOnce([](v1::CreateReadSessionRequest const& request) {
+        EXPECT_EQ(request.parent(), "projects/test-project");
+        return google::cloud::make_status_or(MakeSession({"s0"}));
+      });
+  EXPECT_CALL(*mock, ReadRows).WillOnce([&](v1::ReadRowsRequest const& r) {
+    return FakeReadRows(streams, r);
+  });
+
+  v1::CreateReadSessionRequest request;
+  request.set_parent("projects/test-project");
+  std::vector<std::string> received;
+  auto status = bigquery::ParallelReadRows(
+      mock, request, [&](bigquery::ReadStreamBlock block) {
+        received.push_back(std::string(block.data));
+        return google::cloud::Status{};
+      });
+  ASSERT_TRUE(status.ok()) << status;
+  EXPECT_THAT(received, ElementsAre("a0"));
+}
+
+TEST(MockParallelReadExample, ConsumerErrorStopsRead) {
+  auto const streams = FakeStreams{{"s0", {"a0", "a1", "a2"}}};
+  auto mock = std::make_shared<MockBigQueryReadConnection>();
+  EXPECT_CALL(*mock, ReadRows).WillOnce([&](v1::ReadRowsRequest const& r) {
+    return FakeReadRows(streams, r);
+  });
+
+  int count = 0;
+  auto status = bigquery::ParallelReadRows(
+      mock, MakeSession({"s0"}), [&](bigquery::ReadStreamBlock) {
+        if (++count == 2) {
+          return google::cloud::Status(google::cloud::StatusCode::kAborted,
+                                       "consumer failure");
+        }
+        return google::cloud::Status{};
+      });
+  EXPECT_EQ(status.code(), google::cloud::StatusCode::kAborted);
+  EXPECT_EQ(count, 2);
+}
+
+TEST(MockParallelReadExample, SplitStreams) {
+  // "s0" is split into "p0" (the first two rows) and "r0" (the remaining
+  // rows). Depending on timing the split may or may not be used, but every row
+  // must be delivered exactly once.
+  auto const streams = FakeStreams{{"s0", {"a0", "a1", "a2", "a3"}},
+                                   {"p0", {"a0", "a1"}},
+                                   {"r0", {"a2", "a3"}}};
+  auto mock = std::make_shared<MockBigQueryReadConnection>();
+  EXPECT_CALL(*mock, ReadRows).WillRepeatedly(
+      [&](v1::ReadRowsRequest const& r) { return FakeReadRows(streams, r); });
+  EXPECT_CALL(*mock, SplitReadStream)
+      .WillRepeatedly([](v1::SplitReadStreamRequest const& request) {
+        v1::SplitReadStreamResponse response;
+        if (request.name() == "s0") {
+          response.mutable_primary_stream()->set_name("p0");
+          response.mutable_remainder_stream()->set_name("r0");
+        }
+        return google::cloud::make_status_or(response);
+      });
+
+  std::mutex mu;
+  std::vector<std::string> received;
+  auto status = bigquery::ParallelReadRows(
+      mock, MakeSession({"s0"}),
+      [&](bigquery::ReadStreamBlock block) {
+        std::lock_guard<std::mutex> lk(mu);
+        received.push_back(std::string(block.data));
+        return google::cloud::Status{};
+      },
+      google::cloud::Options{}
+          .set<bigquery::ParallelReadMaxConcurrencyOption>(2)
+          .set<bigquery::ParallelReadSplitStreamsOption>(true));
+  ASSERT_TRUE(status.ok()) << status;
+  EXPECT_THAT(received, UnorderedElementsAre("a0", "a1", "a2", "a3"));
+}
+
+}  // namespace
@@ -0,0 +1,299 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/bigquery/storage/v1/bigquery_write_options.h"
+#include "google/cloud/bigquery/storage/v1/mocks/mock_bigquery_write_connection.h"
+#include "google/cloud/bigquery/storage/v1/stream_appender.h"
+#include "google/cloud/mocks/mock_async_streaming_read_write_rpc.h"
+#include <gmock/gmock.h>
+#include <chrono>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace {
+
+using ::google::cloud::future;
+using ::google::cloud::make_ready_future;
+using ::google::cloud::promise;
+using ::google::cloud::Status;
+using ::google::cloud::StatusCode;
+using ::google::cloud::bigquery_storage_v1_mocks::MockBigQueryWriteConnection;
+using ::testing::ElementsAre;
+namespace bigquery = ::google::cloud::bigquery_storage_v1;
+namespace v1 = ::google::cloud::bigquery::storage::v1;
+
+using MockAppendRowsStream =
+    ::google::cloud::mocks::MockAsyncStreamingReadWriteRpc<
+        v1::AppendRowsRequest, v1::AppendRowsResponse>;
+
+auto constexpr kDefaultStream =
+    "projects/test-project/datasets/d/tables/t/streams/_default";
+auto constexpr kCommittedStream =
+    "projects/test-project/datasets/d/tables/t/streams/s1";
+
+/**
+ * A fake `AppendRows()` service.
+ *
+ * Each stream acknowledges every request, reporting its offset, and records
+ * the requests in `requests`. The streams break after `break_after` requests.
+ */
+class FakeAppendRows {
+ public:
+  std::vector<v1::AppendRowsRequest> requests() {
+    std::lock_guard<std::mutex> lk(mu_);
+    return requests_;
+  }
+
+  void BreakAfter(int count) { break_after_ = count; }
+
+  std::unique_ptr<google::cloud::AsyncStreamingReadWriteRpc<
+      v1::AppendRowsRequest, v1::AppendRowsResponse>>
+  MakeStream() {
+    auto state = std::make_shared<StreamState>();
+    state->break_after = break_after_;
+    break_after_ = -1;
+    auto stream = std::make_unique<MockAppendRowsStream>();
+    EXPECT_CALL(*stream, Start).WillOnce([] {
+      return make_ready_future(true);
+    });
+    EXPECT_CALL(*stream, Write)
+        .WillRepeatedly([this, state](v1::AppendRowsRequest const& request,
+                                      grpc::WriteOptions) {
+          return OnWrite(*state, request);
+        });
+    EXPECT_CALL(*stream, Read).WillRepeatedly([state] {
+      return OnRead(*state);
+    });
+    EXPECT_CALL(*stream, WritesDone).WillRepeatedly([state] {
+      Close(*state);
+      return make_ready_future(true);
+    });
+    EXPECT_CALL(*stream, Finish).WillOnce([state] {
+      return make_ready_future(state->status);
+    });
+    return stream;
+  }
+
+ private:
+  using Response = absl::optional<v1::AppendRowsResponse>;
+
+  struct StreamState {
+    std::mutex mu;
+    std::deque<v1::AppendRowsResponse> responses;
+    std::unique_ptr<promise<Response>> reader;
+    bool closed = false;
+    int break_after = -1;
+    Status status;
+  };
+
+  future<bool> OnWrite(StreamState& state,
+                       v1::AppendRowsRequest const& request) {
+    std::unique_lock<std::mutex> lk(state.mu);
+    if (state.break_after == 0) {
+      lk.unlock();
+      Close(state, Status(StatusCode::kUnavailable, "try-again"));
+      return make_ready_future(false);
+    }
+    --state.break_after;
+    {
+      std::lock_guard<std::mutex> g(mu_);
+      requests_.push_back(request);
+    }
+    v1::AppendRowsResponse response;
+    auto& result = *response.mutable_append_result();
+    if (request.has_offset()) *result.mutable_offset() = request.offset();
+    if (!state.reader) {
+      state.responses.push_back(std::move(response));
+      return make_ready_future(true);
+    }
+    auto reader = std::move(state.reader);
+    lk.unlock();
+    reader->set_value(std::move(response));
+    return make_ready_future(true);
+  }
+
+  static future<Response> OnRead(StreamState& state) {
+    std::lock_guard<std::mutex> lk(state.mu);
+    if (!state.responses.empty()) {
+      auto r = std::move(state.responses.front());
+      state.responses.pop_front();
+      return make_ready_future(Response(std::move(r)));
+    }
+    if (state.closed) return make_ready_future(Response{});
+    state.reader = std::make_unique<promise<Response>>();
+    return state.reader->get_future();
+  }
+
+  static void Close(StreamState& state, Status status = {}) {
+    std::unique_lock<std::mutex> lk(state.mu);
+    state.closed = true;
+    state.status = std::move(status);
+    state.responses.clear();
+    auto reader = std::move(state.reader);
+    lk.unlock();
+    if (reader) reader->set_value(Response{});
+  }
+
+  std::mutex mu_;
+  std::vector<v1::AppendRowsRequest> requests_;
+  int break_after_ = -1;
+};
+
+// The rows are padded to this size, so the request size limits in these tests
+// are not affected by the size of the other request fields.
+auto constexpr kRowSize = 1000;
+
+v1::ProtoRows MakeRows(std::vector<std::string> const& values) {
+  v1::ProtoRows rows;
+  for (auto const& v : values) {
+    rows.add_serialized_rows(v + std::string(kRowSize - v.size(), '.'));
+  }
+  return rows;
+}
+
+v1::ProtoSchema MakeSchema() {
+  v1::ProtoSchema schema;
+  schema.mutable_proto_descriptor()->set_name("TestRow");
+  return schema;
+}
+
+// Returns the rows in @p request, without padding.
+std::vector<std::string> Rows(v1::AppendRowsRequest const& request) {
+  std::vector<std::string> result;
+  for (auto const& r : request.proto_rows().rows().serialized_rows()) {
+    result.push_back(r.substr(0, r.find('.')));
+  }
+  return result;
+}
+
+TEST(MockStreamAppenderExample, DefaultStream) {
+  FakeAppendRows fake;
+  auto mock = std::make_shared<MockBigQueryWriteConnection>();
+  EXPECT_CALL(*mock, AsyncAppendRows).WillOnce([&] {
+    return fake.MakeStream();
+  });
+
+  bigquery::StreamAppender appender(mock, kDefaultStream, MakeSchema());
+  auto a0 = appender.Append(MakeRows({"r0", "r1"}));
+  auto a1 = appender.Append(MakeRows({"r2"}));
+  auto status = appender.Close().get();
+  ASSERT_TRUE(status.ok()) << status;
+  EXPECT_EQ(a0.get().value(), -1);
+  EXPECT_EQ(a1.get().value(), -1);
+
+  auto requests = fake.requests();
+  ASSERT_FALSE(requests.empty());
+  // Only the first request includes the stream name and the schema.
+  EXPECT_EQ(requests[0].write_stream(), kDefaultStream);
+  EXPECT_EQ(requests[0].proto_rows().writer_schema().proto_descriptor().name(),
+            "TestRow");
+  std::vector<std::string> rows;
+  for (auto const& r : requests) {
+    EXPECT_FALSE(r.has_offset());
+    auto const v = Rows(r);
+    rows.insert(rows.end(), v.begin(), v.end());
+  }
+  EXPECT_THAT(rows, ElementsAre("r0", "r1", "r2"));
+  for (std::size_t i = 1; i < requests.size(); ++i) {
+    EXPECT_TRUE(requests[i].write_stream().empty());
+    EXPECT_FALSE(requests[i].proto_rows().has_writer_schema());
+  }
+}
+
+TEST(MockStreamAppenderExample, BatchesWithOffsets) {
+  FakeAppendRows fake;
+  auto mock = std::make_shared<MockBigQueryWriteConnection>();
+  EXPECT_CALL(*mock, AsyncAppendRows).WillOnce([&] {
+    return fake.MakeStream();
+  });
+
+  // Each request holds at most two rows.
+  bigquery::StreamAppender appender(
+      mock, kCommittedStream, MakeSchema(),
+      google::cloud::Options{}
+          .set<bigquery::StreamAppenderMaxRequestBytesOption>(2500));
+  auto a0 = appender.Append(MakeRows({"r0", "r1", "r2"}));
+  auto a1 = appender.Append(MakeRows({"r3", "r4"}));
+  auto status = appender.Close().get();
+  ASSERT_TRUE(status.ok()) << status;
+  EXPECT_EQ(a0.get().value(), 0);
+  EXPECT_EQ(a1.get().value(), 3);
+
+  std::int64_t offset = 0;
+  for (auto const& r : fake.requests()) {
+    EXPECT_LE(r.proto_rows().rows().serialized_rows_size(), 2);
+    EXPECT_EQ(r.offset().value(), offset);
+    offset += r.proto_rows().rows().serialized_rows_size();
+  }
+  EXPECT_EQ(offset, 5);
+}
+
+TEST(MockStreamAppenderExample, ReconnectsAndReplays) {
+  FakeAppendRows fake;
+  auto mock = std::make_shared<MockBigQueryWriteConnection>();
+  EXPECT_CALL(*mock, AsyncAppendRows)
+      .WillOnce([&] {
+        fake.BreakAfter(1);
+        return fake.MakeStream();
+      })
+      .WillOnce([&] { return fake.MakeStream(); });
+
+  bigquery::StreamAppender appender(
+      mock, kCommittedStream, MakeSchema(),
+      google::cloud::Options{}
+          .set<bigquery::StreamAppenderMaxRequestBytesOption>(1500)
+          .set<bigquery::BigQueryWriteBackoffPolicyOption>(
+              std::make_shared<google::cloud::ExponentialBackoffPolicy>(
+                  std::chrono::milliseconds(1), std::chrono::milliseconds(1),
+                  2.0)));
+  auto a0 = appender.Append(MakeRows({"r0", "r1", "r2"}));
+  auto status = appender.Close().get();
+  ASSERT_TRUE(status.ok()) << status;
+  EXPECT_EQ(a0.get().value(), 0);
+
+  auto requests = fake.requests();
+  std::vector<std::string> rows;
+  for (auto const& r : requests) {
+    auto const v = Rows(r);
+    rows.insert(rows.end(), v.begin(), v.end());
+  }
+  EXPECT_THAT(rows, ElementsAre("r0", "r1", "r2"));
+  // The first request on the new stream includes the stream name again.
+  ASSERT_EQ(requests.size(), 3);
+  EXPECT_EQ(requests[1].write_stream(), kCommittedStream);
+}
+
+TEST(MockStreamAppenderExample, InvalidAppends) {
+  auto mock = std::make_shared<MockBigQueryWriteConnection>();
+  EXPECT_CALL(*mock, AsyncAppendRows).Times(0);
+
+  bigquery::StreamAppender appender(
+      mock, kDefaultStream, MakeSchema(),
+      google::cloud::Options{}
+          .set<bigquery::StreamAppenderMaxRequestBytesOption>(4));
+  auto empty = appender.Append(v1::ProtoRows{}).get();
+  EXPECT_EQ(empty.status().code(), StatusCode::kInvalidArgument);
+  auto too_large = appender.Append(MakeRows({"too-large"})).get();
+  EXPECT_EQ(too_large.status().code(), StatusCode::kInvalidArgument);
+
+  auto status = appender.Close().get();
+  ASSERT_TRUE(status.ok()) << status;
+  auto closed = appender.Append(MakeRows({"r0"})).get();
+  EXPECT_EQ(closed.status().code(), StatusCode::kFailedPrecondition);
+}
+
+}  // namespace
@@ -0,0 +1,20 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// The generated `*_sources.cc` files only include generated code. Handwritten
+// additions to the library are compiled via this file.
+
+// NOLINTBEGIN(bugprone-suspicious-include)
+#include "google/cloud/bigquery/storage/v1/parallel_read.cc"
+// NOLINTEND(bugprone-suspicious-include)
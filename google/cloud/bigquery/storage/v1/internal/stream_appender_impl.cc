@@ -0,0 +1,475 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/bigquery/storage/v1/internal/stream_appender_impl.h"
+#include "google/cloud/bigquery/storage/v1/bigquery_write_options.h"
+#include "google/cloud/bigquery/storage/v1/stream_appender.h"
+#include "google/cloud/grpc_error_delegate.h"
+#include "google/cloud/internal/make_status.h"
+#include "absl/strings/match.h"
+#include <google/protobuf/io/coded_stream.h>
+#include <limits>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace google {
+namespace cloud {
+namespace bigquery_storage_v1_internal {
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_BEGIN
+
+namespace v1 = ::google::cloud::bigquery::storage::v1;
+using ::google::cloud::bigquery_storage_v1::BigQueryWriteBackoffPolicyOption;
+using ::google::cloud::bigquery_storage_v1::BigQueryWriteRetryPolicyOption;
+using ::google::cloud::bigquery_storage_v1::StreamAppenderMaxPendingBytesOption;
+using ::google::cloud::bigquery_storage_v1::StreamAppenderMaxPendingRowsOption;
+using ::google::cloud::bigquery_storage_v1::StreamAppenderMaxRequestBytesOption;
+
+namespace {
+
+// The bytes used by @p row in a request, including its tag and length.
+std::size_t RowBytes(std::string const& row) {
+  return 1 + google::protobuf::io::CodedOutputStream::VarintSize64(row.size()) +
+         row.size();
+}
+
+// An upper bound for the size of a request without any rows.
+std::size_t HeaderBytes(std::string const& write_stream,
+                        v1::ProtoSchema const& writer_schema) {
+  v1::AppendRowsRequest request;
+  request.set_write_stream(write_stream);
+  *request.mutable_proto_rows()->mutable_writer_schema() = writer_schema;
+  request.mutable_proto_rows()->mutable_rows();
+  request.mutable_offset()->set_value(
+      (std::numeric_limits<std::int64_t>::max)());
+  // The length prefixes of the `proto_rows` and `rows` fields grow as rows are
+  // added, up to 5 bytes each.
+  return request.ByteSizeLong() + 2 * 5;
+}
+
+}  // namespace
+
+Options StreamAppenderDefaultOptions(Options options) {
+  if (!options.has<StreamAppenderMaxRequestBytesOption>()) {
+    options.set<StreamAppenderMaxRequestBytesOption>(8 * 1024 * 1024);
+  }
+  if (!options.has<StreamAppenderMaxPendingBytesOption>()) {
+    options.set<StreamAppenderMaxPendingBytesOption>(64 * 1024 * 1024);
+  }
+  if (!options.has<StreamAppenderMaxPendingRowsOption>()) {
+    options.set<StreamAppenderMaxPendingRowsOption>(
+        (std::numeric_limits<std::size_t>::max)());
+  }
+  return options;
+}
+
+StreamAppenderImpl::StreamAppenderImpl(
+    std::shared_ptr<bigquery_storage_v1::BigQueryWriteConnection> connection,
+    CompletionQueue cq, std::string write_stream,
+    v1::ProtoSchema writer_schema, Options options)
+    : connection_(std::move(connection)),
+      cq_(std::move(cq)),
+      write_stream_(std::move(write_stream)),
+      writer_schema_(std::move(writer_schema)),
+      options_(StreamAppenderDefaultOptions(std::move(options))),
+      // Rows appended to the default stream have no offsets.
+      use_offsets_(!absl::EndsWith(write_stream_, "/_default")),
+      max_request_bytes_(options_.get<StreamAppenderMaxRequestBytesOption>()),
+      header_bytes_(HeaderBytes(write_stream_, writer_schema_)),
+      max_pending_bytes_(options_.get<StreamAppenderMaxPendingBytesOption>()),
+      max_pending_rows_(options_.get<StreamAppenderMaxPendingRowsOption>()),
+      retry_policy_(options_.get<BigQueryWriteRetryPolicyOption>()->clone()),
+      backoff_policy_(
+          options_.get<BigQueryWriteBackoffPolicyOption>()->clone()) {}
+
+future<StatusOr<std::int64_t>> StreamAppenderImpl::Append(v1::ProtoRows rows) {
+  using Result = StatusOr<std::int64_t>;
+  if (rows.serialized_rows().empty()) {
+    return make_ready_future(Result(internal::InvalidArgumentError(
+        "cannot append an empty set of rows", GCP_ERROR_INFO())));
+  }
+  std::size_t bytes = 0;
+  for (auto const& r : rows.serialized_rows()) {
+    auto const row_bytes = RowBytes(r);
+    if (header_bytes_ + row_bytes > max_request_bytes_) {
+      return make_ready_future(Result(internal::InvalidArgumentError(
+          "request size with a single row (" +
+              std::to_string(header_bytes_ + row_bytes) +
+              ") exceeds StreamAppenderMaxRequestBytesOption (" +
+              std::to_string(max_request_bytes_) + ")",
+          GCP_ERROR_INFO())));
+    }
+    bytes += row_bytes;
+  }
+  auto const count = static_cast<std::size_t>(rows.serialized_rows_size());
+
+  auto append = std::make_shared<PendingAppend>();
+  auto f = append->done.get_future();
+  std::unique_lock<std::mutex> lk(mu_);
+  if (closing_) {
+    return make_ready_future(Result(internal::FailedPreconditionError(
+        "the appender is closed", GCP_ERROR_INFO())));
+  }
+  if (!status_.ok()) return make_ready_future(Result(status_));
+  // Rows from later appends cannot skip over the appends already waiting.
+  if (!waiting_.empty() || !Admits(bytes, count)) {
+    waiting_.push_back(
+        WaitingAppend{std::move(rows), bytes, count, std::move(append)});
+    return f;
+  }
+  Admit(std::move(rows), bytes, count, std::move(append));
+  MaybeWrite(std::move(lk));
+  return f;
+}
+
+void StreamAppenderImpl::Flush() {
+  std::unique_lock<std::mutex> lk(mu_);
+  Seal();
+  MaybeWrite(std::move(lk));
+}
+
+future<Status> StreamAppenderImpl::Close() {
+  std::unique_lock<std::mutex> lk(mu_);
+  if (closed_) return make_ready_future(close_status_);
+  close_promises_.emplace_back();
+  auto f = close_promises_.back().get_future();
+  if (closing_) return f;
+  closing_ = true;
+  Seal();
+  if (state_ == State::kDisconnected && pending_.empty() && waiting_.empty()) {
+    SetClosed(std::move(lk), status_);
+    return f;
+  }
+  MaybeWrite(std::move(lk));
+  return f;
+}
+
+bool StreamAppenderImpl::Admits(std::size_t bytes, std::size_t count) const {
+  // Always admit the rows when nothing is pending, otherwise an append larger
+  // than the limits would wait forever.
+  return pending_bytes_ == 0 || (pending_bytes_ + bytes <= max_pending_bytes_ &&
+                                 pending_rows_ + count <= max_pending_rows_);
+}
+
+void StreamAppenderImpl::Admit(v1::ProtoRows rows, std::size_t bytes,
+                               std::size_t count,
+                               std::shared_ptr<PendingAppend> append) {
+  auto const max_rows_bytes = max_request_bytes_ - header_bytes_;
+  for (auto& r : *rows.mutable_serialized_rows()) {
+    auto const row_bytes = RowBytes(r);
+    if (current_.rows != 0 && current_.bytes + row_bytes > max_rows_bytes) {
+      Seal();
+    }
+    if (current_.parts.empty() || current_.parts.back().append != append) {
+      current_.parts.push_back(BatchPart{append, current_.rows});
+      ++append->parts;
+    }
+    current_.bytes += row_bytes;
+    ++current_.rows;
+    current_.request->mutable_proto_rows()->mutable_rows()->add_serialized_rows(
+        std::move(r));
+  }
+  pending_bytes_ += bytes;
+  pending_rows_ += count;
+}
+
+void StreamAppenderImpl::AdmitWaiting() {
+  while (!waiting_.empty() &&
+         Admits(waiting_.front().bytes, waiting_.front().count)) {
+    auto w = std::move(waiting_.front());
+    waiting_.pop_front();
+    Admit(std::move(w.rows), w.bytes, w.count, std::move(w.append));
+  }
+}
+
+std::vector<std::shared_ptr<StreamAppenderImpl::PendingAppend>>
+StreamAppenderImpl::FailWaiting(Status const& status) {
+  std::vector<std::shared_ptr<PendingAppend>> done;
+  for (auto& w : waiting_) {
+    w.append->status = status;
+    done.push_back(std::move(w.append));
+  }
+  waiting_.clear();
+  return done;
+}
+
+void StreamAppenderImpl::Seal() {
+  if (current_.rows == 0) return;
+  if (use_offsets_) {
+    current_.offset = next_offset_;
+    next_offset_ += current_.rows;
+    current_.request->mutable_offset()->set_value(current_.offset);
+  }
+  pending_.push_back(std::move(current_));
+  current_ = Batch{};
+}
+
+void StreamAppenderImpl::MaybeWrite(std::unique_lock<std::mutex> lk) {
+  if (state_ == State::kDisconnected) {
+    if (pending_.empty() && current_.rows == 0) return;
+    state_ = State::kConnecting;
+    lk.unlock();
+    Connect();
+    return;
+  }
+  if (state_ != State::kConnected || writing_ || writes_done_) return;
+  // Send the rows accumulated so far as soon as the stream is ready, further
+  // rows are batched while this request is written.
+  if (pending_.empty()) Seal();
+  if (pending_.empty()) {
+    if (!closing_ || !inflight_.empty()) return;
+    writes_done_ = true;
+    writing_ = true;
+    auto* stream = stream_.get();
+    lk.unlock();
+    stream->WritesDone().then([self = shared_from_this()](future<bool> f) {
+      self->OnWritesDone(f.get());
+    });
+    return;
+  }
+
+  auto request = pending_.front().request;
+  inflight_.push_back(std::move(pending_.front()));
+  pending_.pop_front();
+  // The write stream and schema are only required in the first request of
+  // each connection.
+  if (first_request_) {
+    request->set_write_stream(write_stream_);
+    *request->mutable_proto_rows()->mutable_writer_schema() = writer_schema_;
+    first_request_ = false;
+  } else {
+    request->clear_write_stream();
+    request->mutable_proto_rows()->clear_writer_schema();
+  }
+  writing_ = true;
+  auto* stream = stream_.get();
+  lk.unlock();
+  stream->Write(*request, grpc::WriteOptions())
+      .then([self = shared_from_this(), request](future<bool> f) {
+        self->OnWrite(f.get());
+      });
+}
+
+void StreamAppenderImpl::Connect() {
+  auto stream = [&] {
+    internal::OptionsSpan span(options_);
+    return connection_->AsyncAppendRows();
+  }();
+  auto* s = stream.get();
+  {
+    std::lock_guard<std::mutex> lk(mu_);
+    stream_ = std::move(stream);
+    first_request_ = true;
+    writes_done_ = false;
+  }
+  s->Start().then([self = shared_from_this()](future<bool> f) {
+    self->OnStart(f.get());
+  });
+}
+
+void StreamAppenderImpl::OnStart(bool ok) {
+  std::unique_lock<std::mutex> lk(mu_);
+  if (!ok) return OnBroken(std::move(lk));
+  state_ = State::kConnected;
+  reading_ = true;
+  auto* stream = stream_.get();
+  lk.unlock();
+  Read(stream);
+  lk.lock();
+  MaybeWrite(std::move(lk));
+}
+
+void StreamAppenderImpl::Read(Stream* stream) {
+  stream->Read().then(
+      [self = shared_from_this()](future<absl::optional<Response>> f) {
+        self->OnRead(f.get());
+      });
+}
+
+void StreamAppenderImpl::OnRead(absl::optional<Response> response) {
+  std::unique_lock<std::mutex> lk(mu_);
+  reading_ = false;
+  if (!response) return OnBroken(std::move(lk));
+  std::vector<std::shared_ptr<PendingAppend>> done;
+  // Ignore any responses without a matching request.
+  if (!inflight_.empty()) {
+    auto batch = std::move(inflight_.front());
+    inflight_.pop_front();
+    auto result = ToResult(*response, batch);
+    done = Resolve(batch, result);
+    if (result) {
+      retry_policy_ = options_.get<BigQueryWriteRetryPolicyOption>()->clone();
+      backoff_policy_ =
+          options_.get<BigQueryWriteBackoffPolicyOption>()->clone();
+    } else if (use_offsets_ && status_.ok()) {
+      // Any requests after the failed one have the wrong offsets, and will
+      // also fail.
+      status_ = result.status();
+      Seal();
+      for (auto const& b : pending_) {
+        auto d = Resolve(b, status_);
+        done.insert(done.end(), d.begin(), d.end());
+      }
+      pending_.clear();
+      auto d = FailWaiting(status_);
+      done.insert(done.end(), d.begin(), d.end());
+    }
+    AdmitWaiting();
+  }
+  reading_ = true;
+  auto* stream = stream_.get();
+  lk.unlock();
+  Notify(std::move(done));
+  Read(stream);
+  lk.lock();
+  MaybeWrite(std::move(lk));
+}
+
+void StreamAppenderImpl::OnWrite(bool ok) {
+  std::unique_lock<std::mutex> lk(mu_);
+  writing_ = false;
+  if (!ok || state_ == State::kFinishing) return OnBroken(std::move(lk));
+  MaybeWrite(std::move(lk));
+}
+
+void StreamAppenderImpl::OnWritesDone(bool ok) {
+  std::unique_lock<std::mutex> lk(mu_);
+  writing_ = false;
+  // Otherwise the read loop ends once the service closes the stream.
+  if (!ok || state_ == State::kFinishing) return OnBroken(std::move(lk));
+}
+
+void StreamAppenderImpl::OnBroken(std::unique_lock<std::mutex> lk) {
+  state_ = State::kFinishing;
+  if (reading_ || writing_ || !stream_) return;
+  auto stream = std::shared_ptr<Stream>(std::move(stream_));
+  lk.unlock();
+  stream->Finish().then(
+      [self = shared_from_this(), stream](future<Status> f) {
+        self->OnFinish(f.get());
+      });
+}
+
+void StreamAppenderImpl::OnFinish(Status status) {
+  std::unique_lock<std::mutex> lk(mu_);
+  state_ = State::kDisconnected;
+  // Replay any requests that were not acknowledged.
+  for (auto i = inflight_.rbegin(); i != inflight_.rend(); ++i) {
+    pending_.push_front(std::move(*i));
+  }
+  inflight_.clear();
+  if (!status_.ok()) return FailAll(std::move(lk), status_);
+  if (pending_.empty() && current_.rows == 0) {
+    if (closing_) SetClosed(std::move(lk), Status{});
+    return;
+  }
+  // The service closed the stream, e.g., because it was idle. Reconnect.
+  if (status.ok()) return MaybeWrite(std::move(lk));
+  if (!retry_policy_->OnFailure(status)) {
+    return FailAll(std::move(lk), status);
+  }
+  state_ = State::kBackoff;
+  auto const delay = backoff_policy_->OnCompletion();
+  lk.unlock();
+  cq_.MakeRelativeTimer(delay).then([self = shared_from_this()](auto f) {
+    auto tp = f.get();
+    std::unique_lock<std::mutex> lk(self->mu_);
+    self->state_ = State::kDisconnected;
+    if (!tp) return self->FailAll(std::move(lk), std::move(tp).status());
+    self->MaybeWrite(std::move(lk));
+  });
+}
+
+void StreamAppenderImpl::FailAll(std::unique_lock<std::mutex> lk,
+                                 Status const& status) {
+  if (status_.ok()) status_ = status;
+  Seal();
+  std::vector<std::shared_ptr<PendingAppend>> done;
+  for (auto* queue : {&inflight_, &pending_}) {
+    for (auto const& b : *queue) {
+      auto d = Resolve(b, status);
+      done.insert(done.end(), d.begin(), d.end());
+    }
+    queue->clear();
+  }
+  auto d = FailWaiting(status);
+  done.insert(done.end(), d.begin(), d.end());
+  auto const closing = closing_;
+  lk.unlock();
+  Notify(std::move(done));
+  if (closing) SetClosed(std::unique_lock<std::mutex>(mu_), status);
+}
+
+void StreamAppenderImpl::SetClosed(std::unique_lock<std::mutex> lk,
+                                   Status status) {
+  if (closed_) return;
+  closed_ = true;
+  close_status_ = status;
+  auto promises = std::move(close_promises_);
+  close_promises_.clear();
+  lk.unlock();
+  for (auto& p : promises) p.set_value(status);
+}
+
+StatusOr<std::int64_t> StreamAppenderImpl::ToResult(Response const& response,
+                                                    Batch const& batch) {
+  if (response.has_error()) {
+    auto status = MakeStatusFromRpcError(response.error());
+    // The rows were written by a previous request, e.g., before a reconnect.
+    if (use_offsets_ && status.code() == StatusCode::kAlreadyExists) {
+      return batch.offset;
+    }
+    return status;
+  }
+  if (response.append_result().has_offset()) {
+    return response.append_result().offset().value();
+  }
+  return batch.offset;
+}
+
+std::vector<std::shared_ptr<StreamAppenderImpl::PendingAppend>>
+StreamAppenderImpl::Resolve(Batch const& batch,
+                            StatusOr<std::int64_t> const& result) {
+  pending_bytes_ -= batch.bytes;
+  pending_rows_ -= static_cast<std::size_t>(batch.rows);
+  std::vector<std::shared_ptr<PendingAppend>> done;
+  for (auto const& p : batch.parts) {
+    auto& a = *p.append;
+    if (!result) {
+      if (a.status.ok()) a.status = result.status();
+    } else if (a.offset < 0 && *result >= 0) {
+      // Batches are resolved in order, the first one contains the first row.
+      a.offset = *result + p.index;
+    }
+    if (--a.parts == 0) done.push_back(p.append);
+  }
+  return done;
+}
+
+void StreamAppenderImpl::Notify(
+    std::vector<std::shared_ptr<PendingAppend>> done) {
+  for (auto& a : done) {
+    if (!a->status.ok()) {
+      a->done.set_value(std::move(a->status));
+    } else {
+      a->done.set_value(a->offset);
+    }
+  }
+}
+
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
+}  // namespace bigquery_storage_v1_internal
+}  // namespace cloud
+}  // namespace google
@@ -0,0 +1,186 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GOOGLE_CLOUD_CPP_GOOGLE_CLOUD_BIGQUERY_STORAGE_V1_INTERNAL_STREAM_APPENDER_IMPL_H
+#define GOOGLE_CLOUD_CPP_GOOGLE_CLOUD_BIGQUERY_STORAGE_V1_INTERNAL_STREAM_APPENDER_IMPL_H
+
+#include "google/cloud/bigquery/storage/v1/bigquery_write_connection.h"
+#include "google/cloud/async_streaming_read_write_rpc.h"
+#include "google/cloud/backoff_policy.h"
+#include "google/cloud/completion_queue.h"
+#include "google/cloud/future.h"
+#include "google/cloud/options.h"
+#include "google/cloud/status_or.h"
+#include "google/cloud/version.h"
+#include "absl/types/optional.h"
+#include <google/cloud/bigquery/storage/v1/storage.pb.h>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace google {
+namespace cloud {
+namespace bigquery_storage_v1_internal {
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_BEGIN
+
+/// Fills any missing `StreamAppender*Option` values with their defaults.
+Options StreamAppenderDefaultOptions(Options options);
+
+/**
+ * Implements `bigquery_storage_v1::StreamAppender`.
+ *
+ * Appends that exceed the flow control limits wait in `waiting_`, they are
+ * admitted, in order, as the service acknowledges earlier rows. Admitted rows
+ * are accumulated into `current_`, until the batch is full, or until the
+ * stream is ready to send a request. Full batches wait in `pending_`. Batches
+ * move to `inflight_` when they are written to the stream, and leave it when
+ * the service acknowledges them. The service acknowledges the requests in the
+ * order they are written.
+ *
+ * When the stream breaks, the class waits for any pending `Read()` and
+ * `Write()` calls, calls `Finish()`, and moves all the batches in `inflight_`
+ * back to `pending_`. If the error is transient, it reconnects after the
+ * backoff period and replays them.
+ */
+class StreamAppenderImpl
+    : public std::enable_shared_from_this<StreamAppenderImpl> {
+ public:
+  StreamAppenderImpl(
+      std::shared_ptr<bigquery_storage_v1::BigQueryWriteConnection> connection,
+      CompletionQueue cq, std::string write_stream,
+      google::cloud::bigquery::storage::v1::ProtoSchema writer_schema,
+      Options options);
+
+  future<StatusOr<std::int64_t>> Append(
+      google::cloud::bigquery::storage::v1::ProtoRows rows);
+  void Flush();
+  future<Status> Close();
+
+ private:
+  using Request = google::cloud::bigquery::storage::v1::AppendRowsRequest;
+  using Response = google::cloud::bigquery::storage::v1::AppendRowsResponse;
+  using Stream = AsyncStreamingReadWriteRpc<Request, Response>;
+
+  // The state of a single `Append()` call, whose rows may span more than one
+  // batch.
+  struct PendingAppend {
+    promise<StatusOr<std::int64_t>> done;
+    int parts = 0;
+    std::int64_t offset = -1;
+    Status status;
+  };
+
+  struct BatchPart {
+    std::shared_ptr<PendingAppend> append;
+    // The index, within the batch, of the first row in the append. Only set
+    // for the batch containing the first row.
+    std::int64_t index;
+  };
+
+  struct WaitingAppend {
+    google::cloud::bigquery::storage::v1::ProtoRows rows;
+    std::size_t bytes;
+    std::size_t count;
+    std::shared_ptr<PendingAppend> append;
+  };
+
+  struct Batch {
+    // Shared with any `Write()` calls, as the request is kept for replays.
+    std::shared_ptr<Request> request = std::make_shared<Request>();
+    // The size of the rows in the request, including their tags and lengths.
+    std::size_t bytes = 0;
+    std::int64_t rows = 0;
+    std::int64_t offset = -1;
+    std::vector<BatchPart> parts;
+  };
+
+  enum class State {
+    kDisconnected,
+    kConnecting,
+    kConnected,
+    kFinishing,
+    kBackoff,
+  };
+
+  bool Admits(std::size_t bytes, std::size_t count) const;
+  void Admit(google::cloud::bigquery::storage::v1::ProtoRows rows,
+             std::size_t bytes, std::size_t count,
+             std::shared_ptr<PendingAppend> append);
+  void AdmitWaiting();
+  std::vector<std::shared_ptr<PendingAppend>> FailWaiting(Status const& status);
+  void Seal();
+  void MaybeWrite(std::unique_lock<std::mutex> lk);
+  void Connect();
+  void OnStart(bool ok);
+  void Read(Stream* stream);
+  void OnRead(absl::optional<Response> response);
+  void OnWrite(bool ok);
+  void OnWritesDone(bool ok);
+  void OnBroken(std::unique_lock<std::mutex> lk);
+  void OnFinish(Status status);
+  void FailAll(std::unique_lock<std::mutex> lk, Status const& status);
+  void SetClosed(std::unique_lock<std::mutex> lk, Status status);
+  StatusOr<std::int64_t> ToResult(Response const& response,
+                                  Batch const& batch);
+  std::vector<std::shared_ptr<PendingAppend>> Resolve(
+      Batch const& batch, StatusOr<std::int64_t> const& result);
+  static void Notify(std::vector<std::shared_ptr<PendingAppend>> done);
+
+  std::shared_ptr<bigquery_storage_v1::BigQueryWriteConnection> connection_;
+  CompletionQueue cq_;
+  std::string write_stream_;
+  google::cloud::bigquery::storage::v1::ProtoSchema writer_schema_;
+  Options options_;
+  bool use_offsets_;
+  std::size_t max_request_bytes_;
+  // An upper bound for the bytes used by the request fields other than the
+  // rows.
+  std::size_t header_bytes_;
+  std::size_t max_pending_bytes_;
+  std::size_t max_pending_rows_;
+
+  std::mutex mu_;
+  State state_ = State::kDisconnected;
+  std::unique_ptr<Stream> stream_;
+  bool reading_ = false;
+  bool writing_ = false;
+  bool first_request_ = true;
+  bool writes_done_ = false;
+  std::deque<WaitingAppend> waiting_;
+  Batch current_;
+  std::deque<Batch> pending_;
+  std::deque<Batch> inflight_;
+  std::size_t pending_bytes_ = 0;
+  std::size_t pending_rows_ = 0;
+  std::int64_t next_offset_ = 0;
+  Status status_;
+  bool closing_ = false;
+  bool closed_ = false;
+  Status close_status_;
+  std::vector<promise<Status>> close_promises_;
+  std::unique_ptr<bigquery_storage_v1::BigQueryWriteRetryPolicy> retry_policy_;
+  std::unique_ptr<BackoffPolicy> backoff_policy_;
+};
+
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
+}  // namespace bigquery_storage_v1_internal
+}  // namespace cloud
+}  // namespace google
+
+#endif  // GOOGLE_CLOUD_CPP_GOOGLE_CLOUD_BIGQUERY_STORAGE_V1_INTERNAL_STREAM_APPENDER_IMPL_H
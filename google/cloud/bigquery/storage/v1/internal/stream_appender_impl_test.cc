@@ -0,0 +1,358 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/bigquery/storage/v1/internal/stream_appender_impl.h"
+#include "google/cloud/bigquery/storage/v1/bigquery_write_options.h"
+#include "google/cloud/bigquery/storage/v1/mocks/mock_bigquery_write_connection.h"
+#include "google/cloud/bigquery/storage/v1/stream_appender.h"
+#include "google/cloud/mocks/mock_async_streaming_read_write_rpc.h"
+#include "google/cloud/testing_util/async_sequencer.h"
+#include "google/cloud/testing_util/fake_completion_queue_impl.h"
+#include "google/cloud/testing_util/status_matchers.h"
+#include <gmock/gmock.h>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace google {
+namespace cloud {
+namespace bigquery_storage_v1_internal {
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_BEGIN
+namespace {
+
+namespace v1 = ::google::cloud::bigquery::storage::v1;
+using ::google::cloud::bigquery_storage_v1::StreamAppenderMaxPendingRowsOption;
+using ::google::cloud::bigquery_storage_v1::StreamAppenderMaxRequestBytesOption;
+using ::google::cloud::bigquery_storage_v1_mocks::MockBigQueryWriteConnection;
+using ::google::cloud::testing_util::AsyncSequencer;
+using ::google::cloud::testing_util::FakeCompletionQueueImpl;
+using ::google::cloud::testing_util::IsOkAndHolds;
+using ::google::cloud::testing_util::StatusIs;
+using ::testing::ElementsAre;
+
+using Request = v1::AppendRowsRequest;
+using Response = v1::AppendRowsResponse;
+using MockStream =
+    ::google::cloud::mocks::MockAsyncStreamingReadWriteRpc<Request, Response>;
+
+auto constexpr kDefaultStream =
+    "projects/test-project/datasets/d/tables/t/streams/_default";
+auto constexpr kCommittedStream =
+    "projects/test-project/datasets/d/tables/t/streams/s1";
+
+// The rows are padded to this size, so the request size limits in these tests
+// are not affected by the size of the other request fields.
+std::size_t constexpr kRowSize = 1000;
+
+v1::ProtoRows MakeRows(std::vector<std::string> const& values) {
+  v1::ProtoRows rows;
+  for (auto const& v : values) {
+    rows.add_serialized_rows(v + std::string(kRowSize - v.size(), '.'));
+  }
+  return rows;
+}
+
+// Returns the rows in @p request, without padding.
+std::vector<std::string> Rows(Request const& request) {
+  std::vector<std::string> result;
+  for (auto const& r : request.proto_rows().rows().serialized_rows()) {
+    result.push_back(r.substr(0, r.find('.')));
+  }
+  return result;
+}
+
+v1::ProtoSchema MakeSchema() {
+  v1::ProtoSchema schema;
+  schema.mutable_proto_descriptor()->set_name("TestRow");
+  return schema;
+}
+
+Options TestOptions() {
+  return Options{}
+      .set<bigquery_storage_v1::BigQueryWriteRetryPolicyOption>(
+          bigquery_storage_v1::BigQueryWriteLimitedErrorCountRetryPolicy(3)
+              .clone())
+      .set<bigquery_storage_v1::BigQueryWriteBackoffPolicyOption>(
+          ExponentialBackoffPolicy(std::chrono::milliseconds(1),
+                                   std::chrono::milliseconds(1), 2.0)
+              .clone());
+}
+
+/**
+ * Creates a stream controlled by @p sequencer.
+ *
+ * Each operation on the stream adds a named future to @p sequencer. `Read()`
+ * returns an acknowledgement for the oldest request, without an offset. The
+ * requests are recorded in @p requests.
+ */
+std::unique_ptr<AsyncStreamingReadWriteRpc<Request, Response>> MakeStream(
+    AsyncSequencer<bool>& sequencer, std::vector<Request>& requests,
+    Status finish = {}) {
+  auto stream = std::make_unique<MockStream>();
+  EXPECT_CALL(*stream, Start).WillOnce([&sequencer] {
+    return sequencer.PushBack("Start");
+  });
+  EXPECT_CALL(*stream, Write)
+      .WillRepeatedly([&sequencer, &requests](Request const& request,
+                                              grpc::WriteOptions) {
+        requests.push_back(request);
+        return sequencer.PushBack("Write");
+      });
+  EXPECT_CALL(*stream, Read).WillRepeatedly([&sequencer] {
+    return sequencer.PushBack("Read").then(
+        [](future<bool> f) -> absl::optional<Response> {
+          if (!f.get()) return absl::nullopt;
+          Response response;
+          response.mutable_append_result();
+          return response;
+        });
+  });
+  EXPECT_CALL(*stream, WritesDone).WillRepeatedly([&sequencer] {
+    return sequencer.PushBack("WritesDone");
+  });
+  EXPECT_CALL(*stream, Finish).WillOnce([&sequencer, finish] {
+    return sequencer.PushBack("Finish").then(
+        [finish](future<bool>) { return finish; });
+  });
+  return stream;
+}
+
+// Returns the next pending operation, which must be @p name.
+promise<bool> Pop(AsyncSequencer<bool>& sequencer, std::string const& name) {
+  auto p = sequencer.PopFrontWithName();
+  EXPECT_EQ(p.second, name);
+  return std::move(p.first);
+}
+
+// Completes the next pending operation, which must be @p name.
+void Next(AsyncSequencer<bool>& sequencer, std::string const& name,
+          bool ok = true) {
+  Pop(sequencer, name).set_value(ok);
+}
+
+// Closes the appender, @p read is the pending `Read()` call.
+void CloseAndFinish(StreamAppenderImpl& appender,
+                    AsyncSequencer<bool>& sequencer, promise<bool> read) {
+  auto closed = appender.Close();
+  Next(sequencer, "WritesDone");
+  read.set_value(false);
+  Next(sequencer, "Finish");
+  EXPECT_STATUS_OK(closed.get());
+}
+
+TEST(StreamAppenderImpl, Batching) {
+  AsyncSequencer<bool> sequencer;
+  std::vector<Request> requests;
+  auto mock = std::make_shared<MockBigQueryWriteConnection>();
+  EXPECT_CALL(*mock, AsyncAppendRows).WillOnce([&] {
+    return MakeStream(sequencer, requests);
+  });
+
+  // Each request holds at most two rows.
+  auto appender = std::make_shared<StreamAppenderImpl>(
+      mock, CompletionQueue(std::make_shared<FakeCompletionQueueImpl>()),
+      kDefaultStream, MakeSchema(),
+      TestOptions().set<StreamAppenderMaxRequestBytesOption>(2500));
+  auto a0 = appender->Append(MakeRows({"r0", "r1", "r2"}));
+  auto a1 = appender->Append(MakeRows({"r3", "r4"}));
+
+  Next(sequencer, "Start");
+  auto read = Pop(sequencer, "Read");
+  // The requests are pipelined, without waiting for acknowledgements.
+  Next(sequencer, "Write");
+  Next(sequencer, "Write");
+  Next(sequencer, "Write");
+  ASSERT_EQ(requests.size(), 3);
+  EXPECT_THAT(Rows(requests[0]), ElementsAre("r0", "r1"));
+  EXPECT_THAT(Rows(requests[1]), ElementsAre("r2", "r3"));
+  EXPECT_THAT(Rows(requests[2]), ElementsAre("r4"));
+  // Only the first request includes the stream name and the schema.
+  EXPECT_EQ(requests[0].write_stream(), kDefaultStream);
+  EXPECT_TRUE(requests[0].proto_rows().has_writer_schema());
+  for (auto const& r : {requests[1], requests[2]}) {
+    EXPECT_TRUE(r.write_stream().empty());
+    EXPECT_FALSE(r.proto_rows().has_writer_schema());
+    EXPECT_FALSE(r.has_offset());
+  }
+
+  read.set_value(true);
+  EXPECT_FALSE(a0.is_ready());
+  Next(sequencer, "Read");
+  Next(sequencer, "Read");
+  // The `_default` stream has no offsets.
+  EXPECT_THAT(a0.get(), IsOkAndHolds(-1));
+  EXPECT_THAT(a1.get(), IsOkAndHolds(-1));
+
+  CloseAndFinish(*appender, sequencer, Pop(sequencer, "Read"));
+}
+
+TEST(StreamAppenderImpl, Offsets) {
+  AsyncSequencer<bool> sequencer;
+  std::vector<Request> requests;
+  auto mock = std::make_shared<MockBigQueryWriteConnection>();
+  EXPECT_CALL(*mock, AsyncAppendRows).WillOnce([&] {
+    return MakeStream(sequencer, requests);
+  });
+
+  auto appender = std::make_shared<StreamAppenderImpl>(
+      mock, CompletionQueue(std::make_shared<FakeCompletionQueueImpl>()),
+      kCommittedStream, MakeSchema(),
+      TestOptions().set<StreamAppenderMaxRequestBytesOption>(2500));
+  auto a0 = appender->Append(MakeRows({"r0", "r1", "r2"}));
+  auto a1 = appender->Append(MakeRows({"r3", "r4"}));
+
+  Next(sequencer, "Start");
+  auto read = Pop(sequencer, "Read");
+  Next(sequencer, "Write");
+  Next(sequencer, "Write");
+  Next(sequencer, "Write");
+  std::vector<std::int64_t> offsets;
+  for (auto const& r : requests) offsets.push_back(r.offset().value());
+  EXPECT_THAT(offsets, ElementsAre(0, 2, 4));
+
+  read.set_value(true);
+  Next(sequencer, "Read");
+  Next(sequencer, "Read");
+  EXPECT_THAT(a0.get(), IsOkAndHolds(0));
+  EXPECT_THAT(a1.get(), IsOkAndHolds(3));
+
+  CloseAndFinish(*appender, sequencer, Pop(sequencer, "Read"));
+}
+
+TEST(StreamAppenderImpl, ReplayOnTransientError) {
+  AsyncSequencer<bool> sequencer;
+  std::vector<Request> requests;
+  auto mock = std::make_shared<MockBigQueryWriteConnection>();
+  EXPECT_CALL(*mock, AsyncAppendRows)
+      .WillOnce([&] {
+        return MakeStream(sequencer, requests,
+                          Status(StatusCode::kUnavailable, "try-again"));
+      })
+      .WillOnce([&] { return MakeStream(sequencer, requests); });
+
+  auto fake_cq = std::make_shared<FakeCompletionQueueImpl>();
+  // Each request holds a single row.
+  auto appender = std::make_shared<StreamAppenderImpl>(
+      mock, CompletionQueue(fake_cq), kCommittedStream, MakeSchema(),
+      TestOptions().set<StreamAppenderMaxRequestBytesOption>(1500));
+  auto a0 = appender->Append(MakeRows({"r0", "r1"}));
+
+  Next(sequencer, "Start");
+  auto read = Pop(sequencer, "Read");
+  Next(sequencer, "Write");
+  Next(sequencer, "Write", false);
+  read.set_value(false);
+  Next(sequencer, "Finish");
+  // The appender reconnects after the backoff period.
+  EXPECT_FALSE(a0.is_ready());
+  fake_cq->SimulateCompletion(true);
+
+  Next(sequencer, "Start");
+  read = Pop(sequencer, "Read");
+  Next(sequencer, "Write");
+  Next(sequencer, "Write");
+  ASSERT_EQ(requests.size(), 4);
+  std::vector<std::vector<std::string>> rows;
+  std::vector<std::int64_t> offsets;
+  for (auto const& r : requests) {
+    rows.push_back(Rows(r));
+    offsets.push_back(r.offset().value());
+  }
+  EXPECT_THAT(rows, ElementsAre(ElementsAre("r0"), ElementsAre("r1"),
+                                ElementsAre("r0"), ElementsAre("r1")));
+  EXPECT_THAT(offsets, ElementsAre(0, 1, 0, 1));
+  // The first request on the new stream includes the stream name again.
+  EXPECT_EQ(requests[2].write_stream(), kCommittedStream);
+  EXPECT_TRUE(requests[2].proto_rows().has_writer_schema());
+
+  read.set_value(true);
+  Next(sequencer, "Read");
+  EXPECT_THAT(a0.get(), IsOkAndHolds(0));
+
+  CloseAndFinish(*appender, sequencer, Pop(sequencer, "Read"));
+}
+
+TEST(StreamAppenderImpl, FlowControl) {
+  AsyncSequencer<bool> sequencer;
+  std::vector<Request> requests;
+  auto mock = std::make_shared<MockBigQueryWriteConnection>();
+  EXPECT_CALL(*mock, AsyncAppendRows).WillOnce([&] {
+    return MakeStream(sequencer, requests);
+  });
+
+  auto appender = std::make_shared<StreamAppenderImpl>(
+      mock, CompletionQueue(std::make_shared<FakeCompletionQueueImpl>()),
+      kCommittedStream, MakeSchema(),
+      TestOptions().set<StreamAppenderMaxPendingRowsOption>(2));
+  auto a0 = appender->Append(MakeRows({"r0", "r1"}));
+  // These appends exceed the limits, they wait without blocking.
+  auto a1 = appender->Append(MakeRows({"r2"}));
+  auto a2 = appender->Append(MakeRows({"r3"}));
+  // Appending from a continuation does not block either.
+  future<StatusOr<std::int64_t>> a3;
+  auto chained = a0.then([&](auto) {
+    a3 = appender->Append(MakeRows({"r4"}));
+  });
+
+  Next(sequencer, "Start");
+  auto read = Pop(sequencer, "Read");
+  Next(sequencer, "Write");
+  ASSERT_EQ(requests.size(), 1);
+  EXPECT_THAT(Rows(requests[0]), ElementsAre("r0", "r1"));
+
+  // Once the first rows are acknowledged the waiting appends are sent.
+  read.set_value(true);
+  chained.get();
+  read = Pop(sequencer, "Read");
+  Next(sequencer, "Write");
+  ASSERT_EQ(requests.size(), 2);
+  EXPECT_THAT(Rows(requests[1]), ElementsAre("r2", "r3"));
+  EXPECT_FALSE(a3.is_ready());
+
+  read.set_value(true);
+  EXPECT_THAT(a1.get(), IsOkAndHolds(2));
+  EXPECT_THAT(a2.get(), IsOkAndHolds(3));
+  read = Pop(sequencer, "Read");
+  Next(sequencer, "Write");
+  ASSERT_EQ(requests.size(), 3);
+  EXPECT_THAT(Rows(requests[2]), ElementsAre("r4"));
+
+  read.set_value(true);
+  EXPECT_THAT(a3.get(), IsOkAndHolds(4));
+
+  CloseAndFinish(*appender, sequencer, Pop(sequencer, "Read"));
+}
+
+TEST(StreamAppenderImpl, RequestSizeIncludesOtherFields) {
+  auto mock = std::make_shared<MockBigQueryWriteConnection>();
+  EXPECT_CALL(*mock, AsyncAppendRows).Times(0);
+
+  // The row fits, but not with the stream name and schema.
+  auto appender = std::make_shared<StreamAppenderImpl>(
+      mock, CompletionQueue(std::make_shared<FakeCompletionQueueImpl>()),
+      kCommittedStream, MakeSchema(),
+      TestOptions().set<StreamAppenderMaxRequestBytesOption>(kRowSize + 8));
+  auto a0 = appender->Append(MakeRows({"r0"}));
+  EXPECT_THAT(a0.get(), StatusIs(StatusCode::kInvalidArgument));
+  EXPECT_STATUS_OK(appender->Close().get());
+}
+
+}  // namespace
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
+}  // namespace bigquery_storage_v1_internal
+}  // namespace cloud
+}  // namespace google
@@ -0,0 +1,302 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/bigquery/storage/v1/parallel_read.h"
+#include "absl/types/optional.h"
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace google {
+namespace cloud {
+namespace bigquery_storage_v1 {
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_BEGIN
+namespace {
+
+namespace v1 = ::google::cloud::bigquery::storage::v1;
+
+// Streams that are almost fully read are not worth splitting.
+auto constexpr kMaxSplitProgress = 0.9;
+
+/// Wraps the serialized rows in @p response without copying them.
+absl::Cord MakeBlockData(v1::ReadRowsResponse response) {
+  auto holder = std::make_shared<v1::ReadRowsResponse>(std::move(response));
+  absl::string_view contents;
+  if (holder->has_arrow_record_batch()) {
+    contents = holder->arrow_record_batch().serialized_record_batch();
+  } else if (holder->has_avro_rows()) {
+    contents = holder->avro_rows().serialized_binary_rows();
+  }
+  if (contents.empty()) return absl::Cord();
+  return absl::MakeCordFromExternal(contents,
+                                    [b = std::move(holder)]() mutable {});
+}
+
+/**
+ * The service rejects a split when the primary stream ends before the current
+ * read offset. The reader must then continue with the original stream, and
+ * discard the remainder.
+ */
+bool IsSplitRejected(Status const& status) {
+  return status.code() == StatusCode::kFailedPrecondition ||
+         status.code() == StatusCode::kOutOfRange;
+}
+
+/**
+ * Reads all the streams in a session using a fixed number of worker threads.
+ *
+ * Each worker takes the next pending stream, and reads it to completion. When
+ * stream splitting is enabled, workers without a pending stream ask the
+ * service to split the active stream with the least progress. The worker
+ * reading that stream switches to the primary stream at its current offset,
+ * and queues the remainder for the idle workers.
+ */
+class ParallelReader {
+ public:
+  ParallelReader(std::shared_ptr<BigQueryReadConnection> connection,
+                 std::shared_ptr<v1::ReadSession const> session,
+                 ReadStreamBlockConsumer consumer, Options options)
+      : connection_(std::move(connection)),
+        session_(std::move(session)),
+        consumer_(std::move(consumer)),
+        options_(std::move(options)),
+        split_streams_(options_.get<ParallelReadSplitStreamsOption>()) {
+    for (auto const& s : session_->streams()) pending_.push_back(s.name());
+  }
+
+  Status Run() {
+    if (pending_.empty()) return Status{};
+    // Sessions may have thousands of streams, do not start a thread for each
+    // one unless the application asks for it.
+    std::size_t concurrency = std::thread::hardware_concurrency();
+    if (options_.has<ParallelReadMaxConcurrencyOption>()) {
+      concurrency = options_.get<ParallelReadMaxConcurrencyOption>();
+    }
+    if (!split_streams_) concurrency = (std::min)(concurrency, pending_.size());
+    std::vector<std::thread> workers((std::max)(concurrency, std::size_t{1}));
+    for (auto& w : workers) w = std::thread([this] { Worker(); });
+    for (auto& w : workers) w.join();
+    return status_;
+  }
+
+ private:
+  struct ActiveStream {
+    explicit ActiveStream(std::string n) : name(std::move(n)) {}
+
+    std::string name;
+    std::int64_t offset = 0;
+    double progress = 0.0;
+    bool splittable = true;
+    // A `SplitReadStream()` call for this stream is in progress, or its
+    // result is waiting for the worker reading the stream.
+    bool splitting = false;
+    absl::optional<v1::SplitReadStreamResponse> split;
+  };
+  using Reader = StreamRange<v1::ReadRowsResponse>;
+
+  void Worker() {
+    internal::OptionsSpan span(options_);
+    for (auto s = NextStream(); s; s = NextStream()) {
+      auto status = ReadStream(*s);
+      Done(s, std::move(status));
+    }
+  }
+
+  std::unique_ptr<Reader> OpenStream(std::string const& name,
+                                     std::int64_t offset) {
+    v1::ReadRowsRequest request;
+    request.set_read_stream(name);
+    request.set_offset(offset);
+    return std::make_unique<Reader>(connection_->ReadRows(request));
+  }
+
+  Status ReadStream(ActiveStream& s) {
+    auto reader = OpenStream(s.name, s.offset);
+    for (auto i = reader->begin(); i != reader->end();) {
+      if (!*i) return std::move(*i).status();
+      ReadStreamBlock block;
+      block.session = session_;
+      block.stream_name = s.name;
+      block.offset = s.offset;
+      block.row_count = (*i)->row_count();
+      auto const progress = (*i)->stats().progress().at_response_end();
+      block.data = MakeBlockData(*std::move(*i));
+      auto const row_count = block.row_count;
+      auto status = consumer_(std::move(block));
+      if (!status.ok()) return status;
+
+      std::unique_lock<std::mutex> lk(mu_);
+      // Stop early if any other stream failed.
+      if (!status_.ok()) return Status{};
+      s.offset += row_count;
+      s.progress = progress;
+      if (!s.split) {
+        lk.unlock();
+        ++i;
+        continue;
+      }
+      auto split = *std::move(s.split);
+      s.split.reset();
+      lk.unlock();
+
+      auto primary = OpenStream(split.primary_stream().name(), s.offset);
+      auto p = primary->begin();
+      auto const rejected = p != primary->end() && !*p;
+      lk.lock();
+      s.splitting = false;
+      --splitting_;
+      if (rejected && IsSplitRejected(p->status())) {
+        s.splittable = false;
+        cv_.notify_all();
+        lk.unlock();
+        ++i;
+        continue;
+      }
+      if (rejected) {
+        cv_.notify_all();
+        return p->status();
+      }
+      s.name = split.primary_stream().name();
+      pending_.push_back(split.remainder_stream().name());
+      cv_.notify_all();
+      lk.unlock();
+      reader = std::move(primary);
+      i = reader->begin();
+    }
+    return Status{};
+  }
+
+  std::shared_ptr<ActiveStream> NextStream() {
+    std::unique_lock<std::mutex> lk(mu_);
+    while (status_.ok()) {
+      if (!pending_.empty()) {
+        auto s = std::make_shared<ActiveStream>(std::move(pending_.front()));
+        pending_.pop_front();
+        active_.push_back(s);
+        return s;
+      }
+      if (!split_streams_ || active_.empty()) break;
+      auto candidate = SplitCandidate();
+      if (candidate) {
+        Split(lk, std::move(candidate));
+        continue;
+      }
+      if (splitting_ == 0) break;
+      cv_.wait(lk);
+    }
+    return nullptr;
+  }
+
+  std::shared_ptr<ActiveStream> SplitCandidate() const {
+    std::shared_ptr<ActiveStream> candidate;
+    for (auto const& s : active_) {
+      if (!s->splittable || s->splitting) continue;
+      if (s->progress >= kMaxSplitProgress) continue;
+      if (!candidate || s->progress < candidate->progress) candidate = s;
+    }
+    return candidate;
+  }
+
+  void Split(std::unique_lock<std::mutex>& lk,
+             std::shared_ptr<ActiveStream> candidate) {
+    candidate->splitting = true;
+    ++splitting_;
+    v1::SplitReadStreamRequest request;
+    request.set_name(candidate->name);
+    request.set_fraction(candidate->progress +
+                         (1.0 - candidate->progress) / 2);
+    lk.unlock();
+    auto response = connection_->SplitReadStream(request);
+    lk.lock();
+    auto const is_active = std::find(active_.begin(), active_.end(),
+                                     candidate) != active_.end();
+    // An empty response means the stream cannot be split any further. If the
+    // stream finished while the split was in progress then the worker read
+    // all its rows, including those in the remainder.
+    if (!is_active || !response ||
+        response->primary_stream().name().empty() ||
+        response->remainder_stream().name().empty()) {
+      candidate->splittable = false;
+      candidate->splitting = false;
+      --splitting_;
+      cv_.notify_all();
+      return;
+    }
+    candidate->split = *std::move(response);
+  }
+
+  void Done(std::shared_ptr<ActiveStream> const& s, Status status) {
+    std::lock_guard<std::mutex> lk(mu_);
+    active_.erase(std::remove(active_.begin(), active_.end(), s),
+                  active_.end());
+    if (s->split) {
+      s->split.reset();
+      s->splitting = false;
+      --splitting_;
+    }
+    if (!status.ok() && status_.ok()) status_ = std::move(status);
+    cv_.notify_all();
+  }
+
+  std::shared_ptr<BigQueryReadConnection> connection_;
+  std::shared_ptr<v1::ReadSession const> session_;
+  ReadStreamBlockConsumer consumer_;
+  Options options_;
+  bool split_streams_;
+
+  std::mutex mu_;
+  std::condition_variable cv_;
+  std::deque<std::string> pending_;
+  std::vector<std::shared_ptr<ActiveStream>> active_;
+  int splitting_ = 0;
+  Status status_;
+};
+
+}  // namespace
+
+Status ParallelReadRows(std::shared_ptr<BigQueryReadConnection> connection,
+                        v1::ReadSession session,
+                        ReadStreamBlockConsumer consumer, Options opts) {
+  auto options = internal::MergeOptions(std::move(opts), connection->options());
+  ParallelReader reader(
+      std::move(connection),
+      std::make_shared<v1::ReadSession const>(std::move(session)),
+      std::move(consumer), std::move(options));
+  return reader.Run();
+}
+
+Status ParallelReadRows(std::shared_ptr<BigQueryReadConnection> connection,
+                        v1::CreateReadSessionRequest const& request,
+                        ReadStreamBlockConsumer consumer, Options opts) {
+  auto options = internal::MergeOptions(std::move(opts), connection->options());
+  auto session = [&] {
+    internal::OptionsSpan span(options);
+    return connection->CreateReadSession(request);
+  }();
+  if (!session) return std::move(session).status();
+  ParallelReader reader(
+      std::move(connection),
+      std::make_shared<v1::ReadSession const>(*std::move(session)),
+      std::move(consumer), std::move(options));
+  return reader.Run();
+}
+
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
+}  // namespace bigquery_storage_v1
+}  // namespace cloud
+}  // namespace google
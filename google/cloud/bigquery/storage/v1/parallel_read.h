@@ -0,0 +1,142 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GOOGLE_CLOUD_CPP_GOOGLE_CLOUD_BIGQUERY_STORAGE_V1_PARALLEL_READ_H
+#define GOOGLE_CLOUD_CPP_GOOGLE_CLOUD_BIGQUERY_STORAGE_V1_PARALLEL_READ_H
+
+#include "google/cloud/bigquery/storage/v1/bigquery_read_connection.h"
+#include "google/cloud/options.h"
+#include "google/cloud/status.h"
+#include "google/cloud/version.h"
+#include "absl/strings/cord.h"
+#include <google/cloud/bigquery/storage/v1/storage.pb.h>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+
+namespace google {
+namespace cloud {
+namespace bigquery_storage_v1 {
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_BEGIN
+
+/**
+ * The serialized rows contained in a single `ReadRowsResponse`.
+ *
+ * The library moves the `ReadRowsResponse` into the `absl::Cord` that holds
+ * `data`, the serialized Arrow record batch (or Avro block) is not copied.
+ */
+struct ReadStreamBlock {
+  /// The read session that contains the stream.
+  std::shared_ptr<google::cloud::bigquery::storage::v1::ReadSession const>
+      session;
+
+  /**
+   * The name of the stream that returned this block.
+   *
+   * This may be a stream created by `SplitReadStream()`, and thus not one of
+   * the streams listed in `session`.
+   */
+  std::string stream_name;
+
+  /// The offset, within `stream_name`, of the first row in this block.
+  std::int64_t offset = 0;
+
+  /// The number of rows in this block.
+  std::int64_t row_count = 0;
+
+  /**
+   * The contents of `serialized_record_batch` for Arrow sessions, or
+   * `serialized_binary_rows` for Avro sessions.
+   */
+  absl::Cord data;
+};
+
+/**
+ * The callback type used to consume the blocks in a parallel read.
+ *
+ * The callback is invoked concurrently from multiple threads, at most once at
+ * a time for each stream. Blocks from the same stream are delivered in order.
+ * Returning a non-OK status stops the read, and the status is returned to the
+ * caller.
+ */
+using ReadStreamBlockConsumer = std::function<Status(ReadStreamBlock)>;
+
+/**
+ * Use with `google::cloud::Options` to configure the maximum number of streams
+ * read concurrently by `ParallelReadRows()`.
+ *
+ * The default is `std::thread::hardware_concurrency()`. Set a larger value if
+ * the consumer blocks, for example, on I/O. Without
+ * `ParallelReadSplitStreamsOption` the number of threads is also bounded by the
+ * number of streams in the session.
+ *
+ * @ingroup google-cloud-bigquery-options
+ */
+struct ParallelReadMaxConcurrencyOption {
+  using Type = std::size_t;
+};
+
+/**
+ * Use with `google::cloud::Options` to rebalance work in `ParallelReadRows()`.
+ *
+ * When enabled, a worker that runs out of streams splits the stream with the
+ * least progress (using `SplitReadStream()`) and reads the remainder. This is
+ * useful when the session has fewer streams than the desired concurrency, or
+ * when some streams are much larger than others. The default is `false`.
+ *
+ * @ingroup google-cloud-bigquery-options
+ */
+struct ParallelReadSplitStreamsOption {
+  using Type = bool;
+};
+
+/**
+ * Reads all the rows in @p session, using multiple streams in parallel.
+ *
+ * The function blocks until all the streams are fully read, or until one of
+ * them fails. Each stream is resumed at its last received row offset after
+ * transient errors, as configured by `BigQueryReadRetryPolicyOption`.
+ *
+ * @param connection the connection used to read the streams.
+ * @param session a session created by `CreateReadSession()`.
+ * @param consumer the callback that receives the data.
+ * @param opts override the connection options, including the
+ *     `ParallelRead*Option` values.
+ */
+Status ParallelReadRows(
+    std::shared_ptr<BigQueryReadConnection> connection,
+    google::cloud::bigquery::storage::v1::ReadSession session,
+    ReadStreamBlockConsumer consumer, Options opts = {});
+
+/**
+ * Creates a read session and reads all its rows in parallel.
+ *
+ * This is a convenience function, it calls `CreateReadSession()` with
+ * @p request and then reads the resulting session with `ParallelReadRows()`.
+ * The session is available to @p consumer via `ReadStreamBlock::session`.
+ */
+Status ParallelReadRows(
+    std::shared_ptr<BigQueryReadConnection> connection,
+    google::cloud::bigquery::storage::v1::CreateReadSessionRequest const&
+        request,
+    ReadStreamBlockConsumer consumer, Options opts = {});
+
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
+}  // namespace bigquery_storage_v1
+}  // namespace cloud
+}  // namespace google
+
+#endif  // GOOGLE_CLOUD_CPP_GOOGLE_CLOUD_BIGQUERY_STORAGE_V1_PARALLEL_READ_H
@@ -0,0 +1,174 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/bigquery/storage/v1/parallel_read.h"
+#include "google/cloud/bigquery/storage/v1/mocks/mock_bigquery_read_connection.h"
+#include "google/cloud/mocks/mock_stream_range.h"
+#include "google/cloud/testing_util/status_matchers.h"
+#include <gmock/gmock.h>
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace google {
+namespace cloud {
+namespace bigquery_storage_v1 {
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_BEGIN
+namespace {
+
+namespace v1 = ::google::cloud::bigquery::storage::v1;
+using ::google::cloud::bigquery_storage_v1_mocks::MockBigQueryReadConnection;
+using ::google::cloud::testing_util::StatusIs;
+using ::testing::Return;
+using ::testing::UnorderedElementsAreArray;
+
+std::size_t DefaultConcurrency() {
+  return (std::max)(std::size_t{1},
+                    std::size_t{std::thread::hardware_concurrency()});
+}
+
+v1::ReadSession MakeSession(std::size_t stream_count) {
+  v1::ReadSession session;
+  session.set_name("test-session");
+  for (std::size_t i = 0; i != stream_count; ++i) {
+    session.add_streams()->set_name("s" + std::to_string(i));
+  }
+  return session;
+}
+
+// Each stream returns a single block, containing the stream name.
+StreamRange<v1::ReadRowsResponse> ReadRowsFromName(
+    v1::ReadRowsRequest const& request) {
+  v1::ReadRowsResponse response;
+  response.set_row_count(1);
+  response.mutable_arrow_record_batch()->set_serialized_record_batch(
+      request.read_stream());
+  response.mutable_stats()->mutable_progress()->set_at_response_end(1.0);
+  return mocks::MakeStreamRange<v1::ReadRowsResponse>({std::move(response)});
+}
+
+/**
+ * Counts the consumer calls running at the same time.
+ *
+ * The consumers wait until `target` calls overlap, or until the deadline
+ * expires. Once the target is reached the remaining calls do not wait.
+ */
+class ConcurrencyTracker {
+ public:
+  explicit ConcurrencyTracker(std::size_t target) : target_(target) {}
+
+  Status Consume(ReadStreamBlock block) {
+    std::unique_lock<std::mutex> lk(mu_);
+    names_.emplace_back(block.data);
+    max_active_ = (std::max)(max_active_, ++active_);
+    if (active_ >= target_) released_ = true;
+    cv_.notify_all();
+    cv_.wait_for(lk, std::chrono::seconds(30), [this] { return released_; });
+    --active_;
+    return Status{};
+  }
+
+  std::size_t max_active() const { return max_active_; }
+  std::vector<std::string> const& names() const { return names_; }
+
+ private:
+  std::size_t const target_;
+  std::mutex mu_;
+  std::condition_variable cv_;
+  std::size_t active_ = 0;
+  std::size_t max_active_ = 0;
+  bool released_ = false;
+  std::vector<std::string> names_;
+};
+
+std::vector<std::string> StreamNames(v1::ReadSession const& session) {
+  std::vector<std::string> names;
+  for (auto const& s : session.streams()) names.push_back(s.name());
+  return names;
+}
+
+TEST(ParallelReadRows, DefaultConcurrency) {
+  auto const concurrency = DefaultConcurrency();
+  auto const session = MakeSession(4 * concurrency + 1);
+  auto mock = std::make_shared<MockBigQueryReadConnection>();
+  EXPECT_CALL(*mock, options).WillRepeatedly(Return(Options{}));
+  EXPECT_CALL(*mock, ReadRows).WillRepeatedly(ReadRowsFromName);
+
+  ConcurrencyTracker tracker(concurrency);
+  auto status = ParallelReadRows(mock, session, [&](ReadStreamBlock b) {
+    return tracker.Consume(std::move(b));
+  });
+  ASSERT_STATUS_OK(status);
+  EXPECT_THAT(tracker.names(), UnorderedElementsAreArray(StreamNames(session)));
+  EXPECT_LE(tracker.max_active(), concurrency);
+}
+
+TEST(ParallelReadRows, ConcurrencyOptionRaisesLimit) {
+  auto const concurrency = DefaultConcurrency() + 2;
+  auto const session = MakeSession(concurrency);
+  auto mock = std::make_shared<MockBigQueryReadConnection>();
+  EXPECT_CALL(*mock, options).WillRepeatedly(Return(Options{}));
+  EXPECT_CALL(*mock, ReadRows).WillRepeatedly(ReadRowsFromName);
+
+  ConcurrencyTracker tracker(concurrency);
+  auto status = ParallelReadRows(
+      mock, session,
+      [&](ReadStreamBlock b) { return tracker.Consume(std::move(b)); },
+      Options{}.set<ParallelReadMaxConcurrencyOption>(concurrency));
+  ASSERT_STATUS_OK(status);
+  EXPECT_THAT(tracker.names(), UnorderedElementsAreArray(StreamNames(session)));
+  EXPECT_EQ(tracker.max_active(), concurrency);
+}
+
+TEST(ParallelReadRows, ConcurrencyOptionLowersLimit) {
+  auto const session = MakeSession(8);
+  auto mock = std::make_shared<MockBigQueryReadConnection>();
+  EXPECT_CALL(*mock, options).WillRepeatedly(Return(Options{}));
+  EXPECT_CALL(*mock, ReadRows).WillRepeatedly(ReadRowsFromName);
+
+  ConcurrencyTracker tracker(1);
+  auto status = ParallelReadRows(
+      mock, session,
+      [&](ReadStreamBlock b) { return tracker.Consume(std::move(b)); },
+      Options{}.set<ParallelReadMaxConcurrencyOption>(1));
+  ASSERT_STATUS_OK(status);
+  EXPECT_THAT(tracker.names(), UnorderedElementsAreArray(StreamNames(session)));
+  EXPECT_EQ(tracker.max_active(), std::size_t{1});
+}
+
+TEST(ParallelReadRows, ReadErrorStopsRead) {
+  auto mock = std::make_shared<MockBigQueryReadConnection>();
+  EXPECT_CALL(*mock, options).WillRepeatedly(Return(Options{}));
+  EXPECT_CALL(*mock, ReadRows).WillRepeatedly([](v1::ReadRowsRequest const& r) {
+    if (r.read_stream() != "s1") return ReadRowsFromName(r);
+    return mocks::MakeStreamRange<v1::ReadRowsResponse>(
+        {}, Status(StatusCode::kPermissionDenied, "uh-oh"));
+  });
+
+  auto status = ParallelReadRows(mock, MakeSession(4),
+                                 [](ReadStreamBlock) { return Status{}; });
+  EXPECT_THAT(status, StatusIs(StatusCode::kPermissionDenied));
+}
+
+}  // namespace
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
+}  // namespace bigquery_storage_v1
+}  // namespace cloud
+}  // namespace google
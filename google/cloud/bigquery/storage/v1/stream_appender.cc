@@ -0,0 +1,71 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/bigquery/storage/v1/stream_appender.h"
+#include "google/cloud/bigquery/storage/v1/internal/bigquery_write_option_defaults.h"
+#include "google/cloud/bigquery/storage/v1/internal/stream_appender_impl.h"
+#include "google/cloud/grpc_options.h"
+#include "google/cloud/internal/background_threads_impl.h"
+#include <utility>
+
+namespace google {
+namespace cloud {
+namespace bigquery_storage_v1 {
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_BEGIN
+namespace {
+
+// The completion queue for the backoff timers between reconnects.
+CompletionQueue TimerQueue(Options const& options) {
+  if (options.has<GrpcCompletionQueueOption>()) {
+    return options.get<GrpcCompletionQueueOption>();
+  }
+  // The appenders only run timers in this queue, one thread is enough for all
+  // of them. The thread is never stopped, as the timers may outlive any
+  // appender.
+  static auto* const kThreads =
+      new internal::AutomaticallyCreatedBackgroundThreads(1);
+  return kThreads->cq();
+}
+
+}  // namespace
+
+StreamAppender::StreamAppender(
+    std::shared_ptr<BigQueryWriteConnection> connection,
+    std::string write_stream,
+    google::cloud::bigquery::storage::v1::ProtoSchema writer_schema,
+    Options opts) {
+  auto options = bigquery_storage_v1_internal::BigQueryWriteDefaultOptions(
+      internal::MergeOptions(std::move(opts), connection->options()));
+  auto cq = TimerQueue(options);
+  impl_ = std::make_shared<bigquery_storage_v1_internal::StreamAppenderImpl>(
+      std::move(connection), std::move(cq), std::move(write_stream),
+      std::move(writer_schema), std::move(options));
+}
+
+// The pending operations keep `impl_` alive until the stream is closed.
+StreamAppender::~StreamAppender() { impl_->Close(); }
+
+future<StatusOr<std::int64_t>> StreamAppender::Append(
+    google::cloud::bigquery::storage::v1::ProtoRows rows) {
+  return impl_->Append(std::move(rows));
+}
+
+void StreamAppender::Flush() { impl_->Flush(); }
+
+future<Status> StreamAppender::Close() { return impl_->Close(); }
+
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
+}  // namespace bigquery_storage_v1
+}  // namespace cloud
+}  // namespace google
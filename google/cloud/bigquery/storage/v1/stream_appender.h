@@ -0,0 +1,191 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GOOGLE_CLOUD_CPP_GOOGLE_CLOUD_BIGQUERY_STORAGE_V1_STREAM_APPENDER_H
+#define GOOGLE_CLOUD_CPP_GOOGLE_CLOUD_BIGQUERY_STORAGE_V1_STREAM_APPENDER_H
+
+#include "google/cloud/bigquery/storage/v1/bigquery_write_connection.h"
+#include "google/cloud/future.h"
+#include "google/cloud/options.h"
+#include "google/cloud/status_or.h"
+#include "google/cloud/version.h"
+#include <google/cloud/bigquery/storage/v1/storage.pb.h>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace google {
+namespace cloud {
+namespace bigquery_storage_v1_internal {
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_BEGIN
+class StreamAppenderImpl;
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
+}  // namespace bigquery_storage_v1_internal
+
+namespace bigquery_storage_v1 {
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_BEGIN
+
+/**
+ * Use with `google::cloud::Options` to configure the maximum size of each
+ * `AppendRowsRequest` sent by `StreamAppender`.
+ *
+ * The limit applies to the full request, including the writer schema, the
+ * stream name, and the framing of each row. The service rejects requests
+ * larger than 10 MB, the default is 8 MiB.
+ *
+ * @ingroup google-cloud-bigquery-options
+ */
+struct StreamAppenderMaxRequestBytesOption {
+  using Type = std::size_t;
+};
+
+/**
+ * Use with `google::cloud::Options` to configure the flow control in
+ * `StreamAppender`.
+ *
+ * Rows passed to `StreamAppender::Append()` wait, without being sent, while
+ * the rows not yet acknowledged by the service exceed this number of bytes.
+ * The default is 64 MiB.
+ *
+ * @ingroup google-cloud-bigquery-options
+ */
+struct StreamAppenderMaxPendingBytesOption {
+  using Type = std::size_t;
+};
+
+/**
+ * Use with `google::cloud::Options` to configure the flow control in
+ * `StreamAppender`.
+ *
+ * Rows passed to `StreamAppender::Append()` wait, without being sent, while
+ * the rows not yet acknowledged by the service exceed this count. By default
+ * only the number of bytes is limited.
+ *
+ * @ingroup google-cloud-bigquery-options
+ */
+struct StreamAppenderMaxPendingRowsOption {
+  using Type = std::size_t;
+};
+
+/**
+ * Appends rows to a BigQuery write stream.
+ *
+ * `AppendRows()` is a bidirectional streaming RPC, where each request must be
+ * acknowledged by the service. This class hides these details:
+ *
+ * - Rows from multiple `Append()` calls are batched into a single request,
+ *   without exceeding `StreamAppenderMaxRequestBytesOption`. Batches are sent
+ *   as soon as the stream is ready, and are pipelined, that is, the class does
+ *   not wait for the acknowledgement of a request before sending the next.
+ * - For streams other than the `_default` stream, each request includes the
+ *   offset of its first row. The service discards any rows it has already
+ *   received, which provides exactly-once semantics.
+ * - If the stream breaks with a transient error, the class reconnects and
+ *   replays any requests that were not acknowledged. The retry and backoff
+ *   policies are configured with `BigQueryWriteRetryPolicyOption` and
+ *   `BigQueryWriteBackoffPolicyOption`.
+ * - `Append()` never blocks. When the rows pending acknowledgement exceed the
+ *   limits set by `StreamAppenderMaxPendingBytesOption` and
+ *   `StreamAppenderMaxPendingRowsOption`, new rows wait in the appender
+ *   until the service acknowledges earlier rows. Applications that need to
+ *   bound their memory usage should wait on the futures returned by
+ *   `Append()`.
+ *
+ * @par Example
+ * @code
+ * namespace bigquery = ::google::cloud::bigquery_storage_v1;
+ * bigquery::StreamAppender appender(
+ *     bigquery::MakeBigQueryWriteConnection(), stream_name, schema);
+ * google::cloud::bigquery::storage::v1::ProtoRows rows;
+ * *rows.add_serialized_rows() = MyRow(...).SerializeAsString();
+ * auto offset = appender.Append(std::move(rows));
+ * ...
+ * auto status = appender.Close().get();
+ * @endcode
+ */
+class StreamAppender {
+ public:
+  /**
+   * Creates an appender for @p write_stream.
+   *
+   * @param connection the connection used to make the `AppendRows()` calls.
+   * @param write_stream the full name of the write stream, for example
+   *     `projects/p/datasets/d/tables/t/streams/_default`.
+   * @param writer_schema the schema of the serialized rows.
+   * @param opts override the connection options, including the
+   *     `StreamAppender*Option` values.
+   *
+   * The appender runs the streaming RPCs in the completion queue of
+   * @p connection. It also needs a completion queue for the backoff timers
+   * between reconnects. If the options include `GrpcCompletionQueueOption`,
+   * the appender uses that queue, otherwise it uses a single background thread
+   * shared by all the appenders in the process.
+   */
+  StreamAppender(
+      std::shared_ptr<BigQueryWriteConnection> connection,
+      std::string write_stream,
+      google::cloud::bigquery::storage::v1::ProtoSchema writer_schema,
+      Options opts = {});
+
+  /**
+   * Starts closing the appender, without waiting for the result.
+   *
+   * Any rows already appended are still sent, and the futures returned by
+   * `Append()` are satisfied as usual. Use `Close()` to wait until all the
+   * rows are acknowledged.
+   */
+  ~StreamAppender();
+
+  StreamAppender(StreamAppender const&) = delete;
+  StreamAppender& operator=(StreamAppender const&) = delete;
+
+  /**
+   * Appends @p rows to the stream.
+   *
+   * The returned future is satisfied when the service acknowledges all the
+   * rows. Its value is the offset of the first row in @p rows, or -1 when
+   * writing to the `_default` stream, where the offsets are not known.
+   *
+   * This function does not block, and it is safe to call from any thread,
+   * including the continuations of the futures it returns. While the rows
+   * pending acknowledgement exceed the `StreamAppenderMaxPendingBytesOption`
+   * or `StreamAppenderMaxPendingRowsOption` limits, @p rows wait in the
+   * appender, and are sent in order once the service acknowledges earlier
+   * rows.
+   */
+  future<StatusOr<std::int64_t>> Append(
+      google::cloud::bigquery::storage::v1::ProtoRows rows);
+
+  /// Sends any rows waiting for the current request to complete.
+  void Flush();
+
+  /**
+   * Flushes any pending rows and closes the stream.
+   *
+   * The returned future is satisfied once all the rows are acknowledged, and
+   * the streaming RPC is closed. Calls to `Append()` after `Close()` fail.
+   */
+  future<Status> Close();
+
+ private:
+  std::shared_ptr<bigquery_storage_v1_internal::StreamAppenderImpl> impl_;
+};
+
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
+}  // namespace bigquery_storage_v1
+}  // namespace cloud
+}  // namespace google
+
+#endif  // GOOGLE_CLOUD_CPP_GOOGLE_CLOUD_BIGQUERY_STORAGE_V1_STREAM_APPENDER_H
@@ -63,6 +63,11 @@ gRPC server that implements the Cloud Bigtable APIs used by the benchmark.  If
 this parameter is not used the benchmark uses the default configuration, that
 is, a production instance of Cloud Bigtable unless the CLOUD_BIGTABLE_EMULATOR
 environment variable is set.
+
+With `--read-row-coalescing-window=N` all the threads share one connection, and
+`ReadRow()` calls started within N microseconds of each other are sent as a
+single `ReadRows` request. Compare the `ReadRow()` latencies and the number of
+requests against a run without this option.
 )""";
 
 /// Helper functions and types for the apply_read_latency_benchmark.
@@ -85,7 +90,7 @@ struct LatencyBenchmarkResult {
 
 /// Run an iteration of the test.
 google::cloud::StatusOr<LatencyBenchmarkResult> RunBenchmark(
-    bigtable::benchmarks::Benchmark const& benchmark,
+    bigtable::benchmarks::Benchmark const& benchmark, bigtable::Table table,
     std::chrono::seconds test_duration);
 
 ///@{
@@ -122,14 +127,19 @@ int main(int argc, char* argv[]) {
   auto latency_test_start = std::chrono::steady_clock::now();
   std::vector<std::future<google::cloud::StatusOr<LatencyBenchmarkResult>>>
       tasks;
+  // `ReadRow()` calls can only be coalesced if the threads share a connection.
+  auto const share_connection = options->read_row_coalescing_window.count() > 0;
+  auto shared_table = benchmark.MakeTable();
   for (int i = 0; i != options->thread_count; ++i) {
     auto launch_policy = std::launch::async;
     if (options->thread_count == 1) {
       // If the user requests only one thread, use the current thread.
       launch_policy = std::launch::deferred;
     }
+    auto table = share_connection ? shared_table : benchmark.MakeTable();
     tasks.emplace_back(std::async(launch_policy, RunBenchmark,
-                                  std::ref(benchmark), options->test_duration));
+                                  std::ref(benchmark), std::move(table),
+                                  options->test_duration));
   }
 
   // Wait for the threads and combine all the results.
@@ -168,6 +178,10 @@ int main(int argc, char* argv[]) {
                                 combined.apply_results);
   Benchmark::PrintLatencyResult(std::cout, "perf", "ReadRow()",
                                 combined.read_results);
+  if (options->use_embedded_server) {
+    std::cout << "# ReadRow() calls=" << combined.read_results.row_count
+              << ", ReadRows requests=" << benchmark.read_rows_count() << "\n";
+  }
 
   std::cout << bigtable::benchmarks::Benchmark::ResultsCsvHeader() << "\n";
   benchmark.PrintResultCsv(std::cout, "perf", "BulkApply()", "Latency",
@@ -207,12 +221,10 @@ OperationResult RunOneReadRow(bigtable::Table& table, std::string row_key) {
 }
 
 google::cloud::StatusOr<LatencyBenchmarkResult> RunBenchmark(
-    bigtable::benchmarks::Benchmark const& benchmark,
+    bigtable::benchmarks::Benchmark const& benchmark, bigtable::Table table,
     std::chrono::seconds test_duration) {
   LatencyBenchmarkResult result = {};
 
-  auto table = benchmark.MakeTable();
-
   auto generator = google::cloud::internal::MakeDefaultPRNG();
   std::uniform_int_distribution<int> prng_operation(0, 1);
 
@@ -15,10 +15,12 @@
 #include "google/cloud/bigtable/benchmarks/benchmark.h"
 #include "google/cloud/bigtable/admin/bigtable_table_admin_client.h"
 #include "google/cloud/bigtable/benchmarks/random_mutation.h"
+#include "google/cloud/bigtable/options.h"
 #include "google/cloud/bigtable/resource_names.h"
 #include "google/cloud/internal/background_threads_impl.h"
 #include "google/cloud/internal/getenv.h"
 #include "google/cloud/internal/make_status.h"
+#include <cstddef>
 #include <future>
 #include <iomanip>
 #include <sstream>
@@ -72,6 +74,15 @@ google::cloud::StatusOr<BenchmarkOptions> ParseArgs(
 Benchmark::Benchmark(BenchmarkOptions options)
     : options_(std::move(options)), key_width_(KeyWidth()) {
   opts_.set<GrpcNumChannelsOption>(options_.thread_count);
+  if (options_.read_row_coalescing_window.count() > 0) {
+    opts_.set<experimental::ReadRowCoalescingWindowOption>(
+        options_.read_row_coalescing_window);
+  }
+  if (options_.row_cache_max_bytes > 0) {
+    opts_.set<experimental::RowCacheMaxBytesOption>(
+        static_cast<std::size_t>(options_.row_cache_max_bytes));
+    opts_.set<experimental::RowCacheStatsOption>(row_cache_stats_);
+  }
   if (options_.use_embedded_server) {
     server_ = CreateEmbeddedServer();
     std::string address = server_->address();
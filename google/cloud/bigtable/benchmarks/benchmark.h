@@ -18,11 +18,13 @@
 #include "google/cloud/bigtable/benchmarks/benchmark_options.h"
 #include "google/cloud/bigtable/benchmarks/constants.h"
 #include "google/cloud/bigtable/benchmarks/embedded_server.h"
+#include "google/cloud/bigtable/row_cache_stats.h"
 #include "google/cloud/bigtable/table.h"
 #include "google/cloud/internal/random.h"
 #include "google/cloud/status_or.h"
 #include <chrono>
 #include <deque>
+#include <memory>
 #include <string>
 #include <thread>
 
@@ -119,6 +121,11 @@ class Benchmark {
   int read_rows_count() const;
   ///@}
 
+  /// The counters of the client-side row cache, if it is enabled.
+  experimental::RowCacheStats const& row_cache_stats() const {
+    return *row_cache_stats_;
+  }
+
   void DisableBackgroundThreads(CompletionQueue& cq);
 
  private:
@@ -135,6 +142,8 @@ class Benchmark {
   BenchmarkOptions options_;
   int key_width_;
   Options opts_;
+  std::shared_ptr<experimental::RowCacheStats> row_cache_stats_ =
+      std::make_shared<experimental::RowCacheStats>();
   std::unique_ptr<EmbeddedServer> server_;
   std::thread server_thread_;
 };
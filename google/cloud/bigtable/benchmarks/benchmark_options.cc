@@ -91,6 +91,19 @@ google::cloud::StatusOr<BenchmarkOptions> ParseBenchmarkOptions(
        [&options](std::string const& val) {
          options.use_embedded_server = ParseBoolean(val).value_or(true);
        }},
+      {"--read-row-coalescing-window",
+       "coalesce concurrent ReadRow() calls started within this many"
+       " microseconds, 0 disables coalescing",
+       [&options](std::string const& val) {
+         options.read_row_coalescing_window =
+             std::chrono::microseconds(std::stol(val));
+       }},
+      {"--row-cache-max-bytes",
+       "cache ReadRow() results in a client-side cache of this many bytes,"
+       " 0 disables the cache",
+       [&options](std::string const& val) {
+         options.row_cache_max_bytes = std::stoll(val);
+       }},
   };
 
   auto usage = BuildUsage(desc, argv[0]);
@@ -155,6 +168,19 @@ google::cloud::StatusOr<BenchmarkOptions> ParseBenchmarkOptions(
        << "). Check your --test-duration option.\n";
     return make_status(os, GCP_ERROR_INFO());
   }
+  if (options.read_row_coalescing_window.count() < 0) {
+    std::ostringstream os;
+    os << "Invalid ReadRow() coalescing window ("
+       << options.read_row_coalescing_window.count()
+       << "). Check your --read-row-coalescing-window option.\n";
+    return make_status(os, GCP_ERROR_INFO());
+  }
+  if (options.row_cache_max_bytes < 0) {
+    std::ostringstream os;
+    os << "Invalid row cache size (" << options.row_cache_max_bytes
+       << "). Check your --row-cache-max-bytes option.\n";
+    return make_status(os, GCP_ERROR_INFO());
+  }
   return options;
 }
 
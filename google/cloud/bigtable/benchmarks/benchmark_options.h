@@ -39,6 +39,8 @@ struct BenchmarkOptions {
       std::chrono::seconds(kDefaultTestDuration * 60);
   bool use_embedded_server = false;
   int parallel_requests = 10;
+  std::chrono::microseconds read_row_coalescing_window{0};
+  std::int64_t row_cache_max_bytes = 0;
   bool exit_after_parse = false;
 };
 
@@ -34,7 +34,8 @@ TEST(BenchmarkOptions, Basic) {
   auto options = ParseBenchmarkOptions(
       {"self-test", "--project-id=test-project", "--instance-id=test-instance",
        "--app-profile-id=test-app-profile-id", "--table-size=10000",
-       "--test-duration=300s", "--use-embedded-server=true"},
+       "--test-duration=300s", "--use-embedded-server=true",
+       "--read-row-coalescing-window=250", "--row-cache-max-bytes=1000000"},
       "");
   ASSERT_STATUS_OK(options);
   EXPECT_FALSE(options->exit_after_parse);
@@ -44,6 +45,8 @@ TEST(BenchmarkOptions, Basic) {
   EXPECT_EQ(10000, options->table_size);
   EXPECT_EQ(300, options->test_duration.count());
   EXPECT_EQ(true, options->use_embedded_server);
+  EXPECT_EQ(250, options->read_row_coalescing_window.count());
+  EXPECT_EQ(1000000, options->row_cache_max_bytes);
 }
 
 TEST(BenchmarkOptions, Defaults) {
@@ -62,6 +65,8 @@ TEST(BenchmarkOptions, Defaults) {
             options->test_duration.count());
   EXPECT_EQ(false, options->use_embedded_server);
   EXPECT_EQ(10, options->parallel_requests);
+  EXPECT_EQ(0, options->read_row_coalescing_window.count());
+  EXPECT_EQ(0, options->row_cache_max_bytes);
 }
 
 TEST(BenchmarkOptions, Initialization) {
@@ -103,6 +108,14 @@ TEST(BenchmarkOptions, Validate) {
   EXPECT_FALSE(ParseBenchmarkOptions(
       {"self-test", "--project-id=a", "--instance-id=b", "--test-duration=0"},
       ""));
+  EXPECT_FALSE(ParseBenchmarkOptions({"self-test", "--project-id=a",
+                                      "--instance-id=b",
+                                      "--read-row-coalescing-window=-1"},
+                                     ""));
+  EXPECT_FALSE(ParseBenchmarkOptions({"self-test", "--project-id=a",
+                                      "--instance-id=b",
+                                      "--row-cache-max-bytes=-1"},
+                                     ""));
 }
 
 }  // namespace
@@ -17,9 +17,11 @@
 #include "google/cloud/bigtable/benchmarks/random_mutation.h"
 #include <google/bigtable/admin/v2/bigtable_table_admin.grpc.pb.h>
 #include <google/bigtable/v2/bigtable.grpc.pb.h>
+#include <algorithm>
 #include <atomic>
 #include <iomanip>
 #include <sstream>
+#include <vector>
 
 namespace btproto = ::google::bigtable::v2;
 namespace btadmin = ::google::bigtable::admin::v2;
@@ -80,18 +82,33 @@ class BigtableImpl final : public btproto::Bigtable::Service {
       rows_limit = request->rows_limit();
     }
 
+    // Echo the requested row keys, sorted and without duplicates, as the
+    // service would. Requests without row keys get a sequence of made up keys.
+    std::vector<std::string> row_keys;
+    auto const& requested = request->rows().row_keys();
+    if (!requested.empty()) {
+      row_keys.assign(requested.begin(), requested.end());
+      std::sort(row_keys.begin(), row_keys.end());
+      row_keys.erase(std::unique(row_keys.begin(), row_keys.end()),
+                     row_keys.end());
+      if (static_cast<std::int64_t>(row_keys.size()) > rows_limit) {
+        row_keys.resize(static_cast<std::size_t>(rows_limit));
+      }
+    } else {
+      for (std::int64_t i = 0; i != rows_limit; ++i) {
+        std::ostringstream os;
+        os << "user" << std::setw(12) << std::setfill('0') << i;
+        row_keys.push_back(std::move(os).str());
+      }
+    }
+
     btproto::ReadRowsResponse msg;
-    for (std::int64_t i = 0; i != rows_limit; ++i) {
+    for (std::size_t i = 0; i != row_keys.size(); ++i) {
       std::size_t idx = 0;
       char const* cf = kColumnFamily;
-      std::ostringstream os;
-      os << "user" << std::setw(12) << std::setfill('0') << i;
-      std::string row_key = os.str();
       for (int j = 0; j != kNumFields; ++j) {
         auto& chunk = *msg.add_chunks();
-        // This is neither the real format of the keys, nor the keys requested,
-        // but it is good enough for a simulation.
-        chunk.set_row_key(row_key);
+        chunk.set_row_key(row_keys[i]);
         chunk.set_timestamp_micros(0);
         chunk.mutable_family_name()->set_value(cf);
         chunk.mutable_qualifier()->set_value("field" + std::to_string(j));
@@ -106,7 +123,7 @@ class BigtableImpl final : public btproto::Bigtable::Service {
           chunk.set_commit_row(true);
         }
       }
-      if (i != request->rows_limit() - 1) {
+      if (i + 1 != row_keys.size()) {
         writer->Write(msg);
         msg = {};
       }
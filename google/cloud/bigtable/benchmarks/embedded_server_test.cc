@@ -18,7 +18,9 @@
 #include "google/cloud/bigtable/table.h"
 #include "google/cloud/testing_util/status_matchers.h"
 #include <gmock/gmock.h>
+#include <string>
 #include <thread>
+#include <vector>
 
 namespace google {
 namespace cloud {
@@ -27,6 +29,7 @@ namespace benchmarks {
 namespace {
 
 using ::std::chrono::milliseconds;
+using ::testing::ElementsAre;
 
 TEST(EmbeddedServer, WaitAndShutdown) {
   auto server = CreateEmbeddedServer();
@@ -163,6 +166,33 @@ TEST(EmbeddedServer, ReadRows100) {
   wait_thread.join();
 }
 
+TEST(EmbeddedServer, ReadRowsKeys) {
+  auto server = CreateEmbeddedServer();
+  std::thread wait_thread([&server]() { server->Wait(); });
+
+  auto options =
+      Options{}
+          .set<GrpcCredentialOption>(grpc::InsecureChannelCredentials())
+          .set<EndpointOption>(server->address());
+
+  Table table(MakeDataConnection(options),
+              TableResource("fake-project", "fake-instance", "fake-table"));
+
+  EXPECT_EQ(0, server->read_rows_count());
+  auto reader = table.ReadRows(RowSet("row3", "row1", "row3"),
+                               Filter::PassAllFilter());
+  std::vector<std::string> keys;
+  for (auto& row : reader) {
+    ASSERT_STATUS_OK(row);
+    keys.push_back(row->row_key());
+  }
+  EXPECT_THAT(keys, ElementsAre("row1", "row3"));
+  EXPECT_EQ(1, server->read_rows_count());
+
+  server->Shutdown();
+  wait_thread.join();
+}
+
 }  // namespace
 }  // namespace benchmarks
 }  // namespace bigtable
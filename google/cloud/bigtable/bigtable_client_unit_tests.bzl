@@ -63,7 +63,9 @@ bigtable_client_unit_tests = [
     "internal/operation_context_test.cc",
     "internal/prefix_range_end_test.cc",
     "internal/rate_limiter_test.cc",
+    "internal/read_row_coalescing_connection_test.cc",
     "internal/retry_traits_test.cc",
+    "internal/row_cache_connection_test.cc",
     "internal/traced_row_reader_test.cc",
     "legacy_table_test.cc",
     "metadata_update_policy_test.cc",
@@ -18,6 +18,8 @@
 #include "google/cloud/bigtable/internal/data_tracing_connection.h"
 #include "google/cloud/bigtable/internal/defaults.h"
 #include "google/cloud/bigtable/internal/mutate_rows_limiter.h"
+#include "google/cloud/bigtable/internal/read_row_coalescing_connection.h"
+#include "google/cloud/bigtable/internal/row_cache_connection.h"
 #include "google/cloud/bigtable/internal/row_reader_impl.h"
 #include "google/cloud/bigtable/options.h"
 #include "google/cloud/background_threads.h"
@@ -170,10 +172,14 @@ std::shared_ptr<DataConnection> MakeDataConnection(Options options) {
                                                     background->cq(), options);
   auto limiter =
       bigtable_internal::MakeMutateRowsLimiter(background->cq(), options);
+  auto cq = background->cq();
   std::shared_ptr<DataConnection> conn =
       std::make_shared<bigtable_internal::DataConnectionImpl>(
           std::move(background), std::move(stub), std::move(limiter),
-          std::move(options));
+          options);
+  conn = bigtable_internal::MakeReadRowCoalescingConnection(
+      std::move(cq), std::move(conn), options);
+  conn = bigtable_internal::MakeRowCacheConnection(std::move(conn), options);
   if (google::cloud::internal::TracingEnabled(conn->options())) {
     conn = bigtable_internal::MakeDataTracingConnection(std::move(conn));
   }
@@ -100,8 +100,10 @@ google_cloud_cpp_bigtable_hdrs = [
     "internal/operation_context.h",
     "internal/prefix_range_end.h",
     "internal/rate_limiter.h",
+    "internal/read_row_coalescing_connection.h",
     "internal/readrowsparser.h",
     "internal/retry_traits.h",
+    "internal/row_cache_connection.h",
     "internal/row_reader_impl.h",
     "internal/rpc_policy_parameters.h",
     "internal/rpc_policy_parameters.inc",
@@ -117,6 +119,7 @@ google_cloud_cpp_bigtable_hdrs = [
     "resource_names.h",
     "retry_policy.h",
     "row.h",
+    "row_cache_stats.h",
     "row_key.h",
     "row_key_sample.h",
     "row_range.h",
@@ -202,7 +205,9 @@ google_cloud_cpp_bigtable_srcs = [
     "internal/operation_context.cc",
     "internal/prefix_range_end.cc",
     "internal/rate_limiter.cc",
+    "internal/read_row_coalescing_connection.cc",
     "internal/readrowsparser.cc",
+    "internal/row_cache_connection.cc",
     "internal/traced_row_reader.cc",
     "metadata_update_policy.cc",
     "mutation_batcher.cc",
@@ -61,8 +61,8 @@ BigtableMetadata::ReadRows(
         {
             {[](google::bigtable::v2::ReadRowsRequest const& request)
                  -> std::string const& { return request.table_name(); },
-             std::regex{"(projects/[^/]+/instances/[^/]+/tables/[^/]+)",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate(
+                 "{projects/*/instances/*/tables/*}")},
         }};
   }();
   table_name_matcher->AppendParam(request, params);
@@ -81,9 +81,8 @@ BigtableMetadata::ReadRows(
                  -> std::string const& {
                return request.authorized_view_name();
              },
-             std::regex{"(projects/[^/]+/instances/[^/]+/tables/[^/]+/"
-                        "authorizedViews/[^/]+)",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate(
+                 "{projects/*/instances/*/tables/*/authorizedViews/*}")},
         }};
   }();
   authorized_view_name_matcher->AppendParam(request, params);
@@ -111,8 +110,8 @@ BigtableMetadata::SampleRowKeys(
         {
             {[](google::bigtable::v2::SampleRowKeysRequest const& request)
                  -> std::string const& { return request.table_name(); },
-             std::regex{"(projects/[^/]+/instances/[^/]+/tables/[^/]+)",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate(
+                 "{projects/*/instances/*/tables/*}")},
         }};
   }();
   table_name_matcher->AppendParam(request, params);
@@ -131,9 +130,8 @@ BigtableMetadata::SampleRowKeys(
                  -> std::string const& {
                return request.authorized_view_name();
              },
-             std::regex{"(projects/[^/]+/instances/[^/]+/tables/[^/]+/"
-                        "authorizedViews/[^/]+)",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate(
+                 "{projects/*/instances/*/tables/*/authorizedViews/*}")},
         }};
   }();
   authorized_view_name_matcher->AppendParam(request, params);
@@ -159,8 +157,8 @@ StatusOr<google::bigtable::v2::MutateRowResponse> BigtableMetadata::MutateRow(
         {
             {[](google::bigtable::v2::MutateRowRequest const& request)
                  -> std::string const& { return request.table_name(); },
-             std::regex{"(projects/[^/]+/instances/[^/]+/tables/[^/]+)",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate(
+                 "{projects/*/instances/*/tables/*}")},
         }};
   }();
   table_name_matcher->AppendParam(request, params);
@@ -179,9 +177,8 @@ StatusOr<google::bigtable::v2::MutateRowResponse> BigtableMetadata::MutateRow(
                  -> std::string const& {
                return request.authorized_view_name();
              },
-             std::regex{"(projects/[^/]+/instances/[^/]+/tables/[^/]+/"
-                        "authorizedViews/[^/]+)",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate(
+                 "{projects/*/instances/*/tables/*/authorizedViews/*}")},
         }};
   }();
   authorized_view_name_matcher->AppendParam(request, params);
@@ -209,8 +206,8 @@ BigtableMetadata::MutateRows(
         {
             {[](google::bigtable::v2::MutateRowsRequest const& request)
                  -> std::string const& { return request.table_name(); },
-             std::regex{"(projects/[^/]+/instances/[^/]+/tables/[^/]+)",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate(
+                 "{projects/*/instances/*/tables/*}")},
         }};
   }();
   table_name_matcher->AppendParam(request, params);
@@ -229,9 +226,8 @@ BigtableMetadata::MutateRows(
                  -> std::string const& {
                return request.authorized_view_name();
              },
-             std::regex{"(projects/[^/]+/instances/[^/]+/tables/[^/]+/"
-                        "authorizedViews/[^/]+)",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate(
+                 "{projects/*/instances/*/tables/*/authorizedViews/*}")},
         }};
   }();
   authorized_view_name_matcher->AppendParam(request, params);
@@ -258,8 +254,8 @@ BigtableMetadata::CheckAndMutateRow(
         {
             {[](google::bigtable::v2::CheckAndMutateRowRequest const& request)
                  -> std::string const& { return request.table_name(); },
-             std::regex{"(projects/[^/]+/instances/[^/]+/tables/[^/]+)",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate(
+                 "{projects/*/instances/*/tables/*}")},
         }};
   }();
   table_name_matcher->AppendParam(request, params);
@@ -278,9 +274,8 @@ BigtableMetadata::CheckAndMutateRow(
                  -> std::string const& {
                return request.authorized_view_name();
              },
-             std::regex{"(projects/[^/]+/instances/[^/]+/tables/[^/]+/"
-                        "authorizedViews/[^/]+)",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate(
+                 "{projects/*/instances/*/tables/*/authorizedViews/*}")},
         }};
   }();
   authorized_view_name_matcher->AppendParam(request, params);
@@ -307,8 +302,7 @@ BigtableMetadata::PingAndWarm(
         {
             {[](google::bigtable::v2::PingAndWarmRequest const& request)
                  -> std::string const& { return request.name(); },
-             std::regex{"(projects/[^/]+/instances/[^/]+)",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate("{projects/*/instances/*}")},
         }};
   }();
   name_matcher->AppendParam(request, params);
@@ -340,8 +334,8 @@ BigtableMetadata::ReadModifyWriteRow(
         {
             {[](google::bigtable::v2::ReadModifyWriteRowRequest const& request)
                  -> std::string const& { return request.table_name(); },
-             std::regex{"(projects/[^/]+/instances/[^/]+/tables/[^/]+)",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate(
+                 "{projects/*/instances/*/tables/*}")},
         }};
   }();
   table_name_matcher->AppendParam(request, params);
@@ -360,9 +354,8 @@ BigtableMetadata::ReadModifyWriteRow(
                  -> std::string const& {
                return request.authorized_view_name();
              },
-             std::regex{"(projects/[^/]+/instances/[^/]+/tables/[^/]+/"
-                        "authorizedViews/[^/]+)",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate(
+                 "{projects/*/instances/*/tables/*/authorizedViews/*}")},
         }};
   }();
   authorized_view_name_matcher->AppendParam(request, params);
@@ -389,8 +382,7 @@ BigtableMetadata::PrepareQuery(
         {
             {[](google::bigtable::v2::PrepareQueryRequest const& request)
                  -> std::string const& { return request.instance_name(); },
-             std::regex{"(projects/[^/]+/instances/[^/]+)",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate("{projects/*/instances/*}")},
         }};
   }();
   name_matcher->AppendParam(request, params);
@@ -423,8 +415,7 @@ BigtableMetadata::ExecuteQuery(
         {
             {[](google::bigtable::v2::ExecuteQueryRequest const& request)
                  -> std::string const& { return request.instance_name(); },
-             std::regex{"(projects/[^/]+/instances/[^/]+)",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate("{projects/*/instances/*}")},
         }};
   }();
   name_matcher->AppendParam(request, params);
@@ -459,8 +450,8 @@ BigtableMetadata::AsyncReadRows(
         {
             {[](google::bigtable::v2::ReadRowsRequest const& request)
                  -> std::string const& { return request.table_name(); },
-             std::regex{"(projects/[^/]+/instances/[^/]+/tables/[^/]+)",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate(
+                 "{projects/*/instances/*/tables/*}")},
         }};
   }();
   table_name_matcher->AppendParam(request, params);
@@ -479,9 +470,8 @@ BigtableMetadata::AsyncReadRows(
                  -> std::string const& {
                return request.authorized_view_name();
              },
-             std::regex{"(projects/[^/]+/instances/[^/]+/tables/[^/]+/"
-                        "authorizedViews/[^/]+)",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate(
+                 "{projects/*/instances/*/tables/*/authorizedViews/*}")},
         }};
   }();
   authorized_view_name_matcher->AppendParam(request, params);
@@ -512,8 +502,8 @@ BigtableMetadata::AsyncSampleRowKeys(
         {
             {[](google::bigtable::v2::SampleRowKeysRequest const& request)
                  -> std::string const& { return request.table_name(); },
-             std::regex{"(projects/[^/]+/instances/[^/]+/tables/[^/]+)",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate(
+                 "{projects/*/instances/*/tables/*}")},
         }};
   }();
   table_name_matcher->AppendParam(request, params);
@@ -532,9 +522,8 @@ BigtableMetadata::AsyncSampleRowKeys(
                  -> std::string const& {
                return request.authorized_view_name();
              },
-             std::regex{"(projects/[^/]+/instances/[^/]+/tables/[^/]+/"
-                        "authorizedViews/[^/]+)",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate(
+                 "{projects/*/instances/*/tables/*/authorizedViews/*}")},
         }};
   }();
   authorized_view_name_matcher->AppendParam(request, params);
@@ -564,8 +553,8 @@ BigtableMetadata::AsyncMutateRow(
         {
             {[](google::bigtable::v2::MutateRowRequest const& request)
                  -> std::string const& { return request.table_name(); },
-             std::regex{"(projects/[^/]+/instances/[^/]+/tables/[^/]+)",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate(
+                 "{projects/*/instances/*/tables/*}")},
         }};
   }();
   table_name_matcher->AppendParam(request, params);
@@ -584,9 +573,8 @@ BigtableMetadata::AsyncMutateRow(
                  -> std::string const& {
                return request.authorized_view_name();
              },
-             std::regex{"(projects/[^/]+/instances/[^/]+/tables/[^/]+/"
-                        "authorizedViews/[^/]+)",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate(
+                 "{projects/*/instances/*/tables/*/authorizedViews/*}")},
         }};
   }();
   authorized_view_name_matcher->AppendParam(request, params);
@@ -617,8 +605,8 @@ BigtableMetadata::AsyncMutateRows(
         {
             {[](google::bigtable::v2::MutateRowsRequest const& request)
                  -> std::string const& { return request.table_name(); },
-             std::regex{"(projects/[^/]+/instances/[^/]+/tables/[^/]+)",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate(
+                 "{projects/*/instances/*/tables/*}")},
         }};
   }();
   table_name_matcher->AppendParam(request, params);
@@ -637,9 +625,8 @@ BigtableMetadata::AsyncMutateRows(
                  -> std::string const& {
                return request.authorized_view_name();
              },
-             std::regex{"(projects/[^/]+/instances/[^/]+/tables/[^/]+/"
-                        "authorizedViews/[^/]+)",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate(
+                 "{projects/*/instances/*/tables/*/authorizedViews/*}")},
         }};
   }();
   authorized_view_name_matcher->AppendParam(request, params);
@@ -669,8 +656,8 @@ BigtableMetadata::AsyncCheckAndMutateRow(
         {
             {[](google::bigtable::v2::CheckAndMutateRowRequest const& request)
                  -> std::string const& { return request.table_name(); },
-             std::regex{"(projects/[^/]+/instances/[^/]+/tables/[^/]+)",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate(
+                 "{projects/*/instances/*/tables/*}")},
         }};
   }();
   table_name_matcher->AppendParam(request, params);
@@ -689,9 +676,8 @@ BigtableMetadata::AsyncCheckAndMutateRow(
                  -> std::string const& {
                return request.authorized_view_name();
              },
-             std::regex{"(projects/[^/]+/instances/[^/]+/tables/[^/]+/"
-                        "authorizedViews/[^/]+)",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate(
+                 "{projects/*/instances/*/tables/*/authorizedViews/*}")},
         }};
   }();
   authorized_view_name_matcher->AppendParam(request, params);
@@ -721,8 +707,8 @@ BigtableMetadata::AsyncReadModifyWriteRow(
         {
             {[](google::bigtable::v2::ReadModifyWriteRowRequest const& request)
                  -> std::string const& { return request.table_name(); },
-             std::regex{"(projects/[^/]+/instances/[^/]+/tables/[^/]+)",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate(
+                 "{projects/*/instances/*/tables/*}")},
         }};
   }();
   table_name_matcher->AppendParam(request, params);
@@ -741,9 +727,8 @@ BigtableMetadata::AsyncReadModifyWriteRow(
                  -> std::string const& {
                return request.authorized_view_name();
              },
-             std::regex{"(projects/[^/]+/instances/[^/]+/tables/[^/]+/"
-                        "authorizedViews/[^/]+)",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate(
+                 "{projects/*/instances/*/tables/*/authorizedViews/*}")},
         }};
   }();
   authorized_view_name_matcher->AppendParam(request, params);
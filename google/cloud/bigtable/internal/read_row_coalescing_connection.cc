@@ -0,0 +1,329 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/bigtable/internal/read_row_coalescing_connection.h"
+#include "google/cloud/bigtable/options.h"
+#include "google/cloud/bigtable/row_reader.h"
+#include "google/cloud/common_options.h"
+#include "google/cloud/internal/make_status.h"
+#include <algorithm>
+#include <cstdint>
+
+namespace google {
+namespace cloud {
+namespace bigtable_internal {
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_BEGIN
+namespace {
+
+using ReadRowResult = StatusOr<std::pair<bool, bigtable::Row>>;
+
+std::size_t constexpr kDefaultMaxKeys = 100;
+
+// Appends @p value to @p key. The fields are length-prefixed, as they may
+// contain any character.
+void AppendField(std::string& key, std::string const& value) {
+  key += std::to_string(value.size());
+  key.push_back(':');
+  key += value;
+}
+
+template <typename T>
+void AppendPointer(std::string& key, std::shared_ptr<T> const& p) {
+  AppendField(key, std::to_string(reinterpret_cast<std::uintptr_t>(p.get())));
+}
+
+/**
+ * Calls can only share a batch if they would send the same request.
+ *
+ * The key includes the per-call options used by `AsyncReadRows()`: the app
+ * profile, the retry and backoff policies, and the request metadata. Policies
+ * cannot be compared by value, calls share a batch if they share the same
+ * policy objects, as calls made with the same `Table` options do.
+ */
+std::string BatchKey(std::string const& table_name, Options const& options,
+                     bigtable::Filter const& filter) {
+  std::string key;
+  AppendField(key, table_name);
+  AppendField(key, options.get<bigtable::AppProfileIdOption>());
+  AppendPointer(key, options.get<bigtable::DataRetryPolicyOption>());
+  AppendPointer(key, options.get<bigtable::DataBackoffPolicyOption>());
+  AppendField(key, options.get<EnableServerRetriesOption>() ? "1" : "0");
+  // The request metadata set by `internal::ConfigureContext()`.
+  for (auto const& v : {options.get<UserProjectOption>(),
+                        options.get<AuthorityOption>(),
+                        options.get<QuotaUserOption>(),
+                        options.get<UserIpOption>(),
+                        options.get<FieldMaskOption>()}) {
+    AppendField(key, v);
+  }
+  auto const& headers = options.get<CustomHeadersOption>();
+  std::vector<std::pair<std::string, std::string>> sorted(headers.begin(),
+                                                          headers.end());
+  std::sort(sorted.begin(), sorted.end());
+  AppendField(key, std::to_string(sorted.size()));
+  for (auto const& h : sorted) {
+    AppendField(key, h.first);
+    AppendField(key, h.second);
+  }
+  key += filter.as_proto().SerializeAsString();
+  return key;
+}
+
+}  // namespace
+
+struct ReadRowCoalescingConnection::Batch {
+  Batch(std::string k, std::string t, bigtable::Filter f,
+        internal::ImmutableOptions o)
+      : key(std::move(k)),
+        table_name(std::move(t)),
+        filter(std::move(f)),
+        options(std::move(o)) {}
+
+  std::string key;
+  std::string table_name;
+  bigtable::Filter filter;
+  // The options of the first call in the batch, used for the whole batch. The
+  // other calls only differ in the options not included in `key`.
+  internal::ImmutableOptions options;
+  // The callers waiting on each row key. Only modified while the batch is
+  // open (with `mu_` held), or by the `AsyncReadRows()` callbacks after it is
+  // closed.
+  std::unordered_map<std::string, std::vector<promise<ReadRowResult>>> waiters;
+  // Guarded by `mu_`.
+  bool open = true;
+};
+
+ReadRowCoalescingConnection::ReadRowCoalescingConnection(
+    std::shared_ptr<bigtable::DataConnection> child, Timer timer,
+    std::chrono::microseconds window, std::size_t max_keys)
+    : child_(std::move(child)),
+      timer_(std::move(timer)),
+      window_(window),
+      max_keys_(max_keys) {}
+
+ReadRowCoalescingConnection::~ReadRowCoalescingConnection() {
+  // The timers for the open batches cannot flush them once this object is
+  // gone. Fail the callers waiting on them instead.
+  std::unordered_map<std::string, std::shared_ptr<Batch>> batches;
+  {
+    std::lock_guard<std::mutex> lk(mu_);
+    batches.swap(batches_);
+    for (auto& kv : batches) kv.second->open = false;
+  }
+  auto const status = internal::CancelledError(
+      "the connection was destroyed before the read was sent",
+      GCP_ERROR_INFO());
+  for (auto& kv : batches) {
+    for (auto& w : kv.second->waiters) {
+      for (auto& p : w.second) p.set_value(status);
+    }
+  }
+}
+
+Status ReadRowCoalescingConnection::Apply(std::string const& table_name,
+                                          bigtable::SingleRowMutation mut) {
+  return child_->Apply(table_name, std::move(mut));
+}
+
+future<Status> ReadRowCoalescingConnection::AsyncApply(
+    std::string const& table_name, bigtable::SingleRowMutation mut) {
+  return child_->AsyncApply(table_name, std::move(mut));
+}
+
+std::vector<bigtable::FailedMutation> ReadRowCoalescingConnection::BulkApply(
+    std::string const& table_name, bigtable::BulkMutation mut) {
+  return child_->BulkApply(table_name, std::move(mut));
+}
+
+future<std::vector<bigtable::FailedMutation>>
+ReadRowCoalescingConnection::AsyncBulkApply(std::string const& table_name,
+                                            bigtable::BulkMutation mut) {
+  return child_->AsyncBulkApply(table_name, std::move(mut));
+}
+
+bigtable::RowReader ReadRowCoalescingConnection::ReadRows(
+    std::string const& table_name, bigtable::RowSet row_set,
+    std::int64_t rows_limit, bigtable::Filter filter) {
+  return child_->ReadRows(table_name, std::move(row_set), rows_limit,
+                          std::move(filter));
+}
+
+bigtable::RowReader ReadRowCoalescingConnection::ReadRowsFull(
+    bigtable::ReadRowsParams params) {
+  return child_->ReadRowsFull(std::move(params));
+}
+
+StatusOr<std::pair<bool, bigtable::Row>> ReadRowCoalescingConnection::ReadRow(
+    std::string const& table_name, std::string row_key,
+    bigtable::Filter filter) {
+  return AsyncReadRow(table_name, std::move(row_key), std::move(filter)).get();
+}
+
+StatusOr<bigtable::MutationBranch>
+ReadRowCoalescingConnection::CheckAndMutateRow(
+    std::string const& table_name, std::string row_key,
+    bigtable::Filter filter, std::vector<bigtable::Mutation> true_mutations,
+    std::vector<bigtable::Mutation> false_mutations) {
+  return child_->CheckAndMutateRow(table_name, std::move(row_key),
+                                   std::move(filter), std::move(true_mutations),
+                                   std::move(false_mutations));
+}
+
+future<StatusOr<bigtable::MutationBranch>>
+ReadRowCoalescingConnection::AsyncCheckAndMutateRow(
+    std::string const& table_name, std::string row_key,
+    bigtable::Filter filter, std::vector<bigtable::Mutation> true_mutations,
+    std::vector<bigtable::Mutation> false_mutations) {
+  return child_->AsyncCheckAndMutateRow(
+      table_name, std::move(row_key), std::move(filter),
+      std::move(true_mutations), std::move(false_mutations));
+}
+
+StatusOr<std::vector<bigtable::RowKeySample>>
+ReadRowCoalescingConnection::SampleRows(std::string const& table_name) {
+  return child_->SampleRows(table_name);
+}
+
+future<StatusOr<std::vector<bigtable::RowKeySample>>>
+ReadRowCoalescingConnection::AsyncSampleRows(std::string const& table_name) {
+  return child_->AsyncSampleRows(table_name);
+}
+
+StatusOr<bigtable::Row> ReadRowCoalescingConnection::ReadModifyWriteRow(
+    google::bigtable::v2::ReadModifyWriteRowRequest request) {
+  return child_->ReadModifyWriteRow(std::move(request));
+}
+
+future<StatusOr<bigtable::Row>>
+ReadRowCoalescingConnection::AsyncReadModifyWriteRow(
+    google::bigtable::v2::ReadModifyWriteRowRequest request) {
+  return child_->AsyncReadModifyWriteRow(std::move(request));
+}
+
+void ReadRowCoalescingConnection::AsyncReadRows(
+    std::string const& table_name,
+    std::function<future<bool>(bigtable::Row)> on_row,
+    std::function<void(Status)> on_finish, bigtable::RowSet row_set,
+    std::int64_t rows_limit, bigtable::Filter filter) {
+  child_->AsyncReadRows(table_name, std::move(on_row), std::move(on_finish),
+                        std::move(row_set), rows_limit, std::move(filter));
+}
+
+future<StatusOr<std::pair<bool, bigtable::Row>>>
+ReadRowCoalescingConnection::AsyncReadRow(std::string const& table_name,
+                                          std::string row_key,
+                                          bigtable::Filter filter) {
+  auto current = internal::SaveCurrentOptions();
+  auto key = BatchKey(table_name, *current, filter);
+  promise<ReadRowResult> p;
+  auto f = p.get_future();
+
+  std::shared_ptr<Batch> started;
+  std::shared_ptr<Batch> full;
+  {
+    std::lock_guard<std::mutex> lk(mu_);
+    auto& batch = batches_[key];
+    if (!batch) {
+      batch = std::make_shared<Batch>(key, table_name, std::move(filter),
+                                      std::move(current));
+      started = batch;
+    }
+    batch->waiters[std::move(row_key)].push_back(std::move(p));
+    if (batch->waiters.size() >= max_keys_) {
+      batch->open = false;
+      full = std::move(batch);
+      batches_.erase(key);
+    }
+  }
+  if (full) {
+    Flush(std::move(full));
+    return f;
+  }
+  if (started) {
+    // We need a weak_ptr<> because this class owns the completion queue,
+    // creating a lambda with a shared_ptr<> owning this class would create a
+    // cycle.
+    auto weak = std::weak_ptr<ReadRowCoalescingConnection>(shared_from_this());
+    timer_(window_).then([weak, started](future<void>) {
+      if (auto self = weak.lock()) self->OnTimer(started);
+    });
+  }
+  return f;
+}
+
+void ReadRowCoalescingConnection::OnTimer(std::shared_ptr<Batch> const& batch) {
+  {
+    std::lock_guard<std::mutex> lk(mu_);
+    // The batch may have been sent already, because it reached `max_keys_`.
+    if (!batch->open) return;
+    batch->open = false;
+    batches_.erase(batch->key);
+  }
+  Flush(batch);
+}
+
+void ReadRowCoalescingConnection::Flush(std::shared_ptr<Batch> batch) {
+  internal::OptionsSpan span(batch->options);
+  bigtable::RowSet row_set;
+  for (auto const& kv : batch->waiters) row_set.Append(kv.first);
+
+  auto on_row = [batch](bigtable::Row row) {
+    auto i = batch->waiters.find(row.row_key());
+    if (i != batch->waiters.end()) {
+      auto waiters = std::move(i->second);
+      batch->waiters.erase(i);
+      for (auto& w : waiters) w.set_value(std::make_pair(true, row));
+    }
+    return make_ready_future(true);
+  };
+  auto on_finish = [batch](Status const& status) {
+    auto waiters = std::move(batch->waiters);
+    batch->waiters.clear();
+    for (auto& kv : waiters) {
+      for (auto& w : kv.second) {
+        if (!status.ok()) {
+          w.set_value(status);
+          continue;
+        }
+        w.set_value(std::make_pair(false, bigtable::Row("", {})));
+      }
+    }
+  };
+  child_->AsyncReadRows(batch->table_name, std::move(on_row),
+                        std::move(on_finish), std::move(row_set),
+                        bigtable::RowReader::NO_ROWS_LIMIT, batch->filter);
+}
+
+std::shared_ptr<bigtable::DataConnection> MakeReadRowCoalescingConnection(
+    CompletionQueue cq, std::shared_ptr<bigtable::DataConnection> conn,
+    Options const& options) {
+  using ::google::cloud::bigtable::experimental::ReadRowCoalescingMaxKeysOption;
+  using ::google::cloud::bigtable::experimental::ReadRowCoalescingWindowOption;
+  auto const window = options.get<ReadRowCoalescingWindowOption>();
+  if (window <= std::chrono::microseconds::zero()) return conn;
+  auto const max_keys = options.has<ReadRowCoalescingMaxKeysOption>()
+                            ? options.get<ReadRowCoalescingMaxKeysOption>()
+                            : kDefaultMaxKeys;
+  auto timer = [cq = std::move(cq)](std::chrono::microseconds d) mutable {
+    return cq.MakeRelativeTimer(d).then([](auto f) { (void)f.get(); });
+  };
+  return std::make_shared<ReadRowCoalescingConnection>(
+      std::move(conn), std::move(timer), window,
+      (std::max)(max_keys, std::size_t{1}));
+}
+
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
+}  // namespace bigtable_internal
+}  // namespace cloud
+}  // namespace google
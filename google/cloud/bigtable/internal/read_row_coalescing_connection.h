@@ -0,0 +1,154 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GOOGLE_CLOUD_CPP_GOOGLE_CLOUD_BIGTABLE_INTERNAL_READ_ROW_COALESCING_CONNECTION_H
+#define GOOGLE_CLOUD_CPP_GOOGLE_CLOUD_BIGTABLE_INTERNAL_READ_ROW_COALESCING_CONNECTION_H
+
+#include "google/cloud/bigtable/data_connection.h"
+#include "google/cloud/completion_queue.h"
+#include "google/cloud/future.h"
+#include "google/cloud/options.h"
+#include "google/cloud/version.h"
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace google {
+namespace cloud {
+namespace bigtable_internal {
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_BEGIN
+
+/**
+ * A `DataConnection` decorator that coalesces concurrent point reads.
+ *
+ * Calls to `ReadRow()` and `AsyncReadRow()` with the same table name, app
+ * profile, and filter are collected into a batch. The batch is sent as a single
+ * `AsyncReadRows()` call when the window started by its first call expires, or
+ * as soon as it holds `max_keys` distinct row keys, whichever comes first.
+ * Each row in the response satisfies the callers waiting on its key, and any
+ * keys not in the response are reported as not found.
+ *
+ * The child connection's row reader resumes interrupted streams with only the
+ * keys it has not returned yet, so retries do not re-read rows that have
+ * already been delivered.
+ *
+ * All other operations are forwarded to the child connection unchanged.
+ */
+class ReadRowCoalescingConnection
+    : public bigtable::DataConnection,
+      public std::enable_shared_from_this<ReadRowCoalescingConnection> {
+ public:
+  /// Returns a future satisfied after the given duration.
+  using Timer = std::function<future<void>(std::chrono::microseconds)>;
+
+  ReadRowCoalescingConnection(std::shared_ptr<bigtable::DataConnection> child,
+                              Timer timer, std::chrono::microseconds window,
+                              std::size_t max_keys);
+  ~ReadRowCoalescingConnection() override;
+
+  Options options() override { return child_->options(); }
+
+  Status Apply(std::string const& table_name,
+               bigtable::SingleRowMutation mut) override;
+
+  future<Status> AsyncApply(std::string const& table_name,
+                            bigtable::SingleRowMutation mut) override;
+
+  std::vector<bigtable::FailedMutation> BulkApply(
+      std::string const& table_name, bigtable::BulkMutation mut) override;
+
+  future<std::vector<bigtable::FailedMutation>> AsyncBulkApply(
+      std::string const& table_name, bigtable::BulkMutation mut) override;
+
+  bigtable::RowReader ReadRows(std::string const& table_name,
+                               bigtable::RowSet row_set,
+                               std::int64_t rows_limit,
+                               bigtable::Filter filter) override;
+
+  bigtable::RowReader ReadRowsFull(bigtable::ReadRowsParams params) override;
+
+  StatusOr<std::pair<bool, bigtable::Row>> ReadRow(
+      std::string const& table_name, std::string row_key,
+      bigtable::Filter filter) override;
+
+  StatusOr<bigtable::MutationBranch> CheckAndMutateRow(
+      std::string const& table_name, std::string row_key,
+      bigtable::Filter filter, std::vector<bigtable::Mutation> true_mutations,
+      std::vector<bigtable::Mutation> false_mutations) override;
+
+  future<StatusOr<bigtable::MutationBranch>> AsyncCheckAndMutateRow(
+      std::string const& table_name, std::string row_key,
+      bigtable::Filter filter, std::vector<bigtable::Mutation> true_mutations,
+      std::vector<bigtable::Mutation> false_mutations) override;
+
+  StatusOr<std::vector<bigtable::RowKeySample>> SampleRows(
+      std::string const& table_name) override;
+
+  future<StatusOr<std::vector<bigtable::RowKeySample>>> AsyncSampleRows(
+      std::string const& table_name) override;
+
+  StatusOr<bigtable::Row> ReadModifyWriteRow(
+      google::bigtable::v2::ReadModifyWriteRowRequest request) override;
+
+  future<StatusOr<bigtable::Row>> AsyncReadModifyWriteRow(
+      google::bigtable::v2::ReadModifyWriteRowRequest request) override;
+
+  void AsyncReadRows(std::string const& table_name,
+                     std::function<future<bool>(bigtable::Row)> on_row,
+                     std::function<void(Status)> on_finish,
+                     bigtable::RowSet row_set, std::int64_t rows_limit,
+                     bigtable::Filter filter) override;
+
+  future<StatusOr<std::pair<bool, bigtable::Row>>> AsyncReadRow(
+      std::string const& table_name, std::string row_key,
+      bigtable::Filter filter) override;
+
+ private:
+  struct Batch;
+
+  void OnTimer(std::shared_ptr<Batch> const& batch);
+  void Flush(std::shared_ptr<Batch> batch);
+
+  std::shared_ptr<bigtable::DataConnection> child_;
+  Timer timer_;
+  std::chrono::microseconds window_;
+  std::size_t max_keys_;
+
+  std::mutex mu_;
+  // The open batches, by table name, app profile, and filter.
+  std::unordered_map<std::string, std::shared_ptr<Batch>> batches_;
+};
+
+/**
+ * Applies the read coalescing decorator to the given connection.
+ *
+ * The decorator is only included if `ReadRowCoalescingWindowOption` is set to
+ * a positive duration.
+ */
+std::shared_ptr<bigtable::DataConnection> MakeReadRowCoalescingConnection(
+    CompletionQueue cq, std::shared_ptr<bigtable::DataConnection> conn,
+    Options const& options);
+
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
+}  // namespace bigtable_internal
+}  // namespace cloud
+}  // namespace google
+
+#endif  // GOOGLE_CLOUD_CPP_GOOGLE_CLOUD_BIGTABLE_INTERNAL_READ_ROW_COALESCING_CONNECTION_H
@@ -0,0 +1,326 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/bigtable/internal/read_row_coalescing_connection.h"
+#include "google/cloud/bigtable/mocks/mock_data_connection.h"
+#include "google/cloud/bigtable/options.h"
+#include "google/cloud/common_options.h"
+#include "google/cloud/internal/make_status.h"
+#include "google/cloud/testing_util/status_matchers.h"
+#include <gmock/gmock.h>
+#include <deque>
+
+namespace google {
+namespace cloud {
+namespace bigtable_internal {
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_BEGIN
+namespace {
+
+using ::google::cloud::bigtable_mocks::MockDataConnection;
+using ::google::cloud::testing_util::StatusIs;
+using ::testing::_;
+using ::testing::ElementsAre;
+using ::testing::Eq;
+using ::testing::Pair;
+using ::testing::Return;
+using ::testing::UnorderedElementsAre;
+using ms = std::chrono::milliseconds;
+using us = std::chrono::microseconds;
+
+auto constexpr kTableName = "test-table";
+auto constexpr kWindow = us(500);
+
+// A fake timer. The tests decide when each timer expires.
+class FakeTimers {
+ public:
+  ReadRowCoalescingConnection::Timer MakeTimer() {
+    return [this](us d) {
+      EXPECT_EQ(d, kWindow);
+      pending_.emplace_back();
+      return pending_.back().get_future();
+    };
+  }
+
+  std::size_t size() const { return pending_.size(); }
+
+  void FireNext() {
+    auto p = std::move(pending_.front());
+    pending_.pop_front();
+    p.set_value();
+  }
+
+ private:
+  std::deque<promise<void>> pending_;
+};
+
+std::shared_ptr<ReadRowCoalescingConnection> MakeConnection(
+    std::shared_ptr<bigtable::DataConnection> child, FakeTimers& timers,
+    std::size_t max_keys = 100) {
+  return std::make_shared<ReadRowCoalescingConnection>(
+      std::move(child), timers.MakeTimer(), kWindow, max_keys);
+}
+
+std::vector<std::string> RowKeys(bigtable::RowSet const& row_set) {
+  auto const& keys = row_set.as_proto().row_keys();
+  return {keys.begin(), keys.end()};
+}
+
+TEST(ReadRowCoalescingConnection, CoalescesConcurrentReads) {
+  auto mock = std::make_shared<MockDataConnection>();
+  EXPECT_CALL(*mock, AsyncReadRows)
+      .WillOnce([](std::string const& table_name, auto on_row, auto on_finish,
+                   bigtable::RowSet const& row_set, std::int64_t rows_limit,
+                   bigtable::Filter const& filter) {
+        EXPECT_EQ(table_name, kTableName);
+        EXPECT_THAT(RowKeys(row_set), UnorderedElementsAre("r1", "r2"));
+        EXPECT_EQ(rows_limit, bigtable::RowReader::NO_ROWS_LIMIT);
+        EXPECT_EQ(filter.as_proto().SerializeAsString(),
+                  bigtable::Filter::Latest(1).as_proto().SerializeAsString());
+        EXPECT_TRUE(on_row(bigtable::Row("r1", {})).get());
+        on_finish(Status());
+      });
+
+  FakeTimers timers;
+  auto conn = MakeConnection(mock, timers);
+  auto f1 = conn->AsyncReadRow(kTableName, "r1", bigtable::Filter::Latest(1));
+  auto f2 = conn->AsyncReadRow(kTableName, "r2", bigtable::Filter::Latest(1));
+  auto f3 = conn->AsyncReadRow(kTableName, "r1", bigtable::Filter::Latest(1));
+  ASSERT_EQ(timers.size(), 1);
+  EXPECT_EQ(f1.wait_for(ms(0)), std::future_status::timeout);
+
+  timers.FireNext();
+  auto r1 = f1.get();
+  ASSERT_STATUS_OK(r1);
+  EXPECT_TRUE(r1->first);
+  EXPECT_EQ(r1->second.row_key(), "r1");
+  auto r2 = f2.get();
+  ASSERT_STATUS_OK(r2);
+  EXPECT_FALSE(r2->first);
+  auto r3 = f3.get();
+  ASSERT_STATUS_OK(r3);
+  EXPECT_TRUE(r3->first);
+  EXPECT_EQ(r3->second.row_key(), "r1");
+}
+
+TEST(ReadRowCoalescingConnection, FlushesWhenFull) {
+  auto mock = std::make_shared<MockDataConnection>();
+  EXPECT_CALL(*mock, AsyncReadRows)
+      .WillOnce([](std::string const&, auto on_row, auto on_finish,
+                   bigtable::RowSet const& row_set, std::int64_t,
+                   bigtable::Filter const&) {
+        EXPECT_THAT(RowKeys(row_set), UnorderedElementsAre("r1", "r2"));
+        EXPECT_TRUE(on_row(bigtable::Row("r2", {})).get());
+        on_finish(Status());
+      });
+
+  FakeTimers timers;
+  auto conn = MakeConnection(mock, timers, 2);
+  auto const filter = bigtable::Filter::PassAllFilter();
+  auto f1 = conn->AsyncReadRow(kTableName, "r1", filter);
+  auto f2 = conn->AsyncReadRow(kTableName, "r2", filter);
+  // The batch is sent without waiting for the timer.
+  auto r1 = f1.get();
+  ASSERT_STATUS_OK(r1);
+  EXPECT_FALSE(r1->first);
+  auto r2 = f2.get();
+  ASSERT_STATUS_OK(r2);
+  EXPECT_TRUE(r2->first);
+
+  // The expired timer does not send the batch again.
+  ASSERT_EQ(timers.size(), 1);
+  timers.FireNext();
+}
+
+TEST(ReadRowCoalescingConnection, SeparateBatches) {
+  auto mock = std::make_shared<MockDataConnection>();
+  std::vector<std::pair<std::string, std::vector<std::string>>> requests;
+  EXPECT_CALL(*mock, AsyncReadRows)
+      .Times(3)
+      .WillRepeatedly([&](std::string const& table_name, auto, auto on_finish,
+                          bigtable::RowSet const& row_set, std::int64_t,
+                          bigtable::Filter const&) {
+        auto const& options = internal::CurrentOptions();
+        requests.emplace_back(
+            table_name + "/" + options.get<bigtable::AppProfileIdOption>(),
+            RowKeys(row_set));
+        on_finish(Status());
+      });
+
+  FakeTimers timers;
+  auto conn = MakeConnection(mock, timers);
+  std::vector<future<StatusOr<std::pair<bool, bigtable::Row>>>> pending;
+  pending.push_back(
+      conn->AsyncReadRow("t1", "r1", bigtable::Filter::Latest(1)));
+  pending.push_back(
+      conn->AsyncReadRow("t1", "r2", bigtable::Filter::Latest(2)));
+  {
+    internal::OptionsSpan span(
+        Options{}.set<bigtable::AppProfileIdOption>("profile"));
+    pending.push_back(
+        conn->AsyncReadRow("t1", "r3", bigtable::Filter::Latest(1)));
+  }
+  ASSERT_EQ(timers.size(), 3);
+  while (timers.size() != 0) timers.FireNext();
+  for (auto& f : pending) EXPECT_STATUS_OK(f.get());
+  EXPECT_THAT(requests, UnorderedElementsAre(
+                            Pair("t1/", ElementsAre("r1")),
+                            Pair("t1/", ElementsAre("r2")),
+                            Pair("t1/profile", ElementsAre("r3"))));
+}
+
+TEST(ReadRowCoalescingConnection, SeparateBatchesByOptions) {
+  auto mock = std::make_shared<MockDataConnection>();
+  std::vector<std::vector<std::string>> requests;
+  EXPECT_CALL(*mock, AsyncReadRows)
+      .Times(5)
+      .WillRepeatedly([&](std::string const&, auto, auto on_finish,
+                          bigtable::RowSet const& row_set, std::int64_t,
+                          bigtable::Filter const&) {
+        requests.push_back(RowKeys(row_set));
+        on_finish(Status());
+      });
+
+  FakeTimers timers;
+  auto conn = MakeConnection(mock, timers);
+  std::shared_ptr<bigtable::DataRetryPolicy> p1 =
+      bigtable::DataLimitedErrorCountRetryPolicy(3).clone();
+  std::shared_ptr<bigtable::DataRetryPolicy> p2 =
+      bigtable::DataLimitedErrorCountRetryPolicy(3).clone();
+  auto const filter = bigtable::Filter::Latest(1);
+  std::vector<future<StatusOr<std::pair<bool, bigtable::Row>>>> pending;
+  auto read = [&](std::string row_key, Options options) {
+    internal::OptionsSpan span(std::move(options));
+    pending.push_back(
+        conn->AsyncReadRow(kTableName, std::move(row_key), filter));
+  };
+  read("r1", Options{});
+  read("r2", Options{}.set<UserProjectOption>("project"));
+  read("r3", Options{}.set<CustomHeadersOption>({{"x-test", "value"}}));
+  read("r4", Options{}.set<bigtable::DataRetryPolicyOption>(p1));
+  read("r5", Options{}.set<bigtable::DataRetryPolicyOption>(p1));
+  read("r6", Options{}.set<bigtable::DataRetryPolicyOption>(p2));
+  ASSERT_EQ(timers.size(), 5);
+  while (timers.size() != 0) timers.FireNext();
+  for (auto& f : pending) EXPECT_STATUS_OK(f.get());
+  EXPECT_THAT(requests,
+              UnorderedElementsAre(ElementsAre("r1"), ElementsAre("r2"),
+                                   ElementsAre("r3"),
+                                   UnorderedElementsAre("r4", "r5"),
+                                   ElementsAre("r6")));
+}
+
+TEST(ReadRowCoalescingConnection, PermanentError) {
+  auto mock = std::make_shared<MockDataConnection>();
+  EXPECT_CALL(*mock, AsyncReadRows)
+      .WillOnce([](std::string const&, auto on_row, auto on_finish,
+                   bigtable::RowSet const&, std::int64_t,
+                   bigtable::Filter const&) {
+        EXPECT_TRUE(on_row(bigtable::Row("r1", {})).get());
+        on_finish(internal::PermissionDeniedError("fail"));
+      });
+
+  FakeTimers timers;
+  auto conn = MakeConnection(mock, timers);
+  auto f1 = conn->AsyncReadRow(kTableName, "r1", bigtable::Filter::Latest(1));
+  auto f2 = conn->AsyncReadRow(kTableName, "r2", bigtable::Filter::Latest(1));
+  timers.FireNext();
+  // Rows received before the error are still delivered.
+  auto r1 = f1.get();
+  ASSERT_STATUS_OK(r1);
+  EXPECT_TRUE(r1->first);
+  EXPECT_THAT(f2.get(), StatusIs(StatusCode::kPermissionDenied, Eq("fail")));
+}
+
+TEST(ReadRowCoalescingConnection, DestroyedBeforeTimer) {
+  auto mock = std::make_shared<MockDataConnection>();
+  EXPECT_CALL(*mock, AsyncReadRows).Times(0);
+
+  FakeTimers timers;
+  auto conn = MakeConnection(mock, timers);
+  auto f1 = conn->AsyncReadRow(kTableName, "r1", bigtable::Filter::Latest(1));
+  auto f2 = conn->AsyncReadRow(kTableName, "r2", bigtable::Filter::Latest(2));
+  ASSERT_EQ(timers.size(), 2);
+  EXPECT_EQ(f1.wait_for(ms(0)), std::future_status::timeout);
+
+  // The pending timers do not keep the connection alive.
+  std::weak_ptr<ReadRowCoalescingConnection> weak = conn;
+  conn.reset();
+  EXPECT_TRUE(weak.expired());
+  EXPECT_THAT(f1.get(), StatusIs(StatusCode::kCancelled));
+  EXPECT_THAT(f2.get(), StatusIs(StatusCode::kCancelled));
+
+  // The timers expire after the connection is gone.
+  while (timers.size() != 0) timers.FireNext();
+}
+
+TEST(ReadRowCoalescingConnection, ReadRow) {
+  auto mock = std::make_shared<MockDataConnection>();
+  EXPECT_CALL(*mock, ReadRow).Times(0);
+  EXPECT_CALL(*mock, AsyncReadRows)
+      .WillOnce([](std::string const&, auto on_row, auto on_finish,
+                   bigtable::RowSet const& row_set, std::int64_t,
+                   bigtable::Filter const&) {
+        EXPECT_THAT(RowKeys(row_set), ElementsAre("r1"));
+        EXPECT_TRUE(on_row(bigtable::Row("r1", {})).get());
+        on_finish(Status());
+      });
+
+  FakeTimers timers;
+  // With a single key per batch, the request is sent right away.
+  auto conn = MakeConnection(mock, timers, 1);
+  auto row = conn->ReadRow(kTableName, "r1", bigtable::Filter::Latest(1));
+  ASSERT_STATUS_OK(row);
+  EXPECT_TRUE(row->first);
+  EXPECT_EQ(row->second.row_key(), "r1");
+  EXPECT_EQ(timers.size(), 0);
+}
+
+TEST(ReadRowCoalescingConnection, ForwardsOtherCalls) {
+  auto mock = std::make_shared<MockDataConnection>();
+  EXPECT_CALL(*mock, Apply(kTableName, _))
+      .WillOnce(Return(internal::AbortedError("fail")));
+
+  FakeTimers timers;
+  auto conn = MakeConnection(mock, timers);
+  auto mut = bigtable::SingleRowMutation(
+      "row", {bigtable::SetCell("fam", "col", ms(0), "val")});
+  EXPECT_THAT(conn->Apply(kTableName, std::move(mut)),
+              StatusIs(StatusCode::kAborted));
+  EXPECT_EQ(timers.size(), 0);
+}
+
+TEST(MakeReadRowCoalescingConnection, DisabledByDefault) {
+  auto mock = std::make_shared<MockDataConnection>();
+  CompletionQueue cq;
+  auto conn = MakeReadRowCoalescingConnection(cq, mock, Options{});
+  EXPECT_EQ(conn, mock);
+
+  conn = MakeReadRowCoalescingConnection(
+      cq, mock,
+      Options{}.set<bigtable::experimental::ReadRowCoalescingWindowOption>(
+          us(0)));
+  EXPECT_EQ(conn, mock);
+
+  conn = MakeReadRowCoalescingConnection(
+      cq, mock,
+      Options{}.set<bigtable::experimental::ReadRowCoalescingWindowOption>(
+          kWindow));
+  EXPECT_NE(conn, mock);
+}
+
+}  // namespace
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
+}  // namespace bigtable_internal
+}  // namespace cloud
+}  // namespace google
@@ -0,0 +1,338 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/bigtable/internal/row_cache_connection.h"
+#include "google/cloud/bigtable/options.h"
+#include <algorithm>
+#include <functional>
+#include <iterator>
+
+namespace google {
+namespace cloud {
+namespace bigtable_internal {
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_BEGIN
+namespace {
+
+using ReadRowResult = StatusOr<std::pair<bool, bigtable::Row>>;
+
+auto constexpr kDefaultTtl = std::chrono::seconds(1);
+std::size_t constexpr kShardCount = 16;
+// An estimate of the per-entry overhead of the map and list nodes.
+std::size_t constexpr kEntryOverhead = 128;
+
+// The common prefix of the keys for all the entries of a row. The row key is
+// length-prefixed, as it may contain any byte.
+std::string RowPrefix(std::string const& table_name,
+                      std::string const& row_key) {
+  auto prefix = table_name;
+  prefix.push_back('\0');
+  prefix += std::to_string(row_key.size());
+  prefix.push_back(':');
+  prefix += row_key;
+  return prefix;
+}
+
+std::size_t EntryBytes(std::string const& key, bigtable::Row const& row) {
+  // The key is stored in the map and in the LRU list.
+  auto bytes = kEntryOverhead + 2 * key.size() + row.row_key().size();
+  for (auto const& cell : row.cells()) {
+    bytes += sizeof(cell) + cell.row_key().size() + cell.family_name().size() +
+             cell.column_qualifier().size() + cell.value().size();
+    for (auto const& label : cell.labels()) bytes += label.size();
+  }
+  return bytes;
+}
+
+// `BulkMutation` does not expose its row keys, so take the mutations apart and
+// put them back.
+std::vector<std::string> RowKeys(bigtable::BulkMutation& mut) {
+  google::bigtable::v2::MutateRowsRequest request;
+  mut.MoveTo(&request);
+  std::vector<std::string> keys;
+  keys.reserve(static_cast<std::size_t>(request.entries_size()));
+  for (auto& entry : *request.mutable_entries()) {
+    keys.push_back(entry.row_key());
+    mut.emplace_back(bigtable::SingleRowMutation(std::move(entry)));
+  }
+  return keys;
+}
+
+}  // namespace
+
+RowCache::RowCache(
+    std::shared_ptr<Clock> clock, std::size_t max_bytes,
+    std::chrono::milliseconds ttl, std::size_t shard_count,
+    std::shared_ptr<bigtable::experimental::RowCacheStats> stats)
+    : clock_(std::move(clock)),
+      shard_max_bytes_((std::max)(max_bytes / shard_count, std::size_t{1})),
+      ttl_(ttl),
+      stats_(std::move(stats)) {
+  if (!stats_) {
+    stats_ = std::make_shared<bigtable::experimental::RowCacheStats>();
+  }
+  shards_.reserve(shard_count);
+  for (std::size_t i = 0; i != shard_count; ++i) {
+    shards_.push_back(std::make_unique<Shard>());
+  }
+}
+
+absl::optional<RowCache::Value> RowCache::Lookup(
+    std::string const& table_name, std::string const& row_key,
+    bigtable::Filter const& filter, Ticket& ticket) {
+  ticket.key = RowPrefix(table_name, row_key);
+  ticket.shard = std::hash<std::string>{}(ticket.key) % shards_.size();
+  // Different app profiles may route the read to different clusters, which
+  // are only eventually consistent. The profile is length-prefixed, as the
+  // filter follows it.
+  auto const& app_profile =
+      internal::CurrentOptions().get<bigtable::AppProfileIdOption>();
+  ticket.key += std::to_string(app_profile.size());
+  ticket.key.push_back(':');
+  ticket.key += app_profile;
+  ticket.key += filter.as_proto().SerializeAsString();
+
+  auto& shard = *shards_[ticket.shard];
+  std::lock_guard<std::mutex> lk(shard.mu);
+  auto i = shard.entries.find(ticket.key);
+  if (i != shard.entries.end()) {
+    if (clock_->Now() < i->second.expiration) {
+      shard.lru.splice(shard.lru.begin(), shard.lru, i->second.lru);
+      ++stats_->hits_;
+      return i->second.value;
+    }
+    Erase(shard, i);
+    ++stats_->evictions_;
+  }
+  ticket.generation = shard.generation;
+  ++stats_->misses_;
+  return absl::nullopt;
+}
+
+void RowCache::Insert(Ticket ticket, Value const& value) {
+  auto const bytes = EntryBytes(ticket.key, value.second);
+  if (bytes > shard_max_bytes_) return;
+
+  auto& shard = *shards_[ticket.shard];
+  std::lock_guard<std::mutex> lk(shard.mu);
+  // The row was modified while the value was read. It may be stale.
+  if (shard.generation != ticket.generation) return;
+  // Another miss for the same entry may have completed first.
+  auto i = shard.entries.find(ticket.key);
+  if (i != shard.entries.end()) Erase(shard, i);
+
+  shard.lru.push_front(ticket.key);
+  shard.entries.emplace(
+      std::move(ticket.key),
+      Entry{value, clock_->Now() + ttl_, bytes, shard.lru.begin()});
+  shard.bytes += bytes;
+  while (shard.bytes > shard_max_bytes_) {
+    Erase(shard, shard.entries.find(shard.lru.back()));
+    ++stats_->evictions_;
+  }
+}
+
+void RowCache::Invalidate(std::string const& table_name,
+                          std::string const& row_key) {
+  auto const prefix = RowPrefix(table_name, row_key);
+  auto& shard = *shards_[std::hash<std::string>{}(prefix) % shards_.size()];
+  std::lock_guard<std::mutex> lk(shard.mu);
+  ++shard.generation;
+  auto i = shard.entries.lower_bound(prefix);
+  while (i != shard.entries.end() &&
+         i->first.compare(0, prefix.size(), prefix) == 0) {
+    Erase(shard, i++);
+    ++stats_->invalidations_;
+  }
+}
+
+void RowCache::Erase(Shard& shard, std::map<std::string, Entry>::iterator i) {
+  shard.bytes -= i->second.bytes;
+  shard.lru.erase(i->second.lru);
+  shard.entries.erase(i);
+}
+
+RowCacheConnection::RowCacheConnection(
+    std::shared_ptr<bigtable::DataConnection> child,
+    std::shared_ptr<RowCache> cache)
+    : child_(std::move(child)), cache_(std::move(cache)) {}
+
+Status RowCacheConnection::Apply(std::string const& table_name,
+                                 bigtable::SingleRowMutation mut) {
+  auto row_key = mut.row_key();
+  auto status = child_->Apply(table_name, std::move(mut));
+  cache_->Invalidate(table_name, row_key);
+  return status;
+}
+
+future<Status> RowCacheConnection::AsyncApply(std::string const& table_name,
+                                              bigtable::SingleRowMutation mut) {
+  auto row_key = mut.row_key();
+  return child_->AsyncApply(table_name, std::move(mut))
+      .then([cache = cache_, table_name,
+             row_key = std::move(row_key)](future<Status> f) {
+        cache->Invalidate(table_name, row_key);
+        return f.get();
+      });
+}
+
+std::vector<bigtable::FailedMutation> RowCacheConnection::BulkApply(
+    std::string const& table_name, bigtable::BulkMutation mut) {
+  auto row_keys = RowKeys(mut);
+  auto failures = child_->BulkApply(table_name, std::move(mut));
+  for (auto const& row_key : row_keys) cache_->Invalidate(table_name, row_key);
+  return failures;
+}
+
+future<std::vector<bigtable::FailedMutation>>
+RowCacheConnection::AsyncBulkApply(std::string const& table_name,
+                                   bigtable::BulkMutation mut) {
+  auto row_keys = RowKeys(mut);
+  return child_->AsyncBulkApply(table_name, std::move(mut))
+      .then([cache = cache_, table_name, row_keys = std::move(row_keys)](
+                future<std::vector<bigtable::FailedMutation>> f) {
+        for (auto const& row_key : row_keys) {
+          cache->Invalidate(table_name, row_key);
+        }
+        return f.get();
+      });
+}
+
+bigtable::RowReader RowCacheConnection::ReadRows(
+    std::string const& table_name, bigtable::RowSet row_set,
+    std::int64_t rows_limit, bigtable::Filter filter) {
+  return child_->ReadRows(table_name, std::move(row_set), rows_limit,
+                          std::move(filter));
+}
+
+bigtable::RowReader RowCacheConnection::ReadRowsFull(
+    bigtable::ReadRowsParams params) {
+  return child_->ReadRowsFull(std::move(params));
+}
+
+StatusOr<std::pair<bool, bigtable::Row>> RowCacheConnection::ReadRow(
+    std::string const& table_name, std::string row_key,
+    bigtable::Filter filter) {
+  RowCache::Ticket ticket;
+  auto cached = cache_->Lookup(table_name, row_key, filter, ticket);
+  if (cached) return *std::move(cached);
+  auto result =
+      child_->ReadRow(table_name, std::move(row_key), std::move(filter));
+  if (result) cache_->Insert(std::move(ticket), *result);
+  return result;
+}
+
+StatusOr<bigtable::MutationBranch> RowCacheConnection::CheckAndMutateRow(
+    std::string const& table_name, std::string row_key,
+    bigtable::Filter filter, std::vector<bigtable::Mutation> true_mutations,
+    std::vector<bigtable::Mutation> false_mutations) {
+  auto result = child_->CheckAndMutateRow(
+      table_name, row_key, std::move(filter), std::move(true_mutations),
+      std::move(false_mutations));
+  cache_->Invalidate(table_name, row_key);
+  return result;
+}
+
+future<StatusOr<bigtable::MutationBranch>>
+RowCacheConnection::AsyncCheckAndMutateRow(
+    std::string const& table_name, std::string row_key,
+    bigtable::Filter filter, std::vector<bigtable::Mutation> true_mutations,
+    std::vector<bigtable::Mutation> false_mutations) {
+  return child_
+      ->AsyncCheckAndMutateRow(table_name, row_key, std::move(filter),
+                               std::move(true_mutations),
+                               std::move(false_mutations))
+      .then([cache = cache_, table_name, row_key = std::move(row_key)](
+                future<StatusOr<bigtable::MutationBranch>> f) {
+        cache->Invalidate(table_name, row_key);
+        return f.get();
+      });
+}
+
+StatusOr<std::vector<bigtable::RowKeySample>> RowCacheConnection::SampleRows(
+    std::string const& table_name) {
+  return child_->SampleRows(table_name);
+}
+
+future<StatusOr<std::vector<bigtable::RowKeySample>>>
+RowCacheConnection::AsyncSampleRows(std::string const& table_name) {
+  return child_->AsyncSampleRows(table_name);
+}
+
+StatusOr<bigtable::Row> RowCacheConnection::ReadModifyWriteRow(
+    google::bigtable::v2::ReadModifyWriteRowRequest request) {
+  auto table_name = request.table_name();
+  auto row_key = request.row_key();
+  auto result = child_->ReadModifyWriteRow(std::move(request));
+  cache_->Invalidate(table_name, row_key);
+  return result;
+}
+
+future<StatusOr<bigtable::Row>> RowCacheConnection::AsyncReadModifyWriteRow(
+    google::bigtable::v2::ReadModifyWriteRowRequest request) {
+  auto table_name = request.table_name();
+  auto row_key = request.row_key();
+  return child_->AsyncReadModifyWriteRow(std::move(request))
+      .then([cache = cache_, table_name = std::move(table_name),
+             row_key = std::move(row_key)](future<StatusOr<bigtable::Row>> f) {
+        cache->Invalidate(table_name, row_key);
+        return f.get();
+      });
+}
+
+void RowCacheConnection::AsyncReadRows(
+    std::string const& table_name,
+    std::function<future<bool>(bigtable::Row)> on_row,
+    std::function<void(Status)> on_finish, bigtable::RowSet row_set,
+    std::int64_t rows_limit, bigtable::Filter filter) {
+  child_->AsyncReadRows(table_name, std::move(on_row), std::move(on_finish),
+                        std::move(row_set), rows_limit, std::move(filter));
+}
+
+future<StatusOr<std::pair<bool, bigtable::Row>>>
+RowCacheConnection::AsyncReadRow(std::string const& table_name,
+                                 std::string row_key, bigtable::Filter filter) {
+  RowCache::Ticket ticket;
+  auto cached = cache_->Lookup(table_name, row_key, filter, ticket);
+  if (cached) return make_ready_future(ReadRowResult(*std::move(cached)));
+  return child_
+      ->AsyncReadRow(table_name, std::move(row_key), std::move(filter))
+      .then([cache = cache_, ticket = std::move(ticket)](
+                future<ReadRowResult> f) mutable {
+        auto result = f.get();
+        if (result) cache->Insert(std::move(ticket), *result);
+        return result;
+      });
+}
+
+std::shared_ptr<bigtable::DataConnection> MakeRowCacheConnection(
+    std::shared_ptr<bigtable::DataConnection> conn, Options const& options) {
+  using ::google::cloud::bigtable::experimental::RowCacheMaxBytesOption;
+  using ::google::cloud::bigtable::experimental::RowCacheStatsOption;
+  using ::google::cloud::bigtable::experimental::RowCacheTtlOption;
+  auto const max_bytes = options.get<RowCacheMaxBytesOption>();
+  if (max_bytes == 0) return conn;
+  auto const ttl = options.has<RowCacheTtlOption>()
+                       ? options.get<RowCacheTtlOption>()
+                       : std::chrono::milliseconds(kDefaultTtl);
+  auto cache = std::make_shared<RowCache>(
+      std::make_shared<RowCache::Clock>(), max_bytes, ttl, kShardCount,
+      options.get<RowCacheStatsOption>());
+  return std::make_shared<RowCacheConnection>(std::move(conn),
+                                              std::move(cache));
+}
+
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
+}  // namespace bigtable_internal
+}  // namespace cloud
+}  // namespace google
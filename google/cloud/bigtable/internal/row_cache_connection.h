@@ -0,0 +1,204 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GOOGLE_CLOUD_CPP_GOOGLE_CLOUD_BIGTABLE_INTERNAL_ROW_CACHE_CONNECTION_H
+#define GOOGLE_CLOUD_CPP_GOOGLE_CLOUD_BIGTABLE_INTERNAL_ROW_CACHE_CONNECTION_H
+
+#include "google/cloud/bigtable/data_connection.h"
+#include "google/cloud/bigtable/row_cache_stats.h"
+#include "google/cloud/internal/clock.h"
+#include "google/cloud/options.h"
+#include "google/cloud/version.h"
+#include "absl/types/optional.h"
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace google {
+namespace cloud {
+namespace bigtable_internal {
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_BEGIN
+
+/**
+ * A sharded, size-bounded LRU cache of `ReadRow()` results with a TTL.
+ *
+ * Entries are keyed by table name, row key, app profile, and filter. The app
+ * profile is the `bigtable::AppProfileIdOption` in the current `OptionsSpan`.
+ * All the entries for a row live in the same shard, so invalidating a row
+ * locks a single shard.
+ *
+ * Each shard counts its invalidations. A read that misses the cache records
+ * this count, and its result is only inserted if no row in the shard was
+ * invalidated in the meantime. This prevents a read that races with a write
+ * from caching the value that the write replaced.
+ */
+class RowCache {
+ public:
+  using Clock = ::google::cloud::internal::SteadyClock;
+  using Value = std::pair<bool, bigtable::Row>;
+
+  /// Identifies a cache entry, and the shard state observed by a lookup.
+  struct Ticket {
+    std::string key;
+    std::size_t shard;
+    std::uint64_t generation;
+  };
+
+  RowCache(std::shared_ptr<Clock> clock, std::size_t max_bytes,
+           std::chrono::milliseconds ttl, std::size_t shard_count,
+           std::shared_ptr<bigtable::experimental::RowCacheStats> stats);
+
+  /**
+   * Returns the cached value for the row, if any.
+   *
+   * On a miss, @p ticket is set so the caller can `Insert()` the value it
+   * reads from the service.
+   */
+  absl::optional<Value> Lookup(std::string const& table_name,
+                               std::string const& row_key,
+                               bigtable::Filter const& filter, Ticket& ticket);
+
+  /// Caches @p value, unless the row was invalidated since the lookup.
+  void Insert(Ticket ticket, Value const& value);
+
+  /// Removes all the cached values for a row.
+  void Invalidate(std::string const& table_name, std::string const& row_key);
+
+ private:
+  struct Entry {
+    Value value;
+    Clock::time_point expiration;
+    std::size_t bytes;
+    std::list<std::string>::iterator lru;
+  };
+
+  struct Shard {
+    std::mutex mu;
+    // Ordered, so all the entries for a row are adjacent.
+    std::map<std::string, Entry> entries;
+    // The entry keys, most recently used first.
+    std::list<std::string> lru;
+    std::size_t bytes = 0;
+    std::uint64_t generation = 0;
+  };
+
+  void Erase(Shard& shard, std::map<std::string, Entry>::iterator i);
+
+  std::shared_ptr<Clock> clock_;
+  std::size_t shard_max_bytes_;
+  std::chrono::milliseconds ttl_;
+  std::shared_ptr<bigtable::experimental::RowCacheStats> stats_;
+  std::vector<std::unique_ptr<Shard>> shards_;
+};
+
+/**
+ * A `DataConnection` decorator that serves point reads from a `RowCache`.
+ *
+ * `ReadRow()` and `AsyncReadRow()` check the cache before calling the child
+ * connection, and cache successful results. Operations that modify rows
+ * invalidate the rows they touch once they complete, whether or not they
+ * succeed, as a failed mutation may have been partially applied.
+ *
+ * All other operations are forwarded to the child connection unchanged.
+ */
+class RowCacheConnection : public bigtable::DataConnection {
+ public:
+  RowCacheConnection(std::shared_ptr<bigtable::DataConnection> child,
+                     std::shared_ptr<RowCache> cache);
+  ~RowCacheConnection() override = default;
+
+  Options options() override { return child_->options(); }
+
+  Status Apply(std::string const& table_name,
+               bigtable::SingleRowMutation mut) override;
+
+  future<Status> AsyncApply(std::string const& table_name,
+                            bigtable::SingleRowMutation mut) override;
+
+  std::vector<bigtable::FailedMutation> BulkApply(
+      std::string const& table_name, bigtable::BulkMutation mut) override;
+
+  future<std::vector<bigtable::FailedMutation>> AsyncBulkApply(
+      std::string const& table_name, bigtable::BulkMutation mut) override;
+
+  bigtable::RowReader ReadRows(std::string const& table_name,
+                               bigtable::RowSet row_set,
+                               std::int64_t rows_limit,
+                               bigtable::Filter filter) override;
+
+  bigtable::RowReader ReadRowsFull(bigtable::ReadRowsParams params) override;
+
+  StatusOr<std::pair<bool, bigtable::Row>> ReadRow(
+      std::string const& table_name, std::string row_key,
+      bigtable::Filter filter) override;
+
+  StatusOr<bigtable::MutationBranch> CheckAndMutateRow(
+      std::string const& table_name, std::string row_key,
+      bigtable::Filter filter, std::vector<bigtable::Mutation> true_mutations,
+      std::vector<bigtable::Mutation> false_mutations) override;
+
+  future<StatusOr<bigtable::MutationBranch>> AsyncCheckAndMutateRow(
+      std::string const& table_name, std::string row_key,
+      bigtable::Filter filter, std::vector<bigtable::Mutation> true_mutations,
+      std::vector<bigtable::Mutation> false_mutations) override;
+
+  StatusOr<std::vector<bigtable::RowKeySample>> SampleRows(
+      std::string const& table_name) override;
+
+  future<StatusOr<std::vector<bigtable::RowKeySample>>> AsyncSampleRows(
+      std::string const& table_name) override;
+
+  StatusOr<bigtable::Row> ReadModifyWriteRow(
+      google::bigtable::v2::ReadModifyWriteRowRequest request) override;
+
+  future<StatusOr<bigtable::Row>> AsyncReadModifyWriteRow(
+      google::bigtable::v2::ReadModifyWriteRowRequest request) override;
+
+  void AsyncReadRows(std::string const& table_name,
+                     std::function<future<bool>(bigtable::Row)> on_row,
+                     std::function<void(Status)> on_finish,
+                     bigtable::RowSet row_set, std::int64_t rows_limit,
+                     bigtable::Filter filter) override;
+
+  future<StatusOr<std::pair<bool, bigtable::Row>>> AsyncReadRow(
+      std::string const& table_name, std::string row_key,
+      bigtable::Filter filter) override;
+
+ private:
+  std::shared_ptr<bigtable::DataConnection> child_;
+  std::shared_ptr<RowCache> cache_;
+};
+
+/**
+ * Applies the row cache decorator to the given connection.
+ *
+ * The decorator is only included if `RowCacheMaxBytesOption` is set to a
+ * positive value.
+ */
+std::shared_ptr<bigtable::DataConnection> MakeRowCacheConnection(
+    std::shared_ptr<bigtable::DataConnection> conn, Options const& options);
+
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
+}  // namespace bigtable_internal
+}  // namespace cloud
+}  // namespace google
+
+#endif  // GOOGLE_CLOUD_CPP_GOOGLE_CLOUD_BIGTABLE_INTERNAL_ROW_CACHE_CONNECTION_H
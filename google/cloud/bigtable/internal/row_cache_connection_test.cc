@@ -0,0 +1,330 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/bigtable/internal/row_cache_connection.h"
+#include "google/cloud/bigtable/mocks/mock_data_connection.h"
+#include "google/cloud/bigtable/options.h"
+#include "google/cloud/internal/make_status.h"
+#include "google/cloud/testing_util/fake_clock.h"
+#include "google/cloud/testing_util/status_matchers.h"
+#include <gmock/gmock.h>
+
+namespace google {
+namespace cloud {
+namespace bigtable_internal {
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_BEGIN
+namespace {
+
+using ::google::cloud::bigtable::experimental::RowCacheStats;
+using ::google::cloud::bigtable_mocks::MockDataConnection;
+using ::google::cloud::testing_util::FakeSteadyClock;
+using ::google::cloud::testing_util::StatusIs;
+using ::testing::_;
+using ::testing::ByMove;
+using ::testing::ElementsAre;
+using ::testing::Return;
+using ms = std::chrono::milliseconds;
+
+auto constexpr kTableName = "projects/p/instances/i/tables/t";
+auto constexpr kTtl = ms(1000);
+
+bigtable::Row MakeRow(std::string row_key, std::string value = "value") {
+  return bigtable::Row(row_key, {bigtable::Cell(row_key, "fam", "col", 0,
+                                                std::move(value))});
+}
+
+StatusOr<std::pair<bool, bigtable::Row>> Found(std::string row_key) {
+  return std::make_pair(true, MakeRow(std::move(row_key)));
+}
+
+bigtable::SingleRowMutation Mutation(std::string row_key) {
+  return bigtable::SingleRowMutation(
+      std::move(row_key), {bigtable::SetCell("fam", "col", ms(0), "val")});
+}
+
+struct TestCache {
+  explicit TestCache(std::shared_ptr<bigtable::DataConnection> child,
+                     std::size_t max_bytes = 1024 * 1024,
+                     std::size_t shard_count = 4)
+      : clock(std::make_shared<FakeSteadyClock>()),
+        stats(std::make_shared<RowCacheStats>()),
+        conn(std::make_shared<RowCacheConnection>(
+            std::move(child),
+            std::make_shared<RowCache>(clock, max_bytes, kTtl, shard_count,
+                                       stats))) {}
+
+  std::shared_ptr<FakeSteadyClock> clock;
+  std::shared_ptr<RowCacheStats> stats;
+  std::shared_ptr<bigtable::DataConnection> conn;
+};
+
+TEST(RowCacheConnection, ReadRowHit) {
+  auto mock = std::make_shared<MockDataConnection>();
+  EXPECT_CALL(*mock, ReadRow(kTableName, "r1", _))
+      .WillOnce(Return(Found("r1")));
+  EXPECT_CALL(*mock, ReadRow(kTableName, "r2", _))
+      .WillOnce(Return(std::make_pair(false, bigtable::Row("", {}))));
+
+  TestCache cache(mock);
+  auto const filter = bigtable::Filter::Latest(1);
+  for (int i = 0; i != 3; ++i) {
+    auto row = cache.conn->ReadRow(kTableName, "r1", filter);
+    ASSERT_STATUS_OK(row);
+    EXPECT_TRUE(row->first);
+    EXPECT_EQ(row->second.row_key(), "r1");
+    ASSERT_EQ(row->second.cells().size(), 1);
+    EXPECT_EQ(row->second.cells()[0].value(), "value");
+  }
+  // Rows that do not exist are cached too.
+  for (int i = 0; i != 2; ++i) {
+    auto row = cache.conn->ReadRow(kTableName, "r2", filter);
+    ASSERT_STATUS_OK(row);
+    EXPECT_FALSE(row->first);
+  }
+  EXPECT_EQ(cache.stats->hits(), 3);
+  EXPECT_EQ(cache.stats->misses(), 2);
+}
+
+TEST(RowCacheConnection, KeyedByFilter) {
+  auto mock = std::make_shared<MockDataConnection>();
+  EXPECT_CALL(*mock, ReadRow(kTableName, "r1", _))
+      .Times(2)
+      .WillRepeatedly(Return(Found("r1")));
+
+  TestCache cache(mock);
+  auto const f1 = bigtable::Filter::Latest(1);
+  auto const f2 = bigtable::Filter::Latest(2);
+  for (auto const& filter : {f1, f2, f1, f2}) {
+    EXPECT_STATUS_OK(cache.conn->ReadRow(kTableName, "r1", filter));
+  }
+  EXPECT_EQ(cache.stats->hits(), 2);
+  EXPECT_EQ(cache.stats->misses(), 2);
+}
+
+TEST(RowCacheConnection, KeyedByAppProfile) {
+  auto mock = std::make_shared<MockDataConnection>();
+  EXPECT_CALL(*mock, ReadRow(kTableName, "r1", _))
+      .Times(2)
+      .WillRepeatedly(Return(Found("r1")));
+
+  TestCache cache(mock);
+  auto const filter = bigtable::Filter::PassAllFilter();
+  for (auto const* profile : {"", "profile", "", "profile"}) {
+    internal::OptionsSpan span(
+        Options{}.set<bigtable::AppProfileIdOption>(profile));
+    EXPECT_STATUS_OK(cache.conn->ReadRow(kTableName, "r1", filter));
+  }
+  EXPECT_EQ(cache.stats->hits(), 2);
+  EXPECT_EQ(cache.stats->misses(), 2);
+
+  // Writes invalidate the row for all the app profiles.
+  EXPECT_CALL(*mock, Apply).WillOnce(Return(Status{}));
+  EXPECT_CALL(*mock, ReadRow(kTableName, "r1", _))
+      .WillOnce(Return(Found("r1")));
+  EXPECT_STATUS_OK(cache.conn->Apply(kTableName, Mutation("r1")));
+  EXPECT_EQ(cache.stats->invalidations(), 2);
+  {
+    internal::OptionsSpan span(
+        Options{}.set<bigtable::AppProfileIdOption>("profile"));
+    EXPECT_STATUS_OK(cache.conn->ReadRow(kTableName, "r1", filter));
+  }
+  EXPECT_EQ(cache.stats->misses(), 3);
+}
+
+TEST(RowCacheConnection, ErrorsAreNotCached) {
+  auto mock = std::make_shared<MockDataConnection>();
+  EXPECT_CALL(*mock, ReadRow)
+      .WillOnce(Return(internal::UnavailableError("try-again")))
+      .WillOnce(Return(Found("r1")));
+
+  TestCache cache(mock);
+  auto const filter = bigtable::Filter::PassAllFilter();
+  EXPECT_THAT(cache.conn->ReadRow(kTableName, "r1", filter),
+              StatusIs(StatusCode::kUnavailable));
+  EXPECT_STATUS_OK(cache.conn->ReadRow(kTableName, "r1", filter));
+  EXPECT_STATUS_OK(cache.conn->ReadRow(kTableName, "r1", filter));
+  EXPECT_EQ(cache.stats->hits(), 1);
+  EXPECT_EQ(cache.stats->misses(), 2);
+}
+
+TEST(RowCacheConnection, Expiration) {
+  auto mock = std::make_shared<MockDataConnection>();
+  EXPECT_CALL(*mock, ReadRow)
+      .Times(2)
+      .WillRepeatedly(Return(Found("r1")));
+
+  TestCache cache(mock);
+  auto const filter = bigtable::Filter::PassAllFilter();
+  EXPECT_STATUS_OK(cache.conn->ReadRow(kTableName, "r1", filter));
+  cache.clock->AdvanceTime(kTtl - ms(1));
+  EXPECT_STATUS_OK(cache.conn->ReadRow(kTableName, "r1", filter));
+  cache.clock->AdvanceTime(ms(1));
+  EXPECT_STATUS_OK(cache.conn->ReadRow(kTableName, "r1", filter));
+  EXPECT_EQ(cache.stats->hits(), 1);
+  EXPECT_EQ(cache.stats->misses(), 2);
+  EXPECT_EQ(cache.stats->evictions(), 1);
+}
+
+TEST(RowCacheConnection, EvictsLeastRecentlyUsed) {
+  auto mock = std::make_shared<MockDataConnection>();
+  auto const large = std::string(1000, 'x');
+  EXPECT_CALL(*mock, ReadRow)
+      .WillRepeatedly([&](std::string const&, std::string const& row_key,
+                          bigtable::Filter const&) {
+        return std::make_pair(true, MakeRow(row_key, large));
+      });
+
+  // With a single shard, there is room for two of these rows.
+  TestCache cache(mock, 3000, 1);
+  auto const filter = bigtable::Filter::PassAllFilter();
+  for (auto const* key : {"r1", "r2", "r1", "r3", "r1", "r2"}) {
+    EXPECT_STATUS_OK(cache.conn->ReadRow(kTableName, key, filter));
+  }
+  // "r3" evicts "r2", which was used less recently than "r1".
+  EXPECT_EQ(cache.stats->hits(), 2);
+  EXPECT_EQ(cache.stats->misses(), 4);
+  EXPECT_EQ(cache.stats->evictions(), 2);
+}
+
+TEST(RowCacheConnection, ApplyInvalidates) {
+  auto mock = std::make_shared<MockDataConnection>();
+  EXPECT_CALL(*mock, ReadRow)
+      .Times(3)
+      .WillRepeatedly(Return(Found("r1")));
+  EXPECT_CALL(*mock, Apply(kTableName, _))
+      .WillOnce(Return(internal::AbortedError("fail")));
+
+  TestCache cache(mock);
+  auto const f1 = bigtable::Filter::Latest(1);
+  auto const f2 = bigtable::Filter::Latest(2);
+  EXPECT_STATUS_OK(cache.conn->ReadRow(kTableName, "r1", f1));
+  EXPECT_STATUS_OK(cache.conn->ReadRow(kTableName, "r1", f2));
+  // Failed mutations may have been applied, so they invalidate too.
+  EXPECT_THAT(cache.conn->Apply(kTableName, Mutation("r1")),
+              StatusIs(StatusCode::kAborted));
+  EXPECT_EQ(cache.stats->invalidations(), 2);
+  EXPECT_STATUS_OK(cache.conn->ReadRow(kTableName, "r1", f1));
+  EXPECT_EQ(cache.stats->hits(), 0);
+  EXPECT_EQ(cache.stats->misses(), 3);
+}
+
+TEST(RowCacheConnection, InvalidatesOnlyTheModifiedRow) {
+  auto mock = std::make_shared<MockDataConnection>();
+  EXPECT_CALL(*mock, ReadRow)
+      .WillRepeatedly([](std::string const&, std::string const& row_key,
+                         bigtable::Filter const&) { return Found(row_key); });
+  EXPECT_CALL(*mock, Apply).WillOnce(Return(Status()));
+
+  TestCache cache(mock);
+  auto const filter = bigtable::Filter::PassAllFilter();
+  // "r" is a prefix of "r1", and must not invalidate it.
+  EXPECT_STATUS_OK(cache.conn->ReadRow(kTableName, "r1", filter));
+  EXPECT_STATUS_OK(cache.conn->ReadRow(kTableName, "r", filter));
+  EXPECT_STATUS_OK(cache.conn->Apply(kTableName, Mutation("r")));
+  EXPECT_STATUS_OK(cache.conn->ReadRow(kTableName, "r1", filter));
+  EXPECT_EQ(cache.stats->invalidations(), 1);
+  EXPECT_EQ(cache.stats->hits(), 1);
+}
+
+TEST(RowCacheConnection, BulkApplyInvalidates) {
+  auto mock = std::make_shared<MockDataConnection>();
+  EXPECT_CALL(*mock, ReadRow)
+      .WillRepeatedly([](std::string const&, std::string const& row_key,
+                         bigtable::Filter const&) { return Found(row_key); });
+  EXPECT_CALL(*mock, BulkApply(kTableName, _))
+      .WillOnce([](std::string const&, bigtable::BulkMutation mut) {
+        google::bigtable::v2::MutateRowsRequest request;
+        mut.MoveTo(&request);
+        std::vector<std::string> keys;
+        for (auto const& e : request.entries()) keys.push_back(e.row_key());
+        EXPECT_THAT(keys, ElementsAre("r1", "r2"));
+        return std::vector<bigtable::FailedMutation>{};
+      });
+
+  TestCache cache(mock);
+  auto const filter = bigtable::Filter::PassAllFilter();
+  for (auto const* key : {"r1", "r2", "r3"}) {
+    EXPECT_STATUS_OK(cache.conn->ReadRow(kTableName, key, filter));
+  }
+  auto failures = cache.conn->BulkApply(
+      kTableName, bigtable::BulkMutation(Mutation("r1"), Mutation("r2")));
+  EXPECT_TRUE(failures.empty());
+  EXPECT_EQ(cache.stats->invalidations(), 2);
+}
+
+TEST(RowCacheConnection, ReadModifyWriteRowInvalidates) {
+  auto mock = std::make_shared<MockDataConnection>();
+  EXPECT_CALL(*mock, ReadRow).WillOnce(Return(Found("r1")));
+  EXPECT_CALL(*mock, ReadModifyWriteRow).WillOnce(Return(MakeRow("r1")));
+
+  TestCache cache(mock);
+  auto const filter = bigtable::Filter::PassAllFilter();
+  EXPECT_STATUS_OK(cache.conn->ReadRow(kTableName, "r1", filter));
+  google::bigtable::v2::ReadModifyWriteRowRequest request;
+  request.set_table_name(kTableName);
+  request.set_row_key("r1");
+  EXPECT_STATUS_OK(cache.conn->ReadModifyWriteRow(request));
+  EXPECT_EQ(cache.stats->invalidations(), 1);
+}
+
+TEST(RowCacheConnection, AsyncReadRowHit) {
+  auto mock = std::make_shared<MockDataConnection>();
+  EXPECT_CALL(*mock, AsyncReadRow(kTableName, "r1", _))
+      .WillOnce(Return(ByMove(make_ready_future(Found("r1")))));
+
+  TestCache cache(mock);
+  auto const filter = bigtable::Filter::PassAllFilter();
+  for (int i = 0; i != 2; ++i) {
+    auto row = cache.conn->AsyncReadRow(kTableName, "r1", filter).get();
+    ASSERT_STATUS_OK(row);
+    EXPECT_TRUE(row->first);
+  }
+  EXPECT_EQ(cache.stats->hits(), 1);
+  EXPECT_EQ(cache.stats->misses(), 1);
+}
+
+TEST(RowCacheConnection, ReadRacingWithWriteIsNotCached) {
+  auto mock = std::make_shared<MockDataConnection>();
+  promise<StatusOr<std::pair<bool, bigtable::Row>>> p;
+  EXPECT_CALL(*mock, AsyncReadRow)
+      .WillOnce([&p](std::string const&, std::string const&,
+                     bigtable::Filter const&) { return p.get_future(); });
+  EXPECT_CALL(*mock, Apply).WillOnce(Return(Status()));
+  EXPECT_CALL(*mock, ReadRow).WillOnce(Return(Found("r1")));
+
+  TestCache cache(mock);
+  auto const filter = bigtable::Filter::PassAllFilter();
+  auto pending = cache.conn->AsyncReadRow(kTableName, "r1", filter);
+  EXPECT_STATUS_OK(cache.conn->Apply(kTableName, Mutation("r1")));
+  // The value read before the write completed must not be cached.
+  p.set_value(Found("r1"));
+  EXPECT_STATUS_OK(pending.get());
+  EXPECT_STATUS_OK(cache.conn->ReadRow(kTableName, "r1", filter));
+  EXPECT_EQ(cache.stats->hits(), 0);
+  EXPECT_EQ(cache.stats->misses(), 2);
+}
+
+TEST(MakeRowCacheConnection, DisabledByDefault) {
+  using ::google::cloud::bigtable::experimental::RowCacheMaxBytesOption;
+  auto mock = std::make_shared<MockDataConnection>();
+  EXPECT_EQ(MakeRowCacheConnection(mock, Options{}), mock);
+  auto options = Options{}.set<RowCacheMaxBytesOption>(1024);
+  EXPECT_NE(MakeRowCacheConnection(mock, options), mock);
+}
+
+}  // namespace
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
+}  // namespace bigtable_internal
+}  // namespace cloud
+}  // namespace google
@@ -40,11 +40,14 @@
 
 #include "google/cloud/bigtable/idempotent_mutation_policy.h"
 #include "google/cloud/bigtable/retry_policy.h"
+#include "google/cloud/bigtable/row_cache_stats.h"
 #include "google/cloud/bigtable/rpc_retry_policy.h"
 #include "google/cloud/bigtable/version.h"
 #include "google/cloud/backoff_policy.h"
 #include "google/cloud/options.h"
 #include <chrono>
+#include <cstddef>
+#include <memory>
 #include <string>
 
 namespace google {
@@ -187,6 +190,105 @@ struct BulkApplyThrottlingOption {
   using Type = bool;
 };
 
+/**
+ * If set to a positive duration, the client coalesces concurrent point reads.
+ *
+ * Calls to `Table::ReadRow()` and `Table::AsyncReadRow()` that target the same
+ * table, with the same app profile and filter, and that start within this
+ * window of the first such call, are sent as a single `ReadRows` request with
+ * a multi-key row set. The results are demultiplexed back to each caller. If
+ * the stream fails, it is retried only for the keys that have not been
+ * received yet.
+ *
+ * Coalescing trades up to one window of extra latency for fewer RPCs. It is
+ * intended for workloads that issue many small, concurrent point reads.
+ *
+ * Only calls with the same per-call options share a request. The options
+ * compared are `AppProfileIdOption`, `DataRetryPolicyOption`,
+ * `DataBackoffPolicyOption`, `google::cloud::EnableServerRetriesOption`, and
+ * the request metadata options: `google::cloud::UserProjectOption`,
+ * `google::cloud::AuthorityOption`, `google::cloud::QuotaUserOption`,
+ * `google::cloud::UserIpOption`, `google::cloud::FieldMaskOption`, and
+ * `google::cloud::CustomHeadersOption`. The policies are compared by identity,
+ * calls that use the same policy objects (for example, all the calls made
+ * with the same `Table` options) can share a request.
+ *
+ * Any other per-call options, such as `google::cloud::GrpcSetupOption` and
+ * `google::cloud::GrpcSetupPollOption`, are taken from the first call in the
+ * window, and ignored for the other calls.
+ *
+ * @note This option must be supplied to `MakeDataConnection()` in order to take
+ * effect.
+ */
+struct ReadRowCoalescingWindowOption {
+  using Type = std::chrono::microseconds;
+};
+
+/**
+ * The maximum number of distinct row keys in a coalesced `ReadRows` request.
+ *
+ * A batch is sent as soon as it reaches this many keys, without waiting for
+ * the rest of the window. The default is 100.
+ *
+ * @see #google::cloud::bigtable::experimental::ReadRowCoalescingWindowOption
+ *
+ * @note This option must be supplied to `MakeDataConnection()` in order to take
+ * effect.
+ */
+struct ReadRowCoalescingMaxKeysOption {
+  using Type = std::size_t;
+};
+
+/**
+ * If set to a positive value, the client caches the results of point reads.
+ *
+ * `Table::ReadRow()` and `Table::AsyncReadRow()` results, including rows that
+ * were not found, are cached by table, row key, and filter. Reads that hit the
+ * cache return without making an RPC. The cache holds approximately this many
+ * bytes, evicting the least recently used rows first.
+ *
+ * `Apply()`, `BulkApply()`, `CheckAndMutateRow()`, and `ReadModifyWriteRow()`
+ * calls made through the same connection invalidate the rows they modify.
+ * Writes made by other clients are only observed once the cached entry
+ * expires, see `RowCacheTtlOption`.
+ *
+ * The cache is intended for small, frequently read, and rarely modified
+ * tables, such as configuration data.
+ *
+ * @note This option must be supplied to `MakeDataConnection()` in order to take
+ * effect.
+ */
+struct RowCacheMaxBytesOption {
+  using Type = std::size_t;
+};
+
+/**
+ * How long a cached row may be served.
+ *
+ * This bounds how stale a cached row can be with respect to writes made by
+ * other clients. The default is 1 second.
+ *
+ * @see #google::cloud::bigtable::experimental::RowCacheMaxBytesOption
+ *
+ * @note This option must be supplied to `MakeDataConnection()` in order to take
+ * effect.
+ */
+struct RowCacheTtlOption {
+  using Type = std::chrono::milliseconds;
+};
+
+/**
+ * Receive the hit, miss, and eviction counters of the row cache.
+ *
+ * @see #google::cloud::bigtable::experimental::RowCacheMaxBytesOption
+ *
+ * @note This option must be supplied to `MakeDataConnection()` in order to take
+ * effect.
+ */
+struct RowCacheStatsOption {
+  using Type = std::shared_ptr<RowCacheStats>;
+};
+
 }  // namespace experimental
 
 /// The complete list of options accepted by `bigtable::*Client`
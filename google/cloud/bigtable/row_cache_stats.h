@@ -0,0 +1,78 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GOOGLE_CLOUD_CPP_GOOGLE_CLOUD_BIGTABLE_ROW_CACHE_STATS_H
+#define GOOGLE_CLOUD_CPP_GOOGLE_CLOUD_BIGTABLE_ROW_CACHE_STATS_H
+
+#include "google/cloud/bigtable/version.h"
+#include <atomic>
+#include <cstdint>
+
+namespace google {
+namespace cloud {
+namespace bigtable_internal {
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_BEGIN
+class RowCache;
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
+}  // namespace bigtable_internal
+
+namespace bigtable {
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_BEGIN
+namespace experimental {
+
+/**
+ * Counters for the client-side row cache.
+ *
+ * Supply an instance with `RowCacheStatsOption` and read the counters at any
+ * time. The counters are updated concurrently by the cache, each read returns
+ * a recent value.
+ *
+ * @see #google::cloud::bigtable::experimental::RowCacheMaxBytesOption
+ */
+class RowCacheStats {
+ public:
+  /// The number of `ReadRow()` calls served from the cache.
+  std::int64_t hits() const { return hits_.load(std::memory_order_relaxed); }
+
+  /// The number of `ReadRow()` calls sent to the service.
+  std::int64_t misses() const {
+    return misses_.load(std::memory_order_relaxed);
+  }
+
+  /// The number of entries removed because they expired or to stay in budget.
+  std::int64_t evictions() const {
+    return evictions_.load(std::memory_order_relaxed);
+  }
+
+  /// The number of entries removed because the row was modified.
+  std::int64_t invalidations() const {
+    return invalidations_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  friend class bigtable_internal::RowCache;
+
+  std::atomic<std::int64_t> hits_{0};
+  std::atomic<std::int64_t> misses_{0};
+  std::atomic<std::int64_t> evictions_{0};
+  std::atomic<std::int64_t> invalidations_{0};
+};
+
+}  // namespace experimental
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
+}  // namespace bigtable
+}  // namespace cloud
+}  // namespace google
+
+#endif  // GOOGLE_CLOUD_CPP_GOOGLE_CLOUD_BIGTABLE_ROW_CACHE_STATS_H
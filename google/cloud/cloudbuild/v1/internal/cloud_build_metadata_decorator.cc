@@ -62,8 +62,7 @@ CloudBuildMetadata::AsyncCreateBuild(
         {
             {[](google::devtools::cloudbuild::v1::CreateBuildRequest const&
                     request) -> std::string const& { return request.parent(); },
-             std::regex{"projects/[^/]+/locations/([^/]+)",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate("projects/*/locations/{*}")},
         }};
   }();
   location_matcher->AppendParam(request, params);
@@ -90,8 +89,7 @@ StatusOr<google::longrunning::Operation> CloudBuildMetadata::CreateBuild(
         {
             {[](google::devtools::cloudbuild::v1::CreateBuildRequest const&
                     request) -> std::string const& { return request.parent(); },
-             std::regex{"projects/[^/]+/locations/([^/]+)",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate("projects/*/locations/{*}")},
         }};
   }();
   location_matcher->AppendParam(request, params);
@@ -117,8 +115,8 @@ StatusOr<google::devtools::cloudbuild::v1::Build> CloudBuildMetadata::GetBuild(
         {
             {[](google::devtools::cloudbuild::v1::GetBuildRequest const&
                     request) -> std::string const& { return request.name(); },
-             std::regex{"projects/[^/]+/locations/([^/]+)/builds/[^/]+",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate(
+                 "projects/*/locations/{*}/builds/*")},
         }};
   }();
   location_matcher->AppendParam(request, params);
@@ -145,8 +143,7 @@ CloudBuildMetadata::ListBuilds(
         {
             {[](google::devtools::cloudbuild::v1::ListBuildsRequest const&
                     request) -> std::string const& { return request.parent(); },
-             std::regex{"projects/[^/]+/locations/([^/]+)",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate("projects/*/locations/{*}")},
         }};
   }();
   location_matcher->AppendParam(request, params);
@@ -173,8 +170,8 @@ CloudBuildMetadata::CancelBuild(
         {
             {[](google::devtools::cloudbuild::v1::CancelBuildRequest const&
                     request) -> std::string const& { return request.name(); },
-             std::regex{"projects/[^/]+/locations/([^/]+)/builds/[^/]+",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate(
+                 "projects/*/locations/{*}/builds/*")},
         }};
   }();
   location_matcher->AppendParam(request, params);
@@ -203,8 +200,8 @@ CloudBuildMetadata::AsyncRetryBuild(
         {
             {[](google::devtools::cloudbuild::v1::RetryBuildRequest const&
                     request) -> std::string const& { return request.name(); },
-             std::regex{"projects/[^/]+/locations/([^/]+)/builds/[^/]+",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate(
+                 "projects/*/locations/{*}/builds/*")},
         }};
   }();
   location_matcher->AppendParam(request, params);
@@ -231,8 +228,8 @@ StatusOr<google::longrunning::Operation> CloudBuildMetadata::RetryBuild(
         {
             {[](google::devtools::cloudbuild::v1::RetryBuildRequest const&
                     request) -> std::string const& { return request.name(); },
-             std::regex{"projects/[^/]+/locations/([^/]+)/builds/[^/]+",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate(
+                 "projects/*/locations/{*}/builds/*")},
         }};
   }();
   location_matcher->AppendParam(request, params);
@@ -261,8 +258,8 @@ CloudBuildMetadata::AsyncApproveBuild(
         {
             {[](google::devtools::cloudbuild::v1::ApproveBuildRequest const&
                     request) -> std::string const& { return request.name(); },
-             std::regex{"projects/[^/]+/locations/([^/]+)/builds/[^/]+",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate(
+                 "projects/*/locations/{*}/builds/*")},
         }};
   }();
   location_matcher->AppendParam(request, params);
@@ -289,8 +286,8 @@ StatusOr<google::longrunning::Operation> CloudBuildMetadata::ApproveBuild(
         {
             {[](google::devtools::cloudbuild::v1::ApproveBuildRequest const&
                     request) -> std::string const& { return request.name(); },
-             std::regex{"projects/[^/]+/locations/([^/]+)/builds/[^/]+",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate(
+                 "projects/*/locations/{*}/builds/*")},
         }};
   }();
   location_matcher->AppendParam(request, params);
@@ -319,8 +316,7 @@ CloudBuildMetadata::CreateBuildTrigger(
             {[](google::devtools::cloudbuild::v1::
                     CreateBuildTriggerRequest const& request)
                  -> std::string const& { return request.parent(); },
-             std::regex{"projects/[^/]+/locations/([^/]+)",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate("projects/*/locations/{*}")},
         }};
   }();
   location_matcher->AppendParam(request, params);
@@ -347,8 +343,8 @@ CloudBuildMetadata::GetBuildTrigger(
         {
             {[](google::devtools::cloudbuild::v1::GetBuildTriggerRequest const&
                     request) -> std::string const& { return request.name(); },
-             std::regex{"projects/[^/]+/locations/([^/]+)/triggers/[^/]+",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate(
+                 "projects/*/locations/{*}/triggers/*")},
         }};
   }();
   location_matcher->AppendParam(request, params);
@@ -376,8 +372,7 @@ CloudBuildMetadata::ListBuildTriggers(
             {[](google::devtools::cloudbuild::v1::
                     ListBuildTriggersRequest const& request)
                  -> std::string const& { return request.parent(); },
-             std::regex{"projects/[^/]+/locations/([^/]+)",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate("projects/*/locations/{*}")},
         }};
   }();
   location_matcher->AppendParam(request, params);
@@ -405,8 +400,8 @@ Status CloudBuildMetadata::DeleteBuildTrigger(
             {[](google::devtools::cloudbuild::v1::
                     DeleteBuildTriggerRequest const& request)
                  -> std::string const& { return request.name(); },
-             std::regex{"projects/[^/]+/locations/([^/]+)/triggers/[^/]+",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate(
+                 "projects/*/locations/{*}/triggers/*")},
         }};
   }();
   location_matcher->AppendParam(request, params);
@@ -437,8 +432,8 @@ CloudBuildMetadata::UpdateBuildTrigger(
                  -> std::string const& {
                return request.trigger().resource_name();
              },
-             std::regex{"projects/[^/]+/locations/([^/]+)/triggers/[^/]+",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate(
+                 "projects/*/locations/{*}/triggers/*")},
         }};
   }();
   location_matcher->AppendParam(request, params);
@@ -467,8 +462,8 @@ CloudBuildMetadata::AsyncRunBuildTrigger(
         {
             {[](google::devtools::cloudbuild::v1::RunBuildTriggerRequest const&
                     request) -> std::string const& { return request.name(); },
-             std::regex{"projects/[^/]+/locations/([^/]+)/triggers/[^/]+",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate(
+                 "projects/*/locations/{*}/triggers/*")},
         }};
   }();
   location_matcher->AppendParam(request, params);
@@ -495,8 +490,8 @@ StatusOr<google::longrunning::Operation> CloudBuildMetadata::RunBuildTrigger(
         {
             {[](google::devtools::cloudbuild::v1::RunBuildTriggerRequest const&
                     request) -> std::string const& { return request.name(); },
-             std::regex{"projects/[^/]+/locations/([^/]+)/triggers/[^/]+",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate(
+                 "projects/*/locations/{*}/triggers/*")},
         }};
   }();
   location_matcher->AppendParam(request, params);
@@ -537,8 +532,7 @@ CloudBuildMetadata::AsyncCreateWorkerPool(
         {
             {[](google::devtools::cloudbuild::v1::CreateWorkerPoolRequest const&
                     request) -> std::string const& { return request.parent(); },
-             std::regex{"projects/[^/]+/locations/([^/]+)",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate("projects/*/locations/{*}")},
         }};
   }();
   location_matcher->AppendParam(request, params);
@@ -565,8 +559,7 @@ StatusOr<google::longrunning::Operation> CloudBuildMetadata::CreateWorkerPool(
         {
             {[](google::devtools::cloudbuild::v1::CreateWorkerPoolRequest const&
                     request) -> std::string const& { return request.parent(); },
-             std::regex{"projects/[^/]+/locations/([^/]+)",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate("projects/*/locations/{*}")},
         }};
   }();
   location_matcher->AppendParam(request, params);
@@ -593,8 +586,8 @@ CloudBuildMetadata::GetWorkerPool(
         {
             {[](google::devtools::cloudbuild::v1::GetWorkerPoolRequest const&
                     request) -> std::string const& { return request.name(); },
-             std::regex{"projects/[^/]+/locations/([^/]+)/workerPools/[^/]+",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate(
+                 "projects/*/locations/{*}/workerPools/*")},
         }};
   }();
   location_matcher->AppendParam(request, params);
@@ -623,8 +616,8 @@ CloudBuildMetadata::AsyncDeleteWorkerPool(
         {
             {[](google::devtools::cloudbuild::v1::DeleteWorkerPoolRequest const&
                     request) -> std::string const& { return request.name(); },
-             std::regex{"projects/[^/]+/locations/([^/]+)/workerPools/[^/]+",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate(
+                 "projects/*/locations/{*}/workerPools/*")},
         }};
   }();
   location_matcher->AppendParam(request, params);
@@ -651,8 +644,8 @@ StatusOr<google::longrunning::Operation> CloudBuildMetadata::DeleteWorkerPool(
         {
             {[](google::devtools::cloudbuild::v1::DeleteWorkerPoolRequest const&
                     request) -> std::string const& { return request.name(); },
-             std::regex{"projects/[^/]+/locations/([^/]+)/workerPools/[^/]+",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate(
+                 "projects/*/locations/{*}/workerPools/*")},
         }};
   }();
   location_matcher->AppendParam(request, params);
@@ -683,8 +676,8 @@ CloudBuildMetadata::AsyncUpdateWorkerPool(
                     request) -> std::string const& {
                return request.worker_pool().name();
              },
-             std::regex{"projects/[^/]+/locations/([^/]+)/workerPools/[^/]+",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate(
+                 "projects/*/locations/{*}/workerPools/*")},
         }};
   }();
   location_matcher->AppendParam(request, params);
@@ -713,8 +706,8 @@ StatusOr<google::longrunning::Operation> CloudBuildMetadata::UpdateWorkerPool(
                     request) -> std::string const& {
                return request.worker_pool().name();
              },
-             std::regex{"projects/[^/]+/locations/([^/]+)/workerPools/[^/]+",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate(
+                 "projects/*/locations/{*}/workerPools/*")},
         }};
   }();
   location_matcher->AppendParam(request, params);
@@ -741,8 +734,7 @@ CloudBuildMetadata::ListWorkerPools(
         {
             {[](google::devtools::cloudbuild::v1::ListWorkerPoolsRequest const&
                     request) -> std::string const& { return request.parent(); },
-             std::regex{"projects/[^/]+/locations/([^/]+)",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate("projects/*/locations/{*}")},
         }};
   }();
   location_matcher->AppendParam(request, params);
@@ -18,6 +18,7 @@
 #include "google/cloud/internal/attributes.h"
 #include "google/cloud/options.h"
 #include "google/cloud/version.h"
+#include <cstddef>
 #include <set>
 #include <string>
 #include <unordered_map>
@@ -291,12 +292,31 @@ struct FieldMaskOption {
   using Type = std::string;
 };
 
+/**
+ * Prefetch pages in `List*()` operations.
+ *
+ * Functions returning a `StreamRange<T>` over a paginated API fetch each page
+ * when the application has consumed the previous one. With this option set to
+ * a value larger than 0, the library fetches pages in a background thread,
+ * while the application consumes the current page. The value is the maximum
+ * number of pages buffered ahead of the application, and bounds the memory
+ * used by the prefetched pages.
+ *
+ * The default is 0, where pages are only fetched on demand.
+ *
+ * @ingroup options
+ */
+struct PagePrefetchDepthOption {
+  using Type = std::size_t;
+};
+
 /**
  * A list of all the common options.
  */
 using CommonOptionList =
     OptionList<EndpointOption, UserAgentProductsOption, LoggingComponentsOption,
-               UserProjectOption, AuthorityOption, CustomHeadersOption>;
+               UserProjectOption, AuthorityOption, CustomHeadersOption,
+               PagePrefetchDepthOption>;
 
 /**
  * Enable logging for a set of components.
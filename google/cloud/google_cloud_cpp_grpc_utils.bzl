@@ -22,6 +22,7 @@ google_cloud_cpp_grpc_utils_hdrs = [
     "background_threads.h",
     "completion_queue.h",
     "connection_options.h",
+    "grpc_channel_warmup.h",
     "grpc_error_delegate.h",
     "grpc_options.h",
     "grpc_utils/async_operation.h",
@@ -89,6 +90,7 @@ google_cloud_cpp_grpc_utils_hdrs = [
 google_cloud_cpp_grpc_utils_srcs = [
     "completion_queue.cc",
     "connection_options.cc",
+    "grpc_channel_warmup.cc",
     "grpc_error_delegate.cc",
     "grpc_options.cc",
     "internal/async_connection_ready.cc",
@@ -109,6 +111,7 @@ google_cloud_cpp_grpc_utils_srcs = [
     "internal/log_wrapper.cc",
     "internal/minimal_iam_credentials_stub.cc",
     "internal/populate_grpc_options.cc",
+    "internal/routing_matcher.cc",
     "internal/streaming_read_rpc.cc",
     "internal/streaming_write_rpc_impl.cc",
     "internal/time_utils.cc",
@@ -24,6 +24,8 @@ add_library(
     completion_queue.h
     connection_options.cc
     connection_options.h
+    grpc_channel_warmup.cc
+    grpc_channel_warmup.h
     grpc_error_delegate.cc
     grpc_error_delegate.h
     grpc_options.cc
@@ -95,6 +97,7 @@ add_library(
     internal/populate_grpc_options.h
     internal/resumable_streaming_read_rpc.h
     internal/retry_loop.h
+    internal/routing_matcher.cc
     internal/routing_matcher.h
     internal/setup_context.h
     internal/streaming_read_rpc.cc
@@ -231,6 +234,7 @@ if (BUILD_TESTING)
         # cmake-format: sort
         completion_queue_test.cc
         connection_options_test.cc
+        grpc_channel_warmup_test.cc
         grpc_error_delegate_test.cc
         grpc_options_test.cc
         internal/async_connection_ready_test.cc
@@ -329,7 +333,7 @@ if (BUILD_TESTING)
     endforeach ()
 
     set(google_cloud_cpp_grpc_utils_benchmarks # cmake-format: sortable
-                                               completion_queue_benchmark.cc)
+        completion_queue_benchmark.cc internal/routing_matcher_benchmark.cc)
 
     # Export the list of benchmarks to a .bzl file so we do not need to maintain
     # the list in two places.
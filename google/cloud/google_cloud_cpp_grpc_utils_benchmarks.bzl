@@ -18,4 +18,5 @@
 
 google_cloud_cpp_grpc_utils_benchmarks = [
     "completion_queue_benchmark.cc",
+    "internal/routing_matcher_benchmark.cc",
 ]
@@ -19,6 +19,7 @@
 google_cloud_cpp_grpc_utils_unit_tests = [
     "completion_queue_test.cc",
     "connection_options_test.cc",
+    "grpc_channel_warmup_test.cc",
     "grpc_error_delegate_test.cc",
     "grpc_options_test.cc",
     "internal/async_connection_ready_test.cc",
@@ -25,6 +25,7 @@ google_cloud_cpp_rest_protobuf_internal_hdrs = [
     "internal/async_rest_retry_loop.h",
     "internal/rest_background_threads_impl.h",
     "internal/rest_completion_queue_impl.h",
+    "internal/rest_json_transcoder.h",
     "internal/rest_stub_helpers.h",
 ]
 
@@ -32,5 +33,6 @@ google_cloud_cpp_rest_protobuf_internal_srcs = [
     "internal/async_rest_polling_loop.cc",
     "internal/rest_background_threads_impl.cc",
     "internal/rest_completion_queue_impl.cc",
+    "internal/rest_json_transcoder.cc",
     "internal/rest_stub_helpers.cc",
 ]
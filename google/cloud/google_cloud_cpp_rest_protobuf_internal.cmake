@@ -28,6 +28,8 @@ add_library(
     internal/rest_background_threads_impl.h
     internal/rest_completion_queue_impl.cc
     internal/rest_completion_queue_impl.h
+    internal/rest_json_transcoder.cc
+    internal/rest_json_transcoder.h
     internal/rest_stub_helpers.cc
     internal/rest_stub_helpers.h)
 target_link_libraries(
@@ -126,6 +128,7 @@ if (BUILD_TESTING)
         internal/async_rest_retry_loop_test.cc
         internal/rest_background_threads_impl_test.cc
         internal/rest_completion_queue_impl_test.cc
+        internal/rest_json_transcoder_test.cc
         internal/rest_log_wrapper_test.cc
         internal/rest_stub_helpers_test.cc)
 
@@ -137,4 +140,25 @@ if (BUILD_TESTING)
     foreach (fname ${google_cloud_cpp_rest_protobuf_internal_unit_tests})
         google_cloud_cpp_rest_protobuf_internal_add_test("${fname}" "")
     endforeach ()
+
+    set(google_cloud_cpp_rest_protobuf_internal_benchmarks
+        # cmake-format: sortable
+        internal/rest_json_transcoder_benchmark.cc)
+
+    # Export the list of benchmarks to a .bzl file so we do not need to maintain
+    # the list in two places.
+    export_list_to_bazel(
+        "google_cloud_cpp_rest_protobuf_internal_benchmarks.bzl"
+        "google_cloud_cpp_rest_protobuf_internal_benchmarks" YEAR "2025")
+
+    # Generate a target for each benchmark.
+    foreach (fname ${google_cloud_cpp_rest_protobuf_internal_benchmarks})
+        google_cloud_cpp_add_executable(target "common" "${fname}")
+        add_test(NAME ${target} COMMAND ${target})
+        target_link_libraries(
+            ${target}
+            PRIVATE google-cloud-cpp::rest_protobuf_internal
+                    google-cloud-cpp::common benchmark::benchmark_main)
+        google_cloud_cpp_add_common_options(${target})
+    endforeach ()
 endif ()
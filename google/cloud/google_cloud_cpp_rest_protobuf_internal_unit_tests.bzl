@@ -24,6 +24,7 @@ google_cloud_cpp_rest_protobuf_internal_unit_tests = [
     "internal/async_rest_retry_loop_test.cc",
     "internal/rest_background_threads_impl_test.cc",
     "internal/rest_completion_queue_impl_test.cc",
+    "internal/rest_json_transcoder_test.cc",
     "internal/rest_log_wrapper_test.cc",
     "internal/rest_stub_helpers_test.cc",
 ]
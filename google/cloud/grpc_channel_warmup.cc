@@ -0,0 +1,86 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/grpc_channel_warmup.h"
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace google {
+namespace cloud {
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_BEGIN
+namespace experimental {
+
+class GrpcChannelWarmup::State {
+ public:
+  std::size_t channel_count() const {
+    std::lock_guard<std::mutex> lk(mu_);
+    return channel_count_;
+  }
+
+  void OnAdd() {
+    std::lock_guard<std::mutex> lk(mu_);
+    ++channel_count_;
+    ++pending_;
+  }
+
+  void OnDone(Status status) {
+    std::unique_lock<std::mutex> lk(mu_);
+    if (!status.ok() && status_.ok()) status_ = std::move(status);
+    if (--pending_ != 0) return;
+    auto waiters = std::move(waiters_);
+    waiters_.clear();
+    auto s = status_;
+    lk.unlock();
+    for (auto& p : waiters) p.set_value(s);
+  }
+
+  future<Status> Ready() {
+    std::lock_guard<std::mutex> lk(mu_);
+    if (pending_ == 0) return make_ready_future(status_);
+    waiters_.emplace_back();
+    return waiters_.back().get_future();
+  }
+
+ private:
+  mutable std::mutex mu_;
+  std::size_t channel_count_ = 0;
+  std::size_t pending_ = 0;
+  Status status_;
+  std::vector<promise<Status>> waiters_;
+};
+
+GrpcChannelWarmup::GrpcChannelWarmup(std::chrono::milliseconds timeout)
+    : timeout_(timeout), state_(std::make_shared<State>()) {}
+
+std::size_t GrpcChannelWarmup::channel_count() const {
+  return state_->channel_count();
+}
+
+future<Status> GrpcChannelWarmup::Ready() { return state_->Ready(); }
+
+void GrpcChannelWarmup::AddChannel(CompletionQueue& cq,
+                                   std::shared_ptr<grpc::Channel> channel) {
+  state_->OnAdd();
+  // `AsyncWaitConnectionReady()` calls `GetState(true)`, which starts
+  // connecting the channel without blocking.
+  cq.AsyncWaitConnectionReady(std::move(channel),
+                              std::chrono::system_clock::now() + timeout_)
+      .then([state = state_](future<Status> f) { state->OnDone(f.get()); });
+}
+
+}  // namespace experimental
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
+}  // namespace cloud
+}  // namespace google
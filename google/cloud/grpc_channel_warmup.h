@@ -0,0 +1,117 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GOOGLE_CLOUD_CPP_GOOGLE_CLOUD_GRPC_CHANNEL_WARMUP_H
+#define GOOGLE_CLOUD_CPP_GOOGLE_CLOUD_GRPC_CHANNEL_WARMUP_H
+
+#include "google/cloud/completion_queue.h"
+#include "google/cloud/future.h"
+#include "google/cloud/status.h"
+#include "google/cloud/version.h"
+#include <grpcpp/grpcpp.h>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+
+namespace google {
+namespace cloud {
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_BEGIN
+namespace experimental {
+
+/**
+ * Connects gRPC channels as soon as they are created.
+ *
+ * By default, gRPC channels connect lazily. The first RPC on each channel pays
+ * for the DNS lookup, the TCP and TLS handshakes, and the HTTP/2 setup.
+ * Applications sensitive to the latency of their first requests can provide
+ * an instance of this class, via `GrpcChannelWarmupOption`, to the
+ * `Make*Connection()` functions. The library then starts connecting each
+ * channel as soon as it is created. All the channels connect in parallel.
+ *
+ * The application can wait, with a bound set by the timeout, until all the
+ * channels are ready.
+ *
+ * @par Example
+ * @code
+ * namespace gc = ::google::cloud;
+ * auto warmup = std::make_shared<gc::experimental::GrpcChannelWarmup>(
+ *     std::chrono::seconds(5));
+ * auto connection = gc::pubsub::MakePublisherConnection(
+ *     gc::pubsub::Topic("my-project", "my-topic"),
+ *     gc::Options{}.set<gc::experimental::GrpcChannelWarmupOption>(warmup));
+ * // Block until all the channels are connected, or 5 seconds pass.
+ * auto status = warmup->Wait();
+ * @endcode
+ *
+ * @note A single object may be shared by several connections. `Ready()` and
+ *     `Wait()` consider all the channels created so far.
+ */
+class GrpcChannelWarmup {
+ public:
+  /**
+   * Creates a new warm up object.
+   *
+   * @param timeout how long to wait for each channel to become ready. Channels
+   *     that are not ready after this timeout are reported as failures. They
+   *     keep connecting in the background.
+   */
+  explicit GrpcChannelWarmup(
+      std::chrono::milliseconds timeout = std::chrono::seconds(10));
+
+  /// The number of channels created so far.
+  std::size_t channel_count() const;
+
+  /**
+   * Returns a future satisfied when all the channels created so far are ready.
+   *
+   * The future is satisfied with an error if any channel fails to connect
+   * before its timeout. The error is the first failure observed.
+   */
+  future<Status> Ready();
+
+  /// Blocks until all the channels created so far are ready, or fail.
+  Status Wait() { return Ready().get(); }
+
+  /**
+   * Starts connecting @p channel and tracks its state.
+   *
+   * The client libraries call this function when they create a new channel,
+   * applications should have no need to call it.
+   */
+  void AddChannel(CompletionQueue& cq, std::shared_ptr<grpc::Channel> channel);
+
+ private:
+  class State;
+
+  std::chrono::milliseconds timeout_;
+  std::shared_ptr<State> state_;
+};
+
+/**
+ * Connect the gRPC channels when the connection is created.
+ *
+ * @see `GrpcChannelWarmup` for more details.
+ *
+ * @ingroup options
+ */
+struct GrpcChannelWarmupOption {
+  using Type = std::shared_ptr<GrpcChannelWarmup>;
+};
+
+}  // namespace experimental
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
+}  // namespace cloud
+}  // namespace google
+
+#endif  // GOOGLE_CLOUD_CPP_GOOGLE_CLOUD_GRPC_CHANNEL_WARMUP_H
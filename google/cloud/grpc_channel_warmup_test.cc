@@ -0,0 +1,110 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/grpc_channel_warmup.h"
+#include "google/cloud/testing_util/status_matchers.h"
+#include <gmock/gmock.h>
+#include <grpcpp/generic/async_generic_service.h>
+#include <thread>
+
+namespace google {
+namespace cloud {
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_BEGIN
+namespace experimental {
+namespace {
+
+using ::google::cloud::testing_util::StatusIs;
+
+TEST(GrpcChannelWarmupTest, NoChannels) {
+  GrpcChannelWarmup tested;
+  EXPECT_EQ(tested.channel_count(), 0);
+  auto ready = tested.Ready();
+  ASSERT_TRUE(ready.is_ready());
+  EXPECT_STATUS_OK(ready.get());
+  EXPECT_STATUS_OK(tested.Wait());
+}
+
+TEST(GrpcChannelWarmupTest, FailingChannels) {
+  CompletionQueue cq;
+  std::thread t([&cq] { cq.Run(); });
+
+  GrpcChannelWarmup tested(std::chrono::milliseconds(500));
+  auto ready = tested.Ready();
+  for (int i = 0; i != 3; ++i) {
+    grpc::ChannelArguments arguments;
+    arguments.SetInt("test-channel-id", i);
+    tested.AddChannel(cq, grpc::CreateCustomChannel(
+                              "some_nonexistent.address",
+                              grpc::InsecureChannelCredentials(), arguments));
+  }
+  EXPECT_EQ(tested.channel_count(), 3);
+  // The future returned before any channels were added is already satisfied.
+  EXPECT_STATUS_OK(ready.get());
+  EXPECT_THAT(tested.Wait(), StatusIs(StatusCode::kDeadlineExceeded));
+
+  cq.Shutdown();
+  t.join();
+}
+
+TEST(GrpcChannelWarmupTest, SuccessfulChannels) {
+  grpc::ServerBuilder builder;
+  grpc::AsyncGenericService generic_service;
+  builder.RegisterAsyncGenericService(&generic_service);
+  int selected_port;
+  builder.AddListeningPort("localhost:0", grpc::InsecureServerCredentials(),
+                           &selected_port);
+  auto srv_cq = builder.AddCompletionQueue();
+  std::thread srv_thread([&] {
+    bool ok;
+    void* placeholder;
+    while (srv_cq->Next(&placeholder, &ok)) continue;
+  });
+  auto server = builder.BuildAndStart();
+
+  CompletionQueue cli_cq;
+  std::thread cli_thread([&cli_cq] { cli_cq.Run(); });
+
+  // Use generous deadlines to avoid flakes under load.
+  GrpcChannelWarmup tested(std::chrono::seconds(30));
+  auto const endpoint = "localhost:" + std::to_string(selected_port);
+  std::vector<std::shared_ptr<grpc::Channel>> channels;
+  for (int i = 0; i != 3; ++i) {
+    // Use different channel arguments so each channel gets a separate socket.
+    grpc::ChannelArguments arguments;
+    arguments.SetInt("test-channel-id", i);
+    arguments.SetInt(GRPC_ARG_USE_LOCAL_SUBCHANNEL_POOL, 1);
+    channels.push_back(grpc::CreateCustomChannel(
+        endpoint, grpc::InsecureChannelCredentials(), arguments));
+    EXPECT_EQ(GRPC_CHANNEL_IDLE, channels.back()->GetState(false));
+    tested.AddChannel(cli_cq, channels.back());
+  }
+  EXPECT_EQ(tested.channel_count(), 3);
+  EXPECT_STATUS_OK(tested.Wait());
+  for (auto const& c : channels) {
+    EXPECT_EQ(GRPC_CHANNEL_READY, c->GetState(false));
+  }
+
+  server->Shutdown();
+  srv_cq->Shutdown();
+  srv_thread.join();
+
+  cli_cq.Shutdown();
+  cli_thread.join();
+}
+
+}  // namespace
+}  // namespace experimental
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
+}  // namespace cloud
+}  // namespace google
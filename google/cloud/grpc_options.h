@@ -18,6 +18,7 @@
 #include "google/cloud/background_threads.h"
 #include "google/cloud/common_options.h"
 #include "google/cloud/completion_queue.h"
+#include "google/cloud/grpc_channel_warmup.h"
 #include "google/cloud/options.h"
 #include "google/cloud/tracing_options.h"
 #include "google/cloud/version.h"
@@ -189,7 +190,8 @@ using GrpcOptionList =
                GrpcNumChannelsOption, GrpcChannelArgumentsOption,
                GrpcChannelArgumentsNativeOption, GrpcTracingOptionsOption,
                GrpcBackgroundThreadPoolSizeOption, GrpcCompletionQueueOption,
-               GrpcBackgroundThreadsFactoryOption>;
+               GrpcBackgroundThreadsFactoryOption,
+               experimental::GrpcChannelWarmupOption>;
 
 namespace internal {
 
@@ -15,6 +15,7 @@
 #include "google/cloud/internal/base64_transforms.h"
 #include "google/cloud/internal/absl_str_cat_quiet.h"
 #include "google/cloud/internal/make_status.h"
+#include <cstring>
 #include <limits>
 
 namespace google {
@@ -59,6 +60,48 @@ constexpr std::array<unsigned char, 256> kCharToIndexExcessOne = {{
     38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52,
 }};
 
+// Encode 12 bits at a time. The extra table costs 8KiB, but halves the number
+// of lookups (and stores) in `Base64Encode()`.
+struct CharPairTable {
+  char pairs[64 * 64][2];
+};
+
+constexpr CharPairTable MakeCharPairTable() {
+  CharPairTable t{};
+  for (std::size_t i = 0; i != 64 * 64; ++i) {
+    t.pairs[i][0] = kIndexToChar[i >> 6];
+    t.pairs[i][1] = kIndexToChar[i & 0x3f];
+  }
+  return t;
+}
+
+constexpr CharPairTable kIndexToCharPair = MakeCharPairTable();
+
+// Decode 4 characters with 4 lookups and no branches. Each table maps a
+// character to its 6 bits, already shifted into place, or to `kInvalidChar`.
+// Or-ing the 4 values yields the 24 decoded bits, with `kInvalidChar` set if
+// any of the characters is outside the base64 alphabet.
+constexpr std::uint32_t kInvalidChar = 0x80000000;
+
+struct DecodeTable {
+  std::uint32_t values[256];
+};
+
+constexpr DecodeTable MakeDecodeTable(int shift) {
+  DecodeTable t{};
+  for (std::size_t i = 0; i != 256; ++i) {
+    auto const index = kCharToIndexExcessOne[i];
+    t.values[i] = index == 0 ? kInvalidChar
+                             : static_cast<std::uint32_t>(index - 1) << shift;
+  }
+  return t;
+}
+
+constexpr DecodeTable kDecode0 = MakeDecodeTable(18);
+constexpr DecodeTable kDecode1 = MakeDecodeTable(12);
+constexpr DecodeTable kDecode2 = MakeDecodeTable(6);
+constexpr DecodeTable kDecode3 = MakeDecodeTable(0);
+
 /**
  * Decode up to 3 octets from 4 base64-encoded characters.
  *
@@ -95,9 +138,7 @@ inline bool Base64Fill(unsigned char p0, unsigned char p1, unsigned char p2,
   return true;
 }
 
-Status Base64DecodingError(std::string const& input,
-                           std::string::const_iterator p) {
-  auto const offset = std::distance(input.begin(), p);
+Status Base64DecodingError(absl::string_view input, std::size_t offset) {
   auto const bad_chunk = input.substr(offset, 4);
   return internal::InvalidArgumentError(
       absl::StrCat("Invalid base64 chunk \"", bad_chunk, "\" at offset ",
@@ -105,6 +146,44 @@ Status Base64DecodingError(std::string const& input,
       GCP_ERROR_INFO());
 }
 
+Status Base64DecodingError(std::string const& input,
+                           std::string::const_iterator p) {
+  return Base64DecodingError(
+      input, static_cast<std::size_t>(std::distance(input.begin(), p)));
+}
+
+/**
+ * Decode @p input into @p out, returning the number of decoded octets.
+ *
+ * The caller must provide room for `input.size() / 4 * 3` octets in @p out.
+ * All the chunks, except the last one, must be free of padding, so they are
+ * decoded using the branch-free tables.
+ */
+StatusOr<std::size_t> Base64DecodeBulk(absl::string_view input,
+                                       unsigned char* out) {
+  auto const size = input.size();
+  auto const remainder = size % 4;
+  auto const bulk = remainder == 0 && size != 0 ? size - 4 : size - remainder;
+  auto const* in = reinterpret_cast<unsigned char const*>(input.data());
+  auto* const start = out;
+  std::size_t offset = 0;
+  for (; offset != bulk; offset += 4, in += 4, out += 3) {
+    auto const v = kDecode0.values[in[0]] | kDecode1.values[in[1]] |
+                   kDecode2.values[in[2]] | kDecode3.values[in[3]];
+    if ((v & kInvalidChar) != 0) return Base64DecodingError(input, offset);
+    out[0] = static_cast<unsigned char>(v >> 16);
+    out[1] = static_cast<unsigned char>(v >> 8);
+    out[2] = static_cast<unsigned char>(v);
+  }
+  if (offset == size) return static_cast<std::size_t>(out - start);
+  if (size - offset != 4) return Base64DecodingError(input, offset);
+  auto sink = [&out](unsigned char c) { *out++ = c; };
+  if (!Base64Fill(in[0], in[1], in[2], in[3], sink)) {
+    return Base64DecodingError(input, offset);
+  }
+  return static_cast<std::size_t>(out - start);
+}
+
 template <typename Sink>
 Status Base64DecodeGeneric(std::string const& input, Sink const& sink) {
   auto p = input.begin();
@@ -181,10 +260,43 @@ Status ValidateBase64String(std::string const& input) {
 
 StatusOr<std::vector<std::uint8_t>> Base64DecodeToBytes(
     std::string const& input) {
-  std::vector<std::uint8_t> result;
-  auto status = Base64DecodeGeneric(
-      input, [&result](unsigned char c) { result.push_back(c); });
-  if (!status.ok()) return status;
+  std::vector<std::uint8_t> result(input.size() / 4 * 3);
+  auto size = Base64DecodeBulk(input, result.data());
+  if (!size) return std::move(size).status();
+  result.resize(*size);
+  return result;
+}
+
+std::string Base64Encode(absl::string_view bytes) {
+  std::string result((bytes.size() + 2) / 3 * 4, kPadding);
+  auto const* in = reinterpret_cast<unsigned char const*>(bytes.data());
+  auto* out = &result[0];
+  auto n = bytes.size();
+  for (; n >= 3; n -= 3, in += 3, out += 4) {
+    auto const v = static_cast<std::uint32_t>(in[0]) << 16 |
+                   static_cast<std::uint32_t>(in[1]) << 8 | in[2];
+    std::memcpy(out, kIndexToCharPair.pairs[v >> 12], 2);
+    std::memcpy(out + 2, kIndexToCharPair.pairs[v & 0xfff], 2);
+  }
+  // The output is already padded, only the leftover characters remain.
+  if (n == 2) {
+    auto const v = static_cast<std::uint32_t>(in[0]) << 16 |
+                   static_cast<std::uint32_t>(in[1]) << 8;
+    std::memcpy(out, kIndexToCharPair.pairs[v >> 12], 2);
+    out[2] = kIndexToChar[v >> 6 & 0x3f];
+  } else if (n == 1) {
+    auto const v = static_cast<std::uint32_t>(in[0]) << 16;
+    std::memcpy(out, kIndexToCharPair.pairs[v >> 12], 2);
+  }
+  return result;
+}
+
+StatusOr<std::string> Base64Decode(absl::string_view input) {
+  std::string result(input.size() / 4 * 3, '\0');
+  auto size =
+      Base64DecodeBulk(input, reinterpret_cast<unsigned char*>(&result[0]));
+  if (!size) return std::move(size).status();
+  result.resize(*size);
   return result;
 }
 
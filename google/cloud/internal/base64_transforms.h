@@ -17,6 +17,7 @@
 
 #include "google/cloud/status_or.h"
 #include "google/cloud/version.h"
+#include "absl/strings/string_view.h"
 #include <algorithm>
 #include <array>
 #include <cstddef>
@@ -99,6 +100,22 @@ struct Base64Decoder {
 
 Status ValidateBase64String(std::string const& input);
 
+/**
+ * Returns the base64 encoding of @p bytes, using the standard alphabet and
+ * padding.
+ *
+ * Prefer this function over `Base64Encoder` when the input is contiguous, as it
+ * encodes the data in bulk.
+ */
+std::string Base64Encode(absl::string_view bytes);
+
+/**
+ * Decodes the base64 (standard alphabet, padded) string @p input.
+ *
+ * Returns an error if @p input is not a valid base64 string.
+ */
+StatusOr<std::string> Base64Decode(absl::string_view input);
+
 StatusOr<std::vector<std::uint8_t>> Base64DecodeToBytes(
     std::string const& input);
 
@@ -143,6 +143,57 @@ TEST(Base64, ValidateBase64StringFailures) {
   }
 }
 
+TEST(Base64, BulkMatchesIncremental) {
+  // Cover all the possible octets, and all the possible leftover sizes.
+  std::string plain;
+  for (int i = 0; i != 3 * 256 + 2; ++i) {
+    plain.push_back(static_cast<char>((i * 7) % 256));
+    Base64Encoder enc;
+    for (auto c : plain) enc.PushBack(c);
+    auto const expected = std::move(enc).FlushAndPad();
+    auto const actual = Base64Encode(plain);
+    EXPECT_EQ(expected, actual);
+    auto decoded = Base64Decode(actual);
+    ASSERT_STATUS_OK(decoded);
+    EXPECT_EQ(plain, *decoded);
+    auto bytes = Base64DecodeToBytes(actual);
+    ASSERT_STATUS_OK(bytes);
+    EXPECT_EQ(plain, std::string(bytes->begin(), bytes->end()));
+  }
+}
+
+TEST(Base64, Base64DecodeFailures) {
+  // Bad lengths.
+  for (std::string const base64 : {"x", "xx", "xxx"}) {
+    EXPECT_THAT(Base64Decode(base64),
+                StatusIs(StatusCode::kInvalidArgument,
+                         ContainsRegex("Invalid base64.*at offset 0")));
+  }
+  for (std::string const base64 : {"xxxxx", "xxxxxx", "xxxxxxx"}) {
+    EXPECT_THAT(Base64Decode(base64),
+                StatusIs(StatusCode::kInvalidArgument,
+                         ContainsRegex("Invalid base64.*at offset 4")));
+  }
+
+  // Chars outside base64 alphabet, including padding before the last chunk.
+  for (std::string const base64 :
+       {".xxx", "x.xx", "xx.x", "xxx.", "xx.=", "xxxx.xxxxxxx", "QQ==QQ=="}) {
+    auto const offset = base64.find_first_of(".=") / 4 * 4;
+    EXPECT_THAT(Base64Decode(base64),
+                StatusIs(StatusCode::kInvalidArgument,
+                         ContainsRegex("Invalid base64.*at offset " +
+                                       std::to_string(offset))))
+        << base64;
+  }
+
+  // Non-zero padding bits.
+  for (std::string const base64 : {"xx==", "xxx=", "xxxxxx=="}) {
+    EXPECT_THAT(Base64Decode(base64),
+                StatusIs(StatusCode::kInvalidArgument,
+                         ContainsRegex("Invalid base64 chunk")));
+  }
+}
+
 TEST(Base64, UrlsafeBase64Encode) {
   // Produced input using:
   //     echo 'TG9yZ+W0gaXBz/dW1cMACg==' | openssl base64 -d | od -t x1
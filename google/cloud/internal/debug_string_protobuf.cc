@@ -15,9 +15,17 @@
 #include "google/cloud/internal/debug_string_protobuf.h"
 #include "google/cloud/internal/absl_str_cat_quiet.h"
 #include "absl/time/time.h"
+#include <google/protobuf/descriptor.h>
 #include <google/protobuf/duration.pb.h>
+#include <google/protobuf/io/zero_copy_stream_impl_lite.h>
+#include <google/protobuf/message.h>
 #include <google/protobuf/text_format.h>
 #include <google/protobuf/timestamp.pb.h>
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
 
 namespace google {
 namespace cloud {
@@ -62,6 +70,196 @@ class TimestampMessagePrinter
   }
 };
 
+// `Any` payloads larger than this are not formatted when the output is limited.
+auto constexpr kMaxAnyPayload = std::size_t{1024} * 1024;
+
+/**
+ * Copies the leading fields of a message, within a budget.
+ *
+ * The text printer walks the full message, even if its output is truncated.
+ * To bound the cost of formatting large messages, we print a copy with only
+ * the fields that fit in the output. Fields are copied in the order used by
+ * the printer, and the cost of each field is a lower bound on the size of its
+ * text representation.
+ */
+class PayloadPruner {
+ public:
+  PayloadPruner(std::int64_t budget, std::int64_t truncate_string)
+      : budget_(budget), truncate_string_(truncate_string) {}
+
+  /// Returns false if any field of @p source was not copied to @p dest.
+  bool Copy(google::protobuf::Message const& source,
+            google::protobuf::Message& dest) {
+    auto const* descriptor = source.GetDescriptor();
+    auto const& reflection = *source.GetReflection();
+    if (descriptor->full_name() == "google.protobuf.Any") {
+      return CopyAny(source, dest);
+    }
+    // `ListFields()` returns the fields in the same order as the printer.
+    std::vector<FieldDescriptor const*> fields;
+    reflection.ListFields(source, &fields);
+    for (auto const* field : fields) {
+      if (!field->is_repeated()) {
+        if (!CopyField(source, dest, field, -1)) return false;
+        continue;
+      }
+      auto const size = reflection.FieldSize(source, field);
+      for (int j = 0; j != size; ++j) {
+        if (!CopyField(source, dest, field, j)) return false;
+      }
+    }
+    return true;
+  }
+
+ private:
+  using FieldDescriptor = google::protobuf::FieldDescriptor;
+
+  bool CopyField(google::protobuf::Message const& source,
+                 google::protobuf::Message& dest, FieldDescriptor const* field,
+                 int index) {
+    if (budget_ <= 0) return false;
+    budget_ -= static_cast<std::int64_t>(field->name().size()) + 2;
+    auto const& r = *source.GetReflection();
+    auto const repeated = index >= 0;
+    switch (field->cpp_type()) {
+      case FieldDescriptor::CPPTYPE_MESSAGE: {
+        auto const& value = repeated
+                                ? r.GetRepeatedMessage(source, field, index)
+                                : r.GetMessage(source, field);
+        auto* copy = repeated ? r.AddMessage(&dest, field)
+                              : r.MutableMessage(&dest, field);
+        return Copy(value, *copy);
+      }
+      case FieldDescriptor::CPPTYPE_STRING: {
+        std::string scratch;
+        auto const& value =
+            repeated
+                ? r.GetRepeatedStringReference(source, field, index, &scratch)
+                : r.GetStringReference(source, field, &scratch);
+        auto size = value.size();
+        // The printer truncates long strings, keep enough to preserve that.
+        if (truncate_string_ > 0) {
+          size = (std::min)(size,
+                            static_cast<std::size_t>(truncate_string_) + 1);
+        }
+        budget_ -= static_cast<std::int64_t>(size);
+        auto copy = value.substr(0, size);
+        if (repeated) {
+          r.AddString(&dest, field, std::move(copy));
+        } else {
+          r.SetString(&dest, field, std::move(copy));
+        }
+        return true;
+      }
+      default:
+        budget_ -= 1;
+        CopyScalar(source, dest, field, index);
+        return true;
+    }
+  }
+
+  // The printer expands `Any` payloads of known types, so we prune the
+  // payload too. Parsing the payload is cheaper than formatting it, but still
+  // linear in its size, so very large payloads are omitted.
+  bool CopyAny(google::protobuf::Message const& source,
+               google::protobuf::Message& dest) {
+    auto const* descriptor = source.GetDescriptor();
+    auto const* type_url_field = descriptor->FindFieldByNumber(1);
+    auto const* value_field = descriptor->FindFieldByNumber(2);
+    auto const& r = *source.GetReflection();
+    auto const type_url = r.GetString(source, type_url_field);
+    std::string scratch;
+    auto const& value = r.GetStringReference(source, value_field, &scratch);
+    if (value.size() > kMaxAnyPayload) {
+      budget_ -= static_cast<std::int64_t>(type_url.size()) + 4;
+      r.SetString(&dest, type_url_field, type_url);
+      return false;
+    }
+    auto const* type =
+        google::protobuf::DescriptorPool::generated_pool()
+            ->FindMessageTypeByName(type_url.substr(type_url.rfind('/') + 1));
+    std::unique_ptr<google::protobuf::Message> payload;
+    if (type != nullptr) {
+      payload.reset(google::protobuf::MessageFactory::generated_factory()
+                        ->GetPrototype(type)
+                        ->New());
+    }
+    if (!payload || !payload->ParseFromString(value)) {
+      // The printer shows the payload of unknown types as bytes.
+      if (!CopyField(source, dest, type_url_field, -1)) return false;
+      return CopyField(source, dest, value_field, -1);
+    }
+    budget_ -= static_cast<std::int64_t>(type_url.size()) + 4;
+    std::unique_ptr<google::protobuf::Message> pruned(payload->New());
+    auto const complete = Copy(*payload, *pruned);
+    r.SetString(&dest, type_url_field, type_url);
+    r.SetString(&dest, value_field, pruned->SerializeAsString());
+    return complete;
+  }
+
+  static void CopyScalar(google::protobuf::Message const& source,
+                         google::protobuf::Message& dest,
+                         FieldDescriptor const* field, int index) {
+    auto const& r = *source.GetReflection();
+    auto const repeated = index >= 0;
+    switch (field->cpp_type()) {
+      case FieldDescriptor::CPPTYPE_INT32: {
+        auto v = repeated ? r.GetRepeatedInt32(source, field, index)
+                          : r.GetInt32(source, field);
+        return repeated ? r.AddInt32(&dest, field, v)
+                        : r.SetInt32(&dest, field, v);
+      }
+      case FieldDescriptor::CPPTYPE_INT64: {
+        auto v = repeated ? r.GetRepeatedInt64(source, field, index)
+                          : r.GetInt64(source, field);
+        return repeated ? r.AddInt64(&dest, field, v)
+                        : r.SetInt64(&dest, field, v);
+      }
+      case FieldDescriptor::CPPTYPE_UINT32: {
+        auto v = repeated ? r.GetRepeatedUInt32(source, field, index)
+                          : r.GetUInt32(source, field);
+        return repeated ? r.AddUInt32(&dest, field, v)
+                        : r.SetUInt32(&dest, field, v);
+      }
+      case FieldDescriptor::CPPTYPE_UINT64: {
+        auto v = repeated ? r.GetRepeatedUInt64(source, field, index)
+                          : r.GetUInt64(source, field);
+        return repeated ? r.AddUInt64(&dest, field, v)
+                        : r.SetUInt64(&dest, field, v);
+      }
+      case FieldDescriptor::CPPTYPE_DOUBLE: {
+        auto v = repeated ? r.GetRepeatedDouble(source, field, index)
+                          : r.GetDouble(source, field);
+        return repeated ? r.AddDouble(&dest, field, v)
+                        : r.SetDouble(&dest, field, v);
+      }
+      case FieldDescriptor::CPPTYPE_FLOAT: {
+        auto v = repeated ? r.GetRepeatedFloat(source, field, index)
+                          : r.GetFloat(source, field);
+        return repeated ? r.AddFloat(&dest, field, v)
+                        : r.SetFloat(&dest, field, v);
+      }
+      case FieldDescriptor::CPPTYPE_BOOL: {
+        auto v = repeated ? r.GetRepeatedBool(source, field, index)
+                          : r.GetBool(source, field);
+        return repeated ? r.AddBool(&dest, field, v)
+                        : r.SetBool(&dest, field, v);
+      }
+      case FieldDescriptor::CPPTYPE_ENUM: {
+        auto v = repeated ? r.GetRepeatedEnumValue(source, field, index)
+                          : r.GetEnumValue(source, field);
+        return repeated ? r.AddEnumValue(&dest, field, v)
+                        : r.SetEnumValue(&dest, field, v);
+      }
+      default:
+        return;
+    }
+  }
+
+  std::int64_t budget_;
+  std::int64_t truncate_string_;
+};
+
 }  // namespace
 
 std::string DebugString(google::protobuf::Message const& m,
@@ -79,7 +277,24 @@ std::string DebugString(google::protobuf::Message const& m,
                            new DurationMessagePrinter);
   p.RegisterMessagePrinter(google::protobuf::Timestamp::descriptor(),
                            new TimestampMessagePrinter);
-  p.PrintToString(m, &str);
+  auto const limit = options.max_payload_size();
+  if (limit <= 0) {
+    p.PrintToString(m, &str);
+  } else {
+    // Only format the fields that fit in the output, the printer would walk
+    // the full message even after the output is truncated.
+    std::unique_ptr<google::protobuf::Message> pruned(m.New());
+    auto const omitted =
+        !PayloadPruner(limit, options.truncate_string_field_longer_than())
+             .Copy(m, *pruned);
+    auto const& payload = omitted ? *pruned : m;
+    str.resize(static_cast<std::size_t>(limit));
+    google::protobuf::io::ArrayOutputStream output(&str[0],
+                                                   static_cast<int>(limit));
+    auto const complete = p.Print(payload, &output) && !omitted;
+    str.resize(static_cast<std::size_t>(output.ByteCount()));
+    if (!complete) str += "...<truncated>...";
+  }
   return absl::StrCat(m.GetTypeName(), " {",
                       (options.single_line_mode() ? " " : "\n"), str, "}");
 }
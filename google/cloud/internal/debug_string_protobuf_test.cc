@@ -16,10 +16,12 @@
 #include "google/cloud/testing_util/scoped_log.h"
 #include "google/cloud/tracing_options.h"
 #include <google/iam/v1/policy.pb.h>
+#include <google/protobuf/any.pb.h>
 #include <google/protobuf/duration.pb.h>
 #include <google/protobuf/text_format.h>
 #include <google/protobuf/timestamp.pb.h>
 #include <gmock/gmock.h>
+#include <string>
 
 namespace google {
 namespace cloud {
@@ -110,6 +112,61 @@ TEST(LogWrapperHelpers, Truncate) {
   EXPECT_EQ(text, DebugString(MakePolicy(), tracing_options));
 }
 
+TEST(LogWrapperHelpers, MaxPayloadSize) {
+  TracingOptions tracing_options;
+  tracing_options.SetOptions("max_payload_size=32");
+  std::string const text =
+      R"pb(google.iam.v1.Policy { bindings { role: "roles/viewer" )pb"
+      R"pb(...<truncated>...})pb";
+  EXPECT_EQ(text, DebugString(MakePolicy(), tracing_options));
+
+  // Messages smaller than the limit are not affected.
+  tracing_options.SetOptions("max_payload_size=4096");
+  EXPECT_EQ(DebugString(MakePolicy(), TracingOptions{}),
+            DebugString(MakePolicy(), tracing_options));
+}
+
+TEST(LogWrapperHelpers, MaxPayloadSizeLargeMessage) {
+  google::iam::v1::Policy policy;
+  for (int i = 0; i != 10000; ++i) {
+    auto& binding = *policy.add_bindings();
+    binding.set_role("roles/role-" + std::to_string(i));
+    binding.add_members("user:user" + std::to_string(i) + "@example.com");
+  }
+  auto const full = DebugString(policy, TracingOptions{});
+  TracingOptions tracing_options;
+  tracing_options.SetOptions("max_payload_size=128");
+  auto const header = std::string("google.iam.v1.Policy { ");
+  EXPECT_EQ(full.substr(0, header.size() + 128) + "...<truncated>...}",
+            DebugString(policy, tracing_options));
+}
+
+TEST(LogWrapperHelpers, MaxPayloadSizeLongString) {
+  auto policy = MakePolicy();
+  policy.mutable_bindings(0)->set_role(std::string(1024 * 1024, 'x'));
+  policy.set_etag(std::string(1024 * 1024, 'y'));
+  // Long strings are truncated before the payload limit applies.
+  TracingOptions tracing_options;
+  tracing_options.SetOptions("max_payload_size=4096");
+  EXPECT_EQ(DebugString(policy, TracingOptions{}),
+            DebugString(policy, tracing_options));
+}
+
+TEST(LogWrapperHelpers, MaxPayloadSizeAny) {
+  google::protobuf::Any any;
+  any.PackFrom(MakePolicy());
+  TracingOptions tracing_options;
+  tracing_options.SetOptions("max_payload_size=4096");
+  EXPECT_EQ(DebugString(any, TracingOptions{}),
+            DebugString(any, tracing_options));
+
+  tracing_options.SetOptions("max_payload_size=80");
+  auto const full = DebugString(any, TracingOptions{});
+  auto const header = std::string("google.protobuf.Any { ");
+  EXPECT_EQ(full.substr(0, header.size() + 80) + "...<truncated>...}",
+            DebugString(any, tracing_options));
+}
+
 TEST(LogWrapperHelpers, Duration) {
   google::protobuf::Duration duration;
   duration.set_seconds((11 * 60 + 22) * 60 + 33);
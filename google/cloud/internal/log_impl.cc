@@ -14,6 +14,7 @@
 
 #include "google/cloud/internal/log_impl.h"
 #include "google/cloud/internal/getenv.h"
+#include <utility>
 
 namespace google {
 namespace cloud {
@@ -76,6 +77,166 @@ thread_local std::vector<LogRecord> PerThreadCircularBufferBackend::buffer_;
 thread_local std::size_t PerThreadCircularBufferBackend::begin_ = 0;
 thread_local std::size_t PerThreadCircularBufferBackend::end_ = 0;
 
+bool LogRecordRing::Push(LogRecord& lr) {
+  auto const tail = tail_.load(std::memory_order_relaxed);
+  auto const head = head_.load(std::memory_order_acquire);
+  if (tail - head == slots_.size()) return false;
+  slots_[tail % slots_.size()] = std::move(lr);
+  tail_.store(tail + 1, std::memory_order_release);
+  return true;
+}
+
+void LogRecordRing::Drain(std::vector<LogRecord>& out) {
+  auto const head = head_.load(std::memory_order_relaxed);
+  auto const tail = tail_.load(std::memory_order_acquire);
+  for (auto i = head; i != tail; ++i) {
+    out.push_back(std::move(slots_[i % slots_.size()]));
+  }
+  head_.store(tail, std::memory_order_release);
+}
+
+std::size_t LogRecordRing::size() const {
+  return tail_.load(std::memory_order_acquire) -
+         head_.load(std::memory_order_acquire);
+}
+
+namespace {
+
+std::uint64_t NextAsyncLogBackendId() {
+  static std::atomic<std::uint64_t> generator{0};
+  return ++generator;
+}
+
+// The rings used by a thread, keyed by `AsyncLogBackend` id. The ids are never
+// reused. When the thread exits the rings are closed, so the backends can
+// discard them once they are drained.
+struct ThreadRings {
+  ThreadRings() = default;
+  ThreadRings(ThreadRings const&) = delete;
+  ThreadRings& operator=(ThreadRings const&) = delete;
+  ~ThreadRings() {
+    for (auto& kv : rings) kv.second->Close();
+  }
+
+  std::vector<std::pair<std::uint64_t, std::shared_ptr<LogRecordRing>>> rings;
+};
+
+}  // namespace
+
+AsyncLogBackend::AsyncLogBackend(std::size_t ring_size,
+                                 Severity min_flush_severity,
+                                 std::shared_ptr<LogBackend> backend,
+                                 std::chrono::milliseconds flush_period)
+    : id_(NextAsyncLogBackendId()),
+      ring_size_((std::max)(ring_size, std::size_t{1})),
+      min_flush_severity_(
+          (std::min)(min_flush_severity, Severity::GCP_LS_FATAL)),
+      backend_(std::move(backend)),
+      flush_period_(flush_period),
+      flusher_([this] { FlushLoop(); }) {}
+
+AsyncLogBackend::~AsyncLogBackend() {
+  {
+    std::lock_guard<std::mutex> lk(mu_);
+    shutdown_ = true;
+  }
+  cv_.notify_one();
+  flusher_.join();
+  Drain();
+  std::lock_guard<std::mutex> lk(mu_);
+  for (auto& r : rings_) r->Close();
+  backend_->Flush();
+}
+
+void AsyncLogBackend::ProcessWithOwnership(LogRecord lr) {
+  auto const needs_flush = lr.severity >= min_flush_severity_;
+  auto& ring = ThreadRing();
+  if (!ring.Push(lr)) {
+    if (!needs_flush) {
+      ++dropped_;
+      ++total_dropped_;
+      cv_.notify_one();
+      return;
+    }
+    // Do not lose high severity messages, make room and try again. Only this
+    // thread produces into `ring`, so the second attempt always succeeds.
+    Drain();
+    ring.Push(lr);
+  }
+  if (needs_flush) return Flush();
+  // Wake up the flusher thread before the queue is full.
+  if (ring.size() == ring.capacity() / 2) cv_.notify_one();
+}
+
+void AsyncLogBackend::Flush() {
+  Drain();
+  backend_->Flush();
+}
+
+LogRecordRing& AsyncLogBackend::ThreadRing() {
+  thread_local ThreadRings thread_rings;
+  auto& rings = thread_rings.rings;
+  for (auto const& kv : rings) {
+    if (kv.first == id_) return *kv.second;
+  }
+  // The rings of deleted backends are closed, this is a good time to discard
+  // them.
+  rings.erase(
+      std::remove_if(rings.begin(), rings.end(),
+                     [](auto const& kv) { return kv.second->closed(); }),
+      rings.end());
+  auto ring = std::make_shared<LogRecordRing>(ring_size_);
+  {
+    std::lock_guard<std::mutex> lk(mu_);
+    rings_.push_back(ring);
+  }
+  rings.emplace_back(id_, ring);
+  return *ring;
+}
+
+void AsyncLogBackend::Drain() {
+  std::lock_guard<std::mutex> drain_lk(drain_mu_);
+  std::vector<std::shared_ptr<LogRecordRing>> rings;
+  {
+    std::lock_guard<std::mutex> lk(mu_);
+    rings = rings_;
+  }
+  std::vector<LogRecord> records;
+  for (auto& r : rings) r->Drain(records);
+  // Each ring is ordered, merging the rings requires a (stable) sort.
+  std::stable_sort(records.begin(), records.end(),
+                   [](LogRecord const& a, LogRecord const& b) {
+                     return a.timestamp < b.timestamp;
+                   });
+  auto const dropped = dropped_.exchange(0);
+  if (dropped != 0) {
+    records.push_back(LogRecord{
+        Severity::GCP_LS_WARNING, __func__, __FILE__, __LINE__,
+        std::this_thread::get_id(), std::chrono::system_clock::now(),
+        "AsyncLogBackend dropped " + std::to_string(dropped) +
+            " log records, consider increasing the queue size"});
+  }
+  for (auto& lr : records) backend_->ProcessWithOwnership(std::move(lr));
+
+  // Discard the rings of threads that have exited, once they are drained.
+  std::lock_guard<std::mutex> lk(mu_);
+  rings_.erase(std::remove_if(rings_.begin(), rings_.end(),
+                              [](auto const& r) {
+                                return r->closed() && r->size() == 0;
+                              }),
+               rings_.end());
+}
+
+void AsyncLogBackend::FlushLoop() {
+  std::unique_lock<std::mutex> lk(mu_);
+  while (!shutdown_) {
+    cv_.wait_for(lk, flush_period_);
+    lk.unlock();
+    Drain();
+    lk.lock();
+  }
+}
+
 }  // namespace internal
 GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
 }  // namespace cloud
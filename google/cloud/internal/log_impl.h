@@ -18,6 +18,13 @@
 #include "google/cloud/log.h"
 #include "google/cloud/version.h"
 #include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
 #include <vector>
 
 namespace google {
@@ -97,6 +104,90 @@ class PerThreadCircularBufferBackend : public LogBackend {
   std::shared_ptr<LogBackend> backend_;
 };
 
+/**
+ * A single-producer, single-consumer queue of log records.
+ *
+ * The producer and consumer do not block each other, they only synchronize
+ * through the `head_` and `tail_` atomics.
+ */
+class LogRecordRing {
+ public:
+  explicit LogRecordRing(std::size_t capacity) : slots_(capacity) {}
+
+  std::size_t capacity() const { return slots_.size(); }
+
+  /// Only the producer may call this function. Returns false if full.
+  bool Push(LogRecord& lr);
+
+  /// Only the (single) consumer may call this function.
+  void Drain(std::vector<LogRecord>& out);
+
+  /// The number of records in the queue, may be stale for both sides.
+  std::size_t size() const;
+
+  /// Called when the producer thread exits, or the consumer is deleted.
+  void Close() { closed_.store(true, std::memory_order_release); }
+  bool closed() const { return closed_.load(std::memory_order_acquire); }
+
+ private:
+  std::vector<LogRecord> slots_;
+  std::atomic<std::size_t> head_{0};
+  std::atomic<std::size_t> tail_{0};
+  std::atomic<bool> closed_{false};
+};
+
+/**
+ * A backend that moves formatting and I/O off the threads that create logs.
+ *
+ * Each thread appends its records to its own `LogRecordRing`, without any
+ * locks. A background thread periodically drains these queues, and forwards
+ * the records, ordered by timestamp, to the wrapped backend. If a queue is
+ * full the record is dropped, and the number of dropped records is reported
+ * in a separate log record.
+ *
+ * Records with severity @p min_flush_severity or higher are delivered before
+ * `Process()` returns, as the application may be about to crash.
+ */
+class AsyncLogBackend : public LogBackend {
+ public:
+  AsyncLogBackend(std::size_t ring_size, Severity min_flush_severity,
+                  std::shared_ptr<LogBackend> backend,
+                  std::chrono::milliseconds flush_period =
+                      std::chrono::milliseconds(50));
+  ~AsyncLogBackend() override;
+
+  std::size_t ring_size() const { return ring_size_; }
+  Severity min_flush_severity() const { return min_flush_severity_; }
+  std::shared_ptr<LogBackend> backend() const { return backend_; }
+  std::uint64_t dropped() const { return total_dropped_.load(); }
+
+  void Process(LogRecord const& lr) override { ProcessWithOwnership(lr); }
+  void ProcessWithOwnership(LogRecord lr) override;
+  void Flush() override;
+
+ private:
+  LogRecordRing& ThreadRing();
+  void Drain();
+  void FlushLoop();
+
+  std::uint64_t const id_;
+  std::size_t const ring_size_;
+  Severity const min_flush_severity_;
+  std::shared_ptr<LogBackend> backend_;
+  std::chrono::milliseconds const flush_period_;
+  std::atomic<std::uint64_t> dropped_{0};
+  std::atomic<std::uint64_t> total_dropped_{0};
+
+  // Serializes the consumers: the flusher thread and any calls to `Flush()`.
+  std::mutex drain_mu_;
+
+  std::mutex mu_;
+  std::condition_variable cv_;
+  bool shutdown_ = false;
+  std::vector<std::shared_ptr<LogRecordRing>> rings_;
+  std::thread flusher_;
+};
+
 }  // namespace internal
 GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
 }  // namespace cloud
@@ -16,6 +16,13 @@
 #include "google/cloud/testing_util/scoped_environment.h"
 #include "google/cloud/testing_util/scoped_log.h"
 #include <gmock/gmock.h>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
 
 namespace google {
 namespace cloud {
@@ -26,6 +33,7 @@ namespace {
 using ::google::cloud::testing_util::ScopedEnvironment;
 using ::google::cloud::testing_util::ScopedLog;
 using ::testing::ElementsAre;
+using ::testing::HasSubstr;
 using ::testing::IsEmpty;
 using ::testing::NotNull;
 
@@ -125,6 +133,163 @@ TEST(PerThreadCircularBufferBackend, Basic) {
   EXPECT_THAT(be->ExtractLines(), ElementsAre("msg 9", "msg 10"));
 }
 
+TEST(LogRecordRing, PushAndDrain) {
+  LogRecordRing ring(2);
+  auto make = [](std::string msg) {
+    return LogRecord{
+        Severity::GCP_LS_INFO,      "test_function()", "file", 1,
+        std::this_thread::get_id(), {},                std::move(msg)};
+  };
+  auto r1 = make("msg 1");
+  auto r2 = make("msg 2");
+  auto r3 = make("msg 3");
+  EXPECT_TRUE(ring.Push(r1));
+  EXPECT_TRUE(ring.Push(r2));
+  EXPECT_FALSE(ring.Push(r3));
+  EXPECT_EQ(ring.size(), 2);
+
+  std::vector<LogRecord> out;
+  ring.Drain(out);
+  EXPECT_EQ(ring.size(), 0);
+  EXPECT_TRUE(ring.Push(r3));
+  ring.Drain(out);
+  std::vector<std::string> messages;
+  for (auto const& lr : out) messages.push_back(lr.message);
+  EXPECT_THAT(messages, ElementsAre("msg 1", "msg 2", "msg 3"));
+}
+
+TEST(AsyncLogBackend, Basic) {
+  auto be = std::make_shared<ScopedLog::Backend>();
+  // Use a long flush period, so only explicit flushes produce output.
+  AsyncLogBackend async(16, Severity::GCP_LS_ERROR, be, std::chrono::hours(1));
+  auto test_log_record = [](Severity severity, std::string msg) {
+    return LogRecord{severity,
+                     "test_function()",
+                     "file",
+                     1,
+                     std::this_thread::get_id(),
+                     std::chrono::system_clock::now(),
+                     std::move(msg)};
+  };
+  async.ProcessWithOwnership(test_log_record(Severity::GCP_LS_INFO, "msg 1"));
+  async.ProcessWithOwnership(test_log_record(Severity::GCP_LS_DEBUG, "msg 2"));
+  EXPECT_THAT(be->ExtractLines(), IsEmpty());
+
+  // A message with high enough severity is delivered immediately, with any
+  // pending messages.
+  async.ProcessWithOwnership(test_log_record(Severity::GCP_LS_ERROR, "msg 3"));
+  EXPECT_THAT(be->ExtractLines(), ElementsAre("msg 1", "msg 2", "msg 3"));
+
+  async.ProcessWithOwnership(test_log_record(Severity::GCP_LS_INFO, "msg 4"));
+  async.Flush();
+  EXPECT_THAT(be->ExtractLines(), ElementsAre("msg 4"));
+}
+
+// Holds the `AsyncLogBackend` flusher thread inside the first record it
+// delivers, until the test releases it.
+class BlockingBackend : public LogBackend {
+ public:
+  explicit BlockingBackend(std::shared_ptr<LogBackend> backend)
+      : backend_(std::move(backend)) {}
+
+  void Process(LogRecord const& lr) override { ProcessWithOwnership(lr); }
+  void ProcessWithOwnership(LogRecord lr) override {
+    std::unique_lock<std::mutex> lk(mu_);
+    blocked_ = true;
+    cv_.notify_all();
+    cv_.wait(lk, [this] { return released_; });
+    lk.unlock();
+    backend_->ProcessWithOwnership(std::move(lr));
+  }
+  void Flush() override { backend_->Flush(); }
+
+  void WaitBlocked() {
+    std::unique_lock<std::mutex> lk(mu_);
+    cv_.wait(lk, [this] { return blocked_; });
+  }
+  void Release() {
+    std::lock_guard<std::mutex> lk(mu_);
+    released_ = true;
+    cv_.notify_all();
+  }
+
+ private:
+  std::shared_ptr<LogBackend> backend_;
+  std::mutex mu_;
+  std::condition_variable cv_;
+  bool blocked_ = false;
+  bool released_ = false;
+};
+
+TEST(AsyncLogBackend, DropsWhenFull) {
+  auto be = std::make_shared<ScopedLog::Backend>();
+  auto blocking = std::make_shared<BlockingBackend>(be);
+  AsyncLogBackend async(2, Severity::GCP_LS_ERROR, blocking,
+                        std::chrono::milliseconds(1));
+  auto test_log_record = [](int i) {
+    return LogRecord{Severity::GCP_LS_INFO,
+                     "test_function()",
+                     "file",
+                     1,
+                     std::this_thread::get_id(),
+                     std::chrono::system_clock::now(),
+                     "msg " + std::to_string(i)};
+  };
+  // Wait until the flusher thread is busy delivering the first record, so
+  // nothing drains the ring while it fills up.
+  async.ProcessWithOwnership(test_log_record(0));
+  blocking->WaitBlocked();
+  for (int i = 1; i != 6; ++i) async.ProcessWithOwnership(test_log_record(i));
+  EXPECT_EQ(async.dropped(), 3);
+
+  blocking->Release();
+  async.Flush();
+  auto lines = be->ExtractLines();
+  ASSERT_EQ(lines.size(), 4);
+  EXPECT_EQ(lines[0], "msg 0");
+  EXPECT_EQ(lines[1], "msg 1");
+  EXPECT_EQ(lines[2], "msg 2");
+  EXPECT_THAT(lines[3], HasSubstr("dropped 3 log records"));
+  EXPECT_EQ(async.dropped(), 3);
+}
+
+TEST(AsyncLogBackend, MultipleThreads) {
+  auto constexpr kThreads = 4;
+  auto constexpr kRecords = 100;
+  auto be = std::make_shared<ScopedLog::Backend>();
+  {
+    AsyncLogBackend async(kRecords, Severity::GCP_LS_FATAL, be,
+                          std::chrono::milliseconds(1));
+    std::vector<std::thread> threads;
+    for (int t = 0; t != kThreads; ++t) {
+      threads.emplace_back([&async] {
+        for (int i = 0; i != kRecords; ++i) {
+          async.ProcessWithOwnership(LogRecord{
+              Severity::GCP_LS_INFO, "test_function()", "file", 1,
+              std::this_thread::get_id(), std::chrono::system_clock::now(),
+              "msg " + std::to_string(i)});
+        }
+      });
+    }
+    for (auto& t : threads) t.join();
+    // The destructor delivers any pending messages.
+  }
+  EXPECT_EQ(be->ExtractLines().size(), kThreads * kRecords);
+}
+
+TEST(DefaultLogBackend, Async) {
+  ScopedEnvironment config(kLogConfig, "async,1024,ERROR");
+  ScopedEnvironment clog(kEnableClog, absl::nullopt);
+  auto be = DefaultLogBackend();
+  auto const* async = dynamic_cast<AsyncLogBackend*>(be.get());
+  ASSERT_NE(async, nullptr);
+  EXPECT_EQ(1024, async->ring_size());
+  EXPECT_EQ(Severity::GCP_LS_ERROR, async->min_flush_severity());
+  auto const* clog_be = dynamic_cast<StdClogBackend*>(async->backend().get());
+  ASSERT_THAT(clog_be, NotNull());
+  EXPECT_EQ(Severity::GCP_LS_DEBUG, clog_be->min_severity());
+}
+
 TEST(DefaultLogBackend, CircularBuffer) {
   ScopedEnvironment config(kLogConfig, "lastN,5,WARNING");
   ScopedEnvironment clog(kEnableClog, absl::nullopt);
@@ -13,19 +13,33 @@
 // limitations under the License.
 
 #include "google/cloud/internal/log_wrapper.h"
+#include <cstdint>
 
 namespace google {
 namespace cloud {
 GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_BEGIN
 namespace internal {
 
+bool LogPayload(TracingOptions const& options) {
+  if (!LogSink::CompileTimeEnabled(Severity::GCP_LS_DEBUG)) return false;
+  auto const& sink = LogSink::Instance();
+  if (sink.empty() || !sink.is_enabled(Severity::GCP_LS_DEBUG)) return false;
+  auto const period = options.payload_sampling_period();
+  if (period <= 1) return true;
+  // Use a per-thread counter, as a shared counter would be a point of
+  // contention for all the RPCs.
+  thread_local std::int64_t counter = 0;
+  return counter++ % period == 0;
+}
+
 void LogRequest(absl::string_view where, absl::string_view args,
                 absl::string_view message) {
   GCP_LOG(DEBUG) << where << '(' << args << ')' << " << " << message;
 }
 
 Status LogResponse(Status response, absl::string_view where,
-                   absl::string_view args, TracingOptions const& options) {
+                   absl::string_view args, TracingOptions const& options,
+                   bool /*log_payload*/) {
   GCP_LOG(DEBUG) << where << '(' << args << ')'
                  << " >> status=" << DebugString(response, options);
   return response;
@@ -39,7 +53,8 @@ void LogResponseFuture(std::future_status status, absl::string_view where,
 }
 
 future<Status> LogResponse(future<Status> response, std::string where,
-                           std::string args, TracingOptions const& options) {
+                           std::string args, TracingOptions const& options,
+                           bool /*log_payload*/) {
   LogResponseFuture(response.wait_for(std::chrono::microseconds(0)), where,
                     args, options);
   return response.then([where = std::move(where), args = std::move(args),
@@ -61,20 +61,39 @@ struct IsFutureStatus : public std::false_type {};
 template <>
 struct IsFutureStatus<future<Status>> : public std::true_type {};
 
+/**
+ * Returns true if the payloads of the current RPC should be formatted.
+ *
+ * Formatting large request and response messages is expensive. We skip it
+ * when the log would be discarded, and for RPCs not selected by the
+ * `payload_sampling_period` tracing option.
+ */
+bool LogPayload(TracingOptions const& options);
+
+/// Formats @p payload, or a placeholder if @p log_payload is false.
+template <typename T>
+std::string DebugPayload(T const& payload, bool log_payload,
+                         TracingOptions const& options) {
+  if (!log_payload) return "[payload not sampled]";
+  return DebugString(payload, options);
+}
+
 void LogRequest(absl::string_view where, absl::string_view args,
                 absl::string_view message);
 
 Status LogResponse(Status response, absl::string_view where,
-                   absl::string_view args, TracingOptions const& options);
+                   absl::string_view args, TracingOptions const& options,
+                   bool log_payload = true);
 
 template <typename T>
 StatusOr<T> LogResponse(StatusOr<T> response, absl::string_view where,
-                        absl::string_view args, TracingOptions const& options) {
+                        absl::string_view args, TracingOptions const& options,
+                        bool log_payload = true) {
   if (!response) {
     return LogResponse(std::move(response).status(), where, args, options);
   }
-  GCP_LOG(DEBUG) << where << '(' << args << ')'
-                 << " >> response=" << DebugString(*response, options);
+  GCP_LOG(DEBUG) << where << '(' << args << ')' << " >> response="
+                 << DebugPayload(*response, log_payload, options);
   return response;
 }
 
@@ -82,16 +101,18 @@ void LogResponseFuture(std::future_status status, absl::string_view where,
                        absl::string_view args, TracingOptions const& options);
 
 future<Status> LogResponse(future<Status> response, std::string where,
-                           std::string args, TracingOptions const& options);
+                           std::string args, TracingOptions const& options,
+                           bool log_payload = true);
 
 template <typename T>
 future<StatusOr<T>> LogResponse(future<StatusOr<T>> response, std::string where,
-                                std::string args, TracingOptions options) {
+                                std::string args, TracingOptions options,
+                                bool log_payload = true) {
   LogResponseFuture(response.wait_for(std::chrono::microseconds(0)), where,
                     args, options);
   return response.then([where = std::move(where), args = std::move(args),
-                        options = std::move(options)](auto f) {
-    return LogResponse(f.get(), where, args, options);
+                        options = std::move(options), log_payload](auto f) {
+    return LogResponse(f.get(), where, args, options, log_payload);
   });
 }
 
@@ -101,7 +122,8 @@ void LogResponsePtr(bool not_null, absl::string_view where,
 template <typename T>
 std::unique_ptr<T> LogResponse(std::unique_ptr<T> response,
                                absl::string_view where, absl::string_view args,
-                               TracingOptions const& options) {
+                               TracingOptions const& options,
+                               bool /*log_payload*/ = true) {
   LogResponsePtr(!!response, where, args, options);
   return response;
 }
@@ -112,9 +134,10 @@ template <typename Functor, typename Request, typename Context,
 Result LogWrapper(Functor&& functor, Context&& context, Options const& opts,
                   Request const& request, char const* where,
                   TracingOptions const& options) {
-  LogRequest(where, "", DebugString(request, options));
+  auto const log_payload = LogPayload(options);
+  LogRequest(where, "", DebugPayload(request, log_payload, options));
   return LogResponse(functor(std::forward<Context>(context), opts, request),
-                     where, "", options);
+                     where, "", options, log_payload);
 }
 
 template <typename Functor, typename Request, typename Context,
@@ -138,8 +161,10 @@ template <
 Result LogWrapper(Functor&& functor, grpc::ClientContext& context,
                   Request const& request, grpc::CompletionQueue* cq,
                   char const* where, TracingOptions const& options) {
-  LogRequest(where, "", DebugString(request, options));
-  return LogResponse(functor(context, request, cq), where, "", options);
+  auto const log_payload = LogPayload(options);
+  LogRequest(where, "", DebugPayload(request, log_payload, options));
+  return LogResponse(functor(context, request, cq), where, "", options,
+                     log_payload);
 }
 
 template <typename Functor, typename Request, typename Context,
@@ -153,9 +178,10 @@ Result LogWrapper(Functor&& functor, google::cloud::CompletionQueue& cq,
   // Because this is an asynchronous request we need a unique identifier so
   // applications can match the request and response in the log.
   auto args = RequestIdForLogging();
-  LogRequest(where, args, DebugString(request, options));
+  auto const log_payload = LogPayload(options);
+  LogRequest(where, args, DebugPayload(request, log_payload, options));
   return LogResponse(functor(cq, std::forward<Context>(context), opts, request),
-                     where, std::move(args), options);
+                     where, std::move(args), options, log_payload);
 }
 
 template <typename Functor, typename Request, typename Context,
@@ -169,10 +195,11 @@ Result LogWrapper(Functor&& functor, google::cloud::CompletionQueue& cq,
   // Because this is an asynchronous request we need a unique identifier so
   // applications can match the request and response in the log.
   auto args = RequestIdForLogging();
-  LogRequest(where, args, DebugString(request, options));
+  auto const log_payload = LogPayload(options);
+  LogRequest(where, args, DebugPayload(request, log_payload, options));
   return LogResponse(
       functor(cq, std::forward<Context>(context), std::move(opts), request),
-      where, std::move(args), options);
+      where, std::move(args), options, log_payload);
 }
 
 template <
@@ -20,7 +20,9 @@
 #include "google/cloud/tracing_options.h"
 #include <google/protobuf/duration.pb.h>
 #include <google/protobuf/timestamp.pb.h>
+#include "absl/strings/match.h"
 #include <gmock/gmock.h>
+#include <algorithm>
 #include <memory>
 #include <tuple>
 #include <utility>
@@ -163,6 +165,47 @@ TEST(LogWrapperUniquePtr, Error) {
               Contains(AllOf(HasSubstr("in-test("), HasSubstr(" >> null"))));
 }
 
+TEST(LogWrapper, PayloadSampling) {
+  auto functor = [](grpc::ClientContext&, Request const&) {
+    return StatusOr<Response>(MakeResponse());
+  };
+  auto const options =
+      TracingOptions{}.SetOptions("payload_sampling_period=1000000");
+  auto const expected_request = DebugString(MakeRequest(), TracingOptions{});
+  auto const expected_response = DebugString(MakeResponse(), TracingOptions{});
+
+  testing_util::ScopedLog log;
+  grpc::ClientContext context;
+  // With a large period at most one of these calls has its payloads logged.
+  auto constexpr kCalls = 4;
+  for (int i = 0; i != kCalls; ++i) {
+    auto actual =
+        LogWrapper(functor, context, MakeRequest(), "in-test", options);
+    EXPECT_THAT(actual, IsOkAndHolds(IsProtoEqual(MakeResponse())));
+  }
+
+  auto const log_lines = log.ExtractLines();
+  EXPECT_EQ(log_lines.size(), 2 * kCalls);
+  auto count = [&](std::string const& s) {
+    return std::count_if(
+        log_lines.begin(), log_lines.end(),
+        [&](auto const& l) { return absl::StrContains(l, s); });
+  };
+  EXPECT_EQ(count("[payload not sampled]"), 2 * (kCalls - 1));
+  EXPECT_EQ(count(expected_request), 1);
+  EXPECT_EQ(count(expected_response), 1);
+}
+
+TEST(LogWrapper, NoPayloadWhenDebugDisabled) {
+  testing_util::ScopedLog log;
+  EXPECT_TRUE(LogPayload(TracingOptions{}));
+  auto& sink = LogSink::Instance();
+  auto const saved = sink.minimum_severity();
+  sink.set_minimum_severity(Severity::GCP_LS_INFO);
+  EXPECT_FALSE(LogPayload(TracingOptions{}));
+  sink.set_minimum_severity(saved);
+}
+
 TYPED_TEST(LogWrapperTest, BlockingSuccess) {
   using ReturnType = std::tuple_element_t<0, typename TestFixture::TestTypes>;
   using ContextPtrType =
@@ -15,14 +15,21 @@
 #ifndef GOOGLE_CLOUD_CPP_GOOGLE_CLOUD_INTERNAL_PAGINATION_RANGE_H
 #define GOOGLE_CLOUD_CPP_GOOGLE_CLOUD_INTERNAL_PAGINATION_RANGE_H
 
+#include "google/cloud/common_options.h"
 #include "google/cloud/internal/invoke_result.h"
 #include "google/cloud/internal/type_traits.h"
+#include "google/cloud/options.h"
 #include "google/cloud/status_or.h"
 #include "google/cloud/stream_range.h"
 #include "google/cloud/version.h"
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -60,6 +67,9 @@ using PaginationRange = StreamRange<T>;
  * Users should not use this class directly. Use the `MakePaginationRange()`
  * function (defined below) instead.
  *
+ * If `PagePrefetchDepthOption` is set, the pages are loaded in a background
+ * thread, while the application consumes the current page.
+ *
  * @tparam T the type of the items, typically a proto describing the resources
  * @tparam Request the type of the request object for the `List` RPC.
  * @tparam Response the type of the response object for the `List` RPC.
@@ -95,12 +105,11 @@ class PagedStreamReader {
    */
   typename StreamReader<T>::result_type GetNext(Options const& options) {
     while (current_ == page_.end() && !last_page_) {
-      request_.set_page_token(std::move(token_));
-      auto response = loader_(options, request_);
-      if (!response.ok()) return std::move(response).status();
-      token_ = ExtractPageToken(*response);
+      auto page = NextPage(options);
+      if (!page.ok()) return std::move(page).status();
+      token_ = std::move(page->token);
       if (token_.empty()) last_page_ = true;
-      page_ = extractor_(*std::move(response));
+      page_ = extractor_(std::move(page->response));
       current_ = page_.begin();
     }
     if (current_ == page_.end()) return Status{};
@@ -108,6 +117,99 @@ class PagedStreamReader {
   }
 
  private:
+  struct Page {
+    std::string token;
+    Response response;
+  };
+
+  static StatusOr<Page> LoadPage(Loader const& loader, Options const& options,
+                                 Request const& request) {
+    auto response = loader(options, request);
+    if (!response.ok()) return std::move(response).status();
+    auto token = ExtractPageToken(*response);
+    return Page{std::move(token), *std::move(response)};
+  }
+
+  /**
+   * Loads pages in a background thread.
+   *
+   * The thread stops after the last page, after an error, or when this object
+   * is destroyed. Only the next page token is known at any time, so the pages
+   * are loaded sequentially, and at most `depth` pages are buffered.
+   */
+  class Prefetcher {
+   public:
+    Prefetcher(Request request, Loader loader, Options options,
+               std::size_t depth)
+        : depth_(depth),
+          thread_([this, request = std::move(request),
+                   loader = std::move(loader),
+                   options = std::move(options)]() mutable {
+            Run(std::move(request), loader, options);
+          }) {}
+
+    // Stops loading new pages, but waits for any outstanding request.
+    ~Prefetcher() {
+      {
+        std::lock_guard<std::mutex> lk(mu_);
+        cancelled_ = true;
+      }
+      cv_.notify_all();
+      thread_.join();
+    }
+
+    StatusOr<Page> Next() {
+      std::unique_lock<std::mutex> lk(mu_);
+      cv_.wait(lk, [this] { return !pages_.empty() || done_; });
+      // Only happens if the caller ignores an error, treat it as the end.
+      if (pages_.empty()) return Page{};
+      auto page = std::move(pages_.front());
+      pages_.pop_front();
+      cv_.notify_all();
+      return page;
+    }
+
+   private:
+    void Run(Request request, Loader const& loader, Options const& options) {
+      OptionsSpan span(options);
+      for (;;) {
+        auto page = LoadPage(loader, options, request);
+        auto const last = !page.ok() || page->token.empty();
+        if (!last) request.set_page_token(page->token);
+        std::unique_lock<std::mutex> lk(mu_);
+        pages_.push_back(std::move(page));
+        done_ = last;
+        cv_.notify_all();
+        if (last) return;
+        cv_.wait(lk, [this] { return cancelled_ || pages_.size() < depth_; });
+        if (cancelled_) return;
+      }
+    }
+
+    std::size_t const depth_;
+    std::mutex mu_;
+    std::condition_variable cv_;
+    std::deque<StatusOr<Page>> pages_;
+    bool done_ = false;
+    bool cancelled_ = false;
+    std::thread thread_;
+  };
+
+  StatusOr<Page> NextPage(Options const& options) {
+    if (!started_) {
+      started_ = true;
+      auto const depth = options.get<PagePrefetchDepthOption>();
+      if (depth != 0) {
+        request_.set_page_token(std::string{});
+        prefetcher_ = std::make_unique<Prefetcher>(
+            std::move(request_), std::move(loader_), options, depth);
+      }
+    }
+    if (prefetcher_) return prefetcher_->Next();
+    request_.set_page_token(std::move(token_));
+    return LoadPage(loader_, options, request_);
+  }
+
   template <typename U, typename AlwaysVoid = void>
   struct HasMutableNextPageToken : public std::false_type {};
   template <typename U>
@@ -194,6 +296,8 @@ class PagedStreamReader {
   typename std::vector<T>::iterator current_;
   std::string token_;
   bool last_page_ = false;
+  bool started_ = false;
+  std::unique_ptr<Prefetcher> prefetcher_;
 };
 
 /**
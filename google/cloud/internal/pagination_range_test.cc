@@ -377,6 +377,109 @@ TYPED_TEST(PaginationRangeTest, IteratorCoverage) {
   EXPECT_TRUE(i1 == range.end());
 }
 
+TYPED_TEST(PaginationRangeTest, PrefetchPages) {
+  using ResponseType = TypeParam;
+  MockRpcExplicit<ResponseType> mock;
+  EXPECT_CALL(mock, Loader)
+      .WillOnce([](Options const& options, Request const& request) {
+        EXPECT_EQ(options.get<StringOption>(), "PrefetchPages");
+        EXPECT_EQ(CurrentOptions().get<StringOption>(), "PrefetchPages");
+        EXPECT_TRUE(request.testonly_page_token.empty());
+        ResponseType response;
+        response.testonly_set_page_token("t1");
+        response.testonly_items.push_back(Item{"p1"});
+        response.testonly_items.push_back(Item{"p2"});
+        return response;
+      })
+      .WillOnce([](Options const& options, Request const& request) {
+        EXPECT_EQ(options.get<StringOption>(), "PrefetchPages");
+        EXPECT_EQ("t1", request.testonly_page_token);
+        ResponseType response;
+        response.testonly_set_page_token("t2");
+        return response;
+      })
+      .WillOnce([](Options const& options, Request const& request) {
+        EXPECT_EQ(options.get<StringOption>(), "PrefetchPages");
+        EXPECT_EQ("t2", request.testonly_page_token);
+        ResponseType response;
+        response.testonly_items.push_back(Item{"p3"});
+        return response;
+      });
+
+  auto range = MakePaginationRange<ItemRange>(
+      MakeImmutableOptions(Options{}
+                               .set<StringOption>("PrefetchPages")
+                               .set<PagePrefetchDepthOption>(2)),
+      Request{},
+      [&mock](Options const& o, Request const& r) { return mock.Loader(o, r); },
+      [](ResponseType const& r) { return r.testonly_items; });
+  OptionsSpan overlay(Options{}.set<StringOption>("uh-oh"));
+  std::vector<std::string> names;
+  for (auto& p : range) {
+    if (!p) break;
+    names.push_back(p->data);
+  }
+  EXPECT_THAT(names, ElementsAre("p1", "p2", "p3"));
+}
+
+TYPED_TEST(PaginationRangeTest, PrefetchPagesWithError) {
+  using ResponseType = TypeParam;
+  MockRpcExplicit<ResponseType> mock;
+  EXPECT_CALL(mock, Loader)
+      .WillOnce([](Options const&, Request const& request) {
+        EXPECT_TRUE(request.testonly_page_token.empty());
+        ResponseType response;
+        response.testonly_set_page_token("t1");
+        response.testonly_items.push_back(Item{"p1"});
+        return response;
+      })
+      .WillOnce([](Options const&, Request const& request) {
+        EXPECT_EQ("t1", request.testonly_page_token);
+        return Status(StatusCode::kAborted, "bad-luck");
+      });
+
+  auto range = MakePaginationRange<ItemRange>(
+      MakeImmutableOptions(Options{}.set<PagePrefetchDepthOption>(1)),
+      Request{},
+      [&mock](Options const& o, Request const& r) { return mock.Loader(o, r); },
+      [](ResponseType const& r) { return r.testonly_items; });
+  std::vector<std::string> names;
+  for (auto& p : range) {
+    if (!p) {
+      EXPECT_THAT(p, StatusIs(StatusCode::kAborted, HasSubstr("bad-luck")));
+      break;
+    }
+    names.push_back(p->data);
+  }
+  EXPECT_THAT(names, ElementsAre("p1"));
+}
+
+TYPED_TEST(PaginationRangeTest, PrefetchStopsOnDestruction) {
+  using ResponseType = TypeParam;
+  MockRpcExplicit<ResponseType> mock;
+  // With a depth of 1 the second page may be loaded while the application
+  // consumes the first one, but no other pages.
+  EXPECT_CALL(mock, Loader)
+      .Times(::testing::Between(1, 2))
+      .WillRepeatedly([](Options const&, Request const& request) {
+        EXPECT_NE("t2", request.testonly_page_token);
+        ResponseType response;
+        response.testonly_set_page_token(
+            request.testonly_page_token.empty() ? "t1" : "t2");
+        response.testonly_items.push_back(Item{"p1"});
+        return response;
+      });
+
+  auto range = MakePaginationRange<ItemRange>(
+      MakeImmutableOptions(Options{}.set<PagePrefetchDepthOption>(1)),
+      Request{},
+      [&mock](Options const& o, Request const& r) { return mock.Loader(o, r); },
+      [](ResponseType const& r) { return r.testonly_items; });
+  auto i = range.begin();
+  ASSERT_NE(i, range.end());
+  EXPECT_THAT(*i, StatusIs(StatusCode::kOk));
+}
+
 TEST(RangeFromPagination, MakeUnimplemented) {
   using NonProtoRange = PaginationRange<std::string>;
   auto range = MakeUnimplementedPaginationRange<NonProtoRange>();
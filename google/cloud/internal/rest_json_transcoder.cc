@@ -0,0 +1,1031 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/internal/rest_json_transcoder.h"
+#include "absl/strings/ascii.h"
+#include "absl/strings/escaping.h"
+#include "absl/strings/numbers.h"
+#include "absl/strings/str_cat.h"
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/descriptor.pb.h>
+#include <google/protobuf/timestamp.pb.h>
+#include <google/protobuf/util/time_util.h>
+#include <nlohmann/json.hpp>
+#include <cfloat>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace google {
+namespace cloud {
+namespace rest_internal {
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_BEGIN
+namespace {
+
+using ::google::protobuf::Descriptor;
+using ::google::protobuf::DescriptorPool;
+using ::google::protobuf::FieldDescriptor;
+using ::google::protobuf::Message;
+
+// The valid ranges for `google.protobuf.Timestamp` and `Duration`.
+auto constexpr kTimestampMinSeconds = -62135596800LL;
+auto constexpr kTimestampMaxSeconds = 253402300799LL;
+auto constexpr kDurationMaxSeconds = 315576000000LL;
+auto constexpr kNanosPerSecond = 1000000000;
+
+// Integers in this range can be converted to `double` (or `float`) without
+// any rounding. Larger values are left to the protobuf library.
+auto constexpr kMaxExactDouble = std::int64_t{1} << 53;
+auto constexpr kMaxExactFloat = std::int64_t{1} << 24;
+
+enum class Kind {
+  kInt32,
+  kInt64,
+  kUInt32,
+  kUInt64,
+  kDouble,
+  kFloat,
+  kBool,
+  kString,
+  kBytes,
+  kEnum,
+  kMessage,
+  kMap,
+  kTimestamp,
+  kDuration,
+  kWrapper,
+  kUnsupported,
+};
+
+struct MessageInfo;
+
+struct FieldInfo {
+  FieldDescriptor const* descriptor;
+  Kind kind;
+  bool repeated;
+  // The type of message, map entry, and wrapper fields.
+  MessageInfo const* message;
+  // The quoted and escaped keys used by the printer, including the trailing
+  // `:`. Empty if the name cannot be printed by the fast path.
+  std::string json_key;
+  std::string proto_key;
+};
+
+/**
+ * The field lookup tables for a message type.
+ *
+ * `fields` is indexed by `FieldDescriptor::index()`. For map entries the key
+ * and value are always `fields[0]` and `fields[1]`, and for the wrapper
+ * types the value is `fields[0]`.
+ */
+struct MessageInfo {
+  Descriptor const* descriptor = nullptr;
+  Kind kind = Kind::kMessage;
+  bool supported = true;
+  std::vector<FieldInfo> fields;
+  std::unordered_map<std::string, FieldInfo const*> by_name;
+};
+
+// Appends @p s as a JSON string, using the same escapes as the protobuf
+// library. The escaping rules for non-ASCII characters changed across protobuf
+// versions, we only handle ASCII strings.
+bool AppendJsonString(std::string& out, absl::string_view s) {
+  out += '"';
+  auto const* run = s.data();
+  auto const* const end = s.data() + s.size();
+  for (auto const* p = run; p != end; ++p) {
+    auto const u = static_cast<unsigned char>(*p);
+    if (u >= 0x80) return false;
+    char const* escaped;
+    switch (*p) {
+      case '"':
+        escaped = "\\\"";
+        break;
+      case '\\':
+        escaped = "\\\\";
+        break;
+      case '\b':
+        escaped = "\\b";
+        break;
+      case '\f':
+        escaped = "\\f";
+        break;
+      case '\n':
+        escaped = "\\n";
+        break;
+      case '\r':
+        escaped = "\\r";
+        break;
+      case '\t':
+        escaped = "\\t";
+        break;
+      case '<':
+        escaped = "\\u003c";
+        break;
+      case '>':
+        escaped = "\\u003e";
+        break;
+      default:
+        if (u >= 0x20 && u != 0x7f) continue;
+        escaped = nullptr;
+        break;
+    }
+    // Copy the characters that need no escaping in a single call.
+    out.append(run, p);
+    run = p + 1;
+    if (escaped != nullptr) {
+      out += escaped;
+      continue;
+    }
+    char buf[8];
+    std::snprintf(buf, sizeof(buf), "\\u%04x", u);
+    out += buf;
+  }
+  out.append(run, end);
+  out += '"';
+  return true;
+}
+
+std::string JsonKey(absl::string_view name) {
+  std::string key;
+  if (!AppendJsonString(key, name)) return {};
+  key += ':';
+  return key;
+}
+
+using InfoMap =
+    std::unordered_map<Descriptor const*, std::unique_ptr<MessageInfo>>;
+
+Kind MessageKind(Descriptor const* d) {
+  auto const& name = d->full_name();
+  if (name.rfind("google.protobuf.", 0) != 0) return Kind::kMessage;
+  if (name == "google.protobuf.Timestamp") return Kind::kTimestamp;
+  if (name == "google.protobuf.Duration") return Kind::kDuration;
+  if (name == "google.protobuf.DoubleValue" ||
+      name == "google.protobuf.FloatValue" ||
+      name == "google.protobuf.Int64Value" ||
+      name == "google.protobuf.UInt64Value" ||
+      name == "google.protobuf.Int32Value" ||
+      name == "google.protobuf.UInt32Value" ||
+      name == "google.protobuf.BoolValue" ||
+      name == "google.protobuf.StringValue" ||
+      name == "google.protobuf.BytesValue") {
+    return Kind::kWrapper;
+  }
+  // These have special JSON representations that we do not handle.
+  if (name == "google.protobuf.Any" || name == "google.protobuf.Struct" ||
+      name == "google.protobuf.Value" || name == "google.protobuf.ListValue" ||
+      name == "google.protobuf.FieldMask") {
+    return Kind::kUnsupported;
+  }
+  return Kind::kMessage;
+}
+
+Kind FieldKind(FieldDescriptor const* fd) {
+  switch (fd->type()) {
+    case FieldDescriptor::TYPE_INT32:
+    case FieldDescriptor::TYPE_SINT32:
+    case FieldDescriptor::TYPE_SFIXED32:
+      return Kind::kInt32;
+    case FieldDescriptor::TYPE_INT64:
+    case FieldDescriptor::TYPE_SINT64:
+    case FieldDescriptor::TYPE_SFIXED64:
+      return Kind::kInt64;
+    case FieldDescriptor::TYPE_UINT32:
+    case FieldDescriptor::TYPE_FIXED32:
+      return Kind::kUInt32;
+    case FieldDescriptor::TYPE_UINT64:
+    case FieldDescriptor::TYPE_FIXED64:
+      return Kind::kUInt64;
+    case FieldDescriptor::TYPE_DOUBLE:
+      return Kind::kDouble;
+    case FieldDescriptor::TYPE_FLOAT:
+      return Kind::kFloat;
+    case FieldDescriptor::TYPE_BOOL:
+      return Kind::kBool;
+    case FieldDescriptor::TYPE_STRING:
+      return Kind::kString;
+    case FieldDescriptor::TYPE_BYTES:
+      return Kind::kBytes;
+    case FieldDescriptor::TYPE_ENUM:
+      if (fd->enum_type()->full_name() == "google.protobuf.NullValue") {
+        return Kind::kUnsupported;
+      }
+      return Kind::kEnum;
+    case FieldDescriptor::TYPE_MESSAGE:
+      if (fd->is_map()) return Kind::kMap;
+      return MessageKind(fd->message_type());
+    case FieldDescriptor::TYPE_GROUP:
+      return Kind::kUnsupported;
+  }
+  return Kind::kUnsupported;
+}
+
+// Creates the `MessageInfo` for `root`, and for any message types reachable
+// from it, unless they are already in `infos`.
+MessageInfo const* BuildInfo(Descriptor const* root, InfoMap& infos) {
+  auto l = infos.find(root);
+  if (l != infos.end()) return l->second.get();
+
+  std::vector<MessageInfo*> created;
+  auto get = [&](Descriptor const* d) {
+    auto& p = infos[d];
+    if (!p) {
+      p = std::make_unique<MessageInfo>();
+      p->descriptor = d;
+      p->kind = MessageKind(d);
+      created.push_back(p.get());
+    }
+    return p.get();
+  };
+  get(root);
+  // `created` grows while we iterate, use indices.
+  for (std::size_t i = 0; i != created.size(); ++i) {
+    auto* info = created[i];
+    auto const* d = info->descriptor;
+    if (info->kind == Kind::kUnsupported) info->supported = false;
+    info->fields.reserve(d->field_count());
+    for (int f = 0; f != d->field_count(); ++f) {
+      auto const* fd = d->field(f);
+      auto const kind = FieldKind(fd);
+      if (kind == Kind::kUnsupported) info->supported = false;
+      MessageInfo const* message = nullptr;
+      if (fd->type() == FieldDescriptor::TYPE_MESSAGE &&
+          kind != Kind::kUnsupported) {
+        message = get(fd->message_type());
+      }
+      info->fields.push_back(FieldInfo{fd, kind, fd->is_repeated(), message,
+                                       JsonKey(fd->json_name()),
+                                       JsonKey(fd->name())});
+    }
+    auto const& fields = info->fields;
+    if (d->options().map_entry() &&
+        (fields.size() != 2 || fields[0].descriptor->number() != 1 ||
+         fields[1].descriptor->number() != 2)) {
+      info->supported = false;
+    }
+    if (info->kind == Kind::kWrapper &&
+        (fields.size() != 1 || fields[0].descriptor->number() != 1)) {
+      info->supported = false;
+    }
+    for (auto const& fi : fields) {
+      info->by_name.emplace(fi.descriptor->json_name(), &fi);
+      info->by_name.emplace(fi.descriptor->name(), &fi);
+    }
+  }
+  // A message is only supported if all the messages it references are. The
+  // type graph may contain cycles, iterate until there are no changes.
+  for (bool changed = true; changed;) {
+    changed = false;
+    for (auto* info : created) {
+      if (!info->supported) continue;
+      for (auto const& fi : info->fields) {
+        if (fi.message == nullptr || fi.message->supported) continue;
+        info->supported = false;
+        changed = true;
+        break;
+      }
+    }
+  }
+  return infos[root].get();
+}
+
+struct InfoCache {
+  std::mutex mu;
+  InfoMap infos;
+};
+
+InfoCache& GeneratedPoolCache() {
+  static auto* const kCache = new InfoCache;
+  return *kCache;
+}
+
+// Descriptors in the generated pool live until the program exits, so their
+// tables can be cached. Descriptors in other pools may be released (and their
+// addresses reused) at any time, we build their tables for each call.
+MessageInfo const* LookupInfo(Descriptor const* d, InfoMap& local) {
+  if (d->file()->pool() != DescriptorPool::generated_pool()) {
+    return BuildInfo(d, local);
+  }
+  auto& cache = GeneratedPoolCache();
+  std::lock_guard<std::mutex> lk(cache.mu);
+  return BuildInfo(d, cache.infos);
+}
+
+bool IsDecimal(absl::string_view s) {
+  if (!s.empty() && s.front() == '-') s.remove_prefix(1);
+  if (s.empty()) return false;
+  for (auto c : s) {
+    if (!absl::ascii_isdigit(static_cast<unsigned char>(c))) return false;
+  }
+  return true;
+}
+
+// Parses `-?[0-9]+(\.[0-9]{1,9})?s`, the protobuf JSON format for durations.
+bool ParseDuration(absl::string_view s, std::int64_t& seconds,
+                   std::int32_t& nanos) {
+  if (s.empty() || s.back() != 's') return false;
+  s.remove_suffix(1);
+  bool const negative = !s.empty() && s.front() == '-';
+  if (negative) s.remove_prefix(1);
+  auto const dot = s.find('.');
+  auto const whole = s.substr(0, dot);
+  auto frac = dot == absl::string_view::npos ? absl::string_view{}
+                                             : s.substr(dot + 1);
+  if (dot != absl::string_view::npos && (frac.empty() || frac.size() > 9)) {
+    return false;
+  }
+  if (!IsDecimal(whole) || whole.front() == '-') return false;
+  if (!frac.empty() && (!IsDecimal(frac) || frac.front() == '-')) return false;
+  std::uint64_t secs;
+  if (!absl::SimpleAtoi(whole, &secs) || secs > kDurationMaxSeconds) {
+    return false;
+  }
+  std::int32_t n = 0;
+  if (!frac.empty()) {
+    if (!absl::SimpleAtoi(frac, &n)) return false;
+    for (auto i = frac.size(); i != 9; ++i) n *= 10;
+  }
+  seconds = negative ? -static_cast<std::int64_t>(secs)
+                     : static_cast<std::int64_t>(secs);
+  nanos = negative ? -n : n;
+  return true;
+}
+
+// The formatting for fractional seconds in timestamps and durations.
+void AppendNanos(std::string& out, std::int32_t nanos) {
+  if (nanos == 0) return;
+  char buf[16];
+  if (nanos % 1000000 == 0) {
+    std::snprintf(buf, sizeof(buf), ".%03d", nanos / 1000000);
+  } else if (nanos % 1000 == 0) {
+    std::snprintf(buf, sizeof(buf), ".%06d", nanos / 1000);
+  } else {
+    std::snprintf(buf, sizeof(buf), ".%09d", nanos);
+  }
+  out += buf;
+}
+
+// Where a JSON value is stored: a field in a message. Values for repeated
+// fields are appended.
+struct Target {
+  Message* message;
+  FieldInfo const* field;
+};
+
+bool SetTimestamp(Message* m, FieldInfo const& fi, std::string const& value) {
+  google::protobuf::Timestamp ts;
+  if (!google::protobuf::util::TimeUtil::FromString(value, &ts)) return false;
+  auto const* r = m->GetReflection();
+  auto* sub = fi.repeated ? r->AddMessage(m, fi.descriptor)
+                          : r->MutableMessage(m, fi.descriptor);
+  auto const* d = sub->GetDescriptor();
+  auto const* sr = sub->GetReflection();
+  sr->SetInt64(sub, d->FindFieldByNumber(1), ts.seconds());
+  sr->SetInt32(sub, d->FindFieldByNumber(2), ts.nanos());
+  return true;
+}
+
+bool SetDuration(Message* m, FieldInfo const& fi, std::string const& value) {
+  std::int64_t seconds;
+  std::int32_t nanos;
+  if (!ParseDuration(value, seconds, nanos)) return false;
+  auto const* r = m->GetReflection();
+  auto* sub = fi.repeated ? r->AddMessage(m, fi.descriptor)
+                          : r->MutableMessage(m, fi.descriptor);
+  auto const* d = sub->GetDescriptor();
+  auto const* sr = sub->GetReflection();
+  sr->SetInt64(sub, d->FindFieldByNumber(1), seconds);
+  sr->SetInt32(sub, d->FindFieldByNumber(2), nanos);
+  return true;
+}
+
+// Returns the target for the value of a wrapper field.
+Target WrapperValue(Target t) {
+  auto const* r = t.message->GetReflection();
+  auto const* fd = t.field->descriptor;
+  auto* sub = t.field->repeated ? r->AddMessage(t.message, fd)
+                                : r->MutableMessage(t.message, fd);
+  return Target{sub, &t.field->message->fields[0]};
+}
+
+#define GOOGLE_CLOUD_CPP_SET_FIELD(Type, t, v)                              \
+  do {                                                                      \
+    auto const* r = (t).message->GetReflection();                           \
+    if ((t).field->repeated) {                                              \
+      r->Add##Type((t).message, (t).field->descriptor, (v));                \
+    } else {                                                                \
+      r->Set##Type((t).message, (t).field->descriptor, (v));                \
+    }                                                                       \
+  } while (false)
+
+bool SetEnum(Target const& t, int number) {
+  if (t.field->descriptor->enum_type()->FindValueByNumber(number) == nullptr) {
+    return false;
+  }
+  GOOGLE_CLOUD_CPP_SET_FIELD(EnumValue, t, number);
+  return true;
+}
+
+// Sets the value for JSON numbers that fit in a `std::int64_t`.
+bool SetSigned(Target const& t, std::int64_t v) {
+  switch (t.field->kind) {
+    case Kind::kInt32:
+      if (v < std::numeric_limits<std::int32_t>::min() ||
+          v > std::numeric_limits<std::int32_t>::max()) {
+        return false;
+      }
+      GOOGLE_CLOUD_CPP_SET_FIELD(Int32, t, static_cast<std::int32_t>(v));
+      return true;
+    case Kind::kInt64:
+      GOOGLE_CLOUD_CPP_SET_FIELD(Int64, t, v);
+      return true;
+    case Kind::kUInt32:
+      if (v < 0 || v > std::numeric_limits<std::uint32_t>::max()) return false;
+      GOOGLE_CLOUD_CPP_SET_FIELD(UInt32, t, static_cast<std::uint32_t>(v));
+      return true;
+    case Kind::kUInt64:
+      if (v < 0) return false;
+      GOOGLE_CLOUD_CPP_SET_FIELD(UInt64, t, static_cast<std::uint64_t>(v));
+      return true;
+    case Kind::kDouble:
+      if (v < -kMaxExactDouble || v > kMaxExactDouble) return false;
+      GOOGLE_CLOUD_CPP_SET_FIELD(Double, t, static_cast<double>(v));
+      return true;
+    case Kind::kFloat:
+      if (v < -kMaxExactFloat || v > kMaxExactFloat) return false;
+      GOOGLE_CLOUD_CPP_SET_FIELD(Float, t, static_cast<float>(v));
+      return true;
+    case Kind::kEnum:
+      if (v < std::numeric_limits<std::int32_t>::min() ||
+          v > std::numeric_limits<std::int32_t>::max()) {
+        return false;
+      }
+      return SetEnum(t, static_cast<int>(v));
+    case Kind::kWrapper:
+      return SetSigned(WrapperValue(t), v);
+    default:
+      break;
+  }
+  return false;
+}
+
+bool SetUnsigned(Target const& t, std::uint64_t v) {
+  if (t.field->kind == Kind::kUInt64) {
+    GOOGLE_CLOUD_CPP_SET_FIELD(UInt64, t, v);
+    return true;
+  }
+  if (t.field->kind == Kind::kWrapper) return SetUnsigned(WrapperValue(t), v);
+  auto constexpr kMax = std::numeric_limits<std::int64_t>::max();
+  if (v > static_cast<std::uint64_t>(kMax)) return false;
+  return SetSigned(t, static_cast<std::int64_t>(v));
+}
+
+bool SetFloatingPoint(Target const& t, double v) {
+  switch (t.field->kind) {
+    case Kind::kDouble:
+      GOOGLE_CLOUD_CPP_SET_FIELD(Double, t, v);
+      return true;
+    case Kind::kFloat:
+      if (std::isfinite(v) && std::abs(v) > FLT_MAX) return false;
+      GOOGLE_CLOUD_CPP_SET_FIELD(Float, t, static_cast<float>(v));
+      return true;
+    case Kind::kInt32:
+    case Kind::kInt64:
+    case Kind::kUInt32:
+    case Kind::kUInt64:
+      // Integral values in floating point notation, e.g. `1.0` or `1e3`.
+      if (!std::isfinite(v) || std::trunc(v) != v ||
+          std::abs(v) > static_cast<double>(kMaxExactDouble)) {
+        return false;
+      }
+      return SetSigned(t, static_cast<std::int64_t>(v));
+    case Kind::kWrapper:
+      return SetFloatingPoint(WrapperValue(t), v);
+    default:
+      break;
+  }
+  return false;
+}
+
+bool SetBool(Target const& t, bool v) {
+  if (t.field->kind == Kind::kWrapper) return SetBool(WrapperValue(t), v);
+  if (t.field->kind != Kind::kBool) return false;
+  GOOGLE_CLOUD_CPP_SET_FIELD(Bool, t, v);
+  return true;
+}
+
+bool SetString(Target const& t, std::string& v) {
+  switch (t.field->kind) {
+    case Kind::kString:
+      GOOGLE_CLOUD_CPP_SET_FIELD(String, t, std::move(v));
+      return true;
+    case Kind::kBytes: {
+      std::string bytes;
+      auto const web_safe = v.find_first_of("-_") != std::string::npos;
+      auto const ok = web_safe ? absl::WebSafeBase64Unescape(v, &bytes)
+                               : absl::Base64Unescape(v, &bytes);
+      if (!ok) return false;
+      GOOGLE_CLOUD_CPP_SET_FIELD(String, t, std::move(bytes));
+      return true;
+    }
+    case Kind::kInt32:
+    case Kind::kInt64:
+    case Kind::kUInt32:
+    case Kind::kUInt64: {
+      // Integers in quotes, this is how 64-bit integers are formatted.
+      if (!IsDecimal(v)) return false;
+      if (v.front() == '-') {
+        std::int64_t n;
+        if (!absl::SimpleAtoi(v, &n)) return false;
+        return SetSigned(t, n);
+      }
+      std::uint64_t n;
+      if (!absl::SimpleAtoi(v, &n)) return false;
+      return SetUnsigned(t, n);
+    }
+    case Kind::kDouble:
+    case Kind::kFloat:
+      if (v == "NaN") {
+        return SetFloatingPoint(t, std::numeric_limits<double>::quiet_NaN());
+      }
+      if (v == "Infinity") {
+        return SetFloatingPoint(t, std::numeric_limits<double>::infinity());
+      }
+      if (v == "-Infinity") {
+        return SetFloatingPoint(t, -std::numeric_limits<double>::infinity());
+      }
+      return false;
+    case Kind::kEnum: {
+      auto const* e = t.field->descriptor->enum_type()->FindValueByName(v);
+      if (e == nullptr) return false;
+      GOOGLE_CLOUD_CPP_SET_FIELD(EnumValue, t, e->number());
+      return true;
+    }
+    case Kind::kTimestamp:
+      return SetTimestamp(t.message, *t.field, v);
+    case Kind::kDuration:
+      return SetDuration(t.message, *t.field, v);
+    case Kind::kWrapper:
+      return SetString(WrapperValue(t), v);
+    default:
+      break;
+  }
+  return false;
+}
+
+#undef GOOGLE_CLOUD_CPP_SET_FIELD
+
+/**
+ * Streams a JSON document into a protobuf message.
+ *
+ * Any input that is not obviously valid makes the handler stop, and the
+ * caller falls back to the protobuf JSON utilities.
+ */
+class ParseHandler : public nlohmann::json_sax<nlohmann::json> {
+ public:
+  ParseHandler(Message& root, MessageInfo const& info)
+      : root_(root), root_info_(info) {}
+
+  bool done() const { return done_; }
+
+  bool null() override {
+    if (skip_depth_ > 0 || stack_.empty()) return skip_depth_ > 0;
+    auto& top = stack_.back();
+    if (top.type != Frame::kObject) return false;
+    // `null` leaves singular fields unset.
+    return top.field == nullptr || !top.field->repeated;
+  }
+  bool boolean(bool val) override {
+    return OnScalar([val](Target const& t) { return SetBool(t, val); });
+  }
+  bool number_integer(number_integer_t val) override {
+    // The parser reports non-negative integers as `number_unsigned()`, so
+    // zero here is `-0`. Versions of protobuf disagree on how to parse it
+    // into floating point fields, let the library handle it.
+    if (val == 0) return false;
+    return OnScalar([val](Target const& t) { return SetSigned(t, val); });
+  }
+  bool number_unsigned(number_unsigned_t val) override {
+    return OnScalar([val](Target const& t) { return SetUnsigned(t, val); });
+  }
+  bool number_float(number_float_t val, string_t const&) override {
+    return OnScalar(
+        [val](Target const& t) { return SetFloatingPoint(t, val); });
+  }
+  bool string(string_t& val) override {
+    return OnScalar([&val](Target const& t) { return SetString(t, val); });
+  }
+  bool binary(binary_t&) override { return false; }
+
+  bool start_object(std::size_t) override {
+    if (skip_depth_ > 0) {
+      ++skip_depth_;
+      return true;
+    }
+    if (stack_.empty()) {
+      if (done_) return false;
+      stack_.push_back(Frame{Frame::kObject, &root_, &root_info_, nullptr});
+      return true;
+    }
+    auto& top = stack_.back();
+    if (top.type == Frame::kObject && top.field == nullptr) {
+      skip_depth_ = 1;
+      return true;
+    }
+    auto const t = CurrentTarget();
+    auto const& fi = *t.field;
+    auto const* r = t.message->GetReflection();
+    if (top.type == Frame::kObject && fi.kind == Kind::kMap) {
+      stack_.push_back(Frame{Frame::kMap, t.message, fi.message, &fi});
+      return true;
+    }
+    if (fi.kind != Kind::kMessage) return false;
+    if (fi.repeated != (top.type == Frame::kArray)) return false;
+    auto* child = fi.repeated ? r->AddMessage(t.message, fi.descriptor)
+                              : r->MutableMessage(t.message, fi.descriptor);
+    stack_.push_back(Frame{Frame::kObject, child, fi.message, nullptr});
+    return true;
+  }
+
+  bool key(string_t& val) override {
+    if (skip_depth_ > 0) return true;
+    auto& top = stack_.back();
+    if (top.type == Frame::kMap) return MapKey(top, val);
+    // Extensions use `[full.name]` keys, leave them to the protobuf library.
+    if (!val.empty() && val.front() == '[') return false;
+    auto l = top.info->by_name.find(val);
+    top.field = l == top.info->by_name.end() ? nullptr : l->second;
+    if (top.field == nullptr) return true;
+    auto const* oneof = top.field->descriptor->containing_oneof();
+    if (oneof == nullptr) return true;
+    // Setting two fields in the same oneof is an error in newer versions of
+    // protobuf, let the library decide.
+    auto const* r = top.message->GetReflection();
+    auto const* current = r->GetOneofFieldDescriptor(*top.message, oneof);
+    return current == nullptr || current == top.field->descriptor;
+  }
+
+  bool end_object() override { return OnEnd(); }
+
+  bool start_array(std::size_t) override {
+    if (skip_depth_ > 0) {
+      ++skip_depth_;
+      return true;
+    }
+    if (stack_.empty()) return false;
+    auto& top = stack_.back();
+    if (top.type != Frame::kObject) return false;
+    if (top.field == nullptr) {
+      skip_depth_ = 1;
+      return true;
+    }
+    if (!top.field->repeated || top.field->kind == Kind::kMap) return false;
+    stack_.push_back(Frame{Frame::kArray, top.message, top.info, top.field});
+    return true;
+  }
+
+  bool end_array() override { return OnEnd(); }
+
+  bool parse_error(std::size_t, std::string const&,
+                   nlohmann::detail::exception const&) override {
+    return false;
+  }
+
+ private:
+  struct Frame {
+    enum Type { kObject, kArray, kMap } type;
+    // For objects, the message being parsed. For arrays and maps, the message
+    // containing the repeated (or map) field.
+    Message* message;
+    MessageInfo const* info;
+    // For objects, the field named by the last key (if known). For arrays and
+    // maps, the repeated (or map) field.
+    FieldInfo const* field;
+    // For maps, the entry created by the last key.
+    Message* entry = nullptr;
+  };
+
+  Target CurrentTarget() const {
+    auto const& top = stack_.back();
+    if (top.type == Frame::kMap) {
+      return Target{top.entry, &top.field->message->fields[1]};
+    }
+    return Target{top.message, top.field};
+  }
+
+  template <typename Setter>
+  bool OnScalar(Setter const& setter) {
+    if (skip_depth_ > 0) return true;
+    if (stack_.empty()) return false;
+    auto const& top = stack_.back();
+    if (top.type == Frame::kObject) {
+      if (top.field == nullptr) return true;
+      if (top.field->repeated) return false;
+    }
+    return setter(CurrentTarget());
+  }
+
+  bool MapKey(Frame& top, std::string& key) {
+    auto const* r = top.message->GetReflection();
+    top.entry = r->AddMessage(top.message, top.field->descriptor);
+    auto const& kf = top.field->message->fields[0];
+    if (kf.kind == Kind::kBool) {
+      if (key != "true" && key != "false") return false;
+      return SetBool(Target{top.entry, &kf}, key == "true");
+    }
+    if (kf.kind == Kind::kString) return SetString(Target{top.entry, &kf}, key);
+    if (!IsDecimal(key)) return false;
+    return SetString(Target{top.entry, &kf}, key);
+  }
+
+  bool OnEnd() {
+    if (skip_depth_ > 0) {
+      --skip_depth_;
+      return true;
+    }
+    stack_.pop_back();
+    if (stack_.empty()) done_ = true;
+    return true;
+  }
+
+  Message& root_;
+  MessageInfo const& root_info_;
+  std::vector<Frame> stack_;
+  int skip_depth_ = 0;
+  bool done_ = false;
+};
+
+class Printer {
+ public:
+  explicit Printer(bool preserve_proto_field_names)
+      : preserve_proto_field_names_(preserve_proto_field_names) {}
+
+  std::string& output() { return out_; }
+
+  bool WriteMessage(Message const& m, MessageInfo const& info) {
+    auto const* r = m.GetReflection();
+    std::vector<FieldDescriptor const*> fields;
+    r->ListFields(m, &fields);
+    out_ += '{';
+    char const* sep = "";
+    for (auto const* fd : fields) {
+      if (fd->is_extension()) return false;
+      auto const& fi = info.fields[fd->index()];
+      auto const& key =
+          preserve_proto_field_names_ ? fi.proto_key : fi.json_key;
+      if (key.empty()) return false;
+      out_ += sep;
+      sep = ",";
+      out_ += key;
+      if (fi.kind == Kind::kMap) {
+        if (!WriteMap(m, fi)) return false;
+        continue;
+      }
+      if (!fi.repeated) {
+        if (!WriteValue(m, fi, -1)) return false;
+        continue;
+      }
+      out_ += '[';
+      auto const size = r->FieldSize(m, fd);
+      for (int i = 0; i != size; ++i) {
+        if (i != 0) out_ += ',';
+        if (!WriteValue(m, fi, i)) return false;
+      }
+      out_ += ']';
+    }
+    out_ += '}';
+    return true;
+  }
+
+ private:
+  bool WriteMap(Message const& m, FieldInfo const& fi) {
+    auto const* r = m.GetReflection();
+    auto const& kf = fi.message->fields[0];
+    auto const& vf = fi.message->fields[1];
+    out_ += '{';
+    auto const size = r->FieldSize(m, fi.descriptor);
+    for (int i = 0; i != size; ++i) {
+      if (i != 0) out_ += ',';
+      auto const& entry = r->GetRepeatedMessage(m, fi.descriptor, i);
+      // Map keys are always strings in JSON.
+      if (kf.kind == Kind::kString) {
+        if (!WriteValue(entry, kf, -1)) return false;
+      } else {
+        out_ += '"';
+        if (!WriteValue(entry, kf, -1)) return false;
+        out_ += '"';
+      }
+      out_ += ':';
+      if (!WriteValue(entry, vf, -1)) return false;
+    }
+    out_ += '}';
+    return true;
+  }
+
+  // Writes a single value of the field, @p index is `-1` for singular fields.
+  bool WriteValue(Message const& m, FieldInfo const& fi, int index) {
+    auto const* r = m.GetReflection();
+    auto const* fd = fi.descriptor;
+    auto const repeated = index >= 0;
+    switch (fi.kind) {
+      case Kind::kInt32:
+        absl::StrAppend(&out_, repeated ? r->GetRepeatedInt32(m, fd, index)
+                                        : r->GetInt32(m, fd));
+        return true;
+      case Kind::kInt64:
+        absl::StrAppend(&out_, "\"",
+                        repeated ? r->GetRepeatedInt64(m, fd, index)
+                                 : r->GetInt64(m, fd),
+                        "\"");
+        return true;
+      case Kind::kUInt32:
+        absl::StrAppend(&out_, repeated ? r->GetRepeatedUInt32(m, fd, index)
+                                        : r->GetUInt32(m, fd));
+        return true;
+      case Kind::kUInt64:
+        absl::StrAppend(&out_, "\"",
+                        repeated ? r->GetRepeatedUInt64(m, fd, index)
+                                 : r->GetUInt64(m, fd),
+                        "\"");
+        return true;
+      case Kind::kDouble:
+        WriteDouble(repeated ? r->GetRepeatedDouble(m, fd, index)
+                             : r->GetDouble(m, fd));
+        return true;
+      case Kind::kFloat:
+        WriteFloat(repeated ? r->GetRepeatedFloat(m, fd, index)
+                            : r->GetFloat(m, fd));
+        return true;
+      case Kind::kBool: {
+        auto const value =
+            repeated ? r->GetRepeatedBool(m, fd, index) : r->GetBool(m, fd);
+        out_ += value ? "true" : "false";
+        return true;
+      }
+      case Kind::kString: {
+        std::string scratch;
+        auto const& value =
+            repeated ? r->GetRepeatedStringReference(m, fd, index, &scratch)
+                     : r->GetStringReference(m, fd, &scratch);
+        return AppendJsonString(out_, value);
+      }
+      case Kind::kBytes: {
+        std::string scratch;
+        auto const& bytes =
+            repeated ? r->GetRepeatedStringReference(m, fd, index, &scratch)
+                     : r->GetStringReference(m, fd, &scratch);
+        absl::StrAppend(&out_, "\"", absl::Base64Escape(bytes), "\"");
+        return true;
+      }
+      case Kind::kEnum: {
+        auto const number = repeated ? r->GetRepeatedEnumValue(m, fd, index)
+                                     : r->GetEnumValue(m, fd);
+        auto const* e = fd->enum_type()->FindValueByNumber(number);
+        if (e == nullptr) {
+          absl::StrAppend(&out_, number);
+          return true;
+        }
+        return AppendJsonString(out_, e->name());
+      }
+      case Kind::kMessage:
+        return WriteMessage(SubMessage(m, fd, index), *fi.message);
+      case Kind::kTimestamp:
+        return WriteTimestamp(SubMessage(m, fd, index));
+      case Kind::kDuration:
+        return WriteDuration(SubMessage(m, fd, index));
+      case Kind::kWrapper:
+        return WriteValue(SubMessage(m, fd, index), fi.message->fields[0], -1);
+      default:
+        break;
+    }
+    return false;
+  }
+
+  static Message const& SubMessage(Message const& m, FieldDescriptor const* fd,
+                                   int index) {
+    auto const* r = m.GetReflection();
+    return index >= 0 ? r->GetRepeatedMessage(m, fd, index)
+                      : r->GetMessage(m, fd);
+  }
+
+  static std::pair<std::int64_t, std::int32_t> SecondsAndNanos(
+      Message const& m) {
+    auto const* d = m.GetDescriptor();
+    auto const* r = m.GetReflection();
+    return {r->GetInt64(m, d->FindFieldByNumber(1)),
+            r->GetInt32(m, d->FindFieldByNumber(2))};
+  }
+
+  bool WriteTimestamp(Message const& m) {
+    auto const v = SecondsAndNanos(m);
+    if (v.first < kTimestampMinSeconds || v.first > kTimestampMaxSeconds ||
+        v.second < 0 || v.second >= kNanosPerSecond) {
+      return false;
+    }
+    google::protobuf::Timestamp ts;
+    ts.set_seconds(v.first);
+    ts.set_nanos(v.second);
+    absl::StrAppend(&out_, "\"",
+                    google::protobuf::util::TimeUtil::ToString(ts), "\"");
+    return true;
+  }
+
+  bool WriteDuration(Message const& m) {
+    auto v = SecondsAndNanos(m);
+    if (v.first < -kDurationMaxSeconds || v.first > kDurationMaxSeconds ||
+        v.second <= -kNanosPerSecond || v.second >= kNanosPerSecond ||
+        (v.first < 0 && v.second > 0) || (v.first > 0 && v.second < 0)) {
+      return false;
+    }
+    out_ += '"';
+    if (v.first < 0 || v.second < 0) {
+      out_ += '-';
+      v.first = -v.first;
+      v.second = -v.second;
+    }
+    absl::StrAppend(&out_, v.first);
+    AppendNanos(out_, v.second);
+    out_ += "s\"";
+    return true;
+  }
+
+  // Use the same formatting as the protobuf library: the shortest of `%.15g`
+  // and `%.17g` that round-trips.
+  void WriteDouble(double v) {
+    if (std::isnan(v)) {
+      out_ += "\"NaN\"";
+      return;
+    }
+    if (std::isinf(v)) {
+      out_ += v > 0 ? "\"Infinity\"" : "\"-Infinity\"";
+      return;
+    }
+    char buf[32];
+    std::snprintf(buf, sizeof(buf), "%.*g", DBL_DIG, v);
+    if (std::strtod(buf, nullptr) != v) {
+      std::snprintf(buf, sizeof(buf), "%.*g", DBL_DIG + 2, v);
+    }
+    out_ += buf;
+  }
+
+  void WriteFloat(float v) {
+    if (!std::isfinite(v)) return WriteDouble(v);
+    char buf[32];
+    std::snprintf(buf, sizeof(buf), "%.*g", FLT_DIG, static_cast<double>(v));
+    if (std::strtof(buf, nullptr) != v) {
+      std::snprintf(buf, sizeof(buf), "%.*g", FLT_DIG + 3,
+                    static_cast<double>(v));
+    }
+    out_ += buf;
+  }
+
+  bool preserve_proto_field_names_;
+  std::string out_;
+};
+
+}  // namespace
+
+bool TryJsonToProto(absl::string_view json,
+                    google::protobuf::Message& destination) {
+  InfoMap local;
+  auto const* info = LookupInfo(destination.GetDescriptor(), local);
+  if (!info->supported || info->kind != Kind::kMessage) return false;
+  ParseHandler handler(destination, *info);
+  auto const ok = nlohmann::json::sax_parse(json.begin(), json.end(), &handler);
+  return ok && handler.done();
+}
+
+absl::optional<std::string> TryProtoToJson(
+    google::protobuf::Message const& message, bool preserve_proto_field_names) {
+  InfoMap local;
+  auto const* info = LookupInfo(message.GetDescriptor(), local);
+  if (!info->supported || info->kind != Kind::kMessage) return absl::nullopt;
+  Printer printer(preserve_proto_field_names);
+  if (!printer.WriteMessage(message, *info)) return absl::nullopt;
+  return std::move(printer.output());
+}
+
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
+}  // namespace rest_internal
+}  // namespace cloud
+}  // namespace google
@@ -0,0 +1,73 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GOOGLE_CLOUD_CPP_GOOGLE_CLOUD_INTERNAL_REST_JSON_TRANSCODER_H
+#define GOOGLE_CLOUD_CPP_GOOGLE_CLOUD_INTERNAL_REST_JSON_TRANSCODER_H
+
+#include "google/cloud/version.h"
+#include "absl/strings/string_view.h"
+#include "absl/types/optional.h"
+#include <google/protobuf/message.h>
+#include <string>
+
+namespace google {
+namespace cloud {
+namespace rest_internal {
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_BEGIN
+
+/**
+ * Parses @p json into @p destination without going through the protobuf
+ * JSON utilities.
+ *
+ * The protobuf JSON utilities transcode the JSON text to the binary wire
+ * format (using a `TypeResolver`), and then parse the binary format. For
+ * large responses, such as the result of Compute or BigQuery list calls, this
+ * is the dominant CPU cost in the REST stubs. This function streams the JSON
+ * text directly into the message, using field lookup tables cached for each
+ * (generated) descriptor.
+ *
+ * The fast path handles regular messages with scalar, enum, bytes, repeated,
+ * map and message fields, as well as `google.protobuf.Timestamp`,
+ * `google.protobuf.Duration`, and the wrapper types. Unknown fields are
+ * ignored. It does not handle `google.protobuf.Any`, `Struct`, `Value`,
+ * `ListValue` or `FieldMask`, proto2 groups, or extensions.
+ *
+ * Returns `false` if the message type or the input is not supported by the
+ * fast path. That includes any input the protobuf JSON utilities would
+ * reject, so the caller can use them to report the error. In this case the
+ * contents of @p destination are unspecified, the caller should clear it.
+ */
+bool TryJsonToProto(absl::string_view json,
+                    google::protobuf::Message& destination);
+
+/**
+ * Formats @p message as JSON without going through the protobuf JSON
+ * utilities.
+ *
+ * The output is identical to `google::protobuf::util::MessageToJsonString()`
+ * with the default options, other than `preserve_proto_field_names`.
+ *
+ * Returns `absl::nullopt` if the message type or its contents are not
+ * supported by the fast path, e.g., strings with non-ASCII characters, where
+ * the escaping rules vary across protobuf versions.
+ */
+absl::optional<std::string> TryProtoToJson(
+    google::protobuf::Message const& message, bool preserve_proto_field_names);
+
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
+}  // namespace rest_internal
+}  // namespace cloud
+}  // namespace google
+
+#endif  // GOOGLE_CLOUD_CPP_GOOGLE_CLOUD_INTERNAL_REST_JSON_TRANSCODER_H
@@ -0,0 +1,122 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/internal/rest_json_transcoder.h"
+#include <benchmark/benchmark.h>
+#include <google/protobuf/any.pb.h>
+#include <google/protobuf/descriptor.pb.h>
+#include <google/protobuf/duration.pb.h>
+#include <google/protobuf/timestamp.pb.h>
+#include <google/protobuf/util/json_util.h>
+#include <google/protobuf/wrappers.pb.h>
+#include <cstdint>
+#include <string>
+
+namespace google {
+namespace cloud {
+namespace rest_internal {
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_BEGIN
+namespace {
+
+// Compare `TryJsonToProto()` and `TryProtoToJson()` against the protobuf JSON
+// utilities. The payload is a large `FileDescriptorSet`, which has a mix of
+// nested messages, repeated fields, enums, and strings, similar to the
+// responses of list RPCs in the REST-based services.
+//
+// Run on (1 X 2100 MHz CPU )
+// CPU Caches:
+//   L1 Data 48 KiB (x1)
+//   L1 Instruction 32 KiB (x1)
+//   L2 Unified 2048 KiB (x1)
+//   L3 Unified 307200 KiB (x1)
+// Load Average: 0.75, 0.60, 0.61
+// -------------------------------------------------------------------------
+// Benchmark                           Time             CPU   Iterations
+// -------------------------------------------------------------------------
+// BM_JsonToProtoLibrary        38586167 ns     36674823 ns           19
+// BM_JsonToProtoTranscoder     16507732 ns     14659368 ns           47
+// BM_ProtoToJsonLibrary        10960959 ns     10686517 ns           61
+// BM_ProtoToJsonTranscoder      9223849 ns      8138948 ns           92
+
+google::protobuf::FileDescriptorSet MakePayload() {
+  google::protobuf::FileDescriptorSet set;
+  for (int i = 0; i != 32; ++i) {
+    google::protobuf::FileDescriptorProto::descriptor()->file()->CopyTo(
+        set.add_file());
+    google::protobuf::Any::descriptor()->file()->CopyTo(set.add_file());
+    google::protobuf::Duration::descriptor()->file()->CopyTo(set.add_file());
+    google::protobuf::Timestamp::descriptor()->file()->CopyTo(set.add_file());
+    google::protobuf::Int64Value::descriptor()->file()->CopyTo(set.add_file());
+  }
+  return set;
+}
+
+std::string MakeJson() {
+  std::string json;
+  (void)google::protobuf::util::MessageToJsonString(MakePayload(), &json);
+  return json;
+}
+
+void BM_JsonToProtoLibrary(benchmark::State& state) {
+  auto const json = MakeJson();
+  google::protobuf::util::JsonParseOptions options;
+  options.ignore_unknown_fields = true;
+  for (auto _ : state) {
+    google::protobuf::FileDescriptorSet set;
+    auto status =
+        google::protobuf::util::JsonStringToMessage(json, &set, options);
+    benchmark::DoNotOptimize(status);
+  }
+  state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() *
+                                                    json.size()));
+}
+BENCHMARK(BM_JsonToProtoLibrary);
+
+void BM_JsonToProtoTranscoder(benchmark::State& state) {
+  auto const json = MakeJson();
+  for (auto _ : state) {
+    google::protobuf::FileDescriptorSet set;
+    auto success = TryJsonToProto(json, set);
+    benchmark::DoNotOptimize(success);
+  }
+  state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() *
+                                                    json.size()));
+}
+BENCHMARK(BM_JsonToProtoTranscoder);
+
+void BM_ProtoToJsonLibrary(benchmark::State& state) {
+  auto const payload = MakePayload();
+  for (auto _ : state) {
+    std::string json;
+    auto status = google::protobuf::util::MessageToJsonString(payload, &json);
+    benchmark::DoNotOptimize(status);
+    benchmark::DoNotOptimize(json);
+  }
+}
+BENCHMARK(BM_ProtoToJsonLibrary);
+
+void BM_ProtoToJsonTranscoder(benchmark::State& state) {
+  auto const payload = MakePayload();
+  for (auto _ : state) {
+    auto json = TryProtoToJson(payload, /*preserve_proto_field_names=*/false);
+    benchmark::DoNotOptimize(json);
+  }
+}
+BENCHMARK(BM_ProtoToJsonTranscoder);
+
+}  // namespace
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
+}  // namespace rest_internal
+}  // namespace cloud
+}  // namespace google
@@ -0,0 +1,573 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/internal/rest_json_transcoder.h"
+#include <google/protobuf/descriptor.pb.h>
+#include <google/protobuf/duration.pb.h>
+#include <google/protobuf/dynamic_message.h>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/io/zero_copy_stream_impl_lite.h>
+#include <google/protobuf/struct.pb.h>
+#include <google/protobuf/text_format.h>
+#include <google/protobuf/timestamp.pb.h>
+#include <google/protobuf/util/json_util.h>
+#include <google/protobuf/wrappers.pb.h>
+#include <gmock/gmock.h>
+#include <algorithm>
+#include <memory>
+#include <string>
+
+namespace google {
+namespace cloud {
+namespace rest_internal {
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_BEGIN
+namespace {
+
+using ::google::protobuf::DescriptorPool;
+using ::google::protobuf::DynamicMessageFactory;
+using ::google::protobuf::FileDescriptorProto;
+using ::google::protobuf::Message;
+using ::testing::Optional;
+
+// A schema exercising all the field types supported by the transcoder. We
+// create it at runtime to avoid adding a dependency on generated test protos.
+auto constexpr kTestSchema = R"pb(
+  name: "transcoder_test.proto"
+  package: "test"
+  syntax: "proto3"
+  dependency: "google/protobuf/duration.proto"
+  dependency: "google/protobuf/struct.proto"
+  dependency: "google/protobuf/timestamp.proto"
+  dependency: "google/protobuf/wrappers.proto"
+  enum_type {
+    name: "Color"
+    value { name: "COLOR_UNSPECIFIED" number: 0 }
+    value { name: "RED" number: 1 }
+    value { name: "GREEN" number: 2 }
+  }
+  message_type {
+    name: "Nested"
+    field { name: "name" number: 1 label: LABEL_OPTIONAL type: TYPE_STRING }
+    field { name: "value" number: 2 label: LABEL_OPTIONAL type: TYPE_INT32 }
+    field {
+      name: "children"
+      number: 3
+      label: LABEL_REPEATED
+      type: TYPE_MESSAGE
+      type_name: ".test.Nested"
+    }
+  }
+  message_type {
+    name: "Sample"
+    field {
+      name: "int32_value"
+      number: 1
+      label: LABEL_OPTIONAL
+      type: TYPE_INT32
+    }
+    field {
+      name: "int64_value"
+      number: 2
+      label: LABEL_OPTIONAL
+      type: TYPE_INT64
+    }
+    field {
+      name: "uint32_value"
+      number: 3
+      label: LABEL_OPTIONAL
+      type: TYPE_UINT32
+    }
+    field {
+      name: "uint64_value"
+      number: 4
+      label: LABEL_OPTIONAL
+      type: TYPE_UINT64
+    }
+    field {
+      name: "double_value"
+      number: 5
+      label: LABEL_OPTIONAL
+      type: TYPE_DOUBLE
+    }
+    field {
+      name: "float_value"
+      number: 6
+      label: LABEL_OPTIONAL
+      type: TYPE_FLOAT
+    }
+    field { name: "bool_value" number: 7 label: LABEL_OPTIONAL type: TYPE_BOOL }
+    field {
+      name: "string_value"
+      number: 8
+      label: LABEL_OPTIONAL
+      type: TYPE_STRING
+    }
+    field {
+      name: "bytes_value"
+      number: 9
+      label: LABEL_OPTIONAL
+      type: TYPE_BYTES
+    }
+    field {
+      name: "color"
+      number: 10
+      label: LABEL_OPTIONAL
+      type: TYPE_ENUM
+      type_name: ".test.Color"
+    }
+    field {
+      name: "nested"
+      number: 11
+      label: LABEL_OPTIONAL
+      type: TYPE_MESSAGE
+      type_name: ".test.Nested"
+    }
+    field {
+      name: "repeated_int64"
+      number: 12
+      label: LABEL_REPEATED
+      type: TYPE_INT64
+    }
+    field {
+      name: "repeated_string"
+      number: 13
+      label: LABEL_REPEATED
+      type: TYPE_STRING
+    }
+    field {
+      name: "repeated_nested"
+      number: 14
+      label: LABEL_REPEATED
+      type: TYPE_MESSAGE
+      type_name: ".test.Nested"
+    }
+    field {
+      name: "string_map"
+      number: 15
+      label: LABEL_REPEATED
+      type: TYPE_MESSAGE
+      type_name: ".test.Sample.StringMapEntry"
+    }
+    field {
+      name: "int_map"
+      number: 16
+      label: LABEL_REPEATED
+      type: TYPE_MESSAGE
+      type_name: ".test.Sample.IntMapEntry"
+    }
+    field {
+      name: "timestamp"
+      number: 17
+      label: LABEL_OPTIONAL
+      type: TYPE_MESSAGE
+      type_name: ".google.protobuf.Timestamp"
+    }
+    field {
+      name: "duration"
+      number: 18
+      label: LABEL_OPTIONAL
+      type: TYPE_MESSAGE
+      type_name: ".google.protobuf.Duration"
+    }
+    field {
+      name: "int64_wrapper"
+      number: 19
+      label: LABEL_OPTIONAL
+      type: TYPE_MESSAGE
+      type_name: ".google.protobuf.Int64Value"
+    }
+    field {
+      name: "string_wrapper"
+      number: 20
+      label: LABEL_OPTIONAL
+      type: TYPE_MESSAGE
+      type_name: ".google.protobuf.StringValue"
+    }
+    field {
+      name: "choice_string"
+      number: 21
+      label: LABEL_OPTIONAL
+      type: TYPE_STRING
+      oneof_index: 0
+    }
+    field {
+      name: "choice_int"
+      number: 22
+      label: LABEL_OPTIONAL
+      type: TYPE_INT32
+      oneof_index: 0
+    }
+    field {
+      name: "optional_int32"
+      number: 23
+      label: LABEL_OPTIONAL
+      type: TYPE_INT32
+      oneof_index: 1
+      proto3_optional: true
+    }
+    field {
+      name: "sint32_value"
+      number: 24
+      label: LABEL_OPTIONAL
+      type: TYPE_SINT32
+    }
+    field {
+      name: "fixed64_value"
+      number: 25
+      label: LABEL_OPTIONAL
+      type: TYPE_FIXED64
+    }
+    field {
+      name: "repeated_color"
+      number: 26
+      label: LABEL_REPEATED
+      type: TYPE_ENUM
+      type_name: ".test.Color"
+    }
+    field {
+      name: "bool_map"
+      number: 27
+      label: LABEL_REPEATED
+      type: TYPE_MESSAGE
+      type_name: ".test.Sample.BoolMapEntry"
+    }
+    field {
+      name: "custom_name"
+      number: 28
+      label: LABEL_OPTIONAL
+      type: TYPE_STRING
+      json_name: "renamed"
+    }
+    field {
+      name: "repeated_timestamp"
+      number: 29
+      label: LABEL_REPEATED
+      type: TYPE_MESSAGE
+      type_name: ".google.protobuf.Timestamp"
+    }
+    field {
+      name: "double_wrapper"
+      number: 30
+      label: LABEL_OPTIONAL
+      type: TYPE_MESSAGE
+      type_name: ".google.protobuf.DoubleValue"
+    }
+    field {
+      name: "recursive"
+      number: 31
+      label: LABEL_OPTIONAL
+      type: TYPE_MESSAGE
+      type_name: ".test.Sample"
+    }
+    field {
+      name: "repeated_double"
+      number: 32
+      label: LABEL_REPEATED
+      type: TYPE_DOUBLE
+    }
+    field {
+      name: "repeated_float"
+      number: 33
+      label: LABEL_REPEATED
+      type: TYPE_FLOAT
+    }
+    nested_type {
+      name: "StringMapEntry"
+      field { name: "key" number: 1 label: LABEL_OPTIONAL type: TYPE_STRING }
+      field { name: "value" number: 2 label: LABEL_OPTIONAL type: TYPE_STRING }
+      options { map_entry: true }
+    }
+    nested_type {
+      name: "IntMapEntry"
+      field { name: "key" number: 1 label: LABEL_OPTIONAL type: TYPE_INT32 }
+      field {
+        name: "value"
+        number: 2
+        label: LABEL_OPTIONAL
+        type: TYPE_MESSAGE
+        type_name: ".test.Nested"
+      }
+      options { map_entry: true }
+    }
+    nested_type {
+      name: "BoolMapEntry"
+      field { name: "key" number: 1 label: LABEL_OPTIONAL type: TYPE_BOOL }
+      field { name: "value" number: 2 label: LABEL_OPTIONAL type: TYPE_STRING }
+      options { map_entry: true }
+    }
+    oneof_decl { name: "choice" }
+    oneof_decl { name: "_optional_int32" }
+  }
+  message_type {
+    name: "WithStruct"
+    field { name: "name" number: 1 label: LABEL_OPTIONAL type: TYPE_STRING }
+    field {
+      name: "labels"
+      number: 2
+      label: LABEL_OPTIONAL
+      type: TYPE_MESSAGE
+      type_name: ".google.protobuf.Struct"
+    }
+  }
+)pb";
+
+class RestJsonTranscoderTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    for (auto const* d : {google::protobuf::Duration::descriptor(),
+                          google::protobuf::Struct::descriptor(),
+                          google::protobuf::Timestamp::descriptor(),
+                          google::protobuf::Int64Value::descriptor()}) {
+      FileDescriptorProto file;
+      d->file()->CopyTo(&file);
+      ASSERT_NE(pool_.BuildFile(file), nullptr);
+    }
+    FileDescriptorProto file;
+    ASSERT_TRUE(
+        google::protobuf::TextFormat::ParseFromString(kTestSchema, &file));
+    ASSERT_NE(pool_.BuildFile(file), nullptr);
+  }
+
+  std::unique_ptr<Message> NewMessage(std::string const& name) {
+    auto const* d = pool_.FindMessageTypeByName(name);
+    if (d == nullptr) return nullptr;
+    return std::unique_ptr<Message>(factory_.GetPrototype(d)->New());
+  }
+
+  DescriptorPool pool_;
+  DynamicMessageFactory factory_{&pool_};
+};
+
+std::string Serialize(Message const& m) {
+  std::string bytes;
+  {
+    google::protobuf::io::StringOutputStream os(&bytes);
+    google::protobuf::io::CodedOutputStream cos(&os);
+    cos.SetSerializationDeterministic(true);
+    m.SerializeToCodedStream(&cos);
+  }
+  return bytes;
+}
+
+bool LibraryParse(std::string const& json, Message& m) {
+  google::protobuf::util::JsonParseOptions options;
+  options.ignore_unknown_fields = true;
+  return google::protobuf::util::JsonStringToMessage(json, &m, options).ok();
+}
+
+bool HasNonAscii(std::string const& s) {
+  return std::any_of(s.begin(), s.end(), [](char c) {
+    return static_cast<unsigned char>(c) >= 0x80;
+  });
+}
+
+std::string LibraryPrint(Message const& m, bool preserve_proto_field_names) {
+  google::protobuf::util::JsonPrintOptions options;
+  options.preserve_proto_field_names = preserve_proto_field_names;
+  std::string json;
+  auto status = google::protobuf::util::MessageToJsonString(m, &json, options);
+  EXPECT_TRUE(status.ok()) << status.ToString();
+  return json;
+}
+
+// These inputs are handled by the fast path, and must produce the same
+// message as the protobuf library.
+auto const* const kSupported = new std::vector<std::string>{
+    R"js({})js",
+    R"js({"int32Value": -42, "int64Value": "-1234567890123"})js",
+    R"js({"int32_value": 7, "int64_value": 123})js",
+    R"js({"uint32Value": 4294967295, "uint64Value": "18446744073709551615"})js",
+    R"js({"uint64Value": 18446744073709551615, "fixed64Value": "1"})js",
+    R"js({"int32Value": "12", "uint32Value": "13", "sint32Value": -3})js",
+    R"js({"int32Value": 1.0, "int64Value": 1e3})js",
+    R"js({"doubleValue": 0.1, "floatValue": 0.1})js",
+    R"js({"doubleValue": -0.0, "floatValue": -0.0})js",
+    R"js({"doubleValue": 1e300, "floatValue": 3.4e38})js",
+    R"js({"doubleValue": "NaN", "floatValue": "Infinity"})js",
+    R"js({"doubleValue": "-Infinity", "floatValue": 16777216})js",
+    R"js({"repeatedDouble": [1, 2.5, "NaN"], "repeatedFloat": [0.3]})js",
+    R"js({"boolValue": true, "stringValue": "hello \"world\" é"})js",
+    R"js({"bytesValue": "aGVsbG8gd29ybGQ="})js",
+    R"js({"bytesValue": "_-8="})js",
+    R"js({"color": "GREEN", "repeatedColor": ["RED", 2, "GREEN"]})js",
+    R"js({"repeatedColor": ["COLOR_UNSPECIFIED"]})js",
+    R"js({"color": 1})js",
+    R"js({"nested": {"name": "n", "value": 1, "children": [{"name": "c"}]}})js",
+    R"js({"repeatedInt64": ["1", 2, "-3"], "repeatedString": ["a", "b"]})js",
+    R"js({"repeatedNested": [{"name": "a"}, {}, {"value": 3}]})js",
+    R"js({"stringMap": {"a": "1", "b": "2", "": ""}})js",
+    R"js({"intMap": {"1": {"name": "one"}, "-2": {"value": 2}}})js",
+    R"js({"boolMap": {"true": "yes", "false": "no"}})js",
+    R"js({"timestamp": "2024-01-02T03:04:05.123456789Z"})js",
+    R"js({"timestamp": "2024-01-02T03:04:05+01:00"})js",
+    R"js({"duration": "1.5s"})js",
+    R"js({"repeatedTimestamp": ["1970-01-01T00:00:00Z"]})js",
+    R"js({"duration": "-0.5s"})js",
+    R"js({"duration": "-3.000000001s"})js",
+    R"js({"int64Wrapper": "123", "stringWrapper": "abc"})js",
+    R"js({"int64Wrapper": 0, "stringWrapper": "", "doubleWrapper": 1.5})js",
+    R"js({"choiceString": "x"})js",
+    R"js({"choiceInt": 0})js",
+    R"js({"optionalInt32": 0})js",
+    R"js({"renamed": "custom"})js",
+    R"js({"custom_name": "custom"})js",
+    R"js({"recursive": {"recursive": {"int32Value": 3}}})js",
+    R"js({"unknown": {"a": [1, 2, {"b": null}]}, "int32Value": 3})js",
+    R"js({"unknownScalar": 1, "unknownArray": [], "unknownNull": null})js",
+    R"js({"int32Value": null, "nested": null, "int64Wrapper": null})js",
+    R"js({"nested": {"name": "a"}, "nested": {"value": 2}})js",
+};
+
+// These inputs are left to the protobuf library, either because the fast
+// path does not handle them, or because they are invalid.
+auto const* const kFallback = new std::vector<std::string>{
+    R"js([])js",
+    R"js("string")js",
+    R"js({"int32Value": 2147483648})js",
+    R"js({"doubleValue": -0})js",
+    R"js({"int32Value": 1.5})js",
+    R"js({"int32Value": " 12"})js",
+    R"js({"uint32Value": -1})js",
+    R"js({"int64Value": 1e300})js",
+    R"js({"floatValue": 1e39})js",
+    R"js({"doubleValue": "1.5"})js",
+    R"js({"boolValue": "true"})js",
+    R"js({"stringValue": 1})js",
+    R"js({"bytesValue": "not base64!"})js",
+    R"js({"color": "PURPLE"})js",
+    R"js({"color": 7})js",
+    R"js({"nested": 1})js",
+    R"js({"nested": [{}]})js",
+    R"js({"repeatedInt64": 1})js",
+    R"js({"repeatedInt64": [[1]]})js",
+    R"js({"repeatedInt64": [null]})js",
+    R"js({"stringMap": {"a": 1}})js",
+    R"js({"stringMap": {"a": null}})js",
+    R"js({"boolMap": {"yes": "no"}})js",
+    R"js({"intMap": {"x": {}}})js",
+    R"js({"timestamp": "yesterday"})js",
+    R"js({"timestamp": {"seconds": 1}})js",
+    R"js({"duration": "1.5"})js",
+    R"js({"duration": "1.1234567891s"})js",
+    R"js({"duration": "999999999999s"})js",
+    R"js({"choiceString": "x", "choiceInt": 1})js",
+    R"js({"[test.extension]": 1})js",
+    R"js({"int32Value": 1)js",
+    R"js({"int32Value": 1} {})js",
+};
+
+TEST_F(RestJsonTranscoderTest, ParseConformance) {
+  for (auto const& json : *kSupported) {
+    SCOPED_TRACE("Testing with " + json);
+    auto expected = NewMessage("test.Sample");
+    ASSERT_TRUE(LibraryParse(json, *expected));
+    auto actual = NewMessage("test.Sample");
+    ASSERT_TRUE(TryJsonToProto(json, *actual));
+    EXPECT_EQ(Serialize(*actual), Serialize(*expected))
+        << "actual=" << actual->DebugString()
+        << "\nexpected=" << expected->DebugString();
+  }
+}
+
+TEST_F(RestJsonTranscoderTest, ParseFallback) {
+  for (auto const& json : *kFallback) {
+    SCOPED_TRACE("Testing with " + json);
+    auto actual = NewMessage("test.Sample");
+    EXPECT_FALSE(TryJsonToProto(json, *actual));
+  }
+}
+
+TEST_F(RestJsonTranscoderTest, PrintConformance) {
+  for (auto const& json : *kSupported) {
+    SCOPED_TRACE("Testing with " + json);
+    auto message = NewMessage("test.Sample");
+    ASSERT_TRUE(LibraryParse(json, *message));
+    for (bool preserve : {false, true}) {
+      auto actual = TryProtoToJson(*message, preserve);
+      // Non-ASCII strings are left to the protobuf library.
+      if (!actual && HasNonAscii(json)) continue;
+      EXPECT_THAT(actual, Optional(LibraryPrint(*message, preserve)));
+    }
+  }
+}
+
+TEST_F(RestJsonTranscoderTest, PrintEscapes) {
+  auto message = NewMessage("test.Sample");
+  std::string all;
+  for (int c = 1; c != 0x80; ++c) all.push_back(static_cast<char>(c));
+  auto const* fd = message->GetDescriptor()->FindFieldByName("string_value");
+  message->GetReflection()->SetString(message.get(), fd, all);
+  EXPECT_THAT(TryProtoToJson(*message, false),
+              Optional(LibraryPrint(*message, false)));
+}
+
+TEST_F(RestJsonTranscoderTest, PrintUnknownEnum) {
+  auto message = NewMessage("test.Sample");
+  auto const* fd = message->GetDescriptor()->FindFieldByName("color");
+  message->GetReflection()->SetEnumValue(message.get(), fd, 42);
+  EXPECT_THAT(TryProtoToJson(*message, false),
+              Optional(LibraryPrint(*message, false)));
+}
+
+TEST_F(RestJsonTranscoderTest, PrintFallback) {
+  auto message = NewMessage("test.Sample");
+  auto const* d = message->GetDescriptor();
+  auto const* r = message->GetReflection();
+  // Non-ASCII strings are escaped differently across protobuf versions.
+  r->SetString(message.get(), d->FindFieldByName("string_value"),
+               "caf\xc3\xa9");
+  EXPECT_EQ(TryProtoToJson(*message, false), absl::nullopt);
+
+  message->Clear();
+  auto* ts = r->MutableMessage(message.get(), d->FindFieldByName("timestamp"));
+  ts->GetReflection()->SetInt64(
+      ts, ts->GetDescriptor()->FindFieldByName("seconds"), 253402300800LL);
+  EXPECT_EQ(TryProtoToJson(*message, false), absl::nullopt);
+}
+
+TEST_F(RestJsonTranscoderTest, UnsupportedTypes) {
+  auto with_struct = NewMessage("test.WithStruct");
+  EXPECT_FALSE(TryJsonToProto(R"js({"name": "a"})js", *with_struct));
+  EXPECT_EQ(TryProtoToJson(*with_struct, false), absl::nullopt);
+
+  google::protobuf::Timestamp ts;
+  EXPECT_FALSE(TryJsonToProto(R"js("1970-01-01T00:00:00Z")js", ts));
+  EXPECT_EQ(TryProtoToJson(ts, false), absl::nullopt);
+}
+
+TEST(RestJsonTranscoder, GeneratedMessages) {
+  // Use the descriptors for some well-known types as a large, generated,
+  // proto2 message.
+  google::protobuf::FileDescriptorSet set;
+  for (auto const* d : {google::protobuf::Duration::descriptor(),
+                        google::protobuf::Struct::descriptor(),
+                        google::protobuf::Timestamp::descriptor(),
+                        google::protobuf::Int64Value::descriptor()}) {
+    d->file()->CopyTo(set.add_file());
+  }
+  for (bool preserve : {false, true}) {
+    auto const json = LibraryPrint(set, preserve);
+    EXPECT_THAT(TryProtoToJson(set, preserve), Optional(json));
+
+    google::protobuf::FileDescriptorSet actual;
+    ASSERT_TRUE(TryJsonToProto(json, actual));
+    EXPECT_EQ(Serialize(actual), Serialize(set));
+  }
+}
+
+}  // namespace
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
+}  // namespace rest_internal
+}  // namespace cloud
+}  // namespace google
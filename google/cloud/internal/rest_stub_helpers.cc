@@ -14,6 +14,7 @@
 
 #include "google/cloud/internal/rest_stub_helpers.h"
 #include "google/cloud/internal/make_status.h"
+#include "google/cloud/internal/rest_json_transcoder.h"
 
 namespace google {
 namespace cloud {
@@ -28,6 +29,10 @@ Status RestResponseToProto(google::protobuf::Message& destination,
   auto json_response =
       rest_internal::ReadAll(std::move(rest_response).ExtractPayload());
   if (!json_response.ok()) return std::move(json_response).status();
+  if (TryJsonToProto(*json_response, destination)) return {};
+  // Use the protobuf utilities for anything the fast path does not handle,
+  // including any malformed input, so the error details remain unchanged.
+  destination.Clear();
   google::protobuf::util::JsonParseOptions parse_options;
   parse_options.ignore_unknown_fields = true;
   auto json_to_proto_status = google::protobuf::util::JsonStringToMessage(
@@ -47,6 +52,8 @@ Status RestResponseToProto(google::protobuf::Message& destination,
 
 StatusOr<std::string> ProtoRequestToJsonPayload(
     google::protobuf::Message const& request, bool preserve_proto_field_names) {
+  auto fast = TryProtoToJson(request, preserve_proto_field_names);
+  if (fast) return *std::move(fast);
   std::string json_payload;
   google::protobuf::util::JsonPrintOptions print_options;
   print_options.preserve_proto_field_names = preserve_proto_field_names;
@@ -0,0 +1,109 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/internal/routing_matcher.h"
+#include "absl/strings/match.h"
+#include <utility>
+
+namespace google {
+namespace cloud {
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_BEGIN
+namespace internal {
+
+RoutingPathTemplate::RoutingPathTemplate(absl::string_view path_template) {
+  std::string literal;
+  auto flush = [&] {
+    if (literal.empty()) return;
+    tokens_.push_back(Token{TokenType::kLiteral, std::move(literal), '/'});
+    literal.clear();
+  };
+  auto const size = path_template.size();
+  for (std::size_t i = 0; i != size; ++i) {
+    auto const c = path_template[i];
+    if (c == '{' || c == '}') {
+      flush();
+      tokens_.push_back(Token{
+          c == '{' ? TokenType::kCaptureBegin : TokenType::kCaptureEnd, {},
+          '/'});
+      continue;
+    }
+    if (c != '*') {
+      literal.push_back(c);
+      continue;
+    }
+    flush();
+    if (i + 1 != size && path_template[i + 1] == '*') {
+      tokens_.push_back(Token{TokenType::kAny, {}, '/'});
+      ++i;
+      continue;
+    }
+    auto const next = path_template.find_first_not_of('}', i + 1);
+    auto const excluded =
+        next != absl::string_view::npos && path_template[next] == ':' ? ':'
+                                                                      : '/';
+    tokens_.push_back(Token{TokenType::kSegment, {}, excluded});
+  }
+  flush();
+  // Without braces, the template captures the full value.
+  if (path_template.find('{') == absl::string_view::npos) {
+    tokens_.insert(tokens_.begin(), Token{TokenType::kCaptureBegin, {}, '/'});
+    tokens_.push_back(Token{TokenType::kCaptureEnd, {}, '/'});
+  }
+}
+
+absl::optional<absl::string_view> RoutingPathTemplate::Match(
+    absl::string_view value) const {
+  Captures captures;
+  if (!Match(0, value, 0, captures)) return absl::nullopt;
+  return value.substr(captures.begin, captures.end - captures.begin);
+}
+
+bool RoutingPathTemplate::Match(std::size_t token, absl::string_view value,
+                                std::size_t pos, Captures& captures) const {
+  for (; token != tokens_.size(); ++token) {
+    auto const& t = tokens_[token];
+    switch (t.type) {
+      case TokenType::kLiteral:
+        if (!absl::StartsWith(value.substr(pos), t.literal)) return false;
+        pos += t.literal.size();
+        break;
+      case TokenType::kSegment: {
+        auto end = value.find(t.excluded, pos);
+        if (end == absl::string_view::npos) end = value.size();
+        if (end == pos) return false;
+        pos = end;
+        break;
+      }
+      case TokenType::kAny:
+        // Like `.*` in a regular expression, prefer the longest match. In
+        // practice `**` is the last token and the first attempt succeeds.
+        for (auto end = value.size();; --end) {
+          if (Match(token + 1, value, end, captures)) return true;
+          if (end == pos) return false;
+        }
+      case TokenType::kCaptureBegin:
+        captures.begin = pos;
+        break;
+      case TokenType::kCaptureEnd:
+        captures.end = pos;
+        break;
+    }
+  }
+  return pos == value.size();
+}
+
+}  // namespace internal
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
+}  // namespace cloud
+}  // namespace google
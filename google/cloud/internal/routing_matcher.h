@@ -18,9 +18,10 @@
 #include "google/cloud/internal/absl_str_cat_quiet.h"
 #include "google/cloud/internal/url_encode.h"
 #include "google/cloud/version.h"
+#include "absl/strings/string_view.h"
 #include "absl/types/optional.h"
+#include <cstddef>
 #include <functional>
-#include <regex>
 #include <string>
 #include <vector>
 
@@ -29,6 +30,53 @@ namespace cloud {
 GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_BEGIN
 namespace internal {
 
+/**
+ * A path template used to extract routing keys from request fields.
+ *
+ * The template is a sequence of literal text and wildcards. A single `*`
+ * matches a full, non-empty segment: all the characters up to the next `/`.
+ * When the `*` is followed by a `:` it matches up to the next `:` instead, to
+ * support custom verbs. A `**` matches any sequence of characters, including
+ * an empty one. At most one part of the template is enclosed in braces, this
+ * is the value extracted by a successful match. Without braces, the full value
+ * is extracted. For example, matching `projects/p/instances/i` against the
+ * `{projects/&#42;}/&#42;&#42;` template returns `projects/p`.
+ *
+ * The template is parsed once. Matching walks the template segment by segment,
+ * with no allocations, and only backtracks for `**` wildcards that are not at
+ * the end of the template. This is much faster than the equivalent
+ * `std::regex`.
+ */
+class RoutingPathTemplate {
+ public:
+  explicit RoutingPathTemplate(absl::string_view path_template);
+
+  /**
+   * Returns the captured part of @p value, or `absl::nullopt` if @p value does
+   * not match the template.
+   *
+   * The returned value is a view into @p value.
+   */
+  absl::optional<absl::string_view> Match(absl::string_view value) const;
+
+ private:
+  enum class TokenType { kLiteral, kSegment, kAny, kCaptureBegin, kCaptureEnd };
+  struct Token {
+    TokenType type;
+    std::string literal;  // only used for `kLiteral`
+    char excluded;        // only used for `kSegment`
+  };
+  struct Captures {
+    std::size_t begin = 0;
+    std::size_t end = 0;
+  };
+
+  bool Match(std::size_t token, absl::string_view value, std::size_t pos,
+             Captures& captures) const;
+
+  std::vector<Token> tokens_;
+};
+
 /**
  * A helper class used by our `MetadataDecorator`s to match and extract routing
  * keys from a proto.
@@ -40,25 +88,26 @@ struct RoutingMatcher {
 
   struct Pattern {
     std::function<std::string const&(Request const&)> field_getter;
-    absl::optional<std::regex> re;
+    absl::optional<RoutingPathTemplate> path_template;
   };
   std::vector<Pattern> patterns;
 
   // If a match is found for this routing_key, append "routing_key=value" to
   // the `params` vector.
-  void AppendParam(Request const& request, std::vector<std::string>& params) {
-    std::smatch match;
+  void AppendParam(Request const& request,
+                   std::vector<std::string>& params) const {
     for (auto const& pattern : patterns) {
       auto const& field = pattern.field_getter(request);
       if (field.empty()) continue;
-      // When the optional regex is not engaged, it is implied that we should
-      // match the whole field.
-      if (!pattern.re) {
+      // When the optional template is not engaged, it is implied that we
+      // should match the whole field.
+      if (!pattern.path_template) {
         params.push_back(absl::StrCat(routing_key, UrlEncode(field)));
         return;
       }
-      if (std::regex_match(field, match, *pattern.re)) {
-        params.push_back(absl::StrCat(routing_key, UrlEncode(match[1].str())));
+      auto match = pattern.path_template->Match(field);
+      if (match) {
+        params.push_back(absl::StrCat(routing_key, UrlEncode(*match)));
         return;
       }
     }
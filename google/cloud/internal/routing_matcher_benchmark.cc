@@ -0,0 +1,142 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/internal/routing_matcher.h"
+#include <benchmark/benchmark.h>
+#include <regex>
+#include <string>
+#include <vector>
+
+namespace google {
+namespace cloud {
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_BEGIN
+namespace internal {
+namespace {
+
+// Compare the `RoutingPathTemplate` matcher against the `std::regex` based
+// implementation it replaced, using the most common Bigtable routing pattern.
+//
+// Run on (1 X 2100 MHz CPU )
+// CPU Caches:
+//   L1 Data 48 KiB (x1)
+//   L1 Instruction 32 KiB (x1)
+//   L2 Unified 2048 KiB (x1)
+//   L3 Unified 307200 KiB (x1)
+// Load Average: 0.53, 0.51, 0.80
+// -------------------------------------------------------------------------
+// Benchmark                               Time             CPU   Iterations
+// -------------------------------------------------------------------------
+// BM_RoutingRegexMatch                 3138 ns         3107 ns       210410
+// BM_RoutingPathTemplateMatch           890 ns          879 ns       697433
+// BM_RoutingRegexMismatch              1701 ns         1684 ns       393378
+// BM_RoutingPathTemplateMismatch       49.9 ns         49.2 ns     15472580
+// BM_RoutingMatcherAppendParam          996 ns          987 ns       794669
+
+auto constexpr kTableName =
+    "projects/my-project/instances/my-instance/tables/my-table";
+auto constexpr kOtherName = "projects/my-project/instances/my-instance";
+
+struct TestRequest {
+  std::string const& table_name() const { return table_name_; }
+  std::string table_name_;
+};
+
+// The implementation of `RoutingMatcher::AppendParam()` before
+// `RoutingPathTemplate` was introduced.
+std::regex const& TableNameRegex() {
+  static auto const* const kRegex =
+      new std::regex{"(projects/[^/]+/instances/[^/]+/tables/[^/]+)",
+                     std::regex::optimize};
+  return *kRegex;
+}
+
+void RegexAppendParam(std::string const& field,
+                      std::vector<std::string>& params) {
+  std::smatch match;
+  if (std::regex_match(field, match, TableNameRegex())) {
+    params.push_back(absl::StrCat("table_name=", UrlEncode(match[1].str())));
+  }
+}
+
+RoutingPathTemplate const& TableNameTemplate() {
+  static auto const* const kTemplate =
+      new RoutingPathTemplate("{projects/*/instances/*/tables/*}");
+  return *kTemplate;
+}
+
+void BM_RoutingRegexMatch(benchmark::State& state) {
+  auto const field = std::string{kTableName};
+  for (auto _ : state) {
+    std::vector<std::string> params;
+    RegexAppendParam(field, params);
+    benchmark::DoNotOptimize(params);
+  }
+}
+BENCHMARK(BM_RoutingRegexMatch);
+
+void BM_RoutingPathTemplateMatch(benchmark::State& state) {
+  auto const field = std::string{kTableName};
+  for (auto _ : state) {
+    std::vector<std::string> params;
+    auto match = TableNameTemplate().Match(field);
+    if (match) {
+      params.push_back(absl::StrCat("table_name=", UrlEncode(*match)));
+    }
+    benchmark::DoNotOptimize(params);
+  }
+}
+BENCHMARK(BM_RoutingPathTemplateMatch);
+
+void BM_RoutingRegexMismatch(benchmark::State& state) {
+  auto const field = std::string{kOtherName};
+  for (auto _ : state) {
+    std::vector<std::string> params;
+    RegexAppendParam(field, params);
+    benchmark::DoNotOptimize(params);
+  }
+}
+BENCHMARK(BM_RoutingRegexMismatch);
+
+void BM_RoutingPathTemplateMismatch(benchmark::State& state) {
+  auto const field = std::string{kOtherName};
+  for (auto _ : state) {
+    auto match = TableNameTemplate().Match(field);
+    benchmark::DoNotOptimize(match);
+  }
+}
+BENCHMARK(BM_RoutingPathTemplateMismatch);
+
+void BM_RoutingMatcherAppendParam(benchmark::State& state) {
+  auto const matcher = RoutingMatcher<TestRequest>{
+      "table_name=",
+      {
+          {[](TestRequest const& request) -> std::string const& {
+             return request.table_name();
+           },
+           RoutingPathTemplate("{projects/*/instances/*/tables/*}")},
+      }};
+  auto const request = TestRequest{kTableName};
+  for (auto _ : state) {
+    std::vector<std::string> params;
+    matcher.AppendParam(request, params);
+    benchmark::DoNotOptimize(params);
+  }
+}
+BENCHMARK(BM_RoutingMatcherAppendParam);
+
+}  // namespace
+}  // namespace internal
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
+}  // namespace cloud
+}  // namespace google
@@ -21,8 +21,61 @@ GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_BEGIN
 namespace internal {
 namespace {
 
+using ::testing::Eq;
+using ::testing::Optional;
 using ::testing::UnorderedElementsAre;
 
+TEST(RoutingPathTemplate, Segments) {
+  auto const t = RoutingPathTemplate("{projects/*/instances/*/tables/*}");
+  EXPECT_THAT(t.Match("projects/p/instances/i/tables/t"),
+              Optional(Eq("projects/p/instances/i/tables/t")));
+  EXPECT_EQ(t.Match("projects/p/instances/i/tables/t/"), absl::nullopt);
+  EXPECT_EQ(t.Match("projects/p/instances/i/tables/t/x"), absl::nullopt);
+  EXPECT_EQ(t.Match("projects/p/instances/i/tables/"), absl::nullopt);
+  EXPECT_EQ(t.Match("projects//instances/i/tables/t"), absl::nullopt);
+  EXPECT_EQ(t.Match("projects/p/instances/i"), absl::nullopt);
+  EXPECT_EQ(t.Match("project/p/instances/i/tables/t"), absl::nullopt);
+  EXPECT_EQ(t.Match(""), absl::nullopt);
+}
+
+TEST(RoutingPathTemplate, CaptureInTheMiddle) {
+  auto const t = RoutingPathTemplate("projects/*/locations/{*}/builds/*");
+  EXPECT_THAT(t.Match("projects/p/locations/l/builds/b"), Optional(Eq("l")));
+  EXPECT_EQ(t.Match("projects/p/locations/l/builds"), absl::nullopt);
+  EXPECT_EQ(t.Match("projects/p/locations/l/triggers/t"), absl::nullopt);
+}
+
+TEST(RoutingPathTemplate, TrailingAny) {
+  auto const t = RoutingPathTemplate("{projects/*/buckets/*}/**");
+  EXPECT_THAT(t.Match("projects/_/buckets/b/objects/o/with/slashes"),
+              Optional(Eq("projects/_/buckets/b")));
+  EXPECT_THAT(t.Match("projects/_/buckets/b/"),
+              Optional(Eq("projects/_/buckets/b")));
+  EXPECT_EQ(t.Match("projects/_/buckets/b"), absl::nullopt);
+}
+
+TEST(RoutingPathTemplate, LeadingAny) {
+  auto const t = RoutingPathTemplate("**/{tables/*}/views/*");
+  EXPECT_THAT(t.Match("a/b/tables/t1/views/v/tables/t2/views/v"),
+              Optional(Eq("tables/t2")));
+  EXPECT_EQ(t.Match("a/b/tables/t1/views"), absl::nullopt);
+}
+
+TEST(RoutingPathTemplate, CaptureAll) {
+  EXPECT_THAT(RoutingPathTemplate("{**}").Match("a/b/c"),
+              Optional(Eq("a/b/c")));
+  EXPECT_THAT(RoutingPathTemplate("{**}").Match(""), Optional(Eq("")));
+  EXPECT_THAT(RoutingPathTemplate("projects/*").Match("projects/p"),
+              Optional(Eq("projects/p")));
+}
+
+TEST(RoutingPathTemplate, CustomVerb) {
+  auto const t = RoutingPathTemplate("projects/*:{instances/*}:**");
+  EXPECT_THAT(t.Match("projects/p:instances/i:verb"),
+              Optional(Eq("instances/i")));
+  EXPECT_EQ(t.Match("projects/p:instances/i"), absl::nullopt);
+}
+
 // Simulate a protobuf message with two string fields: `foo` and `bar`.
 struct TestRequest {
   std::string const& foo() const { return foo_; };
@@ -39,7 +92,7 @@ TEST(RoutingMatcher, NoAppendIfNoMatch) {
           {[](TestRequest const& request) -> std::string const& {
              return request.foo();
            },
-           std::regex{"baz/([^/]+)"}},
+           RoutingPathTemplate("baz/{*}")},
       }};
 
   std::vector<std::string> params = {"previous"};
@@ -75,7 +128,7 @@ TEST(RoutingMatcher, EmptyFieldIsSkipped) {
           {[](TestRequest const& request) -> std::string const& {
              return request.bar();
            },
-           std::regex{"bar/([^/]+)"}},
+           RoutingPathTemplate("bar/{*}")},
       }};
 
   std::vector<std::string> params = {"previous"};
@@ -91,11 +144,11 @@ TEST(RoutingMatcher, FirstNonEmptyMatchIsUsed) {
           {[](TestRequest const& request) -> std::string const& {
              return request.foo();
            },
-           std::regex{"foo/([^/]+)"}},
+           RoutingPathTemplate("foo/{*}")},
           {[](TestRequest const& request) -> std::string const& {
              return request.bar();
            },
-           std::regex{"bar/([^/]+)"}},
+           RoutingPathTemplate("bar/{*}")},
       }};
 
   std::vector<std::string> params = {"previous"};
@@ -120,14 +173,14 @@ TEST(RoutingMatcher, UrlEncodesMatchAll) {
   EXPECT_THAT(params, UnorderedElementsAre("previous", "routing_id=foo%2Ffoo"));
 }
 
-TEST(RoutingMatcher, UrlEncodesRegex) {
+TEST(RoutingMatcher, UrlEncodesPathTemplate) {
   auto matcher = RoutingMatcher<TestRequest>{
       "routing_id=",
       {
           {[](TestRequest const& request) -> std::string const& {
              return request.foo();
            },
-           std::regex{"(.*)"}},
+           RoutingPathTemplate("{**}")},
       }};
 
   std::vector<std::string> params = {"previous"};
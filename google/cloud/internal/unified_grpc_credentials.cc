@@ -13,6 +13,7 @@
 // limitations under the License.
 
 #include "google/cloud/internal/unified_grpc_credentials.h"
+#include "google/cloud/grpc_channel_warmup.h"
 #include "google/cloud/grpc_error_delegate.h"
 #include "google/cloud/grpc_options.h"
 #include "google/cloud/internal/grpc_access_token_authentication.h"
@@ -73,15 +74,56 @@ class GrpcErrorCredentialsAuthentication : public GrpcAuthenticationStrategy {
   Status error_status_;
 };
 
+/// Starts connecting each channel as soon as it is created.
+class GrpcChannelWarmupAuthentication : public GrpcAuthenticationStrategy {
+ public:
+  GrpcChannelWarmupAuthentication(
+      std::shared_ptr<GrpcAuthenticationStrategy> child, CompletionQueue cq,
+      std::shared_ptr<experimental::GrpcChannelWarmup> warmup)
+      : child_(std::move(child)),
+        cq_(std::move(cq)),
+        warmup_(std::move(warmup)) {}
+  ~GrpcChannelWarmupAuthentication() override = default;
+
+  std::shared_ptr<grpc::Channel> CreateChannel(
+      std::string const& endpoint,
+      grpc::ChannelArguments const& arguments) override {
+    auto channel = child_->CreateChannel(endpoint, arguments);
+    warmup_->AddChannel(cq_, channel);
+    return channel;
+  }
+  bool RequiresConfigureContext() const override {
+    return child_->RequiresConfigureContext();
+  }
+  Status ConfigureContext(grpc::ClientContext& context) override {
+    return child_->ConfigureContext(context);
+  }
+  future<StatusOr<std::shared_ptr<grpc::ClientContext>>> AsyncConfigureContext(
+      std::shared_ptr<grpc::ClientContext> context) override {
+    return child_->AsyncConfigureContext(std::move(context));
+  }
+
+ private:
+  std::shared_ptr<GrpcAuthenticationStrategy> child_;
+  CompletionQueue cq_;
+  std::shared_ptr<experimental::GrpcChannelWarmup> warmup_;
+};
+
 std::shared_ptr<GrpcAuthenticationStrategy> CreateAuthenticationStrategy(
     google::cloud::CompletionQueue cq, Options const& options) {
-  if (options.has<google::cloud::UnifiedCredentialsOption>()) {
+  auto auth = [&] {
+    if (options.has<google::cloud::UnifiedCredentialsOption>()) {
+      return google::cloud::internal::CreateAuthenticationStrategy(
+          *options.get<google::cloud::UnifiedCredentialsOption>(), cq,
+          options);
+    }
     return google::cloud::internal::CreateAuthenticationStrategy(
-        *options.get<google::cloud::UnifiedCredentialsOption>(), std::move(cq),
-        options);
-  }
-  return google::cloud::internal::CreateAuthenticationStrategy(
-      options.get<google::cloud::GrpcCredentialOption>());
+        options.get<google::cloud::GrpcCredentialOption>());
+  }();
+  auto warmup = options.get<experimental::GrpcChannelWarmupOption>();
+  if (!warmup) return auth;
+  return std::make_shared<GrpcChannelWarmupAuthentication>(
+      std::move(auth), std::move(cq), std::move(warmup));
 }
 
 std::shared_ptr<GrpcAuthenticationStrategy> CreateAuthenticationStrategy(
@@ -14,6 +14,7 @@
 
 #include "google/cloud/internal/unified_grpc_credentials.h"
 #include "google/cloud/common_options.h"
+#include "google/cloud/grpc_channel_warmup.h"
 #include "google/cloud/grpc_error_delegate.h"
 #include "google/cloud/grpc_options.h"
 #include "google/cloud/internal/credentials_impl.h"
@@ -25,6 +26,7 @@
 #include "google/cloud/testing_util/validate_metadata.h"
 #include <gmock/gmock.h>
 #include <fstream>
+#include <thread>
 
 namespace google {
 namespace cloud {
@@ -39,6 +41,7 @@ using ::google::cloud::testing_util::ValidateMetadataFixture;
 using ::testing::Contains;
 using ::testing::IsEmpty;
 using ::testing::IsNull;
+using ::testing::Not;
 using ::testing::NotNull;
 using ::testing::Pair;
 
@@ -63,6 +66,24 @@ TEST(UnifiedGrpcCredentialsTest, UnifiedCredentialsOption) {
   EXPECT_TRUE(result->RequiresConfigureContext());
 }
 
+TEST(UnifiedGrpcCredentialsTest, GrpcChannelWarmupOption) {
+  CompletionQueue cq;
+  std::thread t([&cq] { cq.Run(); });
+  auto warmup = std::make_shared<experimental::GrpcChannelWarmup>(
+      std::chrono::milliseconds(10));
+  auto result = CreateAuthenticationStrategy(
+      cq, Options{}
+              .set<GrpcCredentialOption>(grpc::InsecureChannelCredentials())
+              .set<experimental::GrpcChannelWarmupOption>(warmup));
+  EXPECT_FALSE(result->RequiresConfigureContext());
+  auto channel = result->CreateChannel("localhost:1", {});
+  ASSERT_THAT(channel, NotNull());
+  EXPECT_EQ(warmup->channel_count(), 1);
+  EXPECT_THAT(warmup->Wait(), Not(IsOk()));
+  cq.Shutdown();
+  t.join();
+}
+
 TEST(UnifiedGrpcCredentialsTest, WithGrpcCredentials) {
   auto result =
       CreateAuthenticationStrategy(grpc::InsecureChannelCredentials());
@@ -87,7 +87,8 @@ std::ostream& operator<<(std::ostream& os, LogRecord const& rhs) {
 
 LogSink::LogSink()
     : empty_(true),
-      minimum_severity_(static_cast<int>(Severity::GCP_LS_LOWEST_ENABLED)) {}
+      minimum_severity_(static_cast<int>(Severity::GCP_LS_LOWEST_ENABLED)),
+      backends_(std::make_shared<BackendMap const>()) {}
 
 LogSink& LogSink::Instance() {
   static auto* const kInstance = [] {
@@ -112,35 +113,31 @@ void LogSink::RemoveBackend(long id) {
 
 void LogSink::ClearBackends() {
   std::unique_lock<std::mutex> lk(mu_);
-  backends_.clear();
+  UpdateBackends({});
   default_backend_id_ = 0;
-  empty_.store(backends_.empty());
 }
 
-std::size_t LogSink::BackendCount() const {
-  std::unique_lock<std::mutex> lk(mu_);
-  return backends_.size();
-}
+std::size_t LogSink::BackendCount() const { return CopyBackends()->size(); }
 
 void LogSink::Log(LogRecord log_record) {
   auto copy = CopyBackends();
-  if (copy.empty()) return;
+  if (copy->empty()) return;
   // In general, we just give each backend a const-reference and the backends
   // must make a copy if needed.  But if there is only one backend we can give
   // the backend an opportunity to optimize things by transferring ownership of
   // the LogRecord to it.
-  if (copy.size() == 1) {
-    copy.begin()->second->ProcessWithOwnership(std::move(log_record));
+  if (copy->size() == 1) {
+    copy->begin()->second->ProcessWithOwnership(std::move(log_record));
     return;
   }
-  for (auto& kv : copy) {
+  for (auto const& kv : *copy) {
     kv.second->Process(log_record);
   }
 }
 
 void LogSink::Flush() {
   auto copy = CopyBackends();
-  for (auto& kv : copy) kv.second->Flush();
+  for (auto const& kv : *copy) kv.second->Flush();
 }
 
 void LogSink::EnableStdClogImpl(Severity min_severity) {
@@ -169,29 +166,39 @@ void LogSink::SetDefaultBackend(std::shared_ptr<LogBackend> backend) {
 LogSink::BackendId LogSink::AddBackendImpl(
     std::shared_ptr<LogBackend> backend) {
   auto const id = ++next_id_;
-  backends_.emplace(id, std::move(backend));
-  empty_.store(backends_.empty());
+  auto backends = *backends_;
+  backends.emplace(id, std::move(backend));
+  UpdateBackends(std::move(backends));
   return id;
 }
 
 void LogSink::RemoveBackendImpl(BackendId id) {
-  auto it = backends_.find(id);
-  if (backends_.end() == it) {
-    return;
-  }
-  backends_.erase(it);
-  empty_.store(backends_.empty());
+  if (backends_->count(id) == 0) return;
+  auto backends = *backends_;
+  backends.erase(id);
+  UpdateBackends(std::move(backends));
 }
 
-// Make a copy of the backends because calling user-defined functions while
-// holding a lock is a bad idea: the application may change the backends while
-// we are holding this lock, and soon deadlock occurs.
-std::map<LogSink::BackendId, std::shared_ptr<LogBackend>>
-LogSink::CopyBackends() {
-  std::lock_guard<std::mutex> lk(mu_);
-  return backends_;
+// Calling user-defined functions while holding a lock is a bad idea: the
+// application may change the backends while we are holding this lock, and
+// soon deadlock occurs. The snapshot is immutable and published atomically,
+// so readers take no locks, and copying it is just a reference count update.
+// C++20 deprecates these functions in favor of `std::atomic<std::shared_ptr>`,
+// which is not available in C++14.
+#include "google/cloud/internal/disable_deprecation_warnings.inc"
+std::shared_ptr<LogSink::BackendMap const> LogSink::CopyBackends() const {
+  return std::atomic_load(&backends_);
 }
 
+// Requires `mu_`, which serializes the writers. The writers can read
+// `backends_` directly, as no other thread modifies it.
+void LogSink::UpdateBackends(BackendMap backends) {
+  empty_.store(backends.empty());
+  std::atomic_store(&backends_,
+                    std::make_shared<BackendMap const>(std::move(backends)));
+}
+#include "google/cloud/internal/diagnostics_pop.inc"
+
 namespace internal {
 
 std::shared_ptr<LogBackend> DefaultLogBackend() {
@@ -220,6 +227,15 @@ std::shared_ptr<LogBackend> DefaultLogBackend() {
             std::make_shared<StdClogBackend>(min_severity));
       }
     }
+    if (fields[0] == "async" && fields.size() == 3) {
+      auto size = ParseSize(fields[1]);
+      auto min_flush_severity = ParseSeverity(fields[2]);
+      if (size.has_value() && min_flush_severity.has_value()) {
+        return std::make_shared<AsyncLogBackend>(
+            *size, *min_flush_severity,
+            std::make_shared<StdClogBackend>(min_severity));
+      }
+    }
     if (fields[0] == "clog" && fields.size() == 1) {
       return std::make_shared<StdClogBackend>(min_severity);
     }
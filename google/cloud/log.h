@@ -281,14 +281,20 @@ class LogSink {
   BackendId AddBackendImpl(std::shared_ptr<LogBackend> backend);
   void RemoveBackendImpl(BackendId id);
 
-  std::map<BackendId, std::shared_ptr<LogBackend>> CopyBackends();
+  using BackendMap = std::map<BackendId, std::shared_ptr<LogBackend>>;
+
+  std::shared_ptr<BackendMap const> CopyBackends() const;
+  void UpdateBackends(BackendMap backends);
 
   std::atomic<bool> empty_;
   std::atomic<int> minimum_severity_;
   std::mutex mutable mu_;
   BackendId next_id_ = 0;
   BackendId default_backend_id_ = 0;
-  std::map<BackendId, std::shared_ptr<LogBackend>> backends_;
+  // The backends are modified rarely, but read on every log record. Writers
+  // replace this snapshot with `std::atomic_store()`, and readers copy it with
+  // `std::atomic_load()`, without taking `mu_`.
+  std::shared_ptr<BackendMap const> backends_;
 };
 
 /**
@@ -0,0 +1,521 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/pubsub/benchmarks/embedded_server.h"
+#include "google/cloud/internal/random.h"
+#include "google/cloud/internal/time_utils.h"
+#include "google/cloud/testing_util/timer.h"
+#include <google/pubsub/v1/pubsub.grpc.pb.h>
+#include <grpcpp/grpcpp.h>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace google {
+namespace cloud {
+namespace pubsub_benchmarks {
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_BEGIN
+namespace {
+
+namespace pubsub_proto = ::google::pubsub::v1;
+using AckIds = ::google::protobuf::RepeatedPtrField<std::string>;
+using ::google::cloud::testing_util::Timer;
+
+// How long `StreamingPull()` waits for new messages before checking if the
+// stream was cancelled.
+auto constexpr kPullTimeout = std::chrono::milliseconds(50);
+
+// How often do we scan the leases looking for expired ack deadlines.
+auto constexpr kExpirationPeriod = std::chrono::milliseconds(100);
+
+/**
+ * The messages published to the server, and the leases on delivered messages.
+ *
+ * All the topics and subscriptions share this backlog. The messages are
+ * delivered to any stream with enough capacity, as determined by its flow
+ * control limits.
+ */
+class Backlog {
+ public:
+  explicit Backlog(EmbeddedServerOptions options)
+      : options_(std::move(options)),
+        generator_(google::cloud::internal::MakeDefaultPRNG()),
+        synthetic_data_(google::cloud::internal::Sample(
+            generator_, static_cast<int>(options_.synthetic_message_size),
+            "abcdefghijklmnopqrstuvwxyz0123456789")) {}
+
+  std::vector<std::string> Publish(
+      ::google::protobuf::RepeatedPtrField<pubsub_proto::PubsubMessage> const&
+          messages) {
+    auto const publish_time = google::cloud::internal::ToProtoTimestamp(
+        std::chrono::system_clock::now());
+    std::vector<std::string> ids;
+    ids.reserve(messages.size());
+    std::unique_lock<std::mutex> lk(mu_);
+    for (auto const& m : messages) {
+      Pending p{m, 0};
+      p.message.set_message_id(std::to_string(++message_id_));
+      *p.message.mutable_publish_time() = publish_time;
+      ids.push_back(p.message.message_id());
+      pending_.push_back(std::move(p));
+    }
+    published_count_ += messages.size();
+    lk.unlock();
+    cv_.notify_all();
+    return ids;
+  }
+
+  std::int64_t AddStream(pubsub_proto::StreamingPullRequest const& request) {
+    auto limit = [](std::int64_t server, std::int64_t client) {
+      if (server == 0) return client;
+      if (client == 0) return server;
+      return (std::min)(server, client);
+    };
+    Stream s;
+    s.max_messages = limit(options_.max_outstanding_messages,
+                           request.max_outstanding_messages());
+    s.max_bytes =
+        limit(options_.max_outstanding_bytes, request.max_outstanding_bytes());
+    s.ack_deadline = request.stream_ack_deadline_seconds() == 0
+                         ? options_.ack_deadline
+                         : std::chrono::seconds(
+                               request.stream_ack_deadline_seconds());
+    std::lock_guard<std::mutex> lk(mu_);
+    auto const id = ++stream_id_;
+    streams_.emplace(id, s);
+    return id;
+  }
+
+  /// Removes a stream, its leases are redelivered to other streams.
+  void RemoveStream(std::int64_t id) {
+    std::unique_lock<std::mutex> lk(mu_);
+    for (auto i = leases_.begin(); i != leases_.end();) {
+      if (i->second.stream_id != id) {
+        ++i;
+        continue;
+      }
+      Redeliver(std::move(i->second));
+      i = leases_.erase(i);
+    }
+    streams_.erase(id);
+    lk.unlock();
+    cv_.notify_all();
+  }
+
+  /**
+   * Returns the next batch of messages for a stream.
+   *
+   * Waits up to @p timeout for messages, and for capacity in the stream. May
+   * return an empty batch.
+   */
+  std::vector<pubsub_proto::ReceivedMessage> Pull(
+      std::int64_t id, std::chrono::milliseconds timeout) {
+    std::vector<pubsub_proto::ReceivedMessage> messages;
+    std::unique_lock<std::mutex> lk(mu_);
+    auto s = streams_.find(id);
+    if (s == streams_.end()) return messages;
+    auto& stream = s->second;
+    auto const has_capacity = [&stream] {
+      if (stream.max_messages != 0 &&
+          stream.outstanding_messages >= stream.max_messages) {
+        return false;
+      }
+      return stream.max_bytes == 0 ||
+             stream.outstanding_bytes < stream.max_bytes;
+    };
+    auto const synthetic = options_.synthetic_message_size != 0;
+    cv_.wait_for(lk, timeout, [&] {
+      return shutdown_ || (has_capacity() && (synthetic || !pending_.empty()));
+    });
+    if (shutdown_) return messages;
+
+    auto const now = std::chrono::steady_clock::now();
+    if (now >= next_expiration_) {
+      ExpireLeases(now);
+      next_expiration_ = now + kExpirationPeriod;
+    }
+    auto const deadline = now + stream.ack_deadline;
+    while (static_cast<int>(messages.size()) <
+               options_.max_messages_per_response &&
+           has_capacity()) {
+      Pending p;
+      if (!pending_.empty()) {
+        p = std::move(pending_.front());
+        pending_.pop_front();
+      } else if (synthetic) {
+        p.message.set_data(synthetic_data_);
+        p.message.set_message_id(std::to_string(++message_id_));
+      } else {
+        break;
+      }
+      if (p.delivery_attempt != 0) ++redelivered_count_;
+      auto const size = static_cast<std::int64_t>(p.message.ByteSizeLong());
+      ++stream.outstanding_messages;
+      stream.outstanding_bytes += size;
+
+      pubsub_proto::ReceivedMessage m;
+      m.set_ack_id("ack-" + std::to_string(++ack_id_));
+      *m.mutable_message() = p.message;
+      leases_.emplace(m.ack_id(), Lease{std::move(p.message), id, deadline,
+                                        size, p.delivery_attempt});
+      messages.push_back(std::move(m));
+    }
+    delivered_count_ += static_cast<std::int64_t>(messages.size());
+    return messages;
+  }
+
+  void Acknowledge(AckIds const& ack_ids) {
+    std::unique_lock<std::mutex> lk(mu_);
+    ack_count_ += ack_ids.size();
+    std::uniform_real_distribution<double> redeliver(0, 1);
+    for (auto const& ack_id : ack_ids) {
+      auto l = leases_.find(ack_id);
+      if (l == leases_.end()) continue;
+      Release(l->second);
+      if (options_.redelivery_rate > 0.0 &&
+          redeliver(generator_) < options_.redelivery_rate) {
+        Redeliver(std::move(l->second));
+      }
+      leases_.erase(l);
+    }
+    lk.unlock();
+    cv_.notify_all();
+  }
+
+  void ModifyAckDeadline(AckIds const& ack_ids, std::int32_t seconds) {
+    auto const deadline =
+        std::chrono::steady_clock::now() + std::chrono::seconds(seconds);
+    std::unique_lock<std::mutex> lk(mu_);
+    modify_ack_deadline_count_ += ack_ids.size();
+    for (auto const& ack_id : ack_ids) {
+      auto l = leases_.find(ack_id);
+      if (l == leases_.end()) continue;
+      if (seconds != 0) {
+        l->second.deadline = deadline;
+        continue;
+      }
+      // A zero deadline is a "nack", the message is redelivered immediately.
+      Release(l->second);
+      Redeliver(std::move(l->second));
+      leases_.erase(l);
+    }
+    lk.unlock();
+    cv_.notify_all();
+  }
+
+  void Shutdown() {
+    std::unique_lock<std::mutex> lk(mu_);
+    shutdown_ = true;
+    lk.unlock();
+    cv_.notify_all();
+  }
+
+  bool shutdown() const {
+    std::lock_guard<std::mutex> lk(mu_);
+    return shutdown_;
+  }
+
+  std::int64_t published_count() const {
+    std::lock_guard<std::mutex> lk(mu_);
+    return published_count_;
+  }
+  std::int64_t delivered_count() const {
+    std::lock_guard<std::mutex> lk(mu_);
+    return delivered_count_;
+  }
+  std::int64_t redelivered_count() const {
+    std::lock_guard<std::mutex> lk(mu_);
+    return redelivered_count_;
+  }
+  std::int64_t ack_count() const {
+    std::lock_guard<std::mutex> lk(mu_);
+    return ack_count_;
+  }
+  std::int64_t modify_ack_deadline_count() const {
+    std::lock_guard<std::mutex> lk(mu_);
+    return modify_ack_deadline_count_;
+  }
+
+ private:
+  struct Pending {
+    pubsub_proto::PubsubMessage message;
+    std::int32_t delivery_attempt = 0;
+  };
+
+  struct Lease {
+    pubsub_proto::PubsubMessage message;
+    std::int64_t stream_id;
+    std::chrono::steady_clock::time_point deadline;
+    std::int64_t size;
+    std::int32_t delivery_attempt;
+  };
+
+  struct Stream {
+    std::int64_t max_messages = 0;
+    std::int64_t max_bytes = 0;
+    std::chrono::seconds ack_deadline;
+    std::int64_t outstanding_messages = 0;
+    std::int64_t outstanding_bytes = 0;
+  };
+
+  // Releases the flow control capacity used by a lease.
+  void Release(Lease const& lease) {
+    auto s = streams_.find(lease.stream_id);
+    if (s == streams_.end()) return;
+    --s->second.outstanding_messages;
+    s->second.outstanding_bytes -= lease.size;
+  }
+
+  void Redeliver(Lease lease) {
+    pending_.push_back(
+        Pending{std::move(lease.message), lease.delivery_attempt + 1});
+  }
+
+  void ExpireLeases(std::chrono::steady_clock::time_point now) {
+    for (auto i = leases_.begin(); i != leases_.end();) {
+      if (i->second.deadline > now) {
+        ++i;
+        continue;
+      }
+      Release(i->second);
+      Redeliver(std::move(i->second));
+      i = leases_.erase(i);
+    }
+  }
+
+  EmbeddedServerOptions const options_;
+  mutable std::mutex mu_;
+  std::condition_variable cv_;
+  google::cloud::internal::DefaultPRNG generator_;
+  std::string const synthetic_data_;
+  std::deque<Pending> pending_;
+  std::unordered_map<std::string, Lease> leases_;
+  std::unordered_map<std::int64_t, Stream> streams_;
+  std::chrono::steady_clock::time_point next_expiration_;
+  bool shutdown_ = false;
+  std::int64_t message_id_ = 0;
+  std::int64_t ack_id_ = 0;
+  std::int64_t stream_id_ = 0;
+  std::int64_t published_count_ = 0;
+  std::int64_t delivered_count_ = 0;
+  std::int64_t redelivered_count_ = 0;
+  std::int64_t ack_count_ = 0;
+  std::int64_t modify_ack_deadline_count_ = 0;
+};
+
+/**
+ * Adds the CPU time used by the current thread to a counter.
+ *
+ * The handlers run in threads owned by gRPC, measuring them is the only way
+ * to separate the server and client CPU usage within a single process.
+ */
+class HandlerCpuTimer {
+ public:
+  explicit HandlerCpuTimer(std::atomic<std::int64_t>& total)
+      : total_(total), timer_(Timer::PerThread()) {}
+  ~HandlerCpuTimer() { Flush(); }
+
+  /// Adds the CPU time used since the last call, for long-running handlers.
+  void Flush() {
+    total_.fetch_add(timer_.Sample().cpu_time.count());
+    timer_ = Timer::PerThread();
+  }
+
+ private:
+  std::atomic<std::int64_t>& total_;
+  Timer timer_;
+};
+
+/**
+ * Implement the `google.pubsub.v1.Publisher` RPCs used by the benchmarks.
+ *
+ * Like `SubscriberImpl`, this is not a Mock, nor a Fake (use the Cloud Pub/Sub
+ * Emulator for that). It only implements enough of the service to run the
+ * benchmarks.
+ */
+class PublisherImpl final : public pubsub_proto::Publisher::Service {
+ public:
+  PublisherImpl(Backlog& backlog, std::atomic<std::int64_t>& cpu_time)
+      : backlog_(backlog), cpu_time_(cpu_time) {}
+
+  grpc::Status Publish(grpc::ServerContext*,
+                       pubsub_proto::PublishRequest const* request,
+                       pubsub_proto::PublishResponse* response) override {
+    HandlerCpuTimer timer(cpu_time_);
+    for (auto& id : backlog_.Publish(request->messages())) {
+      response->add_message_ids(std::move(id));
+    }
+    return grpc::Status::OK;
+  }
+
+ private:
+  Backlog& backlog_;
+  std::atomic<std::int64_t>& cpu_time_;
+};
+
+/// Implement the `google.pubsub.v1.Subscriber` RPCs used by the benchmarks.
+class SubscriberImpl final : public pubsub_proto::Subscriber::Service {
+ public:
+  SubscriberImpl(Backlog& backlog, std::atomic<std::int64_t>& cpu_time)
+      : backlog_(backlog), cpu_time_(cpu_time) {}
+
+  grpc::Status Acknowledge(grpc::ServerContext*,
+                           pubsub_proto::AcknowledgeRequest const* request,
+                           google::protobuf::Empty*) override {
+    HandlerCpuTimer timer(cpu_time_);
+    backlog_.Acknowledge(request->ack_ids());
+    return grpc::Status::OK;
+  }
+
+  grpc::Status ModifyAckDeadline(
+      grpc::ServerContext*,
+      pubsub_proto::ModifyAckDeadlineRequest const* request,
+      google::protobuf::Empty*) override {
+    HandlerCpuTimer timer(cpu_time_);
+    backlog_.ModifyAckDeadline(request->ack_ids(),
+                               request->ack_deadline_seconds());
+    return grpc::Status::OK;
+  }
+
+  grpc::Status StreamingPull(
+      grpc::ServerContext* context,
+      grpc::ServerReaderWriter<pubsub_proto::StreamingPullResponse,
+                               pubsub_proto::StreamingPullRequest>* stream)
+      override {
+    HandlerCpuTimer timer(cpu_time_);
+    pubsub_proto::StreamingPullRequest request;
+    if (!stream->Read(&request)) return grpc::Status::OK;
+    ++streaming_pull_count_;
+    auto const id = backlog_.AddStream(request);
+    ProcessAcks(request);
+
+    // Acks and deadline changes arrive at any time, while this thread blocks
+    // waiting for messages, so read them in a separate thread.
+    std::atomic<bool> closed{false};
+    std::thread reader([this, stream, &closed] {
+      HandlerCpuTimer timer(cpu_time_);
+      pubsub_proto::StreamingPullRequest r;
+      while (stream->Read(&r)) {
+        ProcessAcks(r);
+        timer.Flush();
+      }
+      closed = true;
+    });
+    while (!closed && !context->IsCancelled() && !backlog_.shutdown()) {
+      auto messages = backlog_.Pull(id, kPullTimeout);
+      if (messages.empty()) continue;
+      pubsub_proto::StreamingPullResponse response;
+      for (auto& m : messages) *response.add_received_messages() = std::move(m);
+      if (!stream->Write(response)) break;
+      timer.Flush();
+    }
+    backlog_.RemoveStream(id);
+    context->TryCancel();
+    reader.join();
+    return grpc::Status::OK;
+  }
+
+  int streaming_pull_count() const { return streaming_pull_count_.load(); }
+
+ private:
+  void ProcessAcks(pubsub_proto::StreamingPullRequest const& request) {
+    if (!request.ack_ids().empty()) backlog_.Acknowledge(request.ack_ids());
+    if (request.modify_deadline_ack_ids().empty()) return;
+    // Each ack id has its own deadline, group them to reuse the `Backlog` API.
+    std::unordered_map<std::int32_t, AckIds> groups;
+    auto const size = (std::min)(request.modify_deadline_ack_ids_size(),
+                                 request.modify_deadline_seconds_size());
+    for (int i = 0; i != size; ++i) {
+      *groups[request.modify_deadline_seconds(i)].Add() =
+          request.modify_deadline_ack_ids(i);
+    }
+    for (auto const& g : groups) backlog_.ModifyAckDeadline(g.second, g.first);
+  }
+
+  Backlog& backlog_;
+  std::atomic<std::int64_t>& cpu_time_;
+  std::atomic<int> streaming_pull_count_{0};
+};
+
+/// The implementation of EmbeddedServer.
+class DefaultEmbeddedServer : public EmbeddedServer {
+ public:
+  explicit DefaultEmbeddedServer(EmbeddedServerOptions options)
+      : backlog_(std::move(options)),
+        publisher_(backlog_, cpu_time_),
+        subscriber_(backlog_, cpu_time_) {
+    int port;
+    grpc::ServerBuilder builder;
+    builder.AddListeningPort("[::]:0", grpc::InsecureServerCredentials(),
+                             &port);
+    builder.RegisterService(&publisher_);
+    builder.RegisterService(&subscriber_);
+    server_ = builder.BuildAndStart();
+    address_ = "localhost:" + std::to_string(port);
+  }
+
+  std::string address() const override { return address_; }
+  void Shutdown() override {
+    backlog_.Shutdown();
+    // The `StreamingPull()` streams only terminate when the client closes
+    // them, force them to terminate after a short time.
+    server_->Shutdown(std::chrono::system_clock::now() + kPullTimeout);
+  }
+  void Wait() override { server_->Wait(); }
+
+  std::int64_t published_count() const override {
+    return backlog_.published_count();
+  }
+  std::int64_t delivered_count() const override {
+    return backlog_.delivered_count();
+  }
+  std::int64_t redelivered_count() const override {
+    return backlog_.redelivered_count();
+  }
+  std::int64_t ack_count() const override { return backlog_.ack_count(); }
+  std::int64_t modify_ack_deadline_count() const override {
+    return backlog_.modify_ack_deadline_count();
+  }
+  int streaming_pull_count() const override {
+    return subscriber_.streaming_pull_count();
+  }
+  std::chrono::microseconds cpu_time() const override {
+    return std::chrono::microseconds(cpu_time_.load());
+  }
+
+ private:
+  std::atomic<std::int64_t> cpu_time_{0};
+  Backlog backlog_;
+  PublisherImpl publisher_;
+  SubscriberImpl subscriber_;
+  std::unique_ptr<grpc::Server> server_;
+  std::string address_;
+};
+
+}  // namespace
+
+std::unique_ptr<EmbeddedServer> CreateEmbeddedServer(
+    EmbeddedServerOptions options) {
+  return std::make_unique<DefaultEmbeddedServer>(std::move(options));
+}
+
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
+}  // namespace pubsub_benchmarks
+}  // namespace cloud
+}  // namespace google
@@ -0,0 +1,129 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GOOGLE_CLOUD_CPP_GOOGLE_CLOUD_PUBSUB_BENCHMARKS_EMBEDDED_SERVER_H
+#define GOOGLE_CLOUD_CPP_GOOGLE_CLOUD_PUBSUB_BENCHMARKS_EMBEDDED_SERVER_H
+
+#include "google/cloud/pubsub/version.h"
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace google {
+namespace cloud {
+namespace pubsub_benchmarks {
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_BEGIN
+
+/// Configure the behavior of the embedded Pub/Sub server.
+struct EmbeddedServerOptions {
+  /**
+   * The maximum number of messages in each `StreamingPullResponse`.
+   *
+   * The service sends messages in batches, the size of these batches affects
+   * the cost of dispatching messages in the client library.
+   */
+  int max_messages_per_response = 100;
+
+  /**
+   * The maximum number of messages delivered, but not acknowledged, in each
+   * `StreamingPull()` stream.
+   *
+   * The server uses the smallest of this value and the value in the
+   * `StreamingPullRequest`. Zero means no limit.
+   */
+  std::int64_t max_outstanding_messages = 1000;
+
+  /// Like `max_outstanding_messages`, but limits the size of the messages.
+  std::int64_t max_outstanding_bytes = 100 * 1024 * 1024;
+
+  /**
+   * The default ack deadline.
+   *
+   * Messages that are not acknowledged before their deadline expires are
+   * redelivered, as are messages with their deadline set to zero (nacked).
+   */
+  std::chrono::seconds ack_deadline = std::chrono::seconds(10);
+
+  /**
+   * Redeliver this fraction of the acknowledged messages, in the `[0.0, 1.0]`
+   * range.
+   *
+   * The service delivers messages at least once. Use this option to measure
+   * the cost of duplicate deliveries in the client library.
+   */
+  double redelivery_rate = 0.0;
+
+  /**
+   * If non-zero, generate messages of this size whenever there are no
+   * published messages to deliver.
+   *
+   * This makes it possible to measure the subscriber without running a
+   * publisher.
+   */
+  std::size_t synthetic_message_size = 0;
+};
+
+/**
+ * An abstract class to run and stop the embedded Pub/Sub server.
+ *
+ * The server implements `Publish()`, `StreamingPull()`, `Acknowledge()`, and
+ * `ModifyAckDeadline()` from `google.pubsub.v1`. Running the benchmarks
+ * against this server eliminates the network and the service from the
+ * measurements, only the client library and gRPC remain.
+ *
+ * All the topics and subscriptions share a single backlog of messages, the
+ * server does not validate or store their configuration.
+ */
+class EmbeddedServer {
+ public:
+  virtual ~EmbeddedServer() = default;
+
+  virtual std::string address() const = 0;
+  virtual void Shutdown() = 0;
+  virtual void Wait() = 0;
+
+  /// The number of messages received via `Publish()`.
+  virtual std::int64_t published_count() const = 0;
+  /// The number of messages sent via `StreamingPull()`, including redelivery.
+  virtual std::int64_t delivered_count() const = 0;
+  /// The number of messages delivered more than once.
+  virtual std::int64_t redelivered_count() const = 0;
+  /// The number of ack ids received via `Acknowledge()` or `StreamingPull()`.
+  virtual std::int64_t ack_count() const = 0;
+  /// The number of ack ids received via `ModifyAckDeadline()` or
+  /// `StreamingPull()`.
+  virtual std::int64_t modify_ack_deadline_count() const = 0;
+  /// The number of `StreamingPull()` streams.
+  virtual int streaming_pull_count() const = 0;
+  /**
+   * The CPU time used by the threads running the RPC handlers.
+   *
+   * This excludes any work done by gRPC in other threads. It is zero if the
+   * platform does not support per-thread CPU usage.
+   */
+  virtual std::chrono::microseconds cpu_time() const = 0;
+};
+
+/// Create an embedded server, listening on a random port in `localhost`.
+std::unique_ptr<EmbeddedServer> CreateEmbeddedServer(
+    EmbeddedServerOptions options = {});
+
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
+}  // namespace pubsub_benchmarks
+}  // namespace cloud
+}  // namespace google
+
+#endif  // GOOGLE_CLOUD_CPP_GOOGLE_CLOUD_PUBSUB_BENCHMARKS_EMBEDDED_SERVER_H
@@ -0,0 +1,174 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/pubsub/benchmarks/embedded_server.h"
+#include "google/cloud/pubsub/publisher.h"
+#include "google/cloud/pubsub/subscriber.h"
+#include "google/cloud/common_options.h"
+#include "google/cloud/grpc_options.h"
+#include "google/cloud/testing_util/status_matchers.h"
+#include <gmock/gmock.h>
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace google {
+namespace cloud {
+namespace pubsub_benchmarks {
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_BEGIN
+namespace {
+
+using ::std::chrono::milliseconds;
+
+Options TestOptions(EmbeddedServer const& server) {
+  return Options{}
+      .set<GrpcCredentialOption>(grpc::InsecureChannelCredentials())
+      .set<EndpointOption>(server.address());
+}
+
+pubsub::Publisher MakePublisher(EmbeddedServer const& server) {
+  return pubsub::Publisher(pubsub::MakePublisherConnection(
+      pubsub::Topic("fake-project", "fake-topic"), TestOptions(server)));
+}
+
+pubsub::Subscriber MakeSubscriber(EmbeddedServer const& server) {
+  return pubsub::Subscriber(pubsub::MakeSubscriberConnection(
+      pubsub::Subscription("fake-project", "fake-subscription"),
+      TestOptions(server)));
+}
+
+/// Wait until @p predicate is true, or a (generous) timeout expires.
+bool WaitFor(std::function<bool()> const& predicate) {
+  auto const deadline = std::chrono::steady_clock::now() + milliseconds(10000);
+  while (std::chrono::steady_clock::now() < deadline) {
+    if (predicate()) return true;
+    std::this_thread::sleep_for(milliseconds(10));
+  }
+  return predicate();
+}
+
+TEST(EmbeddedServer, WaitAndShutdown) {
+  auto server = CreateEmbeddedServer();
+  EXPECT_FALSE(server->address().empty());
+  EXPECT_EQ(server->cpu_time().count(), 0);
+
+  std::thread wait_thread([&server]() { server->Wait(); });
+  EXPECT_TRUE(wait_thread.joinable());
+  std::this_thread::sleep_for(milliseconds(20));
+  EXPECT_TRUE(wait_thread.joinable());
+  server->Shutdown();
+  wait_thread.join();
+}
+
+TEST(EmbeddedServer, PublishAndSubscribe) {
+  auto server = CreateEmbeddedServer();
+  std::thread wait_thread([&server]() { server->Wait(); });
+
+  auto publisher = MakePublisher(*server);
+  std::vector<future<StatusOr<std::string>>> ids;
+  for (int i = 0; i != 10; ++i) {
+    ids.push_back(publisher.Publish(
+        pubsub::MessageBuilder{}.SetData("msg-" + std::to_string(i)).Build()));
+  }
+  for (auto& id : ids) ASSERT_STATUS_OK(id.get());
+  EXPECT_EQ(10, server->published_count());
+
+  std::atomic<int> received{0};
+  auto subscriber = MakeSubscriber(*server);
+  auto session = subscriber.Subscribe(
+      [&received](pubsub::Message const& m, pubsub::AckHandler h) {
+        EXPECT_THAT(m.data(), ::testing::StartsWith("msg-"));
+        ++received;
+        std::move(h).ack();
+      });
+  EXPECT_TRUE(WaitFor([&] { return server->ack_count() >= 10; }));
+  session.cancel();
+  EXPECT_STATUS_OK(session.get());
+  EXPECT_EQ(10, received.load());
+  EXPECT_EQ(10, server->delivered_count());
+  EXPECT_EQ(0, server->redelivered_count());
+  EXPECT_LE(1, server->streaming_pull_count());
+
+  server->Shutdown();
+  wait_thread.join();
+}
+
+TEST(EmbeddedServer, NackRedelivers) {
+  auto server = CreateEmbeddedServer();
+  std::thread wait_thread([&server]() { server->Wait(); });
+
+  auto publisher = MakePublisher(*server);
+  ASSERT_STATUS_OK(
+      publisher.Publish(pubsub::MessageBuilder{}.SetData("nack-me").Build())
+          .get());
+
+  std::atomic<int> received{0};
+  auto subscriber = MakeSubscriber(*server);
+  auto session = subscriber.Subscribe(
+      [&received](pubsub::Message const&, pubsub::AckHandler h) {
+        if (++received == 1) return std::move(h).nack();
+        std::move(h).ack();
+      });
+  EXPECT_TRUE(WaitFor([&] { return server->ack_count() >= 1; }));
+  session.cancel();
+  EXPECT_STATUS_OK(session.get());
+  EXPECT_EQ(2, received.load());
+  EXPECT_EQ(1, server->redelivered_count());
+  EXPECT_LE(1, server->modify_ack_deadline_count());
+
+  server->Shutdown();
+  wait_thread.join();
+}
+
+TEST(EmbeddedServer, SyntheticMessagesAndFlowControl) {
+  EmbeddedServerOptions options;
+  options.synthetic_message_size = 128;
+  options.max_outstanding_messages = 5;
+  auto server = CreateEmbeddedServer(options);
+  std::thread wait_thread([&server]() { server->Wait(); });
+
+  std::mutex mu;
+  std::vector<pubsub::AckHandler> handlers;
+  auto subscriber = MakeSubscriber(*server);
+  auto session = subscriber.Subscribe(
+      [&](pubsub::Message const& m, pubsub::AckHandler h) {
+        EXPECT_EQ(std::size_t{128}, m.data().size());
+        std::lock_guard<std::mutex> lk(mu);
+        handlers.push_back(std::move(h));
+      });
+  EXPECT_TRUE(WaitFor([&] { return server->delivered_count() >= 5; }));
+  // Without acks, the server cannot deliver more messages.
+  std::this_thread::sleep_for(milliseconds(200));
+  EXPECT_EQ(5, server->delivered_count());
+
+  {
+    std::lock_guard<std::mutex> lk(mu);
+    for (auto& h : handlers) std::move(h).ack();
+    handlers.clear();
+  }
+  EXPECT_TRUE(WaitFor([&] { return server->delivered_count() > 5; }));
+  session.cancel();
+  EXPECT_STATUS_OK(session.get());
+
+  server->Shutdown();
+  wait_thread.join();
+}
+
+}  // namespace
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
+}  // namespace pubsub_benchmarks
+}  // namespace cloud
+}  // namespace google
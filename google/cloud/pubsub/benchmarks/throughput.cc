@@ -14,6 +14,7 @@
 
 #include "google/cloud/pubsub/admin/subscription_admin_client.h"
 #include "google/cloud/pubsub/admin/topic_admin_client.h"
+#include "google/cloud/pubsub/benchmarks/embedded_server.h"
 #include "google/cloud/pubsub/publisher.h"
 #include "google/cloud/pubsub/subscriber.h"
 #include "google/cloud/pubsub/testing/random_names.h"
@@ -48,6 +49,10 @@ A throughput vs. CPU benchmark for the Cloud Pub/Sub C++ client library.
 
 Measure the throughput for publishers and/or subscribers in the Cloud Pub/Sub
 C++ client library.
+
+The CPU usage is reported for the whole process. With an embedded server the
+CPU used by its RPC handlers is also reported, and subtracted from the process
+CPU to estimate the client CPU per message.
 )""";
 
 struct Config {
@@ -68,6 +73,8 @@ struct Config {
   std::int64_t publisher_pending_lwm = 112 * kMiB;
   std::int64_t publisher_pending_hwm = 128 * kMiB;
   std::int64_t publisher_target_messages_per_second = 1200 * 2000;
+  std::int64_t publisher_ordering_keys = 0;
+  bool publisher_multiplex_ordering_keys = false;
 
   bool subscriber = false;
   int subscriber_thread_count = 1;
@@ -82,6 +89,10 @@ struct Config {
   std::chrono::seconds minimum_runtime = std::chrono::seconds(5);
   std::chrono::seconds maximum_runtime = std::chrono::seconds(300);
 
+  bool embedded_server = false;
+  int embedded_server_max_messages_per_response = 100;
+  double embedded_server_redelivery_rate = 0.0;
+
   bool show_help = false;
 };
 
@@ -104,6 +115,10 @@ class Cleanup {
 void PublisherTask(Config const& config);
 void SubscriberTask(Config const& config);
 
+// The embedded server, if any. Its CPU usage is reported separately.
+google::cloud::pubsub_benchmarks::EmbeddedServer const* server_for_cpu =
+    nullptr;
+
 }  // namespace
 
 int main(int argc, char* argv[]) {
@@ -116,6 +131,34 @@ int main(int argc, char* argv[]) {
   if (config->show_help) return 0;
   auto const configured_topic = config->topic_id;
 
+  // With an embedded server the topic and subscription need not exist, and
+  // the subscriber can run without a publisher, using synthetic messages.
+  std::unique_ptr<google::cloud::pubsub_benchmarks::EmbeddedServer>
+      embedded_server;
+  std::thread embedded_server_thread;
+  if (config->embedded_server) {
+    google::cloud::pubsub_benchmarks::EmbeddedServerOptions options;
+    options.max_messages_per_response =
+        config->embedded_server_max_messages_per_response;
+    options.max_outstanding_messages = 0;
+    options.max_outstanding_bytes = 0;
+    options.redelivery_rate = config->embedded_server_redelivery_rate;
+    if (!config->publisher) {
+      options.synthetic_message_size =
+          static_cast<std::size_t>(config->payload_size);
+    }
+    embedded_server =
+        google::cloud::pubsub_benchmarks::CreateEmbeddedServer(options);
+    embedded_server_thread =
+        std::thread([&embedded_server] { embedded_server->Wait(); });
+    server_for_cpu = embedded_server.get();
+    config->endpoint = embedded_server->address();
+    if (config->topic_id.empty()) config->topic_id = "embedded-topic";
+    if (config->subscription_id.empty()) {
+      config->subscription_id = "embedded-subscription";
+    }
+  }
+
   auto generator = google::cloud::internal::MakeDefaultPRNG();
 
   Cleanup cleanup;
@@ -162,6 +205,7 @@ int main(int argc, char* argv[]) {
   auto const topic = pubsub::Topic(config->project_id, config->topic_id);
 
   std::cout << "timestamp,elapsed(us),op,iteration,count,msgs/s,bytes,MB/s"
+            << ",cpu(us),cpu/msg(us),server_cpu(us),client_cpu/msg(us)"
             << std::endl;
 
   std::vector<std::thread> tasks;
@@ -173,6 +217,18 @@ int main(int argc, char* argv[]) {
   }
   for (auto& t : tasks) t.join();
 
+  if (embedded_server) {
+    std::cout << "# Embedded Server: published_count="
+              << embedded_server->published_count()
+              << ", delivered_count=" << embedded_server->delivered_count()
+              << ", redelivered_count=" << embedded_server->redelivered_count()
+              << ", ack_count=" << embedded_server->ack_count()
+              << ", modify_ack_deadline_count="
+              << embedded_server->modify_ack_deadline_count() << std::endl;
+    embedded_server->Shutdown();
+    embedded_server_thread.join();
+  }
+
   return 0;
 }
 
@@ -197,9 +253,15 @@ std::string Timestamp() {
       std::chrono::system_clock::now());
 }
 
+std::chrono::microseconds ServerCpuTime() {
+  if (server_for_cpu == nullptr) return std::chrono::microseconds(0);
+  return server_for_cpu->cpu_time();
+}
+
 void PrintResult(std::string const& operation, int iteration,
                  std::int64_t count, std::int64_t bytes,
-                 Timer::Snapshot const& usage) {
+                 Timer::Snapshot const& usage,
+                 std::chrono::microseconds server_cpu) {
   using std::chrono::duration_cast;
   using std::chrono::microseconds;
   using std::chrono::seconds;
@@ -211,10 +273,22 @@ void PrintResult(std::string const& operation, int iteration,
   auto const msgs =
       absl::StrFormat("%.02f", static_cast<double>(count) * 1000000.0 /
                                    static_cast<double>(elapsed_us.count()));
+  // The CPU usage is for the whole process, including any other tasks and the
+  // embedded server (if any), it is an upper bound for the cost of each
+  // message. The client CPU usage excludes the embedded server handlers, but
+  // still includes the gRPC threads shared by the client and the server.
+  auto const cpu_us = usage.cpu_time.count();
+  auto const server_us = server_cpu.count();
+  auto per_msg = [count](std::int64_t us) {
+    if (count == 0) return absl::StrFormat("%.03f", 0.0);
+    return absl::StrFormat("%.03f", static_cast<double>(us) /
+                                        static_cast<double>(count));
+  };
   std::lock_guard<std::mutex> lk(cout_mu);
   std::cout << Timestamp() << ',' << elapsed_us.count() << ',' << operation
             << ',' << iteration << ',' << count << ',' << msgs << ',' << bytes
-            << ',' << mbs << std::endl;
+            << ',' << mbs << ',' << cpu_us << ',' << per_msg(cpu_us) << ','
+            << server_us << ',' << per_msg(cpu_us - server_us) << std::endl;
 }
 
 pubsub::Publisher CreatePublisher(Config const& config) {
@@ -229,6 +303,9 @@ pubsub::Publisher CreatePublisher(Config const& config) {
   if (!config.endpoint.empty()) {
     options.set<gc::EndpointOption>(config.endpoint);
   }
+  if (config.embedded_server) {
+    options.set<gc::GrpcCredentialOption>(grpc::InsecureChannelCredentials());
+  }
   if (config.publisher_io_threads != 0) {
     options.set<gc::GrpcBackgroundThreadPoolSizeOption>(
         config.publisher_io_threads);
@@ -237,6 +314,11 @@ pubsub::Publisher CreatePublisher(Config const& config) {
     options.set<google::cloud::GrpcNumChannelsOption>(
         config.publisher_io_channels);
   }
+  if (config.publisher_ordering_keys != 0) {
+    options.set<pubsub::MessageOrderingOption>(true)
+        .set<pubsub::MultiplexOrderingKeysOption>(
+            config.publisher_multiplex_ordering_keys);
+  }
 
   return pubsub::Publisher(pubsub::MakePublisherConnection(
       pubsub::Topic(config.project_id, config.topic_id), std::move(options)));
@@ -297,6 +379,7 @@ class PublishWorker {
                              {"sequenceNumber", std::to_string(i)},
                          })
                          .SetData(data)
+                         .SetOrderingKey(OrderingKey(i))
                          .Build();
       auto const bytes = MessageSize(message);
       publisher.Publish(std::move(message))
@@ -321,6 +404,12 @@ class PublishWorker {
   std::int64_t lwm_count() const { return lwm_count_; }
 
  private:
+  std::string OrderingKey(std::int64_t i) const {
+    if (config_.publisher_ordering_keys == 0) return {};
+    return "key-" + std::to_string(id_) + "-" +
+           std::to_string(i % config_.publisher_ordering_keys);
+  }
+
   bool NotShutdownAndReady() {
     std::unique_lock<std::mutex> lk(mu_);
     cv_.wait(lk, [&] { return !blocked_ || shutdown_; });
@@ -378,7 +467,8 @@ void PublisherTask(Config const& config) {
   auto const start = std::chrono::steady_clock::now();
   for (int i = 0; !Done(config, i, start); ++i) {
     using std::chrono::steady_clock;
-    auto timer = Timer::PerThread();
+    auto timer = Timer::PerProcess();
+    auto const start_server_cpu = ServerCpuTime();
     auto const start_send_count = send_count.load();
     auto const start_send_bytes = send_bytes.load();
     auto const start_ack_count = ack_count.load();
@@ -389,8 +479,9 @@ void PublisherTask(Config const& config) {
     auto const ack_count_last = ack_count.load() - start_ack_count;
     auto const ack_bytes_last = ack_bytes.load() - start_ack_bytes;
     auto const usage = timer.Sample();
-    PrintResult("Pub", i, send_count_last, send_bytes_last, usage);
-    PrintResult("Ack", i, ack_count_last, ack_bytes_last, usage);
+    auto const server_cpu = ServerCpuTime() - start_server_cpu;
+    PrintResult("Pub", i, send_count_last, send_bytes_last, usage, server_cpu);
+    PrintResult("Ack", i, ack_count_last, ack_bytes_last, usage, server_cpu);
   }
 
   for (auto& w : workers) w->Shutdown();
@@ -425,6 +516,9 @@ pubsub::Subscriber CreateSubscriber(Config const& config) {
   if (!config.endpoint.empty()) {
     options.set<gc::EndpointOption>(config.endpoint);
   }
+  if (config.embedded_server) {
+    options.set<gc::GrpcCredentialOption>(grpc::InsecureChannelCredentials());
+  }
   if (config.subscriber_io_threads != 0) {
     options.set<gc::GrpcBackgroundThreadPoolSizeOption>(
         config.subscriber_io_threads);
@@ -462,14 +556,16 @@ void SubscriberTask(Config const& config) {
   auto const start = std::chrono::steady_clock::now();
   for (int i = 0; !Done(config, i, start); ++i) {
     using std::chrono::steady_clock;
-    auto timer = Timer::PerThread();
+    auto timer = Timer::PerProcess();
+    auto const start_server_cpu = ServerCpuTime();
     auto const start_count = received_count.load();
     auto const start_bytes = received_bytes.load();
     std::this_thread::sleep_for(config.iteration_duration);
     auto const count = received_count.load() - start_count;
     auto const bytes = received_bytes.load() - start_bytes;
     auto const usage = timer.Sample();
-    PrintResult("Sub", i, count, bytes, usage);
+    PrintResult("Sub", i, count, bytes, usage,
+                ServerCpuTime() - start_server_cpu);
   }
   for (auto& s : sessions) s.cancel();
   Status last_status;
@@ -499,7 +595,10 @@ void PrintPublisher(std::ostream& os, Config const& config) {
      << "\n# Publisher Pending HWM: "
      << FormatSize(config.publisher_pending_hwm)
      << "\n# Publisher Target messages/s: "
-     << config.publisher_target_messages_per_second;
+     << config.publisher_target_messages_per_second
+     << "\n# Publisher Ordering Keys: " << config.publisher_ordering_keys
+     << "\n# Publisher Multiplex Ordering Keys: "
+     << config.publisher_multiplex_ordering_keys;
 }
 
 void PrintSubscriber(std::ostream& os, Config const& config) {
@@ -526,7 +625,14 @@ void Print(std::ostream& os, Config const& config) {
      << "\n# Minimum Samples: " << config.minimum_samples
      << "\n# Maximum Samples: " << config.maximum_samples
      << "\n# Minimum Runtime: " << config.minimum_runtime.count() << "s"
-     << "\n# Maximum Runtime: " << config.maximum_runtime.count() << "s";
+     << "\n# Maximum Runtime: " << config.maximum_runtime.count() << "s"
+     << "\n# Embedded Server: " << std::boolalpha << config.embedded_server;
+  if (config.embedded_server) {
+    os << "\n# Embedded Server Max Messages per Response: "
+       << config.embedded_server_max_messages_per_response
+       << "\n# Embedded Server Redelivery Rate: "
+       << config.embedded_server_redelivery_rate;
+  }
   if (config.publisher) PrintPublisher(os, config);
   if (config.subscriber) PrintSubscriber(os, config);
   os << std::endl;
@@ -616,6 +722,18 @@ google::cloud::StatusOr<Config> ParseArgsImpl(std::vector<std::string> args,
        [&options](std::string const& val) {
          options.publisher_target_messages_per_second = std::stol(val);
        }},
+      {"--publisher-ordering-keys",
+       "the number of distinct ordering keys used by each publisher task."
+       " If set to 0 the messages have no ordering key.",
+       [&options](std::string const& val) {
+         options.publisher_ordering_keys = std::stol(val);
+       }},
+      {"--publisher-multiplex-ordering-keys",
+       "batch messages with different ordering keys together",
+       [&options](std::string const& val) {
+         options.publisher_multiplex_ordering_keys =
+             ParseBoolean(val).value_or(true);
+       }},
 
       {"--subscriber", "run a subscriber in this program",
        [&options](std::string const& val) {
@@ -668,6 +786,23 @@ google::cloud::StatusOr<Config> ParseArgsImpl(std::vector<std::string> args,
        [&options](std::string const& val) {
          options.maximum_runtime = ParseDuration(val);
        }},
+
+      {"--embedded-server",
+       "run against an in-process server, without network or service costs",
+       [&options](std::string const& val) {
+         options.embedded_server = ParseBoolean(val).value_or(true);
+       }},
+      {"--embedded-server-max-messages-per-response",
+       "the maximum number of messages in each StreamingPull response from"
+       " the embedded server",
+       [&options](std::string const& val) {
+         options.embedded_server_max_messages_per_response = std::stoi(val);
+       }},
+      {"--embedded-server-redelivery-rate",
+       "the fraction of acked messages redelivered by the embedded server",
+       [&options](std::string const& val) {
+         options.embedded_server_redelivery_rate = std::stod(val);
+       }},
   };
   auto const usage = BuildUsage(desc, args[0]);
   auto unparsed = OptionsParse(desc, args);
@@ -682,11 +817,21 @@ google::cloud::StatusOr<Config> ParseArgsImpl(std::vector<std::string> args,
     return options;
   }
 
+  if (options.embedded_server && options.project_id.empty()) {
+    options.project_id = "embedded-project";
+  }
+
   if (options.project_id.empty()) {
     return google::cloud::internal::InvalidArgumentError(
         "missing or empty --project-id option");
   }
 
+  if (options.embedded_server_redelivery_rate < 0.0 ||
+      options.embedded_server_redelivery_rate > 1.0) {
+    return google::cloud::internal::InvalidArgumentError(
+        "--embedded-server-redelivery-rate must be in the [0.0, 1.0] range");
+  }
+
   return options;
 }
 
@@ -718,6 +863,12 @@ google::cloud::StatusOr<Config> SelfTest(std::string const& cmd) {
   if (!config) return error("--subscription-id", GCP_ERROR_INFO());
   config = ParseArgsImpl({cmd, "--endpoint=test"}, kDescription);
   if (!config) return error("--endpoint", GCP_ERROR_INFO());
+  config = ParseArgsImpl({cmd, "--embedded-server-redelivery-rate=2"},
+                         kDescription);
+  if (config) {
+    return error("--embedded-server-redelivery-rate validation",
+                 GCP_ERROR_INFO());
+  }
 
   return ParseArgsImpl(
       {
@@ -732,6 +883,8 @@ google::cloud::StatusOr<Config> SelfTest(std::string const& cmd) {
           "--publisher-pending-lwm=8MiB",
           "--publisher-pending-hwm=10MiB",
           "--publisher-target-messages-per-second=1000000",
+          "--publisher-ordering-keys=1000",
+          "--publisher-multiplex-ordering-keys=true",
           "--subscriber=true",
           "--subscriber-thread-count=1",
           "--subscriber-io-threads=1",
@@ -75,6 +75,7 @@ google_cloud_cpp_pubsub_hdrs = [
     "internal/message_callback.h",
     "internal/message_carrier.h",
     "internal/message_propagator.h",
+    "internal/multiplexing_publisher_connection.h",
     "internal/noop_message_callback.h",
     "internal/ordering_key_publisher_connection.h",
     "internal/publisher_auth_decorator.h",
@@ -201,6 +202,7 @@ google_cloud_cpp_pubsub_srcs = [
     "internal/flow_controlled_publisher_tracing_connection.cc",
     "internal/message_carrier.cc",
     "internal/message_propagator.cc",
+    "internal/multiplexing_publisher_connection.cc",
     "internal/ordering_key_publisher_connection.cc",
     "internal/publisher_auth_decorator.cc",
     "internal/publisher_logging_decorator.cc",
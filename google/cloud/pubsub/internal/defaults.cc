@@ -113,6 +113,9 @@ Options DefaultPublisherOptionsOnly(Options opts) {
   if (!opts.has<pubsub::MessageOrderingOption>()) {
     opts.set<pubsub::MessageOrderingOption>(false);
   }
+  if (!opts.has<pubsub::MultiplexOrderingKeysOption>()) {
+    opts.set<pubsub::MultiplexOrderingKeysOption>(false);
+  }
   if (!opts.has<pubsub::FullPublisherActionOption>()) {
     opts.set<pubsub::FullPublisherActionOption>(
         pubsub::FullPublisherAction::kBlocks);
@@ -151,6 +151,7 @@ TEST(OptionsTest, PublisherDefaults) {
   EXPECT_EQ((std::numeric_limits<std::size_t>::max)(),
             opts.get<pubsub::MaxPendingMessagesOption>());
   EXPECT_FALSE(opts.get<pubsub::MessageOrderingOption>());
+  EXPECT_FALSE(opts.get<pubsub::MultiplexOrderingKeysOption>());
   EXPECT_EQ(pubsub::FullPublisherAction::kBlocks,
             opts.get<pubsub::FullPublisherActionOption>());
   EXPECT_EQ(GRPC_COMPRESS_DEFLATE,
@@ -168,6 +169,8 @@ TEST(OptionsTest, UserSetPublisherOptions) {
                                   .set<pubsub::MaxPendingBytesOption>(3)
                                   .set<pubsub::MaxPendingMessagesOption>(4)
                                   .set<pubsub::MessageOrderingOption>(true)
+                                  .set<pubsub::MultiplexOrderingKeysOption>(
+                                      true)
                                   .set<pubsub::FullPublisherActionOption>(
                                       pubsub::FullPublisherAction::kIgnored)
                                   .set<pubsub::MaxOtelLinkCountOption>(1));
@@ -178,6 +181,7 @@ TEST(OptionsTest, UserSetPublisherOptions) {
   EXPECT_EQ(3U, opts.get<pubsub::MaxPendingBytesOption>());
   EXPECT_EQ(4U, opts.get<pubsub::MaxPendingMessagesOption>());
   EXPECT_TRUE(opts.get<pubsub::MessageOrderingOption>());
+  EXPECT_TRUE(opts.get<pubsub::MultiplexOrderingKeysOption>());
   EXPECT_EQ(pubsub::FullPublisherAction::kIgnored,
             opts.get<pubsub::FullPublisherActionOption>());
   EXPECT_EQ(1U, opts.get<pubsub::MaxOtelLinkCountOption>());
@@ -0,0 +1,246 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/pubsub/internal/multiplexing_publisher_connection.h"
+#include "google/cloud/internal/make_status.h"
+#include <chrono>
+
+namespace google {
+namespace cloud {
+namespace pubsub_internal {
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_BEGIN
+
+struct MultiplexedBatch {
+  std::vector<promise<StatusOr<std::string>>> waiters;
+  std::vector<std::string> ordering_keys;
+  std::weak_ptr<MultiplexingPublisherConnection> weak;
+
+  void operator()(future<StatusOr<google::pubsub::v1::PublishResponse>> f) {
+    auto response = f.get();
+    auto status = response ? Status{} : response.status();
+    if (!response) {
+      SatisfyAllWaiters(status);
+    } else if (static_cast<std::size_t>(response->message_ids_size()) !=
+               waiters.size()) {
+      SatisfyAllWaiters(internal::UnknownError("mismatched message id count",
+                                               GCP_ERROR_INFO()));
+    } else {
+      int idx = 0;
+      for (auto& w : waiters) {
+        w.set_value(std::move(*response->mutable_message_ids(idx++)));
+      }
+    }
+    if (auto self = weak.lock()) self->OnBatchDone(ordering_keys, status);
+  }
+
+  void SatisfyAllWaiters(Status const& status) {
+    for (auto& w : waiters) w.set_value(status);
+  }
+};
+
+MultiplexingPublisherConnection::~MultiplexingPublisherConnection() {
+  if (timer_.valid()) timer_.cancel();
+}
+
+future<StatusOr<std::string>> MultiplexingPublisherConnection::Publish(
+    PublishParams p) {
+  sink_->AddMessage(p.message);
+  Waiter waiter;
+  auto f = waiter.get_future();
+  auto const ordering_key = p.message.ordering_key();
+
+  std::vector<OutgoingBatch> batches;
+  std::unique_lock<std::mutex> lk(mu_);
+  KeyState* state = nullptr;
+  if (!ordering_key.empty()) {
+    state = &keys_[ordering_key];
+    if (!state->corked_on_status.ok()) {
+      SatisfyAsync(std::move(waiter), state->corked_on_status);
+      return f;
+    }
+    // The key has messages in an outstanding call, this message must wait
+    // until that call completes.
+    if (InFlight(*state) || !state->held.empty()) {
+      state->held.push_back({std::move(p.message), std::move(waiter)});
+      return f;
+    }
+  }
+  AddToBatch(ordering_key, state, std::move(p.message), std::move(waiter),
+             batches);
+  auto const timer = TimerNeeded();
+  lk.unlock();
+  Send(std::move(batches));
+  if (timer != 0) StartTimer(timer);
+  return f;
+}
+
+void MultiplexingPublisherConnection::Flush(FlushParams) {
+  std::vector<OutgoingBatch> batches;
+  {
+    std::lock_guard<std::mutex> lk(mu_);
+    if (waiters_.empty()) return;
+    batches.push_back(TakeBatch());
+  }
+  Send(std::move(batches));
+}
+
+void MultiplexingPublisherConnection::ResumePublish(ResumePublishParams p) {
+  {
+    std::lock_guard<std::mutex> lk(mu_);
+    auto i = keys_.find(p.ordering_key);
+    if (i != keys_.end()) {
+      i->second.corked_on_status = {};
+      if (IsIdle(i->second)) keys_.erase(i);
+    }
+  }
+  sink_->ResumePublish(p.ordering_key);
+}
+
+void MultiplexingPublisherConnection::OnBatchDone(
+    std::vector<std::string> const& ordering_keys, Status const& status) {
+  std::vector<OutgoingBatch> batches;
+  std::unique_lock<std::mutex> lk(mu_);
+  for (auto const& key : ordering_keys) {
+    auto i = keys_.find(key);
+    if (i == keys_.end()) continue;
+    auto& state = i->second;
+    state.batch = 0;
+    if (!status.ok()) {
+      // Like `BatchingPublisherConnection`, an error rejects any messages
+      // waiting for this key, and any new messages until the application
+      // calls `ResumePublish()`.
+      state.corked_on_status = status;
+      for (auto& h : state.held) SatisfyAsync(std::move(h.waiter), status);
+      state.held.clear();
+      continue;
+    }
+    // Move the held messages to the current batch. Once a batch with messages
+    // for this key is sent, because it filled up or the next message does not
+    // fit, the remaining messages wait for that call to complete.
+    while (!state.held.empty() && !InFlight(state)) {
+      auto h = std::move(state.held.front());
+      state.held.pop_front();
+      AddToBatch(key, &state, std::move(h.message), std::move(h.waiter),
+                 batches);
+    }
+    if (IsIdle(state)) keys_.erase(i);
+  }
+  auto const timer = TimerNeeded();
+  lk.unlock();
+  Send(std::move(batches));
+  if (timer != 0) StartTimer(timer);
+}
+
+void MultiplexingPublisherConnection::AddToBatch(
+    std::string const& ordering_key, KeyState* state, pubsub::Message m,
+    Waiter w, std::vector<OutgoingBatch>& batches) {
+  auto const bytes = MessageSize(m);
+  auto const max_bytes = opts_.get<pubsub::MaxBatchBytesOption>();
+  auto const max_messages = opts_.get<pubsub::MaxBatchMessagesOption>();
+  // If empty we need to create the batch, even if it would be oversized,
+  // otherwise the message may be dropped.
+  if (!waiters_.empty() && current_bytes_ + bytes > max_bytes) {
+    batches.push_back(TakeBatch());
+    // The batch just taken has messages for this key, and becomes an
+    // outstanding call. Sending this message in a different call could
+    // reorder the messages, it must wait until the call completes. The caller
+    // always passes the oldest message for the key, so it goes to the front.
+    if (state != nullptr && InFlight(*state)) {
+      state->held.push_front({std::move(m), std::move(w)});
+      return;
+    }
+  }
+  *pending_.add_messages() = ToProto(std::move(m));
+  waiters_.push_back(std::move(w));
+  current_bytes_ += bytes;
+  if (state != nullptr && state->batch != current_batch_) {
+    state->batch = current_batch_;
+    pending_keys_.push_back(ordering_key);
+  }
+  if (waiters_.size() >= max_messages || current_bytes_ >= max_bytes) {
+    batches.push_back(TakeBatch());
+  }
+}
+
+MultiplexingPublisherConnection::OutgoingBatch
+MultiplexingPublisherConnection::TakeBatch() {
+  OutgoingBatch batch;
+  batch.request.Swap(&pending_);
+  batch.request.set_topic(topic_full_name_);
+  batch.waiters.swap(waiters_);
+  batch.ordering_keys.swap(pending_keys_);
+  // Reserve enough capacity for the next batch.
+  pending_.mutable_messages()->Reserve(
+      static_cast<int>(opts_.get<pubsub::MaxBatchMessagesOption>()));
+  current_bytes_ = 0;
+  ++current_batch_;
+  return batch;
+}
+
+// Returns the current batch if it needs a timer, or 0 if it does not.
+std::uint64_t MultiplexingPublisherConnection::TimerNeeded() {
+  if (waiters_.empty() || timer_batch_ == current_batch_) return 0;
+  timer_batch_ = current_batch_;
+  return current_batch_;
+}
+
+void MultiplexingPublisherConnection::Send(std::vector<OutgoingBatch> batches) {
+  if (batches.empty()) return;
+  auto weak =
+      std::weak_ptr<MultiplexingPublisherConnection>(shared_from_this());
+  for (auto& b : batches) {
+    sink_->AsyncPublish(std::move(b.request))
+        .then(MultiplexedBatch{std::move(b.waiters),
+                               std::move(b.ordering_keys), weak});
+  }
+}
+
+void MultiplexingPublisherConnection::StartTimer(std::uint64_t batch) {
+  // We need a weak_ptr<> because this class owns the completion queue,
+  // creating a lambda with a shared_ptr<> owning this class would create a
+  // cycle.
+  auto weak =
+      std::weak_ptr<MultiplexingPublisherConnection>(shared_from_this());
+  auto timer =
+      cq_.MakeRelativeTimer(opts_.get<pubsub::MaxHoldTimeOption>())
+          .then([weak, batch](
+                    future<StatusOr<std::chrono::system_clock::time_point>>) {
+            if (auto self = weak.lock()) self->OnTimer(batch);
+          });
+  std::lock_guard<std::mutex> lk(mu_);
+  timer_ = std::move(timer);
+}
+
+void MultiplexingPublisherConnection::OnTimer(std::uint64_t batch) {
+  std::vector<OutgoingBatch> batches;
+  {
+    std::lock_guard<std::mutex> lk(mu_);
+    // The batch may have been sent already, because it filled up or due to a
+    // call to `Flush()`.
+    if (batch != current_batch_ || waiters_.empty()) return;
+    batches.push_back(TakeBatch());
+  }
+  Send(std::move(batches));
+}
+
+void MultiplexingPublisherConnection::SatisfyAsync(Waiter w, Status status) {
+  cq_.RunAsync([w = std::move(w), status = std::move(status)]() mutable {
+    w.set_value(std::move(status));
+  });
+}
+
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
+}  // namespace pubsub_internal
+}  // namespace cloud
+}  // namespace google
@@ -0,0 +1,150 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GOOGLE_CLOUD_CPP_GOOGLE_CLOUD_PUBSUB_INTERNAL_MULTIPLEXING_PUBLISHER_CONNECTION_H
+#define GOOGLE_CLOUD_CPP_GOOGLE_CLOUD_PUBSUB_INTERNAL_MULTIPLEXING_PUBLISHER_CONNECTION_H
+
+#include "google/cloud/pubsub/internal/batch_sink.h"
+#include "google/cloud/pubsub/publisher_connection.h"
+#include "google/cloud/pubsub/version.h"
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace google {
+namespace cloud {
+namespace pubsub_internal {
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_BEGIN
+
+/**
+ * Batches messages with different ordering keys together.
+ *
+ * `OrderingKeyPublisherConnection` creates a `BatchingPublisherConnection`,
+ * with its own batch and timer, for each ordering key. With many distinct
+ * ordering keys most of these batches contain a single message. This class
+ * uses a single batch for all the ordering keys instead. A `PublishRequest`
+ * may contain messages with different ordering keys, as long as the messages
+ * for each key are in order.
+ *
+ * To preserve the order, the messages for an ordering key are never in more
+ * than one outstanding `AsyncPublish()` call. While a call is outstanding, any
+ * new messages for its ordering keys are held, and moved to the next batch
+ * once the call completes.
+ *
+ * The class only keeps state for ordering keys with messages in the current
+ * batch, in an outstanding call, or held. It also keeps the state for keys
+ * stopped by an error, until the application calls `ResumePublish()`. All
+ * other keys are evicted as soon as their last call completes.
+ */
+class MultiplexingPublisherConnection
+    : public pubsub::PublisherConnection,
+      public std::enable_shared_from_this<MultiplexingPublisherConnection> {
+ public:
+  ~MultiplexingPublisherConnection() override;
+
+  static std::shared_ptr<MultiplexingPublisherConnection> Create(
+      pubsub::Topic topic, Options opts, std::shared_ptr<BatchSink> sink,
+      CompletionQueue cq) {
+    return std::shared_ptr<MultiplexingPublisherConnection>(
+        new MultiplexingPublisherConnection(std::move(topic), std::move(opts),
+                                            std::move(sink), std::move(cq)));
+  }
+
+  future<StatusOr<std::string>> Publish(PublishParams p) override;
+  void Flush(FlushParams) override;
+  void ResumePublish(ResumePublishParams p) override;
+
+  void OnBatchDone(std::vector<std::string> const& ordering_keys,
+                   Status const& status);
+
+  // Useful for testing.
+  std::size_t KeyCount() {
+    std::lock_guard<std::mutex> lk(mu_);
+    return keys_.size();
+  }
+
+ private:
+  explicit MultiplexingPublisherConnection(pubsub::Topic topic, Options opts,
+                                           std::shared_ptr<BatchSink> sink,
+                                           CompletionQueue cq)
+      : topic_full_name_(topic.FullName()),
+        opts_(std::move(opts)),
+        sink_(std::move(sink)),
+        cq_(std::move(cq)) {}
+
+  using Waiter = promise<StatusOr<std::string>>;
+
+  struct HeldMessage {
+    pubsub::Message message;
+    Waiter waiter;
+  };
+
+  struct KeyState {
+    // The batch with the most recent messages for this key, 0 if none.
+    std::uint64_t batch = 0;
+    std::deque<HeldMessage> held;
+    Status corked_on_status;
+  };
+
+  struct OutgoingBatch {
+    google::pubsub::v1::PublishRequest request;
+    std::vector<Waiter> waiters;
+    std::vector<std::string> ordering_keys;
+  };
+
+  bool IsIdle(KeyState const& state) const {
+    return state.batch == 0 && state.held.empty() &&
+           state.corked_on_status.ok();
+  }
+  bool InFlight(KeyState const& state) const {
+    return state.batch != 0 && state.batch != current_batch_;
+  }
+
+  void AddToBatch(std::string const& ordering_key, KeyState* state,
+                  pubsub::Message m, Waiter w,
+                  std::vector<OutgoingBatch>& batches);
+  OutgoingBatch TakeBatch();
+  std::uint64_t TimerNeeded();
+  void Send(std::vector<OutgoingBatch> batches);
+  void StartTimer(std::uint64_t batch);
+  void OnTimer(std::uint64_t batch);
+  void SatisfyAsync(Waiter w, Status status);
+
+  std::string const topic_full_name_;
+  Options const opts_;
+  std::shared_ptr<BatchSink> const sink_;
+  CompletionQueue cq_;
+
+  std::mutex mu_;
+  google::pubsub::v1::PublishRequest pending_;
+  std::vector<Waiter> waiters_;
+  std::vector<std::string> pending_keys_;
+  std::size_t current_bytes_ = 0;
+  // Batches are numbered starting at 1, so 0 can mean "no batch".
+  std::uint64_t current_batch_ = 1;
+  std::uint64_t timer_batch_ = 0;
+  future<void> timer_;
+  std::unordered_map<std::string, KeyState> keys_;
+};
+
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
+}  // namespace pubsub_internal
+}  // namespace cloud
+}  // namespace google
+
+#endif  // GOOGLE_CLOUD_CPP_GOOGLE_CLOUD_PUBSUB_INTERNAL_MULTIPLEXING_PUBLISHER_CONNECTION_H
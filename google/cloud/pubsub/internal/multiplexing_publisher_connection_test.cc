@@ -0,0 +1,301 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/pubsub/internal/multiplexing_publisher_connection.h"
+#include "google/cloud/pubsub/internal/defaults.h"
+#include "google/cloud/pubsub/testing/mock_batch_sink.h"
+#include "google/cloud/future.h"
+#include "google/cloud/internal/background_threads_impl.h"
+#include "google/cloud/testing_util/async_sequencer.h"
+#include "google/cloud/testing_util/status_matchers.h"
+#include <gmock/gmock.h>
+#include <chrono>
+#include <string>
+#include <vector>
+
+namespace google {
+namespace cloud {
+namespace pubsub_internal {
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_BEGIN
+namespace {
+
+using ::google::cloud::testing_util::AsyncSequencer;
+using ::google::cloud::testing_util::IsOkAndHolds;
+using ::google::cloud::testing_util::StatusIs;
+using ::testing::_;
+using ::testing::AtLeast;
+using ::testing::ElementsAre;
+using ::testing::HasSubstr;
+
+google::pubsub::v1::PublishResponse MakeResponse(
+    google::pubsub::v1::PublishRequest const& request) {
+  google::pubsub::v1::PublishResponse response;
+  for (auto const& m : request.messages()) {
+    response.add_message_ids("id-" + std::string(m.data()));
+  }
+  return response;
+}
+
+std::vector<std::string> MessagesData(
+    google::pubsub::v1::PublishRequest const& request) {
+  std::vector<std::string> data;
+  for (auto const& m : request.messages()) data.emplace_back(m.data());
+  return data;
+}
+
+pubsub::Message MakeMessage(std::string const& data, std::string key) {
+  return pubsub::MessageBuilder{}
+      .SetData(data)
+      .SetOrderingKey(std::move(key))
+      .Build();
+}
+
+Options TestOptions(std::size_t max_batch_messages) {
+  // Make the hold time so large that the test times out before it expires,
+  // the tests control when batches are sent.
+  return DefaultPublisherOptions(
+      Options{}
+          .set<pubsub::MaxBatchMessagesOption>(max_batch_messages)
+          .set<pubsub::MaxHoldTimeOption>(std::chrono::hours(24)));
+}
+
+TEST(MultiplexingPublisherConnectionTest, BatchesManyKeys) {
+  auto mock = std::make_shared<pubsub_testing::MockBatchSink>();
+  pubsub::Topic const topic("test-project", "test-topic");
+
+  EXPECT_CALL(*mock, AddMessage(_)).Times(4);
+  EXPECT_CALL(*mock, AsyncPublish)
+      .WillOnce([&](google::pubsub::v1::PublishRequest const& request) {
+        EXPECT_EQ(topic.FullName(), request.topic());
+        EXPECT_THAT(MessagesData(request), ElementsAre("d0", "d1", "d2", "d3"));
+        return make_ready_future(make_status_or(MakeResponse(request)));
+      });
+
+  // Create an inactive queue, the timers never expire.
+  CompletionQueue cq;
+  auto publisher = MultiplexingPublisherConnection::Create(
+      topic, TestOptions(4), mock, cq);
+  std::vector<future<StatusOr<std::string>>> results;
+  for (int i = 0; i != 4; ++i) {
+    auto const id = std::to_string(i);
+    results.push_back(publisher->Publish({MakeMessage("d" + id, "key-" + id)}));
+  }
+  for (int i = 0; i != 4; ++i) {
+    EXPECT_THAT(results[i].get(), IsOkAndHolds("id-d" + std::to_string(i)));
+  }
+  // All the keys are idle, there is no need to keep any state for them.
+  EXPECT_EQ(publisher->KeyCount(), 0U);
+}
+
+TEST(MultiplexingPublisherConnectionTest, PreservesOrderWithinKey) {
+  auto mock = std::make_shared<pubsub_testing::MockBatchSink>();
+  pubsub::Topic const topic("test-project", "test-topic");
+
+  AsyncSequencer<void> async;
+  std::vector<std::vector<std::string>> requests;
+  EXPECT_CALL(*mock, AddMessage(_)).Times(AtLeast(1));
+  EXPECT_CALL(*mock, AsyncPublish)
+      .Times(3)
+      .WillRepeatedly([&](google::pubsub::v1::PublishRequest const& request) {
+        requests.push_back(MessagesData(request));
+        return async.PushBack().then([request](future<void>) {
+          return make_status_or(MakeResponse(request));
+        });
+      });
+
+  CompletionQueue cq;
+  auto publisher = MultiplexingPublisherConnection::Create(
+      topic, TestOptions(2), mock, cq);
+  // This fills the first batch, and sends it.
+  auto a = publisher->Publish({MakeMessage("a", "k1")});
+  auto b = publisher->Publish({MakeMessage("b", "k1")});
+  ASSERT_THAT(requests, ElementsAre(ElementsAre("a", "b")));
+
+  // `k1` has an outstanding call, `c` must wait, but `d` can be sent.
+  auto c = publisher->Publish({MakeMessage("c", "k1")});
+  auto d = publisher->Publish({MakeMessage("d", "k2")});
+  auto e = publisher->Publish({MakeMessage("e", "")});
+  ASSERT_THAT(requests,
+              ElementsAre(ElementsAre("a", "b"), ElementsAre("d", "e")));
+  EXPECT_EQ(publisher->KeyCount(), 2U);
+
+  // Completing the first call moves `c` to the next batch.
+  async.PopFront().set_value();
+  EXPECT_THAT(a.get(), IsOkAndHolds("id-a"));
+  EXPECT_THAT(b.get(), IsOkAndHolds("id-b"));
+  publisher->Flush({});
+  ASSERT_THAT(requests, ElementsAre(ElementsAre("a", "b"),
+                                    ElementsAre("d", "e"), ElementsAre("c")));
+
+  async.PopFront().set_value();
+  async.PopFront().set_value();
+  EXPECT_THAT(c.get(), IsOkAndHolds("id-c"));
+  EXPECT_THAT(d.get(), IsOkAndHolds("id-d"));
+  EXPECT_THAT(e.get(), IsOkAndHolds("id-e"));
+  EXPECT_EQ(publisher->KeyCount(), 0U);
+}
+
+TEST(MultiplexingPublisherConnectionTest, PreservesOrderWhenBatchOverflows) {
+  auto mock = std::make_shared<pubsub_testing::MockBatchSink>();
+  pubsub::Topic const topic("test-project", "test-topic");
+
+  AsyncSequencer<void> async;
+  std::vector<std::vector<std::string>> requests;
+  EXPECT_CALL(*mock, AddMessage(_)).Times(AtLeast(1));
+  EXPECT_CALL(*mock, AsyncPublish)
+      .Times(3)
+      .WillRepeatedly([&](google::pubsub::v1::PublishRequest const& request) {
+        requests.push_back(MessagesData(request));
+        return async.PushBack().then([request](future<void>) {
+          return make_status_or(MakeResponse(request));
+        });
+      });
+
+  // Each message is larger than half the batch, so any two messages overflow
+  // the batch.
+  auto const data = [](char c) { return std::string(100, c); };
+  CompletionQueue cq;
+  auto publisher = MultiplexingPublisherConnection::Create(
+      topic, TestOptions(100).set<pubsub::MaxBatchBytesOption>(200), mock, cq);
+  auto a = publisher->Publish({MakeMessage(data('a'), "k1")});
+  ASSERT_THAT(requests, ElementsAre());
+
+  // `b` does not fit, the batch with `a` is sent first. `b` must wait for
+  // that call to complete, and `c` goes to the next batch.
+  auto b = publisher->Publish({MakeMessage(data('b'), "k1")});
+  auto c = publisher->Publish({MakeMessage(data('c'), "k2")});
+  ASSERT_THAT(requests, ElementsAre(ElementsAre(data('a'))));
+  publisher->Flush({});
+  ASSERT_THAT(requests,
+              ElementsAre(ElementsAre(data('a')), ElementsAre(data('c'))));
+
+  async.PopFront().set_value();
+  EXPECT_THAT(a.get(), IsOkAndHolds("id-" + data('a')));
+  publisher->Flush({});
+  ASSERT_THAT(requests,
+              ElementsAre(ElementsAre(data('a')), ElementsAre(data('c')),
+                          ElementsAre(data('b'))));
+
+  async.PopFront().set_value();
+  async.PopFront().set_value();
+  EXPECT_THAT(b.get(), IsOkAndHolds("id-" + data('b')));
+  EXPECT_THAT(c.get(), IsOkAndHolds("id-" + data('c')));
+  EXPECT_EQ(publisher->KeyCount(), 0U);
+}
+
+TEST(MultiplexingPublisherConnectionTest, HandleErrorCorksKeys) {
+  auto mock = std::make_shared<pubsub_testing::MockBatchSink>();
+  pubsub::Topic const topic("test-project", "test-topic");
+  auto const error_status = Status(StatusCode::kPermissionDenied, "uh-oh");
+
+  AsyncSequencer<void> async;
+  EXPECT_CALL(*mock, AddMessage(_)).Times(AtLeast(1));
+  {
+    ::testing::InSequence sequence;
+    EXPECT_CALL(*mock, AsyncPublish)
+        .WillOnce([&](google::pubsub::v1::PublishRequest const& request) {
+          EXPECT_THAT(MessagesData(request), ElementsAre("a", "b"));
+          return async.PushBack().then([error_status](future<void>) {
+            return StatusOr<google::pubsub::v1::PublishResponse>(error_status);
+          });
+        });
+    EXPECT_CALL(*mock, ResumePublish("k1"));
+    EXPECT_CALL(*mock, AsyncPublish)
+        .WillOnce([&](google::pubsub::v1::PublishRequest const& request) {
+          EXPECT_THAT(MessagesData(request), ElementsAre("d", "e"));
+          return make_ready_future(make_status_or(MakeResponse(request)));
+        });
+  }
+
+  google::cloud::internal::AutomaticallyCreatedBackgroundThreads background;
+  auto publisher = MultiplexingPublisherConnection::Create(
+      topic, TestOptions(2), mock, background.cq());
+  auto a = publisher->Publish({MakeMessage("a", "k1")});
+  auto b = publisher->Publish({MakeMessage("b", "k2")});
+  auto c = publisher->Publish({MakeMessage("c", "k1")});
+
+  async.PopFront().set_value();
+  EXPECT_THAT(a.get(),
+              StatusIs(StatusCode::kPermissionDenied, HasSubstr("uh-oh")));
+  EXPECT_THAT(b.get(),
+              StatusIs(StatusCode::kPermissionDenied, HasSubstr("uh-oh")));
+  // The held message is rejected too.
+  EXPECT_THAT(c.get(),
+              StatusIs(StatusCode::kPermissionDenied, HasSubstr("uh-oh")));
+  // Both keys reject new messages until the application resumes them.
+  EXPECT_THAT(publisher->Publish({MakeMessage("x", "k1")}).get(),
+              StatusIs(StatusCode::kPermissionDenied, HasSubstr("uh-oh")));
+  EXPECT_EQ(publisher->KeyCount(), 2U);
+
+  publisher->ResumePublish({"k1"});
+  EXPECT_EQ(publisher->KeyCount(), 1U);
+  auto d = publisher->Publish({MakeMessage("d", "k1")});
+  auto e = publisher->Publish({MakeMessage("e", "k3")});
+  EXPECT_THAT(d.get(), IsOkAndHolds("id-d"));
+  EXPECT_THAT(e.get(), IsOkAndHolds("id-e"));
+}
+
+TEST(MultiplexingPublisherConnectionTest, HandleInvalidResponse) {
+  auto mock = std::make_shared<pubsub_testing::MockBatchSink>();
+  pubsub::Topic const topic("test-project", "test-topic");
+
+  EXPECT_CALL(*mock, AddMessage(_)).Times(AtLeast(1));
+  EXPECT_CALL(*mock, AsyncPublish)
+      .WillOnce([](google::pubsub::v1::PublishRequest const&) {
+        return make_ready_future(
+            make_status_or(google::pubsub::v1::PublishResponse{}));
+      });
+
+  CompletionQueue cq;
+  auto publisher = MultiplexingPublisherConnection::Create(
+      topic, TestOptions(2), mock, cq);
+  auto r0 = publisher->Publish({MakeMessage("d0", "k0")});
+  auto r1 = publisher->Publish({MakeMessage("d1", "k1")});
+  EXPECT_THAT(r0.get(), StatusIs(StatusCode::kUnknown,
+                                 HasSubstr("mismatched message id count")));
+  EXPECT_THAT(r1.get(), StatusIs(StatusCode::kUnknown,
+                                 HasSubstr("mismatched message id count")));
+  EXPECT_EQ(publisher->KeyCount(), 0U);
+}
+
+TEST(MultiplexingPublisherConnectionTest, BatchByMaximumHoldTime) {
+  auto mock = std::make_shared<pubsub_testing::MockBatchSink>();
+  pubsub::Topic const topic("test-project", "test-topic");
+
+  EXPECT_CALL(*mock, AddMessage(_)).Times(2);
+  EXPECT_CALL(*mock, AsyncPublish)
+      .WillOnce([&](google::pubsub::v1::PublishRequest const& request) {
+        EXPECT_THAT(MessagesData(request), ElementsAre("d0", "d1"));
+        return make_ready_future(make_status_or(MakeResponse(request)));
+      });
+
+  google::cloud::internal::AutomaticallyCreatedBackgroundThreads background;
+  auto publisher = MultiplexingPublisherConnection::Create(
+      topic,
+      DefaultPublisherOptions(
+          Options{}
+              .set<pubsub::MaxBatchMessagesOption>(100)
+              .set<pubsub::MaxHoldTimeOption>(std::chrono::milliseconds(5))),
+      mock, background.cq());
+  auto r0 = publisher->Publish({MakeMessage("d0", "k0")});
+  auto r1 = publisher->Publish({MakeMessage("d1", "k1")});
+  EXPECT_THAT(r0.get(), IsOkAndHolds("id-d0"));
+  EXPECT_THAT(r1.get(), IsOkAndHolds("id-d1"));
+}
+
+}  // namespace
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
+}  // namespace pubsub_internal
+}  // namespace cloud
+}  // namespace google
@@ -128,7 +128,10 @@ void SubscriptionConcurrencyControl::OnMessage(
 
   std::weak_ptr<SubscriptionConcurrencyControl> w = shared_from_this();
   shutdown_manager_->StartAsyncOperation(
-      __func__, "callback", cq_, [m = std::move(m), w = std::move(w)] {
+      __func__, "callback", cq_,
+      // The lambda must be `mutable`, otherwise `std::move(m)` copies the
+      // message, including its payload.
+      [m = std::move(m), w = std::move(w)]() mutable {
         if (auto s = w.lock()) s->OnMessageAsync(std::move(m), std::move(w));
       });
 }
@@ -16,7 +16,9 @@
 #define GOOGLE_CLOUD_CPP_GOOGLE_CLOUD_PUBSUB_MESSAGE_H
 
 #include "google/cloud/pubsub/version.h"
+#include "absl/strings/cord.h"
 #include "absl/strings/string_view.h"
+#include "absl/types/optional.h"
 #include <google/pubsub/v1/pubsub.pb.h>
 #include <chrono>
 #include <iosfwd>
@@ -47,6 +49,17 @@ void SetAttribute(std::string const& key, std::string value, pubsub::Message&);
 // is only valid for the lifetime of the corresponding message.
 absl::string_view GetAttribute(std::string const& key, pubsub::Message& m);
 
+// Assigns @p data to a message payload. The generated code may represent the
+// payload as a `std::string`, the default, or as an `absl::Cord`. Only in the
+// latter case the buffers are shared, with a `std::string` the contents are
+// copied.
+inline void AssignCordToData(absl::Cord const& data, std::string& dest) {
+  absl::CopyCordToString(data, &dest);
+}
+inline void AssignCordToData(absl::Cord data, absl::Cord& dest) {
+  dest = std::move(data);
+}
+
 GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
 }  // namespace pubsub_internal
 
@@ -101,6 +114,32 @@ class Message {
     }
     return r;
   }
+
+  /**
+   * Returns the value of the attribute @p key, if present.
+   *
+   * Unlike `attributes()`, this function does not allocate. The returned view
+   * is valid as long as the message is not modified or destroyed.
+   */
+  absl::optional<absl::string_view> attribute(std::string const& key) const {
+    auto const i = proto_.attributes().find(key);
+    if (i == proto_.attributes().end()) return absl::nullopt;
+    return absl::string_view(i->second);
+  }
+
+  /**
+   * Calls @p f for each attribute in the message.
+   *
+   * Unlike `attributes()`, this function does not allocate. The callback
+   * receives each key and value as `absl::string_view`, in no particular
+   * order. The views are valid only for the duration of the call.
+   */
+  template <typename Functor>
+  void ForEachAttribute(Functor&& f) const {
+    for (auto const& kv : proto_.attributes()) {
+      f(absl::string_view(kv.first), absl::string_view(kv.second));
+    }
+  }
   ///@}
 
   ///@{
@@ -173,6 +212,25 @@ class MessageBuilder {
     return std::move(*this);
   }
 
+  /**
+   * Sets the message payload to @p data
+   *
+   * If `PubsubMessageDataType` is `absl::Cord` the buffers in @p data are
+   * shared with the message, without copying. With the default
+   * `PubsubMessageDataType`, `std::string`, the contents are copied into the
+   * message, and this overload is no cheaper than `SetData(std::string)`.
+   */
+  MessageBuilder& SetData(absl::Cord data) & {
+    pubsub_internal::AssignCordToData(std::move(data), *proto_.mutable_data());
+    return *this;
+  }
+
+  /// Sets the message payload to @p data, see the previous overload.
+  MessageBuilder&& SetData(absl::Cord data) && {
+    SetData(std::move(data));
+    return std::move(*this);
+  }
+
   /// Sets the ordering key to @p key
   MessageBuilder& SetOrderingKey(std::string key) & {
     proto_.set_ordering_key(std::move(key));
@@ -147,6 +147,19 @@ TEST(Message, SetData) {
   EXPECT_EQ("changed", m0.data());
 }
 
+TEST(Message, SetDataCord) {
+  absl::Cord data("part-0/");
+  data.Append(std::string(1024, 'x'));
+  auto const expected = std::string(data);
+  auto const m0 = MessageBuilder{}.SetData(std::move(data)).Build();
+  EXPECT_EQ(expected, std::string(m0.data()));
+
+  MessageBuilder builder;
+  builder.SetData(absl::Cord("contents-1"));
+  auto const m1 = std::move(builder).Build();
+  EXPECT_EQ("contents-1", m1.data());
+}
+
 TEST(Message, SetAttributesIterator) {
   std::map<std::string, std::string> const attributes(
       {{"k1", "v1"}, {"k2", "v2"}});
@@ -266,6 +279,24 @@ TEST(Message, SizeEstimation) {
             pubsub_internal::MessageSize(pubsub_internal::FromProto(expected)));
 }
 
+TEST(Message, Attribute) {
+  auto const m0 =
+      MessageBuilder{}.SetAttributes({{"k0", "v0"}, {"k1", ""}}).Build();
+  EXPECT_EQ(m0.attribute("k0").value_or("missing"), "v0");
+  EXPECT_EQ(m0.attribute("k1").value_or("missing"), "");
+  EXPECT_FALSE(m0.attribute("k2").has_value());
+}
+
+TEST(Message, ForEachAttribute) {
+  auto const m0 =
+      MessageBuilder{}.SetAttributes({{"k0", "v0"}, {"k1", "v1"}}).Build();
+  std::vector<std::pair<std::string, std::string>> actual;
+  m0.ForEachAttribute([&](absl::string_view key, absl::string_view value) {
+    actual.emplace_back(std::string(key), std::string(value));
+  });
+  EXPECT_THAT(actual, UnorderedElementsAre(Pair("k0", "v0"), Pair("k1", "v1")));
+}
+
 TEST(Message, SetAttributeFriend) {
   auto m0 = MessageBuilder{}.Build();
   pubsub_internal::SetAttribute("k1", "v1", m0);
@@ -176,6 +176,30 @@ struct MessageOrderingOption {
   using Type = bool;
 };
 
+/**
+ * Batch messages with different ordering keys together.
+ *
+ * By default, a publisher with message ordering enabled keeps a separate
+ * batch, with its own timer, for each ordering key. Applications that publish
+ * few messages for each of many distinct ordering keys end up sending many
+ * small `Publish()` requests, and keeping some state for every key they ever
+ * used.
+ *
+ * With this option enabled the publisher adds messages for all ordering keys
+ * to the same batches. The messages for each ordering key are still delivered
+ * in order: while a batch with messages for a key is pending, any new messages
+ * for that key wait for the next batch. The publisher only keeps state for
+ * keys with pending messages, or keys paused by an error.
+ *
+ * This option has no effect unless `MessageOrderingOption` is enabled. The
+ * default is `false`.
+ *
+ * @ingroup google-cloud-pubsub-options
+ */
+struct MultiplexOrderingKeysOption {
+  using Type = bool;
+};
+
 /// Actions taken by a full publisher.
 enum class FullPublisherAction {
   /// Ignore full publishers, continue as usual.
@@ -250,8 +274,9 @@ struct MaxOtelLinkCountOption {
 using PublisherOptionList =
     OptionList<MaxHoldTimeOption, MaxBatchMessagesOption, MaxBatchBytesOption,
                MaxPendingMessagesOption, MaxPendingBytesOption,
-               MessageOrderingOption, FullPublisherActionOption,
-               CompressionThresholdOption, MaxOtelLinkCountOption>;
+               MessageOrderingOption, MultiplexOrderingKeysOption,
+               FullPublisherActionOption, CompressionThresholdOption,
+               MaxOtelLinkCountOption>;
 
 /**
  * The maximum deadline for each incoming message.
@@ -21,6 +21,7 @@
 #include "google/cloud/pubsub/internal/defaults.h"
 #include "google/cloud/pubsub/internal/flow_controlled_publisher_connection.h"
 #include "google/cloud/pubsub/internal/flow_controlled_publisher_tracing_connection.h"
+#include "google/cloud/pubsub/internal/multiplexing_publisher_connection.h"
 #include "google/cloud/pubsub/internal/ordering_key_publisher_connection.h"
 #include "google/cloud/pubsub/internal/publisher_stub_factory.h"
 #include "google/cloud/pubsub/internal/publisher_tracing_connection.h"
@@ -51,6 +52,11 @@ std::shared_ptr<pubsub::PublisherConnection> ConnectionFromDecoratedStub(
     if (google::cloud::internal::TracingEnabled(opts)) {
       sink = MakeTracingBatchSink(topic, std::move(sink), opts);
     }
+    if (opts.get<pubsub::MessageOrderingOption>() &&
+        opts.get<pubsub::MultiplexOrderingKeysOption>()) {
+      return pubsub_internal::MultiplexingPublisherConnection::Create(
+          topic, opts, std::move(sink), std::move(cq));
+    }
     if (opts.get<pubsub::MessageOrderingOption>()) {
       auto factory = [topic, opts, sink, cq](std::string const& key) {
         auto used_sink = sink;
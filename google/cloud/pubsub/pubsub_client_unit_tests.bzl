@@ -35,6 +35,7 @@ pubsub_client_unit_tests = [
     "internal/flow_controlled_publisher_tracing_connection_test.cc",
     "internal/message_carrier_test.cc",
     "internal/message_propagator_test.cc",
+    "internal/multiplexing_publisher_connection_test.cc",
     "internal/ordering_key_publisher_connection_test.cc",
     "internal/publisher_stub_factory_test.cc",
     "internal/publisher_tracing_connection_test.cc",
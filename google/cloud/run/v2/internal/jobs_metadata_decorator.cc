@@ -61,8 +61,7 @@ future<StatusOr<google::longrunning::Operation>> JobsMetadata::AsyncCreateJob(
         {
             {[](google::cloud::run::v2::CreateJobRequest const& request)
                  -> std::string const& { return request.parent(); },
-             std::regex{"projects/[^/]+/locations/([^/]+)",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate("projects/*/locations/{*}")},
         }};
   }();
   location_matcher->AppendParam(request, params);
@@ -89,8 +88,7 @@ StatusOr<google::longrunning::Operation> JobsMetadata::CreateJob(
         {
             {[](google::cloud::run::v2::CreateJobRequest const& request)
                  -> std::string const& { return request.parent(); },
-             std::regex{"projects/[^/]+/locations/([^/]+)",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate("projects/*/locations/{*}")},
         }};
   }();
   location_matcher->AppendParam(request, params);
@@ -116,8 +114,7 @@ StatusOr<google::cloud::run::v2::Job> JobsMetadata::GetJob(
         {
             {[](google::cloud::run::v2::GetJobRequest const& request)
                  -> std::string const& { return request.name(); },
-             std::regex{"projects/[^/]+/locations/([^/]+)/.*",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate("projects/*/locations/{*}/**")},
         }};
   }();
   location_matcher->AppendParam(request, params);
@@ -143,8 +140,7 @@ StatusOr<google::cloud::run::v2::ListJobsResponse> JobsMetadata::ListJobs(
         {
             {[](google::cloud::run::v2::ListJobsRequest const& request)
                  -> std::string const& { return request.parent(); },
-             std::regex{"projects/[^/]+/locations/([^/]+)",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate("projects/*/locations/{*}")},
         }};
   }();
   location_matcher->AppendParam(request, params);
@@ -172,8 +168,7 @@ future<StatusOr<google::longrunning::Operation>> JobsMetadata::AsyncUpdateJob(
         {
             {[](google::cloud::run::v2::UpdateJobRequest const& request)
                  -> std::string const& { return request.job().name(); },
-             std::regex{"projects/[^/]+/locations/([^/]+)/.*",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate("projects/*/locations/{*}/**")},
         }};
   }();
   location_matcher->AppendParam(request, params);
@@ -200,8 +195,7 @@ StatusOr<google::longrunning::Operation> JobsMetadata::UpdateJob(
         {
             {[](google::cloud::run::v2::UpdateJobRequest const& request)
                  -> std::string const& { return request.job().name(); },
-             std::regex{"projects/[^/]+/locations/([^/]+)/.*",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate("projects/*/locations/{*}/**")},
         }};
   }();
   location_matcher->AppendParam(request, params);
@@ -229,8 +223,7 @@ future<StatusOr<google::longrunning::Operation>> JobsMetadata::AsyncDeleteJob(
         {
             {[](google::cloud::run::v2::DeleteJobRequest const& request)
                  -> std::string const& { return request.name(); },
-             std::regex{"projects/[^/]+/locations/([^/]+)/.*",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate("projects/*/locations/{*}/**")},
         }};
   }();
   location_matcher->AppendParam(request, params);
@@ -257,8 +250,7 @@ StatusOr<google::longrunning::Operation> JobsMetadata::DeleteJob(
         {
             {[](google::cloud::run::v2::DeleteJobRequest const& request)
                  -> std::string const& { return request.name(); },
-             std::regex{"projects/[^/]+/locations/([^/]+)/.*",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate("projects/*/locations/{*}/**")},
         }};
   }();
   location_matcher->AppendParam(request, params);
@@ -286,8 +278,7 @@ future<StatusOr<google::longrunning::Operation>> JobsMetadata::AsyncRunJob(
         {
             {[](google::cloud::run::v2::RunJobRequest const& request)
                  -> std::string const& { return request.name(); },
-             std::regex{"projects/[^/]+/locations/([^/]+)/.*",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate("projects/*/locations/{*}/**")},
         }};
   }();
   location_matcher->AppendParam(request, params);
@@ -314,8 +305,7 @@ StatusOr<google::longrunning::Operation> JobsMetadata::RunJob(
         {
             {[](google::cloud::run::v2::RunJobRequest const& request)
                  -> std::string const& { return request.name(); },
-             std::regex{"projects/[^/]+/locations/([^/]+)/.*",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate("projects/*/locations/{*}/**")},
         }};
   }();
   location_matcher->AppendParam(request, params);
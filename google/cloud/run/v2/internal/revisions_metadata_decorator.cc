@@ -59,8 +59,7 @@ StatusOr<google::cloud::run::v2::Revision> RevisionsMetadata::GetRevision(
         {
             {[](google::cloud::run::v2::GetRevisionRequest const& request)
                  -> std::string const& { return request.name(); },
-             std::regex{"projects/[^/]+/locations/([^/]+)/.*",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate("projects/*/locations/{*}/**")},
         }};
   }();
   location_matcher->AppendParam(request, params);
@@ -87,8 +86,7 @@ RevisionsMetadata::ListRevisions(
         {
             {[](google::cloud::run::v2::ListRevisionsRequest const& request)
                  -> std::string const& { return request.parent(); },
-             std::regex{"projects/[^/]+/locations/([^/]+)/.*",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate("projects/*/locations/{*}/**")},
         }};
   }();
   location_matcher->AppendParam(request, params);
@@ -117,8 +115,7 @@ RevisionsMetadata::AsyncDeleteRevision(
         {
             {[](google::cloud::run::v2::DeleteRevisionRequest const& request)
                  -> std::string const& { return request.name(); },
-             std::regex{"projects/[^/]+/locations/([^/]+)/.*",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate("projects/*/locations/{*}/**")},
         }};
   }();
   location_matcher->AppendParam(request, params);
@@ -145,8 +142,7 @@ StatusOr<google::longrunning::Operation> RevisionsMetadata::DeleteRevision(
         {
             {[](google::cloud::run::v2::DeleteRevisionRequest const& request)
                  -> std::string const& { return request.name(); },
-             std::regex{"projects/[^/]+/locations/([^/]+)/.*",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate("projects/*/locations/{*}/**")},
         }};
   }();
   location_matcher->AppendParam(request, params);
@@ -62,8 +62,7 @@ ServicesMetadata::AsyncCreateService(
         {
             {[](google::cloud::run::v2::CreateServiceRequest const& request)
                  -> std::string const& { return request.parent(); },
-             std::regex{"projects/[^/]+/locations/([^/]+)",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate("projects/*/locations/{*}")},
         }};
   }();
   location_matcher->AppendParam(request, params);
@@ -90,8 +89,7 @@ StatusOr<google::longrunning::Operation> ServicesMetadata::CreateService(
         {
             {[](google::cloud::run::v2::CreateServiceRequest const& request)
                  -> std::string const& { return request.parent(); },
-             std::regex{"projects/[^/]+/locations/([^/]+)",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate("projects/*/locations/{*}")},
         }};
   }();
   location_matcher->AppendParam(request, params);
@@ -117,8 +115,7 @@ StatusOr<google::cloud::run::v2::Service> ServicesMetadata::GetService(
         {
             {[](google::cloud::run::v2::GetServiceRequest const& request)
                  -> std::string const& { return request.name(); },
-             std::regex{"projects/[^/]+/locations/([^/]+)/.*",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate("projects/*/locations/{*}/**")},
         }};
   }();
   location_matcher->AppendParam(request, params);
@@ -145,8 +142,7 @@ ServicesMetadata::ListServices(
         {
             {[](google::cloud::run::v2::ListServicesRequest const& request)
                  -> std::string const& { return request.parent(); },
-             std::regex{"projects/[^/]+/locations/([^/]+)",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate("projects/*/locations/{*}")},
         }};
   }();
   location_matcher->AppendParam(request, params);
@@ -175,8 +171,7 @@ ServicesMetadata::AsyncUpdateService(
         {
             {[](google::cloud::run::v2::UpdateServiceRequest const& request)
                  -> std::string const& { return request.service().name(); },
-             std::regex{"projects/[^/]+/locations/([^/]+)/.*",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate("projects/*/locations/{*}/**")},
         }};
   }();
   location_matcher->AppendParam(request, params);
@@ -203,8 +198,7 @@ StatusOr<google::longrunning::Operation> ServicesMetadata::UpdateService(
         {
             {[](google::cloud::run::v2::UpdateServiceRequest const& request)
                  -> std::string const& { return request.service().name(); },
-             std::regex{"projects/[^/]+/locations/([^/]+)/.*",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate("projects/*/locations/{*}/**")},
         }};
   }();
   location_matcher->AppendParam(request, params);
@@ -233,8 +227,7 @@ ServicesMetadata::AsyncDeleteService(
         {
             {[](google::cloud::run::v2::DeleteServiceRequest const& request)
                  -> std::string const& { return request.name(); },
-             std::regex{"projects/[^/]+/locations/([^/]+)/.*",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate("projects/*/locations/{*}/**")},
         }};
   }();
   location_matcher->AppendParam(request, params);
@@ -261,8 +254,7 @@ StatusOr<google::longrunning::Operation> ServicesMetadata::DeleteService(
         {
             {[](google::cloud::run::v2::DeleteServiceRequest const& request)
                  -> std::string const& { return request.name(); },
-             std::regex{"projects/[^/]+/locations/([^/]+)/.*",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate("projects/*/locations/{*}/**")},
         }};
   }();
   location_matcher->AppendParam(request, params);
@@ -112,18 +112,15 @@ SecurityCenterMetadata::CreateMuteConfig(
             {[](google::cloud::securitycenter::v2::
                     CreateMuteConfigRequest const& request)
                  -> std::string const& { return request.parent(); },
-             std::regex{"folders/[^/]+/locations/([^/]+)",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate("folders/*/locations/{*}")},
             {[](google::cloud::securitycenter::v2::
                     CreateMuteConfigRequest const& request)
                  -> std::string const& { return request.parent(); },
-             std::regex{"organizations/[^/]+/locations/([^/]+)",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate("organizations/*/locations/{*}")},
             {[](google::cloud::securitycenter::v2::
                     CreateMuteConfigRequest const& request)
                  -> std::string const& { return request.parent(); },
-             std::regex{"projects/[^/]+/locations/([^/]+)",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate("projects/*/locations/{*}")},
         }};
   }();
   location_matcher->AppendParam(request, params);
@@ -178,19 +175,18 @@ Status SecurityCenterMetadata::DeleteMuteConfig(
             {[](google::cloud::securitycenter::v2::
                     DeleteMuteConfigRequest const& request)
                  -> std::string const& { return request.name(); },
-             std::regex{"folders/[^/]+/locations/([^/]+)/muteConfigs/[^/]+",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate(
+                 "folders/*/locations/{*}/muteConfigs/*")},
             {[](google::cloud::securitycenter::v2::
                     DeleteMuteConfigRequest const& request)
                  -> std::string const& { return request.name(); },
-             std::regex{
-                 "organizations/[^/]+/locations/([^/]+)/muteConfigs/[^/]+",
-                 std::regex::optimize}},
+             internal::RoutingPathTemplate(
+                 "organizations/*/locations/{*}/muteConfigs/*")},
             {[](google::cloud::securitycenter::v2::
                     DeleteMuteConfigRequest const& request)
                  -> std::string const& { return request.name(); },
-             std::regex{"projects/[^/]+/locations/([^/]+)/muteConfigs/[^/]+",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate(
+                 "projects/*/locations/{*}/muteConfigs/*")},
         }};
   }();
   location_matcher->AppendParam(request, params);
@@ -273,17 +269,16 @@ SecurityCenterMetadata::GetMuteConfig(
         {
             {[](google::cloud::securitycenter::v2::GetMuteConfigRequest const&
                     request) -> std::string const& { return request.name(); },
-             std::regex{"folders/[^/]+/locations/([^/]+)/muteConfigs/[^/]+",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate(
+                 "folders/*/locations/{*}/muteConfigs/*")},
             {[](google::cloud::securitycenter::v2::GetMuteConfigRequest const&
                     request) -> std::string const& { return request.name(); },
-             std::regex{
-                 "organizations/[^/]+/locations/([^/]+)/muteConfigs/[^/]+",
-                 std::regex::optimize}},
+             internal::RoutingPathTemplate(
+                 "organizations/*/locations/{*}/muteConfigs/*")},
             {[](google::cloud::securitycenter::v2::GetMuteConfigRequest const&
                     request) -> std::string const& { return request.name(); },
-             std::regex{"projects/[^/]+/locations/([^/]+)/muteConfigs/[^/]+",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate(
+                 "projects/*/locations/{*}/muteConfigs/*")},
         }};
   }();
   location_matcher->AppendParam(request, params);
@@ -376,16 +371,16 @@ SecurityCenterMetadata::ListMuteConfigs(
         {
             {[](google::cloud::securitycenter::v2::ListMuteConfigsRequest const&
                     request) -> std::string const& { return request.parent(); },
-             std::regex{"folders/[^/]+/locations/([^/]+)/muteConfigs",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate(
+                 "folders/*/locations/{*}/muteConfigs")},
             {[](google::cloud::securitycenter::v2::ListMuteConfigsRequest const&
                     request) -> std::string const& { return request.parent(); },
-             std::regex{"organizations/[^/]+/locations/([^/]+)/muteConfigs",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate(
+                 "organizations/*/locations/{*}/muteConfigs")},
             {[](google::cloud::securitycenter::v2::ListMuteConfigsRequest const&
                     request) -> std::string const& { return request.parent(); },
-             std::regex{"projects/[^/]+/locations/([^/]+)/muteConfigs",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate(
+                 "projects/*/locations/{*}/muteConfigs")},
         }};
   }();
   location_matcher->AppendParam(request, params);
@@ -523,19 +518,18 @@ SecurityCenterMetadata::UpdateMuteConfig(
             {[](google::cloud::securitycenter::v2::
                     UpdateMuteConfigRequest const& request)
                  -> std::string const& { return request.mute_config().name(); },
-             std::regex{"folders/[^/]+/locations/([^/]+)/muteConfigs/[^/]+",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate(
+                 "folders/*/locations/{*}/muteConfigs/*")},
             {[](google::cloud::securitycenter::v2::
                     UpdateMuteConfigRequest const& request)
                  -> std::string const& { return request.mute_config().name(); },
-             std::regex{
-                 "organizations/[^/]+/locations/([^/]+)/muteConfigs/[^/]+",
-                 std::regex::optimize}},
+             internal::RoutingPathTemplate(
+                 "organizations/*/locations/{*}/muteConfigs/*")},
             {[](google::cloud::securitycenter::v2::
                     UpdateMuteConfigRequest const& request)
                  -> std::string const& { return request.mute_config().name(); },
-             std::regex{"projects/[^/]+/locations/([^/]+)/muteConfigs/[^/]+",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate(
+                 "projects/*/locations/{*}/muteConfigs/*")},
         }};
   }();
   location_matcher->AppendParam(request, params);
@@ -13,6 +13,8 @@
 // limitations under the License.
 
 #include "google/cloud/spanner/benchmarks/benchmarks_config.h"
+#include "google/cloud/common_options.h"
+#include "google/cloud/grpc_options.h"
 #include "google/cloud/internal/build_info.h"
 #include "google/cloud/internal/compiler_info.h"
 #include "google/cloud/internal/getenv.h"
@@ -42,12 +44,21 @@ std::ostream& operator<<(std::ostream& os, Config const& config) {
             << "\n# Query Size: " << config.query_size
             << "\n# Use Only Stubs: " << config.use_only_stubs
             << "\n# Use Only Clients: " << config.use_only_clients
+            << "\n# Embedded Server: " << config.embedded_server
             << "\n# Compiler: " << google::cloud::internal::CompilerId() << "-"
             << google::cloud::internal::CompilerVersion()
             << "\n# Build Flags: " << google::cloud::internal::compiler_flags()
             << "\n";
 }
 
+google::cloud::Options ConnectionOptions(Config const& config) {
+  if (!config.embedded_server) return {};
+  return google::cloud::Options{}
+      .set<google::cloud::EndpointOption>(config.embedded_server_address)
+      .set<google::cloud::GrpcCredentialOption>(
+          grpc::InsecureChannelCredentials());
+}
+
 google::cloud::StatusOr<Config> ParseArgs(std::vector<std::string> args) {
   Config config;
 
@@ -112,6 +123,8 @@ google::cloud::StatusOr<Config> ParseArgs(std::vector<std::string> args) {
        [](Config& c, std::string const&) { c.use_only_stubs = true; }},
       {"--use-only-clients",
        [](Config& c, std::string const&) { c.use_only_clients = true; }},
+      {"--embedded-server",
+       [](Config& c, std::string const&) { c.embedded_server = true; }},
   };
 
   auto invalid_argument = [](std::string msg) {
@@ -138,6 +151,13 @@ google::cloud::StatusOr<Config> ParseArgs(std::vector<std::string> args) {
     return invalid_argument("Missing value for --experiment flag");
   }
 
+  if (config.embedded_server) {
+    // The embedded server accepts any resource names.
+    if (config.project_id.empty()) config.project_id = "embedded-project";
+    if (config.instance_id.empty()) config.instance_id = "embedded-instance";
+    if (config.database_id.empty()) config.database_id = "embedded-database";
+  }
+
   if (config.project_id.empty()) {
     return invalid_argument(
         "The project id is not set, provide a value in the --project flag,"
@@ -16,6 +16,7 @@
 #define GOOGLE_CLOUD_CPP_GOOGLE_CLOUD_SPANNER_BENCHMARKS_BENCHMARKS_CONFIG_H
 
 #include "google/cloud/spanner/version.h"
+#include "google/cloud/options.h"
 #include "google/cloud/status_or.h"
 #include <chrono>
 #include <string>
@@ -46,10 +47,23 @@ struct Config {
 
   bool use_only_clients = false;
   bool use_only_stubs = false;
+
+  /// Run the benchmark against an in-process server, see `EmbeddedServer`.
+  bool embedded_server = false;
+  /// The address of the embedded server, set by the benchmark at runtime.
+  std::string embedded_server_address;
 };
 
 std::ostream& operator<<(std::ostream& os, Config const& config);
 
+/**
+ * The options to connect to the service.
+ *
+ * When using the embedded server these options override the endpoint and
+ * credentials, otherwise they are empty.
+ */
+google::cloud::Options ConnectionOptions(Config const& config);
+
 google::cloud::StatusOr<Config> ParseArgs(std::vector<std::string> args);
 
 GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
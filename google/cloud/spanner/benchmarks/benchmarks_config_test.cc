@@ -13,6 +13,8 @@
 // limitations under the License.
 
 #include "google/cloud/spanner/benchmarks/benchmarks_config.h"
+#include "google/cloud/common_options.h"
+#include "google/cloud/grpc_options.h"
 #include "google/cloud/testing_util/scoped_environment.h"
 #include "google/cloud/testing_util/status_matchers.h"
 #include <gmock/gmock.h>
@@ -133,6 +135,31 @@ TEST(BenchmarkConfigTest, OnlyClients) {
   EXPECT_TRUE(config->use_only_clients);
 }
 
+TEST(BenchmarkConfigTest, EmbeddedServer) {
+  testing_util::ScopedEnvironment env("GOOGLE_CLOUD_PROJECT", absl::nullopt);
+  auto config = ParseArgs({"placeholder", "--embedded-server"});
+  ASSERT_STATUS_OK(config);
+
+  EXPECT_TRUE(config->embedded_server);
+  EXPECT_FALSE(config->project_id.empty());
+  EXPECT_FALSE(config->instance_id.empty());
+  EXPECT_FALSE(config->database_id.empty());
+
+  config->embedded_server_address = "localhost:12345";
+  auto const options = ConnectionOptions(*config);
+  EXPECT_EQ(options.get<EndpointOption>(), "localhost:12345");
+  EXPECT_TRUE(options.has<GrpcCredentialOption>());
+}
+
+TEST(BenchmarkConfigTest, ConnectionOptionsDefault) {
+  auto config = ParseArgs({"placeholder", "--project=test-project"});
+  ASSERT_STATUS_OK(config);
+  EXPECT_FALSE(config->embedded_server);
+  auto const options = ConnectionOptions(*config);
+  EXPECT_FALSE(options.has<EndpointOption>());
+  EXPECT_FALSE(options.has<GrpcCredentialOption>());
+}
+
 }  // namespace
 GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
 }  // namespace spanner_benchmarks
@@ -0,0 +1,649 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/spanner/benchmarks/embedded_server.h"
+#include "google/cloud/internal/random.h"
+#include "google/cloud/internal/time_utils.h"
+#include "absl/strings/ascii.h"
+#include "absl/strings/escaping.h"
+#include "absl/strings/match.h"
+#include "absl/strings/numbers.h"
+#include "absl/strings/str_split.h"
+#include "absl/strings/string_view.h"
+#include "absl/strings/strip.h"
+#include "absl/types/optional.h"
+#include <google/spanner/v1/spanner.grpc.pb.h>
+#include <algorithm>
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <utility>
+
+namespace google {
+namespace cloud {
+namespace spanner_benchmarks {
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_BEGIN
+namespace {
+
+namespace spanner_proto = ::google::spanner::v1;
+
+auto constexpr kValuePoolSize = 1000;
+
+using Schema =
+    std::map<std::string, std::map<std::string, spanner_proto::TypeCode>>;
+
+spanner_proto::TypeCode ParseColumnType(absl::string_view type) {
+  struct {
+    absl::string_view prefix;
+    spanner_proto::TypeCode code;
+  } const kTypes[] = {
+      {"BOOL", spanner_proto::TypeCode::BOOL},
+      {"INT64", spanner_proto::TypeCode::INT64},
+      {"FLOAT64", spanner_proto::TypeCode::FLOAT64},
+      {"FLOAT32", spanner_proto::TypeCode::FLOAT32},
+      {"STRING", spanner_proto::TypeCode::STRING},
+      {"BYTES", spanner_proto::TypeCode::BYTES},
+      {"DATE", spanner_proto::TypeCode::DATE},
+      {"TIMESTAMP", spanner_proto::TypeCode::TIMESTAMP},
+      {"NUMERIC", spanner_proto::TypeCode::NUMERIC},
+      {"JSON", spanner_proto::TypeCode::JSON},
+  };
+  for (auto const& t : kTypes) {
+    if (absl::StartsWithIgnoreCase(type, t.prefix)) return t.code;
+  }
+  return spanner_proto::TypeCode::STRING;
+}
+
+/**
+ * Extracts the column types from simple `CREATE TABLE` statements.
+ *
+ * This is not a DDL parser, it only understands statements such as:
+ *   CREATE TABLE Name (Key INT64 NOT NULL, Data STRING(1024)) PRIMARY KEY(Key)
+ * which is all the benchmarks need.
+ */
+Schema ParseSchema(std::vector<std::string> const& statements) {
+  Schema schema;
+  for (auto const& statement : statements) {
+    absl::string_view s = statement;
+    s = absl::StripLeadingAsciiWhitespace(s);
+    if (!absl::ConsumePrefix(&s, "CREATE TABLE")) continue;
+    auto const open = s.find('(');
+    auto const close = s.rfind(") PRIMARY KEY");
+    if (open == absl::string_view::npos || close == absl::string_view::npos) {
+      continue;
+    }
+    auto& columns =
+        schema[std::string(absl::StripAsciiWhitespace(s.substr(0, open)))];
+    for (auto column : absl::StrSplit(s.substr(open + 1, close - open - 1), ',',
+                                      absl::SkipWhitespace())) {
+      std::vector<absl::string_view> tokens =
+          absl::StrSplit(column, absl::ByAnyChar(" \t\n"), absl::SkipEmpty());
+      if (tokens.size() < 2) continue;
+      columns[std::string(tokens[0])] = ParseColumnType(tokens[1]);
+    }
+  }
+  return schema;
+}
+
+/// Generates the (synthetic) values returned by the server.
+class ValueGenerator {
+ public:
+  explicit ValueGenerator(std::size_t value_size) {
+    auto generator = google::cloud::internal::MakeDefaultPRNG();
+    auto const size = static_cast<int>(value_size);
+    strings_.reserve(kValuePoolSize);
+    bytes_.reserve(kValuePoolSize);
+    for (int i = 0; i != kValuePoolSize; ++i) {
+      strings_.push_back(google::cloud::internal::Sample(
+          generator, size, "abcdefghijklmnopqrstuvwxyz0123456789"));
+      bytes_.push_back(absl::Base64Escape(google::cloud::internal::Sample(
+          generator, size, "\x01\x02\x7f\x80\xfe\xff ABCDEFabcdef0123456789")));
+    }
+  }
+
+  google::protobuf::Value Make(spanner_proto::TypeCode code,
+                               std::int64_t key) const {
+    auto const i = static_cast<std::size_t>(key < 0 ? -key : key);
+    google::protobuf::Value v;
+    switch (code) {
+      case spanner_proto::TypeCode::BOOL:
+        v.set_bool_value(i % 2 == 0);
+        break;
+      case spanner_proto::TypeCode::INT64:
+        v.set_string_value(std::to_string(key));
+        break;
+      case spanner_proto::TypeCode::FLOAT64:
+      case spanner_proto::TypeCode::FLOAT32:
+        v.set_number_value(static_cast<double>(i % kValuePoolSize) / 8.0);
+        break;
+      case spanner_proto::TypeCode::BYTES:
+        v.set_string_value(bytes_[i % bytes_.size()]);
+        break;
+      case spanner_proto::TypeCode::DATE:
+        v.set_string_value("2020-" + Pad(1 + i % 12) + "-" + Pad(1 + i % 28));
+        break;
+      case spanner_proto::TypeCode::TIMESTAMP:
+        v.set_string_value("2020-01-" + Pad(1 + i % 28) + "T12:34:56." +
+                           std::to_string(100000000 + i % 900000000) + "Z");
+        break;
+      case spanner_proto::TypeCode::NUMERIC:
+        v.set_string_value(std::to_string(key) + ".123456789");
+        break;
+      case spanner_proto::TypeCode::JSON:
+        v.set_string_value(R"js({"key":)js" + std::to_string(key) + "}");
+        break;
+      default:
+        v.set_string_value(strings_[i % strings_.size()]);
+        break;
+    }
+    return v;
+  }
+
+ private:
+  static std::string Pad(std::size_t n) {
+    return (n < 10 ? "0" : "") + std::to_string(n);
+  }
+
+  std::vector<std::string> strings_;
+  std::vector<std::string> bytes_;
+};
+
+std::int64_t ParseKey(google::protobuf::ListValue const& key) {
+  std::int64_t value = 0;
+  if (key.values_size() == 0) return value;
+  auto const& v = key.values(0);
+  if (v.has_string_value() && absl::SimpleAtoi(v.string_value(), &value)) {
+    return value;
+  }
+  if (v.has_number_value()) return static_cast<std::int64_t>(v.number_value());
+  return value;
+}
+
+/// The keys selected by a request, as a list of `[begin, end)` ranges.
+using KeyRanges = std::vector<std::pair<std::int64_t, std::int64_t>>;
+
+KeyRanges ToKeyRanges(spanner_proto::KeySet const& key_set,
+                      std::int64_t table_size) {
+  if (key_set.all()) return {{0, table_size}};
+  KeyRanges result;
+  for (auto const& k : key_set.keys()) {
+    auto const key = ParseKey(k);
+    result.emplace_back(key, key + 1);
+  }
+  for (auto const& r : key_set.ranges()) {
+    auto const begin = r.has_start_closed() ? ParseKey(r.start_closed())
+                                            : ParseKey(r.start_open()) + 1;
+    auto const end = r.has_end_closed() ? ParseKey(r.end_closed()) + 1
+                                        : ParseKey(r.end_open());
+    result.emplace_back(begin, (std::max)(begin, end));
+  }
+  return result;
+}
+
+absl::optional<std::int64_t> ParamAsKey(
+    spanner_proto::ExecuteSqlRequest const& request, std::string const& name) {
+  auto const& fields = request.params().fields();
+  auto f = fields.find(name);
+  if (f == fields.end()) return absl::nullopt;
+  std::int64_t value;
+  if (!absl::SimpleAtoi(f->second.string_value(), &value)) return absl::nullopt;
+  return value;
+}
+
+KeyRanges ToKeyRanges(spanner_proto::ExecuteSqlRequest const& request,
+                      std::int64_t table_size) {
+  auto key = ParamAsKey(request, "key");
+  if (key) return {{*key, *key + 1}};
+  auto begin = ParamAsKey(request, "begin");
+  auto end = ParamAsKey(request, "end");
+  if (begin && end) return {{*begin, (std::max)(*begin, *end)}};
+  return {{0, table_size}};
+}
+
+bool IsDml(absl::string_view sql) {
+  sql = absl::StripLeadingAsciiWhitespace(sql);
+  for (auto const* prefix : {"UPDATE", "INSERT", "DELETE"}) {
+    if (absl::StartsWithIgnoreCase(sql, prefix)) return true;
+  }
+  return false;
+}
+
+/**
+ * The table and columns in a `SELECT c1, c2, ... FROM table ...` query.
+ *
+ * Like `ParseSchema()`, this only understands the queries in the benchmarks.
+ */
+std::pair<std::string, std::vector<std::string>> ParseQuery(
+    absl::string_view sql) {
+  sql = absl::StripLeadingAsciiWhitespace(sql);
+  if (!absl::StartsWithIgnoreCase(sql, "SELECT")) return {};
+  sql.remove_prefix(6);
+  std::string table;
+  auto const upper = absl::AsciiStrToUpper(sql);
+  auto const from = upper.find(" FROM ");
+  auto columns_text = sql.substr(0, from);
+  if (from != std::string::npos) {
+    std::vector<absl::string_view> tokens = absl::StrSplit(
+        sql.substr(from + 6), absl::ByAnyChar(" \t\n"), absl::SkipEmpty());
+    if (!tokens.empty()) table = std::string(tokens[0]);
+  }
+  std::vector<std::string> columns;
+  for (auto c : absl::StrSplit(columns_text, ',', absl::SkipWhitespace())) {
+    columns.emplace_back(absl::StripAsciiWhitespace(c));
+  }
+  return {std::move(table), std::move(columns)};
+}
+
+/**
+ * Implement the portions of the `google.spanner.v1.Spanner` interface
+ * necessary for the benchmarks.
+ *
+ * This is not a Mock (use `spanner_testing::MockSpannerStub` for that), nor is
+ * this a Fake implementation (use the Cloud Spanner Emulator for that), this
+ * is an implementation of the interface that returns synthetic values. It is
+ * suitable for the benchmarks, but for nothing else.
+ */
+class SpannerImpl final : public spanner_proto::Spanner::Service {
+ public:
+  explicit SpannerImpl(EmbeddedServerOptions options)
+      : options_(std::move(options)),
+        schema_(ParseSchema(options_.ddl_statements)),
+        values_(options_.value_size) {}
+
+  grpc::Status CreateSession(grpc::ServerContext*,
+                             spanner_proto::CreateSessionRequest const* request,
+                             spanner_proto::Session* response) override {
+    auto status = StartRpc();
+    if (!status.ok()) return status;
+    ++create_session_count_;
+    *response = MakeSession(request->database(), request->session());
+    return grpc::Status::OK;
+  }
+
+  grpc::Status BatchCreateSessions(
+      grpc::ServerContext*,
+      spanner_proto::BatchCreateSessionsRequest const* request,
+      spanner_proto::BatchCreateSessionsResponse* response) override {
+    auto status = StartRpc();
+    if (!status.ok()) return status;
+    for (int i = 0; i != request->session_count(); ++i) {
+      ++create_session_count_;
+      *response->add_session() =
+          MakeSession(request->database(), request->session_template());
+    }
+    return grpc::Status::OK;
+  }
+
+  grpc::Status GetSession(grpc::ServerContext*,
+                          spanner_proto::GetSessionRequest const* request,
+                          spanner_proto::Session* response) override {
+    auto status = StartRpc();
+    if (!status.ok()) return status;
+    response->set_name(request->name());
+    return grpc::Status::OK;
+  }
+
+  grpc::Status DeleteSession(grpc::ServerContext*,
+                             spanner_proto::DeleteSessionRequest const*,
+                             google::protobuf::Empty*) override {
+    auto status = StartRpc();
+    if (!status.ok()) return status;
+    ++delete_session_count_;
+    return grpc::Status::OK;
+  }
+
+  grpc::Status ExecuteSql(grpc::ServerContext*,
+                          spanner_proto::ExecuteSqlRequest const* request,
+                          spanner_proto::ResultSet* response) override {
+    auto status = StartRpc();
+    if (!status.ok()) return status;
+    ++execute_sql_count_;
+    auto messages = MakeQueryResults(*request);
+    for (auto& m : messages) {
+      if (m.has_metadata()) *response->mutable_metadata() = m.metadata();
+      if (m.has_stats()) *response->mutable_stats() = m.stats();
+    }
+    // `ResultSet` does not support chunked values, merge any chunks while
+    // splitting the values into rows.
+    auto const columns = response->metadata().row_type().fields_size();
+    if (columns == 0) return grpc::Status::OK;
+    google::protobuf::ListValue* row = nullptr;
+    bool chunked = false;
+    for (auto& m : messages) {
+      for (auto& v : *m.mutable_values()) {
+        if (chunked) {
+          auto& last = *row->mutable_values(row->values_size() - 1);
+          last.mutable_string_value()->append(v.string_value());
+          chunked = false;
+          continue;
+        }
+        if (row == nullptr || row->values_size() == columns) {
+          row = response->add_rows();
+        }
+        *row->add_values() = std::move(v);
+      }
+      chunked = m.chunked_value();
+    }
+    return grpc::Status::OK;
+  }
+
+  grpc::Status ExecuteStreamingSql(
+      grpc::ServerContext*, spanner_proto::ExecuteSqlRequest const* request,
+      grpc::ServerWriter<spanner_proto::PartialResultSet>* writer) override {
+    auto status = StartRpc();
+    if (!status.ok()) return status;
+    ++execute_sql_count_;
+    return WriteAll(MakeQueryResults(*request), request->resume_token(),
+                    writer);
+  }
+
+  grpc::Status ExecuteBatchDml(
+      grpc::ServerContext*,
+      spanner_proto::ExecuteBatchDmlRequest const* request,
+      spanner_proto::ExecuteBatchDmlResponse* response) override {
+    auto status = StartRpc();
+    if (!status.ok()) return status;
+    ++execute_sql_count_;
+    for (int i = 0; i != request->statements_size(); ++i) {
+      auto& rs = *response->add_result_sets();
+      rs.mutable_stats()->set_row_count_exact(1);
+      if (i != 0) continue;
+      SetTransaction(request->transaction(), *rs.mutable_metadata());
+    }
+    return grpc::Status::OK;
+  }
+
+  grpc::Status StreamingRead(
+      grpc::ServerContext*, spanner_proto::ReadRequest const* request,
+      grpc::ServerWriter<spanner_proto::PartialResultSet>* writer) override {
+    auto status = StartRpc();
+    if (!status.ok()) return status;
+    ++read_count_;
+    std::vector<std::string> columns{request->columns().begin(),
+                                     request->columns().end()};
+    auto ranges = ToKeyRanges(request->key_set(), options_.table_size);
+    auto messages =
+        MakeRows(request->table(), columns, ranges, request->limit());
+    SetTransaction(request->transaction(), *messages[0].mutable_metadata());
+    return WriteAll(std::move(messages), request->resume_token(), writer);
+  }
+
+  grpc::Status BeginTransaction(
+      grpc::ServerContext*, spanner_proto::BeginTransactionRequest const*,
+      spanner_proto::Transaction* response) override {
+    auto status = StartRpc();
+    if (!status.ok()) return status;
+    ++begin_transaction_count_;
+    *response = MakeTransaction();
+    return grpc::Status::OK;
+  }
+
+  grpc::Status Commit(grpc::ServerContext*,
+                      spanner_proto::CommitRequest const* request,
+                      spanner_proto::CommitResponse* response) override {
+    auto status = StartRpc();
+    if (!status.ok()) return status;
+    ++commit_count_;
+    *response->mutable_commit_timestamp() =
+        google::cloud::internal::ToProtoTimestamp(
+            std::chrono::system_clock::now());
+    if (request->return_commit_stats()) {
+      response->mutable_commit_stats()->set_mutation_count(
+          request->mutations_size());
+    }
+    return grpc::Status::OK;
+  }
+
+  grpc::Status Rollback(grpc::ServerContext*,
+                        spanner_proto::RollbackRequest const*,
+                        google::protobuf::Empty*) override {
+    auto status = StartRpc();
+    if (!status.ok()) return status;
+    ++rollback_count_;
+    return grpc::Status::OK;
+  }
+
+  int create_session_count() const { return create_session_count_.load(); }
+  int delete_session_count() const { return delete_session_count_.load(); }
+  int execute_sql_count() const { return execute_sql_count_.load(); }
+  int read_count() const { return read_count_.load(); }
+  int begin_transaction_count() const {
+    return begin_transaction_count_.load();
+  }
+  int commit_count() const { return commit_count_.load(); }
+  int rollback_count() const { return rollback_count_.load(); }
+  int injected_error_count() const { return injected_error_count_.load(); }
+
+ private:
+  grpc::Status StartRpc() {
+    if (options_.latency.count() != 0) {
+      std::this_thread::sleep_for(options_.latency);
+    }
+    if (options_.error_rate <= 0.0) return grpc::Status::OK;
+    thread_local auto generator = google::cloud::internal::MakeDefaultPRNG();
+    if (std::uniform_real_distribution<double>(0, 1)(generator) >=
+        options_.error_rate) {
+      return grpc::Status::OK;
+    }
+    ++injected_error_count_;
+    return grpc::Status(options_.error_code, "injected error");
+  }
+
+  spanner_proto::Session MakeSession(std::string const& database,
+                                     spanner_proto::Session const& tmpl) {
+    spanner_proto::Session session;
+    session.set_name(database + "/sessions/session-" +
+                     std::to_string(++session_id_));
+    session.set_multiplexed(tmpl.multiplexed());
+    *session.mutable_labels() = tmpl.labels();
+    *session.mutable_create_time() = google::cloud::internal::ToProtoTimestamp(
+        std::chrono::system_clock::now());
+    return session;
+  }
+
+  spanner_proto::Transaction MakeTransaction() {
+    spanner_proto::Transaction transaction;
+    transaction.set_id("transaction-" + std::to_string(++transaction_id_));
+    *transaction.mutable_read_timestamp() =
+        google::cloud::internal::ToProtoTimestamp(
+            std::chrono::system_clock::now());
+    return transaction;
+  }
+
+  // Transactions started inline return their id with the first response.
+  void SetTransaction(spanner_proto::TransactionSelector const& selector,
+                      spanner_proto::ResultSetMetadata& metadata) {
+    if (!selector.has_begin()) return;
+    *metadata.mutable_transaction() = MakeTransaction();
+  }
+
+  spanner_proto::TypeCode ColumnType(std::string const& table,
+                                     std::string const& column) const {
+    auto t = schema_.find(table);
+    if (t != schema_.end()) {
+      auto c = t->second.find(column);
+      if (c != t->second.end()) return c->second;
+    }
+    std::int64_t unused;
+    if (column == "Key" || absl::SimpleAtoi(column, &unused)) {
+      return spanner_proto::TypeCode::INT64;
+    }
+    return spanner_proto::TypeCode::STRING;
+  }
+
+  std::vector<spanner_proto::PartialResultSet> MakeQueryResults(
+      spanner_proto::ExecuteSqlRequest const& request) {
+    std::vector<spanner_proto::PartialResultSet> messages;
+    if (IsDml(request.sql())) {
+      messages.emplace_back();
+      messages[0].mutable_metadata()->mutable_row_type();
+      messages[0].mutable_stats()->set_row_count_exact(1);
+    } else {
+      auto query = ParseQuery(request.sql());
+      messages = MakeRows(query.first, query.second,
+                          ToKeyRanges(request, options_.table_size), 0);
+    }
+    SetTransaction(request.transaction(), *messages[0].mutable_metadata());
+    return messages;
+  }
+
+  /**
+   * Generates the `PartialResultSet` messages for a query or read.
+   *
+   * Each message contains at most `values_per_message` values, and large
+   * string values are split across messages if `chunk_value_size` is set.
+   */
+  std::vector<spanner_proto::PartialResultSet> MakeRows(
+      std::string const& table, std::vector<std::string> const& columns,
+      KeyRanges const& ranges, std::int64_t limit) const {
+    std::vector<spanner_proto::TypeCode> types;
+    spanner_proto::PartialResultSet current;
+    auto& row_type = *current.mutable_metadata()->mutable_row_type();
+    for (auto const& c : columns) {
+      auto& field = *row_type.add_fields();
+      field.set_name(c);
+      types.push_back(ColumnType(table, c));
+      field.mutable_type()->set_code(types.back());
+    }
+
+    std::vector<spanner_proto::PartialResultSet> messages;
+    auto flush = [&] {
+      current.set_resume_token(std::to_string(messages.size() + 1));
+      messages.push_back(std::move(current));
+      current = {};
+    };
+    auto const max_values = options_.values_per_message;
+    auto const chunk_size = options_.chunk_value_size;
+    std::int64_t row_count = 0;
+    for (auto const& range : ranges) {
+      for (auto key = range.first; key != range.second; ++key) {
+        if (limit != 0 && row_count == limit) break;
+        ++row_count;
+        for (std::size_t i = 0; i != columns.size(); ++i) {
+          auto value = columns[i] == "Key"
+                           ? values_.Make(spanner_proto::TypeCode::INT64, key)
+                           : values_.Make(types[i], key);
+          if (chunk_size != 0 && value.has_string_value()) {
+            auto& s = *value.mutable_string_value();
+            while (s.size() > chunk_size) {
+              current.add_values()->set_string_value(s.substr(0, chunk_size));
+              current.set_chunked_value(true);
+              flush();
+              s.erase(0, chunk_size);
+            }
+          }
+          *current.add_values() = std::move(value);
+          if (max_values != 0 && current.values_size() >= max_values) flush();
+        }
+      }
+    }
+    if (messages.empty() || current.values_size() != 0) flush();
+    return messages;
+  }
+
+  /// Writes the messages after @p resume_token.
+  static grpc::Status WriteAll(
+      std::vector<spanner_proto::PartialResultSet> messages,
+      std::string const& resume_token,
+      grpc::ServerWriter<spanner_proto::PartialResultSet>* writer) {
+    std::size_t skip = 0;
+    if (!resume_token.empty()) {
+      if (!absl::SimpleAtoi(resume_token, &skip)) {
+        return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT,
+                            "invalid resume token");
+      }
+      // The metadata is only sent in the first response.
+      if (skip < messages.size()) messages[skip].clear_metadata();
+    }
+    for (auto i = skip; i < messages.size(); ++i) {
+      if (i + 1 == messages.size()) {
+        writer->WriteLast(messages[i], grpc::WriteOptions());
+      } else {
+        writer->Write(messages[i]);
+      }
+    }
+    return grpc::Status::OK;
+  }
+
+  EmbeddedServerOptions const options_;
+  Schema const schema_;
+  ValueGenerator const values_;
+  std::atomic<std::int64_t> session_id_{0};
+  std::atomic<std::int64_t> transaction_id_{0};
+  std::atomic<int> create_session_count_{0};
+  std::atomic<int> delete_session_count_{0};
+  std::atomic<int> execute_sql_count_{0};
+  std::atomic<int> read_count_{0};
+  std::atomic<int> begin_transaction_count_{0};
+  std::atomic<int> commit_count_{0};
+  std::atomic<int> rollback_count_{0};
+  std::atomic<int> injected_error_count_{0};
+};
+
+/// The implementation of EmbeddedServer.
+class DefaultEmbeddedServer : public EmbeddedServer {
+ public:
+  explicit DefaultEmbeddedServer(EmbeddedServerOptions options)
+      : service_(std::move(options)) {
+    int port;
+    grpc::ServerBuilder builder;
+    builder.AddListeningPort("[::]:0", grpc::InsecureServerCredentials(),
+                             &port);
+    builder.RegisterService(&service_);
+    server_ = builder.BuildAndStart();
+    address_ = "localhost:" + std::to_string(port);
+  }
+
+  std::string address() const override { return address_; }
+  void Shutdown() override { server_->Shutdown(); }
+  void Wait() override { server_->Wait(); }
+
+  int create_session_count() const override {
+    return service_.create_session_count();
+  }
+  int delete_session_count() const override {
+    return service_.delete_session_count();
+  }
+  int execute_sql_count() const override {
+    return service_.execute_sql_count();
+  }
+  int read_count() const override { return service_.read_count(); }
+  int begin_transaction_count() const override {
+    return service_.begin_transaction_count();
+  }
+  int commit_count() const override { return service_.commit_count(); }
+  int rollback_count() const override { return service_.rollback_count(); }
+  int injected_error_count() const override {
+    return service_.injected_error_count();
+  }
+
+ private:
+  SpannerImpl service_;
+  std::unique_ptr<grpc::Server> server_;
+  std::string address_;
+};
+
+}  // namespace
+
+std::unique_ptr<EmbeddedServer> CreateEmbeddedServer(
+    EmbeddedServerOptions options) {
+  return std::make_unique<DefaultEmbeddedServer>(std::move(options));
+}
+
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
+}  // namespace spanner_benchmarks
+}  // namespace cloud
+}  // namespace google
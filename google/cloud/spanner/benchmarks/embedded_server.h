@@ -0,0 +1,108 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GOOGLE_CLOUD_CPP_GOOGLE_CLOUD_SPANNER_BENCHMARKS_EMBEDDED_SERVER_H
+#define GOOGLE_CLOUD_CPP_GOOGLE_CLOUD_SPANNER_BENCHMARKS_EMBEDDED_SERVER_H
+
+#include "google/cloud/spanner/version.h"
+#include <grpcpp/grpcpp.h>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace google {
+namespace cloud {
+namespace spanner_benchmarks {
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_BEGIN
+
+/// Configure the behavior of the embedded Spanner server.
+struct EmbeddedServerOptions {
+  /**
+   * The `CREATE TABLE` statements defining the schema.
+   *
+   * The server uses the schema to determine the type of each column returned
+   * by `ExecuteStreamingSql()` and `StreamingRead()`. Only simple column types
+   * are supported, columns in unknown tables are returned as `STRING`, except
+   * for a column named `Key`, which is returned as `INT64`.
+   */
+  std::vector<std::string> ddl_statements;
+
+  /// The number of rows returned when the request does not select any keys.
+  std::int64_t table_size = 1000;
+
+  /// The size of `STRING` and `BYTES` values.
+  std::size_t value_size = 1024;
+
+  /// If non-zero, the maximum number of values in each `PartialResultSet`.
+  int values_per_message = 0;
+
+  /**
+   * If non-zero, split `STRING` and `BYTES` values larger than this size
+   * across `PartialResultSet` messages, using `chunked_value`.
+   */
+  std::size_t chunk_value_size = 0;
+
+  /// Delay each RPC by this amount.
+  std::chrono::microseconds latency = std::chrono::microseconds(0);
+
+  /// Fail this fraction of the RPCs, in the `[0.0, 1.0]` range.
+  double error_rate = 0.0;
+
+  /// The error returned by failed RPCs.
+  grpc::StatusCode error_code = grpc::StatusCode::UNAVAILABLE;
+};
+
+/**
+ * An abstract class to run and stop the embedded Spanner server.
+ *
+ * Running the benchmarks against an embedded server eliminates the network and
+ * the service from the measurements. This makes it possible to detect small
+ * changes in the performance of the client library, for example, as part of
+ * the CI builds.
+ *
+ * The server implements the portions of `google.spanner.v1.Spanner` used by
+ * the benchmarks: sessions, queries, reads, DML, and commits. The values
+ * returned are synthetic, the server does not store any data.
+ */
+class EmbeddedServer {
+ public:
+  virtual ~EmbeddedServer() = default;
+
+  virtual std::string address() const = 0;
+  virtual void Shutdown() = 0;
+  virtual void Wait() = 0;
+
+  virtual int create_session_count() const = 0;
+  virtual int delete_session_count() const = 0;
+  virtual int execute_sql_count() const = 0;
+  virtual int read_count() const = 0;
+  virtual int begin_transaction_count() const = 0;
+  virtual int commit_count() const = 0;
+  virtual int rollback_count() const = 0;
+  virtual int injected_error_count() const = 0;
+};
+
+/// Create an embedded server, listening on a random port in `localhost`.
+std::unique_ptr<EmbeddedServer> CreateEmbeddedServer(
+    EmbeddedServerOptions options = {});
+
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
+}  // namespace spanner_benchmarks
+}  // namespace cloud
+}  // namespace google
+
+#endif  // GOOGLE_CLOUD_CPP_GOOGLE_CLOUD_SPANNER_BENCHMARKS_EMBEDDED_SERVER_H
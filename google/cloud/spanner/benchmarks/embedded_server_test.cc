@@ -0,0 +1,172 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/spanner/benchmarks/embedded_server.h"
+#include "google/cloud/spanner/client.h"
+#include "google/cloud/spanner/mutations.h"
+#include "google/cloud/common_options.h"
+#include "google/cloud/grpc_options.h"
+#include "google/cloud/testing_util/status_matchers.h"
+#include <gmock/gmock.h>
+#include <thread>
+
+namespace google {
+namespace cloud {
+namespace spanner_benchmarks {
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_BEGIN
+namespace {
+
+using ::google::cloud::testing_util::StatusIs;
+using ::std::chrono::milliseconds;
+using ::testing::ElementsAre;
+using ::testing::SizeIs;
+
+auto constexpr kCreateTableStatement = R"sql(CREATE TABLE KeyValue (
+                                        Key   INT64 NOT NULL,
+                                        Data  STRING(1024),
+                                        Flag  BOOL,
+                                     ) PRIMARY KEY (Key))sql";
+
+spanner::Client MakeClient(EmbeddedServer const& server) {
+  auto options =
+      Options{}
+          .set<GrpcCredentialOption>(grpc::InsecureChannelCredentials())
+          .set<EndpointOption>(server.address())
+          .set<spanner::SessionPoolMinSessionsOption>(1);
+  return spanner::Client(spanner::MakeConnection(
+      spanner::Database("fake-project", "fake-instance", "fake-database"),
+      std::move(options)));
+}
+
+TEST(EmbeddedServer, WaitAndShutdown) {
+  auto server = CreateEmbeddedServer();
+  EXPECT_FALSE(server->address().empty());
+
+  std::thread wait_thread([&server]() { server->Wait(); });
+  EXPECT_TRUE(wait_thread.joinable());
+  std::this_thread::sleep_for(milliseconds(20));
+  EXPECT_TRUE(wait_thread.joinable());
+  server->Shutdown();
+  wait_thread.join();
+}
+
+TEST(EmbeddedServer, ExecuteQuery) {
+  EmbeddedServerOptions options;
+  options.ddl_statements = {kCreateTableStatement};
+  options.value_size = 16;
+  auto server = CreateEmbeddedServer(options);
+  std::thread wait_thread([&server]() { server->Wait(); });
+
+  auto client = MakeClient(*server);
+  auto rows = client.ExecuteQuery(
+      spanner::SqlStatement("SELECT Key, Data, Flag FROM KeyValue"
+                            " WHERE Key >= @begin AND Key < @end",
+                            {{"begin", spanner::Value(10)},
+                             {"end", spanner::Value(13)}}));
+  using RowType = std::tuple<std::int64_t, std::string, bool>;
+  std::vector<std::int64_t> keys;
+  for (auto& row : spanner::StreamOf<RowType>(rows)) {
+    ASSERT_STATUS_OK(row);
+    keys.push_back(std::get<0>(*row));
+    EXPECT_THAT(std::get<1>(*row), SizeIs(16));
+  }
+  EXPECT_THAT(keys, ElementsAre(10, 11, 12));
+  EXPECT_EQ(1, server->execute_sql_count());
+  EXPECT_LE(1, server->create_session_count());
+
+  server->Shutdown();
+  wait_thread.join();
+}
+
+TEST(EmbeddedServer, ReadChunkedValues) {
+  EmbeddedServerOptions options;
+  options.ddl_statements = {kCreateTableStatement};
+  options.value_size = 1000;
+  options.values_per_message = 3;
+  options.chunk_value_size = 64;
+  auto server = CreateEmbeddedServer(options);
+  std::thread wait_thread([&server]() { server->Wait(); });
+
+  auto client = MakeClient(*server);
+  auto rows = client.Read(
+      "KeyValue",
+      spanner::KeySet().AddRange(spanner::MakeKeyBoundClosed(spanner::Value(5)),
+                                 spanner::MakeKeyBoundOpen(spanner::Value(9))),
+      {"Key", "Data"});
+  using RowType = std::tuple<std::int64_t, std::string>;
+  std::vector<std::int64_t> keys;
+  for (auto& row : spanner::StreamOf<RowType>(rows)) {
+    ASSERT_STATUS_OK(row);
+    keys.push_back(std::get<0>(*row));
+    EXPECT_THAT(std::get<1>(*row), SizeIs(1000));
+  }
+  EXPECT_THAT(keys, ElementsAre(5, 6, 7, 8));
+  EXPECT_EQ(1, server->read_count());
+
+  server->Shutdown();
+  wait_thread.join();
+}
+
+TEST(EmbeddedServer, Commit) {
+  auto server = CreateEmbeddedServer();
+  std::thread wait_thread([&server]() { server->Wait(); });
+
+  auto client = MakeClient(*server);
+  auto commit = client.Commit(spanner::Mutations{
+      spanner::MakeInsertOrUpdateMutation("KeyValue", {"Key", "Data"},
+                                          std::int64_t{1}, "value")});
+  ASSERT_STATUS_OK(commit);
+  EXPECT_EQ(1, server->commit_count());
+
+  auto dml = client.Commit([&client](spanner::Transaction const& txn)
+                               -> StatusOr<spanner::Mutations> {
+    auto update = client.ExecuteDml(
+        txn, spanner::SqlStatement("UPDATE KeyValue SET Data = 'v'"
+                                   " WHERE Key = 1"));
+    if (!update) return std::move(update).status();
+    EXPECT_EQ(1, update->RowsModified());
+    return spanner::Mutations{};
+  });
+  ASSERT_STATUS_OK(dml);
+  EXPECT_EQ(2, server->commit_count());
+
+  server->Shutdown();
+  wait_thread.join();
+}
+
+TEST(EmbeddedServer, InjectErrors) {
+  EmbeddedServerOptions options;
+  options.error_rate = 1.0;
+  options.error_code = grpc::StatusCode::PERMISSION_DENIED;
+  auto server = CreateEmbeddedServer(options);
+  std::thread wait_thread([&server]() { server->Wait(); });
+
+  auto client = MakeClient(*server);
+  auto rows = client.ExecuteQuery(
+      spanner::SqlStatement("SELECT Key, Data FROM KeyValue"));
+  for (auto& row : rows) {
+    EXPECT_THAT(row, StatusIs(StatusCode::kPermissionDenied));
+  }
+  EXPECT_LE(1, server->injected_error_count());
+  EXPECT_EQ(0, server->execute_sql_count());
+
+  server->Shutdown();
+  wait_thread.join();
+}
+
+}  // namespace
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
+}  // namespace spanner_benchmarks
+}  // namespace cloud
+}  // namespace google
@@ -14,6 +14,7 @@
 
 #include "google/cloud/spanner/admin/database_admin_client.h"
 #include "google/cloud/spanner/benchmarks/benchmarks_config.h"
+#include "google/cloud/spanner/benchmarks/embedded_server.h"
 #include "google/cloud/spanner/client.h"
 #include "google/cloud/spanner/internal/defaults.h"
 #include "google/cloud/spanner/internal/route_to_leader.h"
@@ -57,6 +58,7 @@ namespace spanner = ::google::cloud::spanner;
 namespace spanner_internal = ::google::cloud::spanner_internal;
 using ::google::cloud::Status;
 using ::google::cloud::spanner_benchmarks::Config;
+using ::google::cloud::spanner_benchmarks::ConnectionOptions;
 using ::google::cloud::testing_util::Timer;
 
 struct RowCpuSample {
@@ -214,7 +216,8 @@ class ExperimentImpl {
   Status FillTable(Config const& config, spanner::Database const& database,
                    std::string const& table_name) {
     // We need to populate some data or all the requests to read will fail.
-    spanner::Client client(spanner::MakeConnection(database));
+    spanner::Client client(
+        spanner::MakeConnection(database, ConnectionOptions(config)));
     std::cout << "# Populating database " << std::flush;
     int const task_count = 16;
     std::vector<std::future<void>> tasks(task_count);
@@ -293,7 +296,7 @@ class ExperimentImpl {
     auto connection = spanner::MakeConnection(
         database,
         // This pre-creates all the Sessions we will need (one per thread).
-        google::cloud::Options{}
+        ConnectionOptions(config)
             .set<google::cloud::GrpcNumChannelsOption>(num_channels)
             .set<spanner::SessionPoolMinSessionsOption>(
                 config.maximum_threads));
@@ -306,9 +309,8 @@ class ExperimentImpl {
     std::cout << "# Creating " << num_channels << " stub"
               << (num_channels != 1 ? "s" : "") << "\n"
               << std::flush;
-    auto opts =
-        google::cloud::Options{}.set<google::cloud::GrpcNumChannelsOption>(
-            num_channels);
+    auto opts = ConnectionOptions(config)
+                    .set<google::cloud::GrpcNumChannelsOption>(num_channels);
     opts = spanner_internal::DefaultOptions(std::move(opts));
     auto auth = google::cloud::internal::CreateAuthenticationStrategy(
         opts.get<google::cloud::GrpcCredentialOption>());
@@ -1305,6 +1307,47 @@ std::map<std::string, ExperimentFactory> AvailableExperiments() {
   };
 }
 
+/**
+ * Creates the database used in the experiments.
+ *
+ * Returns `false` if the database already exists and should be reused.
+ */
+google::cloud::StatusOr<bool> CreateDatabase(
+    google::cloud::spanner_admin::DatabaseAdminClient& admin_client,
+    spanner::Database const& database,
+    std::vector<std::string> const& ddl_statements,
+    bool user_specified_database) {
+  std::cout << "# Waiting for database creation to complete " << std::flush;
+  google::spanner::admin::database::v1::CreateDatabaseRequest request;
+  request.set_parent(database.instance().FullName());
+  request.set_create_statement(
+      absl::StrCat("CREATE DATABASE `", database.database_id(), "`"));
+  for (auto const& s : ddl_statements) request.add_extra_statements(s);
+  google::cloud::StatusOr<google::spanner::admin::database::v1::Database> db;
+  int constexpr kMaxCreateDatabaseRetries = 3;
+  for (int retry = 0; retry <= kMaxCreateDatabaseRetries; ++retry) {
+    auto create_future = admin_client.CreateDatabase(request);
+    for (;;) {
+      auto status = create_future.wait_for(std::chrono::seconds(1));
+      if (status == std::future_status::ready) break;
+      std::cout << '.' << std::flush;
+    }
+    db = create_future.get();
+    if (db) break;
+    if (db.status().code() != google::cloud::StatusCode::kUnavailable) break;
+    std::this_thread::sleep_for(retry * std::chrono::seconds(3));
+  }
+  std::cout << " DONE\n";
+
+  if (db) return true;
+  if (user_specified_database &&
+      db.status().code() == google::cloud::StatusCode::kAlreadyExists) {
+    std::cout << "# Re-using existing database\n";
+    return false;
+  }
+  return std::move(db).status();
+}
+
 }  // namespace
 
 int main(int argc, char* argv[]) {
@@ -1364,46 +1407,42 @@ int main(int argc, char* argv[]) {
   // print everything out.
   std::cout << config << std::flush;
 
-  google::cloud::spanner_admin::DatabaseAdminClient admin_client(
-      google::cloud::spanner_admin::MakeDatabaseAdminConnection());
-
-  std::cout << "# Waiting for database creation to complete " << std::flush;
-  google::spanner::admin::database::v1::CreateDatabaseRequest request;
-  request.set_parent(database.instance().FullName());
-  request.set_create_statement(
-      absl::StrCat("CREATE DATABASE `", database.database_id(), "`"));
+  std::vector<std::string> ddl_statements;
   for (auto const& kv : available) {
     auto experiment = kv.second(generator);
     auto s = experiment->AdditionalDdlStatement();
     if (s.empty()) continue;
-    request.add_extra_statements(std::move(s));
+    ddl_statements.push_back(std::move(s));
   }
-  google::cloud::StatusOr<google::spanner::admin::database::v1::Database> db;
-  int constexpr kMaxCreateDatabaseRetries = 3;
-  for (int retry = 0; retry <= kMaxCreateDatabaseRetries; ++retry) {
-    auto create_future = admin_client.CreateDatabase(request);
-    for (;;) {
-      auto status = create_future.wait_for(std::chrono::seconds(1));
-      if (status == std::future_status::ready) break;
-      std::cout << '.' << std::flush;
-    }
-    db = create_future.get();
-    if (db) break;
-    if (db.status().code() != google::cloud::StatusCode::kUnavailable) break;
-    std::this_thread::sleep_for(retry * std::chrono::seconds(3));
+
+  std::unique_ptr<google::cloud::spanner_benchmarks::EmbeddedServer>
+      embedded_server;
+  std::thread embedded_server_thread;
+  if (config.embedded_server) {
+    google::cloud::spanner_benchmarks::EmbeddedServerOptions options;
+    options.ddl_statements = ddl_statements;
+    options.table_size = config.table_size;
+    embedded_server =
+        google::cloud::spanner_benchmarks::CreateEmbeddedServer(options);
+    embedded_server_thread =
+        std::thread([&embedded_server] { embedded_server->Wait(); });
+    config.embedded_server_address = embedded_server->address();
   }
-  std::cout << " DONE\n";
 
-  bool database_created = true;
-  if (!db) {
-    if (user_specified_database &&
-        db.status().code() == google::cloud::StatusCode::kAlreadyExists) {
-      std::cout << "# Re-using existing database\n";
-      database_created = false;
-    } else {
-      std::cerr << "Error creating database: " << db.status() << "\n";
+  google::cloud::spanner_admin::DatabaseAdminClient admin_client(
+      google::cloud::spanner_admin::MakeDatabaseAdminConnection());
+
+  // With an embedded server there is no database to create or drop, and the
+  // server returns synthetic data, so there is no need to populate the tables.
+  bool database_created = false;
+  if (!config.embedded_server) {
+    auto created = CreateDatabase(admin_client, database, ddl_statements,
+                                  user_specified_database);
+    if (!created) {
+      std::cerr << "Error creating database: " << created.status() << "\n";
       return 1;
     }
+    database_created = *created;
   }
 
   std::cout << "ChannelCount,ThreadCount,UsingStub"
@@ -1427,7 +1466,7 @@ int main(int argc, char* argv[]) {
     if (!run_status.ok()) exit_status = EXIT_FAILURE;
   }
 
-  if (!user_specified_database) {
+  if (!config.embedded_server && !user_specified_database) {
     auto drop = admin_client.DropDatabase(database.FullName());
     if (!drop.ok()) {
       std::cerr << "# Error dropping database: " << drop << "\n";
@@ -1436,5 +1475,9 @@ int main(int argc, char* argv[]) {
   std::cout << "# Experiment finished, "
             << (user_specified_database ? "user-specified database kept\n"
                                         : "database dropped\n");
+  if (embedded_server) {
+    embedded_server->Shutdown();
+    embedded_server_thread.join();
+  }
   return exit_status;
 }
@@ -14,6 +14,7 @@
 
 #include "google/cloud/spanner/admin/database_admin_client.h"
 #include "google/cloud/spanner/benchmarks/benchmarks_config.h"
+#include "google/cloud/spanner/benchmarks/embedded_server.h"
 #include "google/cloud/spanner/client.h"
 #include "google/cloud/spanner/testing/pick_random_instance.h"
 #include "google/cloud/spanner/testing/random_database_name.h"
@@ -39,6 +40,7 @@ struct SingleRowThroughputSample {
 };
 
 using ::google::cloud::spanner_benchmarks::Config;
+using ::google::cloud::spanner_benchmarks::ConnectionOptions;
 using SampleSink = std::function<void(std::vector<SingleRowThroughputSample>)>;
 using RandomKeyGenerator = std::function<std::int64_t()>;
 using ErrorSink = std::function<void(std::vector<google::cloud::Status>)>;
@@ -52,7 +54,7 @@ spanner::Client MakeClient(Config const& config, int num_channels,
   auto connection = spanner::MakeConnection(
       database,
       // This pre-creates all the Sessions we will need (one per thread).
-      google::cloud::Options{}
+      ConnectionOptions(config)
           .set<google::cloud::GrpcNumChannelsOption>(num_channels)
           .set<spanner::SessionPoolMinSessionsOption>(config.maximum_threads));
   return spanner::Client(std::move(connection));
@@ -103,7 +105,8 @@ class BasicExperiment : public Experiment {
   void FillTable(Config const& config, spanner::Database const& database,
                  std::string const& value) {
     // We need to populate some data or all the requests to read will fail.
-    spanner::Client client(spanner::MakeConnection(database));
+    spanner::Client client(
+        spanner::MakeConnection(database, ConnectionOptions(config)));
     std::cout << "# Populating database " << std::flush;
     int const task_count = 16;
     std::vector<std::future<void>> tasks(task_count);
@@ -392,6 +395,50 @@ std::map<std::string, std::shared_ptr<Experiment>> AvailableExperiments() {
   };
 }
 
+auto constexpr kCreateTableStatement = R"sql(CREATE TABLE KeyValue (
+                                        Key   INT64 NOT NULL,
+                                        Data  STRING(1024),
+                                     ) PRIMARY KEY (Key))sql";
+
+/**
+ * Creates the database used in the experiments.
+ *
+ * Returns `false` if the database already exists and should be reused.
+ */
+google::cloud::StatusOr<bool> CreateDatabase(
+    google::cloud::spanner_admin::DatabaseAdminClient& admin_client,
+    spanner::Database const& database, bool user_specified_database) {
+  std::cout << "# Waiting for database creation to complete " << std::flush;
+  google::spanner::admin::database::v1::CreateDatabaseRequest request;
+  request.set_parent(database.instance().FullName());
+  request.set_create_statement(
+      absl::StrCat("CREATE DATABASE `", database.database_id(), "`"));
+  request.add_extra_statements(kCreateTableStatement);
+  google::cloud::StatusOr<google::spanner::admin::database::v1::Database> db;
+  int constexpr kMaxCreateDatabaseRetries = 3;
+  for (int retry = 0; retry <= kMaxCreateDatabaseRetries; ++retry) {
+    auto create_future = admin_client.CreateDatabase(request);
+    for (;;) {
+      auto status = create_future.wait_for(std::chrono::seconds(1));
+      if (status == std::future_status::ready) break;
+      std::cout << '.' << std::flush;
+    }
+    db = create_future.get();
+    if (db) break;
+    if (db.status().code() != google::cloud::StatusCode::kUnavailable) break;
+    std::this_thread::sleep_for(retry * std::chrono::seconds(3));
+  }
+  std::cout << " DONE\n";
+
+  if (db) return true;
+  if (user_specified_database &&
+      db.status().code() == google::cloud::StatusCode::kAlreadyExists) {
+    std::cout << "# Re-using existing database\n";
+    return false;
+  }
+  return std::move(db).status();
+}
+
 }  // namespace
 
 int main(int argc, char* argv[]) {
@@ -439,44 +486,34 @@ int main(int argc, char* argv[]) {
     return 1;
   }
 
+  std::unique_ptr<google::cloud::spanner_benchmarks::EmbeddedServer>
+      embedded_server;
+  std::thread embedded_server_thread;
+  if (config.embedded_server) {
+    google::cloud::spanner_benchmarks::EmbeddedServerOptions options;
+    options.ddl_statements = {kCreateTableStatement};
+    options.table_size = config.table_size;
+    embedded_server =
+        google::cloud::spanner_benchmarks::CreateEmbeddedServer(options);
+    embedded_server_thread =
+        std::thread([&embedded_server] { embedded_server->Wait(); });
+    config.embedded_server_address = embedded_server->address();
+  }
+
   google::cloud::spanner_admin::DatabaseAdminClient admin_client(
       google::cloud::spanner_admin::MakeDatabaseAdminConnection());
 
-  std::cout << "# Waiting for database creation to complete " << std::flush;
-  google::spanner::admin::database::v1::CreateDatabaseRequest request;
-  request.set_parent(database.instance().FullName());
-  request.set_create_statement(
-      absl::StrCat("CREATE DATABASE `", database.database_id(), "`"));
-  request.add_extra_statements(R"sql(CREATE TABLE KeyValue (
-                                        Key   INT64 NOT NULL,
-                                        Data  STRING(1024),
-                                     ) PRIMARY KEY (Key))sql");
-  google::cloud::StatusOr<google::spanner::admin::database::v1::Database> db;
-  int constexpr kMaxCreateDatabaseRetries = 3;
-  for (int retry = 0; retry <= kMaxCreateDatabaseRetries; ++retry) {
-    auto create_future = admin_client.CreateDatabase(request);
-    for (;;) {
-      auto status = create_future.wait_for(std::chrono::seconds(1));
-      if (status == std::future_status::ready) break;
-      std::cout << '.' << std::flush;
-    }
-    db = create_future.get();
-    if (db) break;
-    if (db.status().code() != google::cloud::StatusCode::kUnavailable) break;
-    std::this_thread::sleep_for(retry * std::chrono::seconds(3));
-  }
-  std::cout << " DONE\n";
-
-  bool database_created = true;
-  if (!db) {
-    if (user_specified_database &&
-        db.status().code() == google::cloud::StatusCode::kAlreadyExists) {
-      std::cout << "# Re-using existing database\n";
-      database_created = false;
-    } else {
-      std::cerr << "Error creating database: " << db.status() << "\n";
+  // With an embedded server there is no database to create or drop, and the
+  // server returns synthetic data, so there is no need to populate the table.
+  bool database_created = false;
+  if (!config.embedded_server) {
+    auto created =
+        CreateDatabase(admin_client, database, user_specified_database);
+    if (!created) {
+      std::cerr << "Error creating database: " << created.status() << "\n";
       return 1;
     }
+    database_created = *created;
   }
 
   std::cout << "ChannelCount,ThreadCount,EventCount,ElapsedTime\n"
@@ -500,7 +537,7 @@ int main(int argc, char* argv[]) {
   }
   experiment->Run(config, database, cout_sink);
 
-  if (!user_specified_database) {
+  if (!config.embedded_server && !user_specified_database) {
     auto drop = admin_client.DropDatabase(database.FullName());
     if (!drop.ok()) {
       std::cerr << "# Error dropping database: " << drop << "\n";
@@ -509,5 +546,9 @@ int main(int argc, char* argv[]) {
   std::cout << "# Experiment finished, "
             << (user_specified_database ? "user-specified database kept\n"
                                         : "database dropped\n");
+  if (embedded_server) {
+    embedded_server->Shutdown();
+    embedded_server_thread.join();
+  }
   return 0;
 }
@@ -18,6 +18,7 @@
 
 spanner_client_benchmark_programs = [
     "benchmarks_config_test.cc",
+    "embedded_server_test.cc",
     "multiple_rows_cpu_benchmark.cc",
     "single_row_throughput_benchmark.cc",
 ]
@@ -25,14 +25,13 @@ namespace cloud {
 namespace spanner {
 GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_BEGIN
 
-using ::google::cloud::internal::Base64Decoder;
-
 // Prints the bytes in the form B"...", where printable bytes are output
 // normally, double quotes are backslash escaped, and non-printable characters
 // are printed as a 3-digit octal escape sequence.
 std::ostream& operator<<(std::ostream& os, Bytes const& bytes) {
   os << R"(B")";
-  for (auto const byte : Base64Decoder(bytes.base64_rep_)) {
+  for (auto const c : bytes.bytes_) {
+    auto const byte = static_cast<unsigned char>(c);
     if (byte == '"') {
       os << R"(\")";
     } else if (std::isprint(byte)) {
@@ -59,27 +58,27 @@ GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
 namespace spanner_internal {
 GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_BEGIN
 struct BytesInternals {
-  static spanner::Bytes Create(std::string rep) {
-    spanner::Bytes bytes;
-    bytes.base64_rep_ = std::move(rep);
-    return bytes;
+  static spanner::Bytes Create(std::string bytes) {
+    spanner::Bytes result;
+    result.bytes_ = std::move(bytes);
+    return result;
   }
 
-  static std::string GetRep(spanner::Bytes&& bytes) {
-    return std::move(bytes.base64_rep_);
+  static std::string const& GetBytes(spanner::Bytes const& bytes) {
+    return bytes.bytes_;
   }
 };
 
 // Construction from a base64-encoded US-ASCII `std::string`.
 StatusOr<spanner::Bytes> BytesFromBase64(std::string input) {
-  auto status = google::cloud::internal::ValidateBase64String(input);
-  if (!status.ok()) return status;
-  return BytesInternals::Create(std::move(input));
+  auto bytes = google::cloud::internal::Base64Decode(input);
+  if (!bytes) return std::move(bytes).status();
+  return BytesInternals::Create(*std::move(bytes));
 }
 
 // Conversion to a base64-encoded US-ASCII `std::string`.
 std::string BytesToBase64(spanner::Bytes b) {
-  return BytesInternals::GetRep(std::move(b));
+  return google::cloud::internal::Base64Encode(BytesInternals::GetBytes(b));
 }
 
 GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
@@ -16,10 +16,10 @@
 #define GOOGLE_CLOUD_CPP_GOOGLE_CLOUD_SPANNER_BYTES_H
 
 #include "google/cloud/spanner/version.h"
-#include "google/cloud/internal/base64_transforms.h"
 #include "google/cloud/status_or.h"
 #include <array>
 #include <cstddef>
+#include <iterator>
 #include <ostream>
 #include <string>
 
@@ -39,6 +39,10 @@ GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_BEGIN
  *
  * A `Bytes` value can be constructed from, and converted to any sequence of
  * octets. `Bytes` values can be compared for equality.
+ *
+ * The octets are stored as-is. The base64 encoding required by the Spanner
+ * protos happens only when the value is serialized (and the decoding when it
+ * is parsed), so constructing and reading `Bytes` values is just a copy.
  */
 class Bytes {
  public:
@@ -48,11 +52,7 @@ class Bytes {
   /// @name Construction from a sequence of octets.
   ///@{
   template <typename InputIt>
-  Bytes(InputIt first, InputIt last) {
-    google::cloud::internal::Base64Encoder encoder;
-    while (first != last) encoder.PushBack(*first++);
-    base64_rep_ = std::move(encoder).FlushAndPad();
-  }
+  Bytes(InputIt first, InputIt last) : bytes_(first, last) {}
   template <typename Container>
   explicit Bytes(Container const& c) : Bytes(std::begin(c), std::end(c)) {}
   ///@}
@@ -61,14 +61,14 @@ class Bytes {
   /// construction from a range specified as a pair of input iterators.
   template <typename Container>
   Container get() const {
-    google::cloud::internal::Base64Decoder decoder(base64_rep_);
-    return Container(decoder.begin(), decoder.end());
+    auto const* data = reinterpret_cast<unsigned char const*>(bytes_.data());
+    return Container(data, data + bytes_.size());
   }
 
   /// @name Relational operators
   ///@{
   friend bool operator==(Bytes const& a, Bytes const& b) {
-    return a.base64_rep_ == b.base64_rep_;
+    return a.bytes_ == b.bytes_;
   }
   friend bool operator!=(Bytes const& a, Bytes const& b) { return !(a == b); }
   ///@}
@@ -84,9 +84,15 @@ class Bytes {
  private:
   friend struct spanner_internal::BytesInternals;
 
-  std::string base64_rep_;  // valid base64 representation
+  std::string bytes_;  // the raw octets
 };
 
+/// Conversion to `std::string` is a plain copy.
+template <>
+inline std::string Bytes::get<std::string>() const {
+  return bytes_;
+}
+
 GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
 }  // namespace spanner
 
@@ -29,6 +29,8 @@ namespace spanner {
 GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_BEGIN
 namespace {
 
+using ::google::cloud::testing_util::StatusIs;
+
 TEST(Bytes, RoundTrip) {
   char c = std::numeric_limits<char>::min();
   std::string chars(1, c);
@@ -111,6 +113,14 @@ TEST(Bytes, Conversions) {
   EXPECT_EQ(v_plain, bytes->get<std::vector<std::uint8_t>>());
 }
 
+TEST(Bytes, FromInvalidBase64) {
+  for (std::string const base64 : {"Zm9", "Zm9v.mFy", "Zg==Zg=="}) {
+    EXPECT_THAT(spanner_internal::BytesFromBase64(base64),
+                StatusIs(StatusCode::kInvalidArgument))
+        << base64;
+  }
+}
+
 TEST(Bytes, RelationalOperators) {
   std::string const s_plain = "The quick brown fox jumps over the lazy dog.";
   std::deque<char> const d_plain(s_plain.begin(), s_plain.end());
@@ -0,0 +1,391 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/spanner/fixed_numeric.h"
+#include "google/cloud/internal/make_status.h"
+#include "absl/strings/str_cat.h"
+#include "absl/types/optional.h"
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <string>
+
+namespace google {
+namespace cloud {
+namespace spanner_internal {
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::uint64_t kUnitsPerOne = 1000000000;  // 10^kScale
+constexpr std::uint64_t kTenPow19 = 10000000000000000000ULL;
+
+// Any larger shifts overflow, or round to zero.
+constexpr int kExponentClamp = 100;
+
+// The number of decimal digits in `kFixedDecimalMaxUnits`.
+constexpr std::int64_t kMaxDigits = 38;
+
+absl::uint128 Magnitude(absl::int128 v) {
+  auto const u = static_cast<absl::uint128>(v);
+  return v < 0 ? -u : u;
+}
+
+absl::int128 Negate(absl::uint128 u, bool negative) {
+  auto const v = static_cast<absl::int128>(u);
+  return negative ? -v : v;
+}
+
+bool IsDigit(char ch) { return ch >= '0' && ch <= '9'; }
+
+bool IsNaN(absl::string_view s) {
+  return s.size() == 3 && (s[0] == 'n' || s[0] == 'N') &&
+         (s[1] == 'a' || s[1] == 'A') && (s[2] == 'n' || s[2] == 'N');
+}
+
+constexpr std::uint64_t kPowersOf10[] = {
+    1ULL,
+    10ULL,
+    100ULL,
+    1000ULL,
+    10000ULL,
+    100000ULL,
+    1000000ULL,
+    10000000ULL,
+    100000000ULL,
+    1000000000ULL,
+    10000000000ULL,
+    100000000000ULL,
+    1000000000000ULL,
+    10000000000000ULL,
+    100000000000000ULL,
+    1000000000000000ULL,
+    10000000000000000ULL,
+    100000000000000000ULL,
+    1000000000000000000ULL,
+    10000000000000000000ULL,
+};
+
+// Returns 10^n as an `absl::uint128`, for n in [0, 38].
+absl::uint128 PowerOf10(int n) {
+  if (n <= 19) return kPowersOf10[n];
+  return absl::uint128(kTenPow19) * kPowersOf10[n - 19];
+}
+
+/**
+ * Multiplies @p magnitude by 10^@p shift, rounding halfway cases away from
+ * zero if @p shift is negative.
+ *
+ * Returns `absl::nullopt` if the result would be larger than @p max.
+ */
+absl::optional<absl::uint128> Scale(absl::uint128 magnitude, int shift,
+                                    absl::uint128 max) {
+  if (magnitude == 0) return magnitude;
+  if (shift < 0) {
+    // Any magnitude in range is less than half of 10^39.
+    if (shift < -38) return absl::uint128(0);
+    auto const divisor = PowerOf10(-shift);
+    auto const q = magnitude / divisor;
+    auto const r = magnitude % divisor;
+    auto const rounded = r >= divisor - r ? q + 1 : q;
+    if (rounded > max) return absl::nullopt;
+    return rounded;
+  }
+  auto const limit = max / 10;
+  for (; shift > 0; --shift) {
+    if (magnitude > limit) return absl::nullopt;
+    magnitude *= 10;
+  }
+  if (magnitude > max) return absl::nullopt;
+  return magnitude;
+}
+
+// Returns `units * 10^digits.size() + digits`.
+absl::uint128 Accumulate(absl::uint128 units, absl::string_view digits) {
+  while (!digits.empty()) {
+    auto const n = (std::min)(digits.size(), std::size_t{19});
+    std::uint64_t chunk = 0;
+    for (auto c : digits.substr(0, n)) {
+      chunk = chunk * 10 + static_cast<unsigned>(c - '0');
+    }
+    units = units * kPowersOf10[n] + chunk;
+    digits.remove_prefix(n);
+  }
+  return units;
+}
+
+constexpr char kDigitPairs[] =
+    "00010203040506070809101112131415161718192021222324252627282930313233343536"
+    "37383940414243444546474849505152535455565758596061626364656667686970717273"
+    "7475767778798081828384858687888990919293949596979899";
+
+// Appends the decimal digits of `v` before `p`, with at least `width` digits.
+char* FormatDigits(std::uint64_t v, int width, char* p) {
+  // Generate two digits at a time, this halves the dependent divisions.
+  for (; v >= 100 || width > 2; v /= 100, width -= 2) {
+    auto const* pair = kDigitPairs + 2 * (v % 100);
+    *--p = pair[1];
+    *--p = pair[0];
+  }
+  if (v >= 10 || width == 2) {
+    *--p = kDigitPairs[2 * v + 1];
+    *--p = kDigitPairs[2 * v];
+  } else if (v != 0 || width == 1) {
+    *--p = static_cast<char>('0' + v);
+  }
+  return p;
+}
+
+}  // namespace
+
+StatusOr<absl::int128> ParseFixedDecimal(absl::string_view s,
+                                         bool const has_nan) {
+  auto const input = s;
+  auto invalid = [input] {
+    return internal::InvalidArgumentError(std::string(input), GCP_ERROR_INFO());
+  };
+  auto out_of_range = [input] {
+    return internal::OutOfRangeError(std::string(input), GCP_ERROR_INFO());
+  };
+  if (IsNaN(s)) {
+    if (has_nan) return kFixedDecimalNaN;
+    return invalid();
+  }
+
+  bool negative = false;
+  if (!s.empty() && (s.front() == '+' || s.front() == '-')) {
+    negative = s.front() == '-';
+    s.remove_prefix(1);
+  }
+  std::size_t n = 0;
+  while (n != s.size() && IsDigit(s[n])) ++n;
+  auto const int_part = s.substr(0, n);
+  s.remove_prefix(n);
+  auto frac_part = absl::string_view{};
+  if (!s.empty() && s.front() == '.') {
+    s.remove_prefix(1);
+    n = 0;
+    while (n != s.size() && IsDigit(s[n])) ++n;
+    frac_part = s.substr(0, n);
+    s.remove_prefix(n);
+  }
+  if (int_part.empty() && frac_part.empty()) return invalid();
+
+  // Exponents beyond this limit either overflow, or round to zero.
+  auto constexpr kExponentLimit = 1000000;
+  std::int64_t exponent = 0;
+  if (!s.empty() && (s.front() == 'e' || s.front() == 'E')) {
+    s.remove_prefix(1);
+    bool negative_exponent = false;
+    if (!s.empty() && (s.front() == '+' || s.front() == '-')) {
+      negative_exponent = s.front() == '-';
+      s.remove_prefix(1);
+    }
+    if (s.empty() || !IsDigit(s.front())) return invalid();
+    for (; !s.empty() && IsDigit(s.front()); s.remove_prefix(1)) {
+      if (exponent < kExponentLimit) exponent = exponent * 10 + (s[0] - '0');
+    }
+    if (negative_exponent) exponent = -exponent;
+  }
+  if (!s.empty()) return invalid();
+
+  // The value is `digits * 10^(exponent - frac_part.size())`, where `digits`
+  // is the concatenation of the integer and fractional parts. Only the first
+  // `keep` digits contribute to the 10^-9 units.
+  auto const size =
+      static_cast<std::int64_t>(int_part.size() + frac_part.size());
+  auto const keep = size + exponent + kFixedDecimalScale -
+                    static_cast<std::int64_t>(frac_part.size());
+  auto digit = [&](std::int64_t i) {
+    auto const k = static_cast<std::size_t>(i);
+    auto const c = k < int_part.size() ? int_part[k]
+                                       : frac_part[k - int_part.size()];
+    return static_cast<unsigned>(c - '0');
+  };
+
+  // Skip the leading zeros, then reject any values with more significant
+  // digits than the largest value. The remaining digits are accumulated in
+  // 64-bit chunks, which avoids any 128-bit divisions.
+  auto const end = (std::min)(size, keep);
+  std::int64_t i = 0;
+  while (i < end && digit(i) == 0) ++i;
+  auto const significant = end - i;
+  if (significant > kMaxDigits) return out_of_range();
+  absl::uint128 units = 0;
+  auto const int_size = static_cast<std::int64_t>(int_part.size());
+  auto const split = (std::max)(i, (std::min)(int_size, end));
+  if (i < split) {
+    units = Accumulate(units,
+                       int_part.substr(static_cast<std::size_t>(i),
+                                       static_cast<std::size_t>(split - i)));
+  }
+  if (split < end) {
+    units = Accumulate(
+        units, frac_part.substr(static_cast<std::size_t>(split - int_size),
+                                static_cast<std::size_t>(end - split)));
+  }
+
+  auto const max = static_cast<absl::uint128>(kFixedDecimalMaxUnits);
+  if (keep < size) {
+    // Round the remaining digits, halfway cases away from zero.
+    if (keep >= 0 && digit(keep) >= 5) ++units;
+  } else if (units != 0) {
+    auto const zeros = keep - size;
+    if (significant + zeros > kMaxDigits) return out_of_range();
+    units *= PowerOf10(static_cast<int>(zeros));
+  }
+  if (units > max) return out_of_range();
+  return Negate(units, negative);
+}
+
+std::string FormatFixedDecimal(absl::int128 units) {
+  if (units == kFixedDecimalNaN) return "NaN";
+  if (units == 0) return "0";
+  auto const magnitude = Magnitude(units);
+
+  // The largest value has 29 integer digits, a point, and 9 fractional digits.
+  std::array<char, 48> buffer;
+  char* const end = buffer.data() + buffer.size();
+  char* p = end;
+
+  // Split the magnitude into 64-bit pieces, so the digits can be generated
+  // without any further 128-bit divisions. If `int_high` is not zero the
+  // integer part is `int_high` followed by the 10 digits in `int_low`.
+  std::uint64_t frac;
+  std::uint64_t int_low;
+  std::uint64_t int_high = 0;
+  if (absl::Uint128High64(magnitude) == 0) {
+    auto const m = absl::Uint128Low64(magnitude);
+    frac = m % kUnitsPerOne;
+    int_low = m / kUnitsPerOne;
+  } else {
+    auto const high = magnitude / kTenPow19;
+    auto const low = absl::Uint128Low64(magnitude - high * kTenPow19);
+    frac = low % kUnitsPerOne;
+    int_low = low / kUnitsPerOne;
+    int_high = absl::Uint128Low64(high);
+  }
+  if (frac != 0) {
+    int width = kFixedDecimalScale;
+    for (; frac % 10 == 0; frac /= 10) --width;
+    p = FormatDigits(frac, width, p);
+    *--p = '.';
+  }
+  if (int_high != 0) {
+    p = FormatDigits(int_low, 10, p);
+    p = FormatDigits(int_high, 0, p);
+  } else if (int_low != 0) {
+    p = FormatDigits(int_low, 0, p);
+  } else {
+    *--p = '0';
+  }
+  if (units < 0) *--p = '-';
+  return std::string(p, end);
+}
+
+StatusOr<absl::int128> ScaleToFixedDecimal(absl::int128 i, int exponent) {
+  exponent = (std::max)(-kExponentClamp, (std::min)(exponent, kExponentClamp));
+  auto const scaled =
+      Scale(Magnitude(i), exponent + kFixedDecimalScale,
+            static_cast<absl::uint128>(kFixedDecimalMaxUnits));
+  if (!scaled) {
+    return internal::OutOfRangeError(
+        absl::StrCat(ToString(i), "e", exponent,
+                     " is outside the NUMERIC range"),
+        GCP_ERROR_INFO());
+  }
+  return Negate(*scaled, i < 0);
+}
+
+StatusOr<absl::int128> ScaleFromFixedDecimal(absl::int128 units,
+                                             int exponent) {
+  if (units == kFixedDecimalNaN) return DataLoss("NaN");
+  exponent = (std::max)(-kExponentClamp, (std::min)(exponent, kExponentClamp));
+  auto const scaled =
+      Scale(Magnitude(units), exponent - kFixedDecimalScale,
+            static_cast<absl::uint128>(absl::Int128Max()));
+  if (!scaled) return DataLoss(FormatFixedDecimal(units));
+  return Negate(*scaled, units < 0);
+}
+
+StatusOr<absl::int128> MultiplyFixedDecimal(absl::int128 a, absl::int128 b) {
+  if (a == kFixedDecimalNaN || b == kFixedDecimalNaN) return kFixedDecimalNaN;
+  auto const negative = (a < 0) != (b < 0);
+  auto const x = Magnitude(a);
+  auto const y = Magnitude(b);
+  auto const max = static_cast<absl::uint128>(kFixedDecimalMaxUnits);
+
+  absl::uint128 q;
+  std::uint64_t r;
+  if (absl::Uint128High64(x) == 0 && absl::Uint128High64(y) == 0) {
+    // The common case, the product fits in 128 bits.
+    auto const p = x * y;
+    q = p / kUnitsPerOne;
+    r = absl::Uint128Low64(p % kUnitsPerOne);
+  } else {
+    // Compute the 256-bit product in 64-bit limbs, least significant first,
+    // and then divide it by 10^9 one limb at a time.
+    std::array<std::uint64_t, 2> const xs = {absl::Uint128Low64(x),
+                                             absl::Uint128High64(x)};
+    std::array<std::uint64_t, 2> const ys = {absl::Uint128Low64(y),
+                                             absl::Uint128High64(y)};
+    std::array<std::uint64_t, 4> p = {0, 0, 0, 0};
+    for (std::size_t i = 0; i != xs.size(); ++i) {
+      std::uint64_t carry = 0;
+      for (std::size_t j = 0; j != ys.size(); ++j) {
+        auto const t = absl::uint128(xs[i]) * ys[j] + p[i + j] + carry;
+        p[i + j] = absl::Uint128Low64(t);
+        carry = absl::Uint128High64(t);
+      }
+      p[i + ys.size()] = carry;
+    }
+    absl::uint128 remainder = 0;
+    for (auto k = p.size(); k != 0; --k) {
+      auto const t = (remainder << 64) + p[k - 1];
+      p[k - 1] = absl::Uint128Low64(t / kUnitsPerOne);
+      remainder = t % kUnitsPerOne;
+    }
+    if (p[3] != 0 || p[2] != 0) {
+      return internal::OutOfRangeError("NUMERIC overflow in Multiply()",
+                                       GCP_ERROR_INFO());
+    }
+    q = absl::MakeUint128(p[1], p[0]);
+    r = absl::Uint128Low64(remainder);
+  }
+  if (r >= kUnitsPerOne - r) ++q;
+  if (q > max) {
+    return internal::OutOfRangeError("NUMERIC overflow in Multiply()",
+                                     GCP_ERROR_INFO());
+  }
+  return Negate(q, negative);
+}
+
+double FixedDecimalToDouble(absl::int128 units) {
+  if (units == kFixedDecimalNaN) {
+    return std::numeric_limits<double>::quiet_NaN();
+  }
+  // Both operands are exact, so the quotient is correctly rounded.
+  auto constexpr kMaxExact = absl::int128(1) << 53;
+  if (units > -kMaxExact && units < kMaxExact) {
+    return static_cast<double>(units) / static_cast<double>(kUnitsPerOne);
+  }
+  return std::strtod(FormatFixedDecimal(units).c_str(), nullptr);
+}
+
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
+}  // namespace spanner_internal
+}  // namespace cloud
+}  // namespace google
@@ -0,0 +1,339 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GOOGLE_CLOUD_CPP_GOOGLE_CLOUD_SPANNER_FIXED_NUMERIC_H
+#define GOOGLE_CLOUD_CPP_GOOGLE_CLOUD_SPANNER_FIXED_NUMERIC_H
+
+#include "google/cloud/spanner/numeric.h"
+#include "google/cloud/spanner/version.h"
+#include "google/cloud/internal/make_status.h"
+#include "google/cloud/status_or.h"
+#include "absl/numeric/int128.h"
+#include "absl/strings/string_view.h"
+#include <limits>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace google {
+namespace cloud {
+namespace spanner_internal {
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_BEGIN
+struct FixedDecimalInternals;
+
+/// The number of fractional decimal digits in a `FixedDecimal`.
+constexpr int kFixedDecimalScale = 9;
+
+/// The largest magnitude of a NUMERIC value, (10^38 - 1) * 10^-9.
+constexpr absl::int128 kFixedDecimalMaxUnits =
+    absl::MakeInt128(0x4b3b4ca85a86c47a, 0x098a223fffffffff);
+
+/// Represents NaN, which PostgreSQL sorts after all the other values.
+constexpr absl::int128 kFixedDecimalNaN = absl::Int128Max();
+
+StatusOr<absl::int128> ParseFixedDecimal(absl::string_view s, bool has_nan);
+std::string FormatFixedDecimal(absl::int128 units);
+StatusOr<absl::int128> ScaleToFixedDecimal(absl::int128 i, int exponent);
+StatusOr<absl::int128> ScaleFromFixedDecimal(absl::int128 units,
+                                             int exponent);
+StatusOr<absl::int128> MultiplyFixedDecimal(absl::int128 a, absl::int128 b);
+double FixedDecimalToDouble(absl::int128 units);
+
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
+}  // namespace spanner_internal
+
+namespace spanner {
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_BEGIN
+
+/**
+ * A binary, fixed-point representation of the Spanner NUMERIC type.
+ *
+ * `Decimal` stores a canonical decimal string, which is exactly what the
+ * service sends and receives, but makes arithmetic, comparisons, and numeric
+ * conversions expensive. A `FixedDecimal` stores the value as a 128-bit
+ * integer count of 10^-9 units instead. This supports the full range and
+ * precision of the GoogleSQL NUMERIC type, with cheap parsing, formatting,
+ * comparisons, and exact arithmetic.
+ *
+ * `FixedDecimal` values use the same wire format as `Decimal` values, and can
+ * be used in a `Value` wherever the corresponding `Decimal` is expected.
+ *
+ * The `kPostgreSQL` mode (`FixedPgNumeric`) reads and writes PG_NUMERIC
+ * columns. It supports NaN, which (as in PostgreSQL) compares equal to itself
+ * and greater than any other value. It cannot represent PG_NUMERIC values with
+ * more than 29 integer digits, converting them returns an error. PG_NUMERIC
+ * values with more than 9 fractional digits are rounded, with halfway cases
+ * rounding away from zero.
+ *
+ * @par Example
+ *
+ * @code
+ * auto a = spanner::MakeFixedNumeric("1.25").value();
+ * auto b = spanner::MakeFixedNumeric(3).value();
+ * auto c = spanner::Multiply(a, b).value();
+ * assert(c.ToString() == "3.75");
+ * assert(spanner::ToInt128(c, 2).value() == 375);
+ * @endcode
+ */
+template <DecimalMode Mode>
+class FixedDecimal {
+ public:
+  /// The number of fractional decimal digits.
+  static constexpr int kScale = spanner_internal::kFixedDecimalScale;
+
+  /// A zero value.
+  FixedDecimal() = default;
+
+  /// The canonical decimal representation, as in `Decimal::ToString()`.
+  std::string ToString() const {
+    return spanner_internal::FormatFixedDecimal(units_);
+  }
+
+  /// @name Relational operators
+  ///@{
+  friend bool operator==(FixedDecimal const& a, FixedDecimal const& b) {
+    return a.units_ == b.units_;
+  }
+  friend bool operator!=(FixedDecimal const& a, FixedDecimal const& b) {
+    return !(a == b);
+  }
+  friend bool operator<(FixedDecimal const& a, FixedDecimal const& b) {
+    return a.units_ < b.units_;
+  }
+  friend bool operator<=(FixedDecimal const& a, FixedDecimal const& b) {
+    return !(b < a);
+  }
+  friend bool operator>(FixedDecimal const& a, FixedDecimal const& b) {
+    return b < a;
+  }
+  friend bool operator>=(FixedDecimal const& a, FixedDecimal const& b) {
+    return !(a < b);
+  }
+  ///@}
+
+  /// Outputs string representation of the `FixedDecimal` to the stream.
+  friend std::ostream& operator<<(std::ostream& os, FixedDecimal const& d) {
+    return os << d.ToString();
+  }
+
+ private:
+  friend struct spanner_internal::FixedDecimalInternals;
+
+  explicit FixedDecimal(absl::int128 units) : units_(units) {}
+
+  absl::int128 units_ = 0;  // the value * 10^kScale, or kFixedDecimalNaN
+};
+
+template <DecimalMode Mode>
+constexpr int FixedDecimal<Mode>::kScale;
+
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
+}  // namespace spanner
+
+namespace spanner_internal {
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_BEGIN
+
+struct FixedDecimalInternals {
+  template <spanner::DecimalMode Mode>
+  static spanner::FixedDecimal<Mode> Create(absl::int128 units) {
+    return spanner::FixedDecimal<Mode>(units);
+  }
+
+  template <spanner::DecimalMode Mode>
+  static StatusOr<spanner::FixedDecimal<Mode>> Create(
+      StatusOr<absl::int128> units) {
+    if (!units) return std::move(units).status();
+    return spanner::FixedDecimal<Mode>(*units);
+  }
+
+  template <spanner::DecimalMode Mode>
+  static absl::int128 Units(spanner::FixedDecimal<Mode> const& d) {
+    return d.units_;
+  }
+};
+
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
+}  // namespace spanner_internal
+
+namespace spanner {
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_BEGIN
+
+/**
+ * Construction from a string, using the same formats as `MakeDecimal()`.
+ *
+ * This is the fast path to parse the values received from the service. Fails
+ * on syntax errors, if the value is outside the NUMERIC range, or if the value
+ * is NaN and the mode does not support NaN.
+ */
+template <DecimalMode Mode>
+StatusOr<FixedDecimal<Mode>> MakeFixedDecimal(absl::string_view s) {
+  return spanner_internal::FixedDecimalInternals::Create<Mode>(
+      spanner_internal::ParseFixedDecimal(s, Decimal<Mode>::kHasNaN));
+}
+
+/// Conversion from a `Decimal` of the same mode.
+template <DecimalMode Mode>
+StatusOr<FixedDecimal<Mode>> MakeFixedDecimal(Decimal<Mode> const& d) {
+  return MakeFixedDecimal<Mode>(d.ToString());
+}
+
+/**
+ * Construction from an integer `i`, scaled by 10^`exponent`.
+ *
+ * Rounds to 9 fractional digits, with halfway cases rounding away from zero.
+ * Fails on any (scaled) argument outside the NUMERIC value range. Any integer
+ * type that fits in an `absl::int128` is accepted.
+ */
+template <typename T, DecimalMode Mode,
+          /// @cond implementation_details
+          std::enable_if_t<std::numeric_limits<T>::is_integer &&
+                               std::numeric_limits<T>::digits <= 127,
+                           int> = 0
+          /// @endcond
+          >
+StatusOr<FixedDecimal<Mode>> MakeFixedDecimal(T i, int exponent = 0) {
+  return spanner_internal::FixedDecimalInternals::Create<Mode>(
+      spanner_internal::ScaleToFixedDecimal(static_cast<absl::int128>(i),
+                                            exponent));
+}
+
+/// Conversion to a `Decimal` of the same mode. Always succeeds.
+template <DecimalMode Mode>
+Decimal<Mode> ToDecimal(FixedDecimal<Mode> const& d) {
+  return *spanner_internal::MakeDecimal<Mode>(d.ToString());
+}
+
+/**
+ * Conversion to the nearest `absl::int128` value, scaled by 10^`exponent`.
+ *
+ * Rounds halfway cases away from zero. Fails for NaN, or if the scaled value
+ * does not fit in an `absl::int128`. With an `exponent` of 9 this returns the
+ * exact internal representation.
+ */
+template <DecimalMode Mode>
+StatusOr<absl::int128> ToInt128(FixedDecimal<Mode> const& d,
+                                int exponent = 0) {
+  return spanner_internal::ScaleFromFixedDecimal(
+      spanner_internal::FixedDecimalInternals::Units(d), exponent);
+}
+
+/// Conversion to the closest double value, with possible loss of precision.
+template <DecimalMode Mode>
+double ToDouble(FixedDecimal<Mode> const& d) {
+  return spanner_internal::FixedDecimalToDouble(
+      spanner_internal::FixedDecimalInternals::Units(d));
+}
+
+/**
+ * @name Arithmetic
+ *
+ * The sum, difference, and product of two values. Sums and differences are
+ * exact. Products are rounded to 9 fractional digits, with halfway cases
+ * rounding away from zero. Fails if the result is outside the NUMERIC range.
+ * Any operation involving NaN returns NaN.
+ */
+///@{
+template <DecimalMode Mode>
+StatusOr<FixedDecimal<Mode>> Add(FixedDecimal<Mode> const& a,
+                                 FixedDecimal<Mode> const& b) {
+  using spanner_internal::FixedDecimalInternals;
+  auto const x = FixedDecimalInternals::Units(a);
+  auto const y = FixedDecimalInternals::Units(b);
+  if (x == spanner_internal::kFixedDecimalNaN ||
+      y == spanner_internal::kFixedDecimalNaN) {
+    return FixedDecimalInternals::Create<Mode>(
+        spanner_internal::kFixedDecimalNaN);
+  }
+  // Both operands are in range, so none of these expressions can overflow.
+  if ((y > 0 && x > spanner_internal::kFixedDecimalMaxUnits - y) ||
+      (y < 0 && x < -spanner_internal::kFixedDecimalMaxUnits - y)) {
+    return internal::OutOfRangeError("NUMERIC overflow in Add()",
+                                     GCP_ERROR_INFO());
+  }
+  return FixedDecimalInternals::Create<Mode>(x + y);
+}
+
+template <DecimalMode Mode>
+StatusOr<FixedDecimal<Mode>> Subtract(FixedDecimal<Mode> const& a,
+                                      FixedDecimal<Mode> const& b) {
+  using spanner_internal::FixedDecimalInternals;
+  auto const y = FixedDecimalInternals::Units(b);
+  if (y == spanner_internal::kFixedDecimalNaN) return b;
+  return Add(a, FixedDecimalInternals::Create<Mode>(-y));
+}
+
+template <DecimalMode Mode>
+StatusOr<FixedDecimal<Mode>> Multiply(FixedDecimal<Mode> const& a,
+                                      FixedDecimal<Mode> const& b) {
+  using spanner_internal::FixedDecimalInternals;
+  return FixedDecimalInternals::Create<Mode>(
+      spanner_internal::MultiplyFixedDecimal(FixedDecimalInternals::Units(a),
+                                             FixedDecimalInternals::Units(b)));
+}
+///@}
+
+/**
+ * Most users only need the `FixedNumeric` or `FixedPgNumeric`
+ * specializations of `FixedDecimal`.
+ */
+using FixedNumeric = FixedDecimal<DecimalMode::kGoogleSQL>;
+using FixedPgNumeric = FixedDecimal<DecimalMode::kPostgreSQL>;
+
+/// `MakeFixedNumeric()` factory functions for `FixedNumeric`.
+///@{
+inline StatusOr<FixedNumeric> MakeFixedNumeric(absl::string_view s) {
+  return MakeFixedDecimal<DecimalMode::kGoogleSQL>(s);
+}
+inline StatusOr<FixedNumeric> MakeFixedNumeric(Numeric const& n) {
+  return MakeFixedDecimal<DecimalMode::kGoogleSQL>(n);
+}
+template <typename T,
+          /// @cond implementation_details
+          std::enable_if_t<std::numeric_limits<T>::is_integer &&
+                               std::numeric_limits<T>::digits <= 127,
+                           int> = 0
+          /// @endcond
+          >
+StatusOr<FixedNumeric> MakeFixedNumeric(T i, int exponent = 0) {
+  return MakeFixedDecimal<T, DecimalMode::kGoogleSQL>(i, exponent);
+}
+///@}
+
+/// `MakeFixedPgNumeric()` factory functions for `FixedPgNumeric`.
+///@{
+inline StatusOr<FixedPgNumeric> MakeFixedPgNumeric(absl::string_view s) {
+  return MakeFixedDecimal<DecimalMode::kPostgreSQL>(s);
+}
+inline StatusOr<FixedPgNumeric> MakeFixedPgNumeric(PgNumeric const& n) {
+  return MakeFixedDecimal<DecimalMode::kPostgreSQL>(n);
+}
+template <typename T,
+          /// @cond implementation_details
+          std::enable_if_t<std::numeric_limits<T>::is_integer &&
+                               std::numeric_limits<T>::digits <= 127,
+                           int> = 0
+          /// @endcond
+          >
+StatusOr<FixedPgNumeric> MakeFixedPgNumeric(T i, int exponent = 0) {
+  return MakeFixedDecimal<T, DecimalMode::kPostgreSQL>(i, exponent);
+}
+///@}
+
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
+}  // namespace spanner
+}  // namespace cloud
+}  // namespace google
+
+#endif  // GOOGLE_CLOUD_CPP_GOOGLE_CLOUD_SPANNER_FIXED_NUMERIC_H
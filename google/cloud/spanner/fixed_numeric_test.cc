@@ -0,0 +1,264 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/spanner/fixed_numeric.h"
+#include "google/cloud/testing_util/status_matchers.h"
+#include "absl/numeric/int128.h"
+#include <gmock/gmock.h>
+#include <cmath>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace google {
+namespace cloud {
+namespace spanner {
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_BEGIN
+namespace {
+
+using ::google::cloud::testing_util::StatusIs;
+using ::testing::HasSubstr;
+
+auto constexpr kMaxValue = "99999999999999999999999999999.999999999";
+auto constexpr kMinValue = "-99999999999999999999999999999.999999999";
+
+TEST(FixedNumeric, DefaultCtor) {
+  FixedNumeric n;
+  EXPECT_EQ("0", n.ToString());
+  EXPECT_EQ(0, ToInt128(n).value());
+  EXPECT_EQ(0.0, ToDouble(n));
+  EXPECT_EQ(n, MakeFixedNumeric(0).value());
+}
+
+TEST(FixedNumeric, RelationalOperators) {
+  auto const a = MakeFixedNumeric("-1.5").value();
+  auto const b = MakeFixedNumeric("0.25").value();
+  auto const c = MakeFixedNumeric("2.5e-1").value();
+  EXPECT_EQ(b, c);
+  EXPECT_NE(a, b);
+  EXPECT_LT(a, b);
+  EXPECT_LE(b, c);
+  EXPECT_GT(b, a);
+  EXPECT_GE(c, b);
+  EXPECT_LT(MakeFixedNumeric(kMinValue).value(),
+            MakeFixedNumeric(kMaxValue).value());
+}
+
+TEST(FixedNumeric, OutputStreaming) {
+  std::ostringstream ss;
+  ss << MakeFixedNumeric("-12.3400").value();
+  EXPECT_EQ("-12.34", ss.str());
+}
+
+TEST(FixedNumeric, MakeFixedNumericString) {
+  EXPECT_EQ("0", MakeFixedNumeric("-00.00e100").value().ToString());
+  EXPECT_EQ("1", MakeFixedNumeric("+01").value().ToString());
+  EXPECT_EQ("12", MakeFixedNumeric("12.").value().ToString());
+  EXPECT_EQ("-12.34", MakeFixedNumeric("-12.34").value().ToString());
+  EXPECT_EQ("0.000000001", MakeFixedNumeric("1e-9").value().ToString());
+  EXPECT_EQ("1.2", MakeFixedNumeric(".12E1").value().ToString());
+  EXPECT_EQ("123400", MakeFixedNumeric("1.234e+05").value().ToString());
+  EXPECT_EQ("12345678901234567890",
+            MakeFixedNumeric("12345678901234567890").value().ToString());
+  EXPECT_EQ(kMaxValue, MakeFixedNumeric(kMaxValue).value().ToString());
+  EXPECT_EQ(kMinValue, MakeFixedNumeric(kMinValue).value().ToString());
+  EXPECT_EQ("10000000000000000000000000000",
+            MakeFixedNumeric("1e28").value().ToString());
+}
+
+TEST(FixedNumeric, MatchesNumeric) {
+  std::vector<std::string> const inputs = {
+      "0",
+      "-0.0",
+      "1",
+      "-1",
+      "0.1",
+      "123.456",
+      "-0.000000001",
+      "0.0000000005",
+      "-0.0000000005",
+      "0.00000000049",
+      "1e10",
+      "9.99999999e-1",
+      "18446744073709551615",
+      "18446744073709551616.5",
+      "-9223372036854775808.000000001",
+      "12345678901234567890.123456789",
+      "1234567890123456789012345678.9",
+      "89999999999999999999999999999.9999999999",
+      "-99999999999999999999999999999.9999999989",
+      kMaxValue,
+      kMinValue,
+  };
+  for (auto const& s : inputs) {
+    SCOPED_TRACE("Testing with " + s);
+    auto const n = MakeNumeric(s).value();
+    auto const f = MakeFixedNumeric(s).value();
+    EXPECT_EQ(n.ToString(), f.ToString());
+    EXPECT_EQ(n, ToDecimal(f));
+    EXPECT_EQ(f, MakeFixedNumeric(n).value());
+    EXPECT_EQ(ToDouble(n), ToDouble(f));
+  }
+}
+
+TEST(FixedNumeric, MakeFixedNumericStringRounding) {
+  EXPECT_EQ("0.899989999", MakeFixedNumeric("0.8999899994").value().ToString());
+  EXPECT_EQ("0.89999", MakeFixedNumeric("0.8999899995").value().ToString());
+  EXPECT_EQ("1", MakeFixedNumeric(".9999999995").value().ToString());
+  EXPECT_EQ("-100", MakeFixedNumeric("-99.9999999995").value().ToString());
+  EXPECT_EQ("0", MakeFixedNumeric("4e-10").value().ToString());
+  EXPECT_EQ("0.000000001", MakeFixedNumeric("5e-10").value().ToString());
+  EXPECT_EQ("0", MakeFixedNumeric("9e-1000").value().ToString());
+}
+
+TEST(FixedNumeric, MakeFixedNumericStringFail) {
+  for (auto const* s : {"", "+", "-", ".", "X", "1.2.3", "12345.6789X",
+                        "1.2e3X", "1e", "1e+", "e1", "NaN", "nan"}) {
+    SCOPED_TRACE(std::string("Testing with ") + s);
+    EXPECT_THAT(MakeFixedNumeric(s), StatusIs(StatusCode::kInvalidArgument));
+  }
+  for (auto const* s : {"-1e29", "1e29", "1e9223372036854775808",
+                        "99999999999999999999999999999.9999999995",
+                        "-99999999999999999999999999999.9999999995"}) {
+    SCOPED_TRACE(std::string("Testing with ") + s);
+    EXPECT_THAT(MakeFixedNumeric(s),
+                StatusIs(StatusCode::kOutOfRange, HasSubstr(s)));
+  }
+}
+
+TEST(FixedNumeric, MakeFixedNumericInteger) {
+  EXPECT_EQ("42", MakeFixedNumeric(42).value().ToString());
+  EXPECT_EQ("-42", MakeFixedNumeric(-42).value().ToString());
+  EXPECT_EQ("1.25", MakeFixedNumeric(125, -2).value().ToString());
+  EXPECT_EQ("0.000000002", MakeFixedNumeric(15, -10).value().ToString());
+  EXPECT_EQ("-0.000000002", MakeFixedNumeric(-15, -10).value().ToString());
+  EXPECT_EQ("0", MakeFixedNumeric(absl::Int128Max(), -100).value().ToString());
+  EXPECT_EQ("12000", MakeFixedNumeric(12, 3).value().ToString());
+  EXPECT_EQ("170141183460469231731.687303716",
+            MakeFixedNumeric(absl::Int128Max(), -18).value().ToString());
+
+  EXPECT_THAT(MakeFixedNumeric(absl::Int128Max()),
+              StatusIs(StatusCode::kOutOfRange));
+  EXPECT_THAT(MakeFixedNumeric(absl::Int128Min()),
+              StatusIs(StatusCode::kOutOfRange));
+  EXPECT_THAT(MakeFixedNumeric(1, 29), StatusIs(StatusCode::kOutOfRange));
+  EXPECT_THAT(MakeFixedNumeric(1, 2000000000),
+              StatusIs(StatusCode::kOutOfRange));
+}
+
+TEST(FixedNumeric, ToInt128) {
+  auto const n = MakeFixedNumeric("-1234.5678").value();
+  EXPECT_EQ(-1235, ToInt128(n).value());
+  EXPECT_EQ(-123457, ToInt128(n, 2).value());
+  EXPECT_EQ(-1234567800000, ToInt128(n, 9).value());
+  EXPECT_EQ(0, ToInt128(n, -4).value());
+  EXPECT_EQ(-1, ToInt128(n, -3).value());
+  EXPECT_EQ(2, ToInt128(MakeFixedNumeric("1.5").value()).value());
+  EXPECT_EQ(1, ToInt128(MakeFixedNumeric("1.4999").value()).value());
+
+  auto const max = MakeFixedNumeric(kMaxValue).value();
+  EXPECT_EQ(absl::MakeInt128(0x4b3b4ca85a86c47a, 0x098a223fffffffff),
+            ToInt128(max, 9).value());
+  EXPECT_THAT(ToInt128(max, 10),
+              StatusIs(StatusCode::kDataLoss, HasSubstr(kMaxValue)));
+}
+
+TEST(FixedNumeric, Add) {
+  auto const a = MakeFixedNumeric("1.000000001").value();
+  auto const b = MakeFixedNumeric("-3.5").value();
+  EXPECT_EQ("-2.499999999", Add(a, b).value().ToString());
+  EXPECT_EQ("4.500000001", Subtract(a, b).value().ToString());
+  EXPECT_EQ("0", Subtract(a, a).value().ToString());
+
+  auto const max = MakeFixedNumeric(kMaxValue).value();
+  auto const min = MakeFixedNumeric(kMinValue).value();
+  auto const tiny = MakeFixedNumeric("1e-9").value();
+  EXPECT_EQ("0", Add(max, min).value().ToString());
+  EXPECT_THAT(Add(max, tiny), StatusIs(StatusCode::kOutOfRange));
+  EXPECT_THAT(Subtract(min, tiny), StatusIs(StatusCode::kOutOfRange));
+  EXPECT_THAT(Subtract(max, min), StatusIs(StatusCode::kOutOfRange));
+  EXPECT_EQ("99999999999999999999999999999.999999998",
+            Subtract(max, tiny).value().ToString());
+}
+
+TEST(FixedNumeric, Multiply) {
+  auto mul = [](char const* a, char const* b) {
+    return Multiply(MakeFixedNumeric(a).value(), MakeFixedNumeric(b).value());
+  };
+  EXPECT_EQ("3.75", mul("1.25", "3").value().ToString());
+  EXPECT_EQ("-3.75", mul("-1.25", "3").value().ToString());
+  EXPECT_EQ("3.75", mul("-1.25", "-3").value().ToString());
+  EXPECT_EQ("0", mul("0", kMaxValue).value().ToString());
+  EXPECT_EQ(kMaxValue, mul(kMaxValue, "1").value().ToString());
+  EXPECT_EQ(kMinValue, mul(kMaxValue, "-1").value().ToString());
+
+  // Products are rounded, with halfway cases rounding away from zero.
+  EXPECT_EQ("0.000000001", mul("0.00001", "0.00005").value().ToString());
+  EXPECT_EQ("-0.000000001", mul("-0.00001", "0.00005").value().ToString());
+  EXPECT_EQ("0", mul("0.00001", "0.000049").value().ToString());
+
+  // Operands larger than 64 bits use the 256-bit product.
+  EXPECT_EQ("99999999999999999999999999999.8",
+            mul("49999999999999999999999999999.9", "2").value().ToString());
+  EXPECT_EQ("10000000000000000000000000000",
+            mul("100000000000000", "100000000000000").value().ToString());
+  EXPECT_EQ("15241578753238836750495211342.784374346",
+            mul("123456789012345.678901234", "123456789012345.678901234")
+                .value()
+                .ToString());
+  EXPECT_EQ("12345678901.23456789",
+            mul("12345678901234567890.123456789", "0.000000001")
+                .value()
+                .ToString());
+
+  EXPECT_THAT(mul(kMaxValue, "1.000000001"),
+              StatusIs(StatusCode::kOutOfRange));
+  EXPECT_THAT(mul("1e15", "1e15"), StatusIs(StatusCode::kOutOfRange));
+  EXPECT_THAT(mul(kMaxValue, kMinValue), StatusIs(StatusCode::kOutOfRange));
+}
+
+TEST(FixedNumeric, PostgreSQL) {
+  auto const nan = MakeFixedPgNumeric("NaN").value();
+  EXPECT_EQ("NaN", nan.ToString());
+  EXPECT_EQ(nan, MakeFixedPgNumeric("nan").value());
+  EXPECT_EQ(nan, MakeFixedPgNumeric(MakePgNumeric("NaN").value()).value());
+  EXPECT_EQ("NaN", ToDecimal(nan).ToString());
+  EXPECT_TRUE(std::isnan(ToDouble(nan)));
+  EXPECT_THAT(ToInt128(nan), StatusIs(StatusCode::kDataLoss));
+
+  // NaN sorts after all the other values.
+  auto const max = MakeFixedPgNumeric(kMaxValue).value();
+  EXPECT_LT(max, nan);
+  EXPECT_GT(nan, max);
+
+  // Any arithmetic involving NaN results in NaN.
+  auto const one = MakeFixedPgNumeric(1).value();
+  EXPECT_EQ(nan, Add(one, nan).value());
+  EXPECT_EQ(nan, Subtract(nan, one).value());
+  EXPECT_EQ(nan, Subtract(one, nan).value());
+  EXPECT_EQ(nan, Multiply(nan, one).value());
+
+  // PG_NUMERIC values outside the fixed-point range are rejected.
+  auto const wide = MakePgNumeric("1e29").value();
+  EXPECT_THAT(MakeFixedPgNumeric(wide), StatusIs(StatusCode::kOutOfRange));
+  EXPECT_EQ("0.5", MakeFixedPgNumeric("0.5000000000000001")
+                       .value()
+                       .ToString());
+}
+
+}  // namespace
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
+}  // namespace spanner
+}  // namespace cloud
+}  // namespace google
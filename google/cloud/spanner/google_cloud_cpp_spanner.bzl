@@ -63,6 +63,7 @@ google_cloud_cpp_spanner_hdrs = [
     "date.h",
     "directed_read_replicas.h",
     "encryption_config.h",
+    "fixed_numeric.h",
     "iam_updater.h",
     "instance.h",
     "instance_admin_client.h",
@@ -103,6 +104,7 @@ google_cloud_cpp_spanner_hdrs = [
     "options.h",
     "order_by.h",
     "partition_options.h",
+    "partition_runner.h",
     "partitioned_dml_result.h",
     "polling_policy.h",
     "proto_enum.h",
@@ -115,6 +117,7 @@ google_cloud_cpp_spanner_hdrs = [
     "results.h",
     "retry_policy.h",
     "row.h",
+    "row_binding.h",
     "session_pool_options.h",
     "sql_statement.h",
     "timestamp.h",
@@ -161,6 +164,7 @@ google_cloud_cpp_spanner_srcs = [
     "database.cc",
     "database_admin_client.cc",
     "database_admin_connection.cc",
+    "fixed_numeric.cc",
     "instance.cc",
     "instance_admin_client.cc",
     "instance_admin_connection.cc",
@@ -192,12 +196,14 @@ google_cloud_cpp_spanner_srcs = [
     "mutations.cc",
     "numeric.cc",
     "partition_options.cc",
+    "partition_runner.cc",
     "query_options.cc",
     "query_partition.cc",
     "read_options.cc",
     "read_partition.cc",
     "results.cc",
     "row.cc",
+    "row_binding.cc",
     "sql_statement.cc",
     "timestamp.cc",
     "transaction.cc",
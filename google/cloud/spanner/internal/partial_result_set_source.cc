@@ -110,23 +110,50 @@ PartialResultSetSource::~PartialResultSetSource() {
 }
 
 StatusOr<spanner::Row> PartialResultSetSource::NextRow() {
-  while (rows_.empty()) {
-    if (state_ == kFinished) return spanner::Row();
+  auto has_next = HasNextRow();
+  if (!has_next) return std::move(has_next).status();
+  if (!*has_next) return spanner::Row();
+  std::vector<spanner::Value> values;
+  values.reserve(columns_->size());
+  for (auto const& field : metadata_->row_type().fields()) {
+    auto& value = *values_.Mutable(next_value_++);
+    values.push_back(FromProto(field.type(), std::move(value)));
+  }
+  return RowFriend::MakeRow(std::move(values), columns_);
+}
+
+StatusOr<bool> PartialResultSetSource::NextRowValues(
+    std::vector<google::protobuf::Value>& values) {
+  auto has_next = HasNextRow();
+  if (!has_next || !*has_next) return has_next;
+  values.resize(columns_->size());
+  for (auto& value : values) {
+    value = std::move(*values_.Mutable(next_value_++));
+  }
+  return true;
+}
+
+StatusOr<bool> PartialResultSetSource::HasNextRow() {
+  while (next_value_ == ready_values_) {
+    if (state_ == kFinished) return false;
     internal::OptionsSpan span(options_);
     auto status = ReadFromStream();
     if (!status.ok()) return status;
   }
-  auto row = std::move(rows_.front());
-  rows_.pop_front();
-  return row;
+  return true;
 }
 
 Status PartialResultSetSource::ReadFromStream() {
   absl::optional<PartialResultSet> result_set;
-  if (state_ == kFinished || !rows_.empty()) {
+  if (state_ == kFinished || next_value_ != ready_values_) {
     return internal::InternalError("PartialResultSetSource state error",
                                    GCP_ERROR_INFO());
   }
+  if (ready_values_ != 0) {
+    // Discard the (moved-from) values of the rows we have already returned.
+    values_.DeleteSubrange(0, ready_values_);
+    ready_values_ = next_value_ = 0;
+  }
   if (state_ == kReading) {
     result_set = reader_->Read(resume_token_);
     if (!result_set) state_ = kEndOfStream;
@@ -202,7 +229,7 @@ Status PartialResultSetSource::ReadFromStream() {
   // Deliver whatever rows we can muster.
   auto const n_values = values_.size() - (values_back_incomplete_ ? 1 : 0);
   auto const n_columns = columns_ ? static_cast<int>(columns_->size()) : 0;
-  auto n_rows = n_columns ? n_values / n_columns : 0;
+  auto const n_rows = n_columns ? n_values / n_columns : 0;
   if (n_columns == 0 && !values_.empty()) {
     return internal::InternalError(
         "PartialResultSetSource metadata is missing row type",
@@ -240,23 +267,9 @@ Status PartialResultSetSource::ReadFromStream() {
     resume_token_ = absl::nullopt;
   }
 
-  // Combine the available values into new elements of `rows_`.
-  int values_pos = 0;
-  std::vector<spanner::Value> values;
-  values.reserve(n_columns);
-  for (; n_rows != 0; --n_rows) {
-    for (auto const& field : metadata_->row_type().fields()) {
-      auto& value = *values_.Mutable(values_pos++);
-      values.push_back(FromProto(field.type(), std::move(value)));
-    }
-    rows_.push_back(RowFriend::MakeRow(std::move(values), columns_));
-    values.clear();
-  }
-
-  // If we didn't combine all the values, leave the remainder for next time.
-  auto* rem_values = result_set->result.mutable_values();
-  ExtractSubrangeAndAppend(values_, values_pos, *rem_values);
-  values_.Swap(rem_values);
+  // Make the complete rows available to `NextRow()`. Any remaining values
+  // are left for next time.
+  ready_values_ = n_rows * n_columns;
 
   return {};  // OK
 }
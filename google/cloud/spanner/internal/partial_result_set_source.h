@@ -27,7 +27,6 @@
 #include <google/protobuf/struct.pb.h>
 #include <google/spanner/v1/spanner.pb.h>
 #include <cstddef>
-#include <deque>
 #include <memory>
 #include <string>
 #include <vector>
@@ -52,6 +51,9 @@ class PartialResultSetSource : public spanner::ResultSourceInterface {
 
   StatusOr<spanner::Row> NextRow() override;
 
+  StatusOr<bool> NextRowValues(
+      std::vector<google::protobuf::Value>& values) override;
+
   absl::optional<google::spanner::v1::ResultSetMetadata> Metadata() override {
     return metadata_;
   }
@@ -64,6 +66,9 @@ class PartialResultSetSource : public spanner::ResultSourceInterface {
   explicit PartialResultSetSource(
       std::unique_ptr<PartialResultSetReader> reader);
 
+  // Reads from the stream until a complete row is ready to be returned,
+  // yielding `false` if the stream finishes first.
+  StatusOr<bool> HasNextRow();
   Status ReadFromStream();
 
   Options options_;
@@ -78,22 +83,26 @@ class PartialResultSetSource : public spanner::ResultSourceInterface {
   // to the `QueryMode` implied by the particular streaming read/query type.
   absl::optional<google::spanner::v1::ResultSetStats> stats_;
 
-  // `Row`s ready to be returned by `NextRow()`.
-  std::deque<spanner::Row> rows_;
+  // The first `ready_values_` elements of `values_` form complete rows that
+  // are ready to be returned by `NextRow()`, and `next_value_` is the index
+  // of the first column of the next such row. Rows are only built from the
+  // values on demand, so that `NextRowValues()` can avoid building them.
+  int ready_values_ = 0;
+  int next_value_ = 0;
 
   // When engaged, the token we can use to resume the stream immediately after
-  // any data in (or previously in) `rows_`. When disengaged, we have already
+  // any ready data (or data previously ready). When disengaged, we have already
   // delivered data that would be replayed, so resumption is disabled until we
   // see a new token.
   absl::optional<std::string> resume_token_ = "";
 
-  // `Value`s that could be combined into `rows_` when we have enough to fill
-  // an entire row, plus a token that would resume the stream after such rows.
+  // `Value`s that could be combined into rows when we have enough to fill an
+  // entire row, preceded by any ready rows that have yet to be returned.
   google::protobuf::RepeatedPtrField<google::protobuf::Value> values_;
 
   // Should the space used by `values_` get larger than this limit, we will
-  // move complete rows into `rows_` and disable resumption until we see a
-  // new token. During this time, an error in the stream will be returned by
+  // make complete rows ready and disable resumption until we see a new
+  // token. During this time, an error in the stream will be returned by
   // `NextRow()`. No individual row in a result set can exceed 100 MiB, so we
   // set the default limit to twice that.
   std::size_t values_space_limit_ = 2 * 100 * (std::size_t{1} << 20);
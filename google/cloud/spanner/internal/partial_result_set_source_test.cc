@@ -27,6 +27,7 @@
 #include <array>
 #include <cstdint>
 #include <string>
+#include <vector>
 
 namespace google {
 namespace cloud {
@@ -416,6 +417,97 @@ TEST(PartialResultSetSourceTest, MultipleResponses) {
   }
 }
 
+/**
+ * @test Verify that `NextRowValues()` and `NextRow()` can be mixed, and that
+ * the former yields the raw values of each row.
+ */
+TEST(PartialResultSetSourceTest, NextRowValues) {
+  std::array<char const*, 3> text{{
+      R"pb(
+        metadata: {
+          row_type: {
+            fields: {
+              name: "UserId",
+              type: { code: INT64 }
+            }
+            fields: {
+              name: "UserName",
+              type: { code: STRING }
+            }
+          }
+        }
+        values: { string_value: "10" }
+        values: { string_value: "user10" }
+        values: { string_value: "22" }
+      )pb",
+      R"pb(
+        values: { string_value: "user22" }
+        values: { string_value: "99" }
+        values: { string_value: "user99" }
+      )pb",
+      R"pb(
+        values: { string_value: "100" }
+        values: { null_value: NULL_VALUE }
+      )pb",
+  }};
+  std::array<google::spanner::v1::PartialResultSet, text.size()> response;
+  for (std::size_t i = 0; i != text.size(); ++i) {
+    SCOPED_TRACE("Converting text to proto [" + std::to_string(i) + "]");
+    ASSERT_TRUE(TextFormat::ParseFromString(text[i], &response[i]));
+  }
+
+  for (std::size_t buffer_size : {0, 1 << 20}) {
+    auto grpc_reader = std::make_unique<MockPartialResultSetReader>();
+    EXPECT_CALL(*grpc_reader, Read(_))
+        .WillOnce(ResultMock(ReadResult(response[0])))
+        .WillOnce(ResultMock(ReadResult(response[1])))
+        .WillOnce(ResultMock(ReadResult(response[2])))
+        .WillOnce(ResultMock(ReadResult()));
+    EXPECT_CALL(*grpc_reader, Finish()).WillOnce(ResultMock(Status()));
+    EXPECT_CALL(*grpc_reader, TryCancel()).Times(0);
+
+    internal::OptionsSpan overlay(Options{}.set<StringOption>("uh-oh"));
+    auto reader = CreatePartialResultSetSource(
+        std::move(grpc_reader),
+        Options{}.set<spanner::StreamingResumabilityBufferSizeOption>(
+            buffer_size));
+    ASSERT_STATUS_OK(reader);
+
+    std::vector<google::protobuf::Value> values;
+    auto next = (*reader)->NextRowValues(values);
+    ASSERT_STATUS_OK(next);
+    EXPECT_TRUE(*next);
+    ASSERT_EQ(values.size(), 2);
+    EXPECT_EQ(values[0].string_value(), "10");
+    EXPECT_EQ(values[1].string_value(), "user10");
+
+    EXPECT_THAT((*reader)->NextRow(),
+                IsValidAndEquals(spanner_mocks::MakeRow({
+                    {"UserId", spanner::Value(22)},
+                    {"UserName", spanner::Value("user22")},
+                })));
+
+    next = (*reader)->NextRowValues(values);
+    ASSERT_STATUS_OK(next);
+    EXPECT_TRUE(*next);
+    ASSERT_EQ(values.size(), 2);
+    EXPECT_EQ(values[0].string_value(), "99");
+    EXPECT_EQ(values[1].string_value(), "user99");
+
+    next = (*reader)->NextRowValues(values);
+    ASSERT_STATUS_OK(next);
+    EXPECT_TRUE(*next);
+    ASSERT_EQ(values.size(), 2);
+    EXPECT_EQ(values[0].string_value(), "100");
+    EXPECT_EQ(values[1].kind_case(), google::protobuf::Value::kNullValue);
+
+    // At end of stream, we get an 'ok' response with `false`.
+    next = (*reader)->NextRowValues(values);
+    ASSERT_STATUS_OK(next);
+    EXPECT_FALSE(*next);
+  }
+}
+
 /**
  * @test Verify the behavior when a response with no values is received.
  */
@@ -12,11 +12,13 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include "google/cloud/spanner/fixed_numeric.h"
 #include "google/cloud/spanner/numeric.h"
 #include <benchmark/benchmark.h>
 #include <cstdint>
 #include <limits>
 #include <string>
+#include <vector>
 
 namespace google {
 namespace cloud {
@@ -24,25 +26,31 @@ namespace spanner {
 GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_BEGIN
 namespace {
 
-// Run on (96 X 2000.17 MHz CPU s)
+// Run on (1 X 2100 MHz CPU )
 // CPU Caches:
-//   L1 Data 32K (x48)
-//   L1 Instruction 32K (x48)
-//   L2 Unified 1024K (x48)
-//   L3 Unified 39424K (x2)
-// Load Average: 0.22, 1.93, 3.67
-// ------------------------------------------------------------------------
-// Benchmark                              Time             CPU   Iterations
-// ------------------------------------------------------------------------
-// BM_NumericFromStringCanonical       76.0 ns         76.0 ns      8999376
-// BM_NumericFromString                 369 ns          369 ns      1925749
-// BM_NumericFromDouble                2072 ns         2072 ns       340812
-// BM_NumericFromUnsigned               168 ns          168 ns      4151959
-// BM_NumericFromInteger                165 ns          165 ns      4238271
-// BM_NumericToString                 0.360 ns        0.360 ns   1000000000
-// BM_NumericToDouble                   115 ns          115 ns      6120955
-// BM_NumericToUnsigned                83.8 ns         83.8 ns      8466831
-// BM_NumericToInteger                 86.3 ns         86.3 ns      8092890
+//   L1 Data 48 KiB (x1)
+//   L1 Instruction 32 KiB (x1)
+//   L2 Unified 2048 KiB (x1)
+//   L3 Unified 307200 KiB (x1)
+// Load Average: 0.70, 1.04, 1.35
+// -----------------------------------------------------------------------------
+// Benchmark                                   Time             CPU   Iterations
+// -----------------------------------------------------------------------------
+// BM_NumericFromStringCanonical             126 ns          122 ns      6044022
+// BM_NumericFromString                      717 ns          609 ns      1187001
+// BM_NumericFromDouble                     2507 ns         2474 ns       289631
+// BM_NumericFromUnsigned                    145 ns          143 ns      5096990
+// BM_NumericFromInteger                     111 ns          109 ns      6251726
+// BM_NumericToString                       31.8 ns         30.2 ns     22683457
+// BM_NumericToDouble                        134 ns          131 ns      4785424
+// BM_NumericToUnsigned                      115 ns          113 ns      6768670
+// BM_NumericToInteger                       103 ns          101 ns      6378649
+// BM_FixedNumericFromStringCanonical        107 ns          105 ns      7612884
+// BM_FixedNumericToString                  89.2 ns         88.3 ns      8572600
+// BM_FixedNumericToDouble                  4.85 ns         4.68 ns    208195479
+// BM_FixedNumericMultiply                  54.5 ns         54.1 ns     12340074
+// BM_NumericSumColumn                    238087 ns       235057 ns         3082
+// BM_FixedNumericSumColumn                64294 ns        63518 ns        11306
 
 void BM_NumericFromStringCanonical(benchmark::State& state) {
   std::string s = "99999999999999999999999999999.999999999";
@@ -121,6 +129,73 @@ void BM_NumericToInteger(benchmark::State& state) {
 }
 BENCHMARK(BM_NumericToInteger);
 
+void BM_FixedNumericFromStringCanonical(benchmark::State& state) {
+  std::string s = "99999999999999999999999999999.999999999";
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(MakeFixedNumeric(s));
+  }
+}
+BENCHMARK(BM_FixedNumericFromStringCanonical);
+
+void BM_FixedNumericToString(benchmark::State& state) {
+  std::string s = "99999999999999999999999999999.999999999";
+  FixedNumeric n = MakeFixedNumeric(s).value();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(n.ToString());
+  }
+}
+BENCHMARK(BM_FixedNumericToString);
+
+void BM_FixedNumericToDouble(benchmark::State& state) {
+  FixedNumeric n = MakeFixedNumeric("12345.67").value();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(ToDouble(n));
+  }
+}
+BENCHMARK(BM_FixedNumericToDouble);
+
+void BM_FixedNumericMultiply(benchmark::State& state) {
+  FixedNumeric a = MakeFixedNumeric("123456789012345.678901234").value();
+  FixedNumeric b = MakeFixedNumeric("-98765432109876.543210987").value();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(Multiply(a, b));
+  }
+}
+BENCHMARK(BM_FixedNumericMultiply);
+
+// Typical prices, as received from the service in a column of 1000 rows.
+std::vector<std::string> MakeColumn() {
+  std::vector<std::string> column;
+  for (int i = 0; i != 1000; ++i) {
+    column.push_back(std::to_string(i * 7919 % 100000) + "." +
+                     std::to_string(i % 100));
+  }
+  return column;
+}
+
+// Without arithmetic on `Numeric`, aggregates go through `double`.
+void BM_NumericSumColumn(benchmark::State& state) {
+  auto const column = MakeColumn();
+  for (auto _ : state) {
+    double sum = 0;
+    for (auto const& s : column) sum += ToDouble(MakeNumeric(s).value());
+    benchmark::DoNotOptimize(sum);
+  }
+}
+BENCHMARK(BM_NumericSumColumn);
+
+void BM_FixedNumericSumColumn(benchmark::State& state) {
+  auto const column = MakeColumn();
+  for (auto _ : state) {
+    FixedNumeric sum;
+    for (auto const& s : column) {
+      sum = Add(sum, MakeFixedNumeric(s).value()).value();
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+}
+BENCHMARK(BM_FixedNumericSumColumn);
+
 }  // namespace
 GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
 }  // namespace spanner
@@ -0,0 +1,342 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/spanner/partition_runner.h"
+#include "google/cloud/spanner/retry_policy.h"
+#include <algorithm>
+#include <utility>
+
+namespace google {
+namespace cloud {
+namespace spanner {
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_BEGIN
+namespace {
+
+using StreamFactory = std::function<RowStream(std::size_t)>;
+
+// The merged stream buffers at most this many rows per running partition.
+auto constexpr kBufferedRowsPerPartition = 128;
+
+bool IsTransientFailure(Status const& status) {
+  return spanner_internal::SafeGrpcRetry::IsTransientFailure(status);
+}
+
+std::size_t WorkerCount(Options const& opts, std::size_t partition_count) {
+  auto const max = opts.has<PartitionMaxConcurrencyOption>()
+                       ? opts.get<PartitionMaxConcurrencyOption>()
+                       : std::size_t{std::thread::hardware_concurrency()};
+  return (std::max)(std::size_t{1}, (std::min)(max, partition_count));
+}
+
+// Submits @p worker_count copies of @p work to the pool configured in @p opts.
+// If there is no such pool, creates a new one and returns it. The caller must
+// keep the returned pool until the work completes.
+std::unique_ptr<PartitionWorkerPool> StartWorkers(
+    Options const& opts, std::size_t worker_count,
+    std::function<void()> const& work) {
+  std::unique_ptr<PartitionWorkerPool> local;
+  auto* pool = opts.get<PartitionWorkerPoolOption>().get();
+  if (pool == nullptr) {
+    local = std::make_unique<PartitionWorkerPool>(worker_count);
+    pool = local.get();
+  }
+  for (std::size_t i = 0; i != worker_count; ++i) pool->Submit(work);
+  return local;
+}
+
+class CallbackRunner {
+ public:
+  CallbackRunner(std::size_t partition_count, StreamFactory factory,
+                 PartitionRowsCallback callback)
+      : partition_count_(partition_count),
+        factory_(std::move(factory)),
+        callback_(std::move(callback)) {}
+
+  Status Run(Options const& opts) {
+    if (partition_count_ == 0) return Status{};
+    running_ = WorkerCount(opts, partition_count_);
+    auto local = StartWorkers(opts, running_, [this] { Work(); });
+    {
+      std::unique_lock<std::mutex> lk(mu_);
+      cv_.wait(lk, [this] { return running_ == 0; });
+    }
+    if (!status_.ok()) return status_;
+    // Retry the partitions with transient failures one at a time, to reduce
+    // the load on the service.
+    std::sort(failed_.begin(), failed_.end());
+    for (auto const i : failed_) {
+      auto status = callback_(i, factory_(i));
+      if (!status.ok()) return status;
+    }
+    return Status{};
+  }
+
+ private:
+  void Work() {
+    std::unique_lock<std::mutex> lk(mu_);
+    while (status_.ok() && next_ != partition_count_) {
+      auto const i = next_++;
+      lk.unlock();
+      auto status = callback_(i, factory_(i));
+      lk.lock();
+      if (status.ok()) continue;
+      if (IsTransientFailure(status)) {
+        failed_.push_back(i);
+      } else if (status_.ok()) {
+        status_ = std::move(status);
+      }
+    }
+    if (--running_ == 0) cv_.notify_all();
+  }
+
+  std::size_t const partition_count_;
+  StreamFactory const factory_;
+  PartitionRowsCallback const callback_;
+
+  std::mutex mu_;
+  std::condition_variable cv_;
+  std::size_t running_ = 0;
+  std::size_t next_ = 0;
+  std::vector<std::size_t> failed_;
+  Status status_;
+};
+
+/**
+ * The state shared between the merged stream and the workers.
+ *
+ * The workers may outlive the stream when they run in a shared pool, so this
+ * state is kept in a `std::shared_ptr<>`.
+ */
+class MergeState {
+ public:
+  MergeState(std::size_t partition_count, StreamFactory factory,
+             std::size_t worker_count)
+      : partition_count_(partition_count),
+        factory_(std::move(factory)),
+        capacity_(worker_count * kBufferedRowsPerPartition),
+        running_(worker_count) {}
+
+  void Work() {
+    std::unique_lock<std::mutex> lk(mu_);
+    while (!cancelled_) {
+      if (next_ != partition_count_) {
+        auto const i = next_++;
+        lk.unlock();
+        RunPartition(i, /*retry_allowed=*/true);
+        lk.lock();
+        continue;
+      }
+      // Only the last worker retries failed partitions, one at a time.
+      if (running_ != 1 || failed_.empty()) break;
+      auto const i = failed_.front();
+      failed_.pop_front();
+      lk.unlock();
+      RunPartition(i, /*retry_allowed=*/false);
+      lk.lock();
+    }
+    --running_;
+    consumer_cv_.notify_all();
+  }
+
+  StatusOr<Row> Next() {
+    std::unique_lock<std::mutex> lk(mu_);
+    if (!status_.ok()) return status_;
+    consumer_cv_.wait(lk, [this] { return !rows_.empty() || running_ == 0; });
+    if (rows_.empty()) return Row{};
+    auto row = std::move(rows_.front());
+    rows_.pop_front();
+    if (!row) {
+      // Stop all the partitions, the stream ends on the first error.
+      status_ = row.status();
+      cancelled_ = true;
+      producer_cv_.notify_all();
+      return row;
+    }
+    producer_cv_.notify_one();
+    return row;
+  }
+
+  void Cancel() {
+    std::lock_guard<std::mutex> lk(mu_);
+    cancelled_ = true;
+    producer_cv_.notify_all();
+  }
+
+ private:
+  void RunPartition(std::size_t i, bool retry_allowed) {
+    auto rows = factory_(i);
+    auto yielded = false;
+    for (auto& row : rows) {
+      std::unique_lock<std::mutex> lk(mu_);
+      // Retrying a partition after it returned some rows would return them
+      // twice.
+      if (!row && !yielded && retry_allowed &&
+          IsTransientFailure(row.status())) {
+        failed_.push_back(i);
+        return;
+      }
+      producer_cv_.wait(
+          lk, [this] { return cancelled_ || rows_.size() < capacity_; });
+      if (cancelled_) return;
+      auto const ok = row.ok();
+      rows_.push_back(std::move(row));
+      consumer_cv_.notify_one();
+      if (!ok) return;
+      yielded = true;
+    }
+  }
+
+  std::size_t const partition_count_;
+  StreamFactory const factory_;
+  std::size_t const capacity_;
+
+  std::mutex mu_;
+  std::condition_variable producer_cv_;
+  std::condition_variable consumer_cv_;
+  std::deque<StatusOr<Row>> rows_;
+  std::size_t running_;
+  std::size_t next_ = 0;
+  std::deque<std::size_t> failed_;
+  bool cancelled_ = false;
+  Status status_;
+};
+
+class MergedPartitionSource : public ResultSourceInterface {
+ public:
+  MergedPartitionSource(std::size_t partition_count, StreamFactory factory,
+                        Options const& opts) {
+    auto const worker_count = WorkerCount(opts, partition_count);
+    state_ = std::make_shared<MergeState>(partition_count, std::move(factory),
+                                          worker_count);
+    local_pool_ =
+        StartWorkers(opts, worker_count, [s = state_] { s->Work(); });
+  }
+
+  // Stops the workers. If they run in `local_pool_` its destructor waits for
+  // them.
+  ~MergedPartitionSource() override { state_->Cancel(); }
+
+  StatusOr<Row> NextRow() override { return state_->Next(); }
+  absl::optional<google::spanner::v1::ResultSetMetadata> Metadata() override {
+    return absl::nullopt;
+  }
+  absl::optional<google::spanner::v1::ResultSetStats> Stats() const override {
+    return absl::nullopt;
+  }
+
+ private:
+  std::shared_ptr<MergeState> state_;
+  std::unique_ptr<PartitionWorkerPool> local_pool_;
+};
+
+StreamFactory QueryFactory(Client client,
+                           std::vector<QueryPartition> partitions,
+                           Options opts) {
+  // The factory may be destroyed by a worker, it must not own the pool.
+  opts.unset<PartitionWorkerPoolOption>();
+  return [client = std::move(client), partitions = std::move(partitions),
+          opts = std::move(opts)](std::size_t i) mutable {
+    return client.ExecuteQuery(partitions[i], opts);
+  };
+}
+
+StreamFactory ReadFactory(Client client, std::vector<ReadPartition> partitions,
+                          Options opts) {
+  opts.unset<PartitionWorkerPoolOption>();
+  return [client = std::move(client), partitions = std::move(partitions),
+          opts = std::move(opts)](std::size_t i) mutable {
+    return client.Read(partitions[i], opts);
+  };
+}
+
+}  // namespace
+
+PartitionWorkerPool::PartitionWorkerPool(std::size_t thread_count) {
+  thread_count = (std::max)(thread_count, std::size_t{1});
+  threads_.reserve(thread_count);
+  for (std::size_t i = 0; i != thread_count; ++i) {
+    threads_.emplace_back([this] { Run(); });
+  }
+}
+
+PartitionWorkerPool::~PartitionWorkerPool() {
+  {
+    std::lock_guard<std::mutex> lk(mu_);
+    shutdown_ = true;
+  }
+  cv_.notify_all();
+  for (auto& t : threads_) t.join();
+}
+
+void PartitionWorkerPool::Submit(std::function<void()> work) {
+  {
+    std::lock_guard<std::mutex> lk(mu_);
+    work_.push_back(std::move(work));
+  }
+  cv_.notify_one();
+}
+
+void PartitionWorkerPool::Run() {
+  std::unique_lock<std::mutex> lk(mu_);
+  for (;;) {
+    cv_.wait(lk, [this] { return shutdown_ || !work_.empty(); });
+    if (work_.empty()) return;
+    auto work = std::move(work_.front());
+    work_.pop_front();
+    lk.unlock();
+    work();
+    lk.lock();
+  }
+}
+
+Status ExecuteQueryPartitions(Client client,
+                              std::vector<QueryPartition> partitions,
+                              PartitionRowsCallback callback, Options opts) {
+  auto const count = partitions.size();
+  CallbackRunner runner(
+      count, QueryFactory(std::move(client), std::move(partitions), opts),
+      std::move(callback));
+  return runner.Run(opts);
+}
+
+RowStream ExecuteQueryPartitions(Client client,
+                                 std::vector<QueryPartition> partitions,
+                                 Options opts) {
+  auto const count = partitions.size();
+  return RowStream(std::make_unique<MergedPartitionSource>(
+      count, QueryFactory(std::move(client), std::move(partitions), opts),
+      opts));
+}
+
+Status ReadPartitions(Client client, std::vector<ReadPartition> partitions,
+                      PartitionRowsCallback callback, Options opts) {
+  auto const count = partitions.size();
+  CallbackRunner runner(
+      count, ReadFactory(std::move(client), std::move(partitions), opts),
+      std::move(callback));
+  return runner.Run(opts);
+}
+
+RowStream ReadPartitions(Client client, std::vector<ReadPartition> partitions,
+                         Options opts) {
+  auto const count = partitions.size();
+  return RowStream(std::make_unique<MergedPartitionSource>(
+      count, ReadFactory(std::move(client), std::move(partitions), opts),
+      opts));
+}
+
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
+}  // namespace spanner
+}  // namespace cloud
+}  // namespace google
@@ -0,0 +1,178 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GOOGLE_CLOUD_CPP_GOOGLE_CLOUD_SPANNER_PARTITION_RUNNER_H
+#define GOOGLE_CLOUD_CPP_GOOGLE_CLOUD_SPANNER_PARTITION_RUNNER_H
+
+#include "google/cloud/spanner/client.h"
+#include "google/cloud/spanner/query_partition.h"
+#include "google/cloud/spanner/read_partition.h"
+#include "google/cloud/spanner/results.h"
+#include "google/cloud/spanner/version.h"
+#include "google/cloud/options.h"
+#include "google/cloud/status.h"
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace google {
+namespace cloud {
+namespace spanner {
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_BEGIN
+
+/**
+ * A pool of threads to run partitions returned by `Client::PartitionQuery()`
+ * or `Client::PartitionRead()`.
+ *
+ * By default, `ExecuteQueryPartitions()` and `ReadPartitions()` create new
+ * threads on each call. Applications that run partitions often can create a
+ * single pool and share it using `PartitionWorkerPoolOption`.
+ *
+ * @warning The functions in this file block until their work is scheduled in
+ *     the pool. Do not call them from a thread in the same pool.
+ */
+class PartitionWorkerPool {
+ public:
+  /// Creates a pool with @p thread_count threads, at least one.
+  explicit PartitionWorkerPool(std::size_t thread_count);
+
+  /// Runs any pending work, then stops and joins all the threads.
+  ~PartitionWorkerPool();
+
+  PartitionWorkerPool(PartitionWorkerPool const&) = delete;
+  PartitionWorkerPool& operator=(PartitionWorkerPool const&) = delete;
+
+  /// The number of threads in the pool.
+  std::size_t thread_count() const { return threads_.size(); }
+
+  /// Runs @p work in one of the pool threads.
+  void Submit(std::function<void()> work);
+
+ private:
+  void Run();
+
+  std::mutex mu_;
+  std::condition_variable cv_;
+  bool shutdown_ = false;
+  std::deque<std::function<void()>> work_;
+  std::vector<std::thread> threads_;
+};
+
+/**
+ * Option for `google::cloud::Options` to set the maximum number of partitions
+ * that `ExecuteQueryPartitions()` and `ReadPartitions()` run concurrently.
+ *
+ * The default is `std::thread::hardware_concurrency()`.
+ *
+ * @ingroup google-cloud-spanner-options
+ */
+struct PartitionMaxConcurrencyOption {
+  using Type = std::size_t;
+};
+
+/**
+ * Option for `google::cloud::Options` to run partitions in an existing
+ * `PartitionWorkerPool`.
+ *
+ * If unset, `ExecuteQueryPartitions()` and `ReadPartitions()` create a pool
+ * for each call.
+ *
+ * @ingroup google-cloud-spanner-options
+ */
+struct PartitionWorkerPoolOption {
+  using Type = std::shared_ptr<PartitionWorkerPool>;
+};
+
+/**
+ * Receives the rows for one partition.
+ *
+ * The first argument is the index of the partition in the input vector. The
+ * callback should consume the `RowStream` and return the first error it finds,
+ * if any. The callback is called concurrently for different partitions.
+ */
+using PartitionRowsCallback = std::function<Status(std::size_t, RowStream)>;
+
+/**
+ * Runs all the @p partitions concurrently, calling @p callback with the rows
+ * for each one.
+ *
+ * At most `PartitionMaxConcurrencyOption` partitions run at the same time.
+ * Whether the queries use Data Boost is determined by the
+ * `PartitionDataBoostOption` given to `Client::PartitionQuery()`.
+ *
+ * If the callback returns a transient error (see
+ * `LimitedErrorCountRetryPolicy`), the partition is retried once, after all
+ * other partitions complete, and one partition at a time. The callback is
+ * called again with the same index and a new `RowStream`, it should discard
+ * any results from the failed attempt. Any other error stops the scheduling
+ * of new partitions, and is returned once the running partitions complete.
+ *
+ * @param client the client used to run each partition.
+ * @param partitions the partitions returned by `Client::PartitionQuery()`.
+ * @param callback receives the rows for each partition.
+ * @param opts options passed to `Client::ExecuteQuery()`, and also the
+ *     options to configure this function.
+ */
+Status ExecuteQueryPartitions(Client client,
+                              std::vector<QueryPartition> partitions,
+                              PartitionRowsCallback callback,
+                              Options opts = {});
+
+/**
+ * Runs all the @p partitions concurrently, returning all their rows in a
+ * single stream.
+ *
+ * The rows from different partitions are interleaved, in no particular order.
+ * A partition that fails with a transient error before returning any rows is
+ * retried once, after all other partitions complete. Any other error is
+ * returned by the stream, and stops all the partitions.
+ *
+ * @note `RowStream::RowsModified()` and `RowStream::ReadTimestamp()` are not
+ *     available in the returned stream.
+ */
+RowStream ExecuteQueryPartitions(Client client,
+                                 std::vector<QueryPartition> partitions,
+                                 Options opts = {});
+
+/**
+ * Runs all the @p partitions concurrently, calling @p callback with the rows
+ * for each one.
+ *
+ * @see `ExecuteQueryPartitions()` for details on concurrency, retries, and
+ *     error handling.
+ */
+Status ReadPartitions(Client client, std::vector<ReadPartition> partitions,
+                      PartitionRowsCallback callback, Options opts = {});
+
+/**
+ * Runs all the @p partitions concurrently, returning all their rows in a
+ * single stream.
+ *
+ * @see `ExecuteQueryPartitions()` for details on concurrency, retries, and
+ *     error handling.
+ */
+RowStream ReadPartitions(Client client, std::vector<ReadPartition> partitions,
+                         Options opts = {});
+
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
+}  // namespace spanner
+}  // namespace cloud
+}  // namespace google
+
+#endif  // GOOGLE_CLOUD_CPP_GOOGLE_CLOUD_SPANNER_PARTITION_RUNNER_H
@@ -0,0 +1,274 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/spanner/partition_runner.h"
+#include "google/cloud/spanner/mocks/mock_spanner_connection.h"
+#include "google/cloud/spanner/mocks/row.h"
+#include "google/cloud/testing_util/status_matchers.h"
+#include <gmock/gmock.h>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace google {
+namespace cloud {
+namespace spanner {
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_BEGIN
+namespace {
+
+using ::google::cloud::spanner_mocks::MockConnection;
+using ::google::cloud::spanner_mocks::MockResultSetSource;
+using ::google::cloud::testing_util::StatusIs;
+using ::testing::UnorderedElementsAre;
+using ::testing::UnorderedElementsAreArray;
+
+RowStream MakeRowStream(std::vector<StatusOr<Row>> rows) {
+  auto source = std::make_unique<MockResultSetSource>();
+  EXPECT_CALL(*source, NextRow)
+      .WillRepeatedly([rows = std::move(rows), i = std::size_t{0}]() mutable {
+        if (i == rows.size()) return StatusOr<Row>(Row{});
+        return rows[i++];
+      });
+  return RowStream(std::move(source));
+}
+
+// Partition `i` returns the rows `10 * i` and `10 * i + 1`.
+std::vector<StatusOr<Row>> PartitionRows(std::int64_t i) {
+  return {spanner_mocks::MakeRow(10 * i), spanner_mocks::MakeRow(10 * i + 1)};
+}
+
+std::vector<std::int64_t> AllValues(std::int64_t partition_count) {
+  std::vector<std::int64_t> values;
+  for (std::int64_t i = 0; i != partition_count; ++i) {
+    values.push_back(10 * i);
+    values.push_back(10 * i + 1);
+  }
+  return values;
+}
+
+std::int64_t PartitionIndex(absl::optional<std::string> const& token) {
+  return token ? std::stoll(token->substr(token->find('-') + 1)) : -1;
+}
+
+RowStream PartitionStream(absl::optional<std::string> const& token) {
+  return MakeRowStream(PartitionRows(PartitionIndex(token)));
+}
+
+std::vector<QueryPartition> MakeQueryPartitions(int count) {
+  std::vector<QueryPartition> partitions;
+  for (int i = 0; i != count; ++i) {
+    partitions.push_back(spanner_internal::MakeQueryPartition(
+        "txn-id", false, "", "session", "token-" + std::to_string(i),
+        /*data_boost=*/true, SqlStatement("SELECT * FROM Table")));
+  }
+  return partitions;
+}
+
+std::vector<ReadPartition> MakeReadPartitions(int count) {
+  std::vector<ReadPartition> partitions;
+  for (int i = 0; i != count; ++i) {
+    partitions.push_back(spanner_internal::MakeReadPartition(
+        "txn-id", false, "", "session", "token-" + std::to_string(i), "Table",
+        KeySet::All(), {"Value"}, /*data_boost=*/true, ReadOptions{}));
+  }
+  return partitions;
+}
+
+std::vector<std::int64_t> Collect(RowStream& rows) {
+  std::vector<std::int64_t> values;
+  for (auto& row : rows) {
+    EXPECT_STATUS_OK(row);
+    if (!row) break;
+    values.push_back(*row->get<std::int64_t>(0));
+  }
+  return values;
+}
+
+class ValueCollector {
+ public:
+  Status operator()(std::size_t, RowStream rows) {
+    std::vector<std::int64_t> values;
+    for (auto& row : rows) {
+      if (!row) return std::move(row).status();
+      values.push_back(*row->get<std::int64_t>(0));
+    }
+    std::lock_guard<std::mutex> lk(mu_);
+    values_.insert(values_.end(), values.begin(), values.end());
+    return Status{};
+  }
+
+  std::vector<std::int64_t> values() {
+    std::lock_guard<std::mutex> lk(mu_);
+    return values_;
+  }
+
+ private:
+  std::mutex mu_;
+  std::vector<std::int64_t> values_;
+};
+
+TEST(PartitionRunnerTest, ExecuteQueryCallback) {
+  auto conn = std::make_shared<MockConnection>();
+  EXPECT_CALL(*conn, ExecuteQuery)
+      .Times(8)
+      .WillRepeatedly([](Connection::SqlParams const& params) {
+        EXPECT_TRUE(params.partition_data_boost);
+        return PartitionStream(params.partition_token);
+      });
+
+  ValueCollector collector;
+  auto status = ExecuteQueryPartitions(
+      Client(conn), MakeQueryPartitions(8),
+      [&](std::size_t i, RowStream rows) {
+        return collector(i, std::move(rows));
+      },
+      Options{}.set<PartitionMaxConcurrencyOption>(3));
+  ASSERT_STATUS_OK(status);
+  EXPECT_THAT(collector.values(), UnorderedElementsAreArray(AllValues(8)));
+}
+
+TEST(PartitionRunnerTest, CallbackRetriesTransientFailures) {
+  auto conn = std::make_shared<MockConnection>();
+  std::atomic<int> calls{0};
+  EXPECT_CALL(*conn, ExecuteQuery)
+      .WillRepeatedly([&](Connection::SqlParams const& params) {
+        auto const i = PartitionIndex(params.partition_token);
+        // Partition 1 fails on the first attempt.
+        if (i == 1 && calls++ == 0) {
+          return MakeRowStream({Status(StatusCode::kUnavailable, "try-again")});
+        }
+        return MakeRowStream(PartitionRows(i));
+      });
+
+  ValueCollector collector;
+  auto status = ExecuteQueryPartitions(
+      Client(conn), MakeQueryPartitions(4),
+      [&](std::size_t i, RowStream rows) {
+        return collector(i, std::move(rows));
+      },
+      Options{}.set<PartitionMaxConcurrencyOption>(2));
+  ASSERT_STATUS_OK(status);
+  EXPECT_EQ(calls.load(), 2);
+  EXPECT_THAT(collector.values(), UnorderedElementsAreArray(AllValues(4)));
+}
+
+TEST(PartitionRunnerTest, CallbackPermanentFailure) {
+  auto conn = std::make_shared<MockConnection>();
+  EXPECT_CALL(*conn, ExecuteQuery)
+      .WillRepeatedly([&](Connection::SqlParams const& params) {
+        auto const i = PartitionIndex(params.partition_token);
+        if (i == 2) {
+          return MakeRowStream({Status(StatusCode::kPermissionDenied, "nope")});
+        }
+        return MakeRowStream(PartitionRows(i));
+      });
+
+  ValueCollector collector;
+  auto status = ExecuteQueryPartitions(
+      Client(conn), MakeQueryPartitions(4),
+      [&](std::size_t i, RowStream rows) {
+        return collector(i, std::move(rows));
+      },
+      Options{}.set<PartitionMaxConcurrencyOption>(1));
+  EXPECT_THAT(status, StatusIs(StatusCode::kPermissionDenied));
+  // With a single worker the partitions run in order, and the runner stops
+  // at the first permanent failure.
+  EXPECT_THAT(collector.values(), UnorderedElementsAre(0, 1, 10, 11));
+}
+
+TEST(PartitionRunnerTest, ExecuteQueryMerged) {
+  auto conn = std::make_shared<MockConnection>();
+  EXPECT_CALL(*conn, ExecuteQuery)
+      .Times(8)
+      .WillRepeatedly([](Connection::SqlParams const& params) {
+        return PartitionStream(params.partition_token);
+      });
+
+  auto rows = ExecuteQueryPartitions(
+      Client(conn), MakeQueryPartitions(8),
+      Options{}.set<PartitionMaxConcurrencyOption>(3));
+  EXPECT_THAT(Collect(rows), UnorderedElementsAreArray(AllValues(8)));
+}
+
+TEST(PartitionRunnerTest, MergedRetriesBeforeFirstRow) {
+  auto conn = std::make_shared<MockConnection>();
+  std::atomic<int> calls{0};
+  EXPECT_CALL(*conn, ExecuteQuery)
+      .WillRepeatedly([&](Connection::SqlParams const& params) {
+        auto const i = PartitionIndex(params.partition_token);
+        if (i == 3 && calls++ == 0) {
+          return MakeRowStream({Status(StatusCode::kUnavailable, "try-again")});
+        }
+        return MakeRowStream(PartitionRows(i));
+      });
+
+  auto rows = ExecuteQueryPartitions(
+      Client(conn), MakeQueryPartitions(4),
+      Options{}.set<PartitionMaxConcurrencyOption>(2));
+  EXPECT_THAT(Collect(rows), UnorderedElementsAreArray(AllValues(4)));
+  EXPECT_EQ(calls.load(), 2);
+}
+
+TEST(PartitionRunnerTest, MergedErrorAfterFirstRow) {
+  auto conn = std::make_shared<MockConnection>();
+  EXPECT_CALL(*conn, ExecuteQuery)
+      .WillRepeatedly([&](Connection::SqlParams const&) {
+        return MakeRowStream({spanner_mocks::MakeRow(std::int64_t{0}),
+                              Status(StatusCode::kUnavailable, "try-again")});
+      });
+
+  auto rows = ExecuteQueryPartitions(
+      Client(conn), MakeQueryPartitions(4),
+      Options{}.set<PartitionMaxConcurrencyOption>(1));
+  auto i = rows.begin();
+  ASSERT_NE(i, rows.end());
+  EXPECT_STATUS_OK(*i);
+  ++i;
+  ASSERT_NE(i, rows.end());
+  EXPECT_THAT(*i, StatusIs(StatusCode::kUnavailable));
+}
+
+TEST(PartitionRunnerTest, ReadMergedWithSharedPool) {
+  auto conn = std::make_shared<MockConnection>();
+  EXPECT_CALL(*conn, Read)
+      .Times(2 * 5)
+      .WillRepeatedly([](Connection::ReadParams const& params) {
+        EXPECT_EQ(params.table, "Table");
+        return PartitionStream(params.partition_token);
+      });
+
+  auto pool = std::make_shared<PartitionWorkerPool>(2);
+  EXPECT_EQ(pool->thread_count(), 2U);
+  auto const opts = Options{}.set<PartitionWorkerPoolOption>(pool);
+  for (int i = 0; i != 2; ++i) {
+    auto rows = ReadPartitions(Client(conn), MakeReadPartitions(5), opts);
+    EXPECT_THAT(Collect(rows), UnorderedElementsAreArray(AllValues(5)));
+  }
+}
+
+TEST(PartitionRunnerTest, ReadCallbackEmpty) {
+  auto conn = std::make_shared<MockConnection>();
+  EXPECT_CALL(*conn, Read).Times(0);
+  auto status = ReadPartitions(Client(conn), {},
+                               [](std::size_t, RowStream) { return Status{}; });
+  EXPECT_STATUS_OK(status);
+}
+
+}  // namespace
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
+}  // namespace spanner
+}  // namespace cloud
+}  // namespace google
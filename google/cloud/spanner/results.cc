@@ -18,6 +18,8 @@
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace google {
 namespace cloud {
@@ -67,6 +69,18 @@ absl::optional<spanner::ExecutionPlan> GetExecutionPlan(
 }
 }  // namespace
 
+StatusOr<bool> ResultSourceInterface::NextRowValues(
+    std::vector<google::protobuf::Value>& values) {
+  auto row = NextRow();
+  if (!row) return std::move(row).status();
+  if (row->size() == 0) return false;
+  values.clear();
+  for (auto& v : std::move(*row).values()) {
+    values.push_back(spanner_internal::ToProto(std::move(v)).second);
+  }
+  return true;
+}
+
 std::int64_t RowStream::RowsModified() const {
   return GetRowsModified(source_);
 }
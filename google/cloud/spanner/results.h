@@ -20,13 +20,21 @@
 #include "google/cloud/spanner/version.h"
 #include "google/cloud/optional.h"
 #include "absl/types/optional.h"
+#include <google/protobuf/struct.pb.h>
 #include <google/spanner/v1/spanner.pb.h>
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 namespace google {
 namespace cloud {
+namespace spanner_internal {
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_BEGIN
+struct RowStreamFriend;
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
+}  // namespace spanner_internal
+
 namespace spanner {
 GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_BEGIN
 
@@ -53,6 +61,20 @@ class ResultSourceInterface {
    */
   virtual StatusOr<spanner::Row> NextRow() = 0;
 
+  /**
+   * Moves the column values of the next row in the stream into @p values.
+   *
+   * This allows callers that have already checked the column types from
+   * `Metadata()` to decode the values without building a `spanner::Row`.
+   * The default implementation is in terms of `NextRow()`.
+   *
+   * @return `true` if @p values now holds the next row, or `false` to
+   *   indicate end-of-stream. If the stream is interrupted due to a failure
+   *   the `StatusOr<bool>` contains the error.
+   */
+  virtual StatusOr<bool> NextRowValues(
+      std::vector<google::protobuf::Value>& values);
+
   /**
    * Returns metadata about the result set, such as the field types and the
    * transaction id created by the request.
@@ -128,6 +150,7 @@ class RowStream {
   absl::optional<Timestamp> ReadTimestamp() const;
 
  private:
+  friend struct spanner_internal::RowStreamFriend;
   std::unique_ptr<ResultSourceInterface> source_;
 };
 
@@ -0,0 +1,42 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/spanner/row_binding.h"
+#include "google/cloud/internal/make_status.h"
+#include "absl/strings/str_cat.h"
+
+namespace google {
+namespace cloud {
+namespace spanner_internal {
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_BEGIN
+
+// These use the same status codes as `Row::get<Tuple>()` and `Value::get<T>()`
+// so that `BindRows()` reports mismatches just as `StreamOf()` would.
+
+Status RowBindingColumnCountError(std::size_t columns, std::size_t fields) {
+  return internal::InvalidArgumentError(
+      absl::StrCat("row has ", columns, " columns, but the binding has ",
+                   fields, " fields"),
+      GCP_ERROR_INFO());
+}
+
+Status RowBindingColumnTypeError(std::size_t column) {
+  return internal::UnknownError(
+      absl::StrCat("wrong type for column ", column), GCP_ERROR_INFO());
+}
+
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
+}  // namespace spanner_internal
+}  // namespace cloud
+}  // namespace google
@@ -0,0 +1,440 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GOOGLE_CLOUD_CPP_GOOGLE_CLOUD_SPANNER_ROW_BINDING_H
+#define GOOGLE_CLOUD_CPP_GOOGLE_CLOUD_SPANNER_ROW_BINDING_H
+
+#include "google/cloud/spanner/internal/tuple_utils.h"
+#include "google/cloud/spanner/results.h"
+#include "google/cloud/spanner/value.h"
+#include "google/cloud/spanner/version.h"
+#include "google/cloud/status.h"
+#include "google/cloud/status_or.h"
+#include <google/protobuf/struct.pb.h>
+#include <google/spanner/v1/type.pb.h>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace google {
+namespace cloud {
+namespace spanner {
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_BEGIN
+template <typename T, typename... Fields>
+class RowBinding;
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
+}  // namespace spanner
+
+namespace spanner_internal {
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_BEGIN
+
+// A `RowBinding` field that stores a column into a data member of `T`.
+template <typename T, typename M>
+struct MemberField {
+  using type = M;
+  M T::*member;
+  M& operator()(T& t) const { return t.*member; }
+};
+
+// A `RowBinding` field that stores a column into element `I` of a tuple.
+template <typename Tuple, std::size_t I>
+struct TupleField {
+  using type = std::tuple_element_t<I, Tuple>;
+  type& operator()(Tuple& t) const { return std::get<I>(t); }
+};
+
+template <typename Tuple, typename Indices>
+struct TupleBindingImpl;
+template <typename Tuple, std::size_t... Is>
+struct TupleBindingImpl<Tuple, std::index_sequence<Is...>> {
+  using type = spanner::RowBinding<Tuple, TupleField<Tuple, Is>...>;
+  static type Make() { return type(TupleField<Tuple, Is>{}...); }
+};
+
+struct RowStreamFriend {
+  static spanner::ResultSourceInterface* Source(spanner::RowStream& rows) {
+    return rows.source_.get();
+  }
+};
+
+Status RowBindingColumnCountError(std::size_t columns, std::size_t fields);
+Status RowBindingColumnTypeError(std::size_t column);
+
+// Reads rows from a `ResultSourceInterface` and decodes them into the
+// `value_type` of the given `RowBinding`.
+//
+// The column types are checked against the binding once, using the result
+// set metadata, and then each row is decoded straight from the protos into
+// its fields. Should the source have no metadata (say, because it is a mock)
+// we fall back to reading `spanner::Row`s and checking the types of each.
+template <typename Binding>
+class RowDecoder {
+ public:
+  using value_type = typename Binding::value_type;
+
+  RowDecoder(spanner::ResultSourceInterface* source, Binding binding)
+      : source_(source), binding_(std::move(binding)) {}
+
+  // Stores the next row (or an error) into @p row, returning `false` and
+  // leaving @p row untouched at end-of-stream. Assigning into the caller's
+  // `StatusOr` avoids moving one per row, which is not free.
+  bool Next(StatusOr<value_type>& row) {
+    if (source_ == nullptr) return false;
+    if (state_ == kUnchecked) {
+      auto metadata = source_->Metadata();
+      if (!metadata) {
+        state_ = kCheckEachRow;
+      } else {
+        state_ = kChecked;
+        for (auto& field : *metadata->mutable_row_type()->mutable_fields()) {
+          types_.push_back(std::move(*field.mutable_type()));
+        }
+        auto status = CheckTypes();
+        if (!status.ok()) return Fail(row, std::move(status));
+      }
+    }
+    if (state_ == kCheckEachRow) {
+      auto next = source_->NextRow();
+      if (!next) return Fail(row, std::move(next).status());
+      if (next->size() == 0) return false;
+      types_.clear();
+      values_.clear();
+      for (auto& v : std::move(*next).values()) {
+        auto p = ToProto(std::move(v));
+        types_.push_back(std::move(p.first));
+        values_.push_back(std::move(p.second));
+      }
+      auto status = CheckTypes();
+      if (!status.ok()) return Fail(row, std::move(status));
+    } else {
+      auto next = source_->NextRowValues(values_);
+      if (!next) return Fail(row, std::move(next).status());
+      if (!*next) return false;
+      if (values_.size() != types_.size()) {
+        return Fail(row,
+                    RowBindingColumnCountError(values_.size(), types_.size()));
+      }
+    }
+    value_type value{};
+    Status status;
+    spanner_internal::ForEach(binding_.fields(),
+                              DecodeField{status, 0, value, values_, types_});
+    if (!status.ok()) return Fail(row, std::move(status));
+    row = std::move(value);
+    return true;
+  }
+
+ private:
+  // A functor to be used with `ForEach()` to check that each column type
+  // can be decoded into the corresponding field.
+  struct CheckField {
+    std::vector<google::spanner::v1::Type> const& types;
+    std::size_t i;
+    std::size_t mismatch;
+    template <typename F>
+    void operator()(F const&) {
+      if (mismatch == types.size() &&
+          !ValueInternals::TypeProtoIs<typename F::type>(types[i])) {
+        mismatch = i;
+      }
+      ++i;
+    }
+  };
+
+  // A functor to be used with `ForEach()` to decode each column value into
+  // the corresponding field.
+  struct DecodeField {
+    Status& status;
+    std::size_t i;
+    value_type& row;
+    std::vector<google::protobuf::Value>& values;
+    std::vector<google::spanner::v1::Type> const& types;
+    template <typename F>
+    void operator()(F const& field) {
+      auto const column = i++;
+      if (!status.ok()) return;
+      auto value = ValueInternals::GetValue<typename F::type>(
+          std::move(values[column]), types[column]);
+      if (!value) {
+        status = std::move(value).status();
+      } else {
+        field(row) = *std::move(value);
+      }
+    }
+  };
+
+  static bool Fail(StatusOr<value_type>& row, Status status) {
+    row = std::move(status);
+    return true;
+  }
+
+  Status CheckTypes() const {
+    auto constexpr kFields =
+        std::tuple_size<std::decay_t<decltype(binding_.fields())>>::value;
+    if (types_.size() != kFields) {
+      return RowBindingColumnCountError(types_.size(), kFields);
+    }
+    CheckField check{types_, 0, types_.size()};
+    spanner_internal::ForEach(binding_.fields(), check);
+    if (check.mismatch != types_.size()) {
+      return RowBindingColumnTypeError(check.mismatch);
+    }
+    return {};
+  }
+
+  spanner::ResultSourceInterface* source_;
+  Binding binding_;
+  enum { kUnchecked, kChecked, kCheckEachRow } state_ = kUnchecked;
+  std::vector<google::spanner::v1::Type> types_;
+  std::vector<google::protobuf::Value> values_;
+};
+
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
+}  // namespace spanner_internal
+
+namespace spanner {
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_BEGIN
+
+/**
+ * Describes how the columns of a result set map onto the fields of a `T`.
+ *
+ * Each of the `Fields` corresponds to one column, in order, and determines
+ * both the C++ type that column must have and where it is stored in the `T`.
+ * Users create instances using the `MakeRowBinding()` factory function (for
+ * structs), or implicitly with `BindRows<std::tuple<...>>()` (for tuples).
+ *
+ * @tparam T the type each row is decoded into. It must be default
+ *     constructible.
+ */
+template <typename T, typename... Fields>
+class RowBinding {
+ public:
+  using value_type = T;
+
+  explicit RowBinding(Fields... fields) : fields_(std::move(fields)...) {}
+
+  std::tuple<Fields...> const& fields() const { return fields_; }
+
+ private:
+  std::tuple<Fields...> fields_;
+};
+
+/**
+ * Creates a `RowBinding` that stores the columns of each row into the given
+ * data members of a `T`, in order.
+ *
+ * @par Example
+ * @code
+ * struct Singer {
+ *   std::int64_t singer_id;
+ *   std::string first_name;
+ *   absl::optional<std::string> last_name;
+ * };
+ * auto binding = MakeRowBinding(&Singer::singer_id, &Singer::first_name,
+ *                               &Singer::last_name);
+ * @endcode
+ */
+template <typename T, typename... Ms>
+RowBinding<T, spanner_internal::MemberField<T, Ms>...> MakeRowBinding(
+    Ms T::*... members) {
+  return RowBinding<T, spanner_internal::MemberField<T, Ms>...>(
+      spanner_internal::MemberField<T, Ms>{members}...);
+}
+
+/**
+ * The `RowBinding` that `BindRows<Tuple>()` uses to store the columns of each
+ * row into the elements of a `std::tuple`.
+ */
+template <typename Tuple>
+using TupleBinding = typename spanner_internal::TupleBindingImpl<
+    Tuple, std::make_index_sequence<std::tuple_size<Tuple>::value>>::type;
+
+/**
+ * A `BoundRowStreamIterator<Binding>` is an "Input Iterator" that returns a
+ * sequence of `StatusOr<Binding::value_type>` objects.
+ *
+ * As an Input Iterator, the sequence may only be consumed once. Default
+ * constructing this object creates an instance that represents "end".
+ *
+ * @tparam Binding the `RowBinding` used to decode each row.
+ */
+template <typename Binding>
+class BoundRowStreamIterator {
+ public:
+  /// @name Iterator type aliases
+  ///@{
+  using iterator_category = std::input_iterator_tag;
+  using value_type = StatusOr<typename Binding::value_type>;
+  using difference_type = std::ptrdiff_t;
+  using pointer = value_type*;
+  using reference = value_type&;
+  using const_pointer = value_type const*;
+  using const_reference = value_type const&;
+  ///@}
+
+  /// Default constructs an "end" iterator.
+  BoundRowStreamIterator() = default;
+
+  /// Creates an iterator that consumes rows from the given @p decoder.
+  explicit BoundRowStreamIterator(
+      spanner_internal::RowDecoder<Binding>* decoder)
+      : decoder_(decoder) {
+    Decode();
+  }
+
+  reference operator*() { return row_; }
+  pointer operator->() { return &row_; }
+
+  const_reference operator*() const { return row_; }
+  const_pointer operator->() const { return &row_; }
+
+  BoundRowStreamIterator& operator++() {
+    if (!row_ok_) {
+      decoder_ = nullptr;
+      return *this;
+    }
+    Decode();
+    return *this;
+  }
+
+  BoundRowStreamIterator operator++(int) {
+    auto const old = *this;
+    ++*this;
+    return old;
+  }
+
+  friend bool operator==(BoundRowStreamIterator const& a,
+                         BoundRowStreamIterator const& b) {
+    return a.decoder_ == b.decoder_;
+  }
+
+  friend bool operator!=(BoundRowStreamIterator const& a,
+                         BoundRowStreamIterator const& b) {
+    return !(a == b);
+  }
+
+ private:
+  void Decode() {
+    if (decoder_ == nullptr) return;
+    if (!decoder_->Next(row_)) {
+      decoder_ = nullptr;
+      return;
+    }
+    row_ok_ = row_.ok();
+  }
+
+  spanner_internal::RowDecoder<Binding>* decoder_ = nullptr;
+  bool row_ok_{false};
+  value_type row_;
+};
+
+/**
+ * A `BoundRowStream<Binding>` defines a range that decodes the rows of a
+ * `RowStream` into `Binding::value_type` objects.
+ *
+ * Unlike `StreamOf()`, which converts each `Row` with `Row::get<Tuple>()`,
+ * the column types are checked against the binding only once, and the column
+ * values are then decoded straight into the target fields without creating
+ * any intermediate `Row` or `Value` objects.
+ *
+ * Users create instances using the `BindRows()` non-member factory functions
+ * (defined below). The following is a typical usage of this class in a
+ * range-for loop.
+ *
+ * @code
+ * auto rows = client.ExecuteQuery(...);
+ * auto binding = MakeRowBinding(&Singer::singer_id, &Singer::first_name,
+ *                               &Singer::last_name);
+ * for (auto& singer : BindRows(rows, binding)) {
+ *   if (!singer) {
+ *     // Handle error;
+ *   }
+ *   std::int64_t id = singer->singer_id;
+ *   ...
+ * }
+ * @endcode
+ *
+ * @note The term "stream" in this name refers to the general nature
+ *     of the data source, and is not intended to suggest any similarity to
+ *     C++'s I/O streams library. Syntactically, this class is a "range"
+ *     defined by two "iterator" objects of type
+ *     `BoundRowStreamIterator<Binding>`.
+ *
+ * @tparam Binding the `RowBinding` used to decode each row.
+ */
+template <typename Binding>
+class BoundRowStream {
+ public:
+  using iterator = BoundRowStreamIterator<Binding>;
+
+  iterator begin() { return iterator(decoder_.get()); }
+  // NOLINTNEXTLINE(readability-convert-member-functions-to-static)
+  iterator end() { return {}; }
+
+ private:
+  template <typename B>
+  friend BoundRowStream<B> BindRows(RowStream& rows, B binding);
+
+  explicit BoundRowStream(
+      std::unique_ptr<spanner_internal::RowDecoder<Binding>> decoder)
+      : decoder_(std::move(decoder)) {}
+
+  std::unique_ptr<spanner_internal::RowDecoder<Binding>> decoder_;
+};
+
+/**
+ * A factory that creates a `BoundRowStream<Binding>` that decodes the rows
+ * of @p rows using the given @p binding.
+ *
+ * @note Ownership of @p rows is not transferred, so it must outlive the
+ *     returned `BoundRowStream`.
+ */
+template <typename Binding>
+BoundRowStream<Binding> BindRows(RowStream& rows, Binding binding) {
+  return BoundRowStream<Binding>(
+      std::make_unique<spanner_internal::RowDecoder<Binding>>(
+          spanner_internal::RowStreamFriend::Source(rows),
+          std::move(binding)));
+}
+
+/**
+ * A factory that creates a `BoundRowStream` that decodes the rows of @p rows
+ * into the specified `Tuple`.
+ *
+ * This is a drop-in replacement for `StreamOf<Tuple>(rows)`.
+ *
+ * @note Ownership of @p rows is not transferred, so it must outlive the
+ *     returned `BoundRowStream`.
+ *
+ * @tparam Tuple the std::tuple<...> to decode each row into.
+ */
+template <typename Tuple>
+BoundRowStream<TupleBinding<Tuple>> BindRows(RowStream& rows) {
+  static_assert(spanner_internal::IsTuple<Tuple>::value,
+                "BindRows<T>() requires a std::tuple parameter");
+  using Impl = spanner_internal::TupleBindingImpl<
+      Tuple, std::make_index_sequence<std::tuple_size<Tuple>::value>>;
+  return BindRows(rows, Impl::Make());
+}
+
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
+}  // namespace spanner
+}  // namespace cloud
+}  // namespace google
+
+#endif  // GOOGLE_CLOUD_CPP_GOOGLE_CLOUD_SPANNER_ROW_BINDING_H
@@ -0,0 +1,275 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/spanner/row_binding.h"
+#include "google/cloud/spanner/mocks/mock_spanner_connection.h"
+#include "google/cloud/spanner/mocks/row.h"
+#include "google/cloud/spanner/results.h"
+#include "google/cloud/testing_util/status_matchers.h"
+#include "absl/types/optional.h"
+#include <google/protobuf/text_format.h>
+#include <gmock/gmock.h>
+#include <cstdint>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace google {
+namespace cloud {
+namespace spanner {
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_BEGIN
+namespace {
+
+using ::google::cloud::spanner_mocks::MockResultSetSource;
+using ::google::cloud::testing_util::StatusIs;
+using ::google::protobuf::TextFormat;
+using ::testing::HasSubstr;
+using ::testing::Return;
+
+struct Singer {
+  std::int64_t singer_id;
+  std::string first_name;
+  absl::optional<std::string> last_name;
+};
+
+google::spanner::v1::ResultSetMetadata MakeMetadata(std::string const& text) {
+  google::spanner::v1::ResultSetMetadata metadata;
+  EXPECT_TRUE(TextFormat::ParseFromString(text, &metadata));
+  return metadata;
+}
+
+auto constexpr kSingerMetadata = R"pb(
+  row_type: {
+    fields: {
+      name: "SingerId",
+      type: { code: INT64 }
+    }
+    fields: {
+      name: "FirstName",
+      type: { code: STRING }
+    }
+    fields: {
+      name: "LastName",
+      type: { code: STRING }
+    }
+  }
+)pb";
+
+TEST(RowBinding, DefaultRowStream) {
+  RowStream rows;
+  int num_rows = 0;
+  for (auto const& row : BindRows<std::tuple<std::int64_t>>(rows)) {
+    static_cast<void>(row);
+    ++num_rows;
+  }
+  EXPECT_EQ(num_rows, 0);
+}
+
+TEST(RowBinding, IterateNoRows) {
+  auto mock_source = std::make_unique<MockResultSetSource>();
+  EXPECT_CALL(*mock_source, Metadata())
+      .WillOnce(Return(MakeMetadata(kSingerMetadata)));
+  EXPECT_CALL(*mock_source, NextRow()).WillOnce(Return(Row()));
+
+  RowStream rows(std::move(mock_source));
+  int num_rows = 0;
+  using RowType = std::tuple<std::int64_t, std::string, std::string>;
+  for (auto const& row : BindRows<RowType>(rows)) {
+    static_cast<void>(row);
+    ++num_rows;
+  }
+  EXPECT_EQ(num_rows, 0);
+}
+
+TEST(RowBinding, Tuple) {
+  auto mock_source = std::make_unique<MockResultSetSource>();
+  EXPECT_CALL(*mock_source, Metadata())
+      .WillOnce(Return(MakeMetadata(kSingerMetadata)));
+  EXPECT_CALL(*mock_source, NextRow())
+      .WillOnce(Return(spanner_mocks::MakeRow(1, "Marc", "Richards")))
+      .WillOnce(Return(spanner_mocks::MakeRow(2, "Catalina", "Smith")))
+      .WillOnce(Return(Row()));
+
+  RowStream rows(std::move(mock_source));
+  using RowType = std::tuple<std::int64_t, std::string, std::string>;
+  std::vector<RowType> actual;
+  for (auto& row : BindRows<RowType>(rows)) {
+    ASSERT_STATUS_OK(row);
+    actual.push_back(*std::move(row));
+  }
+  std::vector<RowType> const expected = {
+      RowType{1, "Marc", "Richards"},
+      RowType{2, "Catalina", "Smith"},
+  };
+  EXPECT_EQ(actual, expected);
+}
+
+TEST(RowBinding, Struct) {
+  auto mock_source = std::make_unique<MockResultSetSource>();
+  EXPECT_CALL(*mock_source, Metadata())
+      .WillOnce(Return(MakeMetadata(kSingerMetadata)));
+  EXPECT_CALL(*mock_source, NextRow())
+      .WillOnce(Return(spanner_mocks::MakeRow(1, "Marc", "Richards")))
+      .WillOnce(Return(spanner_mocks::MakeRow(
+          2, "Catalina", absl::optional<std::string>{})))
+      .WillOnce(Return(Row()));
+
+  RowStream rows(std::move(mock_source));
+  auto binding = MakeRowBinding(&Singer::singer_id, &Singer::first_name,
+                                &Singer::last_name);
+  int num_rows = 0;
+  for (auto& singer : BindRows(rows, binding)) {
+    ASSERT_STATUS_OK(singer);
+    switch (num_rows++) {
+      case 0:
+        EXPECT_EQ(singer->singer_id, 1);
+        EXPECT_EQ(singer->first_name, "Marc");
+        EXPECT_EQ(singer->last_name, "Richards");
+        break;
+
+      case 1:
+        EXPECT_EQ(singer->singer_id, 2);
+        EXPECT_EQ(singer->first_name, "Catalina");
+        EXPECT_FALSE(singer->last_name.has_value());
+        break;
+
+      default:
+        ADD_FAILURE() << "Unexpected row number " << num_rows;
+        break;
+    }
+  }
+  EXPECT_EQ(num_rows, 2);
+}
+
+TEST(RowBinding, NoMetadata) {
+  auto mock_source = std::make_unique<MockResultSetSource>();
+  EXPECT_CALL(*mock_source, Metadata()).WillOnce(Return(absl::nullopt));
+  EXPECT_CALL(*mock_source, NextRow())
+      .WillOnce(Return(spanner_mocks::MakeRow(1, "Marc", "Richards")))
+      .WillOnce(Return(spanner_mocks::MakeRow(2, "Catalina", true)));
+
+  RowStream rows(std::move(mock_source));
+  auto binding = MakeRowBinding(&Singer::singer_id, &Singer::first_name,
+                                &Singer::last_name);
+  int num_rows = 0;
+  for (auto& singer : BindRows(rows, binding)) {
+    switch (num_rows++) {
+      case 0:
+        ASSERT_STATUS_OK(singer);
+        EXPECT_EQ(singer->singer_id, 1);
+        EXPECT_EQ(singer->first_name, "Marc");
+        EXPECT_EQ(singer->last_name, "Richards");
+        break;
+
+      case 1:
+        // Without metadata the types are checked on every row.
+        EXPECT_THAT(singer, StatusIs(StatusCode::kUnknown,
+                                     HasSubstr("wrong type for column 2")));
+        break;
+
+      default:
+        ADD_FAILURE() << "Unexpected row number " << num_rows;
+        break;
+    }
+  }
+  EXPECT_EQ(num_rows, 2);
+}
+
+TEST(RowBinding, WrongNumberOfColumns) {
+  auto mock_source = std::make_unique<MockResultSetSource>();
+  EXPECT_CALL(*mock_source, Metadata())
+      .WillOnce(Return(MakeMetadata(kSingerMetadata)));
+  EXPECT_CALL(*mock_source, NextRow()).Times(0);
+
+  RowStream rows(std::move(mock_source));
+  int num_rows = 0;
+  for (auto const& row :
+       BindRows<std::tuple<std::int64_t, std::string>>(rows)) {
+    EXPECT_THAT(row, StatusIs(StatusCode::kInvalidArgument,
+                              HasSubstr("row has 3 columns")));
+    ++num_rows;
+  }
+  EXPECT_EQ(num_rows, 1);
+}
+
+TEST(RowBinding, WrongType) {
+  auto mock_source = std::make_unique<MockResultSetSource>();
+  EXPECT_CALL(*mock_source, Metadata())
+      .WillOnce(Return(MakeMetadata(kSingerMetadata)));
+  EXPECT_CALL(*mock_source, NextRow()).Times(0);
+
+  RowStream rows(std::move(mock_source));
+  int num_rows = 0;
+  using RowType = std::tuple<std::int64_t, bool, std::string>;
+  for (auto const& row : BindRows<RowType>(rows)) {
+    EXPECT_THAT(row, StatusIs(StatusCode::kUnknown,
+                              HasSubstr("wrong type for column 1")));
+    ++num_rows;
+  }
+  EXPECT_EQ(num_rows, 1);
+}
+
+TEST(RowBinding, NullValue) {
+  auto mock_source = std::make_unique<MockResultSetSource>();
+  EXPECT_CALL(*mock_source, Metadata())
+      .WillOnce(Return(MakeMetadata(kSingerMetadata)));
+  EXPECT_CALL(*mock_source, NextRow())
+      .WillOnce(Return(spanner_mocks::MakeRow(
+          1, "Marc", absl::optional<std::string>{})));
+
+  RowStream rows(std::move(mock_source));
+  int num_rows = 0;
+  using RowType = std::tuple<std::int64_t, std::string, std::string>;
+  for (auto const& row : BindRows<RowType>(rows)) {
+    EXPECT_THAT(row, StatusIs(StatusCode::kUnknown, HasSubstr("null value")));
+    ++num_rows;
+  }
+  EXPECT_EQ(num_rows, 1);
+}
+
+TEST(RowBinding, IterateError) {
+  auto mock_source = std::make_unique<MockResultSetSource>();
+  EXPECT_CALL(*mock_source, Metadata())
+      .WillOnce(Return(MakeMetadata(kSingerMetadata)));
+  EXPECT_CALL(*mock_source, NextRow())
+      .WillOnce(Return(spanner_mocks::MakeRow(1, "Marc", "Richards")))
+      .WillOnce(Return(Status(StatusCode::kUnknown, "oops")));
+
+  RowStream rows(std::move(mock_source));
+  int num_rows = 0;
+  using RowType = std::tuple<std::int64_t, std::string, std::string>;
+  for (auto const& row : BindRows<RowType>(rows)) {
+    switch (num_rows++) {
+      case 0:
+        ASSERT_STATUS_OK(row);
+        EXPECT_EQ(std::get<0>(*row), 1);
+        break;
+
+      case 1:
+        EXPECT_THAT(row, StatusIs(StatusCode::kUnknown, "oops"));
+        break;
+
+      default:
+        ADD_FAILURE() << "Unexpected row number " << num_rows;
+        break;
+    }
+  }
+  EXPECT_EQ(num_rows, 2);
+}
+
+}  // namespace
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
+}  // namespace spanner
+}  // namespace cloud
+}  // namespace google
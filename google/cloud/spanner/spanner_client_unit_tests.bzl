@@ -27,6 +27,7 @@ spanner_client_unit_tests = [
     "database_admin_client_test.cc",
     "database_admin_connection_test.cc",
     "database_test.cc",
+    "fixed_numeric_test.cc",
     "instance_admin_client_test.cc",
     "instance_admin_connection_test.cc",
     "instance_test.cc",
@@ -52,6 +53,7 @@ spanner_client_unit_tests = [
     "mutations_test.cc",
     "numeric_test.cc",
     "partition_options_test.cc",
+    "partition_runner_test.cc",
     "proto_enum_test.cc",
     "proto_message_test.cc",
     "query_options_test.cc",
@@ -60,6 +62,7 @@ spanner_client_unit_tests = [
     "read_partition_test.cc",
     "results_test.cc",
     "retry_policy_test.cc",
+    "row_binding_test.cc",
     "row_test.cc",
     "session_pool_options_test.cc",
     "spanner_version_test.cc",
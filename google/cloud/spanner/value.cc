@@ -308,6 +308,16 @@ bool Value::TypeProtoIs(PgNumeric const&,
              google::spanner::v1::TypeAnnotationCode::PG_NUMERIC;
 }
 
+bool Value::TypeProtoIs(FixedNumeric const&,
+                        google::spanner::v1::Type const& type) {
+  return TypeProtoIs(Numeric{}, type);
+}
+
+bool Value::TypeProtoIs(FixedPgNumeric const&,
+                        google::spanner::v1::Type const& type) {
+  return TypeProtoIs(PgNumeric{}, type);
+}
+
 bool Value::TypeProtoIs(PgOid const&, google::spanner::v1::Type const& type) {
   return type.code() == google::spanner::v1::TypeCode::INT64 &&
          type.type_annotation() ==
@@ -384,6 +394,14 @@ google::spanner::v1::Type Value::MakeTypeProto(PgNumeric const&) {
   return t;
 }
 
+google::spanner::v1::Type Value::MakeTypeProto(FixedNumeric const&) {
+  return MakeTypeProto(Numeric{});
+}
+
+google::spanner::v1::Type Value::MakeTypeProto(FixedPgNumeric const&) {
+  return MakeTypeProto(PgNumeric{});
+}
+
 google::spanner::v1::Type Value::MakeTypeProto(PgOid const&) {
   google::spanner::v1::Type t;
   t.set_code(google::spanner::v1::TypeCode::INT64);
@@ -501,6 +519,18 @@ google::protobuf::Value Value::MakeValueProto(PgNumeric n) {
   return v;
 }
 
+google::protobuf::Value Value::MakeValueProto(FixedNumeric const& n) {
+  google::protobuf::Value v;
+  v.set_string_value(n.ToString());
+  return v;
+}
+
+google::protobuf::Value Value::MakeValueProto(FixedPgNumeric const& n) {
+  google::protobuf::Value v;
+  v.set_string_value(n.ToString());
+  return v;
+}
+
 google::protobuf::Value Value::MakeValueProto(PgOid n) {
   google::protobuf::Value v;
   v.set_string_value(std::to_string(static_cast<std::uint64_t>(n)));
@@ -688,6 +718,24 @@ StatusOr<PgNumeric> Value::GetValue(PgNumeric const&,
   return *decoded;
 }
 
+StatusOr<FixedNumeric> Value::GetValue(FixedNumeric const&,
+                                       google::protobuf::Value const& pv,
+                                       google::spanner::v1::Type const&) {
+  if (pv.kind_case() != google::protobuf::Value::kStringValue) {
+    return internal::UnknownError("missing NUMERIC", GCP_ERROR_INFO());
+  }
+  return MakeFixedNumeric(pv.string_value());
+}
+
+StatusOr<FixedPgNumeric> Value::GetValue(FixedPgNumeric const&,
+                                         google::protobuf::Value const& pv,
+                                         google::spanner::v1::Type const&) {
+  if (pv.kind_case() != google::protobuf::Value::kStringValue) {
+    return internal::UnknownError("missing NUMERIC", GCP_ERROR_INFO());
+  }
+  return MakeFixedPgNumeric(pv.string_value());
+}
+
 StatusOr<PgOid> Value::GetValue(PgOid const&, google::protobuf::Value const& pv,
                                 google::spanner::v1::Type const&) {
   if (pv.kind_case() != google::protobuf::Value::kStringValue) {
@@ -17,6 +17,7 @@
 
 #include "google/cloud/spanner/bytes.h"
 #include "google/cloud/spanner/date.h"
+#include "google/cloud/spanner/fixed_numeric.h"
 #include "google/cloud/spanner/internal/tuple_utils.h"
 #include "google/cloud/spanner/interval.h"
 #include "google/cloud/spanner/json.h"
@@ -75,6 +76,8 @@ GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_BEGIN
  * JSONB        | `google::cloud::spanner::JsonB`
  * NUMERIC      | `google::cloud::spanner::Numeric`
  * NUMERIC(PG)  | `google::cloud::spanner::PgNumeric`
+ * NUMERIC      | `google::cloud::spanner::FixedNumeric`  // [2]
+ * NUMERIC(PG)  | `google::cloud::spanner::FixedPgNumeric`  // [2]
  * OID(PG)      | `google::cloud::spanner::PgOid`
  * TIMESTAMP    | `google::cloud::spanner::Timestamp`
  * DATE         | `absl::CivilDay`
@@ -86,6 +89,8 @@ GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_BEGIN
  *
  * [1] The type `T` may be any of the other supported types, except for
  *     ARRAY/`std::vector`.
+ * [2] An alternative representation of the same Spanner type, which is
+ *     cheaper to decode and supports arithmetic.
  *
  * Value is a regular C++ value type with support for copy, move, equality,
  * etc. A default-constructed Value represents an empty value with no type.
@@ -214,6 +219,11 @@ class Value {
   /// @copydoc Value(bool)
   explicit Value(PgNumeric v) : Value(PrivateConstructor{}, std::move(v)) {}
   /// @copydoc Value(bool)
+  explicit Value(FixedNumeric v) : Value(PrivateConstructor{}, std::move(v)) {}
+  /// @copydoc Value(bool)
+  explicit Value(FixedPgNumeric v)
+      : Value(PrivateConstructor{}, std::move(v)) {}
+  /// @copydoc Value(bool)
   explicit Value(PgOid v) : Value(PrivateConstructor{}, std::move(v)) {}
   /// @copydoc Value(bool)
   explicit Value(Timestamp v) : Value(PrivateConstructor{}, std::move(v)) {}
@@ -398,6 +408,10 @@ class Value {
   static bool TypeProtoIs(JsonB const&, google::spanner::v1::Type const&);
   static bool TypeProtoIs(Numeric const&, google::spanner::v1::Type const&);
   static bool TypeProtoIs(PgNumeric const&, google::spanner::v1::Type const&);
+  static bool TypeProtoIs(FixedNumeric const&,
+                          google::spanner::v1::Type const&);
+  static bool TypeProtoIs(FixedPgNumeric const&,
+                          google::spanner::v1::Type const&);
   static bool TypeProtoIs(PgOid const&, google::spanner::v1::Type const&);
   template <typename E>
   static bool TypeProtoIs(ProtoEnum<E> const&,
@@ -461,6 +475,8 @@ class Value {
   static google::spanner::v1::Type MakeTypeProto(JsonB const&);
   static google::spanner::v1::Type MakeTypeProto(Numeric const&);
   static google::spanner::v1::Type MakeTypeProto(PgNumeric const&);
+  static google::spanner::v1::Type MakeTypeProto(FixedNumeric const&);
+  static google::spanner::v1::Type MakeTypeProto(FixedPgNumeric const&);
   static google::spanner::v1::Type MakeTypeProto(PgOid const&);
   static google::spanner::v1::Type MakeTypeProto(Timestamp);
   static google::spanner::v1::Type MakeTypeProto(CommitTimestamp);
@@ -541,6 +557,8 @@ class Value {
   static google::protobuf::Value MakeValueProto(JsonB j);
   static google::protobuf::Value MakeValueProto(Numeric n);
   static google::protobuf::Value MakeValueProto(PgNumeric n);
+  static google::protobuf::Value MakeValueProto(FixedNumeric const& n);
+  static google::protobuf::Value MakeValueProto(FixedPgNumeric const& n);
   static google::protobuf::Value MakeValueProto(PgOid n);
   static google::protobuf::Value MakeValueProto(Timestamp ts);
   static google::protobuf::Value MakeValueProto(CommitTimestamp ts);
@@ -552,9 +570,7 @@ class Value {
   }
   template <typename M>
   static google::protobuf::Value MakeValueProto(ProtoMessage<M> m) {
-    internal::Base64Encoder encoder;
-    for (auto c : std::string{m}) encoder.PushBack(c);
-    return MakeValueProto(std::move(encoder).FlushAndPad());
+    return MakeValueProto(internal::Base64Encode(std::string{m}));
   }
   static google::protobuf::Value MakeValueProto(int i);
   static google::protobuf::Value MakeValueProto(char const* s);
@@ -626,6 +642,12 @@ class Value {
   static StatusOr<PgNumeric> GetValue(PgNumeric const&,
                                       google::protobuf::Value const&,
                                       google::spanner::v1::Type const&);
+  static StatusOr<FixedNumeric> GetValue(FixedNumeric const&,
+                                         google::protobuf::Value const&,
+                                         google::spanner::v1::Type const&);
+  static StatusOr<FixedPgNumeric> GetValue(FixedPgNumeric const&,
+                                           google::protobuf::Value const&,
+                                           google::spanner::v1::Type const&);
   static StatusOr<PgOid> GetValue(PgOid const&, google::protobuf::Value const&,
                                   google::spanner::v1::Type const&);
   static StatusOr<Timestamp> GetValue(Timestamp, google::protobuf::Value const&,
@@ -660,9 +682,9 @@ class Value {
     if (pv.kind_case() != google::protobuf::Value::kStringValue) {
       return internal::UnknownError("missing PROTO", GCP_ERROR_INFO());
     }
-    auto bytes = internal::Base64DecodeToBytes(pv.string_value());
+    auto bytes = internal::Base64Decode(pv.string_value());
     if (!bytes) return std::move(bytes).status();
-    return ProtoMessage<M>(std::string(bytes->begin(), bytes->end()));
+    return ProtoMessage<M>(*std::move(bytes));
   }
   template <typename T, typename V>
   static StatusOr<absl::optional<T>> GetValue(
@@ -800,6 +822,26 @@ struct ValueInternals {
       spanner::Value v) {
     return std::make_pair(std::move(v.type_), std::move(v.value_));
   }
+
+  // Typed access to the protos without materializing a `spanner::Value`.
+  // `TypeProtoIs<T>()` performs the type check that `Value::get<T>()` does
+  // on every call, so that `GetValue<T>()` can be used on many values of a
+  // type that has already been checked.
+  template <typename T>
+  static bool TypeProtoIs(google::spanner::v1::Type const& t) {
+    return spanner::Value::TypeProtoIs(T{}, t);
+  }
+
+  template <typename T>
+  static StatusOr<T> GetValue(google::protobuf::Value&& v,
+                              google::spanner::v1::Type const& t) {
+    if (v.kind_case() == google::protobuf::Value::kNullValue) {
+      if (spanner::Value::IsOptional<T>::value) return T{};
+      return internal::UnknownError("null value", GCP_ERROR_INFO());
+    }
+    auto tag = T{};  // Works around an odd msvc issue
+    return spanner::Value::GetValue(std::move(tag), std::move(v), t);
+  }
 };
 
 inline spanner::Value FromProto(google::spanner::v1::Type t,
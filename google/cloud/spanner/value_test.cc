@@ -873,6 +873,39 @@ TEST(Value, ProtoConversionNumeric) {
   }
 }
 
+TEST(Value, ProtoConversionFixedNumeric) {
+  for (auto const& x : std::vector<FixedNumeric>{
+           MakeFixedNumeric("-0.9e29").value(),
+           MakeFixedNumeric(-1).value(),
+           MakeFixedNumeric("-1.0e-9").value(),
+           FixedNumeric(),
+           MakeFixedNumeric("1.0e-9").value(),
+           MakeFixedNumeric(1U).value(),
+           MakeFixedNumeric("0.9e29").value(),
+       }) {
+    Value const v(x);
+    auto const p = spanner_internal::ToProto(v);
+    EXPECT_EQ(v, spanner_internal::FromProto(p.first, p.second));
+    EXPECT_EQ(google::spanner::v1::TypeCode::NUMERIC, p.first.code());
+    EXPECT_EQ(x.ToString(), p.second.string_value());
+
+    // Both representations share the same Spanner type and wire format.
+    Value const n(ToDecimal(x));
+    EXPECT_EQ(v, n);
+    EXPECT_EQ(x, n.get<FixedNumeric>().value());
+    EXPECT_EQ(ToDecimal(x), v.get<Numeric>().value());
+  }
+
+  auto const nan = MakeFixedPgNumeric("NaN").value();
+  Value const v(nan);
+  auto const p = spanner_internal::ToProto(v);
+  EXPECT_EQ(google::spanner::v1::TypeAnnotationCode::PG_NUMERIC,
+            p.first.type_annotation());
+  EXPECT_EQ("NaN", p.second.string_value());
+  EXPECT_EQ(nan, v.get<FixedPgNumeric>().value());
+  EXPECT_THAT(v.get<FixedNumeric>(), Not(IsOk()));
+}
+
 TEST(Value, ProtoConversionPgOid) {
   for (auto const& x : std::vector<PgOid>{
            PgOid(0),
@@ -14,6 +14,7 @@
 
 #include "google/cloud/storage/async/client.h"
 #include "google/cloud/storage/internal/async/connection_impl.h"
+#include "google/cloud/storage/internal/async/connection_read_cache.h"
 #include "google/cloud/storage/internal/async/connection_tracing.h"
 #include "google/cloud/storage/internal/async/default_options.h"
 #include "google/cloud/storage/internal/grpc/stub.h"
@@ -34,8 +35,9 @@ AsyncClient::AsyncClient(Options options) {
   options = storage_internal::DefaultOptionsAsync(std::move(options));
   background_ = MakeBackgroundThreadsFactory(options)();
   connection_ = storage_internal::MakeTracingAsyncConnection(
-      storage_internal::MakeAsyncConnection(background_->cq(),
-                                            std::move(options)));
+      storage_internal::MakeReadCacheAsyncConnection(
+          storage_internal::MakeAsyncConnection(background_->cq(),
+                                                std::move(options))));
 }
 
 AsyncClient::AsyncClient(std::shared_ptr<AsyncConnection> connection)
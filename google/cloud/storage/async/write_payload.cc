@@ -0,0 +1,44 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/storage/async/write_payload.h"
+#include "google/cloud/storage/internal/memory_mapped_file.h"
+#include "google/cloud/internal/make_status.h"
+#include <utility>
+
+namespace google {
+namespace cloud {
+namespace storage_experimental {
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_BEGIN
+
+StatusOr<WritePayload> MakeWritePayloadFromFile(std::string const& file_name,
+                                                std::uint64_t offset) {
+  auto file = storage::internal::MemoryMappedFile::Open(file_name);
+  if (!file) return std::move(file).status();
+  auto const size = (*file)->size();
+  if (offset > size) {
+    return google::cloud::internal::InvalidArgumentError(
+        "offset (" + std::to_string(offset) +
+            ") is bigger than the size of the file (" + std::to_string(size) +
+            ")",
+        GCP_ERROR_INFO().WithMetadata("gl-cpp.file_name", file_name));
+  }
+  auto const start = static_cast<std::size_t>(offset);
+  return WritePayload((*file)->Subcord(start, size - start));
+}
+
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
+}  // namespace storage_experimental
+}  // namespace cloud
+}  // namespace google
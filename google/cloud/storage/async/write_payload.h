@@ -18,6 +18,7 @@
 #include "google/cloud/storage/internal/async/write_payload_fwd.h"
 #include "google/cloud/storage/internal/grpc/make_cord.h"
 #include "google/cloud/storage/version.h"
+#include "google/cloud/status_or.h"
 #include "absl/strings/cord.h"
 #include <cstdint>
 #include <string>
@@ -83,6 +84,25 @@ class WritePayload {
   absl::Cord impl_;
 };
 
+/**
+ * Creates a payload with the contents of @p file_name, without copying them.
+ *
+ * The file is memory mapped, and the payload references the mapped pages.
+ * With `AsyncClient::StartBufferedUpload()` and other upload functions, the
+ * pages are sent to the service without any copies into user-space buffers.
+ * The payload (and any copies of it) keep the mapping alive.
+ *
+ * The application must not modify or truncate the file while the payload is
+ * in use. Memory mapped files are not supported on Windows, where this
+ * function returns an error with `StatusCode::kUnimplemented`.
+ *
+ * @param file_name the name of the file.
+ * @param offset the payload starts at this offset in the file. Use this to
+ *     resume an upload from the persisted size.
+ */
+StatusOr<WritePayload> MakeWritePayloadFromFile(std::string const& file_name,
+                                                std::uint64_t offset = 0);
+
 GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
 }  // namespace storage_experimental
 }  // namespace cloud
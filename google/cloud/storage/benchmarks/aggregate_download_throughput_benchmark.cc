@@ -14,8 +14,11 @@
 
 #include "google/cloud/storage/benchmarks/aggregate_download_throughput_options.h"
 #include "google/cloud/storage/benchmarks/benchmark_utils.h"
+#include "google/cloud/storage/benchmarks/embedded_server.h"
 #include "google/cloud/storage/client.h"
 #include "google/cloud/storage/grpc_plugin.h"
+#include "google/cloud/common_options.h"
+#include "google/cloud/credentials.h"
 #include "google/cloud/grpc_options.h"
 #include "google/cloud/internal/build_info.h"
 #include "google/cloud/internal/getenv.h"
@@ -32,6 +35,7 @@
 #include <iostream>
 #include <iterator>
 #include <map>
+#include <memory>
 #include <mutex>
 #include <random>
 #include <sstream>
@@ -80,6 +84,11 @@ c) Each thread creates a `gcs::Client`, as configured by the
 d) The thread downloads the objects in its group, discarding their data, but
    capturing the download time, size, status, and peer for each download.
 e) The thread returns the vector of results at the end of the upload.
+
+With `--embedded-server` the program runs against an in-process GCS server,
+using a synthetic dataset of `--embedded-object-count` objects. There is no
+network or service in the measurements. Note that the iteration CPU time
+includes the CPU used by the embedded server.
 )""";
 
 google::cloud::StatusOr<AggregateDownloadThroughputOptions> ParseArgs(
@@ -127,7 +136,7 @@ class Iteration {
 gcs::Client MakeClient(AggregateDownloadThroughputOptions const& options) {
   auto opts = options.client_options;
 #if GOOGLE_CLOUD_CPP_STORAGE_HAVE_GRPC
-  if (options.api == "GRPC") return gcs::MakeGrpcClient();
+  if (options.api == "GRPC") return gcs::MakeGrpcClient(std::move(opts));
 #endif  // GOOGLE_CLOUD_CPP_STORAGE_HAVE_GRPC
   return gcs::Client(std::move(opts));
 }
@@ -147,14 +156,44 @@ int main(int argc, char* argv[]) {
   }
   if (options->exit_after_parse) return 0;
 
+  std::unique_ptr<gcs_bm::EmbeddedServer> server;
+  std::thread server_thread;
+  if (options->embedded_server) {
+    server = gcs_bm::CreateEmbeddedServer();
+    server_thread = std::thread([s = server.get()] { s->Wait(); });
+    options->client_options.set<gcs::RestEndpointOption>(
+        server->rest_endpoint());
+    options->client_options.set<google::cloud::EndpointOption>(
+        server->grpc_address());
+    options->client_options.set<google::cloud::UnifiedCredentialsOption>(
+        google::cloud::MakeInsecureCredentials());
+  }
+
   auto client = MakeClient(*options);
   std::vector<gcs::ObjectMetadata> dataset;
   std::uint64_t dataset_size = 0;
-  for (auto& o : client.ListObjects(options->bucket_name,
-                                    gcs::Prefix(options->object_prefix))) {
-    if (!o) break;
-    dataset_size += o->size();
-    dataset.push_back(*std::move(o));
+  if (server) {
+    // The embedded server cannot list objects, create the dataset directly.
+    for (int i = 0; i != options->embedded_object_count; ++i) {
+      auto name = options->object_prefix + "object-" + std::to_string(i);
+      server->InsertObject(options->bucket_name, name,
+                           options->embedded_object_size);
+      auto o = client.GetObjectMetadata(options->bucket_name, name);
+      if (!o) {
+        std::cerr << "Cannot get metadata for synthetic object " << name
+                  << ": " << o.status() << "\n";
+        return 1;
+      }
+      dataset_size += o->size();
+      dataset.push_back(*std::move(o));
+    }
+  } else {
+    for (auto& o : client.ListObjects(options->bucket_name,
+                                      gcs::Prefix(options->object_prefix))) {
+      if (!o) break;
+      dataset_size += o->size();
+      dataset.push_back(*std::move(o));
+    }
   }
   if (dataset.empty()) {
     std::cerr << "No objects found in bucket " << options->bucket_name
@@ -181,6 +220,7 @@ int main(int argc, char* argv[]) {
             << "\n# API: " << options->api
             << "\n# Client Per Thread: " << std::boolalpha
             << options->client_per_thread
+            << "\n# Embedded Server: " << options->embedded_server
             << "\n# Object Count: " << dataset.size()
             << "\n# Dataset size: " << FormatSize(dataset_size);
   gcs_bm::PrintOptions(std::cout, "Client Options", options->client_options);
@@ -252,6 +292,13 @@ int main(int argc, char* argv[]) {
   for (auto& kv : accumulated) {
     std::cout << "# counter " << kv.first << ": " << kv.second << "\n";
   }
+  if (server) {
+    std::cout << "# Embedded Server Downloads: " << server->download_count()
+              << "\n# Embedded Server Bytes Downloaded: "
+              << server->bytes_downloaded() << "\n";
+    server->Shutdown();
+    server_thread.join();
+  }
   return 0;
 }
 
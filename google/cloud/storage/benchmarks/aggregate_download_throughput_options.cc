@@ -39,6 +39,10 @@ StatusOr<AggregateDownloadThroughputOptions> ValidateOptions(
                                                          std::move(eib));
   };
 
+  // The embedded server accepts any bucket name.
+  if (options.bucket_name.empty() && options.embedded_server) {
+    options.bucket_name = "embedded-server-bucket";
+  }
   if (options.bucket_name.empty()) {
     std::ostringstream os;
     os << "Missing --bucket-name option\n" << usage << "\n";
@@ -63,6 +67,15 @@ StatusOr<AggregateDownloadThroughputOptions> ValidateOptions(
        << "), check your --repeats-per-iteration option\n";
     return make_status(os, GCP_ERROR_INFO());
   }
+  if (options.embedded_server && (options.embedded_object_count <= 0 ||
+                                  options.embedded_object_size < 0)) {
+    std::ostringstream os;
+    os << "Invalid synthetic dataset (" << options.embedded_object_count
+       << " objects of " << options.embedded_object_size
+       << " bytes), check your --embedded-object-count and"
+       << " --embedded-object-size options\n";
+    return make_status(os, GCP_ERROR_INFO());
+  }
   if (options.client_options.get<GrpcNumChannelsOption>() < 0) {
     std::ostringstream os;
     os << "Invalid number of gRPC channels ("
@@ -165,6 +178,26 @@ ParseAggregateDownloadThroughputOptions(std::vector<std::string> const& argv,
          options.client_options.set<gcs::ConnectionPoolSizeOption>(
              std::stoi(val));
        }},
+      {"--embedded-server",
+       "run the benchmark against an in-process GCS server, which returns"
+       " synthetic data. Use this to measure the client library in"
+       " isolation.",
+       [&options](std::string const& val) {
+         options.embedded_server =
+             testing_util::ParseBoolean(val).value_or(true);
+       }},
+      {"--embedded-object-count",
+       "the number of objects in the synthetic dataset, requires"
+       " --embedded-server",
+       [&options](std::string const& val) {
+         options.embedded_object_count = std::stoi(val);
+       }},
+      {"--embedded-object-size",
+       "the size of the objects in the synthetic dataset, requires"
+       " --embedded-server",
+       [&options](std::string const& val) {
+         options.embedded_object_size = ParseSize(val);
+       }},
   };
   auto usage = BuildUsage(desc, argv[0]);
 
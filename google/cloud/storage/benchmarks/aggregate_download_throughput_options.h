@@ -36,6 +36,10 @@ struct AggregateDownloadThroughputOptions {
   std::string api;
   bool client_per_thread = false;
   Options client_options;
+  // Run against an in-process server, with a synthetic dataset.
+  bool embedded_server = false;
+  int embedded_object_count = 32;
+  std::int64_t embedded_object_size = 64 * kMiB;
   bool exit_after_parse = false;
 };
 
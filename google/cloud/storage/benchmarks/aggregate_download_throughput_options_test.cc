@@ -77,6 +77,23 @@ TEST(AggregateDownloadThroughputOptions, Basic) {
   EXPECT_EQ(123, options->client_options.get<gcs::ConnectionPoolSizeOption>());
 }
 
+TEST(AggregateDownloadThroughputOptions, EmbeddedServer) {
+  auto options = ParseAggregateDownloadThroughputOptions(
+      {
+          "self-test",
+          "--embedded-server",
+          "--embedded-object-count=8",
+          "--embedded-object-size=16MiB",
+      },
+      "");
+  ASSERT_STATUS_OK(options);
+  EXPECT_TRUE(options->embedded_server);
+  EXPECT_EQ(8, options->embedded_object_count);
+  EXPECT_EQ(16 * kMiB, options->embedded_object_size);
+  // The embedded server accepts any bucket name.
+  EXPECT_FALSE(options->bucket_name.empty());
+}
+
 TEST(AggregateDownloadThroughputOptions, Description) {
   auto options = ParseAggregateDownloadThroughputOptions(
       {"self-test", "--description", "fake-bucket"}, "Description for test");
@@ -111,6 +128,8 @@ TEST(AggregateDownloadThroughputOptions, Validate) {
       {"self-test", "--bucket-name=b", "--repeats-per-iteration=-1"}, ""));
   EXPECT_FALSE(ParseAggregateDownloadThroughputOptions(
       {"self-test", "--bucket-name=b", "--grpc-channel-count=-1"}, ""));
+  EXPECT_FALSE(ParseAggregateDownloadThroughputOptions(
+      {"self-test", "--embedded-server", "--embedded-object-count=0"}, ""));
 }
 
 }  // namespace
@@ -21,8 +21,11 @@
       GRPC_CPP_VERSION_PATCH >= 4))
 #include "google/cloud/storage/async/client.h"
 #include "google/cloud/storage/benchmarks/benchmark_utils.h"
+#include "google/cloud/storage/benchmarks/embedded_server.h"
 #include "google/cloud/storage/client.h"
 #include "google/cloud/storage/grpc_plugin.h"
+#include "google/cloud/common_options.h"
+#include "google/cloud/credentials.h"
 #include "google/cloud/grpc_options.h"
 #include "google/cloud/internal/absl_str_join_quiet.h"
 #include "google/cloud/internal/build_info.h"
@@ -37,6 +40,7 @@
 #include <iterator>
 #include <map>
 #include <memory>
+#include <optional>
 #include <random>
 #include <set>
 #include <sstream>
@@ -199,11 +203,20 @@ struct Configuration {
   int minimum_read_count = 1;
   int maximum_read_count = 1;
   std::size_t chunk_size = 32 * kMiB;
+  // Only used by the sync clients using gRPC. The async client uploads the
+  // payloads without copying them, so it has no buffers to pool.
+  std::optional<std::size_t> write_buffer_pool_size;
 
   int minimum_concurrency = 1;
   int maximum_concurrency = 1;
   int minimum_background_threads = 1;
   int maximum_background_threads = 1;
+
+  // Run against an in-process server instead of GCS. The endpoints are set
+  // once the server starts.
+  bool embedded_server = false;
+  std::string embedded_grpc_endpoint;
+  std::string embedded_rest_endpoint;
 };
 
 struct ClientConfig {
@@ -308,29 +321,46 @@ auto MapPath(std::string_view path) {
   return std::string("google-c2p:///storage.googleapis.com");
 }
 
+// The options to connect to GCS, or to the embedded server.
+g::Options EndpointOptions(Configuration const& cfg, ClientConfig const& cc) {
+  if (!cfg.embedded_server) {
+    return g::Options{}.set<g::EndpointOption>(MapPath(cc.path));
+  }
+  auto options = g::Options{}.set<g::UnifiedCredentialsOption>(
+      g::MakeInsecureCredentials());
+  if (cc.transport == kJson) {
+    return options.set<gcs::RestEndpointOption>(cfg.embedded_rest_endpoint);
+  }
+  return options.set<g::EndpointOption>(cfg.embedded_grpc_endpoint);
+}
+
 auto MakeAsyncClients(Configuration const& cfg,
                       std::set<ClientConfig> const& clients,
                       int background_threads) {
   std::map<ClientConfig, gcs_ex::AsyncClient> result;
   for (auto const& cc : clients) {
     if (cc.client != kAsyncClientName) continue;
-    result.emplace(
-        cc, gcs_ex::AsyncClient(g::Options()
-                                    .set<g::GrpcBackgroundThreadPoolSizeOption>(
-                                        background_threads)
-                                    .set<g::EndpointOption>(MapPath(cc.path))));
+    result.emplace(cc, gcs_ex::AsyncClient(
+                           EndpointOptions(cfg, cc)
+                               .set<g::GrpcBackgroundThreadPoolSizeOption>(
+                                   background_threads)));
   }
   return result;
 }
 
-auto MakeClient(ClientConfig const& cc, int background_threads) {
+auto MakeClient(Configuration const& cfg, ClientConfig const& cc,
+                int background_threads) {
   if (cc.transport == "GRPC") {
-    return gcs::MakeGrpcClient(
-        g::Options{}
-            .set<g::GrpcBackgroundThreadPoolSizeOption>(background_threads)
-            .set<g::EndpointOption>(MapPath(cc.path)));
+    auto options = EndpointOptions(cfg, cc)
+                       .set<g::GrpcBackgroundThreadPoolSizeOption>(
+                           background_threads);
+    if (cfg.write_buffer_pool_size) {
+      options.set<gcs_ex::GrpcWriteBufferPoolSizeOption>(
+          *cfg.write_buffer_pool_size);
+    }
+    return gcs::MakeGrpcClient(std::move(options));
   }
-  return gcs::Client(g::Options{}.set<g::EndpointOption>(MapPath(cc.path)));
+  return gcs::Client(EndpointOptions(cfg, cc));
 }
 
 auto MakeSyncClients(Configuration const& cfg,
@@ -339,7 +369,7 @@ auto MakeSyncClients(Configuration const& cfg,
   std::map<ClientConfig, gcs::Client> result;
   for (auto const& cc : clients) {
     if (cc.client != kSyncClientName) continue;
-    result.emplace(cc, MakeClient(cc, background_threads));
+    result.emplace(cc, MakeClient(cfg, cc, background_threads));
   }
   return result;
 }
@@ -749,10 +779,16 @@ void RunBenchmark(Configuration const& cfg) {
             << "\n# Clients: " << absl::StrJoin(cfg.clients, ", ")        //
             << "\n# Transports: " << absl::StrJoin(cfg.transports, ", ")  //
             << "\n# Paths: " << absl::StrJoin(cfg.paths, ", ")            //
+            << "\n# Embedded Server: " << std::boolalpha                  //
+            << cfg.embedded_server                                        //
             << "\n# Minimum Write Count: " << cfg.minimum_write_count     //
             << "\n# Maximum Write Count: " << cfg.maximum_write_count     //
             << "\n# Minimum Read Count: " << cfg.minimum_read_count       //
             << "\n# Maximum Read Count: " << cfg.maximum_read_count       //
+            << "\n# Write Buffer Pool Size: "                             //
+            << (cfg.write_buffer_pool_size                                //
+                    ? FormatSize(*cfg.write_buffer_pool_size)             //
+                    : std::string("default"))                             //
             << "\n# Compiler: " << g::internal::compiler()                //
             << "\n# Flags: " << g::internal::compiler_flags()             //
             << std::endl;
@@ -766,7 +802,8 @@ void RunBenchmark(Configuration const& cfg) {
   std::cout << Header() << "\n";
   auto last_upload = std::chrono::steady_clock::now();
 
-  auto delete_client = gcs_ex::AsyncClient();
+  auto delete_client = gcs_ex::AsyncClient(
+      EndpointOptions(cfg, ClientConfig{kAsyncClientName, kGrpc, "CP"}));
   std::vector<g::future<void>> pending_deletes;
   auto delete_all = [](gcs_ex::AsyncClient client, std::string bucket,
                        std::vector<std::string> names) -> g::future<void> {
@@ -881,6 +918,12 @@ Configuration ParseArgs(std::vector<std::string> argv) {
        }},
       {"--chunk-size", "select the upload chunk size",
        [&cfg](std::string const& v) { cfg.chunk_size = ParseSize(v); }},
+      {"--write-buffer-pool-size",
+       "configure the size of the upload buffer pool in the sync gRPC clients,"
+       " 0 disables the pool",
+       [&cfg](std::string const& v) {
+         cfg.write_buffer_pool_size = ParseSize(v);
+       }},
       {"--clients", "select the clients",
        [&cfg](std::string const& v) { cfg.clients = absl::StrSplit(v, ','); }},
       {"--transports", "select the transports",
@@ -919,6 +962,13 @@ Configuration ParseArgs(std::vector<std::string> argv) {
        [&cfg](std::string const& v) {
          cfg.maximum_background_threads = std::stoi(v);
        }},
+      {"--embedded-server",
+       "run the benchmark against an in-process GCS server, which discards"
+       " uploads and returns synthetic data. Use this to measure the client"
+       " library in isolation.",
+       [&cfg](std::string const& v) {
+         cfg.embedded_server = ParseBoolean(v).value_or(true);
+       }},
   };
   auto usage = google::cloud::testing_util::BuildUsage(desc, argv[0]);
   google::cloud::testing_util::OptionsParse(desc, std::move(argv));
@@ -930,6 +980,11 @@ Configuration ParseArgs(std::vector<std::string> argv) {
     std::cerr << kDescription << "\n";
     std::exit(0);
   }
+  if (cfg.embedded_server) {
+    // The embedded server accepts any bucket name, and has no DirectPath.
+    if (cfg.bucket.empty()) cfg.bucket = "embedded-server-bucket";
+    cfg.paths = {"CP"};
+  }
   if (cfg.bucket.empty()) {
     throw std::invalid_argument("empty value for --bucket option");
   }
@@ -939,7 +994,24 @@ Configuration ParseArgs(std::vector<std::string> argv) {
 }  // namespace
 
 int main(int argc, char* argv[]) try {
-  RunBenchmark(ParseArgs({argv, argv + argc}));
+  namespace gcs_bm = ::google::cloud::storage_benchmarks;
+  auto cfg = ParseArgs({argv, argv + argc});
+  std::unique_ptr<gcs_bm::EmbeddedServer> server;
+  std::thread server_thread;
+  if (cfg.embedded_server) {
+    server = gcs_bm::CreateEmbeddedServer();
+    server_thread = std::thread([s = server.get()] { s->Wait(); });
+    cfg.embedded_grpc_endpoint = server->grpc_address();
+    cfg.embedded_rest_endpoint = server->rest_endpoint();
+  }
+  RunBenchmark(cfg);
+  if (server) {
+    std::cout << "# Embedded Server Uploads: " << server->upload_count()
+              << "\n# Embedded Server Downloads: " << server->download_count()
+              << "\n";
+    server->Shutdown();
+    server_thread.join();
+  }
   return 0;
 } catch (google::cloud::Status const& ex) {
   std::cerr << "Status error caught " << ex << "\n";
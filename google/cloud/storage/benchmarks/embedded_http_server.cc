@@ -0,0 +1,673 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/storage/benchmarks/embedded_http_server.h"
+#include "google/cloud/storage/internal/base64.h"
+#include "google/cloud/internal/absl_str_join_quiet.h"
+#include "google/cloud/internal/format_time_point.h"
+#include "google/cloud/internal/make_status.h"
+#include "google/cloud/internal/throw_delegate.h"
+#include "google/cloud/internal/url_encode.h"
+#include "absl/strings/ascii.h"
+#include "absl/strings/match.h"
+#include "absl/strings/numbers.h"
+#include "absl/strings/str_split.h"
+#include <nlohmann/json.hpp>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <utility>
+
+namespace google {
+namespace cloud {
+namespace storage_benchmarks {
+
+namespace {
+
+using Object = SyntheticObjectStore::Object;
+using Checksums = SyntheticObjectStore::Checksums;
+using Upload = SyntheticObjectStore::Upload;
+
+struct HttpRequest {
+  std::string method;
+  std::vector<std::string> path;
+  std::map<std::string, std::string> query;
+  // The header names are converted to lowercase.
+  std::map<std::string, std::string> headers;
+  std::string payload;
+
+  std::string Header(std::string const& name) const {
+    auto i = headers.find(name);
+    return i == headers.end() ? std::string{} : i->second;
+  }
+  std::string Query(std::string const& name) const {
+    auto i = query.find(name);
+    return i == query.end() ? std::string{} : i->second;
+  }
+};
+
+struct HttpResponse {
+  int status_code = 200;
+  std::vector<std::pair<std::string, std::string>> headers;
+  std::string payload;
+  // Some responses include a range of synthetic data instead of a payload.
+  std::int64_t data_offset = 0;
+  std::int64_t data_length = 0;
+};
+
+char const* ReasonPhrase(int status_code) {
+  switch (status_code) {
+    case 200:
+      return "OK";
+    case 204:
+      return "No Content";
+    case 206:
+      return "Partial Content";
+    case 308:
+      return "Resume Incomplete";
+    case 400:
+      return "Bad Request";
+    case 404:
+      return "Not Found";
+    case 405:
+      return "Method Not Allowed";
+    case 412:
+      return "Precondition Failed";
+    case 416:
+      return "Requested Range Not Satisfiable";
+    case 499:
+      return "Client Closed Request";
+    case 501:
+      return "Not Implemented";
+    default:
+      break;
+  }
+  return "Internal Server Error";
+}
+
+HttpResponse ErrorResponse(Status const& status) {
+  auto code = [&] {
+    switch (status.code()) {
+      case StatusCode::kInvalidArgument:
+        return 400;
+      case StatusCode::kNotFound:
+        return 404;
+      case StatusCode::kFailedPrecondition:
+        return 412;
+      case StatusCode::kOutOfRange:
+        return 416;
+      case StatusCode::kUnimplemented:
+        return 501;
+      default:
+        break;
+    }
+    return 500;
+  }();
+  HttpResponse response;
+  response.status_code = code;
+  response.headers.emplace_back("Content-Type", "application/json");
+  response.payload =
+      nlohmann::json{
+          {"error", {{"code", code}, {"message", status.message()}}}}
+          .dump();
+  return response;
+}
+
+HttpResponse ErrorResponse(int code, std::string message) {
+  auto response = ErrorResponse(
+      google::cloud::internal::UnknownError(message, GCP_ERROR_INFO()));
+  response.status_code = code;
+  return response;
+}
+
+std::string Crc32cToBase64(std::uint32_t crc32c) {
+  std::array<std::uint8_t, 4> bytes{
+      static_cast<std::uint8_t>((crc32c >> 24) & 0xFF),
+      static_cast<std::uint8_t>((crc32c >> 16) & 0xFF),
+      static_cast<std::uint8_t>((crc32c >> 8) & 0xFF),
+      static_cast<std::uint8_t>(crc32c & 0xFF),
+  };
+  return storage::internal::Base64Encode(bytes);
+}
+
+absl::optional<std::uint32_t> Crc32cFromBase64(std::string const& value) {
+  auto bytes = storage::internal::Base64Decode(value);
+  if (!bytes || bytes->size() != 4) return absl::nullopt;
+  std::uint32_t crc32c = 0;
+  for (auto b : *bytes) crc32c = (crc32c << 8) | b;
+  return crc32c;
+}
+
+std::string Md5FromBase64(std::string const& value) {
+  auto bytes = storage::internal::Base64Decode(value);
+  if (!bytes) return {};
+  return std::string(bytes->begin(), bytes->end());
+}
+
+std::string ObjectJson(Object const& object, Checksums const& checksums) {
+  auto const now =
+      google::cloud::internal::FormatRfc3339(std::chrono::system_clock::now());
+  auto json = nlohmann::json{
+      {"kind", "storage#object"},
+      {"id", object.bucket + "/" + object.name + "/" +
+                 std::to_string(object.generation)},
+      {"bucket", object.bucket},
+      {"name", object.name},
+      {"generation", std::to_string(object.generation)},
+      {"metageneration", std::to_string(object.metageneration)},
+      {"size", std::to_string(object.size)},
+      {"contentType", "application/octet-stream"},
+      {"storageClass", "STANDARD"},
+      {"timeCreated", now},
+      {"updated", now},
+      {"crc32c", Crc32cToBase64(checksums.crc32c)},
+  };
+  if (!checksums.md5.empty()) {
+    json["md5Hash"] = storage::internal::Base64Encode(checksums.md5);
+  }
+  return json.dump();
+}
+
+HttpResponse JsonResponse(std::string payload) {
+  HttpResponse response;
+  response.headers.emplace_back("Content-Type",
+                                "application/json; charset=UTF-8");
+  response.payload = std::move(payload);
+  return response;
+}
+
+HttpResponse UploadResponse(StatusOr<Upload> const& upload) {
+  if (!upload) return ErrorResponse(upload.status());
+  if (upload->object.has_value()) {
+    return JsonResponse(ObjectJson(*upload->object, upload->checksums));
+  }
+  HttpResponse response;
+  response.status_code = 308;
+  if (upload->persisted_size != 0) {
+    response.headers.emplace_back(
+        "Range", "bytes=0-" + std::to_string(upload->persisted_size - 1));
+  }
+  return response;
+}
+
+HttpResponse Download(SyntheticObjectStore& store, HttpRequest const& request,
+                      std::string const& bucket, std::string const& name) {
+  auto object = store.GetObject(bucket, name);
+  if (!object) return ErrorResponse(object.status());
+  auto const size = object->size;
+
+  HttpResponse response;
+  std::int64_t begin = 0;
+  std::int64_t end = size;
+  auto const range = request.Header("range");
+  if (!range.empty()) {
+    std::pair<std::string, std::string> p =
+        absl::StrSplit(absl::StripPrefix(range, "bytes="), '-');
+    std::int64_t first = 0;
+    std::int64_t last = 0;
+    auto const has_first = absl::SimpleAtoi(p.first, &first);
+    auto const has_last = absl::SimpleAtoi(p.second, &last);
+    if (has_first && has_last) {
+      begin = first;
+      end = (std::min)(last + 1, size);
+    } else if (has_first && p.second.empty()) {
+      begin = first;
+    } else if (p.first.empty() && has_last) {
+      begin = (std::max)(std::int64_t{0}, size - last);
+    } else {
+      return ErrorResponse(400, "invalid range header <" + range + ">");
+    }
+    if (begin >= size && size != 0) {
+      return ErrorResponse(416, "range <" + range + "> is not satisfiable");
+    }
+    end = (std::max)(begin, end);
+    response.status_code = 206;
+    response.headers.emplace_back(
+        "Content-Range", "bytes " + std::to_string(begin) + "-" +
+                             std::to_string(end - 1) + "/" +
+                             std::to_string(size));
+  }
+
+  auto const checksums = store.ObjectChecksums(size);
+  auto hash = "crc32c=" + Crc32cToBase64(checksums.crc32c);
+  if (!checksums.md5.empty()) {
+    hash += ",md5=" + storage::internal::Base64Encode(checksums.md5);
+  }
+  response.headers.emplace_back("Content-Type", "application/octet-stream");
+  response.headers.emplace_back("x-goog-generation",
+                                std::to_string(object->generation));
+  response.headers.emplace_back("x-goog-metageneration",
+                                std::to_string(object->metageneration));
+  response.headers.emplace_back("x-goog-storage-class", "STANDARD");
+  response.headers.emplace_back("x-goog-stored-content-encoding", "identity");
+  response.headers.emplace_back("x-goog-stored-content-length",
+                                std::to_string(size));
+  response.headers.emplace_back("x-goog-hash", std::move(hash));
+  response.data_offset = begin;
+  response.data_length = end - begin;
+  store.RecordDownload(response.data_length);
+  return response;
+}
+
+HttpResponse ObjectRequest(SyntheticObjectStore& store,
+                           HttpRequest const& request,
+                           std::string const& bucket,
+                           std::string const& name) {
+  if (request.method == "GET" && request.Query("alt") == "media") {
+    return Download(store, request, bucket, name);
+  }
+  if (request.method == "GET") {
+    auto object = store.GetObject(bucket, name);
+    if (!object) return ErrorResponse(object.status());
+    return JsonResponse(
+        ObjectJson(*object, store.ObjectChecksums(object->size)));
+  }
+  if (request.method == "DELETE") {
+    auto status = store.DeleteObject(bucket, name);
+    if (!status.ok()) return ErrorResponse(status);
+    HttpResponse response;
+    response.status_code = 204;
+    return response;
+  }
+  return ErrorResponse(405, "unsupported method " + request.method);
+}
+
+// Returns the (first, last, total) values in a `Content-Range` header. Any
+// `*` values are represented as -1.
+std::array<std::int64_t, 3> ParseContentRange(std::string const& value) {
+  std::array<std::int64_t, 3> result{-1, -1, -1};
+  std::pair<std::string, std::string> p =
+      absl::StrSplit(absl::StripPrefix(value, "bytes "), '/');
+  std::pair<std::string, std::string> r = absl::StrSplit(p.first, '-');
+  if (!absl::SimpleAtoi(r.first, &result[0]) ||
+      !absl::SimpleAtoi(r.second, &result[1])) {
+    result[0] = result[1] = -1;
+  }
+  if (!absl::SimpleAtoi(p.second, &result[2])) result[2] = -1;
+  return result;
+}
+
+HttpResponse ResumableUpload(SyntheticObjectStore& store,
+                             HttpRequest const& request,
+                             std::string const& upload_id) {
+  if (request.method == "DELETE") {
+    auto status = store.CancelUpload(upload_id);
+    if (!status.ok()) return ErrorResponse(status);
+    HttpResponse response;
+    response.status_code = 499;
+    return response;
+  }
+  if (request.method != "PUT") {
+    return ErrorResponse(405, "unsupported method " + request.method);
+  }
+  auto const content_range = request.Header("content-range");
+  if (content_range.empty()) {
+    auto upload = store.AppendUpload(upload_id, 0, request.payload);
+    if (!upload) return ErrorResponse(upload.status());
+    return UploadResponse(store.FinalizeUpload(upload_id));
+  }
+  auto const range = ParseContentRange(content_range);
+  auto upload = store.QueryUpload(upload_id);
+  if (range[0] >= 0) {
+    upload = store.AppendUpload(upload_id, range[0], request.payload);
+  }
+  if (!upload) return ErrorResponse(upload.status());
+  if (range[2] >= 0 && upload->persisted_size == range[2]) {
+    return UploadResponse(store.FinalizeUpload(upload_id));
+  }
+  return UploadResponse(std::move(upload));
+}
+
+HttpResponse MultipartUpload(SyntheticObjectStore& store,
+                             HttpRequest const& request,
+                             std::string const& bucket) {
+  auto const content_type = request.Header("content-type");
+  auto const pos = content_type.find("boundary=");
+  if (pos == std::string::npos) {
+    return ErrorResponse(400, "missing boundary in multipart upload");
+  }
+  auto const marker =
+      "--" + content_type.substr(pos + std::strlen("boundary="));
+  // The payload is: marker, headers, metadata, marker, headers, data, marker.
+  absl::string_view payload = request.payload;
+  auto const metadata_start = payload.find("\r\n\r\n");
+  auto const metadata_end = payload.find("\r\n" + marker, metadata_start);
+  auto const data_start = payload.find("\r\n\r\n", metadata_end + 2);
+  auto const data_end = payload.rfind("\r\n" + marker + "--");
+  if (metadata_start == absl::string_view::npos ||
+      metadata_end == absl::string_view::npos ||
+      data_start == absl::string_view::npos ||
+      data_end == absl::string_view::npos || data_end < data_start + 4) {
+    return ErrorResponse(400, "cannot parse multipart upload");
+  }
+  auto metadata = nlohmann::json::parse(
+      payload.substr(metadata_start + 4, metadata_end - metadata_start - 4),
+      nullptr, false);
+  if (!metadata.is_object()) {
+    return ErrorResponse(400, "invalid metadata in multipart upload");
+  }
+  auto name = metadata.value("name", request.Query("name"));
+  auto crc32c = Crc32cFromBase64(metadata.value("crc32c", ""));
+  auto md5 = Md5FromBase64(metadata.value("md5Hash", ""));
+  auto const id = store.StartUpload(bucket, std::move(name));
+  auto upload = store.AppendUpload(
+      id, 0, payload.substr(data_start + 4, data_end - data_start - 4));
+  if (!upload) return ErrorResponse(upload.status());
+  return UploadResponse(
+      store.FinalizeUpload(id, std::move(crc32c), std::move(md5)));
+}
+
+HttpResponse UploadRequest(SyntheticObjectStore& store,
+                           HttpRequest const& request,
+                           std::string const& bucket,
+                           std::string const& endpoint) {
+  auto const upload_id = request.Query("upload_id");
+  if (!upload_id.empty()) return ResumableUpload(store, request, upload_id);
+  if (request.method != "POST") {
+    return ErrorResponse(405, "unsupported method " + request.method);
+  }
+  auto const upload_type = request.Query("uploadType");
+  if (upload_type == "multipart") {
+    return MultipartUpload(store, request, bucket);
+  }
+  if (upload_type == "media") {
+    auto const id = store.StartUpload(bucket, request.Query("name"));
+    auto upload = store.AppendUpload(id, 0, request.payload);
+    if (!upload) return ErrorResponse(upload.status());
+    return UploadResponse(store.FinalizeUpload(id));
+  }
+  if (upload_type == "resumable") {
+    auto name = request.Query("name");
+    if (name.empty() && !request.payload.empty()) {
+      auto resource = nlohmann::json::parse(request.payload, nullptr, false);
+      if (resource.is_object()) name = resource.value("name", "");
+    }
+    auto const id = store.StartUpload(bucket, std::move(name));
+    HttpResponse response;
+    response.headers.emplace_back(
+        "Location", endpoint + "/upload/storage/v1/b/" + bucket +
+                        "/o?uploadType=resumable&upload_id=" + id);
+    return response;
+  }
+  return ErrorResponse(400, "unsupported uploadType <" + upload_type + ">");
+}
+
+HttpResponse Dispatch(SyntheticObjectStore& store, HttpRequest const& request,
+                      std::string const& endpoint) {
+  auto const& p = request.path;
+  // JSON API: /upload/storage/v1/b/{bucket}/o
+  if (p.size() == 6 && p[0] == "upload" && p[1] == "storage" && p[3] == "b" &&
+      p[5] == "o") {
+    return UploadRequest(store, request, p[4], endpoint);
+  }
+  // JSON API: /storage/v1/b/{bucket}/o/{object}
+  if (p.size() == 6 && p[0] == "storage" && p[2] == "b" && p[4] == "o") {
+    return ObjectRequest(store, request, p[3], p[5]);
+  }
+  // XML API: /{bucket}/{object}, where the object name may contain `/`.
+  if (p.size() >= 2 && p[0] != "storage" && p[0] != "upload" &&
+      request.method == "GET") {
+    std::vector<std::string> name(std::next(p.begin()), p.end());
+    return Download(store, request, p[0], absl::StrJoin(name, "/"));
+  }
+  return ErrorResponse(404, "unknown path");
+}
+
+/// Buffered I/O for a single connection.
+class Connection {
+ public:
+  explicit Connection(int fd) : fd_(fd) {}
+
+  bool ReadRequest(HttpRequest& request) {
+    std::string line;
+    if (!ReadLine(line)) return false;
+    std::vector<std::string> start = absl::StrSplit(line, ' ');
+    if (start.size() != 3) return false;
+    request.method = start[0];
+    std::pair<std::string, std::string> target =
+        absl::StrSplit(start[1], absl::MaxSplits('?', 1));
+    for (auto const& s : absl::StrSplit(target.first, '/', absl::SkipEmpty())) {
+      request.path.push_back(google::cloud::internal::UrlDecode(s));
+    }
+    for (auto const& kv :
+         absl::StrSplit(target.second, '&', absl::SkipEmpty())) {
+      std::pair<std::string, std::string> p =
+          absl::StrSplit(kv, absl::MaxSplits('=', 1));
+      request.query[google::cloud::internal::UrlDecode(p.first)] =
+          google::cloud::internal::UrlDecode(p.second);
+    }
+    for (;;) {
+      if (!ReadLine(line)) return false;
+      if (line.empty()) break;
+      auto const colon = line.find(':');
+      if (colon == std::string::npos) return false;
+      request.headers[absl::AsciiStrToLower(line.substr(0, colon))] =
+          std::string(absl::StripAsciiWhitespace(line.substr(colon + 1)));
+    }
+    if (request.Header("expect") == "100-continue") {
+      if (!Write("HTTP/1.1 100 Continue\r\n\r\n")) return false;
+    }
+    if (request.Header("transfer-encoding") == "chunked") {
+      return ReadChunked(request.payload);
+    }
+    std::size_t length = 0;
+    auto const content_length = request.Header("content-length");
+    if (!content_length.empty() && !absl::SimpleAtoi(content_length, &length)) {
+      return false;
+    }
+    return ReadExact(length, request.payload);
+  }
+
+  bool Write(absl::string_view data) {
+    while (!data.empty()) {
+      auto n = ::send(fd_, data.data(), data.size(), MSG_NOSIGNAL);
+      if (n <= 0) return false;
+      data.remove_prefix(static_cast<std::size_t>(n));
+    }
+    return true;
+  }
+
+ private:
+  bool Fill() {
+    if (pos_ != 0) {
+      buffer_.erase(0, pos_);
+      pos_ = 0;
+    }
+    auto const size = buffer_.size();
+    buffer_.resize(size + kReadSize);
+    auto n = ::recv(fd_, &buffer_[size], kReadSize, 0);
+    buffer_.resize(size + static_cast<std::size_t>((std::max)(n, ssize_t{0})));
+    return n > 0;
+  }
+
+  bool ReadLine(std::string& line) {
+    for (;;) {
+      auto const eol = buffer_.find("\r\n", pos_);
+      if (eol != std::string::npos) {
+        line = buffer_.substr(pos_, eol - pos_);
+        pos_ = eol + 2;
+        return true;
+      }
+      if (!Fill()) return false;
+    }
+  }
+
+  bool ReadExact(std::size_t length, std::string& out) {
+    while (buffer_.size() - pos_ < length) {
+      if (!Fill()) return false;
+    }
+    out.append(buffer_, pos_, length);
+    pos_ += length;
+    return true;
+  }
+
+  bool ReadChunked(std::string& out) {
+    std::string line;
+    for (;;) {
+      if (!ReadLine(line)) return false;
+      char* end = nullptr;
+      auto const length =
+          static_cast<std::size_t>(std::strtoull(line.c_str(), &end, 16));
+      if (end == line.c_str()) return false;
+      if (length == 0) break;
+      if (!ReadExact(length, out) || !ReadLine(line)) return false;
+    }
+    // Skip any trailers.
+    do {
+      if (!ReadLine(line)) return false;
+    } while (!line.empty());
+    return true;
+  }
+
+  static std::size_t constexpr kReadSize = 1024 * 1024;
+  int fd_;
+  std::string buffer_;
+  std::size_t pos_ = 0;
+};
+
+bool WriteResponse(Connection& connection, SyntheticObjectStore const& store,
+                   HttpResponse const& response) {
+  auto const length = response.payload.empty()
+                          ? response.data_length
+                          : static_cast<std::int64_t>(response.payload.size());
+  std::string header = "HTTP/1.1 " + std::to_string(response.status_code) +
+                       " " + ReasonPhrase(response.status_code) + "\r\n";
+  for (auto const& h : response.headers) {
+    header += h.first + ": " + h.second + "\r\n";
+  }
+  header += "Content-Length: " + std::to_string(length) + "\r\n\r\n";
+  // Send small payloads in a single write, this avoids some latency.
+  if (!response.payload.empty()) {
+    return connection.Write(header + response.payload);
+  }
+  if (!connection.Write(header)) return false;
+  auto const end = response.data_offset + response.data_length;
+  for (auto offset = response.data_offset; offset < end;) {
+    auto contents = store.Contents(offset, end - offset);
+    if (!connection.Write(contents)) return false;
+    offset += static_cast<std::int64_t>(contents.size());
+  }
+  return true;
+}
+
+}  // namespace
+
+EmbeddedHttpServer::EmbeddedHttpServer(
+    std::shared_ptr<SyntheticObjectStore> store)
+    : store_(std::move(store)) {
+  listen_fd_ = ::socket(AF_INET, SOCK_STREAM, 0);
+  if (listen_fd_ < 0) {
+    google::cloud::internal::ThrowRuntimeError("cannot create socket");
+  }
+  int enable = 1;
+  (void)::setsockopt(listen_fd_, SOL_SOCKET, SO_REUSEADDR, &enable,
+                     sizeof(enable));
+  sockaddr_in address{};
+  address.sin_family = AF_INET;
+  address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  address.sin_port = 0;
+  socklen_t length = sizeof(address);
+  if (::bind(listen_fd_, reinterpret_cast<sockaddr*>(&address), length) != 0 ||
+      ::listen(listen_fd_, SOMAXCONN) != 0 ||
+      ::getsockname(listen_fd_, reinterpret_cast<sockaddr*>(&address),
+                    &length) != 0) {
+    ::close(listen_fd_);
+    google::cloud::internal::ThrowRuntimeError(
+        "cannot listen on a local port");
+  }
+  endpoint_ = "http://127.0.0.1:" + std::to_string(ntohs(address.sin_port));
+  accept_thread_ = std::thread([this] { AcceptLoop(); });
+}
+
+EmbeddedHttpServer::~EmbeddedHttpServer() {
+  Shutdown();
+  Wait();
+  ::close(listen_fd_);
+}
+
+void EmbeddedHttpServer::Shutdown() {
+  if (shutdown_.exchange(true)) return;
+  // Wakes up any threads blocked in `accept()`, `recv()` or `send()`.
+  ::shutdown(listen_fd_, SHUT_RDWR);
+  std::lock_guard<std::mutex> lk(mu_);
+  for (auto fd : connections_) ::shutdown(fd, SHUT_RDWR);
+}
+
+void EmbeddedHttpServer::Wait() {
+  if (accept_thread_.joinable()) accept_thread_.join();
+  std::map<std::thread::id, std::thread> threads;
+  std::vector<std::thread> finished;
+  {
+    std::lock_guard<std::mutex> lk(mu_);
+    threads.swap(threads_);
+    finished.swap(finished_);
+  }
+  for (auto& kv : threads) kv.second.join();
+  for (auto& t : finished) t.join();
+}
+
+void EmbeddedHttpServer::AcceptLoop() {
+  while (!shutdown_.load()) {
+    auto fd = ::accept(listen_fd_, nullptr, nullptr);
+    if (fd < 0) continue;
+    int enable = 1;
+    (void)::setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &enable, sizeof(enable));
+    std::unique_lock<std::mutex> lk(mu_);
+    if (shutdown_.load()) {
+      ::close(fd);
+      break;
+    }
+    connections_.insert(fd);
+    // The new thread cannot finish before it is inserted, as it needs `mu_`.
+    std::thread t([this, fd] { HandleConnection(fd); });
+    auto const id = t.get_id();
+    threads_.emplace(id, std::move(t));
+    // Join the threads for any closed connections, otherwise a long-running
+    // benchmark that opens many connections accumulates them.
+    std::vector<std::thread> finished;
+    finished.swap(finished_);
+    lk.unlock();
+    for (auto& f : finished) f.join();
+  }
+}
+
+void EmbeddedHttpServer::HandleConnection(int fd) {
+  Connection connection(fd);
+  for (;;) {
+    HttpRequest request;
+    if (!connection.ReadRequest(request)) break;
+    auto const response = Dispatch(*store_, request, endpoint_);
+    if (!WriteResponse(connection, *store_, response)) break;
+    if (absl::EqualsIgnoreCase(request.Header("connection"), "close")) break;
+  }
+  std::lock_guard<std::mutex> lk(mu_);
+  connections_.erase(fd);
+  ::close(fd);
+  // `Wait()` joins this thread if it already took ownership of it.
+  auto self = threads_.find(std::this_thread::get_id());
+  if (self == threads_.end()) return;
+  finished_.push_back(std::move(self->second));
+  threads_.erase(self);
+}
+
+}  // namespace storage_benchmarks
+}  // namespace cloud
+}  // namespace google
@@ -0,0 +1,85 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GOOGLE_CLOUD_CPP_GOOGLE_CLOUD_STORAGE_BENCHMARKS_EMBEDDED_HTTP_SERVER_H
+#define GOOGLE_CLOUD_CPP_GOOGLE_CLOUD_STORAGE_BENCHMARKS_EMBEDDED_HTTP_SERVER_H
+
+#include "google/cloud/storage/benchmarks/synthetic_object_store.h"
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace google {
+namespace cloud {
+namespace storage_benchmarks {
+
+/**
+ * A minimal HTTP/1.1 server for the GCS JSON and XML APIs.
+ *
+ * The server implements just enough of the protocol to support the REST
+ * transport in the client library (and libcurl): persistent connections,
+ * requests with a `Content-Length` or chunked payloads, and responses with a
+ * `Content-Length`. Each connection is handled by a separate thread, which is
+ * joined once the connection closes.
+ *
+ * The server supports:
+ * - Object downloads, using the JSON API (`?alt=media`) or the XML API, with
+ *   optional `Range` headers.
+ * - Object metadata reads and deletes.
+ * - Simple, multipart, and resumable uploads.
+ */
+class EmbeddedHttpServer {
+ public:
+  explicit EmbeddedHttpServer(std::shared_ptr<SyntheticObjectStore> store);
+  ~EmbeddedHttpServer();
+
+  EmbeddedHttpServer(EmbeddedHttpServer const&) = delete;
+  EmbeddedHttpServer& operator=(EmbeddedHttpServer const&) = delete;
+
+  /// The endpoint for `storage::RestEndpointOption`, e.g. `http://...:port`.
+  std::string endpoint() const { return endpoint_; }
+
+  /// Stop accepting connections and close any open connections.
+  void Shutdown();
+
+  /// Wait until all the server threads terminate, requires `Shutdown()`.
+  void Wait();
+
+ private:
+  void AcceptLoop();
+  void HandleConnection(int fd);
+
+  std::shared_ptr<SyntheticObjectStore> store_;
+  int listen_fd_ = -1;
+  std::string endpoint_;
+  std::atomic<bool> shutdown_{false};
+
+  std::mutex mu_;
+  std::set<int> connections_;
+  std::map<std::thread::id, std::thread> threads_;
+  // The threads for closed connections, waiting to be joined.
+  std::vector<std::thread> finished_;
+  std::thread accept_thread_;
+};
+
+}  // namespace storage_benchmarks
+}  // namespace cloud
+}  // namespace google
+
+#endif  // GOOGLE_CLOUD_CPP_GOOGLE_CLOUD_STORAGE_BENCHMARKS_EMBEDDED_HTTP_SERVER_H
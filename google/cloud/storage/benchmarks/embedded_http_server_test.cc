@@ -0,0 +1,151 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/storage/benchmarks/embedded_http_server.h"
+#include "google/cloud/storage/client.h"
+#include "google/cloud/credentials.h"
+#include "google/cloud/testing_util/status_matchers.h"
+#include <gmock/gmock.h>
+#include <iterator>
+#include <string>
+
+namespace google {
+namespace cloud {
+namespace storage_benchmarks {
+namespace {
+
+namespace gcs = ::google::cloud::storage;
+using ::google::cloud::testing_util::StatusIs;
+
+auto constexpr kBucketName = "test-bucket";
+
+gcs::Client MakeClient(EmbeddedHttpServer const& server) {
+  return gcs::Client(
+      Options{}
+          .set<gcs::RestEndpointOption>(server.endpoint())
+          .set<UnifiedCredentialsOption>(MakeInsecureCredentials())
+          .set<gcs::RetryPolicyOption>(
+              gcs::LimitedErrorCountRetryPolicy(0).clone()));
+}
+
+std::string ReadAll(gcs::ObjectReadStream& reader) {
+  return std::string{std::istreambuf_iterator<char>{reader}, {}};
+}
+
+/// The expected contents of a synthetic object, or a range within one.
+std::string Expected(SyntheticObjectStore const& store, std::int64_t offset,
+                     std::int64_t length) {
+  std::string result;
+  for (auto end = offset + length; offset < end;) {
+    auto contents = store.Contents(offset, end - offset);
+    result.append(contents.data(), contents.size());
+    offset += static_cast<std::int64_t>(contents.size());
+  }
+  return result;
+}
+
+TEST(EmbeddedHttpServer, InsertAndRead) {
+  auto store = std::make_shared<SyntheticObjectStore>(/*md5_hashes=*/true);
+  EmbeddedHttpServer server(store);
+  auto client = MakeClient(server);
+
+  auto const data = std::string(1024, 'A');
+  auto insert = client.InsertObject(kBucketName, "test-object", data,
+                                    gcs::EnableMD5Hash());
+  ASSERT_STATUS_OK(insert);
+  EXPECT_EQ(insert->bucket(), kBucketName);
+  EXPECT_EQ(insert->name(), "test-object");
+  EXPECT_EQ(insert->size(), data.size());
+  EXPECT_EQ(insert->crc32c(), gcs::ComputeCrc32cChecksum(data));
+  EXPECT_EQ(insert->md5_hash(), gcs::ComputeMD5Hash(data));
+
+  // The downloads return synthetic data, validated with CRC32C and MD5.
+  auto reader =
+      client.ReadObject(kBucketName, "test-object", gcs::EnableMD5Hash());
+  auto const contents = ReadAll(reader);
+  ASSERT_STATUS_OK(reader.status());
+  EXPECT_EQ(contents, Expected(*store, 0, 1024));
+  EXPECT_EQ(reader.generation().value_or(0), insert->generation());
+  EXPECT_EQ(1, store->upload_count());
+  EXPECT_EQ(1, store->download_count());
+  EXPECT_EQ(1024, store->bytes_uploaded());
+  EXPECT_EQ(1024, store->bytes_downloaded());
+
+  server.Shutdown();
+  server.Wait();
+}
+
+TEST(EmbeddedHttpServer, ReadRange) {
+  auto store = std::make_shared<SyntheticObjectStore>(/*md5_hashes=*/false);
+  auto const size = static_cast<std::int64_t>(3 * store->kBlockSize);
+  store->InsertObject(kBucketName, "large-object", size);
+  EmbeddedHttpServer server(store);
+  auto client = MakeClient(server);
+
+  auto full = client.ReadObject(kBucketName, "large-object");
+  EXPECT_EQ(ReadAll(full), Expected(*store, 0, size));
+  ASSERT_STATUS_OK(full.status());
+
+  auto const offset = static_cast<std::int64_t>(store->kBlockSize) - 100;
+  auto range = client.ReadObject(kBucketName, "large-object",
+                                 gcs::ReadRange(offset, offset + 1000));
+  EXPECT_EQ(ReadAll(range), Expected(*store, offset, 1000));
+  ASSERT_STATUS_OK(range.status());
+
+  auto last = client.ReadObject(kBucketName, "large-object", gcs::ReadLast(10));
+  EXPECT_EQ(ReadAll(last), Expected(*store, size - 10, 10));
+  ASSERT_STATUS_OK(last.status());
+}
+
+TEST(EmbeddedHttpServer, ResumableUpload) {
+  auto store = std::make_shared<SyntheticObjectStore>(/*md5_hashes=*/true);
+  EmbeddedHttpServer server(store);
+  auto client = MakeClient(server);
+
+  auto const block = std::string(256 * 1024, 'B');
+  auto writer = client.WriteObject(kBucketName, "resumable-object",
+                                   gcs::EnableMD5Hash());
+  for (int i = 0; i != 12; ++i) writer.write(block.data(), block.size());
+  writer.Close();
+  ASSERT_STATUS_OK(writer.metadata());
+  EXPECT_EQ(writer.metadata()->size(), 12 * block.size());
+
+  auto metadata = client.GetObjectMetadata(kBucketName, "resumable-object");
+  ASSERT_STATUS_OK(metadata);
+  EXPECT_EQ(metadata->size(), 12 * block.size());
+  EXPECT_EQ(metadata->generation(), writer.metadata()->generation());
+
+  auto reader =
+      client.ReadObject(kBucketName, "resumable-object", gcs::EnableMD5Hash());
+  EXPECT_EQ(ReadAll(reader).size(), 12 * block.size());
+  ASSERT_STATUS_OK(reader.status());
+}
+
+TEST(EmbeddedHttpServer, Delete) {
+  auto store = std::make_shared<SyntheticObjectStore>(/*md5_hashes=*/false);
+  store->InsertObject(kBucketName, "test-object", 1024);
+  EmbeddedHttpServer server(store);
+  auto client = MakeClient(server);
+
+  ASSERT_STATUS_OK(client.DeleteObject(kBucketName, "test-object"));
+  EXPECT_THAT(client.GetObjectMetadata(kBucketName, "test-object"),
+              StatusIs(StatusCode::kNotFound));
+  EXPECT_THAT(client.DeleteObject(kBucketName, "test-object"),
+              StatusIs(StatusCode::kNotFound));
+}
+
+}  // namespace
+}  // namespace storage_benchmarks
+}  // namespace cloud
+}  // namespace google
@@ -0,0 +1,410 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/storage/benchmarks/embedded_server.h"
+#include "google/cloud/storage/benchmarks/embedded_http_server.h"
+#include "google/cloud/storage/benchmarks/synthetic_object_store.h"
+#include "google/cloud/storage/internal/grpc/ctype_cord_workaround.h"
+#include "google/cloud/internal/make_status.h"
+#include "absl/strings/cord.h"
+#include "absl/strings/match.h"
+#include <google/storage/v2/storage.grpc.pb.h>
+#include <grpcpp/grpcpp.h>
+#include <utility>
+
+namespace google {
+namespace cloud {
+namespace storage_benchmarks {
+namespace {
+
+namespace v2 = ::google::storage::v2;
+using Object = SyntheticObjectStore::Object;
+using Checksums = SyntheticObjectStore::Checksums;
+using Upload = SyntheticObjectStore::Upload;
+
+auto constexpr kBucketPrefix = "projects/_/buckets/";
+
+std::string BucketId(std::string const& bucket_name) {
+  return std::string(absl::StripPrefix(bucket_name, kBucketPrefix));
+}
+
+grpc::Status ToGrpcStatus(Status const& status) {
+  return grpc::Status(static_cast<grpc::StatusCode>(status.code()),
+                      status.message());
+}
+
+void ToProto(Checksums const& checksums, v2::ObjectChecksums& proto) {
+  proto.set_crc32c(checksums.crc32c);
+  if (!checksums.md5.empty()) proto.set_md5_hash(checksums.md5);
+}
+
+void ToProto(Object const& object, Checksums const& checksums,
+             v2::Object& proto) {
+  proto.set_bucket(kBucketPrefix + object.bucket);
+  proto.set_name(object.name);
+  proto.set_generation(object.generation);
+  proto.set_metageneration(object.metageneration);
+  proto.set_size(object.size);
+  proto.set_storage_class("STANDARD");
+  proto.set_content_type("application/octet-stream");
+  ToProto(checksums, *proto.mutable_checksums());
+}
+
+/**
+ * Returns the `[begin, end)` range for a read.
+ *
+ * As in `google.storage.v2`, negative offsets are relative to the end of the
+ * object, and a zero limit means "read until the end of the object".
+ */
+StatusOr<std::pair<std::int64_t, std::int64_t>> ResolveRange(
+    std::int64_t size, std::int64_t offset, std::int64_t limit) {
+  if (limit < 0) {
+    return google::cloud::internal::InvalidArgumentError(
+        "negative read limit", GCP_ERROR_INFO());
+  }
+  auto const begin =
+      offset < 0 ? (std::max)(std::int64_t{0}, size + offset) : offset;
+  if (begin > size) {
+    return google::cloud::internal::OutOfRangeError(
+        "read offset (" + std::to_string(offset) +
+            ") is past the end of the object",
+        GCP_ERROR_INFO());
+  }
+  auto const end = limit == 0 ? size : (std::min)(size, begin + limit);
+  return std::make_pair(begin, end);
+}
+
+/// Sets the synthetic contents at @p offset, returns the number of bytes.
+std::int64_t SetContents(SyntheticObjectStore const& store,
+                         std::int64_t offset, std::int64_t length,
+                         v2::ChecksummedData& data) {
+  auto contents = store.Contents(offset, length);
+  // With `[ctype = CORD]` this does not copy the data.
+  storage_internal::SetContent(data,
+                               absl::MakeCordFromExternal(contents, [] {}));
+  data.set_crc32c(store.Crc32c(contents));
+  return static_cast<std::int64_t>(contents.size());
+}
+
+StatusOr<Upload> Append(SyntheticObjectStore& store,
+                        std::string const& upload_id, std::int64_t offset,
+                        std::string const& data) {
+  return store.AppendUpload(upload_id, offset, data);
+}
+
+StatusOr<Upload> Append(SyntheticObjectStore& store,
+                        std::string const& upload_id, std::int64_t offset,
+                        absl::Cord const& data) {
+  auto upload = store.QueryUpload(upload_id);
+  for (auto chunk : data.Chunks()) {
+    upload = store.AppendUpload(upload_id, offset, chunk);
+    if (!upload) break;
+    offset += static_cast<std::int64_t>(chunk.size());
+  }
+  return upload;
+}
+
+/// Returns the upload id for the first message in `[Bidi]WriteObject()`.
+template <typename Request>
+StatusOr<std::string> StartWrite(SyntheticObjectStore& store,
+                                 Request const& request) {
+  if (!request.upload_id().empty()) return request.upload_id();
+  if (!request.has_write_object_spec()) {
+    return google::cloud::internal::InvalidArgumentError(
+        "the first message must include an upload id or a write object spec",
+        GCP_ERROR_INFO());
+  }
+  auto const& resource = request.write_object_spec().resource();
+  return store.StartUpload(BucketId(resource.bucket()), resource.name());
+}
+
+/// Handles each message in `[Bidi]WriteObject()`.
+template <typename Request>
+StatusOr<Upload> HandleWrite(SyntheticObjectStore& store,
+                             std::string const& upload_id,
+                             Request const& request) {
+  auto upload =
+      request.has_checksummed_data()
+          ? Append(store, upload_id, request.write_offset(),
+                   storage_internal::GetContent(request.checksummed_data()))
+          : store.QueryUpload(upload_id);
+  if (!upload || !request.finish_write()) return upload;
+  absl::optional<std::uint32_t> crc32c;
+  std::string md5;
+  if (request.has_object_checksums()) {
+    auto const& checksums = request.object_checksums();
+    if (checksums.has_crc32c()) crc32c = checksums.crc32c();
+    md5 = checksums.md5_hash();
+  }
+  return store.FinalizeUpload(upload_id, crc32c, std::move(md5));
+}
+
+class StorageImpl final : public v2::Storage::Service {
+ public:
+  explicit StorageImpl(std::shared_ptr<SyntheticObjectStore> store)
+      : store_(std::move(store)) {}
+
+  grpc::Status DeleteObject(grpc::ServerContext*,
+                            v2::DeleteObjectRequest const* request,
+                            google::protobuf::Empty*) override {
+    return ToGrpcStatus(
+        store_->DeleteObject(BucketId(request->bucket()), request->object()));
+  }
+
+  grpc::Status GetObject(grpc::ServerContext*,
+                         v2::GetObjectRequest const* request,
+                         v2::Object* response) override {
+    auto object =
+        store_->GetObject(BucketId(request->bucket()), request->object());
+    if (!object) return ToGrpcStatus(object.status());
+    ToProto(*object, store_->ObjectChecksums(object->size), *response);
+    return grpc::Status::OK;
+  }
+
+  grpc::Status ReadObject(
+      grpc::ServerContext* context, v2::ReadObjectRequest const* request,
+      grpc::ServerWriter<v2::ReadObjectResponse>* writer) override {
+    auto object =
+        store_->GetObject(BucketId(request->bucket()), request->object());
+    if (!object) return ToGrpcStatus(object.status());
+    auto range = ResolveRange(object->size, request->read_offset(),
+                              request->read_limit());
+    if (!range) return ToGrpcStatus(range.status());
+    auto const begin = range->first;
+    auto const end = range->second;
+
+    // The first response includes the metadata and the checksums.
+    v2::ReadObjectResponse response;
+    auto const checksums = store_->ObjectChecksums(object->size);
+    ToProto(*object, checksums, *response.mutable_metadata());
+    ToProto(checksums, *response.mutable_object_checksums());
+    auto& content_range = *response.mutable_content_range();
+    content_range.set_start(begin);
+    content_range.set_end(end);
+    content_range.set_complete_length(object->size);
+
+    auto offset = begin;
+    do {
+      if (offset < end) {
+        offset += SetContents(*store_, offset, end - offset,
+                              *response.mutable_checksummed_data());
+      }
+      if (!writer->Write(response)) break;
+      response.Clear();
+    } while (offset < end && !context->IsCancelled());
+    store_->RecordDownload(offset - begin);
+    return grpc::Status::OK;
+  }
+
+  grpc::Status BidiReadObject(
+      grpc::ServerContext* context,
+      grpc::ServerReaderWriter<v2::BidiReadObjectResponse,
+                               v2::BidiReadObjectRequest>* stream) override {
+    v2::BidiReadObjectRequest request;
+    if (!stream->Read(&request)) return grpc::Status::OK;
+    auto const& spec = request.read_object_spec();
+    auto object = store_->GetObject(BucketId(spec.bucket()), spec.object());
+    if (!object) return ToGrpcStatus(object.status());
+
+    v2::BidiReadObjectResponse response;
+    ToProto(*object, store_->ObjectChecksums(object->size),
+            *response.mutable_metadata());
+    if (!stream->Write(response)) return grpc::Status::OK;
+    do {
+      for (auto const& r : request.read_ranges()) {
+        auto range =
+            ResolveRange(object->size, r.read_offset(), r.read_length());
+        if (!range) return ToGrpcStatus(range.status());
+        auto offset = range->first;
+        do {
+          response.Clear();
+          auto& data = *response.add_object_data_ranges();
+          auto const n =
+              SetContents(*store_, offset, range->second - offset,
+                          *data.mutable_checksummed_data());
+          data.mutable_read_range()->set_read_id(r.read_id());
+          data.mutable_read_range()->set_read_offset(offset);
+          data.mutable_read_range()->set_read_length(n);
+          offset += n;
+          data.set_range_end(offset >= range->second);
+          if (!stream->Write(response)) return grpc::Status::OK;
+        } while (offset < range->second && !context->IsCancelled());
+        store_->RecordDownload(offset - range->first);
+      }
+    } while (stream->Read(&request));
+    return grpc::Status::OK;
+  }
+
+  grpc::Status WriteObject(grpc::ServerContext*,
+                           grpc::ServerReader<v2::WriteObjectRequest>* reader,
+                           v2::WriteObjectResponse* response) override {
+    v2::WriteObjectRequest request;
+    std::string upload_id;
+    while (reader->Read(&request)) {
+      if (upload_id.empty()) {
+        auto id = StartWrite(*store_, request);
+        if (!id) return ToGrpcStatus(id.status());
+        upload_id = *std::move(id);
+      }
+      auto upload = HandleWrite(*store_, upload_id, request);
+      if (!upload) return ToGrpcStatus(upload.status());
+      if (upload->object.has_value()) {
+        ToProto(*upload->object, upload->checksums,
+                *response->mutable_resource());
+        return grpc::Status::OK;
+      }
+    }
+    if (upload_id.empty()) {
+      return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT,
+                          "missing WriteObject() messages");
+    }
+    auto upload = store_->QueryUpload(upload_id);
+    if (!upload) return ToGrpcStatus(upload.status());
+    response->set_persisted_size(upload->persisted_size);
+    return grpc::Status::OK;
+  }
+
+  grpc::Status BidiWriteObject(
+      grpc::ServerContext*,
+      grpc::ServerReaderWriter<v2::BidiWriteObjectResponse,
+                               v2::BidiWriteObjectRequest>* stream) override {
+    v2::BidiWriteObjectRequest request;
+    std::string upload_id;
+    while (stream->Read(&request)) {
+      if (request.has_append_object_spec()) {
+        return grpc::Status(grpc::StatusCode::UNIMPLEMENTED,
+                            "appendable objects are not supported");
+      }
+      if (upload_id.empty()) {
+        auto id = StartWrite(*store_, request);
+        if (!id) return ToGrpcStatus(id.status());
+        upload_id = *std::move(id);
+      }
+      auto upload = HandleWrite(*store_, upload_id, request);
+      if (!upload) return ToGrpcStatus(upload.status());
+      v2::BidiWriteObjectResponse response;
+      if (upload->object.has_value()) {
+        ToProto(*upload->object, upload->checksums,
+                *response.mutable_resource());
+        stream->Write(response);
+        return grpc::Status::OK;
+      }
+      if (!request.state_lookup()) continue;
+      response.set_persisted_size(upload->persisted_size);
+      if (!stream->Write(response)) break;
+    }
+    return grpc::Status::OK;
+  }
+
+  grpc::Status StartResumableWrite(
+      grpc::ServerContext*, v2::StartResumableWriteRequest const* request,
+      v2::StartResumableWriteResponse* response) override {
+    auto const& resource = request->write_object_spec().resource();
+    response->set_upload_id(
+        store_->StartUpload(BucketId(resource.bucket()), resource.name()));
+    return grpc::Status::OK;
+  }
+
+  grpc::Status QueryWriteStatus(
+      grpc::ServerContext*, v2::QueryWriteStatusRequest const* request,
+      v2::QueryWriteStatusResponse* response) override {
+    auto upload = store_->QueryUpload(request->upload_id());
+    if (!upload) return ToGrpcStatus(upload.status());
+    if (upload->object.has_value()) {
+      ToProto(*upload->object, upload->checksums,
+              *response->mutable_resource());
+    } else {
+      response->set_persisted_size(upload->persisted_size);
+    }
+    return grpc::Status::OK;
+  }
+
+  grpc::Status CancelResumableWrite(
+      grpc::ServerContext*, v2::CancelResumableWriteRequest const* request,
+      v2::CancelResumableWriteResponse*) override {
+    return ToGrpcStatus(store_->CancelUpload(request->upload_id()));
+  }
+
+ private:
+  std::shared_ptr<SyntheticObjectStore> store_;
+};
+
+class DefaultEmbeddedServer : public EmbeddedServer {
+ public:
+  explicit DefaultEmbeddedServer(EmbeddedServerOptions const& options)
+      : store_(std::make_shared<SyntheticObjectStore>(options.md5_hashes)),
+        storage_(store_),
+        http_server_(store_) {
+    int port;
+    grpc::ServerBuilder builder;
+    builder.AddListeningPort("[::]:0", grpc::InsecureServerCredentials(),
+                             &port);
+    // The client library sends (and expects) messages up to 2 MiB, plus some
+    // overhead.
+    builder.SetMaxReceiveMessageSize(8 * 1024 * 1024);
+    builder.RegisterService(&storage_);
+    server_ = builder.BuildAndStart();
+    grpc_address_ = "localhost:" + std::to_string(port);
+  }
+
+  std::string grpc_address() const override { return grpc_address_; }
+  std::string rest_endpoint() const override {
+    return http_server_.endpoint();
+  }
+  void Shutdown() override {
+    http_server_.Shutdown();
+    server_->Shutdown();
+  }
+  void Wait() override {
+    server_->Wait();
+    http_server_.Wait();
+  }
+
+  void InsertObject(std::string const& bucket_name,
+                    std::string const& object_name,
+                    std::int64_t size) override {
+    store_->InsertObject(bucket_name, object_name, size);
+  }
+
+  std::int64_t upload_count() const override {
+    return store_->upload_count();
+  }
+  std::int64_t download_count() const override {
+    return store_->download_count();
+  }
+  std::int64_t bytes_uploaded() const override {
+    return store_->bytes_uploaded();
+  }
+  std::int64_t bytes_downloaded() const override {
+    return store_->bytes_downloaded();
+  }
+
+ private:
+  std::shared_ptr<SyntheticObjectStore> store_;
+  StorageImpl storage_;
+  EmbeddedHttpServer http_server_;
+  std::unique_ptr<grpc::Server> server_;
+  std::string grpc_address_;
+};
+
+}  // namespace
+
+std::unique_ptr<EmbeddedServer> CreateEmbeddedServer(
+    EmbeddedServerOptions options) {
+  return std::make_unique<DefaultEmbeddedServer>(options);
+}
+
+}  // namespace storage_benchmarks
+}  // namespace cloud
+}  // namespace google
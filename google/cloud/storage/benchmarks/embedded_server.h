@@ -0,0 +1,83 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GOOGLE_CLOUD_CPP_GOOGLE_CLOUD_STORAGE_BENCHMARKS_EMBEDDED_SERVER_H
+#define GOOGLE_CLOUD_CPP_GOOGLE_CLOUD_STORAGE_BENCHMARKS_EMBEDDED_SERVER_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace google {
+namespace cloud {
+namespace storage_benchmarks {
+
+/// Configure the behavior of the embedded GCS server.
+struct EmbeddedServerOptions {
+  /**
+   * Include MD5 hashes in the object checksums.
+   *
+   * The server computes (and caches) the checksums for each distinct object
+   * size. Computing MD5 hashes for large objects is relatively expensive,
+   * disable them if the benchmark does not need them.
+   */
+  bool md5_hashes = true;
+};
+
+/**
+ * An abstract class to run and stop the embedded GCS server.
+ *
+ * The server implements the object reads and writes in both `google.storage.v2`
+ * (`ReadObject()`, `BidiReadObject()`, `WriteObject()`, `BidiWriteObject()`,
+ * and resumable uploads) and the JSON and XML APIs. Running the benchmarks
+ * against this server eliminates the network and the service from the
+ * measurements, only the client library and the transport remain.
+ *
+ * The server discards any uploaded data, and returns synthetic data (with
+ * valid checksums) for downloads. The buckets are not validated, any bucket
+ * name works.
+ */
+class EmbeddedServer {
+ public:
+  virtual ~EmbeddedServer() = default;
+
+  /// The gRPC endpoint, use with `EndpointOption`.
+  virtual std::string grpc_address() const = 0;
+  /// The JSON and XML endpoint, use with `storage::RestEndpointOption`.
+  virtual std::string rest_endpoint() const = 0;
+  virtual void Shutdown() = 0;
+  virtual void Wait() = 0;
+
+  /// Create (or overwrite) an object with synthetic contents.
+  virtual void InsertObject(std::string const& bucket_name,
+                            std::string const& object_name,
+                            std::int64_t size) = 0;
+
+  /// The number of finalized uploads, over any transport.
+  virtual std::int64_t upload_count() const = 0;
+  /// The number of downloads, including ranges in `BidiReadObject()`.
+  virtual std::int64_t download_count() const = 0;
+  virtual std::int64_t bytes_uploaded() const = 0;
+  virtual std::int64_t bytes_downloaded() const = 0;
+};
+
+/// Create an embedded server, listening on random ports in `localhost`.
+std::unique_ptr<EmbeddedServer> CreateEmbeddedServer(
+    EmbeddedServerOptions options = {});
+
+}  // namespace storage_benchmarks
+}  // namespace cloud
+}  // namespace google
+
+#endif  // GOOGLE_CLOUD_CPP_GOOGLE_CLOUD_STORAGE_BENCHMARKS_EMBEDDED_SERVER_H
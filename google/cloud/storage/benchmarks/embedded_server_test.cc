@@ -0,0 +1,157 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/storage/benchmarks/embedded_server.h"
+#include "google/cloud/storage/client.h"
+#include "google/cloud/storage/grpc_plugin.h"
+#include "google/cloud/common_options.h"
+#include "google/cloud/credentials.h"
+#include "google/cloud/testing_util/status_matchers.h"
+#include <gmock/gmock.h>
+#include <iterator>
+#include <string>
+#include <thread>
+
+namespace google {
+namespace cloud {
+namespace storage_benchmarks {
+namespace {
+
+namespace gcs = ::google::cloud::storage;
+using ::google::cloud::testing_util::StatusIs;
+using ::std::chrono::milliseconds;
+
+auto constexpr kBucketName = "test-bucket";
+
+Options CommonOptions() {
+  return Options{}
+      .set<UnifiedCredentialsOption>(MakeInsecureCredentials())
+      .set<gcs::RetryPolicyOption>(
+          gcs::LimitedErrorCountRetryPolicy(0).clone());
+}
+
+gcs::Client MakeGrpcClient(EmbeddedServer const& server) {
+  return gcs::MakeGrpcClient(
+      CommonOptions().set<EndpointOption>(server.grpc_address()));
+}
+
+gcs::Client MakeRestClient(EmbeddedServer const& server) {
+  return gcs::Client(
+      CommonOptions().set<gcs::RestEndpointOption>(server.rest_endpoint()));
+}
+
+std::string ReadAll(gcs::ObjectReadStream& reader) {
+  return std::string{std::istreambuf_iterator<char>{reader}, {}};
+}
+
+TEST(EmbeddedServer, WaitAndShutdown) {
+  auto server = CreateEmbeddedServer();
+  EXPECT_FALSE(server->grpc_address().empty());
+  EXPECT_FALSE(server->rest_endpoint().empty());
+
+  std::thread wait_thread([&server]() { server->Wait(); });
+  EXPECT_TRUE(wait_thread.joinable());
+  std::this_thread::sleep_for(milliseconds(20));
+  EXPECT_TRUE(wait_thread.joinable());
+  server->Shutdown();
+  wait_thread.join();
+}
+
+TEST(EmbeddedServer, GrpcInsertAndRead) {
+  auto server = CreateEmbeddedServer();
+  std::thread wait_thread([&server]() { server->Wait(); });
+
+  auto client = MakeGrpcClient(*server);
+  auto const data = std::string(1024, 'A');
+  auto insert = client.InsertObject(kBucketName, "test-object", data,
+                                    gcs::EnableMD5Hash());
+  ASSERT_STATUS_OK(insert);
+  EXPECT_EQ(insert->bucket(), kBucketName);
+  EXPECT_EQ(insert->name(), "test-object");
+  EXPECT_EQ(insert->size(), data.size());
+  EXPECT_EQ(1, server->upload_count());
+
+  auto reader =
+      client.ReadObject(kBucketName, "test-object", gcs::EnableMD5Hash());
+  EXPECT_EQ(ReadAll(reader).size(), data.size());
+  ASSERT_STATUS_OK(reader.status());
+  EXPECT_EQ(reader.generation().value_or(0), insert->generation());
+  EXPECT_EQ(1, server->download_count());
+  EXPECT_EQ(1024, server->bytes_downloaded());
+
+  ASSERT_STATUS_OK(client.DeleteObject(kBucketName, "test-object"));
+  EXPECT_THAT(client.GetObjectMetadata(kBucketName, "test-object"),
+              StatusIs(StatusCode::kNotFound));
+
+  server->Shutdown();
+  wait_thread.join();
+}
+
+TEST(EmbeddedServer, GrpcReadRange) {
+  auto server = CreateEmbeddedServer();
+  std::thread wait_thread([&server]() { server->Wait(); });
+  std::int64_t const size = 5 * 1024 * 1024;
+  server->InsertObject(kBucketName, "large-object", size);
+
+  // Both transports return the same synthetic data.
+  auto grpc_client = MakeGrpcClient(*server);
+  auto rest = MakeRestClient(*server);
+  auto grpc_reader = grpc_client.ReadObject(kBucketName, "large-object");
+  auto const grpc_contents = ReadAll(grpc_reader);
+  ASSERT_STATUS_OK(grpc_reader.status());
+  auto rest_reader = rest.ReadObject(kBucketName, "large-object");
+  auto const rest_contents = ReadAll(rest_reader);
+  ASSERT_STATUS_OK(rest_reader.status());
+  EXPECT_EQ(static_cast<std::int64_t>(grpc_contents.size()), size);
+  EXPECT_EQ(grpc_contents, rest_contents);
+
+  std::int64_t const offset = 2 * 1024 * 1024 - 100;
+  auto range = grpc_client.ReadObject(kBucketName, "large-object",
+                                      gcs::ReadRange(offset, offset + 1000));
+  EXPECT_EQ(ReadAll(range), grpc_contents.substr(offset, 1000));
+  ASSERT_STATUS_OK(range.status());
+
+  server->Shutdown();
+  wait_thread.join();
+}
+
+TEST(EmbeddedServer, GrpcResumableUpload) {
+  auto server = CreateEmbeddedServer();
+  std::thread wait_thread([&server]() { server->Wait(); });
+
+  auto client = MakeGrpcClient(*server);
+  auto const block = std::string(256 * 1024, 'B');
+  auto writer = client.WriteObject(kBucketName, "resumable-object");
+  for (int i = 0; i != 12; ++i) writer.write(block.data(), block.size());
+  writer.Close();
+  ASSERT_STATUS_OK(writer.metadata());
+  EXPECT_EQ(writer.metadata()->size(), 12 * block.size());
+  EXPECT_EQ(server->bytes_uploaded(),
+            static_cast<std::int64_t>(12 * block.size()));
+
+  // The uploads are visible over any transport.
+  auto rest = MakeRestClient(*server);
+  auto metadata = rest.GetObjectMetadata(kBucketName, "resumable-object");
+  ASSERT_STATUS_OK(metadata);
+  EXPECT_EQ(metadata->size(), 12 * block.size());
+  EXPECT_EQ(metadata->generation(), writer.metadata()->generation());
+
+  server->Shutdown();
+  wait_thread.join();
+}
+
+}  // namespace
+}  // namespace storage_benchmarks
+}  // namespace cloud
+}  // namespace google
@@ -22,6 +22,9 @@ storage_benchmarks_hdrs = [
     "benchmark_utils.h",
     "bounded_queue.h",
     "create_dataset_options.h",
+    "embedded_http_server.h",
+    "embedded_server.h",
+    "synthetic_object_store.h",
     "throughput_experiment.h",
     "throughput_options.h",
     "throughput_result.h",
@@ -32,6 +35,9 @@ storage_benchmarks_srcs = [
     "aggregate_upload_throughput_options.cc",
     "benchmark_utils.cc",
     "create_dataset_options.cc",
+    "embedded_http_server.cc",
+    "embedded_server.cc",
+    "synthetic_object_store.cc",
     "throughput_experiment.cc",
     "throughput_options.cc",
     "throughput_result.cc",
@@ -22,6 +22,8 @@ storage_benchmarks_unit_tests = [
     "benchmark_make_random_test.cc",
     "benchmark_parser_test.cc",
     "create_dataset_options_test.cc",
+    "embedded_http_server_test.cc",
+    "embedded_server_test.cc",
     "throughput_options_test.cc",
     "throughput_result_test.cc",
 ]
@@ -13,11 +13,14 @@
 // limitations under the License.
 
 #include "google/cloud/storage/benchmarks/benchmark_utils.h"
+#include "google/cloud/storage/benchmarks/embedded_server.h"
 #include "google/cloud/storage/benchmarks/throughput_experiment.h"
 #include "google/cloud/storage/benchmarks/throughput_options.h"
 #include "google/cloud/storage/benchmarks/throughput_result.h"
 #include "google/cloud/storage/client.h"
 #include "google/cloud/storage/grpc_plugin.h"
+#include "google/cloud/common_options.h"
+#include "google/cloud/credentials.h"
 #include "google/cloud/internal/absl_str_join_quiet.h"
 #include "google/cloud/internal/build_info.h"
 #include "google/cloud/internal/format_time_point.h"
@@ -36,6 +39,8 @@
 #include <set>
 #include <sstream>
 #include <string>
+#include <thread>
+#include <tuple>
 #include <utility>
 #include <vector>
 
@@ -100,6 +105,14 @@ stop the loop):
   download.
 - The program then deletes this object and starts another iteration.
 
+The download experiments can use different functions to read the data, as
+configured via `--download-functions`. `ReadObject` uses the `std::istream`
+API, `ReadInto` reads directly into the application buffer, and `ReadChunk`
+returns the data as `absl::Cord` chunks, which, with gRPC, avoids any copies.
+The `Function` column in the output identifies the function used. Divide
+`CpuTimeUs` by `TransferSize`, and multiply by the CPU frequency, to compare
+the CPU cycles per byte of each function.
+
 The loop stops when any of the following conditions are met:
 
 - The test has obtained more than a prescribed "maximum number of samples"
@@ -111,8 +124,26 @@ performance data. The bucket is deleted after the program terminates.
 
 A helper script in this directory can generate pretty graphs from the output of
 this program.
+
+With `--embedded-server` the program runs against an in-process GCS server,
+which discards uploads and returns synthetic data (with valid checksums). In
+this mode there is no network or service in the measurements, and the summary
+at the end of the output reports the CPU time per GiB and the average latency
+introduced by the client library for each library, transport, and operation.
 )""";
 
+// Accumulate the successful samples for each library, transport, and op.
+struct Summary {
+  std::int64_t count = 0;
+  std::int64_t bytes = 0;
+  std::chrono::microseconds elapsed_time{0};
+  std::chrono::microseconds cpu_time{0};
+};
+using SummaryKey = std::tuple<ExperimentLibrary, ExperimentTransport,
+                              gcs_bm::OpType>;
+
+void PrintSummary(std::map<SummaryKey, Summary> const& summary);
+
 using ResultHandler =
     std::function<void(ThroughputOptions const&, gcs_bm::ThroughputResult)>;
 
@@ -134,6 +165,20 @@ int main(int argc, char* argv[]) {
   }
   if (options->exit_after_parse) return 0;
 
+  std::unique_ptr<gcs_bm::EmbeddedServer> server;
+  std::thread server_thread;
+  if (options->embedded_server) {
+    server = gcs_bm::CreateEmbeddedServer();
+    server_thread = std::thread([s = server.get()] { s->Wait(); });
+    options->rest_options.set<gcs::RestEndpointOption>(server->rest_endpoint());
+    options->grpc_options.set<google::cloud::EndpointOption>(
+        server->grpc_address());
+    options->direct_path_options.set<google::cloud::EndpointOption>(
+        server->grpc_address());
+    options->client_options.set<google::cloud::UnifiedCredentialsOption>(
+        google::cloud::MakeInsecureCredentials());
+  }
+
   std::string notes = google::cloud::storage::version_string() + ";" +
                       google::cloud::internal::compiler() + ";" +
                       google::cloud::internal::compiler_flags();
@@ -180,7 +225,8 @@ int main(int argc, char* argv[]) {
             << "\n# Duration: "
             << absl::FormatDuration(absl::FromChrono(options->duration))
             << "\n# Thread Count: " << options->thread_count
-            << "\n# Client Per Thread: " << options->client_per_thread;
+            << "\n# Client Per Thread: " << options->client_per_thread
+            << "\n# Embedded Server: " << options->embedded_server;
 
   output_size_range("Object Size", options->minimum_object_size,
                     options->maximum_object_size);
@@ -223,13 +269,20 @@ int main(int argc, char* argv[]) {
 
   // Serialize output to `std::cout`.
   std::mutex mu;
-  auto handler = [&mu](ThroughputOptions const& options,
-                       gcs_bm::ThroughputResult const& result) {
+  std::map<SummaryKey, Summary> summary;
+  auto handler = [&mu, &summary](ThroughputOptions const& options,
+                                 gcs_bm::ThroughputResult const& result) {
     std::lock_guard<std::mutex> lk(mu);
     gcs_bm::PrintAsCsv(std::cout, options, result);
     if (!result.status.ok()) {
       google::cloud::LogSink::Instance().Flush();
+      return;
     }
+    auto& s = summary[SummaryKey{result.library, result.transport, result.op}];
+    ++s.count;
+    s.bytes += result.transfer_size;
+    s.elapsed_time += result.elapsed_time;
+    s.cpu_time += result.cpu_time;
   };
   auto provider = MakeProvider(*options);
 
@@ -241,6 +294,18 @@ int main(int argc, char* argv[]) {
   }
   for (auto& f : tasks) f.get();
 
+  PrintSummary(summary);
+  if (server) {
+    std::cout << "# Embedded Server Uploads: " << server->upload_count()
+              << "\n# Embedded Server Downloads: " << server->download_count()
+              << "\n# Embedded Server Bytes Uploaded: "
+              << server->bytes_uploaded()
+              << "\n# Embedded Server Bytes Downloaded: "
+              << server->bytes_downloaded() << "\n";
+    server->Shutdown();
+    server_thread.join();
+  }
+
   std::cout << "# DONE\n" << std::flush;
 
   return 0;
@@ -248,6 +313,26 @@ int main(int argc, char* argv[]) {
 
 namespace {
 
+void PrintSummary(std::map<SummaryKey, Summary> const& summary) {
+  for (auto const& kv : summary) {
+    auto const& s = kv.second;
+    // Report the CPU time per GiB, as the sample sizes are random.
+    auto const cpu_per_gib =
+        s.bytes == 0 ? 0.0
+                     : static_cast<double>(s.cpu_time.count()) *
+                           static_cast<double>(gcs_bm::kGiB) /
+                           static_cast<double>(s.bytes);
+    auto const mean_elapsed = static_cast<double>(s.elapsed_time.count()) /
+                              static_cast<double>(s.count);
+    std::cout << "# Summary: " << gcs_bm::ToString(std::get<0>(kv.first))
+              << "," << gcs_bm::ToString(std::get<1>(kv.first)) << ","
+              << gcs_bm::ToString(std::get<2>(kv.first))
+              << ", Samples: " << s.count << ", Bytes: " << s.bytes
+              << ", CpuUsPerGiB: " << cpu_per_gib
+              << ", MeanElapsedUs: " << mean_elapsed << "\n";
+  }
+}
+
 gcs_bm::ClientProvider PerTransport(gcs_bm::ClientProvider const& provider) {
   struct State {
     std::mutex mu;
@@ -0,0 +1,196 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/storage/benchmarks/synthetic_object_store.h"
+#include "google/cloud/storage/benchmarks/benchmark_utils.h"
+#include "google/cloud/storage/internal/base64.h"
+#include "google/cloud/storage/internal/crc32c.h"
+#include "google/cloud/storage/internal/hash_function_impl.h"
+#include "google/cloud/internal/make_status.h"
+#include "google/cloud/internal/random.h"
+#include <algorithm>
+#include <random>
+
+namespace google {
+namespace cloud {
+namespace storage_benchmarks {
+
+namespace {
+
+std::string MakeBlock() {
+  auto generator = google::cloud::internal::DefaultPRNG(std::random_device{}());
+  return MakeRandomData(generator, SyntheticObjectStore::kBlockSize);
+}
+
+Status UploadNotFound(std::string const& upload_id) {
+  return google::cloud::internal::NotFoundError(
+      "unknown upload id <" + upload_id + ">", GCP_ERROR_INFO());
+}
+
+}  // namespace
+
+std::size_t constexpr SyntheticObjectStore::kBlockSize;
+
+SyntheticObjectStore::SyntheticObjectStore(bool md5_hashes)
+    : md5_hashes_(md5_hashes),
+      block_(MakeBlock()),
+      block_crc32c_(storage_internal::Crc32c(block_)) {}
+
+StatusOr<SyntheticObjectStore::Object> SyntheticObjectStore::GetObject(
+    std::string const& bucket, std::string const& name) const {
+  std::lock_guard<std::mutex> lk(mu_);
+  auto i = objects_.find(Key{bucket, name});
+  if (i == objects_.end()) {
+    return google::cloud::internal::NotFoundError(
+        "object <" + name + "> not found in bucket <" + bucket + ">",
+        GCP_ERROR_INFO());
+  }
+  return i->second;
+}
+
+SyntheticObjectStore::Object SyntheticObjectStore::InsertObject(
+    std::string bucket, std::string name, std::int64_t size) {
+  std::lock_guard<std::mutex> lk(mu_);
+  Object object{bucket, name, size, ++generation_, 1};
+  objects_[Key{std::move(bucket), std::move(name)}] = object;
+  return object;
+}
+
+Status SyntheticObjectStore::DeleteObject(std::string const& bucket,
+                                          std::string const& name) {
+  std::lock_guard<std::mutex> lk(mu_);
+  if (objects_.erase(Key{bucket, name}) == 0) {
+    return google::cloud::internal::NotFoundError(
+        "object <" + name + "> not found in bucket <" + bucket + ">",
+        GCP_ERROR_INFO());
+  }
+  return Status{};
+}
+
+absl::string_view SyntheticObjectStore::Contents(std::int64_t offset,
+                                                 std::int64_t length) const {
+  auto const start = static_cast<std::size_t>(offset) % kBlockSize;
+  auto const n = (std::min)(kBlockSize - start,
+                            static_cast<std::size_t>((std::max)(
+                                length, static_cast<std::int64_t>(0))));
+  return absl::string_view(block_).substr(start, n);
+}
+
+std::uint32_t SyntheticObjectStore::Crc32c(absl::string_view contents) const {
+  if (contents.data() == block_.data() && contents.size() == kBlockSize) {
+    return block_crc32c_;
+  }
+  return storage_internal::Crc32c(contents);
+}
+
+SyntheticObjectStore::Checksums SyntheticObjectStore::ObjectChecksums(
+    std::int64_t size) {
+  {
+    std::lock_guard<std::mutex> lk(mu_);
+    auto i = checksums_.find(size);
+    if (i != checksums_.end()) return i->second;
+  }
+  // Compute the checksums without holding the lock, computing MD5 hashes for
+  // large objects can take a while.
+  Checksums checksums;
+  auto md5 = storage::internal::MD5HashFunction::Create();
+  for (std::int64_t offset = 0; offset < size;) {
+    auto contents = Contents(offset, size - offset);
+    checksums.crc32c = storage_internal::ExtendCrc32c(
+        checksums.crc32c, contents, Crc32c(contents));
+    if (md5_hashes_) md5->Update(contents);
+    offset += static_cast<std::int64_t>(contents.size());
+  }
+  if (md5_hashes_) {
+    auto bytes = storage::internal::Base64Decode(md5->Finish().md5);
+    if (bytes) checksums.md5.assign(bytes->begin(), bytes->end());
+  }
+  std::lock_guard<std::mutex> lk(mu_);
+  return checksums_.emplace(size, std::move(checksums)).first->second;
+}
+
+std::string SyntheticObjectStore::StartUpload(std::string bucket,
+                                              std::string name) {
+  std::lock_guard<std::mutex> lk(mu_);
+  auto id = "upload-" + std::to_string(++upload_id_);
+  Upload upload;
+  upload.bucket = std::move(bucket);
+  upload.name = std::move(name);
+  uploads_.emplace(id, std::move(upload));
+  return id;
+}
+
+StatusOr<SyntheticObjectStore::Upload> SyntheticObjectStore::AppendUpload(
+    std::string const& upload_id, std::int64_t offset,
+    absl::string_view data) {
+  std::lock_guard<std::mutex> lk(mu_);
+  auto i = uploads_.find(upload_id);
+  if (i == uploads_.end()) return UploadNotFound(upload_id);
+  auto& upload = i->second;
+  if (upload.object.has_value()) {
+    // The upload is finalized, the service ignores any additional data.
+    return upload;
+  }
+  if (offset > upload.persisted_size) {
+    return google::cloud::internal::InvalidArgumentError(
+        "upload offset (" + std::to_string(offset) +
+            ") is past the persisted size (" +
+            std::to_string(upload.persisted_size) + ")",
+        GCP_ERROR_INFO());
+  }
+  auto const skip = static_cast<std::size_t>(upload.persisted_size - offset);
+  if (skip >= data.size()) return upload;
+  data.remove_prefix(skip);
+  upload.checksums.crc32c =
+      storage_internal::ExtendCrc32c(upload.checksums.crc32c, data);
+  upload.persisted_size += static_cast<std::int64_t>(data.size());
+  bytes_uploaded_ += static_cast<std::int64_t>(data.size());
+  return upload;
+}
+
+StatusOr<SyntheticObjectStore::Upload> SyntheticObjectStore::FinalizeUpload(
+    std::string const& upload_id, absl::optional<std::uint32_t> crc32c,
+    std::string md5) {
+  std::lock_guard<std::mutex> lk(mu_);
+  auto i = uploads_.find(upload_id);
+  if (i == uploads_.end()) return UploadNotFound(upload_id);
+  auto& upload = i->second;
+  if (upload.object.has_value()) return upload;
+  if (crc32c.has_value()) upload.checksums.crc32c = *crc32c;
+  upload.checksums.md5 = std::move(md5);
+  Object object{upload.bucket, upload.name, upload.persisted_size,
+                ++generation_, 1};
+  objects_[Key{upload.bucket, upload.name}] = object;
+  upload.object = std::move(object);
+  ++upload_count_;
+  return upload;
+}
+
+StatusOr<SyntheticObjectStore::Upload> SyntheticObjectStore::QueryUpload(
+    std::string const& upload_id) const {
+  std::lock_guard<std::mutex> lk(mu_);
+  auto i = uploads_.find(upload_id);
+  if (i == uploads_.end()) return UploadNotFound(upload_id);
+  return i->second;
+}
+
+Status SyntheticObjectStore::CancelUpload(std::string const& upload_id) {
+  std::lock_guard<std::mutex> lk(mu_);
+  if (uploads_.erase(upload_id) == 0) return UploadNotFound(upload_id);
+  return Status{};
+}
+
+}  // namespace storage_benchmarks
+}  // namespace cloud
+}  // namespace google
@@ -0,0 +1,160 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GOOGLE_CLOUD_CPP_GOOGLE_CLOUD_STORAGE_BENCHMARKS_SYNTHETIC_OBJECT_STORE_H
+#define GOOGLE_CLOUD_CPP_GOOGLE_CLOUD_STORAGE_BENCHMARKS_SYNTHETIC_OBJECT_STORE_H
+
+#include "google/cloud/status_or.h"
+#include "absl/strings/string_view.h"
+#include "absl/types/optional.h"
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+
+namespace google {
+namespace cloud {
+namespace storage_benchmarks {
+
+/**
+ * The objects served by the embedded GCS server.
+ *
+ * The embedded server discards any uploaded data, it only keeps track of the
+ * object sizes. Downloads return synthetic data: the contents at offset `n`
+ * are `block()[n % kBlockSize]`, where `block()` is generated once, at random.
+ * That makes it possible to serve downloads at memory speed: the data is never
+ * copied, the CRC32C checksum of each (aligned) block is precomputed, and the
+ * checksums of each object can be computed by composing the checksums of the
+ * blocks.
+ *
+ * The uploads are shared by the gRPC and HTTP transports, for example, one can
+ * start a resumable upload via gRPC and query its status via JSON.
+ */
+class SyntheticObjectStore {
+ public:
+  /// The size of the synthetic block, matches the maximum gRPC message size.
+  static std::size_t constexpr kBlockSize = 2 * 1024 * 1024;
+
+  struct Object {
+    std::string bucket;
+    std::string name;
+    std::int64_t size = 0;
+    std::int64_t generation = 0;
+    std::int64_t metageneration = 0;
+  };
+
+  /// The object checksums, the MD5 hash is in binary form, and may be empty.
+  struct Checksums {
+    std::uint32_t crc32c = 0;
+    std::string md5;
+  };
+
+  /// The result of a resumable or single-shot upload.
+  struct Upload {
+    std::string bucket;
+    std::string name;
+    std::int64_t persisted_size = 0;
+    /// The checksums of the uploaded data, or the values set by the client.
+    Checksums checksums;
+    absl::optional<Object> object;
+  };
+
+  explicit SyntheticObjectStore(bool md5_hashes);
+
+  /// The random data used to synthesize all the objects.
+  absl::string_view block() const { return block_; }
+
+  StatusOr<Object> GetObject(std::string const& bucket,
+                             std::string const& name) const;
+  Object InsertObject(std::string bucket, std::string name, std::int64_t size);
+  Status DeleteObject(std::string const& bucket, std::string const& name);
+
+  /**
+   * Returns the contents of any object at @p offset.
+   *
+   * The result is at most @p length bytes, and never crosses a block boundary.
+   * Call this function in a loop to get all the bytes in a range.
+   */
+  absl::string_view Contents(std::int64_t offset, std::int64_t length) const;
+
+  /// Returns the CRC32C checksum of a value returned by `Contents()`.
+  std::uint32_t Crc32c(absl::string_view contents) const;
+
+  /// Returns the checksums of the synthetic contents for an object of @p size.
+  Checksums ObjectChecksums(std::int64_t size);
+
+  /// Start a new upload, returns the upload id.
+  std::string StartUpload(std::string bucket, std::string name);
+
+  /**
+   * Append @p data to an upload.
+   *
+   * Any bytes before the persisted size are ignored, as the service would do
+   * for a retried request. Uploads that skip bytes fail.
+   */
+  StatusOr<Upload> AppendUpload(std::string const& upload_id,
+                                std::int64_t offset, absl::string_view data);
+
+  /**
+   * Finalize an upload, creating the object.
+   *
+   * @p crc32c and @p md5 are the values provided by the client, if any. The
+   * service would validate these values, this server just returns them.
+   */
+  StatusOr<Upload> FinalizeUpload(
+      std::string const& upload_id,
+      absl::optional<std::uint32_t> crc32c = absl::nullopt,
+      std::string md5 = {});
+
+  StatusOr<Upload> QueryUpload(std::string const& upload_id) const;
+  Status CancelUpload(std::string const& upload_id);
+
+  /// Count a download of @p bytes.
+  void RecordDownload(std::int64_t bytes) {
+    ++download_count_;
+    bytes_downloaded_ += bytes;
+  }
+
+  std::int64_t upload_count() const { return upload_count_.load(); }
+  std::int64_t download_count() const { return download_count_.load(); }
+  std::int64_t bytes_uploaded() const { return bytes_uploaded_.load(); }
+  std::int64_t bytes_downloaded() const { return bytes_downloaded_.load(); }
+
+ private:
+  using Key = std::pair<std::string, std::string>;
+
+  bool const md5_hashes_;
+  std::string const block_;
+  std::uint32_t const block_crc32c_;
+
+  mutable std::mutex mu_;
+  std::int64_t generation_ = 1000;
+  std::int64_t upload_id_ = 0;
+  std::map<Key, Object> objects_;
+  std::map<std::string, Upload> uploads_;
+  std::map<std::int64_t, Checksums> checksums_;
+
+  std::atomic<std::int64_t> upload_count_{0};
+  std::atomic<std::int64_t> download_count_{0};
+  std::atomic<std::int64_t> bytes_uploaded_{0};
+  std::atomic<std::int64_t> bytes_downloaded_{0};
+};
+
+}  // namespace storage_benchmarks
+}  // namespace cloud
+}  // namespace google
+
+#endif  // GOOGLE_CLOUD_CPP_GOOGLE_CLOUD_STORAGE_BENCHMARKS_SYNTHETIC_OBJECT_STORE_H
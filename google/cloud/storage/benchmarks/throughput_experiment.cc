@@ -115,7 +115,8 @@ class ResumableUpload : public ThroughputExperiment {
                             object_name,
                             std::move(generation),
                             std::move(upload_id),
-                            ExtractRetryCount(writer.headers())};
+                            ExtractRetryCount(writer.headers()),
+                            "WriteObject"};
   }
 
  private:
@@ -175,7 +176,8 @@ class SimpleUpload : public ThroughputExperiment {
                             object_name,
                             std::move(generation),
                             "[upload-id-N/A]",
-                            "[retry-count-unknown]"};
+                            "[retry-count-unknown]",
+                            "InsertObject"};
   }
 
  private:
@@ -187,12 +189,19 @@ class SimpleUpload : public ThroughputExperiment {
 
 /**
  * Download objects using the GCS client.
+ *
+ * The experiment reads the data using @p function, one of `ReadObject` (the
+ * `std::istream` API), `ReadInto`, or `ReadChunk`. Comparing the CPU time per
+ * byte across these functions measures the cost of the additional copies in
+ * the `std::istream` API.
  */
 class DownloadObject : public ThroughputExperiment {
  public:
   explicit DownloadObject(google::cloud::storage::Client client,
-                          ExperimentTransport transport)
-      : client_(std::move(client)), transport_(transport) {}
+                          ExperimentTransport transport, std::string function)
+      : client_(std::move(client)),
+        transport_(transport),
+        function_(std::move(function)) {}
   ~DownloadObject() override = default;
 
   ThroughputResult Run(std::string const& bucket_name,
@@ -212,9 +221,23 @@ class DownloadObject : public ThroughputExperiment {
                            gcs::DisableCrc32cChecksum(!config.enable_crc32c),
                            gcs::DisableMD5Hash(!config.enable_md5));
     std::int64_t transfer_size = 0;
-    while (!reader.eof() && !reader.bad()) {
-      reader.read(buffer.data(), buffer.size());
-      transfer_size += reader.gcount();
+    if (function_ == "ReadInto") {
+      for (;;) {
+        auto n = reader.ReadInto(buffer.data(), buffer.size());
+        if (!n || *n == 0) break;
+        transfer_size += static_cast<std::int64_t>(*n);
+      }
+    } else if (function_ == "ReadChunk") {
+      for (;;) {
+        auto chunk = reader.ReadChunk(buffer.size());
+        if (!chunk || chunk->empty()) break;
+        transfer_size += static_cast<std::int64_t>(chunk->size());
+      }
+    } else /* if (function_ == "ReadObject") */ {
+      while (!reader.eof() && !reader.bad()) {
+        reader.read(buffer.data(), buffer.size());
+        transfer_size += reader.gcount();
+      }
     }
     auto const usage = timer.Sample();
     return ThroughputResult{start,
@@ -235,12 +258,14 @@ class DownloadObject : public ThroughputExperiment {
                             object_name,
                             std::to_string(reader.generation().value_or(-1)),
                             "[upload-id-N/A]",
-                            ExtractRetryCount(reader.headers())};
+                            ExtractRetryCount(reader.headers()),
+                            function_};
   }
 
  private:
   google::cloud::storage::Client client_;
   ExperimentTransport transport_;
+  std::string function_;
 };
 
 extern "C" std::size_t OnWrite(char* src, size_t size, size_t nmemb, void* d) {
@@ -260,8 +285,10 @@ class DownloadObjectLibcurl : public ThroughputExperiment {
       : endpoint_(options.rest_options.get<gcs::RestEndpointOption>()),
         target_api_version_path_(
             options.rest_options.get<gcs::internal::TargetApiVersionOption>()),
-        creds_(google::cloud::storage::oauth2::GoogleDefaultCredentials()
-                   .value()) {
+        creds_(options.embedded_server
+                   ? nullptr
+                   : google::cloud::storage::oauth2::GoogleDefaultCredentials()
+                         .value()) {
     if (target_api_version_path_.empty()) {
       target_api_version_path_ = "v1";
     }
@@ -271,13 +298,17 @@ class DownloadObjectLibcurl : public ThroughputExperiment {
   ThroughputResult Run(std::string const& bucket_name,
                        std::string const& object_name,
                        ThroughputExperimentConfig const& config) override {
-    auto header = creds_->AuthorizationHeader();
+    // The embedded server does not require (or validate) any credentials.
+    StatusOr<std::string> header = std::string{};
+    if (creds_) header = creds_->AuthorizationHeader();
     if (!header) return {};
 
     auto const start = std::chrono::system_clock::now();
     auto timer = Timer::PerThread();
     struct curl_slist* slist1 = nullptr;
-    slist1 = curl_slist_append(slist1, header->c_str());
+    if (!header->empty()) {
+      slist1 = curl_slist_append(slist1, header->c_str());
+    }
 
     auto* hnd = curl_easy_init();
     curl_easy_setopt(hnd, CURLOPT_BUFFERSIZE, 102400L);
@@ -333,7 +364,8 @@ class DownloadObjectLibcurl : public ThroughputExperiment {
                             object_name,
                             "[generation-N/A]",
                             "[upload-id-N/A]",
-                            "[retry-count-N/A]"};
+                            "[retry-count-N/A]",
+                            "[function-N/A]"};
   }
 
  private:
@@ -348,13 +380,16 @@ std::shared_ptr<grpc::ChannelInterface> CreateGcsChannel(
     ExperimentTransport transport) {
   grpc::ChannelArguments args;
   args.SetInt("grpc.channel_id", thread_id);
+  auto credentials = options.embedded_server
+                         ? grpc::InsecureChannelCredentials()
+                         : grpc::GoogleDefaultCredentials();
   if (transport == ExperimentTransport::kGrpc) {
     return grpc::CreateCustomChannel(options.grpc_options.get<EndpointOption>(),
-                                     grpc::GoogleDefaultCredentials(), args);
+                                     std::move(credentials), args);
   }
   return grpc::CreateCustomChannel(
-      options.direct_path_options.get<EndpointOption>(),
-      grpc::GoogleDefaultCredentials(), args);
+      options.direct_path_options.get<EndpointOption>(), std::move(credentials),
+      args);
 }
 
 class DownloadObjectRawGrpc : public ThroughputExperiment {
@@ -410,7 +445,8 @@ class DownloadObjectRawGrpc : public ThroughputExperiment {
                             object_name,
                             generation,
                             "[upload-id-N/A]",
-                            "[retry-count-N/A]"};
+                            "[retry-count-N/A]",
+                            "[function-N/A]"};
   }
 
  private:
@@ -452,7 +488,10 @@ std::vector<std::unique_ptr<ThroughputExperiment>> CreateDownloadExperiments(
   for (auto l : options.libs) {
     if (l != ExperimentLibrary::kRaw) {
       for (auto t : options.transports) {
-        result.push_back(std::make_unique<DownloadObject>(provider(t), t));
+        for (auto const& function : options.download_functions) {
+          result.push_back(
+              std::make_unique<DownloadObject>(provider(t), t, function));
+        }
       }
       continue;
     }
@@ -88,6 +88,7 @@ TEST_P(ThroughputExperimentIntegrationTest, Download) {
   options.minimum_write_buffer_size = 1 * kMiB;
   options.libs = {GetParam().library};
   options.transports = {GetParam().transport};
+  options.download_functions = {"ReadObject", "ReadInto", "ReadChunk"};
 
   auto provider = [&](ExperimentTransport) { return client; };
   auto experiments =
@@ -106,6 +106,17 @@ std::vector<std::string> ParseUploadFunctions(std::string const& val) {
   return {functions.begin(), functions.end()};
 }
 
+std::vector<std::string> ParseDownloadFunctions(std::string const& val) {
+  std::set<std::string> functions;  // avoid duplicates
+  for (auto const& token : absl::StrSplit(val, ',')) {
+    if (token != "ReadObject" && token != "ReadInto" && token != "ReadChunk") {
+      return {};
+    }
+    functions.insert(std::string{token});
+  }
+  return {functions.begin(), functions.end()};
+}
+
 }  // namespace
 
 using ::google::cloud::testing_util::OptionDescriptor;
@@ -117,6 +128,10 @@ google::cloud::StatusOr<ThroughputOptions> ValidateParsedOptions(
                                                          GCP_ERROR_INFO());
   };
 
+  // The embedded server accepts any bucket name.
+  if (options.bucket.empty() && options.embedded_server) {
+    options.bucket = "embedded-server-bucket";
+  }
   if (options.bucket.empty()) {
     std::ostringstream os;
     os << "Missing value for --bucket option\n" << usage << "\n";
@@ -201,6 +216,13 @@ google::cloud::StatusOr<ThroughputOptions> ValidateParsedOptions(
     return make_status(os);
   }
 
+  if (options.download_functions.empty()) {
+    std::ostringstream os;
+    os << "No download functions configured for benchmark. Maybe an invalid"
+       << " name?";
+    return make_status(os);
+  }
+
   if (options.enabled_crc32c.empty()) {
     std::ostringstream os;
     os << "No CRC32C settings configured for benchmark.";
@@ -338,6 +360,12 @@ google::cloud::StatusOr<ThroughputOptions> ParseThroughputOptions(
        [&options](std::string const& val) {
          options.upload_functions = ParseUploadFunctions(val);
        }},
+      {"--download-functions",
+       "enable one or more download functions (ReadObject, ReadInto,"
+       " ReadChunk)",
+       [&options](std::string const& val) {
+         options.download_functions = ParseDownloadFunctions(val);
+       }},
       {"--enabled-crc32c", "run with CRC32C enabled, disabled, or both",
        [&options](std::string const& val) {
          options.enabled_crc32c = ParseChecksums(val);
@@ -469,6 +497,13 @@ google::cloud::StatusOr<ThroughputOptions> ParseThroughputOptions(
          options.client_options.set<gcs::ConnectionPoolSizeOption>(
              std::stoi(val));
        }},
+      {"--embedded-server",
+       "run the benchmark against an in-process GCS server, which returns"
+       " synthetic data. Use this to measure the CPU and latency overhead of"
+       " the client library in isolation.",
+       [&options](std::string const& val) {
+         options.embedded_server = ParseBoolean(val).value_or(true);
+       }},
   };
   auto usage = BuildUsage(desc, argv[0]);
 
@@ -53,6 +53,7 @@ struct ThroughputOptions {
       ExperimentTransport::kJson,
   };
   std::vector<std::string> upload_functions = {"InsertObject", "WriteObject"};
+  std::vector<std::string> download_functions = {"ReadObject"};
   std::vector<bool> enabled_crc32c = {false, true};
   std::vector<bool> enabled_md5 = {false, true};
   std::chrono::milliseconds minimum_sample_delay{};
@@ -67,6 +68,9 @@ struct ThroughputOptions {
   Options grpc_options;
   Options direct_path_options =
       Options{}.set<EndpointOption>("google-c2p:///storage.googleapis.com");
+  // Run the benchmark against an in-process GCS server. This eliminates the
+  // network and the service from the measurements.
+  bool embedded_server = false;
   bool exit_after_parse = false;
 };
 
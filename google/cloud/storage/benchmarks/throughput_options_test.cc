@@ -206,6 +206,22 @@ TEST(ThroughputOptions, UploadFunctions) {
               UnorderedElementsAre("InsertObject", "WriteObject"));
 }
 
+TEST(ThroughputOptions, DownloadFunctions) {
+  EXPECT_FALSE(ParseThroughputOptions(
+      {"self-test", "--bucket=b", "--download-functions="}));
+  EXPECT_FALSE(ParseThroughputOptions(
+      {"self-test", "--bucket=b", "--download-functions=ReadInto,Invalid"}));
+  auto options = ParseThroughputOptions({"self-test", "--bucket=b"});
+  ASSERT_STATUS_OK(options);
+  EXPECT_THAT(options->download_functions, ElementsAre("ReadObject"));
+  options = ParseThroughputOptions(
+      {"self-test", "--bucket=b",
+       "--download-functions=ReadChunk,ReadInto,ReadObject,ReadInto"});
+  ASSERT_STATUS_OK(options);
+  EXPECT_THAT(options->download_functions,
+              UnorderedElementsAre("ReadChunk", "ReadInto", "ReadObject"));
+}
+
 TEST(ThroughputOptions, Readoffset) {
   auto options = ParseThroughputOptions({
       "self-test",
@@ -234,6 +250,24 @@ TEST(ThroughputOptions, ReadSize) {
   EXPECT_EQ(options->read_size_quantum, 128 * kKiB);
 }
 
+TEST(ThroughputOptions, EmbeddedServer) {
+  auto options = ParseThroughputOptions({"self-test", "--embedded-server"});
+  ASSERT_STATUS_OK(options);
+  EXPECT_TRUE(options->embedded_server);
+  EXPECT_FALSE(options->bucket.empty());
+
+  options = ParseThroughputOptions(
+      {"self-test", "--embedded-server=true", "--bucket=test-bucket"});
+  ASSERT_STATUS_OK(options);
+  EXPECT_TRUE(options->embedded_server);
+  EXPECT_EQ(options->bucket, "test-bucket");
+
+  options = ParseThroughputOptions(
+      {"self-test", "--embedded-server=false", "--bucket=test-bucket"});
+  ASSERT_STATUS_OK(options);
+  EXPECT_FALSE(options->embedded_server);
+}
+
 TEST(ThroughputOptions, Validate) {
   EXPECT_FALSE(ParseThroughputOptions({"self-test"}));
   EXPECT_FALSE(ParseThroughputOptions({"self-test", "unused-1", "unused-2"}));
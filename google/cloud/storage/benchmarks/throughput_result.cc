@@ -57,6 +57,7 @@ void PrintAsCsv(std::ostream& os, ThroughputOptions const& options,
      << ',' << CleanupCsv(r.generation)        //
      << ',' << CleanupCsv(r.upload_id)         //
      << ',' << CleanupCsv(r.retry_count)       //
+     << ',' << CleanupCsv(r.function)          //
      << ',' << r.status.code()                 //
      << ',' << CleanupCsv(r.status.message())  //
      << '\n';
@@ -66,7 +67,7 @@ void PrintThroughputResultHeader(std::ostream& os) {
   os << "Start,Labels,Library,Transport,Op,ObjectSize,TransferOffset"
      << ",TransferSize,AppBufferSize,Crc32cEnabled,MD5Enabled"
      << ",ElapsedTimeUs,CpuTimeUs,Peer,BucketName,ObjectName,Generation"
-     << ",UploadId,RetryCount,StatusCode,Status\n";
+     << ",UploadId,RetryCount,Function,StatusCode,Status\n";
 }
 
 char const* ToString(OpType op) {
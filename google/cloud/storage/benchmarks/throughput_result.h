@@ -102,6 +102,9 @@ struct ThroughputResult {
   std::string upload_id;
   /// Retry Count
   std::string retry_count;
+  /// The client library function used in this experiment, e.g. `ReadObject`
+  /// or `ReadInto`.
+  std::string function;
 };
 
 /// Print @p r as a CSV line.
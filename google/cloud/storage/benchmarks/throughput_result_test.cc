@@ -84,7 +84,8 @@ TEST(ThroughputResult, HeaderMatches) {
       /*md5_enabled=*/false, std::chrono::microseconds(234000),
       std::chrono::microseconds(345000),
       Status{StatusCode::kOutOfRange, "OOR-status-message"}, "peer",
-      "bucket-name", "object-name", "generation", "upload-id", "retry-count"});
+      "bucket-name", "object-name", "generation", "upload-id", "retry-count",
+      "function"});
   ASSERT_FALSE(header.empty());
   ASSERT_FALSE(line.empty());
 
@@ -15,6 +15,7 @@
 #include "google/cloud/storage/client.h"
 #include "google/cloud/storage/internal/base64.h"
 #include "google/cloud/storage/internal/connection_factory.h"
+#include "google/cloud/storage/internal/memory_mapped_file.h"
 #include "google/cloud/storage/oauth2/service_account_credentials.h"
 #include "google/cloud/internal/absl_str_cat_quiet.h"
 #include "google/cloud/internal/curl_handle.h"
@@ -26,6 +27,7 @@
 #include "absl/strings/str_split.h"
 #include <fstream>
 #include <memory>
+#include <sstream>
 #include <string>
 #include <thread>
 #include <utility>
@@ -132,7 +134,8 @@ StatusOr<ObjectMetadata> Client::UploadFileSimple(
     internal::InsertObjectMediaRequest request) {
   auto payload = connection_->UploadFileSimple(file_name, file_size, request);
   if (!payload) return payload.status();
-  request.set_payload(*payload.value());
+  // A null pointer means the connection has set the request payload.
+  if (*payload) request.set_payload(**payload);
   return connection_->InsertObjectMedia(request);
 }
 
@@ -172,11 +175,17 @@ StatusOr<ObjectMetadata> Client::UploadStreamResumable(
   auto chunk_size = internal::UploadChunkRequest::RoundUpToQuantum(
       current.get<UploadBufferSizeOption>());
 
+  // The chunks of a memory mapped file reference the mapped pages, and the
+  // requests keep the mapping alive, so transports can send the pages without
+  // copying them.
+  auto* mapped = internal::MemoryMappedFileStream::FromStream(source);
+  auto const read_size = chunk_size;
+
   // We iterate while `source` is good, the upload size does not reach the
   // `UploadLimit` and the retry policy has not been exhausted.
   bool reach_upload_limit = false;
   internal::ConstBufferSequence buffers(1);
-  std::vector<char> buffer(chunk_size);
+  std::vector<char> buffer(mapped == nullptr ? read_size : 0);
   std::shared_ptr<internal::HashFunction> hash_function =
       internal::CreateHashFunction(request);
   while (!source.eof() && !reach_upload_limit) {
@@ -186,12 +195,20 @@ StatusOr<ObjectMetadata> Client::UploadStreamResumable(
       chunk_size = static_cast<std::size_t>(upload_limit - committed_size);
       reach_upload_limit = true;
     }
-    source.read(buffer.data(), buffer.size());
-    auto gcount = static_cast<std::size_t>(source.gcount());
+    absl::string_view chunk;
+    if (mapped != nullptr) {
+      chunk = mapped->Consume(read_size);
+      if (chunk.size() < read_size) source.setstate(std::ios::eofbit);
+    } else {
+      source.read(buffer.data(), buffer.size());
+      chunk = absl::string_view(buffer.data(),
+                                static_cast<std::size_t>(source.gcount()));
+    }
+    auto gcount = chunk.size();
     auto expected = committed_size + gcount;
-    buffers[0] = internal::ConstBuffer{buffer.data(), gcount};
+    buffers[0] = internal::ConstBuffer{chunk.data(), gcount};
     auto upload_request = [&] {
-      bool final_chunk = (gcount < buffer.size()) || reach_upload_limit;
+      bool final_chunk = (gcount < read_size) || reach_upload_limit;
       if (!final_chunk) {
         return internal::UploadChunkRequest(upload_id, committed_size, buffers,
                                             hash_function);
@@ -200,6 +217,7 @@ StatusOr<ObjectMetadata> Client::UploadStreamResumable(
                                           hash_function,
                                           internal::HashValues{});
     }();
+    if (mapped != nullptr) upload_request.set_payload_owner(mapped->file());
     request.ForEachOption(internal::CopyCommonOptions(upload_request));
     auto upload = connection_->UploadChunk(upload_request);
     if (!upload) return std::move(upload).status();
@@ -223,6 +241,14 @@ StatusOr<ObjectMetadata> Client::UploadStreamResumable(
       "Upload did not complete but source is exhausted", GCP_ERROR_INFO());
 }
 
+std::vector<storage_experimental::BatchResult> Client::ExecuteBatchImpl(
+    internal::BatchRequest const& request) {
+  auto response = connection_->ExecuteBatch(request);
+  if (response) return std::move(response->results);
+  return std::vector<storage_experimental::BatchResult>(request.requests.size(),
+                                                        response.status());
+}
+
 Status Client::DownloadFileImpl(internal::ReadObjectRangeRequest const& request,
                                 std::string const& file_name) {
   auto const* func = __func__;
@@ -28,6 +28,7 @@
 #include "google/cloud/storage/notification_event_type.h"
 #include "google/cloud/storage/notification_payload_format.h"
 #include "google/cloud/storage/oauth2/google_credentials.h"
+#include "google/cloud/storage/object_batch.h"
 #include "google/cloud/storage/object_rewriter.h"
 #include "google/cloud/storage/object_stream.h"
 #include "google/cloud/storage/retry_policy.h"
@@ -1481,6 +1482,41 @@ class Client {
     return connection_->PatchObject(request);
   }
 
+  /**
+   * Executes multiple object metadata operations using the JSON batch API.
+   *
+   * Sends all the calls in @p batch using as few HTTP requests as possible.
+   * The service limits each request to 100 calls, larger batches are split
+   * automatically.
+   *
+   * @param batch the calls to execute.
+   * @param options a list of optional query parameters and/or request headers.
+   *     Valid types for this operation include the retry, backoff, and
+   *     idempotency policy options. The options for each call are set when
+   *     the call is added to @p batch.
+   * @return the result of each call, in the order the calls were added to
+   *     @p batch. If the batch request itself fails, each call reports that
+   *     error.
+   *
+   * @par Idempotency
+   * Each call is idempotent under the same conditions as the corresponding
+   * `Client` member function. Idempotent calls that fail with a transient
+   * error are retried as part of a new batch. The retry policy applies to the
+   * full batch and not to individual calls.
+   *
+   * @note Batch requests are only supported by the REST transport. The gRPC
+   *     transport returns `kUnimplemented` for all the calls.
+   *
+   * @see https://cloud.google.com/storage/docs/batch
+   */
+  template <typename... Options>
+  std::vector<storage_experimental::BatchResult> ExecuteBatch(
+      storage_experimental::ObjectBatch batch, Options&&... options) {
+    google::cloud::internal::OptionsSpan const span(
+        SpanOptions(std::forward<Options>(options)...));
+    return ExecuteBatchImpl(batch.request_);
+  }
+
   /**
    * Composes existing objects into a new object in the same bucket.
    *
@@ -3550,6 +3586,9 @@ class Client {
       std::istream& source,
       internal::ResumableUploadRequest const& request) const;
 
+  std::vector<storage_experimental::BatchResult> ExecuteBatchImpl(
+      internal::BatchRequest const& request);
+
   Status DownloadFileImpl(internal::ReadObjectRangeRequest const& request,
                           std::string const& file_name);
 
@@ -36,6 +36,9 @@ namespace {
 using ::google::cloud::internal::CurrentOptions;
 using ::google::cloud::storage::testing::TempFile;
 using ::google::cloud::storage::testing::canonical_errors::TransientError;
+using ::google::cloud::testing_util::IsOk;
+using ::google::cloud::testing_util::StatusIs;
+using ::testing::_;
 using ::testing::ByMove;
 using ::testing::ElementsAre;
 using ::testing::HasSubstr;
@@ -302,6 +305,79 @@ TEST_F(ObjectTest, UploadFileResumable) {
   EXPECT_EQ(expected, *actual);
 }
 
+TEST_F(ObjectTest, UploadFileMemoryMappedSimple) {
+  std::string text = R"""({
+      "name": "test-bucket-name/test-object-name/1"
+})""";
+  ObjectMetadata expected =
+      storage::internal::ObjectMetadataParser::FromString(text).value();
+  std::string const contents = std::string{"some simple contents"};
+
+  EXPECT_CALL(*mock_, InsertObjectMedia)
+      .WillOnce([&](internal::InsertObjectMediaRequest const& request) {
+        EXPECT_EQ(contents.substr(5), request.payload());
+#if !_WIN32
+        EXPECT_NE(request.payload_owner(), nullptr);
+#endif  // !_WIN32
+        return make_status_or(expected);
+      });
+
+  TempFile temp(contents);
+  auto client = ClientForMock();
+  StatusOr<ObjectMetadata> actual = client.UploadFile(
+      temp.name(), "test-bucket-name", "test-object-name", UploadFromOffset(5),
+      Options{}.set<EnableMemoryMappedUploadsOption>(true));
+  ASSERT_STATUS_OK(actual);
+  EXPECT_EQ(expected, *actual);
+}
+
+TEST_F(ObjectTest, UploadFileMemoryMappedResumable) {
+  std::string text = R"""({
+      "name": "test-bucket-name/test-object-name/1"
+})""";
+  ObjectMetadata expected =
+      storage::internal::ObjectMetadataParser::FromString(text).value();
+  auto constexpr kChunkSize = 256 * 1024;
+  auto const contents = std::string(kChunkSize, 'a') + std::string(10, 'b');
+
+  EXPECT_CALL(*mock_, CreateResumableUpload)
+      .WillOnce([&](internal::ResumableUploadRequest const& request) {
+        EXPECT_EQ(request.GetOption<UploadContentLength>().value_or(0),
+                  contents.size());
+        return make_status_or(
+            internal::CreateResumableUploadResponse{"test-upload-id"});
+      });
+  EXPECT_CALL(*mock_, UploadChunk)
+      .WillOnce([&](internal::UploadChunkRequest const& request) {
+        EXPECT_EQ(request.offset(), 0);
+        EXPECT_EQ(request.payload_size(), kChunkSize);
+        EXPECT_FALSE(request.last_chunk());
+#if !_WIN32
+        EXPECT_NE(request.payload_owner(), nullptr);
+#endif  // !_WIN32
+        return make_status_or(internal::QueryResumableUploadResponse{
+            kChunkSize, absl::nullopt});
+      })
+      .WillOnce([&](internal::UploadChunkRequest const& request) {
+        EXPECT_EQ(request.offset(), kChunkSize);
+        EXPECT_EQ(request.payload_size(), 10);
+        EXPECT_TRUE(request.last_chunk());
+        return make_status_or(
+            internal::QueryResumableUploadResponse{absl::nullopt, expected});
+      });
+
+  TempFile temp(contents);
+  auto client = ClientForMock();
+  StatusOr<ObjectMetadata> actual = client.UploadFile(
+      temp.name(), "test-bucket-name", "test-object-name",
+      UseResumableUploadSession(""),
+      Options{}
+          .set<EnableMemoryMappedUploadsOption>(true)
+          .set<UploadBufferSizeOption>(kChunkSize));
+  ASSERT_STATUS_OK(actual);
+  EXPECT_EQ(expected, *actual);
+}
+
 TEST_F(ObjectTest, DeleteResumableUpload) {
   EXPECT_CALL(*mock_, DeleteResumableUpload)
       .WillOnce(Return(StatusOr<internal::EmptyResponse>(TransientError())))
@@ -479,6 +555,55 @@ TEST_F(ObjectTest, PatchObject) {
   EXPECT_EQ(expected, *actual);
 }
 
+TEST_F(ObjectTest, ExecuteBatch) {
+  EXPECT_CALL(*mock_, ExecuteBatch)
+      .WillOnce(Return(StatusOr<internal::BatchResponse>(TransientError())))
+      .WillOnce([](internal::BatchRequest const& r) {
+        EXPECT_EQ(CurrentOptions().get<AuthorityOption>(), "a-default");
+        EXPECT_EQ(CurrentOptions().get<UserProjectOption>(), "u-p-test");
+        EXPECT_THAT(r.requests, ElementsAre(_, _));
+        auto const* del =
+            absl::get_if<internal::DeleteObjectRequest>(&r.requests[0]);
+        EXPECT_NE(del, nullptr);
+        auto const* patch =
+            absl::get_if<internal::PatchObjectRequest>(&r.requests[1]);
+        EXPECT_NE(patch, nullptr);
+        if (patch != nullptr) {
+          EXPECT_THAT(patch->payload(), HasSubstr("new-disposition"));
+        }
+        internal::BatchResponse response;
+        response.results.emplace_back(absl::monostate{});
+        response.results.emplace_back(Status(StatusCode::kNotFound, "nope"));
+        return make_status_or(std::move(response));
+      });
+  auto client = ClientForMock();
+  storage_experimental::ObjectBatch batch;
+  EXPECT_EQ(batch.DeleteObject("test-bucket-name", "test-object-name"), 0);
+  EXPECT_EQ(batch.PatchObject(
+                "test-bucket-name", "test-object-name",
+                ObjectMetadataPatchBuilder().SetContentDisposition(
+                    "new-disposition")),
+            1);
+  EXPECT_EQ(batch.size(), 2);
+  auto actual = client.ExecuteBatch(
+      std::move(batch), Options{}.set<UserProjectOption>("u-p-test"));
+  EXPECT_THAT(actual, ElementsAre(IsOk(), StatusIs(StatusCode::kNotFound)));
+}
+
+TEST_F(ObjectTest, ExecuteBatchTooManyFailures) {
+  EXPECT_CALL(*mock_, ExecuteBatch)
+      .Times(3)
+      .WillRepeatedly(
+          Return(StatusOr<internal::BatchResponse>(TransientError())));
+  auto client = ClientForMock();
+  storage_experimental::ObjectBatch batch;
+  batch.DeleteObject("test-bucket-name", "test-object-1");
+  batch.DeleteObject("test-bucket-name", "test-object-2");
+  auto actual = client.ExecuteBatch(std::move(batch));
+  EXPECT_THAT(actual, ElementsAre(StatusIs(TransientError().code()),
+                                  StatusIs(TransientError().code())));
+}
+
 }  // namespace
 GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
 }  // namespace storage
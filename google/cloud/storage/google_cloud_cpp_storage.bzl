@@ -52,6 +52,7 @@ google_cloud_cpp_storage_hdrs = [
     "internal/base64.h",
     "internal/binary_data_as_debug_string.h",
     "internal/bucket_access_control_parser.h",
+    "internal/batch_requests.h",
     "internal/bucket_acl_requests.h",
     "internal/bucket_metadata_parser.h",
     "internal/bucket_requests.h",
@@ -87,12 +88,15 @@ google_cloud_cpp_storage_hdrs = [
     "internal/logging_stub.h",
     "internal/make_jwt_assertion.h",
     "internal/md5hash.h",
+    "internal/memory_mapped_file.h",
     "internal/metadata_parser.h",
     "internal/notification_metadata_parser.h",
     "internal/notification_requests.h",
     "internal/object_access_control_parser.h",
     "internal/object_acl_requests.h",
     "internal/object_metadata_parser.h",
+    "internal/object_metadata_sax_parser.h",
+    "internal/object_read_cache.h",
     "internal/object_read_source.h",
     "internal/object_read_streambuf.h",
     "internal/object_requests.h",
@@ -100,7 +104,9 @@ google_cloud_cpp_storage_hdrs = [
     "internal/patch_builder.h",
     "internal/patch_builder_details.h",
     "internal/policy_document_request.h",
+    "internal/read_cache_connection.h",
     "internal/request_project_id.h",
+    "internal/rest/batch_multipart.h",
     "internal/rest/object_read_source.h",
     "internal/rest/request_builder.h",
     "internal/rest/stub.h",
@@ -133,6 +139,7 @@ google_cloud_cpp_storage_hdrs = [
     "oauth2/refreshing_credentials_wrapper.h",
     "oauth2/service_account_credentials.h",
     "object_access_control.h",
+    "object_batch.h",
     "object_metadata.h",
     "object_read_stream.h",
     "object_retention.h",
@@ -143,6 +150,7 @@ google_cloud_cpp_storage_hdrs = [
     "override_default_project.h",
     "override_unlocked_retention.h",
     "owner.h",
+    "parallel_copy.h",
     "parallel_upload.h",
     "policy_document.h",
     "project_team.h",
@@ -182,6 +190,7 @@ google_cloud_cpp_storage_srcs = [
     "internal/access_token_credentials.cc",
     "internal/base64.cc",
     "internal/bucket_access_control_parser.cc",
+    "internal/batch_requests.cc",
     "internal/bucket_acl_requests.cc",
     "internal/bucket_metadata_parser.cc",
     "internal/bucket_requests.cc",
@@ -209,12 +218,15 @@ google_cloud_cpp_storage_srcs = [
     "internal/logging_stub.cc",
     "internal/make_jwt_assertion.cc",
     "internal/md5hash.cc",
+    "internal/memory_mapped_file.cc",
     "internal/metadata_parser.cc",
     "internal/notification_metadata_parser.cc",
     "internal/notification_requests.cc",
     "internal/object_access_control_parser.cc",
     "internal/object_acl_requests.cc",
     "internal/object_metadata_parser.cc",
+    "internal/object_metadata_sax_parser.cc",
+    "internal/object_read_cache.cc",
     "internal/object_read_streambuf.cc",
     "internal/object_requests.cc",
     "internal/object_write_streambuf.cc",
@@ -222,7 +234,9 @@ google_cloud_cpp_storage_srcs = [
     "internal/patch_builder.cc",
     "internal/patch_builder_details.cc",
     "internal/policy_document_request.cc",
+    "internal/read_cache_connection.cc",
     "internal/request_project_id.cc",
+    "internal/rest/batch_multipart.cc",
     "internal/rest/object_read_source.cc",
     "internal/rest/request_builder.cc",
     "internal/rest/stub.cc",
@@ -255,6 +269,7 @@ google_cloud_cpp_storage_srcs = [
     "object_retention.cc",
     "object_rewriter.cc",
     "object_write_stream.cc",
+    "parallel_copy.cc",
     "parallel_upload.cc",
     "policy_document.cc",
     "service_account.cc",
@@ -79,6 +79,8 @@ add_library(
     internal/binary_data_as_debug_string.h
     internal/bucket_access_control_parser.cc
     internal/bucket_access_control_parser.h
+    internal/batch_requests.cc
+    internal/batch_requests.h
     internal/bucket_acl_requests.cc
     internal/bucket_acl_requests.h
     internal/bucket_metadata_parser.cc
@@ -141,6 +143,8 @@ add_library(
     internal/make_jwt_assertion.h
     internal/md5hash.cc
     internal/md5hash.h
+    internal/memory_mapped_file.cc
+    internal/memory_mapped_file.h
     internal/metadata_parser.cc
     internal/metadata_parser.h
     internal/notification_metadata_parser.cc
@@ -153,6 +157,10 @@ add_library(
     internal/object_acl_requests.h
     internal/object_metadata_parser.cc
     internal/object_metadata_parser.h
+    internal/object_metadata_sax_parser.cc
+    internal/object_metadata_sax_parser.h
+    internal/object_read_cache.cc
+    internal/object_read_cache.h
     internal/object_read_source.h
     internal/object_read_streambuf.cc
     internal/object_read_streambuf.h
@@ -167,8 +175,12 @@ add_library(
     internal/patch_builder_details.h
     internal/policy_document_request.cc
     internal/policy_document_request.h
+    internal/read_cache_connection.cc
+    internal/read_cache_connection.h
     internal/request_project_id.cc
     internal/request_project_id.h
+    internal/rest/batch_multipart.cc
+    internal/rest/batch_multipart.h
     internal/rest/object_read_source.cc
     internal/rest/object_read_source.h
     internal/rest/request_builder.cc
@@ -228,6 +240,7 @@ add_library(
     oauth2/service_account_credentials.h
     object_access_control.cc
     object_access_control.h
+    object_batch.h
     object_metadata.cc
     object_metadata.h
     object_read_stream.cc
@@ -243,6 +256,8 @@ add_library(
     override_default_project.h
     override_unlocked_retention.h
     owner.h
+    parallel_copy.cc
+    parallel_copy.h
     parallel_upload.cc
     parallel_upload.h
     policy_document.cc
@@ -459,6 +474,7 @@ if (BUILD_TESTING)
         internal/bucket_requests_test.cc
         internal/complex_option_test.cc
         internal/compute_engine_util_test.cc
+        internal/connection_impl_batch_test.cc
         internal/connection_impl_bucket_acl_test.cc
         internal/connection_impl_bucket_test.cc
         internal/connection_impl_default_object_acl_test.cc
@@ -484,15 +500,20 @@ if (BUILD_TESTING)
         internal/logging_stub_test.cc
         internal/make_jwt_assertion_test.cc
         internal/md5hash_test.cc
+        internal/memory_mapped_file_test.cc
         internal/metadata_parser_test.cc
         internal/notification_requests_test.cc
         internal/object_acl_requests_test.cc
+        internal/object_metadata_sax_parser_test.cc
+        internal/object_read_cache_test.cc
         internal/object_read_streambuf_test.cc
         internal/object_requests_test.cc
         internal/object_write_streambuf_test.cc
         internal/patch_builder_test.cc
         internal/policy_document_request_test.cc
+        internal/read_cache_connection_test.cc
         internal/request_project_id_test.cc
+        internal/rest/batch_multipart_test.cc
         internal/rest/object_read_source_test.cc
         internal/rest/request_builder_test.cc
         internal/rest/stub_test.cc
@@ -521,6 +542,7 @@ if (BUILD_TESTING)
         object_metadata_test.cc
         object_retention_test.cc
         object_stream_test.cc
+        parallel_copy_test.cc
         parallel_uploads_test.cc
         policy_document_test.cc
         retry_policy_test.cc
@@ -556,8 +578,10 @@ if (BUILD_TESTING)
 
     include(FindBenchmarkWithWorkarounds)
 
-    set(storage_client_benchmarks # cmake-format: sort
-                                  internal/crc32c_benchmark.cc)
+    set(storage_client_benchmarks
+        # cmake-format: sort
+        internal/crc32c_benchmark.cc
+        internal/object_metadata_sax_parser_benchmark.cc)
 
     # Export the list of benchmarks to a .bzl file so we do not need to maintain
     # the list in two places.
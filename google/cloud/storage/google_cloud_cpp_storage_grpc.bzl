@@ -39,6 +39,7 @@ google_cloud_cpp_storage_grpc_hdrs = [
     "grpc_plugin.h",
     "internal/async/connection_fwd.h",
     "internal/async/connection_impl.h",
+    "internal/async/connection_read_cache.h",
     "internal/async/connection_tracing.h",
     "internal/async/default_options.h",
     "internal/async/handle_redirect_error.h",
@@ -94,6 +95,7 @@ google_cloud_cpp_storage_grpc_hdrs = [
     "internal/grpc/split_write_object_data.h",
     "internal/grpc/stub.h",
     "internal/grpc/synthetic_self_link.h",
+    "internal/grpc/write_buffer_pool.h",
     "internal/storage_auth_decorator.h",
     "internal/storage_logging_decorator.h",
     "internal/storage_metadata_decorator.h",
@@ -113,9 +115,11 @@ google_cloud_cpp_storage_grpc_srcs = [
     "async/reader.cc",
     "async/resume_policy.cc",
     "async/rewriter.cc",
+    "async/write_payload.cc",
     "async/writer.cc",
     "grpc_plugin.cc",
     "internal/async/connection_impl.cc",
+    "internal/async/connection_read_cache.cc",
     "internal/async/connection_tracing.cc",
     "internal/async/default_options.cc",
     "internal/async/handle_redirect_error.cc",
@@ -166,6 +170,7 @@ google_cloud_cpp_storage_grpc_srcs = [
     "internal/grpc/split_write_object_data.cc",
     "internal/grpc/stub.cc",
     "internal/grpc/synthetic_self_link.cc",
+    "internal/grpc/write_buffer_pool.cc",
     "internal/storage_auth_decorator.cc",
     "internal/storage_logging_decorator.cc",
     "internal/storage_metadata_decorator.cc",
@@ -93,6 +93,7 @@ add_library(
     async/rewriter.h
     async/rewriter_connection.h
     async/token.h
+    async/write_payload.cc
     async/write_payload.h
     async/writer.cc
     async/writer.h
@@ -102,6 +103,8 @@ add_library(
     internal/async/connection_fwd.h
     internal/async/connection_impl.cc
     internal/async/connection_impl.h
+    internal/async/connection_read_cache.cc
+    internal/async/connection_read_cache.h
     internal/async/connection_tracing.cc
     internal/async/connection_tracing.h
     internal/async/default_options.cc
@@ -207,6 +210,8 @@ add_library(
     internal/grpc/stub.h
     internal/grpc/synthetic_self_link.cc
     internal/grpc/synthetic_self_link.h
+    internal/grpc/write_buffer_pool.cc
+    internal/grpc/write_buffer_pool.h
     internal/storage_auth_decorator.cc
     internal/storage_auth_decorator.h
     internal/storage_logging_decorator.cc
@@ -438,6 +443,7 @@ set(storage_client_grpc_unit_tests
     internal/async/connection_impl_test.cc
     internal/async/connection_impl_upload_hash_test.cc
     internal/async/connection_impl_upload_test.cc
+    internal/async/connection_read_cache_test.cc
     internal/async/connection_tracing_test.cc
     internal/async/default_options_test.cc
     internal/async/handle_redirect_error_test.cc
@@ -491,6 +497,7 @@ set(storage_client_grpc_unit_tests
     internal/grpc/stub_test.cc
     internal/grpc/stub_upload_chunk_test.cc
     internal/grpc/synthetic_self_link_test.cc
+    internal/grpc/write_buffer_pool_test.cc
     internal/storage_stub_factory_test.cc)
 
 foreach (fname ${storage_client_grpc_unit_tests})
@@ -525,3 +532,24 @@ endforeach ()
 # Export the list of unit tests so the Bazel BUILD file can pick it up.
 export_list_to_bazel("storage_client_grpc_unit_tests.bzl"
                      "storage_client_grpc_unit_tests" YEAR "2018")
+
+include(FindBenchmarkWithWorkarounds)
+
+set(storage_client_grpc_benchmarks
+    # cmake-format: sort
+    internal/grpc/split_write_object_data_benchmark.cc)
+
+# Export the list of benchmarks to a .bzl file so we do not need to maintain the
+# list in two places.
+export_list_to_bazel("storage_client_grpc_benchmarks.bzl"
+                     "storage_client_grpc_benchmarks" YEAR "2025")
+
+# Generate a target for each benchmark.
+foreach (fname IN LISTS storage_client_grpc_benchmarks)
+    google_cloud_cpp_add_executable(target "storage" "${fname}")
+    add_test(NAME ${target} COMMAND ${target})
+    target_link_libraries(
+        ${target} PRIVATE google-cloud-cpp::storage_grpc
+                          benchmark::benchmark_main)
+    google_cloud_cpp_add_common_options(${target})
+endforeach ()
@@ -18,6 +18,8 @@
 #include "google/cloud/storage/client.h"
 #include "google/cloud/storage/version.h"
 #include "google/cloud/status_or.h"
+#include <chrono>
+#include <cstddef>
 
 namespace google {
 namespace cloud {
@@ -102,6 +104,23 @@ struct GrpcMetricsPeriodOption {
   using Type = std::chrono::seconds;
 };
 
+/**
+ * Limit the memory used to cache upload buffers.
+ *
+ * Uploads with a `storage::Client` using gRPC (see `MakeGrpcClient()`) copy
+ * the application data into messages of up to 2 MiB. Instead of allocating
+ * new memory for each message, the client keeps a pool of reusable buffers.
+ * This option limits the total size of the buffers kept in the pool of each
+ * connection, the pool holds no memory until the first upload. Setting this
+ * option to 0 disables the pool. The default is 32 MiB.
+ *
+ * `storage_experimental::AsyncClient` ignores this option. Its uploads send
+ * the `absl::Cord` buffers in each `WritePayload` without copying them.
+ */
+struct GrpcWriteBufferPoolSizeOption {
+  using Type = std::size_t;
+};
+
 GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
 }  // namespace storage_experimental
 }  // namespace cloud
@@ -0,0 +1,315 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/storage/internal/async/connection_read_cache.h"
+#include "google/cloud/storage/async/rewriter_connection.h"
+#include "google/cloud/storage/async/writer_connection.h"
+#include "google/cloud/internal/background_threads_impl.h"
+#include "google/cloud/internal/make_status.h"
+#include "absl/types/optional.h"
+#include <algorithm>
+#include <deque>
+#include <functional>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace google {
+namespace cloud {
+namespace storage_internal {
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_BEGIN
+namespace {
+
+using ReadObjectParams =
+    storage_experimental::AsyncConnection::ReadObjectParams;
+
+// Runs the cache file I/O, which may block, in a dedicated pool. The
+// connection's completion queue threads only complete the downloads. The pool
+// is shared by all the caches in the process, and never destroyed, as the
+// last reference to a cache may be released in one of its threads.
+void RunCacheIo(std::function<void()> fn) {
+  static auto* const kThreads =
+      new google::cloud::internal::AutomaticallyCreatedBackgroundThreads(
+          (std::max)(4U, std::thread::hardware_concurrency()));
+  kThreads->cq().RunAsync(std::move(fn));
+}
+
+bool IsCacheable(google::storage::v2::ReadObjectRequest const& request) {
+  // A negative offset reads the last bytes of the object, and a negative limit
+  // is an error reported by the service.
+  return request.generation() > 0 && request.read_offset() >= 0 &&
+         request.read_limit() >= 0 && !request.has_if_generation_match() &&
+         !request.has_if_generation_not_match() &&
+         !request.has_if_metageneration_match() &&
+         !request.has_if_metageneration_not_match() &&
+         !request.has_common_object_request_params();
+}
+
+ObjectReadCache::Fetcher MakeFetcher(
+    std::shared_ptr<storage_experimental::AsyncConnection> impl,
+    ReadObjectParams p) {
+  return [impl = std::move(impl), p = std::move(p)](std::int64_t offset,
+                                                    std::int64_t length) {
+    auto params = p;
+    params.request.set_read_offset(offset);
+    params.request.set_read_limit(length);
+    return impl->ReadObjectRange(std::move(params))
+        .then([](auto f) -> StatusOr<ObjectReadCacheBlock> {
+          auto payload = f.get();
+          ObjectReadCacheBlock block;
+          if (!payload) {
+            // The service rejects ranges that start past the end of the
+            // object.
+            if (payload.status().code() == StatusCode::kOutOfRange) {
+              return block;
+            }
+            return std::move(payload).status();
+          }
+          for (auto const& s : payload->contents()) {
+            block.data.append(s.data(), s.size());
+          }
+          auto metadata = payload->metadata();
+          if (metadata) {
+            block.object_size = static_cast<std::uint64_t>(metadata->size());
+          }
+          return block;
+        });
+  };
+}
+
+/**
+ * Assembles the result of a `ReadObjectRange()` call from cached blocks.
+ *
+ * Bounded ranges start the downloads of all their blocks at once. Reads to the
+ * end of the object load one block at a time, until the object ends.
+ */
+class CachedRangeRead : public std::enable_shared_from_this<CachedRangeRead> {
+ public:
+  CachedRangeRead(std::shared_ptr<ObjectReadCache> cache,
+                  std::shared_ptr<storage_experimental::AsyncConnection> impl,
+                  ReadObjectParams p)
+      : cache_(std::move(cache)),
+        bucket_(p.request.bucket()),
+        object_(p.request.object()),
+        generation_(p.request.generation()),
+        offset_(p.request.read_offset()),
+        position_(offset_),
+        index_(offset_ / cache_->block_size()) {
+    if (p.request.read_limit() > 0) end_ = offset_ + p.request.read_limit();
+    fetcher_ = MakeFetcher(std::move(impl), std::move(p));
+  }
+
+  future<StatusOr<storage_experimental::ReadPayload>> Start() {
+    auto const block_size = cache_->block_size();
+    pending_.push_back(Read(index_));
+    if (end_) {
+      for (auto i = index_ + 1; i * block_size < *end_; ++i) {
+        pending_.push_back(Read(i));
+      }
+    }
+    auto f = promise_.get_future();
+    Next();
+    return f;
+  }
+
+ private:
+  future<StatusOr<ObjectReadCache::BlockPtr>> Read(std::int64_t index) {
+    return cache_->Read(bucket_, object_, generation_, index, fetcher_);
+  }
+
+  void Next() {
+    // Process the blocks that are already available in a loop, a `.then()`
+    // continuation on a satisfied future runs immediately, and would recurse
+    // once per block.
+    for (;;) {
+      auto f = std::move(pending_.front());
+      pending_.pop_front();
+      if (!f.is_ready()) {
+        f.then([self = shared_from_this()](auto g) {
+          if (self->OnBlock(g.get())) self->Next();
+        });
+        return;
+      }
+      if (!OnBlock(f.get())) return;
+    }
+  }
+
+  // Returns true if more blocks are needed.
+  bool OnBlock(StatusOr<ObjectReadCache::BlockPtr> block) {
+    if (!block) {
+      promise_.set_value(std::move(block).status());
+      return false;
+    }
+    auto const block_size = cache_->block_size();
+    auto const& data = (*block)->data;
+    auto const pos = static_cast<std::size_t>(position_ - index_ * block_size);
+    if (offset_ > 0 && position_ == offset_ && pos >= data.size()) {
+      promise_.set_value(google::cloud::internal::OutOfRangeError(
+          "the read offset is past the end of the object", GCP_ERROR_INFO()));
+      return false;
+    }
+    auto count = pos < data.size() ? data.size() - pos : 0;
+    if (end_) {
+      count = (std::min)(count, static_cast<std::size_t>(*end_ - position_));
+    }
+    if (count != 0) contents_.push_back(data.substr(pos, count));
+    position_ += static_cast<std::int64_t>(count);
+    if ((*block)->object_size) object_size_ = (*block)->object_size;
+
+    auto const done =
+        (end_ && position_ >= *end_) ||
+        data.size() < static_cast<std::size_t>(block_size) ||
+        (object_size_ &&
+         static_cast<std::uint64_t>(position_) >= *object_size_);
+    if (done) {
+      Finish();
+      return false;
+    }
+    ++index_;
+    if (pending_.empty()) pending_.push_back(Read(index_));
+    return true;
+  }
+
+  void Finish() {
+    google::storage::v2::Object metadata;
+    metadata.set_bucket(bucket_);
+    metadata.set_name(object_);
+    metadata.set_generation(generation_);
+    if (object_size_) {
+      metadata.set_size(static_cast<std::int64_t>(*object_size_));
+    }
+    promise_.set_value(storage_experimental::ReadPayload(std::move(contents_))
+                           .set_offset(offset_)
+                           .set_metadata(std::move(metadata)));
+  }
+
+  std::shared_ptr<ObjectReadCache> cache_;
+  ObjectReadCache::Fetcher fetcher_;
+  std::string bucket_;
+  std::string object_;
+  std::int64_t generation_;
+  std::int64_t offset_;
+  absl::optional<std::int64_t> end_;
+  std::int64_t position_;
+  std::int64_t index_;
+  absl::optional<std::uint64_t> object_size_;
+  std::deque<future<StatusOr<ObjectReadCache::BlockPtr>>> pending_;
+  std::vector<std::string> contents_;
+  promise<StatusOr<storage_experimental::ReadPayload>> promise_;
+};
+
+class AsyncConnectionReadCache : public storage_experimental::AsyncConnection {
+ public:
+  AsyncConnectionReadCache(
+      std::shared_ptr<storage_experimental::AsyncConnection> impl,
+      std::shared_ptr<ObjectReadCache> cache)
+      : impl_(std::move(impl)), cache_(std::move(cache)) {}
+
+  Options options() const override { return impl_->options(); }
+
+  future<StatusOr<google::storage::v2::Object>> InsertObject(
+      InsertObjectParams p) override {
+    return impl_->InsertObject(std::move(p));
+  }
+
+  future<StatusOr<
+      std::shared_ptr<storage_experimental::ObjectDescriptorConnection>>>
+  Open(OpenParams p) override {
+    return impl_->Open(std::move(p));
+  }
+
+  future<StatusOr<std::unique_ptr<storage_experimental::AsyncReaderConnection>>>
+  ReadObject(ReadObjectParams p) override {
+    return impl_->ReadObject(std::move(p));
+  }
+
+  future<StatusOr<storage_experimental::ReadPayload>> ReadObjectRange(
+      ReadObjectParams p) override {
+    if (!IsCacheable(p.request)) return impl_->ReadObjectRange(std::move(p));
+    return std::make_shared<CachedRangeRead>(cache_, impl_, std::move(p))
+        ->Start();
+  }
+
+  future<StatusOr<std::unique_ptr<storage_experimental::AsyncWriterConnection>>>
+  StartAppendableObjectUpload(AppendableUploadParams p) override {
+    return impl_->StartAppendableObjectUpload(std::move(p));
+  }
+
+  future<StatusOr<std::unique_ptr<storage_experimental::AsyncWriterConnection>>>
+  ResumeAppendableObjectUpload(AppendableUploadParams p) override {
+    return impl_->ResumeAppendableObjectUpload(std::move(p));
+  }
+
+  future<StatusOr<std::unique_ptr<storage_experimental::AsyncWriterConnection>>>
+  StartUnbufferedUpload(UploadParams p) override {
+    return impl_->StartUnbufferedUpload(std::move(p));
+  }
+
+  future<StatusOr<std::unique_ptr<storage_experimental::AsyncWriterConnection>>>
+  StartBufferedUpload(UploadParams p) override {
+    return impl_->StartBufferedUpload(std::move(p));
+  }
+
+  future<StatusOr<std::unique_ptr<storage_experimental::AsyncWriterConnection>>>
+  ResumeUnbufferedUpload(ResumeUploadParams p) override {
+    return impl_->ResumeUnbufferedUpload(std::move(p));
+  }
+
+  future<StatusOr<std::unique_ptr<storage_experimental::AsyncWriterConnection>>>
+  ResumeBufferedUpload(ResumeUploadParams p) override {
+    return impl_->ResumeBufferedUpload(std::move(p));
+  }
+
+  future<StatusOr<google::storage::v2::Object>> ComposeObject(
+      ComposeObjectParams p) override {
+    return impl_->ComposeObject(std::move(p));
+  }
+
+  future<Status> DeleteObject(DeleteObjectParams p) override {
+    return impl_->DeleteObject(std::move(p));
+  }
+
+  std::shared_ptr<storage_experimental::AsyncRewriterConnection> RewriteObject(
+      RewriteObjectParams p) override {
+    return impl_->RewriteObject(std::move(p));
+  }
+
+ private:
+  std::shared_ptr<storage_experimental::AsyncConnection> impl_;
+  std::shared_ptr<ObjectReadCache> cache_;
+};
+
+}  // namespace
+
+std::shared_ptr<storage_experimental::AsyncConnection>
+MakeReadCacheAsyncConnection(
+    std::shared_ptr<storage_experimental::AsyncConnection> impl,
+    std::shared_ptr<ObjectReadCache> cache) {
+  return std::make_shared<AsyncConnectionReadCache>(std::move(impl),
+                                                    std::move(cache));
+}
+
+std::shared_ptr<storage_experimental::AsyncConnection>
+MakeReadCacheAsyncConnection(
+    std::shared_ptr<storage_experimental::AsyncConnection> impl) {
+  auto cache = MakeObjectReadCache(impl->options(), RunCacheIo);
+  if (!cache) return impl;
+  return MakeReadCacheAsyncConnection(std::move(impl), std::move(cache));
+}
+
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
+}  // namespace storage_internal
+}  // namespace cloud
+}  // namespace google
@@ -0,0 +1,54 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GOOGLE_CLOUD_CPP_GOOGLE_CLOUD_STORAGE_INTERNAL_ASYNC_CONNECTION_READ_CACHE_H
+#define GOOGLE_CLOUD_CPP_GOOGLE_CLOUD_STORAGE_INTERNAL_ASYNC_CONNECTION_READ_CACHE_H
+
+#include "google/cloud/storage/async/connection.h"
+#include "google/cloud/storage/internal/object_read_cache.h"
+#include "google/cloud/version.h"
+#include <memory>
+
+namespace google {
+namespace cloud {
+namespace storage_internal {
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_BEGIN
+
+/**
+ * Serves `ReadObjectRange()` for object generations from @p cache.
+ *
+ * Only requests for a specific generation, without pre-conditions or
+ * encryption keys, use the cache. All other requests go to @p impl.
+ */
+std::shared_ptr<storage_experimental::AsyncConnection>
+MakeReadCacheAsyncConnection(
+    std::shared_ptr<storage_experimental::AsyncConnection> impl,
+    std::shared_ptr<ObjectReadCache> cache);
+
+/**
+ * Decorates @p impl with the read cache configured in its options.
+ *
+ * Returns @p impl if `storage_experimental::ReadCacheDirectoryOption` is not
+ * set.
+ */
+std::shared_ptr<storage_experimental::AsyncConnection>
+MakeReadCacheAsyncConnection(
+    std::shared_ptr<storage_experimental::AsyncConnection> impl);
+
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
+}  // namespace storage_internal
+}  // namespace cloud
+}  // namespace google
+
+#endif  // GOOGLE_CLOUD_CPP_GOOGLE_CLOUD_STORAGE_INTERNAL_ASYNC_CONNECTION_READ_CACHE_H
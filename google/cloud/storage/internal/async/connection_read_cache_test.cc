@@ -0,0 +1,208 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/storage/internal/async/connection_read_cache.h"
+#include "google/cloud/storage/mocks/mock_async_connection.h"
+#include "google/cloud/storage/options.h"
+#include "google/cloud/storage/testing/canonical_errors.h"
+#include "google/cloud/internal/make_status.h"
+#include "google/cloud/testing_util/status_matchers.h"
+#include "absl/strings/str_join.h"
+#include <gmock/gmock.h>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace google {
+namespace cloud {
+namespace storage_internal {
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_BEGIN
+namespace {
+
+using ::google::cloud::storage::testing::canonical_errors::PermanentError;
+using ::google::cloud::storage_experimental::AsyncConnection;
+using ::google::cloud::storage_experimental::ReadPayload;
+using ::google::cloud::storage_mocks::MockAsyncConnection;
+using ::google::cloud::testing_util::StatusIs;
+using ::testing::ElementsAre;
+using ::testing::Pair;
+using ::testing::Return;
+
+auto constexpr kBlockSize = 8;
+
+std::string const& Contents() {
+  static auto const* const kContents =
+      new std::string("0123456789abcdefghij");
+  return *kContents;
+}
+
+using Ranges = std::vector<std::pair<std::int64_t, std::int64_t>>;
+
+// Configures @p mock to serve `Contents()` and record the requested ranges.
+void ServeContents(MockAsyncConnection& mock, Ranges& ranges) {
+  EXPECT_CALL(mock, ReadObjectRange)
+      .WillRepeatedly([&ranges](AsyncConnection::ReadObjectParams const& p) {
+        auto const offset = p.request.read_offset();
+        auto const limit = p.request.read_limit();
+        ranges.emplace_back(offset, limit);
+        auto const size = static_cast<std::int64_t>(Contents().size());
+        if (offset >= size) {
+          return make_ready_future(
+              StatusOr<ReadPayload>(google::cloud::internal::OutOfRangeError(
+                  "past the end", GCP_ERROR_INFO())));
+        }
+        google::storage::v2::Object metadata;
+        metadata.set_size(size);
+        return make_ready_future(make_status_or(
+            ReadPayload(Contents().substr(static_cast<std::size_t>(offset),
+                                          static_cast<std::size_t>(limit)))
+                .set_offset(offset)
+                .set_metadata(std::move(metadata))));
+      });
+}
+
+std::shared_ptr<AsyncConnection> MakeTestConnection(
+    std::shared_ptr<MockAsyncConnection> mock) {
+  return MakeReadCacheAsyncConnection(
+      std::move(mock), std::make_shared<ObjectReadCache>(::testing::TempDir(),
+                                                         1024, kBlockSize));
+}
+
+AsyncConnection::ReadObjectParams MakeParams(std::int64_t offset,
+                                             std::int64_t limit) {
+  AsyncConnection::ReadObjectParams p;
+  p.request.set_bucket("projects/_/buckets/test-bucket");
+  p.request.set_object("test-object");
+  p.request.set_generation(1234);
+  p.request.set_read_offset(offset);
+  p.request.set_read_limit(limit);
+  return p;
+}
+
+std::string Join(ReadPayload const& payload) {
+  return absl::StrJoin(payload.contents(), "");
+}
+
+TEST(AsyncConnectionReadCache, FullRead) {
+  auto mock = std::make_shared<MockAsyncConnection>();
+  Ranges ranges;
+  ServeContents(*mock, ranges);
+  auto connection = MakeTestConnection(mock);
+
+  auto payload = connection->ReadObjectRange(MakeParams(0, 0)).get();
+  ASSERT_STATUS_OK(payload);
+  EXPECT_EQ(Join(*payload), Contents());
+  EXPECT_EQ(payload->offset(), 0);
+  ASSERT_TRUE(payload->metadata().has_value());
+  EXPECT_EQ(payload->metadata()->generation(), 1234);
+  EXPECT_EQ(payload->metadata()->size(), 20);
+  EXPECT_THAT(ranges, ElementsAre(Pair(0, 8), Pair(8, 8), Pair(16, 8)));
+
+  ranges.clear();
+  payload = connection->ReadObjectRange(MakeParams(0, 0)).get();
+  ASSERT_STATUS_OK(payload);
+  EXPECT_EQ(Join(*payload), Contents());
+  EXPECT_THAT(ranges, ElementsAre());
+}
+
+TEST(AsyncConnectionReadCache, PartialHitFetchesMissingBlocks) {
+  auto mock = std::make_shared<MockAsyncConnection>();
+  Ranges ranges;
+  ServeContents(*mock, ranges);
+  auto connection = MakeTestConnection(mock);
+
+  auto payload = connection->ReadObjectRange(MakeParams(2, 8)).get();
+  ASSERT_STATUS_OK(payload);
+  EXPECT_EQ(Join(*payload), Contents().substr(2, 8));
+  EXPECT_EQ(payload->offset(), 2);
+  EXPECT_THAT(ranges, ElementsAre(Pair(0, 8), Pair(8, 8)));
+
+  ranges.clear();
+  payload = connection->ReadObjectRange(MakeParams(6, 0)).get();
+  ASSERT_STATUS_OK(payload);
+  EXPECT_EQ(Join(*payload), Contents().substr(6));
+  EXPECT_THAT(ranges, ElementsAre(Pair(16, 8)));
+}
+
+TEST(AsyncConnectionReadCache, OffsetPastEnd) {
+  auto mock = std::make_shared<MockAsyncConnection>();
+  Ranges ranges;
+  ServeContents(*mock, ranges);
+  auto connection = MakeTestConnection(mock);
+
+  auto payload = connection->ReadObjectRange(MakeParams(40, 0)).get();
+  EXPECT_THAT(payload, StatusIs(StatusCode::kOutOfRange));
+}
+
+TEST(AsyncConnectionReadCache, ErrorsAreReported) {
+  auto mock = std::make_shared<MockAsyncConnection>();
+  EXPECT_CALL(*mock, ReadObjectRange).Times(2).WillRepeatedly([] {
+    return make_ready_future(StatusOr<ReadPayload>(PermanentError()));
+  });
+  auto connection = MakeTestConnection(mock);
+
+  for (int i = 0; i != 2; ++i) {
+    auto payload = connection->ReadObjectRange(MakeParams(0, 0)).get();
+    EXPECT_THAT(payload, StatusIs(PermanentError().code()));
+  }
+}
+
+TEST(AsyncConnectionReadCache, BypassWithoutGeneration) {
+  auto mock = std::make_shared<MockAsyncConnection>();
+  EXPECT_CALL(*mock, ReadObjectRange)
+      .WillOnce([](AsyncConnection::ReadObjectParams const& p) {
+        EXPECT_EQ(p.request.read_offset(), 2);
+        EXPECT_EQ(p.request.read_limit(), 0);
+        return make_ready_future(StatusOr<ReadPayload>(PermanentError()));
+      });
+  auto connection = MakeTestConnection(mock);
+
+  auto p = MakeParams(2, 0);
+  p.request.clear_generation();
+  auto payload = connection->ReadObjectRange(std::move(p)).get();
+  EXPECT_THAT(payload, StatusIs(PermanentError().code()));
+}
+
+TEST(AsyncConnectionReadCache, BypassWithPreconditions) {
+  auto mock = std::make_shared<MockAsyncConnection>();
+  EXPECT_CALL(*mock, ReadObjectRange)
+      .WillOnce([](AsyncConnection::ReadObjectParams const& p) {
+        EXPECT_EQ(p.request.read_limit(), 0);
+        return make_ready_future(StatusOr<ReadPayload>(PermanentError()));
+      });
+  auto connection = MakeTestConnection(mock);
+
+  auto p = MakeParams(2, 0);
+  p.request.set_if_metageneration_match(7);
+  auto payload = connection->ReadObjectRange(std::move(p)).get();
+  EXPECT_THAT(payload, StatusIs(PermanentError().code()));
+}
+
+TEST(AsyncConnectionReadCache, MakeReadCacheAsyncConnection) {
+  auto mock = std::make_shared<MockAsyncConnection>();
+  EXPECT_CALL(*mock, options).WillOnce(Return(Options{}));
+  EXPECT_EQ(MakeReadCacheAsyncConnection(mock), mock);
+
+  EXPECT_CALL(*mock, options)
+      .WillOnce(Return(
+          Options{}.set<storage_experimental::ReadCacheDirectoryOption>(
+              ::testing::TempDir())));
+  EXPECT_NE(MakeReadCacheAsyncConnection(mock), mock);
+}
+
+}  // namespace
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
+}  // namespace storage_internal
+}  // namespace cloud
+}  // namespace google
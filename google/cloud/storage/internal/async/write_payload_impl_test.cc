@@ -13,8 +13,10 @@
 // limitations under the License.
 
 #include "google/cloud/storage/internal/async/write_payload_impl.h"
+#include "google/cloud/storage/testing/temp_file.h"
 #include "google/cloud/internal/absl_str_join_quiet.h"
 #include "google/cloud/internal/random.h"
+#include "google/cloud/testing_util/status_matchers.h"
 #include <gmock/gmock.h>
 
 namespace google {
@@ -23,6 +25,7 @@ namespace storage_internal {
 GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_BEGIN
 namespace {
 
+using ::google::cloud::testing_util::StatusIs;
 using ::testing::IsEmpty;
 using ::testing::Not;
 
@@ -51,6 +54,23 @@ TEST(WritePayloadImpl, GetImpl) {
   EXPECT_EQ(WritePayloadImpl::GetImpl(actual), absl::Cord(expected));
 }
 
+TEST(WritePayloadImpl, MakeWritePayloadFromFile) {
+  auto const contents =
+      std::string{"The quick brown fox jumps over the lazy dog"};
+  storage::testing::TempFile temp(contents);
+  auto actual = storage_experimental::MakeWritePayloadFromFile(temp.name(), 4);
+#if _WIN32
+  EXPECT_THAT(actual, StatusIs(StatusCode::kUnimplemented));
+#else
+  ASSERT_STATUS_OK(actual);
+  EXPECT_EQ(WritePayloadImpl::GetImpl(*actual), contents.substr(4));
+
+  actual = storage_experimental::MakeWritePayloadFromFile(
+      temp.name(), contents.size() + 1);
+  EXPECT_THAT(actual, StatusIs(StatusCode::kInvalidArgument));
+#endif  // _WIN32
+}
+
 }  // namespace
 GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
 }  // namespace storage_internal
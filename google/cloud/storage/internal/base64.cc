@@ -14,6 +14,7 @@
 
 #include "google/cloud/storage/internal/base64.h"
 #include "google/cloud/internal/base64_transforms.h"
+#include "absl/strings/string_view.h"
 #include <algorithm>
 #include <memory>
 #include <string>
@@ -31,15 +32,12 @@ StatusOr<std::vector<std::uint8_t>> Base64Decode(std::string const& str) {
 }
 
 std::string Base64Encode(std::string const& str) {
-  google::cloud::internal::Base64Encoder enc;
-  for (auto c : str) enc.PushBack(c);
-  return std::move(enc).FlushAndPad();
+  return google::cloud::internal::Base64Encode(str);
 }
 
 std::string Base64Encode(absl::Span<std::uint8_t const> bytes) {
-  google::cloud::internal::Base64Encoder enc;
-  for (auto c : bytes) enc.PushBack(c);
-  return std::move(enc).FlushAndPad();
+  return google::cloud::internal::Base64Encode(absl::string_view(
+      reinterpret_cast<char const*>(bytes.data()), bytes.size()));
 }
 
 StatusOr<std::vector<std::uint8_t>> UrlsafeBase64Decode(
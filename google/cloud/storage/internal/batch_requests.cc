@@ -0,0 +1,67 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/storage/internal/batch_requests.h"
+#include <iostream>
+
+namespace google {
+namespace cloud {
+namespace storage {
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_BEGIN
+namespace internal {
+namespace {
+
+struct PrintResult {
+  std::ostream& os;
+
+  void operator()(absl::monostate) const { os << "{}"; }
+  template <typename T>
+  void operator()(T const& v) const {
+    os << v;
+  }
+};
+
+}  // namespace
+
+std::ostream& operator<<(std::ostream& os, BatchRequest const& r) {
+  os << "BatchRequest={requests={";
+  char const* sep = "";
+  for (auto const& request : r.requests) {
+    os << sep;
+    absl::visit([&os](auto const& v) { os << v; }, request);
+    sep = ", ";
+  }
+  return os << "}}";
+}
+
+std::ostream& operator<<(std::ostream& os, BatchResponse const& r) {
+  os << "BatchResponse={results={";
+  char const* sep = "";
+  for (auto const& result : r.results) {
+    os << sep;
+    if (result) {
+      absl::visit(PrintResult{os}, *result);
+    } else {
+      os << result.status();
+    }
+    sep = ", ";
+  }
+  return os << "}}";
+}
+
+}  // namespace internal
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
+}  // namespace storage
+}  // namespace cloud
+}  // namespace google
@@ -0,0 +1,75 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GOOGLE_CLOUD_CPP_GOOGLE_CLOUD_STORAGE_INTERNAL_BATCH_REQUESTS_H
+#define GOOGLE_CLOUD_CPP_GOOGLE_CLOUD_STORAGE_INTERNAL_BATCH_REQUESTS_H
+
+#include "google/cloud/storage/internal/object_acl_requests.h"
+#include "google/cloud/storage/internal/object_requests.h"
+#include "google/cloud/storage/object_access_control.h"
+#include "google/cloud/storage/object_metadata.h"
+#include "google/cloud/storage/version.h"
+#include "google/cloud/status_or.h"
+#include "absl/types/variant.h"
+#include <cstddef>
+#include <iosfwd>
+#include <vector>
+
+namespace google {
+namespace cloud {
+namespace storage {
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_BEGIN
+namespace internal {
+
+/// The maximum number of calls in a single JSON batch request.
+auto constexpr kMaxBatchSize = std::size_t{100};
+
+/// The requests that can be included in a JSON batch request.
+using BatchedRequest =
+    absl::variant<DeleteObjectRequest, PatchObjectRequest,
+                  DeleteObjectAclRequest, UpdateObjectAclRequest>;
+
+/**
+ * The result of a single call in a JSON batch request.
+ *
+ * Calls that return no data, such as deletes, produce `absl::monostate`.
+ */
+using BatchedResult = StatusOr<
+    absl::variant<absl::monostate, ObjectMetadata, ObjectAccessControl>>;
+
+/**
+ * Represents a request to the JSON batch API.
+ *
+ * @see https://cloud.google.com/storage/docs/batch
+ */
+struct BatchRequest {
+  std::vector<BatchedRequest> requests;
+};
+
+std::ostream& operator<<(std::ostream& os, BatchRequest const& r);
+
+/// The per-call results of a JSON batch request, in the order of the calls.
+struct BatchResponse {
+  std::vector<BatchedResult> results;
+};
+
+std::ostream& operator<<(std::ostream& os, BatchResponse const& r);
+
+}  // namespace internal
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
+}  // namespace storage
+}  // namespace cloud
+}  // namespace google
+
+#endif  // GOOGLE_CLOUD_CPP_GOOGLE_CLOUD_STORAGE_INTERNAL_BATCH_REQUESTS_H
@@ -16,6 +16,7 @@
 #include "google/cloud/storage/internal/connection_impl.h"
 #include "google/cloud/storage/internal/generic_stub_adapter.h"
 #include "google/cloud/storage/internal/generic_stub_factory.h"
+#include "google/cloud/storage/internal/read_cache_connection.h"
 #include "google/cloud/storage/internal/tracing_connection.h"
 #include "google/cloud/internal/opentelemetry.h"
 #include <memory>
@@ -37,6 +38,7 @@ std::shared_ptr<storage::internal::StorageConnection> MakeStorageConnection(
     Options const& opts, std::unique_ptr<storage_internal::GenericStub> stub) {
   std::shared_ptr<storage::internal::StorageConnection> connection =
       storage::internal::StorageConnectionImpl::Create(std::move(stub), opts);
+  connection = MakeReadCacheConnection(opts, std::move(connection));
   if (google::cloud::internal::TracingEnabled(opts)) {
     connection = storage_internal::MakeTracingClient(std::move(connection));
   }
@@ -13,16 +13,19 @@
 // limitations under the License.
 
 #include "google/cloud/storage/internal/connection_impl.h"
+#include "google/cloud/storage/internal/memory_mapped_file.h"
 #include "google/cloud/storage/internal/retry_object_read_source.h"
 #include "google/cloud/internal/filesystem.h"
 #include "google/cloud/internal/opentelemetry.h"
 #include "google/cloud/internal/rest_retry_loop.h"
 #include "google/cloud/log.h"
 #include "absl/strings/match.h"
+#include <algorithm>
 #include <chrono>
 #include <fstream>
 #include <functional>
 #include <memory>
+#include <numeric>
 #include <sstream>
 #include <string>
 #include <thread>
@@ -141,6 +144,17 @@ Status PartialWriteStatus(int error_count, int upload_count,
 
 auto constexpr kIdempotencyTokenHeader = "x-goog-gcs-idempotency-token";
 
+// Maps @p file_name if `EnableMemoryMappedUploadsOption` is set. On any errors,
+// including files that are not regular files, the caller reads the file with
+// `std::ifstream`, which reports them.
+std::shared_ptr<MemoryMappedFile> MaybeMapFile(std::string const& file_name) {
+  auto const& current = google::cloud::internal::CurrentOptions();
+  if (!current.get<EnableMemoryMappedUploadsOption>()) return nullptr;
+  auto file = MemoryMappedFile::Open(file_name);
+  if (!file) return nullptr;
+  return *std::move(file);
+}
+
 }  // namespace
 
 std::shared_ptr<StorageConnectionImpl> StorageConnectionImpl::Create(
@@ -773,6 +787,15 @@ StatusOr<std::unique_ptr<std::string>> StorageConnectionImpl::UploadFileSimple(
       request.GetOption<UploadLimit>().value_or(file_size - upload_offset),
       file_size - upload_offset);
 
+  auto file = MaybeMapFile(file_name);
+  if (file && file->size() >= upload_offset + upload_size) {
+    request.set_payload(file->contents().substr(
+        static_cast<std::size_t>(upload_offset),
+        static_cast<std::size_t>(upload_size)));
+    request.set_payload_owner(std::move(file));
+    return std::unique_ptr<std::string>();
+  }
+
   std::ifstream is(file_name, std::ios::binary);
   if (!is.is_open()) {
     std::ostringstream os;
@@ -840,6 +863,11 @@ integrity checks using the DisableMD5Hash() and DisableCrc32cChecksum() options.
         file_size - upload_offset);
     request.set_option(UploadContentLength(upload_size));
   }
+  if (auto file = MaybeMapFile(file_name)) {
+    auto source = std::make_unique<MemoryMappedFileStream>(std::move(file));
+    source->seekg(upload_offset, std::ios::beg);
+    return std::unique_ptr<std::istream>(std::move(source));
+  }
   auto source = std::make_unique<std::ifstream>(file_name, std::ios::binary);
   if (!source->is_open()) {
     std::ostringstream os;
@@ -1319,6 +1347,61 @@ StatusOr<EmptyResponse> StorageConnectionImpl::DeleteNotification(
       google::cloud::internal::CurrentOptions(), request, __func__);
 }
 
+// The JSON batch API returns a result for each call. Only the calls that fail
+// with a transient error, and that are idempotent, are included in the next
+// batch. The retry policy sees one failure for each round of retries.
+StatusOr<BatchResponse> StorageConnectionImpl::ExecuteBatch(
+    BatchRequest const& request) {
+  auto const& current = google::cloud::internal::CurrentOptions();
+  std::function<void(std::chrono::milliseconds)> sleeper =
+      [](std::chrono::milliseconds d) { std::this_thread::sleep_for(d); };
+  sleeper = google::cloud::internal::MakeTracedSleeper(
+      current, std::move(sleeper), "Backoff");
+  auto retry_policy = current_retry_policy();
+  auto backoff_policy = current_backoff_policy();
+  auto is_idempotent = [](BatchedRequest const& r) {
+    return absl::visit(
+        [](auto const& r) {
+          return current_idempotency_policy().IsIdempotent(r);
+        },
+        r);
+  };
+
+  BatchResponse response;
+  response.results.resize(request.requests.size());
+  std::vector<std::size_t> pending(request.requests.size());
+  std::iota(pending.begin(), pending.end(), std::size_t{0});
+  while (!pending.empty()) {
+    std::vector<std::size_t> retry;
+    Status last_status;
+    for (std::size_t offset = 0; offset < pending.size();
+         offset += kMaxBatchSize) {
+      auto const end = (std::min)(pending.size(), offset + kMaxBatchSize);
+      BatchRequest batch;
+      for (auto i = offset; i != end; ++i) {
+        batch.requests.push_back(request.requests[pending[i]]);
+      }
+      rest_internal::RestContext context(current);
+      auto r = stub_->ExecuteBatch(context, current, batch);
+      for (auto i = offset; i != end; ++i) {
+        auto const index = pending[i];
+        auto& result = response.results[index];
+        result = r ? std::move(r->results[i - offset]) : r.status();
+        if (result || retry_policy->IsPermanentFailure(result.status()) ||
+            !is_idempotent(request.requests[index])) {
+          continue;
+        }
+        last_status = result.status();
+        retry.push_back(index);
+      }
+    }
+    if (retry.empty() || !retry_policy->OnFailure(last_status)) break;
+    sleeper(backoff_policy->OnCompletion());
+    pending = std::move(retry);
+  }
+  return response;
+}
+
 std::vector<std::string> StorageConnectionImpl::InspectStackStructure() const {
   auto stack = stub_->InspectStackStructure();
   stack.emplace_back("StorageConnectionImpl");
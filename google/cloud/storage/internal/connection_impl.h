@@ -164,6 +164,8 @@ class StorageConnectionImpl
   StatusOr<EmptyResponse> DeleteNotification(
       DeleteNotificationRequest const&) override;
 
+  StatusOr<BatchResponse> ExecuteBatch(BatchRequest const& request) override;
+
   std::vector<std::string> InspectStackStructure() const override;
 
  private:
@@ -0,0 +1,184 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/storage/internal/batch_requests.h"
+#include "google/cloud/storage/internal/connection_impl.h"
+#include "google/cloud/storage/testing/canonical_errors.h"
+#include "google/cloud/storage/testing/mock_generic_stub.h"
+#include "google/cloud/storage/testing/retry_tests.h"
+#include "google/cloud/testing_util/status_matchers.h"
+#include <gmock/gmock.h>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace google {
+namespace cloud {
+namespace storage {
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_BEGIN
+namespace internal {
+namespace {
+
+using ::google::cloud::storage::testing::MockGenericStub;
+using ::google::cloud::storage::testing::RetryTestOptions;
+using ::google::cloud::storage::testing::canonical_errors::PermanentError;
+using ::google::cloud::storage::testing::canonical_errors::TransientError;
+using ::google::cloud::testing_util::IsOk;
+using ::google::cloud::testing_util::StatusIs;
+using ::testing::ElementsAre;
+using ::testing::Return;
+using ::testing::SizeIs;
+
+std::string ObjectName(BatchedRequest const& r) {
+  return absl::get<DeleteObjectRequest>(r).object_name();
+}
+
+std::vector<std::string> ObjectNames(BatchRequest const& r) {
+  std::vector<std::string> names;
+  for (auto const& request : r.requests) names.push_back(ObjectName(request));
+  return names;
+}
+
+BatchedResult Success() {
+  return BatchedResult::value_type(absl::monostate{});
+}
+
+BatchedResult Failure(Status status) { return status; }
+
+BatchRequest MakeDeletes(int count) {
+  BatchRequest request;
+  for (int i = 0; i != count; ++i) {
+    request.requests.emplace_back(
+        DeleteObjectRequest("test-bucket", "object-" + std::to_string(i)));
+  }
+  return request;
+}
+
+TEST(StorageConnectionImpl, ExecuteBatchSuccess) {
+  auto mock = std::make_unique<MockGenericStub>();
+  EXPECT_CALL(*mock, options);
+  EXPECT_CALL(*mock, ExecuteBatch)
+      .WillOnce([](rest_internal::RestContext&, Options const&,
+                   BatchRequest const& r) {
+        EXPECT_THAT(ObjectNames(r), ElementsAre("object-0", "object-1"));
+        return BatchResponse{{Success(), Success()}};
+      });
+  auto client =
+      StorageConnectionImpl::Create(std::move(mock), RetryTestOptions());
+  google::cloud::internal::OptionsSpan span(client->options());
+  auto response = client->ExecuteBatch(MakeDeletes(2));
+  ASSERT_STATUS_OK(response);
+  EXPECT_THAT(response->results, ElementsAre(IsOk(), IsOk()));
+}
+
+TEST(StorageConnectionImpl, ExecuteBatchRetriesFailedCalls) {
+  auto mock = std::make_unique<MockGenericStub>();
+  EXPECT_CALL(*mock, options);
+  EXPECT_CALL(*mock, ExecuteBatch)
+      .WillOnce([](rest_internal::RestContext&, Options const&,
+                   BatchRequest const& r) {
+        EXPECT_THAT(ObjectNames(r),
+                    ElementsAre("object-0", "object-1", "object-2"));
+        return BatchResponse{{Success(), Failure(TransientError()),
+                              Failure(PermanentError())}};
+      })
+      .WillOnce([](rest_internal::RestContext&, Options const&,
+                   BatchRequest const& r) {
+        EXPECT_THAT(ObjectNames(r), ElementsAre("object-1"));
+        return BatchResponse{{Success()}};
+      });
+  auto client =
+      StorageConnectionImpl::Create(std::move(mock), RetryTestOptions());
+  google::cloud::internal::OptionsSpan span(client->options());
+  auto response = client->ExecuteBatch(MakeDeletes(3));
+  ASSERT_STATUS_OK(response);
+  EXPECT_THAT(response->results,
+              ElementsAre(IsOk(), IsOk(), StatusIs(PermanentError().code())));
+}
+
+TEST(StorageConnectionImpl, ExecuteBatchTooManyFailures) {
+  auto mock = std::make_unique<MockGenericStub>();
+  EXPECT_CALL(*mock, options);
+  EXPECT_CALL(*mock, ExecuteBatch)
+      .Times(3)
+      .WillRepeatedly(Return(StatusOr<BatchResponse>(TransientError())));
+  auto client =
+      StorageConnectionImpl::Create(std::move(mock), RetryTestOptions());
+  google::cloud::internal::OptionsSpan span(client->options());
+  auto response = client->ExecuteBatch(MakeDeletes(2));
+  ASSERT_STATUS_OK(response);
+  EXPECT_THAT(response->results,
+              ElementsAre(StatusIs(TransientError().code()),
+                          StatusIs(TransientError().code())));
+}
+
+TEST(StorageConnectionImpl, ExecuteBatchNonIdempotent) {
+  auto mock = std::make_unique<MockGenericStub>();
+  EXPECT_CALL(*mock, options);
+  EXPECT_CALL(*mock, ExecuteBatch)
+      .WillOnce([](rest_internal::RestContext&, Options const&,
+                   BatchRequest const& r) {
+        EXPECT_THAT(ObjectNames(r), ElementsAre("object-0", "object-1"));
+        return BatchResponse{
+            {Failure(TransientError()), Failure(TransientError())}};
+      })
+      .WillOnce([](rest_internal::RestContext&, Options const&,
+                   BatchRequest const& r) {
+        EXPECT_THAT(ObjectNames(r), ElementsAre("object-1"));
+        return BatchResponse{{Success()}};
+      });
+  auto client = StorageConnectionImpl::Create(
+      std::move(mock),
+      RetryTestOptions().set<IdempotencyPolicyOption>(
+          StrictIdempotencyPolicy().clone()));
+  google::cloud::internal::OptionsSpan span(client->options());
+  auto request = MakeDeletes(2);
+  // Only deletes with a pre-condition are idempotent with the strict policy.
+  absl::get<DeleteObjectRequest>(request.requests[1])
+      .set_option(Generation(1234));
+  auto response = client->ExecuteBatch(request);
+  ASSERT_STATUS_OK(response);
+  EXPECT_THAT(response->results,
+              ElementsAre(StatusIs(TransientError().code()), IsOk()));
+}
+
+TEST(StorageConnectionImpl, ExecuteBatchSplitsLargeBatches) {
+  auto mock = std::make_unique<MockGenericStub>();
+  EXPECT_CALL(*mock, options);
+  std::vector<std::size_t> sizes;
+  EXPECT_CALL(*mock, ExecuteBatch)
+      .Times(3)
+      .WillRepeatedly([&sizes](rest_internal::RestContext&, Options const&,
+                               BatchRequest const& r) {
+        sizes.push_back(r.requests.size());
+        BatchResponse response;
+        response.results.resize(r.requests.size(), Success());
+        return response;
+      });
+  auto client =
+      StorageConnectionImpl::Create(std::move(mock), RetryTestOptions());
+  google::cloud::internal::OptionsSpan span(client->options());
+  auto response = client->ExecuteBatch(MakeDeletes(250));
+  ASSERT_STATUS_OK(response);
+  EXPECT_THAT(response->results, SizeIs(250));
+  EXPECT_THAT(sizes, ElementsAre(kMaxBatchSize, kMaxBatchSize, 50));
+}
+
+}  // namespace
+}  // namespace internal
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
+}  // namespace storage
+}  // namespace cloud
+}  // namespace google
@@ -13,6 +13,8 @@
 // limitations under the License.
 
 #include "google/cloud/storage/internal/connection_impl.h"
+#include "google/cloud/storage/internal/memory_mapped_file.h"
+#include "google/cloud/storage/options.h"
 #include "google/cloud/storage/testing/mock_generic_stub.h"
 #include "google/cloud/storage/testing/temp_file.h"
 #include "google/cloud/testing_util/status_matchers.h"
@@ -144,6 +146,43 @@ TEST_F(ConnectionImplFileUploadTest, UploadFileResumableWithLimit) {
   EXPECT_EQ("01234", actual);
 }
 
+#if !_WIN32
+
+TEST_F(ConnectionImplFileUploadTest, UploadFileSimpleMemoryMapped) {
+  std::shared_ptr<StorageConnectionImpl> connection = MakeConnection();
+  std::string const contents = std::string{"0123456789"};
+  TempFile temp(contents);
+  InsertObjectMediaRequest request("test-bucket", "test-object", "");
+  request.set_multiple_options(UploadFromOffset(2), UploadLimit(5));
+  google::cloud::internal::OptionsSpan span(
+      Options{}.set<EnableMemoryMappedUploadsOption>(true));
+  auto payload =
+      connection->UploadFileSimple(temp.name(), contents.size(), request);
+  ASSERT_STATUS_OK(payload);
+  // The connection sets the payload to the mapped pages.
+  EXPECT_EQ(*payload, nullptr);
+  EXPECT_EQ(request.payload(), "23456");
+  EXPECT_NE(request.payload_owner(), nullptr);
+}
+
+TEST_F(ConnectionImplFileUploadTest, UploadFileResumableMemoryMapped) {
+  std::shared_ptr<StorageConnectionImpl> connection = MakeConnection();
+  std::string const contents = std::string{"0123456789"};
+  TempFile temp(contents);
+  ResumableUploadRequest request("test-bucket", "test-object");
+  request.set_option(UploadFromOffset(2));
+  google::cloud::internal::OptionsSpan span(
+      Options{}.set<EnableMemoryMappedUploadsOption>(true));
+  auto stream = connection->UploadFileResumable(temp.name(), request);
+  ASSERT_STATUS_OK(stream);
+  EXPECT_EQ(request.GetOption<UploadContentLength>().value_or(0), 8);
+  auto* mapped = MemoryMappedFileStream::FromStream(**stream);
+  ASSERT_NE(mapped, nullptr);
+  EXPECT_EQ(mapped->Consume(100), "23456789");
+}
+
+#endif  // !_WIN32
+
 }  // namespace
 }  // namespace internal
 GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
@@ -17,6 +17,7 @@
 
 #include "google/cloud/storage/bucket_metadata.h"
 #include "google/cloud/storage/client_options.h"
+#include "google/cloud/storage/internal/batch_requests.h"
 #include "google/cloud/storage/internal/bucket_acl_requests.h"
 #include "google/cloud/storage/internal/bucket_requests.h"
 #include "google/cloud/storage/internal/default_object_acl_requests.h"
@@ -32,6 +33,7 @@
 #include "google/cloud/storage/oauth2/credentials.h"
 #include "google/cloud/storage/object_metadata.h"
 #include "google/cloud/storage/service_account.h"
+#include "google/cloud/internal/make_status.h"
 #include "google/cloud/internal/rest_context.h"
 #include "google/cloud/options.h"
 #include "google/cloud/status.h"
@@ -260,6 +262,19 @@ class GenericStub {
       storage::internal::DeleteNotificationRequest const&) = 0;
   ///@}
 
+  /**
+   * Executes multiple calls using the JSON batch API.
+   *
+   * Only the REST transport supports batch requests.
+   */
+  virtual StatusOr<storage::internal::BatchResponse> ExecuteBatch(
+      rest_internal::RestContext&, Options const&,
+      storage::internal::BatchRequest const&) {
+    return google::cloud::internal::UnimplementedError(
+        "JSON batch requests are not supported by this transport",
+        GCP_ERROR_INFO());
+  }
+
   // Test-only. Returns the names of the decorator stack elements.
   virtual std::vector<std::string> InspectStackStructure() const = 0;
 };
@@ -330,6 +330,12 @@ class GenericStubAdapter : public GenericStub {
     return impl_->DeleteNotification(request);
   }
 
+  StatusOr<storage::internal::BatchResponse> ExecuteBatch(
+      rest_internal::RestContext&, Options const&,
+      storage::internal::BatchRequest const& request) override {
+    return impl_->ExecuteBatch(request);
+  }
+
   std::vector<std::string> InspectStackStructure() const override {
     auto stack = impl_->InspectStackStructure();
     stack.emplace_back("GenericStubAdapter");
@@ -15,6 +15,7 @@
 #include "google/cloud/storage/internal/grpc/buffer_read_object_data.h"
 #include "google/cloud/storage/internal/grpc/make_cord.h"
 #include <algorithm>
+#include <utility>
 
 namespace google {
 namespace cloud {
@@ -41,10 +42,25 @@ std::size_t GrpcBufferReadObjectData::HandleResponse(char* buffer,
 std::size_t GrpcBufferReadObjectData::HandleResponse(char* buffer,
                                                      std::size_t n,
                                                      absl::Cord contents) {
-  contents_ = std::move(contents);
+  Save(std::move(contents));
   return FillBuffer(buffer, n);
 }
 
+absl::Cord GrpcBufferReadObjectData::Extract(std::size_t n) {
+  if (n >= contents_.size()) return std::exchange(contents_, absl::Cord());
+  auto prefix = contents_.Subcord(0, n);
+  contents_.RemovePrefix(n);
+  return prefix;
+}
+
+void GrpcBufferReadObjectData::Save(std::string contents) {
+  Save(MakeCord(std::move(contents)));
+}
+
+void GrpcBufferReadObjectData::Save(absl::Cord contents) {
+  contents_.Append(std::move(contents));
+}
+
 }  // namespace storage_internal
 }  // namespace cloud
 }  // namespace google
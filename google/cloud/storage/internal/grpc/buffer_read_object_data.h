@@ -63,6 +63,15 @@ class GrpcBufferReadObjectData {
    */
   std::size_t HandleResponse(char* buffer, std::size_t n, absl::Cord contents);
 
+  /// Remove up to @p n bytes from the internal buffers, without copying them.
+  absl::Cord Extract(std::size_t n);
+
+  /// Save @p contents in the internal buffers, see `HandleResponse()`.
+  void Save(std::string contents);
+
+  /// Save @p contents in the internal buffers, see `HandleResponse()`.
+  void Save(absl::Cord contents);
+
  private:
   absl::Cord contents_;
 };
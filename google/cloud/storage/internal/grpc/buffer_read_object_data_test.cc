@@ -64,6 +64,23 @@ TEST(GrpcBufferReadObjectData, SimpleCord) {
   EXPECT_EQ(actual, contents);
 }
 
+TEST(GrpcBufferReadObjectData, Extract) {
+  GrpcBufferReadObjectData buffer;
+  auto const contents =
+      std::string{"The quick brown fox jumps over the lazy fox"};
+  buffer.Save(contents.substr(0, 20));
+  buffer.Save(absl::Cord(contents.substr(20)));
+
+  auto constexpr kBufferSize = 8;
+  auto actual = std::string{};
+  for (auto c = buffer.Extract(kBufferSize); !c.empty();
+       c = buffer.Extract(kBufferSize)) {
+    EXPECT_LE(c.size(), kBufferSize);
+    actual += std::string(c);
+  }
+  EXPECT_EQ(actual, contents);
+}
+
 }  // namespace
 }  // namespace storage_internal
 }  // namespace cloud
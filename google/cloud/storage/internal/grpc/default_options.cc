@@ -65,9 +65,13 @@ Options DefaultOptionsGrpc(
   // Experiments show that gRPC gets better upload throughput when the upload
   // buffer is at least 32MiB.
   auto constexpr kDefaultGrpcUploadBufferSize = 32 * 1024 * 1024L;
+  auto constexpr kDefaultWriteBufferPoolSize = 32 * 1024 * 1024L;
   options = google::cloud::internal::MergeOptions(
-      std::move(options), Options{}.set<storage::UploadBufferSizeOption>(
-                              kDefaultGrpcUploadBufferSize));
+      std::move(options),
+      Options{}
+          .set<storage::UploadBufferSizeOption>(kDefaultGrpcUploadBufferSize)
+          .set<storage_experimental::GrpcWriteBufferPoolSizeOption>(
+              kDefaultWriteBufferPoolSize));
   options =
       storage::internal::DefaultOptionsWithCredentials(std::move(options));
   if (!options.has<UnifiedCredentialsOption>() &&
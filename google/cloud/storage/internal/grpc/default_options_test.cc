@@ -148,6 +148,19 @@ TEST(DefaultOptionsGrpc, DefaultOptionsUploadBuffer) {
   EXPECT_EQ(with_override, 256 * 1024L);
 }
 
+TEST(DefaultOptionsGrpc, DefaultOptionsWriteBufferPool) {
+  auto const with_defaults =
+      DefaultOptionsGrpc(Options{})
+          .get<storage_experimental::GrpcWriteBufferPoolSizeOption>();
+  EXPECT_EQ(with_defaults, 32 * 1024 * 1024L);
+
+  auto const disabled =
+      DefaultOptionsGrpc(
+          Options{}.set<storage_experimental::GrpcWriteBufferPoolSizeOption>(0))
+          .get<storage_experimental::GrpcWriteBufferPoolSizeOption>();
+  EXPECT_EQ(disabled, 0);
+}
+
 TEST(DefaultOptionsGrpc, GrpcEnableMetricsIsSafe) {
   EXPECT_FALSE(GrpcEnableMetricsIsSafe(0, 1, 1));
   EXPECT_FALSE(GrpcEnableMetricsIsSafe(0, 65, 1));
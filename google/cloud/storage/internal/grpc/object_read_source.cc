@@ -41,11 +41,31 @@ StatusOr<storage::internal::HttpResponse> GrpcObjectReadSource::Close() {
 /// codes.
 StatusOr<storage::internal::ReadSourceResult> GrpcObjectReadSource::Read(
     char* buf, std::size_t n) {
+  return ReadImpl(n, [&](std::size_t offset) {
+    return buffer_.FillBuffer(buf + offset, n - offset);
+  });
+}
+
+StatusOr<storage::internal::ReadSourceResult> GrpcObjectReadSource::ReadChunk(
+    std::size_t n) {
+  absl::Cord contents;
+  auto result = ReadImpl(n, [&](std::size_t offset) {
+    auto chunk = buffer_.Extract(n - offset);
+    auto const size = chunk.size();
+    contents.Append(std::move(chunk));
+    return size;
+  });
+  if (result) result->contents = std::move(contents);
+  return result;
+}
+
+StatusOr<storage::internal::ReadSourceResult> GrpcObjectReadSource::ReadImpl(
+    std::size_t n, FillFunction fill) {
   using google::storage::v2::ReadObjectResponse;
 
   storage::internal::ReadSourceResult result;
   result.response.status_code = storage::internal::HttpStatusCode::kContinue;
-  result.bytes_received = buffer_.FillBuffer(buf, n);
+  result.bytes_received = fill(0);
 
   while (result.bytes_received < n && stream_) {
     auto watchdog = timer_source_().then([this](auto f) {
@@ -73,7 +93,7 @@ StatusOr<storage::internal::ReadSourceResult> GrpcObjectReadSource::Read(
       if (!status_.ok()) return status_;
       return result;
     }
-    HandleResponse(result, buf, n,
+    HandleResponse(result, fill,
                    absl::get<ReadObjectResponse>(std::move(data)));
   }
 
@@ -81,15 +101,13 @@ StatusOr<storage::internal::ReadSourceResult> GrpcObjectReadSource::Read(
 }
 
 void GrpcObjectReadSource::HandleResponse(
-    storage::internal::ReadSourceResult& result, char* buf, std::size_t n,
+    storage::internal::ReadSourceResult& result, FillFunction fill,
     google::storage::v2::ReadObjectResponse response) {
   // The google.storage.v1.Storage documentation says this field can be
   // empty.
   if (response.has_checksummed_data()) {
-    auto const offset = result.bytes_received;
-    result.bytes_received += buffer_.HandleResponse(
-        buf + offset, n - offset,
-        StealMutableContent(*response.mutable_checksummed_data()));
+    buffer_.Save(StealMutableContent(*response.mutable_checksummed_data()));
+    result.bytes_received += fill(result.bytes_received);
   }
   if (response.has_object_checksums()) {
     auto const& checksums = response.object_checksums();
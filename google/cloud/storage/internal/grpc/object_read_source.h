@@ -64,9 +64,21 @@ class GrpcObjectReadSource : public storage::internal::ObjectReadSource {
   StatusOr<storage::internal::ReadSourceResult> Read(char* buf,
                                                      std::size_t n) override;
 
+  /// Read more data, returning the `absl::Cord` received from gRPC without
+  /// copying it.
+  StatusOr<storage::internal::ReadSourceResult> ReadChunk(
+      std::size_t n) override;
+
  private:
-  void HandleResponse(storage::internal::ReadSourceResult& result, char* buf,
-                      std::size_t n,
+  // Moves data from `buffer_` to the destination of a `Read*()` call. The
+  // argument is the number of bytes already received, the function returns
+  // the number of bytes moved.
+  using FillFunction = absl::FunctionRef<std::size_t(std::size_t)>;
+
+  StatusOr<storage::internal::ReadSourceResult> ReadImpl(std::size_t n,
+                                                         FillFunction fill);
+  void HandleResponse(storage::internal::ReadSourceResult& result,
+                      FillFunction fill,
                       google::storage::v2::ReadObjectResponse response);
 
   TimerSource timer_source_;
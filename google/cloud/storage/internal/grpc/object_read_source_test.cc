@@ -156,6 +156,41 @@ TEST(GrpcObjectReadSource, UseSpillBuffer) {
   EXPECT_STATUS_OK(status);
 }
 
+TEST(GrpcObjectReadSource, ReadChunk) {
+  auto mock = std::make_unique<MockObjectMediaStream>();
+  std::string const expected_1 = "0123456789";
+  std::string const expected_2 = " The quick brown fox jumps over the lazy dog";
+
+  ::testing::InSequence sequence;
+  EXPECT_CALL(*mock, Read)
+      .WillOnce([&] {
+        storage_proto::ReadObjectResponse response;
+        SetContent(response, expected_1 + expected_2);
+        return response;
+      })
+      .WillOnce(Return(Status{}));
+  EXPECT_CALL(*mock, GetRequestMetadata).WillOnce(Return(RpcMetadata{}));
+  GrpcObjectReadSource tested(MakeSimpleTimerSource(), std::move(mock));
+  auto response = tested.ReadChunk(expected_1.size());
+  ASSERT_STATUS_OK(response);
+  EXPECT_EQ(expected_1.size(), response->bytes_received);
+  EXPECT_EQ(expected_1, std::string(response->contents));
+
+  // The remaining data is returned from the spill buffer.
+  response = tested.ReadChunk(1024);
+  ASSERT_STATUS_OK(response);
+  EXPECT_EQ(expected_2.size(), response->bytes_received);
+  EXPECT_EQ(expected_2, std::string(response->contents));
+
+  response = tested.ReadChunk(1024);
+  ASSERT_STATUS_OK(response);
+  EXPECT_EQ(0, response->bytes_received);
+  EXPECT_TRUE(response->contents.empty());
+
+  auto status = tested.Close();
+  EXPECT_STATUS_OK(status);
+}
+
 TEST(GrpcObjectReadSource, UseSpillBufferMany) {
   auto mock = std::make_unique<MockObjectMediaStream>();
   std::string const contents = "0123456789";
@@ -47,12 +47,41 @@ template <>
 absl::Cord SplitObjectWriteData<absl::Cord>::Next() {
   auto constexpr kMax = static_cast<std::size_t>(
       google::storage::v2::ServiceConstants::MAX_WRITE_CHUNK_BYTES);
+  static_assert(kMax == WriteBufferPool::kMaxBufferSize,
+                "the pool buffers must fit a full chunk");
+  if (!owner_ && pool_) {
+    // Copy the chunk into a single pooled buffer, even if it spans multiple
+    // elements in `buffers_`.
+    std::size_t n = 0;
+    for (auto const& b : buffers_) n += b.size();
+    n = (std::min)(n, kMax);
+    if (n < WriteBufferPool::kMinPooledSize) n = 0;
+    if (n != 0) {
+      auto buffer = pool_->Acquire(n);
+      std::size_t offset = 0;
+      while (offset != n) {
+        auto& b = buffers_.front();
+        auto const m = (std::min)(n - offset, b.size());
+        std::copy_n(b.begin(), m, buffer.data.get() + offset);
+        offset += m;
+        if (b.size() == m) {
+          buffers_.erase(buffers_.begin());
+          continue;
+        }
+        b = storage::internal::ConstBuffer(b.data() + m, b.size() - m);
+      }
+      return pool_->MakeCord(std::move(buffer), n);
+    }
+  }
   absl::Cord result;
   while (result.size() != kMax && !buffers_.empty()) {
     auto& b = buffers_.front();
     // Add as much as possible from `b` without exceeding `kMax`.
     auto n = (std::min)(kMax - result.size(), b.size());
-    if (n != 0) {
+    if (n != 0 && owner_) {
+      result.Append(absl::MakeCordFromExternal(
+          absl::string_view{b.data(), n}, [o = owner_]() mutable {}));
+    } else if (n != 0) {
       // We need a container which guarantees the pointer is stable under move
       // construction. `std::vector<>` does not provide that guarantee. Use
       // `std::unique_ptr<char[]>`. Do not use `std::make_unique<char[]> as that
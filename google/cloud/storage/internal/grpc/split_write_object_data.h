@@ -16,31 +16,50 @@
 #define GOOGLE_CLOUD_CPP_GOOGLE_CLOUD_STORAGE_INTERNAL_GRPC_SPLIT_WRITE_OBJECT_DATA_H
 
 #include "google/cloud/storage/internal/const_buffer.h"
+#include "google/cloud/storage/internal/grpc/write_buffer_pool.h"
 #include "google/cloud/version.h"
 #include "absl/strings/cord.h"
 #include "absl/strings/string_view.h"
+#include <memory>
 #include <string>
+#include <utility>
 
 namespace google {
 namespace cloud {
 namespace storage_internal {
 GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_BEGIN
 
+/**
+ * Splits the payload of an upload into `WriteObjectRequest`-sized chunks.
+ *
+ * If @p owner is set, it owns the memory referenced by the buffers, and the
+ * `absl::Cord` chunks reference this memory (keeping @p owner alive) instead
+ * of copying it. Otherwise, if @p pool is set, the `absl::Cord` chunks are
+ * copied into buffers from this pool.
+ */
 template <typename ReturnType>
 class SplitObjectWriteData {
  public:
-  explicit SplitObjectWriteData(absl::string_view buffer)
-      : buffers_({buffer}) {}
+  explicit SplitObjectWriteData(absl::string_view buffer,
+                                std::shared_ptr<void const> owner = {},
+                                std::shared_ptr<WriteBufferPool> pool = {})
+      : buffers_({buffer}), owner_(std::move(owner)), pool_(std::move(pool)) {}
 
   explicit SplitObjectWriteData(
-      google::cloud::storage::internal::ConstBufferSequence buffers)
-      : buffers_(std::move(buffers)) {}
+      google::cloud::storage::internal::ConstBufferSequence buffers,
+      std::shared_ptr<void const> owner = {},
+      std::shared_ptr<WriteBufferPool> pool = {})
+      : buffers_(std::move(buffers)),
+        owner_(std::move(owner)),
+        pool_(std::move(pool)) {}
 
   bool Done() const { return buffers_.empty(); }
   ReturnType Next();
 
  private:
   google::cloud::storage::internal::ConstBufferSequence buffers_;
+  std::shared_ptr<void const> owner_;
+  std::shared_ptr<WriteBufferPool> pool_;
 };
 
 template <>
@@ -0,0 +1,112 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/storage/internal/grpc/split_write_object_data.h"
+#include "google/cloud/storage/internal/grpc/write_buffer_pool.h"
+#include <benchmark/benchmark.h>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <string>
+
+namespace {
+
+std::atomic<std::int64_t> allocation_count{0};
+std::atomic<std::int64_t> allocated_bytes{0};
+
+}  // namespace
+
+// Count all the allocations in the process, including the ones in the library.
+void* operator new(std::size_t size) {
+  allocation_count.fetch_add(1, std::memory_order_relaxed);
+  allocated_bytes.fetch_add(static_cast<std::int64_t>(size),
+                            std::memory_order_relaxed);
+  auto* p = std::malloc(size == 0 ? 1 : size);
+  if (p == nullptr) std::abort();
+  return p;
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+namespace google {
+namespace cloud {
+namespace storage_internal {
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_BEGIN
+namespace {
+
+// Compare the allocations needed to split uploads into `WriteObjectRequest`
+// chunks, with and without a `WriteBufferPool`. The data is not owned by the
+// library, as in `ObjectWriteStream` uploads, so each chunk is a copy.
+//
+// Run on (1 X 2100 MHz CPU )
+// CPU Caches:
+//   L1 Data 48 KiB (x1)
+//   L1 Instruction 32 KiB (x1)
+//   L2 Unified 2048 KiB (x1)
+//   L3 Unified 307200 KiB (x1)
+// ----------------------------------------------------------------------
+// Benchmark                    Time             CPU   Iterations
+// ----------------------------------------------------------------------
+// BM_SplitWithoutPool    1581478 ns      1577316 ns          433
+//     allocated_bytes_per_chunk=2.09719M allocations_per_chunk=2.125
+// BM_SplitWithPool       1635617 ns      1617060 ns          442
+//     allocated_bytes_per_chunk=659.117 allocations_per_chunk=1.12557
+
+auto constexpr kChunkSize = WriteBufferPool::kMaxBufferSize;
+auto constexpr kUploadSize = 8 * kChunkSize;
+
+void RunUploads(benchmark::State& state,
+                std::shared_ptr<WriteBufferPool> const& pool) {
+  auto const data = std::string(kUploadSize, 'a');
+  std::int64_t chunks = 0;
+  auto const count = allocation_count.load();
+  auto const bytes = allocated_bytes.load();
+  for (auto _ : state) {
+    auto splitter =
+        SplitObjectWriteData<absl::Cord>(absl::string_view(data), {}, pool);
+    while (!splitter.Done()) {
+      // The chunk is released as soon as it is "sent", as it would be after
+      // gRPC serializes the request.
+      auto chunk = splitter.Next();
+      benchmark::DoNotOptimize(chunk);
+      ++chunks;
+    }
+  }
+  if (chunks == 0) return;
+  state.counters["allocations_per_chunk"] =
+      static_cast<double>(allocation_count.load() - count) /
+      static_cast<double>(chunks);
+  state.counters["allocated_bytes_per_chunk"] =
+      static_cast<double>(allocated_bytes.load() - bytes) /
+      static_cast<double>(chunks);
+}
+
+void BM_SplitWithoutPool(benchmark::State& state) {
+  RunUploads(state, nullptr);
+}
+BENCHMARK(BM_SplitWithoutPool);
+
+void BM_SplitWithPool(benchmark::State& state) {
+  RunUploads(state, WriteBufferPool::Create(4 * kChunkSize));
+}
+BENCHMARK(BM_SplitWithPool);
+
+}  // namespace
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
+}  // namespace storage_internal
+}  // namespace cloud
+}  // namespace google
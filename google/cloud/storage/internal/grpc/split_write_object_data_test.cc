@@ -15,6 +15,9 @@
 #include "google/cloud/storage/internal/grpc/split_write_object_data.h"
 #include "google/cloud/internal/random.h"
 #include <gmock/gmock.h>
+#include <memory>
+#include <string>
+#include <vector>
 
 namespace google {
 namespace cloud {
@@ -139,6 +142,48 @@ TEST(SplitWriteObjectRequestCord, MultipleBuffer) {
                   data.substr(3 * kExpectedChunkSize)));
 }
 
+TEST(SplitWriteObjectRequestCord, WithOwner) {
+  auto generator = DefaultPRNG(std::random_device{}());
+  auto const owner = std::make_shared<std::string>(
+      RandomData(generator, kExpectedChunkSize + kExpectedChunkSize / 2));
+  auto const& data = *owner;
+  auto tested = SplitObjectWriteData<absl::Cord>(data, owner);
+  std::vector<absl::Cord> actual;
+  while (!tested.Done()) actual.push_back(tested.Next());
+  ASSERT_THAT(actual, ElementsAre(data.substr(0, kExpectedChunkSize),
+                                  data.substr(kExpectedChunkSize)));
+  // The chunks reference the data in `owner`, without copying it.
+  EXPECT_EQ(actual[0].chunk_begin()->data(), data.data());
+  EXPECT_EQ(actual[1].chunk_begin()->data(), data.data() + kExpectedChunkSize);
+  // One reference in this function, one in `tested`, one for each chunk.
+  EXPECT_EQ(owner.use_count(), 4);
+  actual.clear();
+  EXPECT_EQ(owner.use_count(), 2);
+}
+
+TEST(SplitWriteObjectRequestCord, WithPool) {
+  auto generator = DefaultPRNG(std::random_device{}());
+  auto const d0 = RandomData(generator, kExpectedChunkSize / 2);
+  auto const d1 = RandomData(generator, kExpectedChunkSize);
+  auto const data = d0 + d1;
+  auto pool = WriteBufferPool::Create(4 * kExpectedChunkSize);
+  auto split = [&] {
+    auto tested = SplitObjectWriteData<absl::Cord>(
+        {ConstBuffer(d0), ConstBuffer(d1)}, {}, pool);
+    std::vector<std::string> actual;
+    while (!tested.Done()) actual.emplace_back(tested.Next());
+    return actual;
+  };
+  EXPECT_THAT(split(), ElementsAre(data.substr(0, kExpectedChunkSize),
+                                   data.substr(kExpectedChunkSize)));
+  EXPECT_EQ(pool->stats().misses, 2);
+  // The second upload reuses the buffers released by the first one.
+  EXPECT_THAT(split(), ElementsAre(data.substr(0, kExpectedChunkSize),
+                                   data.substr(kExpectedChunkSize)));
+  EXPECT_EQ(pool->stats().misses, 2);
+  EXPECT_EQ(pool->stats().hits, 2);
+}
+
 }  // namespace
 GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
 }  // namespace storage_internal
@@ -178,7 +178,8 @@ using ::google::cloud::internal::MakeBackgroundThreadsFactory;
 GrpcStub::GrpcStub(Options opts)
     : options_(std::move(opts)),
       background_(MakeBackgroundThreadsFactory(options_)()),
-      iam_stub_(CreateStorageIamStub(background_->cq(), options_)) {
+      iam_stub_(CreateStorageIamStub(background_->cq(), options_)),
+      write_buffer_pool_(MakeWriteBufferPool(options_)) {
   std::tie(refresh_, stub_) = CreateStorageStub(background_->cq(), options_);
 }
 
@@ -189,7 +190,8 @@ GrpcStub::GrpcStub(
     : options_(std::move(opts)),
       background_(MakeBackgroundThreadsFactory(options_)()),
       stub_(std::move(stub)),
-      iam_stub_(std::move(iam)) {}
+      iam_stub_(std::move(iam)),
+      write_buffer_pool_(MakeWriteBufferPool(options_)) {}
 
 Options GrpcStub::options() const { return options_; }
 
@@ -341,7 +343,8 @@ StatusOr<storage::ObjectMetadata> GrpcStub::InsertObjectMedia(
   ApplyRoutingHeaders(*ctx, request);
   auto stream = stub_->WriteObject(std::move(ctx), options);
 
-  auto splitter = SplitObjectWriteData<ContentType>(request.payload());
+  auto splitter = SplitObjectWriteData<ContentType>(
+      request.payload(), request.payload_owner(), write_buffer_pool_);
   std::int64_t offset = 0;
 
   // This loop must run at least once because we need to send at least one
@@ -620,7 +623,8 @@ StatusOr<storage::internal::QueryResumableUploadResponse> GrpcStub::UploadChunk(
   ApplyRoutingHeaders(*ctx, request);
   auto stream = stub_->WriteObject(std::move(ctx), options);
 
-  auto splitter = SplitObjectWriteData<ContentType>(request.payload());
+  auto splitter = SplitObjectWriteData<ContentType>(
+      request.payload(), request.payload_owner(), write_buffer_pool_);
   auto offset = request.offset();
 
   // This loop must run at least once because we need to send at least one
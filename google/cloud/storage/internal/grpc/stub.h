@@ -31,6 +31,7 @@ namespace cloud {
 namespace storage_internal {
 GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_BEGIN
 class GrpcChannelRefresh;
+class WriteBufferPool;
 class StorageStub;
 
 class GrpcStub : public GenericStub {
@@ -290,6 +291,7 @@ class GrpcStub : public GenericStub {
   std::shared_ptr<storage_internal::GrpcChannelRefresh> refresh_;
   std::shared_ptr<storage_internal::StorageStub> stub_;
   std::shared_ptr<google::cloud::internal::MinimalIamCredentialsStub> iam_stub_;
+  std::shared_ptr<WriteBufferPool> write_buffer_pool_;
 };
 
 GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
@@ -0,0 +1,125 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/storage/internal/grpc/write_buffer_pool.h"
+#include "google/cloud/storage/grpc_plugin.h"
+#include <algorithm>
+
+namespace google {
+namespace cloud {
+namespace storage_internal {
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_BEGIN
+namespace {
+
+std::size_t SizeClass(std::size_t size) {
+  std::size_t c = 0;
+  for (auto capacity = WriteBufferPool::kMinBufferSize; capacity < size;
+       capacity *= 2) {
+    ++c;
+  }
+  return c;
+}
+
+std::size_t ClassCapacity(std::size_t c) {
+  return WriteBufferPool::kMinBufferSize << c;
+}
+
+}  // namespace
+
+std::size_t constexpr WriteBufferPool::kMaxBufferSize;
+std::size_t constexpr WriteBufferPool::kMinBufferSize;
+std::size_t constexpr WriteBufferPool::kMinPooledSize;
+std::size_t constexpr WriteBufferPool::kSizeClasses;
+
+static_assert(WriteBufferPool::kMinBufferSize << 5 ==
+                  WriteBufferPool::kMaxBufferSize,
+              "size classes must cover [kMinBufferSize, kMaxBufferSize]");
+
+double HitRate(WriteBufferPoolStats const& stats) {
+  auto const total = stats.hits + stats.misses;
+  if (total == 0) return 0.0;
+  return static_cast<double>(stats.hits) / static_cast<double>(total);
+}
+
+std::shared_ptr<WriteBufferPool> WriteBufferPool::Create(
+    std::size_t max_pooled_bytes) {
+  return std::shared_ptr<WriteBufferPool>(
+      new WriteBufferPool(max_pooled_bytes));
+}
+
+WriteBufferPool::Buffer WriteBufferPool::Acquire(std::size_t size) {
+  auto const c = SizeClass(size);
+  auto const capacity = c < kSizeClasses ? ClassCapacity(c) : size;
+  std::unique_lock<std::mutex> lk(mu_);
+  if (c < kSizeClasses && !free_[c].empty()) {
+    auto data = std::move(free_[c].back());
+    free_[c].pop_back();
+    stats_.pooled_bytes -= capacity;
+    ++stats_.hits;
+    return Buffer{std::move(data), capacity};
+  }
+  ++stats_.misses;
+  lk.unlock();
+  // Do not use `std::make_unique<char[]>()`, it zero-initializes the buffer
+  // and we are just going to overwrite the bytes.
+  return Buffer{std::unique_ptr<char[]>(new char[capacity]), capacity};
+}
+
+void WriteBufferPool::Release(Buffer buffer) {
+  auto const c = SizeClass(buffer.capacity);
+  if (!buffer.data || c >= kSizeClasses) return;
+  if (ClassCapacity(c) != buffer.capacity) return;
+  std::lock_guard<std::mutex> lk(mu_);
+  if (stats_.pooled_bytes + buffer.capacity > max_pooled_bytes_) return;
+  stats_.pooled_bytes += buffer.capacity;
+  free_[c].push_back(std::move(buffer.data));
+}
+
+absl::Cord WriteBufferPool::MakeCord(Buffer buffer, std::size_t size) {
+  auto contents = absl::string_view{buffer.data.get(), size};
+  return absl::MakeCordFromExternal(
+      contents, [self = shared_from_this(), b = std::move(buffer)]() mutable {
+        self->Release(std::move(b));
+      });
+}
+
+absl::Cord WriteBufferPool::Copy(absl::string_view data) {
+  if (data.size() < kMinPooledSize) return absl::Cord(data);
+  absl::Cord result;
+  while (!data.empty()) {
+    auto const n = (std::min)(data.size(), kMaxBufferSize);
+    auto buffer = Acquire(n);
+    std::copy_n(data.data(), n, buffer.data.get());
+    result.Append(MakeCord(std::move(buffer), n));
+    data.remove_prefix(n);
+  }
+  return result;
+}
+
+WriteBufferPoolStats WriteBufferPool::stats() const {
+  std::lock_guard<std::mutex> lk(mu_);
+  return stats_;
+}
+
+std::shared_ptr<WriteBufferPool> MakeWriteBufferPool(Options const& options) {
+  auto const size =
+      options.get<storage_experimental::GrpcWriteBufferPoolSizeOption>();
+  if (size == 0) return nullptr;
+  return WriteBufferPool::Create(size);
+}
+
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
+}  // namespace storage_internal
+}  // namespace cloud
+}  // namespace google
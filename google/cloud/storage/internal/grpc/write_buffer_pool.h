@@ -0,0 +1,119 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GOOGLE_CLOUD_CPP_GOOGLE_CLOUD_STORAGE_INTERNAL_GRPC_WRITE_BUFFER_POOL_H
+#define GOOGLE_CLOUD_CPP_GOOGLE_CLOUD_STORAGE_INTERNAL_GRPC_WRITE_BUFFER_POOL_H
+
+#include "google/cloud/options.h"
+#include "google/cloud/version.h"
+#include "absl/strings/cord.h"
+#include "absl/strings/string_view.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace google {
+namespace cloud {
+namespace storage_internal {
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_BEGIN
+
+/// Counters to evaluate the effectiveness of a `WriteBufferPool`.
+struct WriteBufferPoolStats {
+  /// The number of buffers reused from the pool.
+  std::uint64_t hits = 0;
+  /// The number of buffers allocated because the pool had none available.
+  std::uint64_t misses = 0;
+  /// The total capacity of the buffers currently in the pool.
+  std::size_t pooled_bytes = 0;
+};
+
+/// The fraction of buffer requests satisfied by the pool.
+double HitRate(WriteBufferPoolStats const& stats);
+
+/**
+ * A pool of reusable buffers for the payload of `WriteObjectRequest` messages.
+ *
+ * Uploads copy the application data into chunks of up to
+ * `MAX_WRITE_CHUNK_BYTES`. Allocating a new buffer for each chunk churns a lot
+ * of memory through the allocator when there are many concurrent uploads. This
+ * pool keeps released buffers in a few size classes, and returns them to the
+ * pool when the `absl::Cord` referencing them is destroyed.
+ *
+ * The total capacity of the buffers kept in the pool is bounded, any buffers
+ * released when the pool is full are deallocated.
+ */
+class WriteBufferPool : public std::enable_shared_from_this<WriteBufferPool> {
+ public:
+  /// The largest buffer managed by the pool, matches `MAX_WRITE_CHUNK_BYTES`.
+  static std::size_t constexpr kMaxBufferSize = 2 * 1024 * 1024;
+  /// The smallest buffer managed by the pool.
+  static std::size_t constexpr kMinBufferSize = 64 * 1024;
+  /// Smaller payloads are copied into the `absl::Cord` directly.
+  static std::size_t constexpr kMinPooledSize = 16 * 1024;
+
+  /// A buffer with at least the requested size.
+  struct Buffer {
+    std::unique_ptr<char[]> data;
+    std::size_t capacity = 0;
+  };
+
+  static std::shared_ptr<WriteBufferPool> Create(std::size_t max_pooled_bytes);
+
+  /// Returns a buffer with at least @p size bytes.
+  Buffer Acquire(std::size_t size);
+
+  /// Returns @p buffer to the pool, or deallocates it if the pool is full.
+  void Release(Buffer buffer);
+
+  /**
+   * Creates a `absl::Cord` with the first @p size bytes of @p buffer.
+   *
+   * The buffer is returned to the pool when the `absl::Cord`, and any other
+   * `absl::Cord` sharing its contents, are destroyed.
+   */
+  absl::Cord MakeCord(Buffer buffer, std::size_t size);
+
+  /// Copies @p data into one or more pooled buffers.
+  absl::Cord Copy(absl::string_view data);
+
+  WriteBufferPoolStats stats() const;
+
+ private:
+  static std::size_t constexpr kSizeClasses = 6;
+
+  explicit WriteBufferPool(std::size_t max_pooled_bytes)
+      : max_pooled_bytes_(max_pooled_bytes) {}
+
+  std::size_t const max_pooled_bytes_;
+  mutable std::mutex mu_;
+  std::array<std::vector<std::unique_ptr<char[]>>, kSizeClasses> free_;
+  WriteBufferPoolStats stats_;
+};
+
+/**
+ * Creates the pool configured by `GrpcWriteBufferPoolSizeOption`.
+ *
+ * Returns `nullptr` if the option disables the pool.
+ */
+std::shared_ptr<WriteBufferPool> MakeWriteBufferPool(Options const& options);
+
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
+}  // namespace storage_internal
+}  // namespace cloud
+}  // namespace google
+
+#endif  // GOOGLE_CLOUD_CPP_GOOGLE_CLOUD_STORAGE_INTERNAL_GRPC_WRITE_BUFFER_POOL_H
@@ -0,0 +1,121 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/storage/internal/grpc/write_buffer_pool.h"
+#include "google/cloud/storage/grpc_plugin.h"
+#include <gmock/gmock.h>
+#include <string>
+#include <vector>
+
+namespace google {
+namespace cloud {
+namespace storage_internal {
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_BEGIN
+namespace {
+
+auto constexpr kKiB = 1024;
+auto constexpr kMiB = 1024 * kKiB;
+
+TEST(WriteBufferPool, AcquireUsesSizeClasses) {
+  auto pool = WriteBufferPool::Create(8 * kMiB);
+  EXPECT_EQ(pool->Acquire(0).capacity, 64 * kKiB);
+  EXPECT_EQ(pool->Acquire(64 * kKiB).capacity, 64 * kKiB);
+  EXPECT_EQ(pool->Acquire(64 * kKiB + 1).capacity, 128 * kKiB);
+  EXPECT_EQ(pool->Acquire(2 * kMiB).capacity, 2 * kMiB);
+  // Larger buffers are allocated with the exact size, and never pooled.
+  auto large = pool->Acquire(3 * kMiB);
+  EXPECT_EQ(large.capacity, 3 * kMiB);
+  pool->Release(std::move(large));
+  EXPECT_EQ(pool->stats().pooled_bytes, 0);
+  EXPECT_EQ(pool->stats().misses, 5);
+}
+
+TEST(WriteBufferPool, ReleaseAndReuse) {
+  auto pool = WriteBufferPool::Create(8 * kMiB);
+  auto b = pool->Acquire(kMiB);
+  auto const* data = b.data.get();
+  pool->Release(std::move(b));
+  EXPECT_EQ(pool->stats().pooled_bytes, kMiB);
+
+  auto reused = pool->Acquire(kMiB - 1);
+  EXPECT_EQ(reused.data.get(), data);
+  auto const stats = pool->stats();
+  EXPECT_EQ(stats.hits, 1);
+  EXPECT_EQ(stats.misses, 1);
+  EXPECT_EQ(stats.pooled_bytes, 0);
+  EXPECT_DOUBLE_EQ(HitRate(stats), 0.5);
+}
+
+TEST(WriteBufferPool, ReleaseRespectsLimit) {
+  auto pool = WriteBufferPool::Create(3 * kMiB);
+  auto b0 = pool->Acquire(2 * kMiB);
+  auto b1 = pool->Acquire(2 * kMiB);
+  pool->Release(std::move(b0));
+  pool->Release(std::move(b1));
+  EXPECT_EQ(pool->stats().pooled_bytes, 2 * kMiB);
+}
+
+TEST(WriteBufferPool, CordReleasesBuffer) {
+  auto pool = WriteBufferPool::Create(8 * kMiB);
+  auto const data = std::string(3 * kMiB, 'A');
+  {
+    auto cord = pool->Copy(data);
+    EXPECT_EQ(std::string(cord), data);
+    // Copies of the Cord share the buffers.
+    auto copy = cord;
+    cord.Clear();
+    EXPECT_EQ(pool->stats().pooled_bytes, 0);
+    EXPECT_EQ(std::string(copy), data);
+  }
+  // Two buffers: 2 MiB and 1 MiB.
+  EXPECT_EQ(pool->stats().pooled_bytes, 3 * kMiB);
+  EXPECT_EQ(pool->stats().misses, 2);
+
+  auto again = pool->Copy(data);
+  EXPECT_EQ(pool->stats().hits, 2);
+  EXPECT_EQ(pool->stats().pooled_bytes, 0);
+}
+
+TEST(WriteBufferPool, CordOutlivesPool) {
+  auto pool = WriteBufferPool::Create(8 * kMiB);
+  auto const data = std::string(kMiB, 'B');
+  auto cord = pool->Copy(data);
+  pool.reset();
+  EXPECT_EQ(std::string(cord), data);
+}
+
+TEST(WriteBufferPool, SmallCopiesAreNotPooled) {
+  auto pool = WriteBufferPool::Create(8 * kMiB);
+  auto cord = pool->Copy("small");
+  EXPECT_EQ(std::string(cord), "small");
+  EXPECT_EQ(pool->stats().misses, 0);
+  EXPECT_EQ(pool->stats().hits, 0);
+}
+
+TEST(WriteBufferPool, MakeFromOptions) {
+  EXPECT_EQ(MakeWriteBufferPool(Options{}.set<
+                                storage_experimental::
+                                    GrpcWriteBufferPoolSizeOption>(0)),
+            nullptr);
+  EXPECT_NE(MakeWriteBufferPool(Options{}.set<
+                                storage_experimental::
+                                    GrpcWriteBufferPoolSizeOption>(kMiB)),
+            nullptr);
+}
+
+}  // namespace
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
+}  // namespace storage_internal
+}  // namespace cloud
+}  // namespace google
@@ -604,6 +604,16 @@ StatusOr<EmptyResponse> LoggingStub::DeleteNotification(
       context, options, request, __func__);
 }
 
+StatusOr<BatchResponse> LoggingStub::ExecuteBatch(
+    rest_internal::RestContext& context, Options const& options,
+    BatchRequest const& request) {
+  return LogWrapper(
+      [this](auto& context, auto const& options, auto& request) {
+        return stub_->ExecuteBatch(context, options, request);
+      },
+      context, options, request, __func__);
+}
+
 std::vector<std::string> LoggingStub::InspectStackStructure() const {
   auto stack = stub_->InspectStackStructure();
   stack.emplace_back("LoggingStub");
@@ -209,6 +209,10 @@ class LoggingStub : public storage_internal::GenericStub {
       rest_internal::RestContext&, Options const&,
       DeleteNotificationRequest const&) override;
 
+  StatusOr<BatchResponse> ExecuteBatch(rest_internal::RestContext&,
+                                       Options const&,
+                                       BatchRequest const&) override;
+
   std::vector<std::string> InspectStackStructure() const override;
 
  private:
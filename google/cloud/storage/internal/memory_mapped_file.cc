@@ -0,0 +1,179 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/storage/internal/memory_mapped_file.h"
+#include "google/cloud/internal/make_status.h"
+#include "google/cloud/internal/strerror.h"
+#include <algorithm>
+#include <cerrno>
+#include <utility>
+#if _WIN32
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif  // _WIN32
+
+namespace google {
+namespace cloud {
+namespace storage {
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_BEGIN
+namespace internal {
+
+#if _WIN32
+
+StatusOr<std::shared_ptr<MemoryMappedFile>> MemoryMappedFile::Open(
+    std::string const& file_name) {
+  return google::cloud::internal::UnimplementedError(
+      "memory mapped files are not supported on this platform",
+      GCP_ERROR_INFO().WithMetadata("gl-cpp.file_name", file_name));
+}
+
+MemoryMappedFile::~MemoryMappedFile() = default;
+
+#else
+
+namespace {
+
+Status OsError(char const* function, std::string const& file_name) {
+  auto const e = errno;
+  auto msg = std::string{function} + "() failed for " + file_name + ": " +
+             google::cloud::internal::strerror(e);
+  auto info = GCP_ERROR_INFO().WithMetadata("gl-cpp.file_name", file_name);
+  if (e == ENOENT) {
+    return google::cloud::internal::NotFoundError(std::move(msg),
+                                                  std::move(info));
+  }
+  if (e == EACCES || e == EPERM) {
+    return google::cloud::internal::PermissionDeniedError(std::move(msg),
+                                                          std::move(info));
+  }
+  return google::cloud::internal::UnknownError(std::move(msg),
+                                               std::move(info));
+}
+
+}  // namespace
+
+StatusOr<std::shared_ptr<MemoryMappedFile>> MemoryMappedFile::Open(
+    std::string const& file_name) {
+  // Opening a FIFO for reading blocks until there is a writer, `O_NONBLOCK`
+  // returns immediately, so the FIFO can be rejected below.
+  auto fd = ::open(file_name.c_str(), O_RDONLY | O_NONBLOCK);
+  if (fd == -1) return OsError("open", file_name);
+  struct stat s {};
+  if (::fstat(fd, &s) == -1) {
+    auto status = OsError("fstat", file_name);
+    ::close(fd);
+    return status;
+  }
+  // Pipes, devices, and other special files cannot be mapped, or their size is
+  // not the size of their contents.
+  if (!S_ISREG(s.st_mode)) {
+    ::close(fd);
+    return google::cloud::internal::InvalidArgumentError(
+        "cannot map " + file_name + ": not a regular file",
+        GCP_ERROR_INFO().WithMetadata("gl-cpp.file_name", file_name));
+  }
+  auto const size = static_cast<std::size_t>(s.st_size);
+  // `mmap()` rejects empty ranges, an empty file does not need a mapping.
+  if (size == 0) {
+    ::close(fd);
+    return std::shared_ptr<MemoryMappedFile>(new MemoryMappedFile(nullptr, 0));
+  }
+  auto* data = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  // The mapping remains valid after the file descriptor is closed.
+  auto status = data == MAP_FAILED ? OsError("mmap", file_name) : Status{};
+  ::close(fd);
+  if (!status.ok()) return status;
+  // This is only a hint, ignore any errors.
+  (void)::madvise(data, size, MADV_SEQUENTIAL);
+  return std::shared_ptr<MemoryMappedFile>(
+      new MemoryMappedFile(static_cast<char const*>(data), size));
+}
+
+MemoryMappedFile::~MemoryMappedFile() {
+  if (data_ == nullptr) return;
+  ::munmap(const_cast<char*>(data_), size_);
+}
+
+#endif  // _WIN32
+
+absl::Cord MemoryMappedFile::Subcord(std::size_t offset, std::size_t n) {
+  offset = (std::min)(offset, size_);
+  n = (std::min)(n, size_ - offset);
+  if (n == 0) return absl::Cord();
+  return absl::MakeCordFromExternal(absl::string_view(data_ + offset, n),
+                                    [self = shared_from_this()] {});
+}
+
+MemoryMappedFileStream::MemoryMappedFileStream(
+    std::shared_ptr<MemoryMappedFile> file)
+    : std::istream(nullptr), file_(std::move(file)), buf_(file_->contents()) {
+  rdbuf(&buf_);
+  pword(StreamIndex()) = this;
+}
+
+MemoryMappedFileStream* MemoryMappedFileStream::FromStream(std::istream& is) {
+  return static_cast<MemoryMappedFileStream*>(is.pword(StreamIndex()));
+}
+
+int MemoryMappedFileStream::StreamIndex() {
+  static auto const kIndex = std::ios_base::xalloc();
+  return kIndex;
+}
+
+MemoryMappedFileStream::Streambuf::Streambuf(absl::string_view contents) {
+  // The get area is never modified, `std::streambuf` only uses non-const
+  // pointers for historical reasons.
+  auto* begin = const_cast<char*>(contents.data());
+  setg(begin, begin, begin + contents.size());
+}
+
+absl::string_view MemoryMappedFileStream::Streambuf::Consume(std::size_t n) {
+  n = (std::min)(n, static_cast<std::size_t>(egptr() - gptr()));
+  auto result = absl::string_view(gptr(), n);
+  setg(eback(), gptr() + n, egptr());
+  return result;
+}
+
+MemoryMappedFileStream::Streambuf::pos_type
+MemoryMappedFileStream::Streambuf::seekoff(off_type off,
+                                           std::ios_base::seekdir dir,
+                                           std::ios_base::openmode which) {
+  if ((which & std::ios_base::in) == 0) return pos_type(off_type(-1));
+  auto const size = static_cast<off_type>(egptr() - eback());
+  auto base = off_type{0};
+  if (dir == std::ios_base::cur) base = static_cast<off_type>(gptr() - eback());
+  if (dir == std::ios_base::end) base = size;
+  auto const pos = base + off;
+  if (pos < 0) return pos_type(off_type(-1));
+  // Like `std::ifstream`, seeking past the end is not an error, the next read
+  // returns no data.
+  auto const actual = (std::min)(pos, size);
+  setg(eback(), eback() + actual, egptr());
+  return pos_type(actual);
+}
+
+MemoryMappedFileStream::Streambuf::pos_type
+MemoryMappedFileStream::Streambuf::seekpos(pos_type pos,
+                                           std::ios_base::openmode which) {
+  return seekoff(off_type(pos), std::ios_base::beg, which);
+}
+
+}  // namespace internal
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
+}  // namespace storage
+}  // namespace cloud
+}  // namespace google
@@ -0,0 +1,131 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GOOGLE_CLOUD_CPP_GOOGLE_CLOUD_STORAGE_INTERNAL_MEMORY_MAPPED_FILE_H
+#define GOOGLE_CLOUD_CPP_GOOGLE_CLOUD_STORAGE_INTERNAL_MEMORY_MAPPED_FILE_H
+
+#include "google/cloud/storage/version.h"
+#include "google/cloud/status_or.h"
+#include "absl/strings/cord.h"
+#include "absl/strings/string_view.h"
+#include <cstddef>
+#include <istream>
+#include <memory>
+#include <streambuf>
+#include <string>
+
+namespace google {
+namespace cloud {
+namespace storage {
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_BEGIN
+namespace internal {
+
+/**
+ * A read-only, memory mapped file.
+ *
+ * Uploads from a file can send the mapped pages directly, avoiding any copies
+ * into user-space buffers. The mapping uses `MADV_SEQUENTIAL`, as uploads read
+ * the file in order.
+ *
+ * Modifying or truncating the file while it is mapped is undefined behavior,
+ * typically the process receives a `SIGBUS` signal.
+ *
+ * Only regular files can be mapped, `Open()` returns a `kInvalidArgument` error
+ * for pipes, devices, and other special files. Memory mapped files are not
+ * supported on Windows, `Open()` returns an `kUnimplemented` error.
+ */
+class MemoryMappedFile
+    : public std::enable_shared_from_this<MemoryMappedFile> {
+ public:
+  static StatusOr<std::shared_ptr<MemoryMappedFile>> Open(
+      std::string const& file_name);
+
+  ~MemoryMappedFile();
+
+  MemoryMappedFile(MemoryMappedFile const&) = delete;
+  MemoryMappedFile& operator=(MemoryMappedFile const&) = delete;
+
+  /// The contents of the file.
+  absl::string_view contents() const { return {data_, size_}; }
+  std::size_t size() const { return size_; }
+
+  /**
+   * Returns the bytes in `[offset, offset + n)` as an `absl::Cord`.
+   *
+   * The `absl::Cord` references the mapped pages, and keeps the mapping alive.
+   * The range is clamped to the size of the file.
+   */
+  absl::Cord Subcord(std::size_t offset, std::size_t n);
+
+ private:
+  MemoryMappedFile(char const* data, std::size_t size)
+      : data_(data), size_(size) {}
+
+  char const* data_;
+  std::size_t size_;
+};
+
+/**
+ * An input stream reading from a memory mapped file.
+ *
+ * The upload code paths read files through a `std::istream`. Code that knows
+ * about this class can use `FromStream()` and `Consume()` to reference the
+ * mapped pages directly, instead of copying them into a buffer.
+ */
+class MemoryMappedFileStream : public std::istream {
+ public:
+  explicit MemoryMappedFileStream(std::shared_ptr<MemoryMappedFile> file);
+
+  MemoryMappedFileStream(MemoryMappedFileStream const&) = delete;
+  MemoryMappedFileStream& operator=(MemoryMappedFileStream const&) = delete;
+
+  /// Returns @p is as a `MemoryMappedFileStream`, or `nullptr` if it is not.
+  static MemoryMappedFileStream* FromStream(std::istream& is);
+
+  std::shared_ptr<MemoryMappedFile> const& file() const { return file_; }
+
+  /**
+   * Returns the next (up to) @p n bytes, and skips over them.
+   *
+   * The returned view references the mapped pages, it remains valid while
+   * `file()` is alive.
+   */
+  absl::string_view Consume(std::size_t n) { return buf_.Consume(n); }
+
+ private:
+  class Streambuf : public std::streambuf {
+   public:
+    explicit Streambuf(absl::string_view contents);
+
+    absl::string_view Consume(std::size_t n);
+
+   protected:
+    pos_type seekoff(off_type off, std::ios_base::seekdir dir,
+                     std::ios_base::openmode which) override;
+    pos_type seekpos(pos_type pos, std::ios_base::openmode which) override;
+  };
+
+  static int StreamIndex();
+
+  std::shared_ptr<MemoryMappedFile> file_;
+  Streambuf buf_;
+};
+
+}  // namespace internal
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
+}  // namespace storage
+}  // namespace cloud
+}  // namespace google
+
+#endif  // GOOGLE_CLOUD_CPP_GOOGLE_CLOUD_STORAGE_INTERNAL_MEMORY_MAPPED_FILE_H
@@ -0,0 +1,131 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/storage/internal/memory_mapped_file.h"
+#include "google/cloud/storage/testing/random_names.h"
+#include "google/cloud/storage/testing/temp_file.h"
+#include "google/cloud/internal/random.h"
+#include "google/cloud/testing_util/status_matchers.h"
+#include <gmock/gmock.h>
+#include <iterator>
+#include <sstream>
+#include <string>
+#if !_WIN32
+#include <sys/stat.h>
+#include <unistd.h>
+#endif  // !_WIN32
+
+namespace google {
+namespace cloud {
+namespace storage {
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_BEGIN
+namespace internal {
+namespace {
+
+using ::google::cloud::testing_util::StatusIs;
+
+#if _WIN32
+
+TEST(MemoryMappedFileTest, Unimplemented) {
+  testing::TempFile temp_file("abc");
+  auto file = MemoryMappedFile::Open(temp_file.name());
+  EXPECT_THAT(file, StatusIs(StatusCode::kUnimplemented));
+}
+
+#else
+
+TEST(MemoryMappedFileTest, Basic) {
+  auto generator = google::cloud::internal::DefaultPRNG(std::random_device{}());
+  auto const contents = testing::MakeRandomData(generator, 1024 * 1024);
+  testing::TempFile temp_file(contents);
+  auto file = MemoryMappedFile::Open(temp_file.name());
+  ASSERT_STATUS_OK(file);
+  auto mapped = *std::move(file);
+  EXPECT_EQ(mapped->size(), contents.size());
+  EXPECT_EQ(mapped->contents(), contents);
+
+  auto const cord = mapped->Subcord(1000, 256 * 1024);
+  EXPECT_EQ(std::string(cord), contents.substr(1000, 256 * 1024));
+  // The `absl::Cord` references the mapped pages.
+  EXPECT_EQ(cord.chunk_begin()->data(), mapped->contents().data() + 1000);
+  EXPECT_EQ(mapped.use_count(), 2);
+
+  // Out of range requests are clamped.
+  EXPECT_EQ(std::string(mapped->Subcord(contents.size() - 10, 100)),
+            contents.substr(contents.size() - 10));
+  EXPECT_TRUE(mapped->Subcord(contents.size() + 10, 100).empty());
+}
+
+TEST(MemoryMappedFileTest, Empty) {
+  testing::TempFile temp_file("");
+  auto file = MemoryMappedFile::Open(temp_file.name());
+  ASSERT_STATUS_OK(file);
+  EXPECT_EQ((*file)->size(), 0);
+  EXPECT_TRUE((*file)->contents().empty());
+  EXPECT_TRUE((*file)->Subcord(0, 100).empty());
+}
+
+TEST(MemoryMappedFileTest, NotFound) {
+  auto generator = google::cloud::internal::DefaultPRNG(std::random_device{}());
+  auto file = MemoryMappedFile::Open(
+      "/not-found/" + testing::MakeRandomFileName(generator));
+  EXPECT_THAT(file, StatusIs(StatusCode::kNotFound));
+}
+
+TEST(MemoryMappedFileTest, NotRegularFile) {
+  auto generator = google::cloud::internal::DefaultPRNG(std::random_device{}());
+  auto const name =
+      ::testing::TempDir() + testing::MakeRandomFileName(generator);
+  ASSERT_EQ(::mkfifo(name.c_str(), 0600), 0);
+  // Opening the FIFO must not block, even though there is no writer.
+  auto file = MemoryMappedFile::Open(name);
+  EXPECT_THAT(file, StatusIs(StatusCode::kInvalidArgument));
+  ::unlink(name.c_str());
+}
+
+TEST(MemoryMappedFileStreamTest, Basic) {
+  testing::TempFile temp_file("0123456789");
+  auto file = MemoryMappedFile::Open(temp_file.name());
+  ASSERT_STATUS_OK(file);
+  MemoryMappedFileStream stream(*file);
+  EXPECT_EQ(MemoryMappedFileStream::FromStream(stream), &stream);
+  EXPECT_EQ(stream.file(), *file);
+
+  stream.seekg(2, std::ios::beg);
+  auto const chunk = stream.Consume(3);
+  EXPECT_EQ(chunk, "234");
+  // The chunk references the mapped pages.
+  EXPECT_EQ(chunk.data(), (*file)->contents().data() + 2);
+  stream.seekg(1, std::ios::cur);
+  EXPECT_EQ(std::string(std::istreambuf_iterator<char>(stream), {}), "6789");
+  EXPECT_TRUE(stream.Consume(10).empty());
+
+  stream.clear();
+  stream.seekg(-3, std::ios::end);
+  EXPECT_EQ(stream.Consume(10), "789");
+}
+
+TEST(MemoryMappedFileStreamTest, FromOtherStream) {
+  std::istringstream stream("not mapped");
+  EXPECT_EQ(MemoryMappedFileStream::FromStream(stream), nullptr);
+}
+
+#endif  // _WIN32
+
+}  // namespace
+}  // namespace internal
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
+}  // namespace storage
+}  // namespace cloud
+}  // namespace google
@@ -0,0 +1,524 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/storage/internal/object_metadata_sax_parser.h"
+#include "google/cloud/storage/internal/metadata_parser.h"
+#include "google/cloud/storage/internal/object_access_control_parser.h"
+#include "google/cloud/internal/absl_str_cat_quiet.h"
+#include "google/cloud/internal/make_status.h"
+#include "google/cloud/internal/parse_rfc3339.h"
+#include "absl/strings/numbers.h"
+#include <nlohmann/json.hpp>
+#include <istream>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace google {
+namespace cloud {
+namespace storage {
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_BEGIN
+namespace internal {
+namespace {
+
+using ::google::cloud::internal::InvalidArgumentError;
+
+Status FieldError(std::string const& name, char const* type,
+                  nlohmann::json const& value) {
+  return InvalidArgumentError(
+      absl::StrCat("Error parsing field <", name, "> as ", type,
+                   ", value=", value.dump()),
+      GCP_ERROR_INFO());
+}
+
+/// Scalar fields are parsed with the same rules as `ObjectMetadataParser`.
+using ScalarSetter = Status (*)(ObjectMetadata&, nlohmann::json&,
+                                std::string const&);
+
+template <ObjectMetadata& (ObjectMetadata::*Setter)(std::string)>
+Status SetString(ObjectMetadata& meta, nlohmann::json& value,
+                 std::string const& name) {
+  if (!value.is_string()) return FieldError(name, "a string", value);
+  (meta.*Setter)(std::move(value.get_ref<std::string&>()));
+  return Status{};
+}
+
+template <typename T, ObjectMetadata& (ObjectMetadata::*Setter)(T)>
+Status SetInteger(ObjectMetadata& meta, nlohmann::json& value,
+                  std::string const& name) {
+  if (value.is_number()) {
+    (meta.*Setter)(value.get<T>());
+    return Status{};
+  }
+  T v;
+  if (value.is_string() &&
+      absl::SimpleAtoi(value.get_ref<std::string const&>(), &v)) {
+    (meta.*Setter)(v);
+    return Status{};
+  }
+  return FieldError(name, "an integer", value);
+}
+
+template <ObjectMetadata& (ObjectMetadata::*Setter)(bool)>
+Status SetBool(ObjectMetadata& meta, nlohmann::json& value,
+               std::string const& name) {
+  if (value.is_boolean()) {
+    (meta.*Setter)(value.get<bool>());
+    return Status{};
+  }
+  if (value == "true" || value == "false") {
+    (meta.*Setter)(value == "true");
+    return Status{};
+  }
+  return FieldError(name, "a boolean", value);
+}
+
+StatusOr<std::chrono::system_clock::time_point> ParseTimestamp(
+    nlohmann::json const& value, std::string const& name) {
+  if (!value.is_string()) return FieldError(name, "a timestamp", value);
+  return google::cloud::internal::ParseRfc3339(
+      value.get_ref<std::string const&>());
+}
+
+template <ObjectMetadata& (ObjectMetadata::*Setter)(
+    std::chrono::system_clock::time_point)>
+Status SetTimestamp(ObjectMetadata& meta, nlohmann::json& value,
+                    std::string const& name) {
+  auto v = ParseTimestamp(value, name);
+  if (!v) return std::move(v).status();
+  (meta.*Setter)(*v);
+  return Status{};
+}
+
+std::unordered_map<std::string, ScalarSetter> const& ScalarSetters() {
+  using M = ObjectMetadata;
+  static auto const* const kSetters =
+      new std::unordered_map<std::string, ScalarSetter>{
+          {"bucket", SetString<&M::set_bucket>},
+          {"cacheControl", SetString<&M::set_cache_control>},
+          {"componentCount",
+           SetInteger<std::int32_t, &M::set_component_count>},
+          {"contentDisposition", SetString<&M::set_content_disposition>},
+          {"contentEncoding", SetString<&M::set_content_encoding>},
+          {"contentLanguage", SetString<&M::set_content_language>},
+          {"contentType", SetString<&M::set_content_type>},
+          {"crc32c", SetString<&M::set_crc32c>},
+          {"customTime", SetTimestamp<&M::set_custom_time>},
+          {"etag", SetString<&M::set_etag>},
+          {"eventBasedHold", SetBool<&M::set_event_based_hold>},
+          {"generation", SetInteger<std::int64_t, &M::set_generation>},
+          {"id", SetString<&M::set_id>},
+          {"kind", SetString<&M::set_kind>},
+          {"kmsKeyName", SetString<&M::set_kms_key_name>},
+          {"md5Hash", SetString<&M::set_md5_hash>},
+          {"mediaLink", SetString<&M::set_media_link>},
+          {"metageneration", SetInteger<std::int64_t, &M::set_metageneration>},
+          {"name", SetString<&M::set_name>},
+          {"retentionExpirationTime",
+           SetTimestamp<&M::set_retention_expiration_time>},
+          {"selfLink", SetString<&M::set_self_link>},
+          {"size", SetInteger<std::uint64_t, &M::set_size>},
+          {"storageClass", SetString<&M::set_storage_class>},
+          {"temporaryHold", SetBool<&M::set_temporary_hold>},
+          {"timeCreated", SetTimestamp<&M::set_time_created>},
+          {"timeDeleted", SetTimestamp<&M::set_time_deleted>},
+          {"timeStorageClassUpdated",
+           SetTimestamp<&M::set_time_storage_class_updated>},
+          {"updated", SetTimestamp<&M::set_updated>},
+          {"softDeleteTime", SetTimestamp<&M::set_soft_delete_time>},
+          {"hardDeleteTime", SetTimestamp<&M::set_hard_delete_time>},
+      };
+  return *kSetters;
+}
+
+/**
+ * Receives the `nlohmann::json` SAX events and fills the output directly.
+ *
+ * The handler keeps a stack with one frame per open JSON object or array. The
+ * frame type determines how the values, keys, and nested containers are
+ * handled. Any unknown object or array is skipped.
+ */
+class Handler : public nlohmann::json_sax<nlohmann::json> {
+ public:
+  enum class Mode { kObject, kList };
+  explicit Handler(Mode mode) : mode_(mode) {}
+
+  Status const& status() const { return status_; }
+  ObjectMetadata& object() { return object_; }
+  ListObjectsResponse& list() { return list_; }
+
+  bool null() override { return OnScalar(nlohmann::json()); }
+  bool boolean(bool val) override { return OnScalar(nlohmann::json(val)); }
+  bool number_integer(number_integer_t val) override {
+    return OnScalar(nlohmann::json(val));
+  }
+  bool number_unsigned(number_unsigned_t val) override {
+    return OnScalar(nlohmann::json(val));
+  }
+  bool number_float(number_float_t val, string_t const&) override {
+    return OnScalar(nlohmann::json(val));
+  }
+  bool string(string_t& val) override {
+    return OnScalar(nlohmann::json(std::move(val)));
+  }
+  bool binary(binary_t& val) override {
+    return OnScalar(nlohmann::json::binary(std::move(val)));
+  }
+
+  bool start_object(std::size_t) override { return OnStart(true); }
+  bool end_object() override { return OnEnd(); }
+  bool start_array(std::size_t) override { return OnStart(false); }
+  bool end_array() override { return OnEnd(); }
+
+  bool key(string_t& val) override {
+    key_.swap(val);
+    if (frames_.empty() || frames_.back() != Frame::kItem) return true;
+    auto const& setters = ScalarSetters();
+    auto f = setters.find(key_);
+    setter_ = f == setters.end() ? nullptr : f->second;
+    return true;
+  }
+
+  bool parse_error(std::size_t, std::string const&,
+                   nlohmann::detail::exception const& ex) override {
+    return Error(InvalidArgumentError(
+        absl::StrCat("error parsing JSON payload: ", ex.what()),
+        GCP_ERROR_INFO()));
+  }
+
+ private:
+  enum class Frame {
+    kSkip,
+    kList,
+    kItems,
+    kItem,
+    kPrefixes,
+    kAcl,
+    kAclEntry,
+    kCustomerEncryption,
+    kMetadata,
+    kOwner,
+    kRetention,
+  };
+
+  bool Error(Status status) {
+    if (status_.ok()) status_ = std::move(status);
+    return false;
+  }
+
+  static Status NotAnObject() {
+    return InvalidArgumentError("json input is not an object",
+                                GCP_ERROR_INFO());
+  }
+
+  static Status PrefixNotAString() {
+    return google::cloud::internal::InternalError(
+        "List Objects Response's 'prefix' is not a string.", GCP_ERROR_INFO());
+  }
+
+  bool OnScalar(nlohmann::json value) {
+    if (frames_.empty()) return Error(NotAnObject());
+    switch (frames_.back()) {
+      case Frame::kSkip:
+        return true;
+      case Frame::kList:
+        if (key_ == "nextPageToken" && value.is_string()) {
+          list_.next_page_token = std::move(value.get_ref<std::string&>());
+        }
+        return true;
+      case Frame::kItems:
+      case Frame::kAcl:
+        return Error(NotAnObject());
+      case Frame::kPrefixes:
+        if (!value.is_string()) return Error(PrefixNotAString());
+        list_.prefixes.push_back(std::move(value.get_ref<std::string&>()));
+        return true;
+      case Frame::kItem:
+        if (setter_ == nullptr || value.is_null()) return true;
+        return OnStatus(setter_(*current_, value, key_));
+      case Frame::kAclEntry:
+        AddDomValue(std::move(value));
+        return true;
+      case Frame::kCustomerEncryption:
+        if (!value.is_string()) return true;
+        if (key_ == "encryptionAlgorithm") {
+          encryption_.encryption_algorithm =
+              std::move(value.get_ref<std::string&>());
+        } else if (key_ == "keySha256") {
+          encryption_.key_sha256 = std::move(value.get_ref<std::string&>());
+        }
+        return true;
+      case Frame::kMetadata:
+        if (!value.is_string()) {
+          return Error(FieldError("metadata." + key_, "a string", value));
+        }
+        metadata_[key_] = std::move(value.get_ref<std::string&>());
+        return true;
+      case Frame::kOwner:
+        if (!value.is_string()) return true;
+        if (key_ == "entity") {
+          owner_.entity = std::move(value.get_ref<std::string&>());
+        } else if (key_ == "entityId") {
+          owner_.entity_id = std::move(value.get_ref<std::string&>());
+        }
+        return true;
+      case Frame::kRetention:
+        if (key_ == "mode" && value.is_string()) {
+          retention_.mode = std::move(value.get_ref<std::string&>());
+        } else if (key_ == "retainUntilTime") {
+          auto ts = ParseTimestamp(value, "retainUntilTime");
+          if (!ts) return Error(std::move(ts).status());
+          retention_.retain_until_time = *ts;
+        }
+        return true;
+    }
+    return true;
+  }
+
+  bool OnStatus(Status status) {
+    if (status.ok()) return true;
+    return Error(std::move(status));
+  }
+
+  bool OnStart(bool is_object) {
+    if (frames_.empty()) {
+      if (!is_object) return Error(NotAnObject());
+      if (mode_ == Mode::kList) {
+        frames_.push_back(Frame::kList);
+        return true;
+      }
+      current_ = &object_;
+      frames_.push_back(Frame::kItem);
+      return true;
+    }
+    switch (frames_.back()) {
+      case Frame::kSkip:
+        break;
+      case Frame::kList:
+        if (!is_object && key_ == "items") return Push(Frame::kItems);
+        if (!is_object && key_ == "prefixes") return Push(Frame::kPrefixes);
+        break;
+      case Frame::kItems:
+        if (!is_object) return Error(NotAnObject());
+        list_.items.emplace_back();
+        current_ = &list_.items.back();
+        return Push(Frame::kItem);
+      case Frame::kPrefixes:
+        return Error(PrefixNotAString());
+      case Frame::kItem:
+        return OnItemStart(is_object);
+      case Frame::kAcl:
+        if (!is_object) return Error(NotAnObject());
+        dom_ = nlohmann::json::object();
+        dom_stack_.assign(1, &dom_);
+        return Push(Frame::kAclEntry);
+      case Frame::kAclEntry:
+        dom_stack_.push_back(AddDomValue(is_object ? nlohmann::json::object()
+                                                   : nlohmann::json::array()));
+        return Push(Frame::kAclEntry);
+      case Frame::kCustomerEncryption:
+      case Frame::kMetadata:
+      case Frame::kOwner:
+      case Frame::kRetention:
+        break;
+    }
+    return Push(Frame::kSkip);
+  }
+
+  bool OnItemStart(bool is_object) {
+    if (!is_object) {
+      if (key_ != "acl") return Push(Frame::kSkip);
+      acl_.clear();
+      return Push(Frame::kAcl);
+    }
+    if (key_ == "customerEncryption") {
+      encryption_ = CustomerEncryption{};
+      return Push(Frame::kCustomerEncryption);
+    }
+    if (key_ == "metadata") {
+      metadata_.clear();
+      return Push(Frame::kMetadata);
+    }
+    if (key_ == "owner") {
+      owner_ = Owner{};
+      return Push(Frame::kOwner);
+    }
+    if (key_ == "retention") {
+      retention_ = ObjectRetention{};
+      return Push(Frame::kRetention);
+    }
+    return Push(Frame::kSkip);
+  }
+
+  bool Push(Frame f) {
+    frames_.push_back(f);
+    return true;
+  }
+
+  bool OnEnd() {
+    auto const f = frames_.back();
+    frames_.pop_back();
+    switch (f) {
+      case Frame::kAcl:
+        current_->set_acl(std::move(acl_));
+        acl_ = {};
+        break;
+      case Frame::kAclEntry:
+        dom_stack_.pop_back();
+        if (dom_stack_.empty()) {
+          auto acl = ObjectAccessControlParser::FromJson(dom_);
+          if (!acl) return Error(std::move(acl).status());
+          acl_.push_back(*std::move(acl));
+        }
+        break;
+      case Frame::kCustomerEncryption:
+        current_->set_customer_encryption(std::move(encryption_));
+        break;
+      case Frame::kMetadata:
+        current_->mutable_metadata() = std::move(metadata_);
+        metadata_ = {};
+        break;
+      case Frame::kOwner:
+        current_->set_owner(std::move(owner_));
+        break;
+      case Frame::kRetention:
+        current_->set_retention(std::move(retention_));
+        break;
+      case Frame::kItem:
+        // `ObjectMetadataParser` always sets these fields, even when they are
+        // not present in the JSON object.
+        if (!current_->has_soft_delete_time()) {
+          current_->set_soft_delete_time({});
+        }
+        if (!current_->has_hard_delete_time()) {
+          current_->set_hard_delete_time({});
+        }
+        break;
+      case Frame::kSkip:
+      case Frame::kList:
+      case Frame::kItems:
+      case Frame::kPrefixes:
+        break;
+    }
+    return true;
+  }
+
+  // ACL entries are rare, and only included with `Projection::Full()`. They
+  // are parsed into a small DOM and use the existing parser.
+  nlohmann::json* AddDomValue(nlohmann::json value) {
+    auto& parent = *dom_stack_.back();
+    if (parent.is_array()) {
+      parent.push_back(std::move(value));
+      return &parent.back();
+    }
+    auto& slot = parent[key_];
+    slot = std::move(value);
+    return &slot;
+  }
+
+  Mode mode_;
+  Status status_;
+  std::vector<Frame> frames_;
+  std::string key_;
+  ScalarSetter setter_ = nullptr;
+
+  ObjectMetadata object_;
+  ListObjectsResponse list_;
+  ObjectMetadata* current_ = nullptr;
+
+  std::vector<ObjectAccessControl> acl_;
+  nlohmann::json dom_;
+  std::vector<nlohmann::json*> dom_stack_;
+  CustomerEncryption encryption_;
+  std::map<std::string, std::string> metadata_;
+  Owner owner_;
+  ObjectRetention retention_;
+};
+
+/// Adapts a `rest_internal::HttpPayload` to the `std::istream` interface.
+class PayloadStreambuf : public std::streambuf {
+ public:
+  explicit PayloadStreambuf(rest_internal::HttpPayload& payload)
+      : payload_(payload), buffer_(kBufferSize) {}
+
+  Status const& status() const { return status_; }
+
+ protected:
+  int_type underflow() override {
+    if (gptr() != egptr()) return traits_type::to_int_type(*gptr());
+    auto n = payload_.Read(absl::MakeSpan(buffer_));
+    if (!n) {
+      status_ = std::move(n).status();
+      return traits_type::eof();
+    }
+    if (*n == 0) return traits_type::eof();
+    setg(buffer_.data(), buffer_.data(), buffer_.data() + *n);
+    return traits_type::to_int_type(*gptr());
+  }
+
+ private:
+  static constexpr std::size_t kBufferSize = 128 * 1024;
+  rest_internal::HttpPayload& payload_;
+  std::vector<char> buffer_;
+  Status status_;
+};
+
+Status ParseString(absl::string_view payload, Handler& handler) {
+  auto const ok = nlohmann::json::sax_parse(payload.begin(), payload.end(),
+                                            &handler);
+  if (ok) return Status{};
+  if (!handler.status().ok()) return handler.status();
+  return ExpectedJsonObject(std::string(payload.substr(0, 32)),
+                            GCP_ERROR_INFO());
+}
+
+}  // namespace
+
+StatusOr<ObjectMetadata> ObjectMetadataSaxParser::FromString(
+    absl::string_view payload) {
+  Handler handler(Handler::Mode::kObject);
+  auto status = ParseString(payload, handler);
+  if (!status.ok()) return status;
+  return std::move(handler.object());
+}
+
+StatusOr<ListObjectsResponse> ObjectMetadataSaxParser::ListFromString(
+    absl::string_view payload) {
+  Handler handler(Handler::Mode::kList);
+  auto status = ParseString(payload, handler);
+  if (!status.ok()) return status;
+  return std::move(handler.list());
+}
+
+StatusOr<ListObjectsResponse> ObjectMetadataSaxParser::ListFromPayload(
+    rest_internal::HttpPayload& payload) {
+  PayloadStreambuf buf(payload);
+  std::istream is(&buf);
+  Handler handler(Handler::Mode::kList);
+  auto const ok = nlohmann::json::sax_parse(is, &handler);
+  if (!buf.status().ok()) return buf.status();
+  if (!handler.status().ok()) return handler.status();
+  if (!ok) {
+    return InvalidArgumentError("error parsing JSON payload", GCP_ERROR_INFO());
+  }
+  return std::move(handler.list());
+}
+
+}  // namespace internal
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
+}  // namespace storage
+}  // namespace cloud
+}  // namespace google
@@ -0,0 +1,64 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GOOGLE_CLOUD_CPP_GOOGLE_CLOUD_STORAGE_INTERNAL_OBJECT_METADATA_SAX_PARSER_H
+#define GOOGLE_CLOUD_CPP_GOOGLE_CLOUD_STORAGE_INTERNAL_OBJECT_METADATA_SAX_PARSER_H
+
+#include "google/cloud/storage/internal/object_requests.h"
+#include "google/cloud/storage/object_metadata.h"
+#include "google/cloud/storage/version.h"
+#include "google/cloud/internal/http_payload.h"
+#include "google/cloud/status_or.h"
+#include "absl/strings/string_view.h"
+
+namespace google {
+namespace cloud {
+namespace storage {
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_BEGIN
+namespace internal {
+
+/**
+ * Parses object metadata and object list responses without a JSON DOM.
+ *
+ * `ObjectMetadataParser` first builds a `nlohmann::json` object, and then
+ * copies each field into `ObjectMetadata`. For large `Objects: list` responses
+ * the intermediate DOM dominates the cost of parsing. These functions use the
+ * `nlohmann::json` SAX interface to fill the `ObjectMetadata` fields directly,
+ * skipping unknown fields without allocating any memory for them.
+ *
+ * For well-formed responses the results are identical to the results of
+ * `ObjectMetadataParser` and `ListObjectsResponse::FromHttpResponse()`.
+ */
+struct ObjectMetadataSaxParser {
+  static StatusOr<ObjectMetadata> FromString(absl::string_view payload);
+
+  static StatusOr<ListObjectsResponse> ListFromString(
+      absl::string_view payload);
+
+  /**
+   * Parses a `Objects: list` response as it is read from @p payload.
+   *
+   * The payload is consumed in chunks, without buffering the full response.
+   */
+  static StatusOr<ListObjectsResponse> ListFromPayload(
+      rest_internal::HttpPayload& payload);
+};
+
+}  // namespace internal
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
+}  // namespace storage
+}  // namespace cloud
+}  // namespace google
+
+#endif  // GOOGLE_CLOUD_CPP_GOOGLE_CLOUD_STORAGE_INTERNAL_OBJECT_METADATA_SAX_PARSER_H
@@ -0,0 +1,167 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/storage/internal/object_metadata_parser.h"
+#include "google/cloud/storage/internal/object_metadata_sax_parser.h"
+#include "google/cloud/internal/absl_str_cat_quiet.h"
+#include <benchmark/benchmark.h>
+#include <nlohmann/json.hpp>
+#include <algorithm>
+#include <map>
+#include <string>
+
+namespace google {
+namespace cloud {
+namespace storage {
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_BEGIN
+namespace internal {
+namespace {
+
+// Compare parsing a 1,000 item `Objects: list` response using a JSON DOM (the
+// previous implementation) vs. the SAX-based parser.
+//
+// Run on (1 X 2100 MHz CPU )
+// CPU Caches:
+//   L1 Data 48 KiB (x1)
+//   L1 Instruction 32 KiB (x1)
+//   L2 Unified 2048 KiB (x1)
+//   L3 Unified 307200 KiB (x1)
+// Load Average: 0.71, 0.62, 0.70
+// ----------------------------------------------------------------------
+// Benchmark                        Time             CPU   Iterations
+// ----------------------------------------------------------------------
+// BM_ListObjectsDom         31155623 ns     30763737 ns           22
+// BM_ListObjectsSaxString   15653062 ns     15057599 ns           45
+// BM_ListObjectsSaxPayload  15086630 ns     14750466 ns           54
+
+auto constexpr kItemCount = 1000;
+
+std::string MakeListResponse() {
+  auto items = nlohmann::json::array();
+  for (int i = 0; i != kItemCount; ++i) {
+    auto const name = absl::StrCat("prefix/folder-", i / 100, "/object-", i);
+    auto const generation = std::to_string(1700000000000000 + i);
+    items.push_back(nlohmann::json{
+        {"kind", "storage#object"},
+        {"id", absl::StrCat("test-bucket/", name, "/", generation)},
+        {"selfLink",
+         absl::StrCat("https://www.googleapis.com/storage/v1/b/test-bucket/o/",
+                      name)},
+        {"mediaLink",
+         absl::StrCat("https://storage.googleapis.com/download/storage/v1/b/"
+                      "test-bucket/o/",
+                      name, "?generation=", generation, "&alt=media")},
+        {"name", name},
+        {"bucket", "test-bucket"},
+        {"generation", generation},
+        {"metageneration", "1"},
+        {"contentType", "application/octet-stream"},
+        {"storageClass", "STANDARD"},
+        {"size", std::to_string(1024 * i)},
+        {"md5Hash", "1B2M2Y8AsgTpgAmY7PhCfg=="},
+        {"crc32c", "AAAAAA=="},
+        {"etag", "CJWEoYuS8oQDEAE="},
+        {"timeCreated", "2024-03-01T12:34:56.789Z"},
+        {"updated", "2024-03-01T12:34:56.789Z"},
+        {"timeStorageClassUpdated", "2024-03-01T12:34:56.789Z"},
+        {"metadata", {{"goog-reserved-file-mtime", "1709296496"}}},
+    });
+  }
+  return nlohmann::json{{"kind", "storage#objects"},
+                        {"nextPageToken", "CiRwcmVmaXgvZm9sZGVyLTkvb2JqZWN0"},
+                        {"items", std::move(items)}}
+      .dump();
+}
+
+std::string const& ListResponse() {
+  static auto const* const kResponse = new std::string(MakeListResponse());
+  return *kResponse;
+}
+
+// The implementation of `ListObjectsResponse::FromHttpResponse()` before
+// `ObjectMetadataSaxParser` was introduced.
+StatusOr<ListObjectsResponse> DomParse(std::string const& payload) {
+  auto json = nlohmann::json::parse(payload, nullptr, false);
+  if (!json.is_object()) return Status(StatusCode::kInvalidArgument, "");
+  ListObjectsResponse result;
+  result.next_page_token = json.value("nextPageToken", "");
+  for (auto const& kv : json["items"].items()) {
+    auto parsed = ObjectMetadataParser::FromJson(kv.value());
+    if (!parsed.ok()) return std::move(parsed).status();
+    result.items.emplace_back(std::move(*parsed));
+  }
+  for (auto const& kv : json["prefixes"].items()) {
+    result.prefixes.emplace_back(kv.value().get<std::string>());
+  }
+  return result;
+}
+
+// Returns the payload in chunks, as a HTTP library would.
+class StringPayload : public rest_internal::HttpPayload {
+ public:
+  explicit StringPayload(std::string const& contents) : contents_(contents) {}
+
+  bool HasUnreadData() const override { return !contents_.empty(); }
+  StatusOr<std::size_t> Read(absl::Span<char> buffer) override {
+    auto const n = (std::min)({buffer.size(), kChunkSize, contents_.size()});
+    std::copy(contents_.begin(), contents_.begin() + n, buffer.begin());
+    contents_.remove_prefix(n);
+    return n;
+  }
+  std::multimap<std::string, std::string> DebugHeaders() const override {
+    return {};
+  }
+
+ private:
+  static auto constexpr kChunkSize = std::size_t{16 * 1024};
+  absl::string_view contents_;
+};
+
+void BM_ListObjectsDom(benchmark::State& state) {
+  auto const& payload = ListResponse();
+  for (auto _ : state) {
+    auto r = DomParse(payload);
+    benchmark::DoNotOptimize(r);
+  }
+  state.SetBytesProcessed(state.iterations() * payload.size());
+}
+BENCHMARK(BM_ListObjectsDom);
+
+void BM_ListObjectsSaxString(benchmark::State& state) {
+  auto const& payload = ListResponse();
+  for (auto _ : state) {
+    auto r = ObjectMetadataSaxParser::ListFromString(payload);
+    benchmark::DoNotOptimize(r);
+  }
+  state.SetBytesProcessed(state.iterations() * payload.size());
+}
+BENCHMARK(BM_ListObjectsSaxString);
+
+void BM_ListObjectsSaxPayload(benchmark::State& state) {
+  auto const& payload = ListResponse();
+  for (auto _ : state) {
+    StringPayload p(payload);
+    auto r = ObjectMetadataSaxParser::ListFromPayload(p);
+    benchmark::DoNotOptimize(r);
+  }
+  state.SetBytesProcessed(state.iterations() * payload.size());
+}
+BENCHMARK(BM_ListObjectsSaxPayload);
+
+}  // namespace
+}  // namespace internal
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
+}  // namespace storage
+}  // namespace cloud
+}  // namespace google
@@ -0,0 +1,248 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/storage/internal/object_metadata_sax_parser.h"
+#include "google/cloud/storage/internal/object_metadata_parser.h"
+#include "google/cloud/testing_util/mock_http_payload.h"
+#include "google/cloud/testing_util/status_matchers.h"
+#include <gmock/gmock.h>
+#include <nlohmann/json.hpp>
+#include <string>
+
+namespace google {
+namespace cloud {
+namespace storage {
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_BEGIN
+namespace internal {
+namespace {
+
+using ::google::cloud::testing_util::MockHttpPayload;
+using ::google::cloud::testing_util::StatusIs;
+using ::testing::ElementsAre;
+using ::testing::HasSubstr;
+
+// This object has some impossible combination of fields in it. The goal is to
+// fully test the parsing, not to simulate valid objects.
+auto constexpr kFullObject = R"""({
+  "acl": [{
+    "kind": "storage#objectAccessControl",
+    "id": "acl-id-0",
+    "bucket": "foo-bar",
+    "object": "baz",
+    "generation": 12345,
+    "entity": "user-qux",
+    "role": "OWNER",
+    "email": "qux@example.com",
+    "entityId": "user-qux-id-123",
+    "domain": "example.com",
+    "projectTeam": {"projectNumber": "4567", "team": "owners"},
+    "etag": "AYX="
+  }, {
+    "kind": "storage#objectAccessControl",
+    "entity": "user-quux",
+    "role": "READER"
+  }],
+  "bucket": "foo-bar",
+  "cacheControl": "no-cache",
+  "componentCount": 7,
+  "contentDisposition": "a-disposition",
+  "contentEncoding": "an-encoding",
+  "contentLanguage": "a-language",
+  "contentType": "application/octet-stream",
+  "crc32c": "deadbeef",
+  "customTime": "2020-04-12T15:21:14Z",
+  "customerEncryption": {
+    "encryptionAlgorithm": "some-algo",
+    "keySha256": "abc123"
+  },
+  "etag": "XYZ=",
+  "eventBasedHold": true,
+  "generation": "12345",
+  "id": "foo-bar/baz/12345",
+  "kind": "storage#object",
+  "kmsKeyName": "/foo/bar/baz/key",
+  "md5Hash": "deaderBeef=",
+  "mediaLink": "https://storage.googleapis.com/download/storage/v1/b/foo-bar/o/baz",
+  "metadata": {"foo": "bar", "baz": "qux"},
+  "metageneration": "4",
+  "name": "baz",
+  "owner": {"entity": "user-qux", "entityId": "user-qux-id-123"},
+  "retentionExpirationTime": "2019-01-01T00:00:00Z",
+  "retention": {"mode": "Unlocked", "retainUntilTime": "2024-07-18T00:00:00Z"},
+  "selfLink": "https://storage.googleapis.com/storage/v1/b/foo-bar/o/baz",
+  "size": 102400,
+  "storageClass": "STANDARD",
+  "temporaryHold": "true",
+  "timeCreated": "2018-05-19T19:31:14Z",
+  "timeDeleted": "2018-05-19T19:32:24Z",
+  "timeStorageClassUpdated": "2018-05-19T19:31:34Z",
+  "updated": "2018-05-19T19:31:24Z",
+  "softDeleteTime": "2024-05-19T19:31:24Z",
+  "hardDeleteTime": "2024-06-19T19:31:24Z",
+  "unknownField": {"nested": [1, 2, {"a": "b"}], "other": null},
+  "unknownArray": [[], {}, "x"]
+})""";
+
+std::string ListPayload() {
+  auto full = nlohmann::json::parse(kFullObject);
+  auto minimal = nlohmann::json{{"bucket", "foo-bar"}, {"name", "qux"}};
+  return nlohmann::json{
+      {"kind", "storage#objects"},
+      {"nextPageToken", "some-token-42"},
+      {"items", {full, minimal, full}},
+      {"prefixes", {"foo/", "qux/"}},
+  }
+      .dump();
+}
+
+std::unique_ptr<MockHttpPayload> MakeChunkedPayload(std::string contents,
+                                                    std::size_t chunk_size) {
+  auto mock = std::make_unique<MockHttpPayload>();
+  auto c = std::make_shared<std::string>(std::move(contents));
+  EXPECT_CALL(*mock, Read).WillRepeatedly([c, chunk_size](absl::Span<char> b) {
+    auto const n = (std::min)({b.size(), chunk_size, c->size()});
+    std::copy(c->begin(), c->begin() + n, b.begin());
+    c->erase(0, n);
+    return n;
+  });
+  return mock;
+}
+
+TEST(ObjectMetadataSaxParser, MatchesDomParser) {
+  auto expected = ObjectMetadataParser::FromString(kFullObject);
+  ASSERT_STATUS_OK(expected);
+  auto actual = ObjectMetadataSaxParser::FromString(kFullObject);
+  ASSERT_STATUS_OK(actual);
+  EXPECT_EQ(*actual, *expected);
+  EXPECT_EQ(actual->acl().size(), 2);
+  EXPECT_EQ(actual->component_count(), 7);
+  EXPECT_EQ(actual->generation(), 12345);
+  EXPECT_TRUE(actual->temporary_hold());
+  EXPECT_EQ(actual->metadata("foo"), "bar");
+  EXPECT_EQ(actual->owner().entity_id, "user-qux-id-123");
+  EXPECT_EQ(actual->retention().mode, "Unlocked");
+}
+
+TEST(ObjectMetadataSaxParser, MatchesDomParserMinimal) {
+  auto const payload = std::string{R"js({"name": "foo", "size": null})js"};
+  auto expected = ObjectMetadataParser::FromString(R"js({"name": "foo"})js");
+  ASSERT_STATUS_OK(expected);
+  auto actual = ObjectMetadataSaxParser::FromString(payload);
+  ASSERT_STATUS_OK(actual);
+  EXPECT_EQ(*actual, *expected);
+}
+
+TEST(ObjectMetadataSaxParser, ObjectErrors) {
+  EXPECT_THAT(ObjectMetadataSaxParser::FromString("{123"),
+              StatusIs(StatusCode::kInvalidArgument));
+  EXPECT_THAT(ObjectMetadataSaxParser::FromString("[]"),
+              StatusIs(StatusCode::kInvalidArgument));
+  EXPECT_THAT(ObjectMetadataSaxParser::FromString("123"),
+              StatusIs(StatusCode::kInvalidArgument));
+  EXPECT_THAT(ObjectMetadataSaxParser::FromString(R"js({"size": "abc"})js"),
+              StatusIs(StatusCode::kInvalidArgument, HasSubstr("size")));
+  EXPECT_THAT(
+      ObjectMetadataSaxParser::FromString(R"js({"temporaryHold": 7})js"),
+      StatusIs(StatusCode::kInvalidArgument, HasSubstr("temporaryHold")));
+  EXPECT_THAT(ObjectMetadataSaxParser::FromString(R"js({"updated": 7})js"),
+              StatusIs(StatusCode::kInvalidArgument, HasSubstr("updated")));
+  EXPECT_THAT(
+      ObjectMetadataSaxParser::FromString(R"js({"metadata": {"a": 1}})js"),
+      StatusIs(StatusCode::kInvalidArgument, HasSubstr("metadata.a")));
+  EXPECT_THAT(ObjectMetadataSaxParser::FromString(R"js({"acl": [1]})js"),
+              StatusIs(StatusCode::kInvalidArgument));
+}
+
+TEST(ObjectMetadataSaxParser, ListMatchesDomParser) {
+  auto const payload = ListPayload();
+  auto const json = nlohmann::json::parse(payload);
+  auto actual = ObjectMetadataSaxParser::ListFromString(payload);
+  ASSERT_STATUS_OK(actual);
+  EXPECT_EQ(actual->next_page_token, "some-token-42");
+  EXPECT_THAT(actual->prefixes, ElementsAre("foo/", "qux/"));
+  ASSERT_EQ(actual->items.size(), 3);
+  for (std::size_t i = 0; i != actual->items.size(); ++i) {
+    auto expected = ObjectMetadataParser::FromJson(json["items"][i]);
+    ASSERT_STATUS_OK(expected);
+    EXPECT_EQ(actual->items[i], *expected);
+  }
+}
+
+TEST(ObjectMetadataSaxParser, ListEmpty) {
+  auto actual = ObjectMetadataSaxParser::ListFromString("{}");
+  ASSERT_STATUS_OK(actual);
+  EXPECT_EQ(actual->next_page_token, "");
+  EXPECT_TRUE(actual->items.empty());
+  EXPECT_TRUE(actual->prefixes.empty());
+}
+
+TEST(ObjectMetadataSaxParser, ListErrors) {
+  EXPECT_THAT(ObjectMetadataSaxParser::ListFromString("{123"),
+              StatusIs(StatusCode::kInvalidArgument));
+  EXPECT_THAT(ObjectMetadataSaxParser::ListFromString("[]"),
+              StatusIs(StatusCode::kInvalidArgument));
+  EXPECT_THAT(ObjectMetadataSaxParser::ListFromString(R"js({"items": [1]})js"),
+              StatusIs(StatusCode::kInvalidArgument));
+  EXPECT_THAT(
+      ObjectMetadataSaxParser::ListFromString(R"js({"prefixes": [1]})js"),
+      StatusIs(StatusCode::kInternal, HasSubstr("prefix")));
+  EXPECT_THAT(
+      ObjectMetadataSaxParser::ListFromString(R"js({"prefixes": [{}]})js"),
+      StatusIs(StatusCode::kInternal, HasSubstr("prefix")));
+}
+
+TEST(ObjectMetadataSaxParser, ListFromPayload) {
+  auto const payload = ListPayload();
+  auto expected = ObjectMetadataSaxParser::ListFromString(payload);
+  ASSERT_STATUS_OK(expected);
+
+  for (std::size_t chunk_size : {1, 7, 4096, 1024 * 1024}) {
+    SCOPED_TRACE("Testing with chunk_size=" + std::to_string(chunk_size));
+    auto mock = MakeChunkedPayload(payload, chunk_size);
+    auto actual = ObjectMetadataSaxParser::ListFromPayload(*mock);
+    ASSERT_STATUS_OK(actual);
+    EXPECT_EQ(actual->next_page_token, expected->next_page_token);
+    EXPECT_EQ(actual->prefixes, expected->prefixes);
+    EXPECT_EQ(actual->items, expected->items);
+  }
+}
+
+TEST(ObjectMetadataSaxParser, ListFromPayloadReadError) {
+  auto mock = std::make_unique<MockHttpPayload>();
+  EXPECT_CALL(*mock, Read)
+      .WillOnce([](absl::Span<char> b) {
+        std::string const prefix = R"js({"items": [{"name": )js";
+        std::copy(prefix.begin(), prefix.end(), b.begin());
+        return prefix.size();
+      })
+      .WillOnce([](absl::Span<char>) {
+        return StatusOr<std::size_t>(
+            Status(StatusCode::kUnavailable, "try-again"));
+      });
+  auto actual = ObjectMetadataSaxParser::ListFromPayload(*mock);
+  EXPECT_THAT(actual, StatusIs(StatusCode::kUnavailable, "try-again"));
+}
+
+TEST(ObjectMetadataSaxParser, ListFromPayloadTruncated) {
+  auto mock = MakeChunkedPayload(R"js({"items": [{"name": "foo"})js", 16);
+  auto actual = ObjectMetadataSaxParser::ListFromPayload(*mock);
+  EXPECT_THAT(actual, StatusIs(StatusCode::kInvalidArgument));
+}
+
+}  // namespace
+}  // namespace internal
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
+}  // namespace storage
+}  // namespace cloud
+}  // namespace google
@@ -0,0 +1,270 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/storage/internal/object_read_cache.h"
+#include "google/cloud/storage/internal/crc32c.h"
+#include "google/cloud/storage/options.h"
+#include "google/cloud/internal/filesystem.h"
+#include "google/cloud/internal/random.h"
+#include "google/cloud/log.h"
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+
+namespace google {
+namespace cloud {
+namespace storage_internal {
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_BEGIN
+namespace {
+
+auto constexpr kDefaultMaxBytes = std::uint64_t{1024} * 1024 * 1024;
+auto constexpr kDefaultBlockSize = std::size_t{16} * 1024 * 1024;
+
+// Bucket names cannot contain NUL characters, and neither can the generation
+// digits, so the key is unambiguous even if the object name contains NULs.
+std::string GenerationKey(std::string const& bucket, std::string const& object,
+                          std::int64_t generation) {
+  return std::to_string(generation) + '\0' + bucket + '\0' + object;
+}
+
+std::string RandomPrefix() {
+  auto generator = google::cloud::internal::MakeDefaultPRNG();
+  return "gcs-read-cache-" + google::cloud::internal::Sample(
+                                 generator, 16,
+                                 "abcdefghijklmnopqrstuvwxyz0123456789");
+}
+
+// Reads a block from @p path, returns false if the file is missing or its
+// contents do not match the expected size and checksum.
+bool Load(std::string const& path, std::size_t size, std::uint32_t crc32c,
+          std::string& data) {
+  std::ifstream is(path, std::ios::binary);
+  if (!is.is_open()) return false;
+  data.resize(size);
+  is.read(&data[0], static_cast<std::streamsize>(size));
+  if (static_cast<std::size_t>(is.gcount()) != size) return false;
+  if (is.peek() != std::ifstream::traits_type::eof()) return false;
+  return Crc32c(data) == crc32c;
+}
+
+}  // namespace
+
+ObjectReadCache::ObjectReadCache(std::string directory, std::uint64_t max_bytes,
+                                 std::int64_t block_size, Executor executor)
+    : directory_(std::move(directory)),
+      max_bytes_(max_bytes),
+      block_size_(block_size),
+      prefix_(RandomPrefix()),
+      executor_(std::move(executor)) {}
+
+ObjectReadCache::~ObjectReadCache() {
+  for (auto const& g : generations_) {
+    for (auto const& b : g.second.blocks) std::remove(b.second.path.c_str());
+  }
+}
+
+future<StatusOr<ObjectReadCache::BlockPtr>> ObjectReadCache::Read(
+    std::string const& bucket, std::string const& object,
+    std::int64_t generation, std::int64_t index, Fetcher const& fetcher) {
+  auto const id = BlockId{GenerationKey(bucket, object, generation), index};
+  std::unique_lock<std::mutex> lk(mu_);
+  auto g = generations_.find(id.first);
+  if (g == generations_.end()) return Fetch(id, fetcher, std::move(lk), {});
+  auto b = g->second.blocks.find(index);
+  if (b == g->second.blocks.end()) return Fetch(id, fetcher, std::move(lk), {});
+
+  lru_.splice(lru_.begin(), lru_, b->second.lru);
+  auto const entry = b->second;
+  ObjectReadCacheBlock block;
+  block.object_size = g->second.object_size;
+  block.hashes = g->second.hashes;
+  lk.unlock();
+  if (!executor_) return LoadOrFetch(id, entry, std::move(block), fetcher);
+
+  // `std::function<>` requires copyable functors, share the move-only state.
+  auto p = std::make_shared<promise<StatusOr<BlockPtr>>>();
+  auto f = p->get_future();
+  auto shared_block = std::make_shared<ObjectReadCacheBlock>(std::move(block));
+  executor_([self = shared_from_this(), id, entry, shared_block, fetcher, p] {
+    self->LoadOrFetch(id, entry, std::move(*shared_block), fetcher)
+        .then([p](auto g) { p->set_value(g.get()); });
+  });
+  return f;
+}
+
+void ObjectReadCache::Run(std::function<void()> fn) {
+  if (executor_) return executor_(std::move(fn));
+  fn();
+}
+
+future<StatusOr<ObjectReadCache::BlockPtr>> ObjectReadCache::LoadOrFetch(
+    BlockId const& id, Entry const& entry, ObjectReadCacheBlock block,
+    Fetcher const& fetcher) {
+  if (Load(entry.path, entry.size, entry.crc32c, block.data)) {
+    return make_ready_future(make_status_or(
+        BlockPtr(std::make_shared<ObjectReadCacheBlock>(std::move(block)))));
+  }
+  // The file is missing or corrupted. Unless another thread already replaced
+  // it, remove it from the cache and download it again.
+  std::vector<std::string> removed;
+  std::unique_lock<std::mutex> lk(mu_);
+  auto g = generations_.find(id.first);
+  if (g != generations_.end()) {
+    auto b = g->second.blocks.find(id.second);
+    if (b != g->second.blocks.end() && b->second.path == entry.path) {
+      Erase(id, removed);
+    }
+  }
+  return Fetch(id, fetcher, std::move(lk), std::move(removed));
+}
+
+future<StatusOr<ObjectReadCache::BlockPtr>> ObjectReadCache::Fetch(
+    BlockId const& id, Fetcher const& fetcher, std::unique_lock<std::mutex> lk,
+    std::vector<std::string> removed) {
+  auto& waiters = pending_[id];
+  waiters.emplace_back();
+  auto f = waiters.back().get_future();
+  auto const first = waiters.size() == 1;
+  lk.unlock();
+  for (auto const& path : removed) std::remove(path.c_str());
+  if (!first) return f;
+
+  fetcher(id.second * block_size_, block_size_)
+      .then([self = shared_from_this(), id](auto g) {
+        // Writing the block to disk may block, do not run it in the thread
+        // that completed the download.
+        auto fetched =
+            std::make_shared<StatusOr<ObjectReadCacheBlock>>(g.get());
+        self->Run([self, id, fetched] {
+          self->OnFetch(id, std::move(*fetched));
+        });
+      });
+  return f;
+}
+
+std::string ObjectReadCache::BlockPath(std::string const& bucket,
+                                       std::string const& object,
+                                       std::int64_t generation,
+                                       std::int64_t index) {
+  std::lock_guard<std::mutex> lk(mu_);
+  auto g = generations_.find(GenerationKey(bucket, object, generation));
+  if (g == generations_.end()) return {};
+  auto b = g->second.blocks.find(index);
+  if (b == g->second.blocks.end()) return {};
+  return b->second.path;
+}
+
+absl::optional<ObjectReadCache::Entry> ObjectReadCache::Store(
+    ObjectReadCacheBlock const& block) {
+  auto const size = block.data.size();
+  if (size > static_cast<std::uint64_t>(block_size_) || size > max_bytes_) {
+    return absl::nullopt;
+  }
+  auto path = google::cloud::internal::PathAppend(
+      directory_, prefix_ + "-" + std::to_string(next_file_++) + ".block");
+  std::ofstream os(path, std::ios::binary | std::ios::trunc);
+  os.write(block.data.data(), static_cast<std::streamsize>(size));
+  os.close();
+  if (!os.good()) {
+    std::remove(path.c_str());
+    std::call_once(store_error_logged_, [&path] {
+      GCP_LOG(WARNING) << "Cannot write GCS read cache file " << path
+                       << ", the cache is not usable until writes succeed";
+    });
+    return absl::nullopt;
+  }
+  return Entry{std::move(path), size, Crc32c(block.data), {}};
+}
+
+void ObjectReadCache::OnFetch(BlockId const& id,
+                              StatusOr<ObjectReadCacheBlock> fetched) {
+  std::vector<promise<StatusOr<BlockPtr>>> waiters;
+  auto extract_waiters = [&] {
+    auto p = pending_.find(id);
+    waiters = std::move(p->second);
+    pending_.erase(p);
+  };
+  if (!fetched) {
+    {
+      std::lock_guard<std::mutex> lk(mu_);
+      extract_waiters();
+    }
+    for (auto& w : waiters) w.set_value(fetched.status());
+    return;
+  }
+
+  auto block = std::make_shared<ObjectReadCacheBlock>(*std::move(fetched));
+  auto entry = Store(*block);
+  std::vector<std::string> removed;
+  {
+    std::lock_guard<std::mutex> lk(mu_);
+    if (entry) {
+      // Two downloads of the same block may race if a cached file failed
+      // verification, keep the newest.
+      Erase(id, removed);
+      auto& generation = generations_[id.first];
+      if (block->object_size) generation.object_size = block->object_size;
+      generation.hashes = storage::internal::Merge(std::move(generation.hashes),
+                                                   block->hashes);
+      lru_.push_front(id);
+      entry->lru = lru_.begin();
+      bytes_ += entry->size;
+      generation.blocks.emplace(id.second, *std::move(entry));
+      while (bytes_ > max_bytes_ && !lru_.empty()) {
+        auto const victim = lru_.back();
+        Erase(victim, removed);
+      }
+    }
+    extract_waiters();
+  }
+  for (auto const& path : removed) std::remove(path.c_str());
+  for (auto& w : waiters) w.set_value(BlockPtr(block));
+}
+
+void ObjectReadCache::Erase(BlockId const& id,
+                            std::vector<std::string>& removed) {
+  auto g = generations_.find(id.first);
+  if (g == generations_.end()) return;
+  auto b = g->second.blocks.find(id.second);
+  if (b == g->second.blocks.end()) return;
+  bytes_ -= b->second.size;
+  lru_.erase(b->second.lru);
+  removed.push_back(std::move(b->second.path));
+  g->second.blocks.erase(b);
+  if (g->second.blocks.empty()) generations_.erase(g);
+}
+
+std::shared_ptr<ObjectReadCache> MakeObjectReadCache(
+    Options const& options, ObjectReadCache::Executor executor) {
+  auto directory =
+      options.get<storage_experimental::ReadCacheDirectoryOption>();
+  if (directory.empty()) return nullptr;
+  auto const max_bytes =
+      options.has<storage_experimental::ReadCacheMaxBytesOption>()
+          ? options.get<storage_experimental::ReadCacheMaxBytesOption>()
+          : kDefaultMaxBytes;
+  auto const block_size =
+      options.has<storage_experimental::ReadCacheBlockSizeOption>()
+          ? options.get<storage_experimental::ReadCacheBlockSizeOption>()
+          : kDefaultBlockSize;
+  return std::make_shared<ObjectReadCache>(
+      std::move(directory), max_bytes,
+      static_cast<std::int64_t>((std::max)(block_size, std::size_t{1})),
+      std::move(executor));
+}
+
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
+}  // namespace storage_internal
+}  // namespace cloud
+}  // namespace google
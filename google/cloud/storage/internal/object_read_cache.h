@@ -0,0 +1,161 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GOOGLE_CLOUD_CPP_GOOGLE_CLOUD_STORAGE_INTERNAL_OBJECT_READ_CACHE_H
+#define GOOGLE_CLOUD_CPP_GOOGLE_CLOUD_STORAGE_INTERNAL_OBJECT_READ_CACHE_H
+
+#include "google/cloud/storage/internal/hash_values.h"
+#include "google/cloud/storage/version.h"
+#include "google/cloud/future.h"
+#include "google/cloud/options.h"
+#include "google/cloud/status_or.h"
+#include "absl/types/optional.h"
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace google {
+namespace cloud {
+namespace storage_internal {
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_BEGIN
+
+/// A block of an object generation, as stored in an `ObjectReadCache`.
+struct ObjectReadCacheBlock {
+  /// The block contents. Only the last block of an object is shorter than the
+  /// cache block size.
+  std::string data;
+  /// The size of the full object, if known.
+  absl::optional<std::uint64_t> object_size;
+  /// The hashes of the full object, if known.
+  storage::internal::HashValues hashes;
+};
+
+/**
+ * A local on-disk cache of object generation contents.
+ *
+ * Object generations are immutable, so the cache never needs to invalidate
+ * its contents. Each generation is split into blocks of `block_size()` bytes,
+ * and each block is stored in its own file in the cache directory. The cache
+ * keeps an in-memory index of these files, grouped by object generation, with
+ * the CRC32C checksum of each block. Blocks read from disk are verified against
+ * this checksum, and blocks that fail verification are downloaded again.
+ *
+ * Once the cache holds more than `max_bytes` the least recently used blocks are
+ * removed.
+ *
+ * A block that is not in the cache is downloaded with the `Fetcher` provided
+ * by the caller. Concurrent reads of the same missing block share a single
+ * download. Failed downloads are not cached.
+ *
+ * The cache reads and writes its files in the calling thread, unless it is
+ * created with an `Executor`. Asynchronous callers use an executor to keep the
+ * file I/O out of the threads that complete the downloads.
+ */
+class ObjectReadCache : public std::enable_shared_from_this<ObjectReadCache> {
+ public:
+  using BlockPtr = std::shared_ptr<ObjectReadCacheBlock const>;
+
+  /**
+   * Downloads @p length bytes of the object, starting at @p offset.
+   *
+   * Implementations return a short, possibly empty, block if the object ends
+   * before `offset + length`.
+   */
+  using Fetcher = std::function<future<StatusOr<ObjectReadCacheBlock>>(
+      std::int64_t offset, std::int64_t length)>;
+
+  /// Runs @p fn, usually in a different thread.
+  using Executor = std::function<void(std::function<void()> fn)>;
+
+  ObjectReadCache(std::string directory, std::uint64_t max_bytes,
+                  std::int64_t block_size, Executor executor = {});
+  ~ObjectReadCache();
+
+  std::int64_t block_size() const { return block_size_; }
+
+  /// Returns block @p index of the object generation, fetching it if needed.
+  future<StatusOr<BlockPtr>> Read(std::string const& bucket,
+                                  std::string const& object,
+                                  std::int64_t generation, std::int64_t index,
+                                  Fetcher const& fetcher);
+
+  /// Returns the file holding a block, or an empty string if it is not cached.
+  std::string BlockPath(std::string const& bucket, std::string const& object,
+                        std::int64_t generation, std::int64_t index);
+
+ private:
+  using BlockId = std::pair<std::string, std::int64_t>;
+
+  struct Entry {
+    std::string path;
+    std::size_t size;
+    std::uint32_t crc32c;
+    std::list<BlockId>::iterator lru;
+  };
+
+  struct Generation {
+    std::map<std::int64_t, Entry> blocks;
+    absl::optional<std::uint64_t> object_size;
+    storage::internal::HashValues hashes;
+  };
+
+  void Run(std::function<void()> fn);
+  future<StatusOr<BlockPtr>> LoadOrFetch(BlockId const& id, Entry const& entry,
+                                         ObjectReadCacheBlock block,
+                                         Fetcher const& fetcher);
+  future<StatusOr<BlockPtr>> Fetch(BlockId const& id, Fetcher const& fetcher,
+                                   std::unique_lock<std::mutex> lk,
+                                   std::vector<std::string> removed);
+  absl::optional<Entry> Store(ObjectReadCacheBlock const& block);
+  void OnFetch(BlockId const& id, StatusOr<ObjectReadCacheBlock> fetched);
+  void Erase(BlockId const& id, std::vector<std::string>& removed);
+
+  std::string directory_;
+  std::uint64_t max_bytes_;
+  std::int64_t block_size_;
+  std::string prefix_;
+  Executor executor_;
+  std::atomic<std::uint64_t> next_file_{0};
+  std::once_flag store_error_logged_;
+
+  std::mutex mu_;
+  std::map<std::string, Generation> generations_;
+  // The cached blocks, most recently used first.
+  std::list<BlockId> lru_;
+  std::uint64_t bytes_ = 0;
+  std::map<BlockId, std::vector<promise<StatusOr<BlockPtr>>>> pending_;
+};
+
+/**
+ * Creates the read cache configured in @p options.
+ *
+ * Returns `nullptr` if `storage_experimental::ReadCacheDirectoryOption` is not
+ * set. The cache uses @p executor for its file I/O, if provided.
+ */
+std::shared_ptr<ObjectReadCache> MakeObjectReadCache(
+    Options const& options, ObjectReadCache::Executor executor = {});
+
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
+}  // namespace storage_internal
+}  // namespace cloud
+}  // namespace google
+
+#endif  // GOOGLE_CLOUD_CPP_GOOGLE_CLOUD_STORAGE_INTERNAL_OBJECT_READ_CACHE_H
@@ -0,0 +1,297 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/storage/internal/object_read_cache.h"
+#include "google/cloud/storage/options.h"
+#include "google/cloud/storage/testing/canonical_errors.h"
+#include "google/cloud/testing_util/status_matchers.h"
+#include <gmock/gmock.h>
+#include <cstdio>
+#include <deque>
+#include <fstream>
+#include <functional>
+#include <string>
+#include <utility>
+
+namespace google {
+namespace cloud {
+namespace storage_internal {
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_BEGIN
+namespace {
+
+using ::google::cloud::storage::testing::canonical_errors::PermanentError;
+using ::google::cloud::testing_util::StatusIs;
+using ::testing::IsEmpty;
+using ::testing::Not;
+using ::testing::Optional;
+
+auto constexpr kBlockSize = 8;
+
+std::string const& Contents() {
+  static auto const* const kContents =
+      new std::string("0123456789abcdefghijklmnopqrstuvwxyz");
+  return *kContents;
+}
+
+bool FileExists(std::string const& path) {
+  return std::ifstream(path, std::ios::binary).is_open();
+}
+
+// Returns a fetcher serving `Contents()` and counting the downloads.
+ObjectReadCache::Fetcher MakeFetcher(int& calls) {
+  return [&calls](std::int64_t offset, std::int64_t length) {
+    ++calls;
+    auto const& contents = Contents();
+    ObjectReadCacheBlock block;
+    if (offset < static_cast<std::int64_t>(contents.size())) {
+      block.data = contents.substr(static_cast<std::size_t>(offset),
+                                   static_cast<std::size_t>(length));
+    }
+    block.object_size = contents.size();
+    block.hashes.crc32c = "test-crc32c";
+    return make_ready_future(make_status_or(std::move(block)));
+  };
+}
+
+std::shared_ptr<ObjectReadCache> MakeCache(std::uint64_t max_bytes = 1024) {
+  return std::make_shared<ObjectReadCache>(::testing::TempDir(), max_bytes,
+                                           kBlockSize);
+}
+
+TEST(ObjectReadCache, MissThenHit) {
+  auto cache = MakeCache();
+  int calls = 0;
+  auto const fetcher = MakeFetcher(calls);
+
+  auto block = cache->Read("b", "o", 1234, 1, fetcher).get();
+  ASSERT_STATUS_OK(block);
+  EXPECT_EQ((*block)->data, Contents().substr(8, kBlockSize));
+  EXPECT_EQ(calls, 1);
+  auto const path = cache->BlockPath("b", "o", 1234, 1);
+  EXPECT_THAT(path, Not(IsEmpty()));
+  EXPECT_TRUE(FileExists(path));
+
+  block = cache->Read("b", "o", 1234, 1, fetcher).get();
+  ASSERT_STATUS_OK(block);
+  EXPECT_EQ((*block)->data, Contents().substr(8, kBlockSize));
+  EXPECT_THAT((*block)->object_size, Optional(Contents().size()));
+  EXPECT_EQ((*block)->hashes.crc32c, "test-crc32c");
+  EXPECT_EQ(calls, 1);
+}
+
+TEST(ObjectReadCache, ShortLastBlock) {
+  auto cache = MakeCache();
+  int calls = 0;
+  auto const fetcher = MakeFetcher(calls);
+
+  for (int i = 0; i != 2; ++i) {
+    auto block = cache->Read("b", "o", 1234, 4, fetcher).get();
+    ASSERT_STATUS_OK(block);
+    EXPECT_EQ((*block)->data, Contents().substr(32));
+  }
+  EXPECT_EQ(calls, 1);
+}
+
+TEST(ObjectReadCache, KeyedByGeneration) {
+  auto cache = MakeCache();
+  int calls = 0;
+  auto const fetcher = MakeFetcher(calls);
+
+  ASSERT_STATUS_OK(cache->Read("b", "o", 1234, 0, fetcher).get());
+  ASSERT_STATUS_OK(cache->Read("b", "o", 2345, 0, fetcher).get());
+  ASSERT_STATUS_OK(cache->Read("b", "o2", 1234, 0, fetcher).get());
+  ASSERT_STATUS_OK(cache->Read("b2", "o", 1234, 0, fetcher).get());
+  EXPECT_EQ(calls, 4);
+}
+
+TEST(ObjectReadCache, ErrorsAreNotCached) {
+  auto cache = MakeCache();
+  int calls = 0;
+  auto const fetcher = MakeFetcher(calls);
+  auto failing = [&calls](std::int64_t, std::int64_t) {
+    ++calls;
+    return make_ready_future(StatusOr<ObjectReadCacheBlock>(PermanentError()));
+  };
+
+  auto block = cache->Read("b", "o", 1234, 0, failing).get();
+  EXPECT_THAT(block, StatusIs(PermanentError().code()));
+  EXPECT_THAT(cache->BlockPath("b", "o", 1234, 0), IsEmpty());
+
+  block = cache->Read("b", "o", 1234, 0, fetcher).get();
+  ASSERT_STATUS_OK(block);
+  EXPECT_EQ((*block)->data, Contents().substr(0, kBlockSize));
+  EXPECT_EQ(calls, 2);
+}
+
+TEST(ObjectReadCache, ConcurrentMissesShareFetch) {
+  auto cache = MakeCache();
+  int calls = 0;
+  promise<StatusOr<ObjectReadCacheBlock>> p;
+  auto fetcher = [&](std::int64_t, std::int64_t) {
+    ++calls;
+    return p.get_future();
+  };
+
+  auto f1 = cache->Read("b", "o", 1234, 0, fetcher);
+  auto f2 = cache->Read("b", "o", 1234, 0, fetcher);
+  EXPECT_EQ(calls, 1);
+  EXPECT_FALSE(f1.is_ready());
+  EXPECT_FALSE(f2.is_ready());
+
+  ObjectReadCacheBlock block;
+  block.data = Contents().substr(0, kBlockSize);
+  p.set_value(std::move(block));
+  auto b1 = f1.get();
+  auto b2 = f2.get();
+  ASSERT_STATUS_OK(b1);
+  ASSERT_STATUS_OK(b2);
+  EXPECT_EQ((*b1)->data, Contents().substr(0, kBlockSize));
+  EXPECT_EQ(*b1, *b2);
+}
+
+TEST(ObjectReadCache, CorruptedBlockIsFetchedAgain) {
+  auto cache = MakeCache();
+  int calls = 0;
+  auto const fetcher = MakeFetcher(calls);
+
+  ASSERT_STATUS_OK(cache->Read("b", "o", 1234, 0, fetcher).get());
+  auto const path = cache->BlockPath("b", "o", 1234, 0);
+  ASSERT_THAT(path, Not(IsEmpty()));
+  // Same size, different contents.
+  std::ofstream(path, std::ios::binary | std::ios::trunc) << "XXXXXXXX";
+
+  auto block = cache->Read("b", "o", 1234, 0, fetcher).get();
+  ASSERT_STATUS_OK(block);
+  EXPECT_EQ((*block)->data, Contents().substr(0, kBlockSize));
+  EXPECT_EQ(calls, 2);
+  EXPECT_FALSE(FileExists(path));
+}
+
+TEST(ObjectReadCache, MissingBlockIsFetchedAgain) {
+  auto cache = MakeCache();
+  int calls = 0;
+  auto const fetcher = MakeFetcher(calls);
+
+  ASSERT_STATUS_OK(cache->Read("b", "o", 1234, 0, fetcher).get());
+  auto const path = cache->BlockPath("b", "o", 1234, 0);
+  ASSERT_EQ(std::remove(path.c_str()), 0);
+
+  auto block = cache->Read("b", "o", 1234, 0, fetcher).get();
+  ASSERT_STATUS_OK(block);
+  EXPECT_EQ((*block)->data, Contents().substr(0, kBlockSize));
+  EXPECT_EQ(calls, 2);
+}
+
+TEST(ObjectReadCache, EvictsLeastRecentlyUsed) {
+  auto cache = MakeCache(2 * kBlockSize);
+  int calls = 0;
+  auto const fetcher = MakeFetcher(calls);
+
+  ASSERT_STATUS_OK(cache->Read("b", "o", 1234, 0, fetcher).get());
+  ASSERT_STATUS_OK(cache->Read("b", "o", 1234, 1, fetcher).get());
+  // Make block 1 the least recently used.
+  ASSERT_STATUS_OK(cache->Read("b", "o", 1234, 0, fetcher).get());
+  EXPECT_EQ(calls, 2);
+  auto const evicted = cache->BlockPath("b", "o", 1234, 1);
+
+  ASSERT_STATUS_OK(cache->Read("b", "o", 1234, 2, fetcher).get());
+  EXPECT_EQ(calls, 3);
+  EXPECT_THAT(cache->BlockPath("b", "o", 1234, 1), IsEmpty());
+  EXPECT_FALSE(FileExists(evicted));
+
+  ASSERT_STATUS_OK(cache->Read("b", "o", 1234, 0, fetcher).get());
+  EXPECT_EQ(calls, 3);
+  ASSERT_STATUS_OK(cache->Read("b", "o", 1234, 1, fetcher).get());
+  EXPECT_EQ(calls, 4);
+}
+
+TEST(ObjectReadCache, DestructorRemovesFiles) {
+  auto cache = MakeCache();
+  int calls = 0;
+  ASSERT_STATUS_OK(cache->Read("b", "o", 1234, 0, MakeFetcher(calls)).get());
+  auto const path = cache->BlockPath("b", "o", 1234, 0);
+  EXPECT_TRUE(FileExists(path));
+  cache.reset();
+  EXPECT_FALSE(FileExists(path));
+}
+
+TEST(ObjectReadCache, UnwritableDirectory) {
+  auto cache = std::make_shared<ObjectReadCache>(
+      "/invalid/path/does/not/exist", 1024, kBlockSize);
+  int calls = 0;
+  auto const fetcher = MakeFetcher(calls);
+
+  for (int i = 0; i != 2; ++i) {
+    auto block = cache->Read("b", "o", 1234, 0, fetcher).get();
+    ASSERT_STATUS_OK(block);
+    EXPECT_EQ((*block)->data, Contents().substr(0, kBlockSize));
+  }
+  EXPECT_EQ(calls, 2);
+}
+
+TEST(ObjectReadCache, ExecutorRunsFileIo) {
+  std::deque<std::function<void()>> queue;
+  auto run_all = [&queue] {
+    while (!queue.empty()) {
+      auto fn = std::move(queue.front());
+      queue.pop_front();
+      fn();
+    }
+  };
+  auto cache = std::make_shared<ObjectReadCache>(
+      ::testing::TempDir(), 1024, kBlockSize,
+      [&queue](std::function<void()> fn) { queue.push_back(std::move(fn)); });
+  int calls = 0;
+  auto const fetcher = MakeFetcher(calls);
+
+  // The download completes, but the block is stored by the executor.
+  auto f = cache->Read("b", "o", 1234, 1, fetcher);
+  EXPECT_EQ(calls, 1);
+  EXPECT_FALSE(f.is_ready());
+  EXPECT_THAT(cache->BlockPath("b", "o", 1234, 1), IsEmpty());
+  run_all();
+  ASSERT_TRUE(f.is_ready());
+  auto block = f.get();
+  ASSERT_STATUS_OK(block);
+  EXPECT_EQ((*block)->data, Contents().substr(8, kBlockSize));
+  EXPECT_TRUE(FileExists(cache->BlockPath("b", "o", 1234, 1)));
+
+  // Cache hits load the block in the executor too.
+  f = cache->Read("b", "o", 1234, 1, fetcher);
+  EXPECT_FALSE(f.is_ready());
+  run_all();
+  ASSERT_TRUE(f.is_ready());
+  block = f.get();
+  ASSERT_STATUS_OK(block);
+  EXPECT_EQ((*block)->data, Contents().substr(8, kBlockSize));
+  EXPECT_EQ(calls, 1);
+}
+
+TEST(ObjectReadCache, MakeObjectReadCache) {
+  EXPECT_EQ(MakeObjectReadCache(Options{}), nullptr);
+
+  auto cache = MakeObjectReadCache(
+      Options{}
+          .set<storage_experimental::ReadCacheDirectoryOption>(
+              ::testing::TempDir())
+          .set<storage_experimental::ReadCacheBlockSizeOption>(1024));
+  ASSERT_NE(cache, nullptr);
+  EXPECT_EQ(cache->block_size(), 1024);
+}
+
+}  // namespace
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
+}  // namespace storage_internal
+}  // namespace cloud
+}  // namespace google
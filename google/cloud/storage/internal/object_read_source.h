@@ -19,6 +19,8 @@
 #include "google/cloud/storage/internal/http_response.h"
 #include "google/cloud/storage/version.h"
 #include "google/cloud/status_or.h"
+#include "absl/strings/cord.h"
+#include "absl/strings/cord_buffer.h"
 #include "absl/types/optional.h"
 #include <cstdint>
 #include <string>
@@ -57,6 +59,8 @@ struct ReadSourceResult {
   absl::optional<std::string> storage_class;
   absl::optional<std::uint64_t> size;
   absl::optional<std::string> transformation;
+  /// The data returned by `ObjectReadSource::ReadChunk()`.
+  absl::Cord contents;
 
   ReadSourceResult() = default;
   ReadSourceResult(std::size_t b, HttpResponse r)
@@ -83,6 +87,27 @@ class ObjectReadSource {
   /// Read more data from the download, returning any HTTP headers and error
   /// codes.
   virtual StatusOr<ReadSourceResult> Read(char* buf, std::size_t n) = 0;
+
+  /**
+   * Read up to @p n bytes from the download into `ReadSourceResult::contents`.
+   *
+   * Sources that receive the data as an `absl::Cord` override this function to
+   * return the data without copying it. The default implementation reads into
+   * an uninitialized `absl::CordBuffer`. Its capacity is bounded, so a short
+   * read does not pin a large allocation, and each call returns at most
+   * `absl::CordBuffer::kCustomLimit` bytes.
+   */
+  virtual StatusOr<ReadSourceResult> ReadChunk(std::size_t n) {
+    auto buffer = absl::CordBuffer::CreateWithCustomLimit(
+        absl::CordBuffer::kCustomLimit, n);
+    auto available = buffer.available_up_to(n);
+    auto result = Read(available.data(), available.size());
+    if (!result) return result;
+    buffer.IncreaseLengthBy(result->bytes_received);
+    result->contents = absl::Cord();
+    result->contents.Append(std::move(buffer));
+    return result;
+  }
 };
 
 /**
@@ -103,7 +103,8 @@ ObjectReadStreambuf::int_type ObjectReadStreambuf::ReportError(Status status) {
 #endif  // GOOGLE_CLOUD_CPP_HAVE_EXCEPTIONS
 }
 
-void ObjectReadStreambuf::ThrowHashMismatchDelegate(char const* function_name) {
+std::string ObjectReadStreambuf::RecordHashMismatch(
+    char const* function_name) {
   std::string msg;
   msg += function_name;
   msg += "(): mismatched hashes in download";
@@ -117,6 +118,11 @@ void ObjectReadStreambuf::ThrowHashMismatchDelegate(char const* function_name) {
     // produce invalid checksums, but that is not the interesting information.
     status_ = google::cloud::internal::DataLossError(msg, GCP_ERROR_INFO());
   }
+  return msg;
+}
+
+void ObjectReadStreambuf::ThrowHashMismatchDelegate(char const* function_name) {
+  auto msg = RecordHashMismatch(function_name);
 #if GOOGLE_CLOUD_CPP_HAVE_EXCEPTIONS
   // The only way to report errors from a std::basic_streambuf<> (which this
   // class derives from) is to throw exceptions:
@@ -130,7 +136,7 @@ void ObjectReadStreambuf::ThrowHashMismatchDelegate(char const* function_name) {
 #endif  // GOOGLE_CLOUD_CPP_HAVE_EXCEPTIONS
 }
 
-bool ObjectReadStreambuf::ValidateHashes(char const* function_name) {
+bool ObjectReadStreambuf::CompareHashes() {
   // This function is called once the stream is "closed" (either an explicit
   // `Close()` call or a permanent error). After this point the validator is
   // not usable.
@@ -147,11 +153,88 @@ bool ObjectReadStreambuf::ValidateHashes(char const* function_name) {
       std::move(*validator).Finish(std::move(*function).Finish());
   computed_hash_ = FormatComputedHashes(hash_validator_result_);
   received_hash_ = FormatReceivedHashes(hash_validator_result_);
-  if (!hash_validator_result_.is_mismatch) return true;
+  return !hash_validator_result_.is_mismatch;
+}
+
+bool ObjectReadStreambuf::ValidateHashes(char const* function_name) {
+  if (CompareHashes()) return true;
   ThrowHashMismatchDelegate(function_name);
   return false;
 }
 
+Status ObjectReadStreambuf::ValidateHashesIfClosed(char const* function_name) {
+  if (IsOpen() || CompareHashes()) return status_;
+  RecordHashMismatch(function_name);
+  return status_;
+}
+
+Status ObjectReadStreambuf::HandleReadError(char const* function_name,
+                                            Status status) {
+  status_ = std::move(status);
+  return ValidateHashesIfClosed(function_name);
+}
+
+void ObjectReadStreambuf::HandleReadResult(ReadSourceResult& read) {
+  hash_validator_->ProcessHashValues(read.hashes);
+  for (auto const& kv : read.response.headers) {
+    headers_.emplace(kv.first, kv.second);
+  }
+  if (!generation_) generation_ = std::move(read.generation);
+  if (!metageneration_) metageneration_ = std::move(read.metageneration);
+  if (!storage_class_) storage_class_ = std::move(read.storage_class);
+  if (!size_) size_ = std::move(read.size);
+  if (!transformation_) transformation_ = std::move(read.transformation);
+
+  if (source_pos_ >= 0) {
+    source_pos_ += static_cast<std::streamoff>(read.bytes_received);
+  } else if (size_) {
+    source_pos_ += *size_ + static_cast<std::streamoff>(read.bytes_received);
+  }
+}
+
+StatusOr<std::size_t> ObjectReadStreambuf::ReadInto(char* buf, std::size_t n) {
+  if (hash_validator_result_.is_mismatch || !status_.ok()) return status_;
+  // Drain the get area first, this is only non-empty if the application mixes
+  // this function with the `std::istream` API.
+  auto const from_internal = (std::min)(
+      n, static_cast<std::size_t>(egptr() - gptr()));
+  if (from_internal > 0) {
+    std::memcpy(buf, gptr(), from_internal);
+    gbump(static_cast<int>(from_internal));
+    return from_internal;
+  }
+  if (n == 0 || !IsOpen()) return 0;
+
+  auto read = source_->Read(buf, n);
+  if (!read) return HandleReadError(__func__, std::move(read).status());
+  hash_function_->Update(absl::string_view{buf, read->bytes_received});
+  HandleReadResult(*read);
+  auto status = ValidateHashesIfClosed(__func__);
+  if (!status.ok()) return status;
+  return read->bytes_received;
+}
+
+StatusOr<absl::Cord> ObjectReadStreambuf::ReadChunk(std::size_t max_size) {
+  if (hash_validator_result_.is_mismatch || !status_.ok()) return status_;
+  auto const from_internal = (std::min)(
+      max_size, static_cast<std::size_t>(egptr() - gptr()));
+  if (from_internal > 0) {
+    auto contents = absl::Cord(absl::string_view{gptr(), from_internal});
+    gbump(static_cast<int>(from_internal));
+    return contents;
+  }
+  if (max_size == 0 || !IsOpen()) return absl::Cord();
+
+  auto read = source_->ReadChunk(max_size);
+  if (!read) return HandleReadError(__func__, std::move(read).status());
+  auto contents = std::move(read->contents);
+  for (auto chunk : contents.Chunks()) hash_function_->Update(chunk);
+  HandleReadResult(*read);
+  auto status = ValidateHashesIfClosed(__func__);
+  if (!status.ok()) return status;
+  return contents;
+}
+
 bool ObjectReadStreambuf::CheckPreconditions(char const* function_name) {
   if (hash_validator_result_.is_mismatch) {
     ThrowHashMismatchDelegate(function_name);
@@ -213,22 +296,8 @@ std::streamsize ObjectReadStreambuf::xsgetn(char* s, std::streamsize count) {
   if (!read) return run_validator_if_closed(std::move(read).status());
 
   hash_function_->Update(absl::string_view{s + offset, read->bytes_received});
-  hash_validator_->ProcessHashValues(read->hashes);
   offset += static_cast<std::streamsize>(read->bytes_received);
-  for (auto const& kv : read->response.headers) {
-    headers_.emplace(kv.first, kv.second);
-  }
-  if (!generation_) generation_ = std::move(read->generation);
-  if (!metageneration_) metageneration_ = std::move(read->metageneration);
-  if (!storage_class_) storage_class_ = std::move(read->storage_class);
-  if (!size_) size_ = std::move(read->size);
-  if (!transformation_) transformation_ = std::move(read->transformation);
-
-  if (source_pos_ >= 0) {
-    source_pos_ += static_cast<std::streamoff>(read->bytes_received);
-  } else if (size_) {
-    source_pos_ += *size_ + static_cast<std::streamoff>(read->bytes_received);
-  }
+  HandleReadResult(*read);
   return run_validator_if_closed(Status());
 }
 
@@ -22,6 +22,8 @@
 #include "google/cloud/storage/version.h"
 #include "google/cloud/status.h"
 #include "google/cloud/status_or.h"
+#include "absl/strings/cord.h"
+#include <cstddef>
 #include <iostream>
 #include <map>
 #include <memory>
@@ -62,6 +64,23 @@ class ObjectReadStreambuf : public std::basic_streambuf<char> {
 
   bool IsOpen() const;
   void Close();
+
+  /**
+   * Reads up to @p n bytes directly into @p buf.
+   *
+   * Unlike `sgetn()`, this function never throws, errors (including checksum
+   * mismatches) are returned as a `Status`. Any data in the get area is
+   * returned first. Returns 0 once the download is complete.
+   */
+  StatusOr<std::size_t> ReadInto(char* buf, std::size_t n);
+
+  /**
+   * Reads up to @p max_size bytes, without copying them when possible.
+   *
+   * Errors are reported as in `ReadInto()`. Returns an empty `absl::Cord`
+   * once the download is complete.
+   */
+  StatusOr<absl::Cord> ReadChunk(std::size_t max_size);
   Status const& status() const { return status_; }
   std::string const& received_hash() const { return received_hash_; }
   std::string const& computed_hash() const { return computed_hash_; }
@@ -84,8 +103,13 @@ class ObjectReadStreambuf : public std::basic_streambuf<char> {
 
  private:
   int_type ReportError(Status status);
+  std::string RecordHashMismatch(char const* function_name);
   void ThrowHashMismatchDelegate(char const* function_name);
+  bool CompareHashes();
   bool ValidateHashes(char const* function_name);
+  Status ValidateHashesIfClosed(char const* function_name);
+  Status HandleReadError(char const* function_name, Status status);
+  void HandleReadResult(ReadSourceResult& read);
   bool CheckPreconditions(char const* function_name);
 
   int_type underflow() override;
@@ -13,9 +13,14 @@
 // limitations under the License.
 
 #include "google/cloud/storage/internal/object_read_streambuf.h"
+#include "google/cloud/storage/object_read_stream.h"
 #include "google/cloud/storage/testing/mock_client.h"
+#include "google/cloud/testing_util/status_matchers.h"
+#include "absl/strings/cord_buffer.h"
 #include <gmock/gmock.h>
+#include <algorithm>
 #include <memory>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -26,6 +31,7 @@ GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_BEGIN
 namespace internal {
 namespace {
 
+using ::google::cloud::testing_util::StatusIs;
 using ::testing::Return;
 
 TEST(ObjectReadStreambufTest, FailedTellg) {
@@ -173,6 +179,151 @@ TEST(ObjectReadStreambufTest, WrongSeek) {
   EXPECT_TRUE(stream.fail());
 }
 
+TEST(ObjectReadStreambufTest, ReadInto) {
+  auto read_source = std::make_unique<testing::MockObjectReadSource>();
+  auto open = true;
+  EXPECT_CALL(*read_source, IsOpen()).WillRepeatedly([&] { return open; });
+  EXPECT_CALL(*read_source, Read)
+      .WillOnce([](char* buf, std::size_t n) {
+        auto const data = std::string(128 * 1024, 'a');
+        auto const size = (std::min)(n, data.size());
+        std::copy(data.begin(), data.begin() + size, buf);
+        return ReadSourceResult{size, {}};
+      })
+      .WillOnce([&](char* buf, std::size_t n) {
+        EXPECT_EQ(n, 1024);
+        std::fill(buf, buf + 4, 'b');
+        open = false;
+        return ReadSourceResult{4, {}};
+      });
+  ObjectReadStreambuf buf(ReadObjectRangeRequest{}, std::move(read_source));
+
+  // Populate the get area, the next call should return its contents.
+  std::istream stream(&buf);
+  EXPECT_EQ(stream.get(), 'a');
+  std::vector<char> v(1024);
+  auto read = buf.ReadInto(v.data(), v.size());
+  ASSERT_STATUS_OK(read);
+  EXPECT_EQ(*read, 1024);
+  EXPECT_EQ(std::string(v.data(), 3), "aaa");
+
+  std::vector<char> rest(128 * 1024);
+  read = buf.ReadInto(rest.data(), rest.size());
+  ASSERT_STATUS_OK(read);
+  EXPECT_EQ(*read, 128 * 1024 - 1 - 1024);
+
+  read = buf.ReadInto(v.data(), v.size());
+  ASSERT_STATUS_OK(read);
+  EXPECT_EQ(*read, 4);
+  EXPECT_EQ(std::string(v.data(), 4), "bbbb");
+
+  read = buf.ReadInto(v.data(), v.size());
+  ASSERT_STATUS_OK(read);
+  EXPECT_EQ(*read, 0);
+  EXPECT_EQ(stream.tellg(), 128 * 1024 + 4);
+}
+
+TEST(ObjectReadStreambufTest, ReadChunk) {
+  auto read_source = std::make_unique<testing::MockObjectReadSource>();
+  auto open = true;
+  EXPECT_CALL(*read_source, IsOpen()).WillRepeatedly([&] { return open; });
+  // The mock uses the default implementation of `ReadChunk()`, which calls
+  // `Read()`.
+  EXPECT_CALL(*read_source, Read).WillOnce([&](char* buf, std::size_t n) {
+    EXPECT_EQ(n, 1024);
+    std::fill(buf, buf + 16, 'a');
+    open = false;
+    return ReadSourceResult{16, {}};
+  });
+  ObjectReadStreambuf buf(ReadObjectRangeRequest{}, std::move(read_source));
+
+  auto chunk = buf.ReadChunk(1024);
+  ASSERT_STATUS_OK(chunk);
+  EXPECT_EQ(std::string(*chunk), std::string(16, 'a'));
+  chunk = buf.ReadChunk(1024);
+  ASSERT_STATUS_OK(chunk);
+  EXPECT_TRUE(chunk->empty());
+}
+
+TEST(ObjectReadStreambufTest, ReadChunkBoundedBuffer) {
+  auto read_source = std::make_unique<testing::MockObjectReadSource>();
+  EXPECT_CALL(*read_source, IsOpen()).WillRepeatedly(Return(true));
+  EXPECT_CALL(*read_source, Read).WillOnce([](char* buf, std::size_t n) {
+    EXPECT_GT(n, 0);
+    EXPECT_LE(n, absl::CordBuffer::kCustomLimit);
+    std::fill(buf, buf + n, 'a');
+    return ReadSourceResult{n, {}};
+  });
+  ObjectReadStreambuf buf(ReadObjectRangeRequest{}, std::move(read_source));
+
+  auto chunk = buf.ReadChunk(4 * absl::CordBuffer::kCustomLimit);
+  ASSERT_STATUS_OK(chunk);
+  EXPECT_GT(chunk->size(), 0);
+  EXPECT_LE(chunk->size(), absl::CordBuffer::kCustomLimit);
+  EXPECT_EQ(std::string(*chunk), std::string(chunk->size(), 'a'));
+}
+
+TEST(ObjectReadStreambufTest, ReadIntoHashMismatch) {
+  auto read_source = std::make_unique<testing::MockObjectReadSource>();
+  auto open = true;
+  EXPECT_CALL(*read_source, IsOpen()).WillRepeatedly([&] { return open; });
+  EXPECT_CALL(*read_source, Read).WillOnce([&](char* buf, std::size_t n) {
+    std::fill(buf, buf + n, 'a');
+    open = false;
+    auto result = ReadSourceResult{n, {}};
+    result.hashes = HashValues{/*crc32c=*/"invalid", /*md5=*/{}};
+    return result;
+  });
+  ObjectReadStreambuf buf(ReadObjectRangeRequest{}, std::move(read_source));
+
+  std::vector<char> v(1024);
+  auto read = buf.ReadInto(v.data(), v.size());
+  EXPECT_THAT(read, StatusIs(StatusCode::kDataLoss));
+  EXPECT_THAT(buf.status(), StatusIs(StatusCode::kDataLoss));
+  // The error is sticky.
+  read = buf.ReadInto(v.data(), v.size());
+  EXPECT_THAT(read, StatusIs(StatusCode::kDataLoss));
+}
+
+TEST(ObjectReadStreambufTest, ReadIntoError) {
+  auto read_source = std::make_unique<testing::MockObjectReadSource>();
+  EXPECT_CALL(*read_source, IsOpen()).WillRepeatedly(Return(true));
+  EXPECT_CALL(*read_source, Read)
+      .WillOnce(Return(Status(StatusCode::kPermissionDenied, "uh-oh")));
+  ObjectReadStreambuf buf(ReadObjectRangeRequest{}, std::move(read_source));
+
+  std::vector<char> v(1024);
+  auto read = buf.ReadInto(v.data(), v.size());
+  EXPECT_THAT(read, StatusIs(StatusCode::kPermissionDenied));
+  auto chunk = buf.ReadChunk(1024);
+  EXPECT_THAT(chunk, StatusIs(StatusCode::kPermissionDenied));
+}
+
+TEST(ObjectReadStreambufTest, ReadIntoStreamState) {
+  auto read_source = std::make_unique<testing::MockObjectReadSource>();
+  EXPECT_CALL(*read_source, IsOpen()).WillRepeatedly(Return(true));
+  EXPECT_CALL(*read_source, Read)
+      .WillRepeatedly(Return(Status(StatusCode::kPermissionDenied, "uh-oh")));
+  ObjectReadStream stream(std::make_unique<ObjectReadStreambuf>(
+      ReadObjectRangeRequest{}, std::move(read_source)));
+
+  // With the default exception mask the error is only reported in the result
+  // and the stream state.
+  std::vector<char> v(1024);
+  auto read = stream.ReadInto(v.data(), v.size());
+  EXPECT_THAT(read, StatusIs(StatusCode::kPermissionDenied));
+  EXPECT_TRUE(stream.bad());
+
+#if GOOGLE_CLOUD_CPP_HAVE_EXCEPTIONS
+  // Like `read()`, `ReadInto()` and `ReadChunk()` honor `exceptions()`.
+  stream.clear();
+  stream.exceptions(std::ios_base::badbit);
+  EXPECT_THROW(stream.ReadInto(v.data(), v.size()), std::ios_base::failure);
+  stream.clear();
+  EXPECT_THROW(stream.ReadChunk(1024), std::ios_base::failure);
+#endif  // GOOGLE_CLOUD_CPP_HAVE_EXCEPTIONS
+}
+
 }  // namespace
 }  // namespace internal
 GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
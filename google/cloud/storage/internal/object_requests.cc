@@ -17,6 +17,7 @@
 #include "google/cloud/storage/internal/metadata_parser.h"
 #include "google/cloud/storage/internal/object_acl_requests.h"
 #include "google/cloud/storage/internal/object_metadata_parser.h"
+#include "google/cloud/storage/internal/object_metadata_sax_parser.h"
 #include "google/cloud/storage/object_metadata.h"
 #include "absl/strings/numbers.h"
 #include "absl/strings/str_split.h"
@@ -118,31 +119,7 @@ std::ostream& operator<<(std::ostream& os, ListObjectsRequest const& r) {
 
 StatusOr<ListObjectsResponse> ListObjectsResponse::FromHttpResponse(
     std::string const& payload) {
-  auto json = nlohmann::json::parse(payload, nullptr, false);
-  if (!json.is_object()) return ExpectedJsonObject(payload, GCP_ERROR_INFO());
-
-  ListObjectsResponse result;
-  result.next_page_token = json.value("nextPageToken", "");
-
-  for (auto const& kv : json["items"].items()) {
-    auto parsed = internal::ObjectMetadataParser::FromJson(kv.value());
-    if (!parsed.ok()) {
-      return std::move(parsed).status();
-    }
-    result.items.emplace_back(std::move(*parsed));
-  }
-
-  for (auto const& prefix_iterator : json["prefixes"].items()) {
-    auto const& prefix = prefix_iterator.value();
-    if (!prefix.is_string()) {
-      return google::cloud::internal::InternalError(
-          "List Objects Response's 'prefix' is not a string.",
-          GCP_ERROR_INFO());
-    }
-    result.prefixes.emplace_back(prefix.get<std::string>());
-  }
-
-  return result;
+  return ObjectMetadataSaxParser::ListFromString(payload);
 }
 
 StatusOr<ListObjectsResponse> ListObjectsResponse::FromHttpResponse(
@@ -187,6 +164,7 @@ void InsertObjectMediaRequest::reset_hash_function() {
 
 void InsertObjectMediaRequest::set_payload(absl::string_view payload) {
   payload_ = payload;
+  payload_owner_.reset();
   dirty_ = true;
 }
 
@@ -200,6 +178,7 @@ std::string const& InsertObjectMediaRequest::contents() const {
 void InsertObjectMediaRequest::set_contents(std::string v) {
   contents_ = std::move(v);
   payload_ = contents_;
+  payload_owner_.reset();
   dirty_ = false;
 }
 
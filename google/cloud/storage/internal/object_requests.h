@@ -128,6 +128,20 @@ class InsertObjectMediaRequest
   absl::string_view payload() const { return payload_; }
   void set_payload(absl::string_view payload);
 
+  /**
+   * The owner of the memory referenced by `payload()`, if any.
+   *
+   * Transports that can hold references to the payload, instead of copying
+   * it, keep this object alive while they need the data. `set_payload()`
+   * resets this value, set it after the payload.
+   */
+  std::shared_ptr<void const> const& payload_owner() const {
+    return payload_owner_;
+  }
+  void set_payload_owner(std::shared_ptr<void const> owner) {
+    payload_owner_ = std::move(owner);
+  }
+
   template <typename... O>
   InsertObjectMediaRequest& set_multiple_options(O&&... o) {
     InsertObjectRequestImpl<InsertObjectMediaRequest>::set_multiple_options(
@@ -156,6 +170,7 @@ class InsertObjectMediaRequest
   void reset_hash_function();
 
   absl::string_view payload_;
+  std::shared_ptr<void const> payload_owner_;
   std::shared_ptr<HashFunction> hash_function_;
   mutable std::string contents_;
   mutable bool dirty_ = true;
@@ -526,6 +541,14 @@ class UploadChunkRequest
   absl::optional<std::uint64_t> upload_size() const { return upload_size_; }
   ConstBufferSequence const& payload() const { return payload_; }
 
+  /// The owner of the memory referenced by `payload()`, if any.
+  std::shared_ptr<void const> const& payload_owner() const {
+    return payload_owner_;
+  }
+  void set_payload_owner(std::shared_ptr<void const> owner) {
+    payload_owner_ = std::move(owner);
+  }
+
   [[deprecated("use known_hashes() and hash_function()")]] HashValues const&
   full_object_hashes() const {
     return known_object_hashes_;
@@ -568,6 +591,7 @@ class UploadChunkRequest
   std::uint64_t offset_ = 0;
   absl::optional<std::uint64_t> upload_size_;
   ConstBufferSequence payload_;
+  std::shared_ptr<void const> payload_owner_;
   std::shared_ptr<HashFunction> hash_function_;
   HashValues known_object_hashes_;
 };
@@ -0,0 +1,574 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/storage/internal/read_cache_connection.h"
+#include "google/cloud/storage/internal/http_response.h"
+#include "google/cloud/storage/internal/object_read_source.h"
+#include "google/cloud/storage/well_known_parameters.h"
+#include "google/cloud/internal/make_status.h"
+#include "google/cloud/options.h"
+#include "absl/types/optional.h"
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+namespace google {
+namespace cloud {
+namespace storage_internal {
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_BEGIN
+namespace {
+
+using ::google::cloud::storage::internal::HttpResponse;
+using ::google::cloud::storage::internal::HttpStatusCode;
+using ::google::cloud::storage::internal::ObjectReadSource;
+using ::google::cloud::storage::internal::ReadObjectRangeRequest;
+using ::google::cloud::storage::internal::ReadSourceResult;
+
+auto constexpr kReadCacheMetadataKey = "gcloud-cpp.storage.read_cache";
+
+bool IsCacheable(ReadObjectRangeRequest const& request) {
+  if (!request.HasOption<storage::Generation>() ||
+      request.HasOption<storage::ReadLast>() ||
+      request.HasOption<storage::EncryptionKey>() ||
+      request.HasOption<storage::IfGenerationMatch>() ||
+      request.HasOption<storage::IfGenerationNotMatch>() ||
+      request.HasOption<storage::IfMetagenerationMatch>() ||
+      request.HasOption<storage::IfMetagenerationNotMatch>()) {
+    return false;
+  }
+  // Let the service report any errors for empty or inverted ranges.
+  return !request.HasOption<storage::ReadRange>() ||
+         request.GetOption<storage::ReadRange>().value().end >
+             request.StartingByte();
+}
+
+// Decompressive transcoding returns the full, uncompressed object for any
+// range, the blocks of these objects cannot be cached.
+Status TranscodedError() {
+  return google::cloud::internal::FailedPreconditionError(
+      "cannot cache objects served with decompressive transcoding",
+      GCP_ERROR_INFO().WithMetadata(kReadCacheMetadataKey, "transcoded"));
+}
+
+bool IsTranscodedError(Status const& status) {
+  auto const& metadata = status.error_info().metadata();
+  auto const l = metadata.find(kReadCacheMetadataKey);
+  return l != metadata.end() && l->second == "transcoded";
+}
+
+StatusOr<ObjectReadCacheBlock> FetchBlock(
+    storage::internal::StorageConnection& impl, ReadObjectRangeRequest request,
+    std::int64_t offset, std::int64_t length) {
+  request.set_option(storage::ReadFromOffset());
+  request.set_option(storage::ReadRange(offset, offset + length));
+  auto source = impl.ReadObject(request);
+  if (!source) return std::move(source).status();
+
+  ObjectReadCacheBlock block;
+  block.data.resize(static_cast<std::size_t>(length));
+  std::size_t size = 0;
+  while (size < block.data.size() && (*source)->IsOpen()) {
+    auto read = (*source)->Read(&block.data[size], block.data.size() - size);
+    if (!read) return std::move(read).status();
+    if (read->transformation) return TranscodedError();
+    if (read->response.status_code >= HttpStatusCode::kMinNotSuccess) {
+      return storage::internal::AsStatus(read->response);
+    }
+    if (!block.object_size) block.object_size = read->size;
+    block.hashes =
+        storage::internal::Merge(std::move(block.hashes), read->hashes);
+    if (read->bytes_received == 0) break;
+    size += read->bytes_received;
+  }
+  if ((*source)->IsOpen()) (void)(*source)->Close();
+  block.data.resize(size);
+  return block;
+}
+
+/**
+ * Serves a download from the blocks in an `ObjectReadCache`.
+ *
+ * Blocks are loaded one at a time, as the application reads past the end of
+ * the current block.
+ */
+class CachedObjectReadSource : public ObjectReadSource {
+ public:
+  CachedObjectReadSource(std::shared_ptr<ObjectReadCache> cache,
+                         ObjectReadCache::Fetcher fetcher,
+                         ReadObjectRangeRequest const& request)
+      : cache_(std::move(cache)),
+        fetcher_(std::move(fetcher)),
+        options_(google::cloud::internal::SaveCurrentOptions()),
+        bucket_(request.bucket_name()),
+        object_(request.object_name()),
+        generation_(request.GetOption<storage::Generation>().value()),
+        offset_(request.StartingByte()),
+        report_hashes_(!request.RequiresRangeHeader()) {
+    if (request.HasOption<storage::ReadRange>()) {
+      end_ = request.GetOption<storage::ReadRange>().value().end;
+    }
+  }
+
+  /// Loads the first block, so errors are reported when the download starts.
+  Status Open() {
+    auto status = Load(offset_ / cache_->block_size());
+    if (!status.ok()) return status;
+    if (offset_ > 0 && Position() >= block_->data.size()) {
+      return google::cloud::internal::OutOfRangeError(
+          "the read offset is past the end of the object", GCP_ERROR_INFO());
+    }
+    return Status{};
+  }
+
+  bool IsOpen() const override { return is_open_; }
+
+  StatusOr<HttpResponse> Close() override {
+    is_open_ = false;
+    return HttpResponse{HttpStatusCode::kOk, {}, {}};
+  }
+
+  StatusOr<ReadSourceResult> Read(char* buf, std::size_t n) override {
+    if (!is_open_) {
+      return google::cloud::internal::FailedPreconditionError(
+          "Connection not open.", GCP_ERROR_INFO());
+    }
+    auto const block_size = cache_->block_size();
+    auto status = Load(offset_ / block_size);
+    if (!status.ok()) return status;
+
+    auto const& data = block_->data;
+    auto const pos = Position();
+    auto count = pos < data.size() ? data.size() - pos : 0;
+    if (end_) {
+      count = (std::min)(count, static_cast<std::size_t>(*end_ - offset_));
+    }
+    count = (std::min)(count, n);
+    if (count != 0) std::memcpy(buf, data.data() + pos, count);
+    offset_ += static_cast<std::int64_t>(count);
+
+    auto const done =
+        (end_ && offset_ >= *end_) ||
+        (data.size() < static_cast<std::size_t>(block_size) &&
+         Position() >= data.size()) ||
+        (block_->object_size &&
+         static_cast<std::uint64_t>(offset_) >= *block_->object_size);
+    is_open_ = !done;
+
+    auto const code = done ? HttpStatusCode::kOk : HttpStatusCode::kContinue;
+    ReadSourceResult result(count, HttpResponse{code, {}, {}});
+    if (first_read_) {
+      first_read_ = false;
+      result.generation = generation_;
+      result.size = block_->object_size;
+      if (report_hashes_) result.hashes = block_->hashes;
+    }
+    return result;
+  }
+
+ private:
+  std::size_t Position() const {
+    return static_cast<std::size_t>(offset_ -
+                                    block_index_ * cache_->block_size());
+  }
+
+  Status Load(std::int64_t index) {
+    if (block_ && index == block_index_) return Status{};
+    google::cloud::internal::OptionsSpan span(options_);
+    auto block =
+        cache_->Read(bucket_, object_, generation_, index, fetcher_).get();
+    if (!block) return std::move(block).status();
+    block_ = *std::move(block);
+    block_index_ = index;
+    return Status{};
+  }
+
+  std::shared_ptr<ObjectReadCache> cache_;
+  ObjectReadCache::Fetcher fetcher_;
+  google::cloud::internal::ImmutableOptions options_;
+  std::string bucket_;
+  std::string object_;
+  std::int64_t generation_;
+  std::int64_t offset_;
+  absl::optional<std::int64_t> end_;
+  bool report_hashes_;
+  bool is_open_ = true;
+  bool first_read_ = true;
+  ObjectReadCache::BlockPtr block_;
+  std::int64_t block_index_ = 0;
+};
+
+}  // namespace
+
+ReadCacheConnection::ReadCacheConnection(
+    std::shared_ptr<StorageConnection> impl,
+    std::shared_ptr<ObjectReadCache> cache)
+    : impl_(std::move(impl)), cache_(std::move(cache)) {}
+
+storage::ClientOptions const& ReadCacheConnection::client_options() const {
+  return impl_->client_options();
+}
+
+Options ReadCacheConnection::options() const { return impl_->options(); }
+
+StatusOr<std::unique_ptr<storage::internal::ObjectReadSource>>
+ReadCacheConnection::ReadObject(
+    storage::internal::ReadObjectRangeRequest const& request) {
+  if (!IsCacheable(request)) return impl_->ReadObject(request);
+  auto fetcher = [impl = impl_, request](std::int64_t offset,
+                                         std::int64_t length) {
+    auto block = FetchBlock(*impl, request, offset, length);
+    // The service rejects ranges that start past the end of the object.
+    if (block.status().code() == StatusCode::kOutOfRange) {
+      block = ObjectReadCacheBlock{};
+    }
+    return make_ready_future(std::move(block));
+  };
+  auto source = std::make_unique<CachedObjectReadSource>(
+      cache_, std::move(fetcher), request);
+  auto status = source->Open();
+  if (IsTranscodedError(status)) return impl_->ReadObject(request);
+  if (!status.ok()) return status;
+  return std::unique_ptr<storage::internal::ObjectReadSource>(
+      std::move(source));
+}
+
+StatusOr<storage::internal::ListBucketsResponse>
+ReadCacheConnection::ListBuckets(
+    storage::internal::ListBucketsRequest const& request) {
+  return impl_->ListBuckets(request);
+}
+
+StatusOr<storage::BucketMetadata> ReadCacheConnection::CreateBucket(
+    storage::internal::CreateBucketRequest const& request) {
+  return impl_->CreateBucket(request);
+}
+
+StatusOr<storage::BucketMetadata> ReadCacheConnection::GetBucketMetadata(
+    storage::internal::GetBucketMetadataRequest const& request) {
+  return impl_->GetBucketMetadata(request);
+}
+
+StatusOr<storage::internal::EmptyResponse> ReadCacheConnection::DeleteBucket(
+    storage::internal::DeleteBucketRequest const& request) {
+  return impl_->DeleteBucket(request);
+}
+
+StatusOr<storage::BucketMetadata> ReadCacheConnection::UpdateBucket(
+    storage::internal::UpdateBucketRequest const& request) {
+  return impl_->UpdateBucket(request);
+}
+
+StatusOr<storage::BucketMetadata> ReadCacheConnection::PatchBucket(
+    storage::internal::PatchBucketRequest const& request) {
+  return impl_->PatchBucket(request);
+}
+
+StatusOr<storage::NativeIamPolicy>
+ReadCacheConnection::GetNativeBucketIamPolicy(
+    storage::internal::GetBucketIamPolicyRequest const& request) {
+  return impl_->GetNativeBucketIamPolicy(request);
+}
+
+StatusOr<storage::NativeIamPolicy>
+ReadCacheConnection::SetNativeBucketIamPolicy(
+    storage::internal::SetNativeBucketIamPolicyRequest const& request) {
+  return impl_->SetNativeBucketIamPolicy(request);
+}
+
+StatusOr<storage::internal::TestBucketIamPermissionsResponse>
+ReadCacheConnection::TestBucketIamPermissions(
+    storage::internal::TestBucketIamPermissionsRequest const& request) {
+  return impl_->TestBucketIamPermissions(request);
+}
+
+StatusOr<storage::BucketMetadata>
+ReadCacheConnection::LockBucketRetentionPolicy(
+    storage::internal::LockBucketRetentionPolicyRequest const& request) {
+  return impl_->LockBucketRetentionPolicy(request);
+}
+
+StatusOr<storage::ObjectMetadata> ReadCacheConnection::InsertObjectMedia(
+    storage::internal::InsertObjectMediaRequest const& request) {
+  return impl_->InsertObjectMedia(request);
+}
+
+StatusOr<storage::ObjectMetadata> ReadCacheConnection::CopyObject(
+    storage::internal::CopyObjectRequest const& request) {
+  return impl_->CopyObject(request);
+}
+
+StatusOr<storage::ObjectMetadata> ReadCacheConnection::GetObjectMetadata(
+    storage::internal::GetObjectMetadataRequest const& request) {
+  return impl_->GetObjectMetadata(request);
+}
+
+StatusOr<storage::internal::ListObjectsResponse>
+ReadCacheConnection::ListObjects(
+    storage::internal::ListObjectsRequest const& request) {
+  return impl_->ListObjects(request);
+}
+
+StatusOr<storage::internal::EmptyResponse> ReadCacheConnection::DeleteObject(
+    storage::internal::DeleteObjectRequest const& request) {
+  return impl_->DeleteObject(request);
+}
+
+StatusOr<storage::ObjectMetadata> ReadCacheConnection::UpdateObject(
+    storage::internal::UpdateObjectRequest const& request) {
+  return impl_->UpdateObject(request);
+}
+
+StatusOr<storage::ObjectMetadata> ReadCacheConnection::MoveObject(
+    storage::internal::MoveObjectRequest const& request) {
+  return impl_->MoveObject(request);
+}
+
+StatusOr<storage::ObjectMetadata> ReadCacheConnection::PatchObject(
+    storage::internal::PatchObjectRequest const& request) {
+  return impl_->PatchObject(request);
+}
+
+StatusOr<storage::ObjectMetadata> ReadCacheConnection::ComposeObject(
+    storage::internal::ComposeObjectRequest const& request) {
+  return impl_->ComposeObject(request);
+}
+
+StatusOr<storage::internal::RewriteObjectResponse>
+ReadCacheConnection::RewriteObject(
+    storage::internal::RewriteObjectRequest const& request) {
+  return impl_->RewriteObject(request);
+}
+
+StatusOr<storage::ObjectMetadata> ReadCacheConnection::RestoreObject(
+    storage::internal::RestoreObjectRequest const& request) {
+  return impl_->RestoreObject(request);
+}
+
+StatusOr<storage::internal::CreateResumableUploadResponse>
+ReadCacheConnection::CreateResumableUpload(
+    storage::internal::ResumableUploadRequest const& request) {
+  return impl_->CreateResumableUpload(request);
+}
+
+StatusOr<storage::internal::QueryResumableUploadResponse>
+ReadCacheConnection::QueryResumableUpload(
+    storage::internal::QueryResumableUploadRequest const& request) {
+  return impl_->QueryResumableUpload(request);
+}
+
+StatusOr<storage::internal::EmptyResponse>
+ReadCacheConnection::DeleteResumableUpload(
+    storage::internal::DeleteResumableUploadRequest const& request) {
+  return impl_->DeleteResumableUpload(request);
+}
+
+StatusOr<storage::internal::QueryResumableUploadResponse>
+ReadCacheConnection::UploadChunk(
+    storage::internal::UploadChunkRequest const& request) {
+  return impl_->UploadChunk(request);
+}
+
+StatusOr<std::unique_ptr<std::string>> ReadCacheConnection::UploadFileSimple(
+    std::string const& file_name, std::size_t file_size,
+    storage::internal::InsertObjectMediaRequest& request) {
+  return impl_->UploadFileSimple(file_name, file_size, request);
+}
+
+StatusOr<std::unique_ptr<std::istream>>
+ReadCacheConnection::UploadFileResumable(
+    std::string const& file_name,
+    storage::internal::ResumableUploadRequest& request) {
+  return impl_->UploadFileResumable(file_name, request);
+}
+
+StatusOr<storage::internal::ListBucketAclResponse>
+ReadCacheConnection::ListBucketAcl(
+    storage::internal::ListBucketAclRequest const& request) {
+  return impl_->ListBucketAcl(request);
+}
+
+StatusOr<storage::BucketAccessControl> ReadCacheConnection::CreateBucketAcl(
+    storage::internal::CreateBucketAclRequest const& request) {
+  return impl_->CreateBucketAcl(request);
+}
+
+StatusOr<storage::internal::EmptyResponse> ReadCacheConnection::DeleteBucketAcl(
+    storage::internal::DeleteBucketAclRequest const& request) {
+  return impl_->DeleteBucketAcl(request);
+}
+
+StatusOr<storage::BucketAccessControl> ReadCacheConnection::GetBucketAcl(
+    storage::internal::GetBucketAclRequest const& request) {
+  return impl_->GetBucketAcl(request);
+}
+
+StatusOr<storage::BucketAccessControl> ReadCacheConnection::UpdateBucketAcl(
+    storage::internal::UpdateBucketAclRequest const& request) {
+  return impl_->UpdateBucketAcl(request);
+}
+
+StatusOr<storage::BucketAccessControl> ReadCacheConnection::PatchBucketAcl(
+    storage::internal::PatchBucketAclRequest const& request) {
+  return impl_->PatchBucketAcl(request);
+}
+
+StatusOr<storage::internal::ListObjectAclResponse>
+ReadCacheConnection::ListObjectAcl(
+    storage::internal::ListObjectAclRequest const& request) {
+  return impl_->ListObjectAcl(request);
+}
+
+StatusOr<storage::ObjectAccessControl> ReadCacheConnection::CreateObjectAcl(
+    storage::internal::CreateObjectAclRequest const& request) {
+  return impl_->CreateObjectAcl(request);
+}
+
+StatusOr<storage::internal::EmptyResponse> ReadCacheConnection::DeleteObjectAcl(
+    storage::internal::DeleteObjectAclRequest const& request) {
+  return impl_->DeleteObjectAcl(request);
+}
+
+StatusOr<storage::ObjectAccessControl> ReadCacheConnection::GetObjectAcl(
+    storage::internal::GetObjectAclRequest const& request) {
+  return impl_->GetObjectAcl(request);
+}
+
+StatusOr<storage::ObjectAccessControl> ReadCacheConnection::UpdateObjectAcl(
+    storage::internal::UpdateObjectAclRequest const& request) {
+  return impl_->UpdateObjectAcl(request);
+}
+
+StatusOr<storage::ObjectAccessControl> ReadCacheConnection::PatchObjectAcl(
+    storage::internal::PatchObjectAclRequest const& request) {
+  return impl_->PatchObjectAcl(request);
+}
+
+StatusOr<storage::internal::ListDefaultObjectAclResponse>
+ReadCacheConnection::ListDefaultObjectAcl(
+    storage::internal::ListDefaultObjectAclRequest const& request) {
+  return impl_->ListDefaultObjectAcl(request);
+}
+
+StatusOr<storage::ObjectAccessControl>
+ReadCacheConnection::CreateDefaultObjectAcl(
+    storage::internal::CreateDefaultObjectAclRequest const& request) {
+  return impl_->CreateDefaultObjectAcl(request);
+}
+
+StatusOr<storage::internal::EmptyResponse>
+ReadCacheConnection::DeleteDefaultObjectAcl(
+    storage::internal::DeleteDefaultObjectAclRequest const& request) {
+  return impl_->DeleteDefaultObjectAcl(request);
+}
+
+StatusOr<storage::ObjectAccessControl> ReadCacheConnection::GetDefaultObjectAcl(
+    storage::internal::GetDefaultObjectAclRequest const& request) {
+  return impl_->GetDefaultObjectAcl(request);
+}
+
+StatusOr<storage::ObjectAccessControl>
+ReadCacheConnection::UpdateDefaultObjectAcl(
+    storage::internal::UpdateDefaultObjectAclRequest const& request) {
+  return impl_->UpdateDefaultObjectAcl(request);
+}
+
+StatusOr<storage::ObjectAccessControl>
+ReadCacheConnection::PatchDefaultObjectAcl(
+    storage::internal::PatchDefaultObjectAclRequest const& request) {
+  return impl_->PatchDefaultObjectAcl(request);
+}
+
+StatusOr<storage::ServiceAccount> ReadCacheConnection::GetServiceAccount(
+    storage::internal::GetProjectServiceAccountRequest const& request) {
+  return impl_->GetServiceAccount(request);
+}
+
+StatusOr<storage::internal::ListHmacKeysResponse>
+ReadCacheConnection::ListHmacKeys(
+    storage::internal::ListHmacKeysRequest const& request) {
+  return impl_->ListHmacKeys(request);
+}
+
+StatusOr<storage::internal::CreateHmacKeyResponse>
+ReadCacheConnection::CreateHmacKey(
+    storage::internal::CreateHmacKeyRequest const& request) {
+  return impl_->CreateHmacKey(request);
+}
+
+StatusOr<storage::internal::EmptyResponse> ReadCacheConnection::DeleteHmacKey(
+    storage::internal::DeleteHmacKeyRequest const& request) {
+  return impl_->DeleteHmacKey(request);
+}
+
+StatusOr<storage::HmacKeyMetadata> ReadCacheConnection::GetHmacKey(
+    storage::internal::GetHmacKeyRequest const& request) {
+  return impl_->GetHmacKey(request);
+}
+
+StatusOr<storage::HmacKeyMetadata> ReadCacheConnection::UpdateHmacKey(
+    storage::internal::UpdateHmacKeyRequest const& request) {
+  return impl_->UpdateHmacKey(request);
+}
+
+StatusOr<storage::internal::SignBlobResponse> ReadCacheConnection::SignBlob(
+    storage::internal::SignBlobRequest const& request) {
+  return impl_->SignBlob(request);
+}
+
+StatusOr<storage::internal::ListNotificationsResponse>
+ReadCacheConnection::ListNotifications(
+    storage::internal::ListNotificationsRequest const& request) {
+  return impl_->ListNotifications(request);
+}
+
+StatusOr<storage::NotificationMetadata> ReadCacheConnection::CreateNotification(
+    storage::internal::CreateNotificationRequest const& request) {
+  return impl_->CreateNotification(request);
+}
+
+StatusOr<storage::NotificationMetadata> ReadCacheConnection::GetNotification(
+    storage::internal::GetNotificationRequest const& request) {
+  return impl_->GetNotification(request);
+}
+
+StatusOr<storage::internal::EmptyResponse>
+ReadCacheConnection::DeleteNotification(
+    storage::internal::DeleteNotificationRequest const& request) {
+  return impl_->DeleteNotification(request);
+}
+
+StatusOr<storage::internal::BatchResponse> ReadCacheConnection::ExecuteBatch(
+    storage::internal::BatchRequest const& request) {
+  return impl_->ExecuteBatch(request);
+}
+
+std::vector<std::string> ReadCacheConnection::InspectStackStructure() const {
+  auto stack = impl_->InspectStackStructure();
+  stack.emplace_back("ReadCacheConnection");
+  return stack;
+}
+
+std::shared_ptr<storage::internal::StorageConnection> MakeReadCacheConnection(
+    Options const& options,
+    std::shared_ptr<storage::internal::StorageConnection> impl) {
+  auto cache = MakeObjectReadCache(options);
+  if (!cache) return impl;
+  return std::make_shared<ReadCacheConnection>(std::move(impl),
+                                               std::move(cache));
+}
+
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
+}  // namespace storage_internal
+}  // namespace cloud
+}  // namespace google
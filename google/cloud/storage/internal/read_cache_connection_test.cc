@@ -0,0 +1,279 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/storage/internal/read_cache_connection.h"
+#include "google/cloud/storage/options.h"
+#include "google/cloud/storage/testing/canonical_errors.h"
+#include "google/cloud/storage/testing/mock_client.h"
+#include "google/cloud/internal/make_status.h"
+#include "google/cloud/testing_util/status_matchers.h"
+#include <gmock/gmock.h>
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace google {
+namespace cloud {
+namespace storage_internal {
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_BEGIN
+namespace {
+
+using ::google::cloud::storage::internal::HttpResponse;
+using ::google::cloud::storage::internal::ObjectReadSource;
+using ::google::cloud::storage::internal::ReadObjectRangeRequest;
+using ::google::cloud::storage::internal::ReadSourceResult;
+using ::google::cloud::storage::testing::MockClient;
+using ::google::cloud::storage::testing::canonical_errors::PermanentError;
+using ::google::cloud::testing_util::IsOkAndHolds;
+using ::google::cloud::testing_util::StatusIs;
+using ::testing::ElementsAre;
+using ::testing::Optional;
+using ::testing::Pair;
+
+auto constexpr kBlockSize = 8;
+
+std::string const& Contents() {
+  static auto const* const kContents =
+      new std::string("0123456789abcdefghij");
+  return *kContents;
+}
+
+// Serves a range of `Contents()`, a few bytes at a time.
+class FakeReadSource : public ObjectReadSource {
+ public:
+  FakeReadSource(std::string data, absl::optional<std::string> transformation)
+      : data_(std::move(data)), transformation_(std::move(transformation)) {}
+
+  bool IsOpen() const override { return is_open_; }
+  StatusOr<HttpResponse> Close() override {
+    is_open_ = false;
+    return HttpResponse{storage::internal::HttpStatusCode::kOk, {}, {}};
+  }
+  StatusOr<ReadSourceResult> Read(char* buf, std::size_t n) override {
+    auto const count = (std::min)({n, data_.size() - offset_, std::size_t{3}});
+    std::memcpy(buf, data_.data() + offset_, count);
+    offset_ += count;
+    is_open_ = offset_ < data_.size();
+    auto const code = is_open_ ? storage::internal::HttpStatusCode::kContinue
+                               : storage::internal::HttpStatusCode::kOk;
+    ReadSourceResult result(count, HttpResponse{code, {}, {}});
+    result.generation = 1234;
+    result.size = Contents().size();
+    result.hashes.crc32c = "test-crc32c";
+    result.transformation = transformation_;
+    return result;
+  }
+
+ private:
+  std::string data_;
+  absl::optional<std::string> transformation_;
+  std::size_t offset_ = 0;
+  bool is_open_ = true;
+};
+
+using Ranges = std::vector<std::pair<std::int64_t, std::int64_t>>;
+
+// Configures @p mock to serve `Contents()` and record the requested ranges.
+void ServeContents(MockClient& mock, Ranges& ranges,
+                   absl::optional<std::string> transformation = {}) {
+  EXPECT_CALL(mock, ReadObject)
+      .WillRepeatedly([&ranges, transformation](
+                          ReadObjectRangeRequest const& request)
+                          -> StatusOr<std::unique_ptr<ObjectReadSource>> {
+        auto const size = static_cast<std::int64_t>(Contents().size());
+        auto begin = request.StartingByte();
+        auto end = size;
+        if (request.HasOption<storage::ReadRange>()) {
+          auto const range = request.GetOption<storage::ReadRange>().value();
+          ranges.emplace_back(range.begin, range.end);
+          end = (std::min)(end, range.end);
+        }
+        if (begin >= size) {
+          return google::cloud::internal::OutOfRangeError("past the end",
+                                                          GCP_ERROR_INFO());
+        }
+        if (transformation) begin = 0, end = size;
+        return std::unique_ptr<ObjectReadSource>(
+            std::make_unique<FakeReadSource>(
+                Contents().substr(static_cast<std::size_t>(begin),
+                                  static_cast<std::size_t>(end - begin)),
+                transformation));
+      });
+}
+
+std::shared_ptr<ReadCacheConnection> MakeTestConnection(
+    std::shared_ptr<MockClient> mock) {
+  return std::make_shared<ReadCacheConnection>(
+      std::move(mock), std::make_shared<ObjectReadCache>(::testing::TempDir(),
+                                                         1024, kBlockSize));
+}
+
+StatusOr<std::string> ReadAll(ObjectReadSource& source,
+                              ReadSourceResult* first = nullptr) {
+  std::string contents;
+  char buffer[5];
+  while (source.IsOpen()) {
+    auto r = source.Read(buffer, sizeof(buffer));
+    if (!r) return std::move(r).status();
+    if (first != nullptr && contents.empty()) *first = *r;
+    contents.append(buffer, r->bytes_received);
+  }
+  return contents;
+}
+
+StatusOr<std::string> ReadObject(ReadCacheConnection& connection,
+                                 ReadObjectRangeRequest const& request,
+                                 ReadSourceResult* first = nullptr) {
+  auto source = connection.ReadObject(request);
+  if (!source) return std::move(source).status();
+  return ReadAll(**source, first);
+}
+
+ReadObjectRangeRequest MakeRequest() {
+  return ReadObjectRangeRequest("test-bucket", "test-object")
+      .set_multiple_options(storage::Generation(1234));
+}
+
+TEST(ReadCacheConnection, FullRead) {
+  auto mock = std::make_shared<MockClient>();
+  Ranges ranges;
+  ServeContents(*mock, ranges);
+  auto connection = MakeTestConnection(mock);
+
+  ReadSourceResult first;
+  auto contents = ReadObject(*connection, MakeRequest(), &first);
+  EXPECT_THAT(contents, IsOkAndHolds(Contents()));
+  EXPECT_THAT(ranges, ElementsAre(Pair(0, 8), Pair(8, 16), Pair(16, 24)));
+  EXPECT_THAT(first.generation, Optional(1234));
+  EXPECT_THAT(first.size, Optional(Contents().size()));
+  EXPECT_EQ(first.hashes.crc32c, "test-crc32c");
+
+  ranges.clear();
+  contents = ReadObject(*connection, MakeRequest());
+  EXPECT_THAT(contents, IsOkAndHolds(Contents()));
+  EXPECT_THAT(ranges, ElementsAre());
+}
+
+TEST(ReadCacheConnection, PartialHitFetchesMissingBlocks) {
+  auto mock = std::make_shared<MockClient>();
+  Ranges ranges;
+  ServeContents(*mock, ranges);
+  auto connection = MakeTestConnection(mock);
+
+  ReadSourceResult first;
+  auto contents = ReadObject(
+      *connection,
+      MakeRequest().set_multiple_options(storage::ReadRange(2, 10)), &first);
+  EXPECT_THAT(contents, IsOkAndHolds(Contents().substr(2, 8)));
+  EXPECT_THAT(ranges, ElementsAre(Pair(0, 8), Pair(8, 16)));
+  // The full object hashes do not apply to a range.
+  EXPECT_TRUE(first.hashes.crc32c.empty());
+
+  ranges.clear();
+  contents = ReadObject(
+      *connection,
+      MakeRequest().set_multiple_options(storage::ReadFromOffset(6)));
+  EXPECT_THAT(contents, IsOkAndHolds(Contents().substr(6)));
+  EXPECT_THAT(ranges, ElementsAre(Pair(16, 24)));
+}
+
+TEST(ReadCacheConnection, OffsetPastEnd) {
+  auto mock = std::make_shared<MockClient>();
+  Ranges ranges;
+  ServeContents(*mock, ranges);
+  auto connection = MakeTestConnection(mock);
+
+  auto source = connection->ReadObject(
+      MakeRequest().set_multiple_options(storage::ReadFromOffset(40)));
+  EXPECT_THAT(source, StatusIs(StatusCode::kOutOfRange));
+
+  source = connection->ReadObject(
+      MakeRequest().set_multiple_options(storage::ReadFromOffset(20)));
+  EXPECT_THAT(source, StatusIs(StatusCode::kOutOfRange));
+}
+
+TEST(ReadCacheConnection, BypassWithoutGeneration) {
+  auto mock = std::make_shared<MockClient>();
+  EXPECT_CALL(*mock, ReadObject)
+      .WillOnce([](ReadObjectRangeRequest const& request) {
+        EXPECT_FALSE(request.HasOption<storage::ReadRange>());
+        return PermanentError();
+      });
+  auto connection = MakeTestConnection(mock);
+
+  auto source = connection->ReadObject(
+      ReadObjectRangeRequest("test-bucket", "test-object"));
+  EXPECT_THAT(source, StatusIs(PermanentError().code()));
+}
+
+TEST(ReadCacheConnection, BypassWithPreconditions) {
+  auto mock = std::make_shared<MockClient>();
+  EXPECT_CALL(*mock, ReadObject)
+      .WillOnce([](ReadObjectRangeRequest const& request) {
+        EXPECT_FALSE(request.HasOption<storage::ReadRange>());
+        return PermanentError();
+      });
+  auto connection = MakeTestConnection(mock);
+
+  auto source = connection->ReadObject(MakeRequest().set_multiple_options(
+      storage::IfMetagenerationMatch(7)));
+  EXPECT_THAT(source, StatusIs(PermanentError().code()));
+}
+
+TEST(ReadCacheConnection, TranscodedObjectsBypassCache) {
+  auto mock = std::make_shared<MockClient>();
+  Ranges ranges;
+  ServeContents(*mock, ranges, "gunzipped");
+  auto connection = MakeTestConnection(mock);
+
+  auto contents = ReadObject(*connection, MakeRequest());
+  EXPECT_THAT(contents, IsOkAndHolds(Contents()));
+  // One attempt to fill the cache, then an uncached read.
+  EXPECT_THAT(ranges, ElementsAre(Pair(0, 8)));
+}
+
+TEST(ReadCacheConnection, ErrorsAreReported) {
+  auto mock = std::make_shared<MockClient>();
+  EXPECT_CALL(*mock, ReadObject).Times(2).WillRepeatedly([] {
+    return PermanentError();
+  });
+  auto connection = MakeTestConnection(mock);
+
+  for (int i = 0; i != 2; ++i) {
+    auto source = connection->ReadObject(MakeRequest());
+    EXPECT_THAT(source, StatusIs(PermanentError().code()));
+  }
+}
+
+TEST(ReadCacheConnection, MakeReadCacheConnection) {
+  auto mock = std::make_shared<MockClient>();
+  EXPECT_EQ(MakeReadCacheConnection(Options{}, mock), mock);
+
+  auto connection = MakeReadCacheConnection(
+      Options{}.set<storage_experimental::ReadCacheDirectoryOption>(
+          ::testing::TempDir()),
+      mock);
+  EXPECT_NE(connection, mock);
+  EXPECT_THAT(connection->InspectStackStructure(),
+              ::testing::Contains("ReadCacheConnection"));
+}
+
+}  // namespace
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
+}  // namespace storage_internal
+}  // namespace cloud
+}  // namespace google
@@ -0,0 +1,206 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/storage/internal/rest/batch_multipart.h"
+#include "google/cloud/internal/absl_str_cat_quiet.h"
+#include "google/cloud/internal/make_status.h"
+#include "google/cloud/internal/url_encode.h"
+#include "absl/strings/ascii.h"
+#include "absl/strings/match.h"
+#include "absl/strings/numbers.h"
+#include "absl/strings/str_split.h"
+#include "absl/strings/strip.h"
+#include "absl/types/optional.h"
+#include <map>
+#include <utility>
+
+namespace google {
+namespace cloud {
+namespace storage {
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_BEGIN
+namespace internal {
+namespace {
+
+using ::google::cloud::internal::InternalError;
+using ::google::cloud::internal::UrlEncode;
+
+auto constexpr kCrLf = "\r\n";
+
+Status MalformedResponse(absl::string_view what) {
+  return InternalError(absl::StrCat("malformed JSON batch response: ", what),
+                       GCP_ERROR_INFO());
+}
+
+// Splits a MIME part (or a HTTP message) into its headers and body. Services
+// should use CRLF line endings, but we tolerate plain LF.
+std::pair<absl::string_view, absl::string_view> SplitHeaders(
+    absl::string_view message) {
+  for (absl::string_view separator : {"\r\n\r\n", "\n\n"}) {
+    auto pos = message.find(separator);
+    if (pos == absl::string_view::npos) continue;
+    return {message.substr(0, pos), message.substr(pos + separator.size())};
+  }
+  return {message, absl::string_view{}};
+}
+
+absl::optional<absl::string_view> FindHeader(absl::string_view headers,
+                                             absl::string_view name) {
+  for (auto line : absl::StrSplit(headers, '\n')) {
+    line = absl::StripTrailingAsciiWhitespace(line);
+    std::pair<absl::string_view, absl::string_view> kv =
+        absl::StrSplit(line, absl::MaxSplits(':', 1));
+    if (!absl::EqualsIgnoreCase(absl::StripAsciiWhitespace(kv.first), name)) {
+      continue;
+    }
+    return absl::StripAsciiWhitespace(kv.second);
+  }
+  return absl::nullopt;
+}
+
+absl::optional<absl::string_view> ExtractBoundary(
+    absl::string_view content_type) {
+  for (auto param : absl::StrSplit(content_type, ';')) {
+    std::pair<absl::string_view, absl::string_view> kv =
+        absl::StrSplit(param, absl::MaxSplits('=', 1));
+    if (!absl::EqualsIgnoreCase(absl::StripAsciiWhitespace(kv.first),
+                                "boundary")) {
+      continue;
+    }
+    auto value = absl::StripAsciiWhitespace(kv.second);
+    if (absl::ConsumePrefix(&value, "\"")) absl::ConsumeSuffix(&value, "\"");
+    if (value.empty()) return absl::nullopt;
+    return value;
+  }
+  return absl::nullopt;
+}
+
+// The service returns `Content-ID: <response-${request-content-id}>`.
+absl::optional<std::size_t> ParseContentId(absl::string_view mime_headers) {
+  auto header = FindHeader(mime_headers, "content-id");
+  if (!header) return absl::nullopt;
+  auto value = *header;
+  absl::ConsumePrefix(&value, "<");
+  absl::ConsumeSuffix(&value, ">");
+  absl::ConsumePrefix(&value, "response-");
+  std::size_t id;
+  if (!absl::SimpleAtoi(value, &id)) return absl::nullopt;
+  return id;
+}
+
+StatusOr<BatchPartResponse> ParsePart(absl::string_view http_message) {
+  auto split = SplitHeaders(http_message);
+  auto status_line = split.first.substr(0, split.first.find('\n'));
+  std::vector<absl::string_view> tokens =
+      absl::StrSplit(status_line, ' ', absl::SkipEmpty());
+  std::int32_t code;
+  if (tokens.size() < 2 || !absl::StartsWith(tokens[0], "HTTP/") ||
+      !absl::SimpleAtoi(tokens[1], &code)) {
+    return MalformedResponse(
+        absl::StrCat("invalid status line <", status_line, ">"));
+  }
+  return BatchPartResponse{code, std::string(split.second)};
+}
+
+}  // namespace
+
+std::string FormatBatchPart(absl::string_view method,
+                            rest_internal::RestRequest const& request,
+                            absl::string_view body, std::size_t content_id) {
+  auto part = absl::StrCat("Content-Type: application/http", kCrLf,
+                           "Content-ID: <", content_id, ">", kCrLf, kCrLf,
+                           method, " ");
+  if (!absl::StartsWith(request.path(), "/")) part += "/";
+  part += request.path();
+  char const* sep = "?";
+  for (auto const& p : request.parameters()) {
+    absl::StrAppend(&part, sep, UrlEncode(p.first), "=", UrlEncode(p.second));
+    sep = "&";
+  }
+  absl::StrAppend(&part, " HTTP/1.1", kCrLf);
+  // Sort the headers to make the output predictable.
+  std::map<std::string, std::vector<std::string>> headers(
+      request.headers().begin(), request.headers().end());
+  for (auto const& h : headers) {
+    for (auto const& v : h.second) {
+      absl::StrAppend(&part, h.first, ": ", v, kCrLf);
+    }
+  }
+  absl::StrAppend(&part, kCrLf, body);
+  return part;
+}
+
+std::string JoinBatchParts(std::vector<std::string> const& parts,
+                           std::string const& boundary) {
+  std::string payload;
+  for (auto const& p : parts) {
+    absl::StrAppend(&payload, "--", boundary, kCrLf, p, kCrLf);
+  }
+  absl::StrAppend(&payload, "--", boundary, "--", kCrLf);
+  return payload;
+}
+
+StatusOr<std::vector<BatchPartResponse>> ParseBatchResponse(
+    absl::string_view content_type, absl::string_view payload,
+    std::size_t expected_count) {
+  auto boundary = ExtractBoundary(content_type);
+  if (!boundary) {
+    return MalformedResponse(
+        absl::StrCat("missing boundary in content-type <", content_type, ">"));
+  }
+  auto const marker = absl::StrCat("--", *boundary);
+
+  std::vector<absl::optional<BatchPartResponse>> parts(expected_count);
+  std::size_t position = 0;
+  auto start = payload.find(marker);
+  while (start != absl::string_view::npos) {
+    start += marker.size();
+    if (payload.substr(start, 2) == "--") break;
+    auto eol = payload.find('\n', start);
+    if (eol == absl::string_view::npos) break;
+    auto end = payload.find(marker, eol);
+    if (end == absl::string_view::npos) {
+      return MalformedResponse("missing closing boundary");
+    }
+    auto part = payload.substr(eol + 1, end - eol - 1);
+    if (!absl::ConsumeSuffix(&part, kCrLf)) absl::ConsumeSuffix(&part, "\n");
+    start = end;
+
+    auto split = SplitHeaders(part);
+    auto const id = ParseContentId(split.first).value_or(position);
+    ++position;
+    if (id >= parts.size() || parts[id].has_value()) {
+      return MalformedResponse(absl::StrCat("unexpected Content-ID ", id));
+    }
+    auto response = ParsePart(split.second);
+    if (!response) return std::move(response).status();
+    parts[id] = *std::move(response);
+  }
+
+  std::vector<BatchPartResponse> result;
+  result.reserve(parts.size());
+  for (auto& p : parts) {
+    if (!p) {
+      return MalformedResponse(absl::StrCat("expected ", expected_count,
+                                            " parts, got ", position));
+    }
+    result.push_back(*std::move(p));
+  }
+  return result;
+}
+
+}  // namespace internal
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
+}  // namespace storage
+}  // namespace cloud
+}  // namespace google
@@ -0,0 +1,83 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GOOGLE_CLOUD_CPP_GOOGLE_CLOUD_STORAGE_INTERNAL_REST_BATCH_MULTIPART_H
+#define GOOGLE_CLOUD_CPP_GOOGLE_CLOUD_STORAGE_INTERNAL_REST_BATCH_MULTIPART_H
+
+#include "google/cloud/storage/version.h"
+#include "google/cloud/internal/rest_request.h"
+#include "google/cloud/status_or.h"
+#include "absl/strings/string_view.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace google {
+namespace cloud {
+namespace storage {
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_BEGIN
+namespace internal {
+
+/**
+ * Formats one call in a JSON batch request as a `multipart/mixed` part.
+ *
+ * The result does not include the boundary markers. The caller must pick a
+ * boundary that does not appear in any of the parts, and then use
+ * `JoinBatchParts()` to create the full payload.
+ *
+ * @param method the HTTP verb for this call, e.g. `DELETE` or `PATCH`.
+ * @param request the path, query parameters, and headers for this call. Any
+ *     authorization headers should be set in the outer request.
+ * @param body the payload for this call, if any.
+ * @param content_id the identifier for this call, the response includes it in
+ *     its `Content-ID` header.
+ */
+std::string FormatBatchPart(absl::string_view method,
+                            rest_internal::RestRequest const& request,
+                            absl::string_view body, std::size_t content_id);
+
+/// Joins the output of multiple `FormatBatchPart()` calls into a payload.
+std::string JoinBatchParts(std::vector<std::string> const& parts,
+                           std::string const& boundary);
+
+/// The HTTP response for one call in a JSON batch response.
+struct BatchPartResponse {
+  std::int32_t status_code;
+  std::string payload;
+};
+
+/**
+ * Parses a `multipart/mixed` JSON batch response.
+ *
+ * The responses are returned in the order of their `Content-ID` (or of their
+ * position, if the service does not echo the `Content-ID` header). If the
+ * response does not contain exactly @p expected_count parts the function
+ * returns an error.
+ *
+ * @param content_type the value of the `Content-Type` header, it contains the
+ *     boundary used to separate the parts.
+ * @param payload the full payload of the batch response.
+ * @param expected_count the number of calls in the batch request.
+ */
+StatusOr<std::vector<BatchPartResponse>> ParseBatchResponse(
+    absl::string_view content_type, absl::string_view payload,
+    std::size_t expected_count);
+
+}  // namespace internal
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
+}  // namespace storage
+}  // namespace cloud
+}  // namespace google
+
+#endif  // GOOGLE_CLOUD_CPP_GOOGLE_CLOUD_STORAGE_INTERNAL_REST_BATCH_MULTIPART_H
@@ -0,0 +1,172 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/storage/internal/rest/batch_multipart.h"
+#include "google/cloud/testing_util/status_matchers.h"
+#include "absl/strings/str_replace.h"
+#include <gmock/gmock.h>
+
+namespace google {
+namespace cloud {
+namespace storage {
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_BEGIN
+namespace internal {
+namespace {
+
+using ::google::cloud::testing_util::StatusIs;
+using ::testing::ElementsAre;
+using ::testing::Field;
+using ::testing::HasSubstr;
+
+auto constexpr kContentType = "multipart/mixed; boundary=batch_abc123";
+
+// A response in the format used by the service. The parts are intentionally
+// out of order.
+auto constexpr kResponse =
+    "--batch_abc123\r\n"
+    "Content-Type: application/http\r\n"
+    "Content-ID: <response-1>\r\n"
+    "\r\n"
+    "HTTP/1.1 404 Not Found\r\n"
+    "Content-Type: application/json; charset=UTF-8\r\n"
+    "\r\n"
+    R"js({"error": {"code": 404, "message": "No such object"}})js"
+    "\r\n"
+    "--batch_abc123\r\n"
+    "Content-Type: application/http\r\n"
+    "Content-ID: <response-0>\r\n"
+    "\r\n"
+    "HTTP/1.1 204 No Content\r\n"
+    "Content-Length: 0\r\n"
+    "\r\n"
+    "\r\n"
+    "--batch_abc123--\r\n";
+
+auto MatchPart(std::int32_t code, std::string const& payload) {
+  return AllOf(Field(&BatchPartResponse::status_code, code),
+               Field(&BatchPartResponse::payload, payload));
+}
+
+TEST(BatchMultipartTest, FormatPart) {
+  rest_internal::RestRequest request(
+      "storage/v1/b/test-bucket/o/test-object");
+  request.AddQueryParameter("generation", "42");
+  request.AddQueryParameter("userProject", "my project");
+  request.AddHeader("x-goog-user-project", "my-project");
+  request.AddHeader("content-type", "application/json");
+  auto const actual =
+      FormatBatchPart("PATCH", request, R"js({"contentType":"text/plain"})js",
+                      7);
+  auto const expected = std::string(
+      "Content-Type: application/http\r\n"
+      "Content-ID: <7>\r\n"
+      "\r\n"
+      "PATCH /storage/v1/b/test-bucket/o/test-object"
+      "?generation=42&userProject=my%20project HTTP/1.1\r\n"
+      "content-type: application/json\r\n"
+      "x-goog-user-project: my-project\r\n"
+      "\r\n"
+      R"js({"contentType":"text/plain"})js");
+  EXPECT_EQ(actual, expected);
+}
+
+TEST(BatchMultipartTest, JoinParts) {
+  auto const actual = JoinBatchParts({"part-1", "part-2"}, "boundary");
+  EXPECT_EQ(actual,
+            "--boundary\r\npart-1\r\n"
+            "--boundary\r\npart-2\r\n"
+            "--boundary--\r\n");
+}
+
+TEST(BatchMultipartTest, ParseResponse) {
+  auto actual = ParseBatchResponse(kContentType, kResponse, 2);
+  ASSERT_STATUS_OK(actual);
+  EXPECT_THAT(
+      *actual,
+      ElementsAre(MatchPart(204, ""),
+                  MatchPart(404, R"js({"error": {"code": 404, )js"
+                                 R"js("message": "No such object"}})js")));
+}
+
+TEST(BatchMultipartTest, ParseResponseQuotedBoundary) {
+  auto actual = ParseBatchResponse(
+      R"(multipart/mixed; boundary="batch_abc123")", kResponse, 2);
+  ASSERT_STATUS_OK(actual);
+  EXPECT_THAT(*actual, ElementsAre(Field(&BatchPartResponse::status_code, 204),
+                                   Field(&BatchPartResponse::status_code, 404)));
+}
+
+TEST(BatchMultipartTest, ParseResponseLineFeedOnly) {
+  auto const payload = absl::StrReplaceAll(kResponse, {{"\r\n", "\n"}});
+  auto actual = ParseBatchResponse(kContentType, payload, 2);
+  ASSERT_STATUS_OK(actual);
+  EXPECT_THAT(*actual, ElementsAre(Field(&BatchPartResponse::status_code, 204),
+                                   Field(&BatchPartResponse::status_code, 404)));
+}
+
+TEST(BatchMultipartTest, ParseResponseWithoutContentId) {
+  auto const payload = std::string(
+      "--b\r\n"
+      "Content-Type: application/http\r\n"
+      "\r\n"
+      "HTTP/1.1 200 OK\r\n"
+      "\r\n"
+      "first\r\n"
+      "--b\r\n"
+      "Content-Type: application/http\r\n"
+      "\r\n"
+      "HTTP/1.1 200 OK\r\n"
+      "\r\n"
+      "second\r\n"
+      "--b--\r\n");
+  auto actual = ParseBatchResponse("multipart/mixed; boundary=b", payload, 2);
+  ASSERT_STATUS_OK(actual);
+  EXPECT_THAT(*actual,
+              ElementsAre(MatchPart(200, "first"), MatchPart(200, "second")));
+}
+
+TEST(BatchMultipartTest, ParseResponseMissingBoundary) {
+  auto actual = ParseBatchResponse("multipart/mixed", kResponse, 2);
+  EXPECT_THAT(actual, StatusIs(StatusCode::kInternal,
+                               HasSubstr("missing boundary")));
+}
+
+TEST(BatchMultipartTest, ParseResponseWrongCount) {
+  auto actual = ParseBatchResponse(kContentType, kResponse, 3);
+  EXPECT_THAT(actual,
+              StatusIs(StatusCode::kInternal, HasSubstr("expected 3 parts")));
+  actual = ParseBatchResponse(kContentType, kResponse, 1);
+  EXPECT_THAT(actual, StatusIs(StatusCode::kInternal,
+                               HasSubstr("unexpected Content-ID")));
+}
+
+TEST(BatchMultipartTest, ParseResponseBadStatusLine) {
+  auto const payload = std::string(
+      "--b\r\n"
+      "Content-Type: application/http\r\n"
+      "\r\n"
+      "garbage\r\n"
+      "\r\n"
+      "--b--\r\n");
+  auto actual = ParseBatchResponse("multipart/mixed; boundary=b", payload, 1);
+  EXPECT_THAT(actual, StatusIs(StatusCode::kInternal,
+                               HasSubstr("invalid status line")));
+}
+
+}  // namespace
+}  // namespace internal
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
+}  // namespace storage
+}  // namespace cloud
+}  // namespace google
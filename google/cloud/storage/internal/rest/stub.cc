@@ -21,7 +21,9 @@
 #include "google/cloud/storage/internal/notification_metadata_parser.h"
 #include "google/cloud/storage/internal/object_access_control_parser.h"
 #include "google/cloud/storage/internal/object_metadata_parser.h"
+#include "google/cloud/storage/internal/object_metadata_sax_parser.h"
 #include "google/cloud/storage/internal/object_read_streambuf.h"
+#include "google/cloud/storage/internal/rest/batch_multipart.h"
 #include "google/cloud/storage/internal/rest/object_read_source.h"
 #include "google/cloud/storage/internal/rest/request_builder.h"
 #include "google/cloud/storage/internal/service_account_parser.h"
@@ -33,6 +35,7 @@
 #include "google/cloud/internal/make_status.h"
 #include "google/cloud/internal/url_encode.h"
 #include "absl/strings/match.h"
+#include "absl/strings/str_join.h"
 #include "absl/strings/strip.h"
 #include <sstream>
 
@@ -132,6 +135,92 @@ Status AddHeaders(Options const& options, RestRequestBuilder& builder) {
   return {};
 }
 
+// Formats each call in a JSON batch request. The authorization and custom
+// headers are only included in the outer request.
+struct BatchPartFormatter {
+  std::string const& version;
+  std::size_t content_id;
+
+  std::string operator()(DeleteObjectRequest const& request) const {
+    RestRequestBuilder builder(ObjectPath(request));
+    request.AddOptionsToHttpRequest(builder);
+    return FormatBatchPart("DELETE", std::move(builder).BuildRequest(), {},
+                           content_id);
+  }
+
+  std::string operator()(PatchObjectRequest const& request) const {
+    RestRequestBuilder builder(ObjectPath(request));
+    request.AddOptionsToHttpRequest(builder);
+    builder.AddHeader("Content-Type", "application/json");
+    return FormatBatchPart("PATCH", std::move(builder).BuildRequest(),
+                           request.payload(), content_id);
+  }
+
+  std::string operator()(DeleteObjectAclRequest const& request) const {
+    RestRequestBuilder builder(ObjectAclPath(request));
+    request.AddOptionsToHttpRequest(builder);
+    return FormatBatchPart("DELETE", std::move(builder).BuildRequest(), {},
+                           content_id);
+  }
+
+  std::string operator()(UpdateObjectAclRequest const& request) const {
+    RestRequestBuilder builder(ObjectAclPath(request));
+    request.AddOptionsToHttpRequest(builder);
+    builder.AddHeader("Content-Type", "application/json");
+    nlohmann::json object;
+    object["entity"] = request.entity();
+    object["role"] = request.role();
+    return FormatBatchPart("PUT", std::move(builder).BuildRequest(),
+                           object.dump(), content_id);
+  }
+
+  template <typename Request>
+  std::string ObjectPath(Request const& request) const {
+    return absl::StrCat("storage/", version, "/b/",
+                        UrlEncode(request.bucket_name()), "/o/",
+                        UrlEncode(request.object_name()));
+  }
+
+  template <typename Request>
+  std::string ObjectAclPath(Request const& request) const {
+    return absl::StrCat(ObjectPath(request), "/acl/",
+                        UrlEncode(request.entity()));
+  }
+};
+
+// Converts the response for each call in a JSON batch request.
+struct BatchResultParser {
+  BatchPartResponse const& response;
+
+  BatchedResult operator()(DeleteObjectRequest const&) const {
+    return Parse(Empty);
+  }
+  BatchedResult operator()(DeleteObjectAclRequest const&) const {
+    return Parse(Empty);
+  }
+  BatchedResult operator()(PatchObjectRequest const&) const {
+    return Parse(ObjectMetadataParser::FromString);
+  }
+  BatchedResult operator()(UpdateObjectAclRequest const&) const {
+    return Parse(ObjectAccessControlParser::FromString);
+  }
+
+  template <typename Functor>
+  BatchedResult Parse(Functor&& f) const {
+    if (response.status_code >= rest::HttpStatusCode::kMinNotSuccess) {
+      return rest::AsStatus(rest::HttpStatusCode(response.status_code),
+                            response.payload);
+    }
+    auto result = f(response.payload);
+    if (!result) return std::move(result).status();
+    return BatchedResult::value_type(*std::move(result));
+  }
+
+  static StatusOr<absl::monostate> Empty(std::string const&) {
+    return absl::monostate{};
+  }
+};
+
 }  // namespace
 
 RestStub::RestStub(Options options)
@@ -542,8 +631,14 @@ StatusOr<ListObjectsResponse> RestStub::ListObjects(
   if (!headers.ok()) return headers;
   request.AddOptionsToHttpRequest(builder);
   builder.AddQueryParameter("pageToken", request.page_token());
-  return ParseFromRestResponse<ListObjectsResponse>(
-      storage_rest_client_->Get(context, std::move(builder).BuildRequest()));
+  auto response =
+      storage_rest_client_->Get(context, std::move(builder).BuildRequest());
+  if (!response.ok()) return std::move(response).status();
+  if (IsHttpError(**response)) return rest::AsStatus(std::move(**response));
+  // List responses can be large, parse them as they are received and without
+  // building an intermediate JSON object.
+  auto payload = std::move(**response).ExtractPayload();
+  return ObjectMetadataSaxParser::ListFromPayload(*payload);
 }
 
 StatusOr<EmptyResponse> RestStub::DeleteObject(
@@ -1239,6 +1334,46 @@ StatusOr<EmptyResponse> RestStub::DeleteNotification(
       storage_rest_client_->Delete(context, std::move(builder).BuildRequest()));
 }
 
+StatusOr<BatchResponse> RestStub::ExecuteBatch(
+    rest_internal::RestContext& context, Options const& options,
+    BatchRequest const& request) {
+  auto const& version = options.get<TargetApiVersionOption>();
+  std::vector<std::string> parts;
+  parts.reserve(request.requests.size());
+  for (auto const& r : request.requests) {
+    parts.push_back(absl::visit(BatchPartFormatter{version, parts.size()}, r));
+  }
+  auto const boundary = GenerateMessageBoundary(
+      absl::StrJoin(parts, ""), [this] { return MakeBoundary(); });
+  auto const payload = JoinBatchParts(parts, boundary);
+
+  RestRequestBuilder builder(absl::StrCat("batch/storage/", version));
+  auto headers = AddHeaders(options, builder);
+  if (!headers.ok()) return headers;
+  builder.AddHeader("Content-Type", "multipart/mixed; boundary=" + boundary);
+  auto response =
+      storage_rest_client_->Post(context, std::move(builder).BuildRequest(),
+                                 {absl::MakeConstSpan(payload)});
+  if (!response.ok()) return std::move(response).status();
+  if (IsHttpError(**response)) return rest::AsStatus(std::move(**response));
+  auto const response_headers = (*response)->Headers();
+  auto content_type = response_headers.find("content-type");
+  auto body = rest::ReadAll(std::move(**response).ExtractPayload());
+  if (!body) return std::move(body).status();
+  auto responses = ParseBatchResponse(
+      content_type == response_headers.end() ? "" : content_type->second,
+      *body, request.requests.size());
+  if (!responses) return std::move(responses).status();
+
+  BatchResponse result;
+  result.results.reserve(responses->size());
+  for (std::size_t i = 0; i != responses->size(); ++i) {
+    result.results.push_back(
+        absl::visit(BatchResultParser{(*responses)[i]}, request.requests[i]));
+  }
+  return result;
+}
+
 std::vector<std::string> RestStub::InspectStackStructure() const {
   return {"RestStub"};
 }
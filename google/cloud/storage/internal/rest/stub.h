@@ -228,6 +228,10 @@ class RestStub : public storage_internal::GenericStub {
       rest_internal::RestContext& context, Options const& options,
       DeleteNotificationRequest const& request) override;
 
+  StatusOr<BatchResponse> ExecuteBatch(rest_internal::RestContext& context,
+                                       Options const& options,
+                                       BatchRequest const& request) override;
+
   std::vector<std::string> InspectStackStructure() const override;
 
  private:
@@ -15,7 +15,9 @@
 #include "google/cloud/storage/internal/rest/stub.h"
 #include "google/cloud/storage/testing/canonical_errors.h"
 #include "google/cloud/internal/api_client_header.h"
+#include "google/cloud/testing_util/mock_http_payload.h"
 #include "google/cloud/testing_util/mock_rest_client.h"
+#include "google/cloud/testing_util/mock_rest_response.h"
 #include "google/cloud/testing_util/status_matchers.h"
 #include <gmock/gmock.h>
 
@@ -30,11 +32,14 @@ using ::google::cloud::internal::HandCraftedLibClientHeader;
 using ::google::cloud::rest_internal::RestContext;
 using ::google::cloud::rest_internal::RestRequest;
 using ::google::cloud::storage::testing::canonical_errors::PermanentError;
+using ::google::cloud::testing_util::MakeMockHttpPayloadSuccess;
 using ::google::cloud::testing_util::MockRestClient;
+using ::google::cloud::testing_util::MockRestResponse;
 using ::google::cloud::testing_util::StatusIs;
 using ::testing::_;
 using ::testing::AllOf;
 using ::testing::An;
+using ::testing::ByMove;
 using ::testing::Contains;
 using ::testing::ElementsAre;
 using ::testing::Eq;
@@ -901,6 +906,121 @@ TEST(RestStubTest, DeleteNotification) {
               StatusIs(PermanentError().code(), PermanentError().message()));
 }
 
+TEST(RestStubTest, ExecuteBatch) {
+  auto mock = std::make_shared<MockRestClient>();
+  EXPECT_CALL(*mock,
+              Post(ExpectedContext(),
+                   ResultOf(
+                       "request path is the batch endpoint",
+                       [](RestRequest const& r) { return r.path(); },
+                       Eq("batch/storage/vTest")),
+                   ExpectedPayload()))
+      .WillOnce(Return(PermanentError()));
+  auto tested = std::make_unique<RestStub>(Options{}, mock, mock);
+  auto context = TestContext();
+  BatchRequest request;
+  request.requests.emplace_back(DeleteObjectRequest("bucket", "object"));
+  auto status = tested->ExecuteBatch(context, TestOptions(), request);
+  EXPECT_THAT(status,
+              StatusIs(PermanentError().code(), PermanentError().message()));
+}
+
+TEST(RestStubTest, ExecuteBatchEncodesPaths) {
+  auto mock = std::make_shared<MockRestClient>();
+  EXPECT_CALL(*mock, Post(ExpectedContext(), _, ExpectedPayload()))
+      .WillOnce([&](RestContext&, RestRequest const&,
+                    std::vector<absl::Span<char const>> const& p) {
+        std::string body;
+        for (auto const& s : p) body.append(s.begin(), s.end());
+        EXPECT_THAT(body, HasSubstr("DELETE /storage/vTest/b/my%20bucket/o/"
+                                    "dir%2Fobject%3F/acl/user%3Aa%40b.com"));
+        return PermanentError();
+      });
+  auto tested = std::make_unique<RestStub>(Options{}, mock, mock);
+  auto context = TestContext();
+  BatchRequest request;
+  request.requests.emplace_back(
+      DeleteObjectAclRequest("my bucket", "dir/object?", "user:a@b.com"));
+  auto status = tested->ExecuteBatch(context, TestOptions(), request);
+  EXPECT_THAT(status, StatusIs(PermanentError().code()));
+}
+
+TEST(RestStubTest, ExecuteBatchParsesResponse) {
+  auto const response_payload = std::string(
+      "--response_boundary\r\n"
+      "Content-Type: application/http\r\n"
+      "Content-ID: <response-1>\r\n"
+      "\r\n"
+      "HTTP/1.1 200 OK\r\n"
+      "Content-Type: application/json; charset=UTF-8\r\n"
+      "\r\n"
+      R"js({"bucket": "bucket", "name": "object", "generation": "42"})js"
+      "\r\n"
+      "--response_boundary\r\n"
+      "Content-Type: application/http\r\n"
+      "Content-ID: <response-0>\r\n"
+      "\r\n"
+      "HTTP/1.1 204 No Content\r\n"
+      "\r\n"
+      "\r\n"
+      "--response_boundary\r\n"
+      "Content-Type: application/http\r\n"
+      "Content-ID: <response-2>\r\n"
+      "\r\n"
+      "HTTP/1.1 404 Not Found\r\n"
+      "\r\n"
+      R"js({"error": {"code": 404, "message": "No such object"}})js"
+      "\r\n"
+      "--response_boundary--\r\n");
+
+  auto mock = std::make_shared<MockRestClient>();
+  EXPECT_CALL(*mock, Post(ExpectedContext(), _, ExpectedPayload()))
+      .WillOnce([&](RestContext&, RestRequest const& r,
+                    std::vector<absl::Span<char const>> const& p) {
+        auto const content_type = r.GetHeader("content-type");
+        EXPECT_THAT(content_type,
+                    ElementsAre(HasSubstr("multipart/mixed; boundary=")));
+        std::string body;
+        for (auto const& s : p) body.append(s.begin(), s.end());
+        EXPECT_THAT(body, HasSubstr("DELETE /storage/vTest/b/bucket/o/object"));
+        EXPECT_THAT(body, HasSubstr("PATCH /storage/vTest/b/bucket/o/object"));
+        EXPECT_THAT(body,
+                    HasSubstr("DELETE /storage/vTest/b/bucket/o/missing"));
+
+        auto response = std::make_unique<MockRestResponse>();
+        EXPECT_CALL(*response, StatusCode)
+            .WillRepeatedly(Return(rest_internal::HttpStatusCode::kOk));
+        EXPECT_CALL(*response, Headers)
+            .WillRepeatedly(Return(std::multimap<std::string, std::string>{
+                {"content-type",
+                 "multipart/mixed; boundary=response_boundary"}}));
+        EXPECT_CALL(std::move(*response), ExtractPayload)
+            .WillOnce(Return(
+                ByMove(MakeMockHttpPayloadSuccess(response_payload))));
+        return std::unique_ptr<rest_internal::RestResponse>(
+            std::move(response));
+      });
+  auto tested = std::make_unique<RestStub>(Options{}, mock, mock);
+  auto context = TestContext();
+  BatchRequest request;
+  request.requests.emplace_back(DeleteObjectRequest("bucket", "object"));
+  request.requests.emplace_back(PatchObjectRequest(
+      "bucket", "object",
+      ObjectMetadataPatchBuilder().SetContentType("text/plain")));
+  request.requests.emplace_back(DeleteObjectRequest("bucket", "missing"));
+  auto response = tested->ExecuteBatch(context, TestOptions(), request);
+  ASSERT_STATUS_OK(response);
+  ASSERT_THAT(response->results, ElementsAre(_, _, _));
+  ASSERT_STATUS_OK(response->results[0]);
+  EXPECT_TRUE(absl::holds_alternative<absl::monostate>(*response->results[0]));
+  ASSERT_STATUS_OK(response->results[1]);
+  auto const* metadata = absl::get_if<ObjectMetadata>(&*response->results[1]);
+  ASSERT_NE(metadata, nullptr);
+  EXPECT_EQ(metadata->name(), "object");
+  EXPECT_EQ(metadata->generation(), 42);
+  EXPECT_THAT(response->results[2], StatusIs(StatusCode::kNotFound));
+}
+
 }  // namespace
 }  // namespace internal
 GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
@@ -72,13 +72,21 @@ RetryObjectReadSource::RetryObjectReadSource(
 
 StatusOr<ReadSourceResult> RetryObjectReadSource::Read(char* buf,
                                                        std::size_t n) {
+  return ReadImpl([&](ObjectReadSource& child) { return child.Read(buf, n); });
+}
+
+StatusOr<ReadSourceResult> RetryObjectReadSource::ReadChunk(std::size_t n) {
+  return ReadImpl([&](ObjectReadSource& child) { return child.ReadChunk(n); });
+}
+
+StatusOr<ReadSourceResult> RetryObjectReadSource::ReadImpl(ReadFunction read) {
   if (!child_) {
     return google::cloud::internal::FailedPreconditionError(
         "Stream is not open", GCP_ERROR_INFO());
   }
 
   // Read some data, if successful return immediately, saving some allocations.
-  auto result = child_->Read(buf, n);
+  auto result = read(*child_);
   if (HandleResult(result)) return result;
   bool has_emulator_instructions = false;
   std::string instructions;
@@ -124,7 +132,7 @@ StatusOr<ReadSourceResult> RetryObjectReadSource::Read(char* buf,
       result = status;
       continue;
     }
-    result = child_->Read(buf, n);
+    result = read(*child_);
   }
   if (HandleResult(result)) return result;
   // We have exhausted the retry policy, return the error.
@@ -20,6 +20,7 @@
 #include "google/cloud/storage/retry_policy.h"
 #include "google/cloud/storage/version.h"
 #include "google/cloud/options.h"
+#include "absl/functional/function_ref.h"
 #include "absl/types/optional.h"
 #include <chrono>
 #include <functional>
@@ -64,8 +65,13 @@ class RetryObjectReadSource : public ObjectReadSource {
   bool IsOpen() const override { return child_ && child_->IsOpen(); }
   StatusOr<HttpResponse> Close() override { return child_->Close(); }
   StatusOr<ReadSourceResult> Read(char* buf, std::size_t n) override;
+  StatusOr<ReadSourceResult> ReadChunk(std::size_t n) override;
 
  private:
+  using ReadFunction =
+      absl::FunctionRef<StatusOr<ReadSourceResult>(ObjectReadSource&)>;
+
+  StatusOr<ReadSourceResult> ReadImpl(ReadFunction read);
   bool HandleResult(StatusOr<ReadSourceResult> const& r);
   Status MakeChild(RetryPolicy& retry_policy, BackoffPolicy& backoff_policy);
   StatusOr<std::unique_ptr<ObjectReadSource>> ReadDiscard(
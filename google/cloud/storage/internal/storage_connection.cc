@@ -13,6 +13,7 @@
 // limitations under the License.
 
 #include "google/cloud/storage/internal/storage_connection.h"
+#include "google/cloud/internal/make_status.h"
 #include <utility>
 #include <vector>
 
@@ -22,6 +23,12 @@ namespace storage {
 GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_BEGIN
 namespace internal {
 
+StatusOr<BatchResponse> StorageConnection::ExecuteBatch(BatchRequest const&) {
+  return google::cloud::internal::UnimplementedError(
+      "JSON batch requests are not supported by this connection",
+      GCP_ERROR_INFO());
+}
+
 std::vector<std::string> StorageConnection::InspectStackStructure() const {
   return {};
 }
@@ -17,6 +17,7 @@
 
 #include "google/cloud/storage/bucket_metadata.h"
 #include "google/cloud/storage/client_options.h"
+#include "google/cloud/storage/internal/batch_requests.h"
 #include "google/cloud/storage/internal/bucket_acl_requests.h"
 #include "google/cloud/storage/internal/bucket_requests.h"
 #include "google/cloud/storage/internal/default_object_acl_requests.h"
@@ -110,6 +111,13 @@ class StorageConnection {
       DeleteResumableUploadRequest const& request) = 0;
   virtual StatusOr<QueryResumableUploadResponse> UploadChunk(
       UploadChunkRequest const& request) = 0;
+  /**
+   * Returns the contents of the file to upload in @p request.
+   *
+   * Implementations may set the payload of the request directly instead, for
+   * example to reference the pages of a memory mapped file. In that case they
+   * return a null pointer.
+   */
   virtual StatusOr<std::unique_ptr<std::string>> UploadFileSimple(
       std::string const&, std::size_t, InsertObjectMediaRequest&) {
     return Status(StatusCode::kUnimplemented, "unimplemented");
@@ -194,6 +202,15 @@ class StorageConnection {
       DeleteNotificationRequest const&) = 0;
   ///@}
 
+  /**
+   * Executes multiple calls using the JSON batch API.
+   *
+   * The calls are split into multiple batches if needed, and the calls that
+   * fail with transient errors are retried. Only the REST transport supports
+   * batch requests, the default implementation returns `kUnimplemented`.
+   */
+  virtual StatusOr<BatchResponse> ExecuteBatch(BatchRequest const&);
+
   // Test-only. Returns the names of the decorator stack elements.
   virtual std::vector<std::string> InspectStackStructure() const;
 };
@@ -158,8 +158,7 @@ StatusOr<google::iam::v1::Policy> StorageMetadata::GetIamPolicy(
         {
             {[](google::iam::v1::GetIamPolicyRequest const& request)
                  -> std::string const& { return request.resource(); },
-             std::regex{"(projects/[^/]+/buckets/[^/]+)/.*",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate("{projects/*/buckets/*}/**")},
             {[](google::iam::v1::GetIamPolicyRequest const& request)
                  -> std::string const& { return request.resource(); },
              absl::nullopt},
@@ -188,8 +187,7 @@ StatusOr<google::iam::v1::Policy> StorageMetadata::SetIamPolicy(
         {
             {[](google::iam::v1::SetIamPolicyRequest const& request)
                  -> std::string const& { return request.resource(); },
-             std::regex{"(projects/[^/]+/buckets/[^/]+)/.*",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate("{projects/*/buckets/*}/**")},
             {[](google::iam::v1::SetIamPolicyRequest const& request)
                  -> std::string const& { return request.resource(); },
              absl::nullopt},
@@ -219,12 +217,12 @@ StorageMetadata::TestIamPermissions(
         {
             {[](google::iam::v1::TestIamPermissionsRequest const& request)
                  -> std::string const& { return request.resource(); },
-             std::regex{"(projects/[^/]+/buckets/[^/]+)/managedFolders/.*",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate(
+                 "{projects/*/buckets/*}/managedFolders/**")},
             {[](google::iam::v1::TestIamPermissionsRequest const& request)
                  -> std::string const& { return request.resource(); },
-             std::regex{"(projects/[^/]+/buckets/[^/]+)/objects/.*",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate(
+                 "{projects/*/buckets/*}/objects/**")},
             {[](google::iam::v1::TestIamPermissionsRequest const& request)
                  -> std::string const& { return request.resource(); },
              absl::nullopt},
@@ -330,8 +328,7 @@ StorageMetadata::CancelResumableWrite(
         {
             {[](google::storage::v2::CancelResumableWriteRequest const& request)
                  -> std::string const& { return request.upload_id(); },
-             std::regex{"(projects/[^/]+/buckets/[^/]+)/.*",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate("{projects/*/buckets/*}/**")},
         }};
   }();
   bucket_matcher->AppendParam(request, params);
@@ -514,8 +511,7 @@ StorageMetadata::QueryWriteStatus(
         {
             {[](google::storage::v2::QueryWriteStatusRequest const& request)
                  -> std::string const& { return request.upload_id(); },
-             std::regex{"(projects/[^/]+/buckets/[^/]+)/.*",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate("{projects/*/buckets/*}/**")},
         }};
   }();
   bucket_matcher->AppendParam(request, params);
@@ -695,8 +691,7 @@ StorageMetadata::AsyncQueryWriteStatus(
         {
             {[](google::storage::v2::QueryWriteStatusRequest const& request)
                  -> std::string const& { return request.upload_id(); },
-             std::regex{"(projects/[^/]+/buckets/[^/]+)/.*",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate("{projects/*/buckets/*}/**")},
         }};
   }();
   bucket_matcher->AppendParam(request, params);
@@ -473,6 +473,13 @@ TracingConnection::DeleteNotification(
   return internal::EndSpan(*span, impl_->DeleteNotification(request));
 }
 
+StatusOr<storage::internal::BatchResponse> TracingConnection::ExecuteBatch(
+    storage::internal::BatchRequest const& request) {
+  auto span = internal::MakeSpan("storage::Client::ExecuteBatch");
+  auto scope = opentelemetry::trace::Scope(span);
+  return internal::EndSpan(*span, impl_->ExecuteBatch(request));
+}
+
 std::vector<std::string> TracingConnection::InspectStackStructure() const {
   auto stack = impl_->InspectStackStructure();
   stack.emplace_back("TracingConnection");
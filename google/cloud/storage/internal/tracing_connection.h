@@ -170,6 +170,9 @@ class TracingConnection : public storage::internal::StorageConnection {
   StatusOr<storage::internal::EmptyResponse> DeleteNotification(
       storage::internal::DeleteNotificationRequest const& request) override;
 
+  StatusOr<storage::internal::BatchResponse> ExecuteBatch(
+      storage::internal::BatchRequest const& request) override;
+
   std::vector<std::string> InspectStackStructure() const override;
 
  private:
@@ -52,9 +52,20 @@ StatusOr<storage::internal::HttpResponse> TracingObjectReadSource::Close() {
 
 StatusOr<storage::internal::ReadSourceResult> TracingObjectReadSource::Read(
     char* buf, std::size_t n) {
+  return ReadImpl(n, [&] { return child_->Read(buf, n); });
+}
+
+StatusOr<storage::internal::ReadSourceResult>
+TracingObjectReadSource::ReadChunk(std::size_t n) {
+  return ReadImpl(n, [&] { return child_->ReadChunk(n); });
+}
+
+StatusOr<storage::internal::ReadSourceResult> TracingObjectReadSource::ReadImpl(
+    std::size_t n,
+    absl::FunctionRef<StatusOr<storage::internal::ReadSourceResult>()> read) {
   auto scope = opentelemetry::trace::Scope(span_);
   auto const start = std::chrono::system_clock::now();
-  auto response = child_->Read(buf, n);
+  auto response = read();
   auto const latency = std::chrono::duration_cast<std::chrono::microseconds>(
                            std::chrono::system_clock::now() - start)
                            .count();
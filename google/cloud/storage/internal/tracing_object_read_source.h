@@ -20,6 +20,7 @@
 #include "google/cloud/storage/internal/object_read_source.h"
 #include "google/cloud/storage/version.h"
 #include "google/cloud/internal/opentelemetry.h"
+#include "absl/functional/function_ref.h"
 #include <memory>
 
 namespace google {
@@ -46,8 +47,14 @@ class TracingObjectReadSource : public storage::internal::ObjectReadSource {
   StatusOr<storage::internal::HttpResponse> Close() override;
   StatusOr<storage::internal::ReadSourceResult> Read(char* buf,
                                                      std::size_t n) override;
+  StatusOr<storage::internal::ReadSourceResult> ReadChunk(
+      std::size_t n) override;
 
  private:
+  StatusOr<storage::internal::ReadSourceResult> ReadImpl(
+      std::size_t n,
+      absl::FunctionRef<StatusOr<storage::internal::ReadSourceResult>()> read);
+
   opentelemetry::nostd::shared_ptr<opentelemetry::trace::Span> span_;
   std::unique_ptr<storage::internal::ObjectReadSource> child_;
 };
@@ -0,0 +1,131 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GOOGLE_CLOUD_CPP_GOOGLE_CLOUD_STORAGE_OBJECT_BATCH_H
+#define GOOGLE_CLOUD_CPP_GOOGLE_CLOUD_STORAGE_OBJECT_BATCH_H
+
+#include "google/cloud/storage/internal/batch_requests.h"
+#include "google/cloud/storage/object_access_control.h"
+#include "google/cloud/storage/object_metadata.h"
+#include "google/cloud/storage/version.h"
+#include <cstddef>
+#include <string>
+#include <utility>
+
+namespace google {
+namespace cloud {
+namespace storage {
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_BEGIN
+class Client;
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
+}  // namespace storage
+
+namespace storage_experimental {
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_BEGIN
+
+/**
+ * The result of a single call in an `ObjectBatch`.
+ *
+ * On success, this contains `storage::ObjectMetadata` for `PatchObject()`,
+ * `storage::ObjectAccessControl` for `UpdateObjectAcl()`, and
+ * `absl::monostate` for the delete operations.
+ */
+using BatchResult = storage::internal::BatchedResult;
+
+/**
+ * Accumulates object metadata operations to send using the JSON batch API.
+ *
+ * Each call in a batch is executed independently by the service, but all the
+ * calls share a single HTTP round trip. This is more efficient when deleting
+ * or updating the metadata of many objects. Use `storage::Client::ExecuteBatch`
+ * to send the calls.
+ *
+ * Each member function returns the index of the call, which is also the index
+ * of its result in the vector returned by `ExecuteBatch()`. The options for
+ * each call are the same as the options for the corresponding
+ * `storage::Client` member function.
+ *
+ * @note Batch requests are only supported by the REST transport.
+ *
+ * @see https://cloud.google.com/storage/docs/batch
+ */
+class ObjectBatch {
+ public:
+  ObjectBatch() = default;
+
+  /// The number of calls in the batch.
+  std::size_t size() const { return request_.requests.size(); }
+
+  /// Adds a call to delete an object, see `storage::Client::DeleteObject()`.
+  template <typename... Options>
+  std::size_t DeleteObject(std::string bucket_name, std::string object_name,
+                           Options&&... options) {
+    storage::internal::DeleteObjectRequest request(std::move(bucket_name),
+                                                   std::move(object_name));
+    request.set_multiple_options(std::forward<Options>(options)...);
+    return Add(std::move(request));
+  }
+
+  /// Adds a call to patch an object, see `storage::Client::PatchObject()`.
+  template <typename... Options>
+  std::size_t PatchObject(std::string bucket_name, std::string object_name,
+                          storage::ObjectMetadataPatchBuilder const& builder,
+                          Options&&... options) {
+    storage::internal::PatchObjectRequest request(
+        std::move(bucket_name), std::move(object_name), builder);
+    request.set_multiple_options(std::forward<Options>(options)...);
+    return Add(std::move(request));
+  }
+
+  /// Adds a call to delete an object ACL, see
+  /// `storage::Client::DeleteObjectAcl()`.
+  template <typename... Options>
+  std::size_t DeleteObjectAcl(std::string bucket_name, std::string object_name,
+                              std::string entity, Options&&... options) {
+    storage::internal::DeleteObjectAclRequest request(
+        std::move(bucket_name), std::move(object_name), std::move(entity));
+    request.set_multiple_options(std::forward<Options>(options)...);
+    return Add(std::move(request));
+  }
+
+  /// Adds a call to update an object ACL, see
+  /// `storage::Client::UpdateObjectAcl()`.
+  template <typename... Options>
+  std::size_t UpdateObjectAcl(std::string bucket_name, std::string object_name,
+                              storage::ObjectAccessControl const& acl,
+                              Options&&... options) {
+    storage::internal::UpdateObjectAclRequest request(
+        std::move(bucket_name), std::move(object_name), acl.entity(),
+        acl.role());
+    request.set_multiple_options(std::forward<Options>(options)...);
+    return Add(std::move(request));
+  }
+
+ private:
+  friend class storage::Client;
+
+  std::size_t Add(storage::internal::BatchedRequest request) {
+    request_.requests.push_back(std::move(request));
+    return request_.requests.size() - 1;
+  }
+
+  storage::internal::BatchRequest request_;
+};
+
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
+}  // namespace storage_experimental
+}  // namespace cloud
+}  // namespace google
+
+#endif  // GOOGLE_CLOUD_CPP_GOOGLE_CLOUD_STORAGE_OBJECT_BATCH_H
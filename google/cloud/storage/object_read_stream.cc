@@ -84,6 +84,26 @@ void ObjectReadStream::Close() {
   }
 }
 
+StatusOr<std::size_t> ObjectReadStream::ReadInto(char* buf, std::size_t n) {
+  auto read = buf_->ReadInto(buf, n);
+  if (!read) {
+    setstate(std::ios_base::badbit);
+  } else if (*read == 0 && n != 0) {
+    setstate(std::ios_base::eofbit);
+  }
+  return read;
+}
+
+StatusOr<absl::Cord> ObjectReadStream::ReadChunk(std::size_t max_size) {
+  auto read = buf_->ReadChunk(max_size);
+  if (!read) {
+    setstate(std::ios_base::badbit);
+  } else if (read->empty() && max_size != 0) {
+    setstate(std::ios_base::eofbit);
+  }
+  return read;
+}
+
 GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
 }  // namespace storage
 }  // namespace cloud
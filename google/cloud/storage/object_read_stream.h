@@ -18,6 +18,9 @@
 #include "google/cloud/storage/headers_map.h"
 #include "google/cloud/storage/internal/object_read_streambuf.h"
 #include "google/cloud/storage/version.h"
+#include "google/cloud/status_or.h"
+#include "absl/strings/cord.h"
+#include <cstddef>
 #include <istream>
 #include <memory>
 #include <string>
@@ -76,6 +79,39 @@ class ObjectReadStream : public std::basic_istream<char> {
    */
   void Close();
 
+  /**
+   * Reads up to @p n bytes directly into @p buf.
+   *
+   * This function bypasses the `std::istream` buffering: the data is copied
+   * once, from the transport into @p buf. Errors, including checksum
+   * mismatches, are returned as a `Status`. The stream state is updated as in
+   * `read()`, that is, the function sets `badbit` on errors and `eofbit` at
+   * the end of the download.
+   *
+   * @note Like `read()`, this function throws `std::ios_base::failure` if the
+   *     application enables exceptions (via `exceptions()`) for the state bits
+   *     it sets. With the default exception mask it never throws.
+   *
+   * @return the number of bytes read, which may be smaller than @p n even if
+   *     the download is not complete. Returns 0 at the end of the download.
+   */
+  StatusOr<std::size_t> ReadInto(char* buf, std::size_t n);
+
+  /**
+   * Reads up to @p max_size bytes, returning them as an `absl::Cord`.
+   *
+   * When using gRPC the returned `absl::Cord` shares the buffers received
+   * from the transport, and the data is not copied. With other transports the
+   * data is copied once. Errors are reported, and the stream state is updated,
+   * as in `ReadInto()`. In particular, this function may throw if the
+   * application enables exceptions for the stream.
+   *
+   * @return the data read, which may be smaller than @p max_size even if the
+   *     download is not complete. Returns an empty value at the end of the
+   *     download.
+   */
+  StatusOr<absl::Cord> ReadChunk(std::size_t max_size);
+
   /**
    * Report any download errors.
    *
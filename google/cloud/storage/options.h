@@ -24,6 +24,7 @@
 #include "google/cloud/internal/rest_options.h"
 #include "google/cloud/options.h"
 #include <chrono>
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <string>
@@ -53,6 +54,63 @@ struct HttpVersionOption {
   using Type = std::string;
 };
 
+/**
+ * Cache the contents of object generations in a local directory.
+ *
+ * A given object generation never changes, so its contents can be cached
+ * without invalidation. With this option set, reads that name an object
+ * generation are served from fixed-size blocks stored in this directory. Only
+ * the blocks that are not in the cache are downloaded, and concurrent reads of
+ * the same missing block share a single download. Each block is verified
+ * against its CRC32C checksum when it is read from the local disk.
+ *
+ * The cache applies to `Client::ReadObject()` calls with a
+ * `storage::Generation()` option, and to `AsyncClient::ReadObjectRange()` calls
+ * that set the `generation` field. Reads of the last N bytes of an object,
+ * reads with preconditions or customer-supplied encryption keys, and reads
+ * subject to decompressive transcoding, bypass the cache.
+ *
+ * The directory must exist. Each client keeps its own index of the blocks it
+ * stores, and removes them when it is destroyed, so the cache does not persist
+ * across processes.
+ *
+ * @note This option must be supplied when the client is created.
+ *
+ * @ingroup storage-options
+ */
+struct ReadCacheDirectoryOption {
+  using Type = std::string;
+};
+
+/**
+ * The maximum number of bytes stored by the read cache.
+ *
+ * Once the cache reaches this size, the least recently used blocks are
+ * removed. The default is 1 GiB.
+ *
+ * @see #google::cloud::storage_experimental::ReadCacheDirectoryOption
+ *
+ * @ingroup storage-options
+ */
+struct ReadCacheMaxBytesOption {
+  using Type = std::uint64_t;
+};
+
+/**
+ * The size of the blocks stored by the read cache.
+ *
+ * Objects are downloaded and cached in blocks of this size. Larger blocks need
+ * fewer requests to fill the cache, but may download more data than a small
+ * range read requires. The default is 16 MiB.
+ *
+ * @see #google::cloud::storage_experimental::ReadCacheDirectoryOption
+ *
+ * @ingroup storage-options
+ */
+struct ReadCacheBlockSizeOption {
+  using Type = std::size_t;
+};
+
 GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
 }  // namespace storage_experimental
 
@@ -190,6 +248,22 @@ struct MaximumSimpleUploadSizeOption {
   using Type = std::size_t;
 };
 
+/**
+ * Use memory mapped files in `Client::UploadFile()`.
+ *
+ * By default `UploadFile()` reads the file into an in-memory buffer. With this
+ * option the library maps the file into memory, and uploads the mapped pages.
+ * With gRPC the pages are sent without any copies into user-space buffers.
+ *
+ * The application must not modify or truncate the file during the upload. On
+ * platforms without memory mapped files (Windows) this option is ignored.
+ *
+ * @ingroup storage-options
+ */
+struct EnableMemoryMappedUploadsOption {
+  using Type = bool;
+};
+
 /**
  * Disables automatic OpenSSL locking.
  *
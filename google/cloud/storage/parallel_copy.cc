@@ -0,0 +1,71 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/storage/parallel_copy.h"
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace google {
+namespace cloud {
+namespace storage {
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_BEGIN
+namespace internal {
+namespace {
+auto constexpr kCopyBufferSize = 1024 * 1024;
+}  // namespace
+
+void ParallelCopyProgress::Add(std::uint64_t n) {
+  std::lock_guard<std::mutex> lk(mu_);
+  bytes_copied_ += n;
+  if (callback_) callback_(bytes_copied_, size_);
+}
+
+void ParallelCopyProgress::Set(std::uint64_t n) {
+  std::lock_guard<std::mutex> lk(mu_);
+  bytes_copied_ = n;
+  if (callback_) callback_(bytes_copied_, size_);
+}
+
+StatusOr<ObjectMetadata> CopyStream(ObjectReadStream reader,
+                                    ObjectWriteStream writer,
+                                    ParallelCopyProgress& progress) {
+  if (!reader.status().ok()) {
+    std::move(writer).Suspend();
+    return reader.status();
+  }
+  std::vector<char> buffer(kCopyBufferSize);
+  do {
+    reader.read(buffer.data(), buffer.size());
+    auto const n = reader.gcount();
+    writer.write(buffer.data(), n);
+    if (n > 0 && writer.good()) progress.Add(static_cast<std::uint64_t>(n));
+  } while (reader.good() && writer.good());
+  if (!reader.status().ok()) {
+    std::move(writer).Suspend();
+    return reader.status();
+  }
+  if (!writer.last_status().ok()) {
+    std::move(writer).Suspend();
+    return writer.last_status();
+  }
+  writer.Close();
+  return writer.metadata();
+}
+
+}  // namespace internal
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
+}  // namespace storage
+}  // namespace cloud
+}  // namespace google
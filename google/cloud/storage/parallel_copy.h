@@ -0,0 +1,325 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GOOGLE_CLOUD_CPP_GOOGLE_CLOUD_STORAGE_PARALLEL_COPY_H
+#define GOOGLE_CLOUD_CPP_GOOGLE_CLOUD_STORAGE_PARALLEL_COPY_H
+
+#include "google/cloud/storage/client.h"
+#include "google/cloud/storage/internal/tuple_filter.h"
+#include "google/cloud/storage/parallel_upload.h"
+#include "google/cloud/storage/version.h"
+#include "google/cloud/internal/make_status.h"
+#include "google/cloud/status_or.h"
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace google {
+namespace cloud {
+namespace storage {
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_BEGIN
+
+/**
+ * A parameter type to receive progress updates from `ParallelCopyObject()`.
+ *
+ * The callback receives the number of bytes copied so far, and the size of the
+ * source object. The calls are serialized, but they may happen on any of the
+ * threads used by `ParallelCopyObject()`.
+ */
+class ParallelCopyProgressCallback {
+ public:
+  using Callback =
+      std::function<void(std::uint64_t bytes_copied, std::uint64_t size)>;
+
+  explicit ParallelCopyProgressCallback(Callback value)
+      : value_(std::move(value)) {}
+  Callback const& value() const { return value_; }
+
+ private:
+  Callback value_;
+};
+
+namespace internal {
+
+// Just a wrapper to allow for use in `google::cloud::internal::apply`.
+struct RewriteObjectApplyHelper {
+  template <typename... Options>
+  ObjectRewriter operator()(Options... options) const {
+    return client.RewriteObject(
+        source_bucket_name, source_object_name, destination_bucket_name,
+        destination_object_name, std::move(options)...);
+  }
+
+  Client& client;
+  std::string const& source_bucket_name;
+  std::string const& source_object_name;
+  std::string const& destination_bucket_name;
+  std::string const& destination_object_name;
+};
+
+// Just a wrapper to allow for use in `google::cloud::internal::apply`.
+struct WriteObjectApplyHelper {
+  template <typename... Options>
+  ObjectWriteStream operator()(Options... options) const {
+    return client.WriteObject(bucket_name, object_name, std::move(options)...);
+  }
+
+  Client& client;
+  std::string const& bucket_name;
+  std::string const& object_name;
+};
+
+/// Tracks the bytes copied by `ParallelCopyObject()`, and reports them.
+class ParallelCopyProgress {
+ public:
+  ParallelCopyProgress(ParallelCopyProgressCallback::Callback callback,
+                       std::uint64_t size)
+      : callback_(std::move(callback)), size_(size) {}
+
+  /// Adds @p n bytes to the bytes copied so far.
+  void Add(std::uint64_t n);
+  /// Sets the bytes copied so far to @p n.
+  void Set(std::uint64_t n);
+
+ private:
+  ParallelCopyProgressCallback::Callback callback_;
+  std::uint64_t size_;
+  std::mutex mu_;
+  std::uint64_t bytes_copied_ = 0;
+};
+
+/**
+ * Copy the bytes from @p reader to @p writer and finalize the object.
+ *
+ * If reading fails the upload is suspended, so no partial object is created.
+ */
+StatusOr<ObjectMetadata> CopyStream(ObjectReadStream reader,
+                                    ObjectWriteStream writer,
+                                    ParallelCopyProgress& progress);
+
+}  // namespace internal
+
+/**
+ * Copy a large object using many concurrent streams.
+ *
+ * `Client::RewriteObject()` copies an object using a single sequence of
+ * requests. Copying large objects across locations or storage classes with a
+ * single rewrite can take a long time. This function splits the source object
+ * into ranges, copies each range concurrently into a temporary object, and
+ * then composes these temporary objects into the destination.
+ *
+ * The service cannot rewrite a range of an object, so each range is read from
+ * the source and written to the destination bucket by this process. Copies
+ * within a single bucket, and objects too small to split, use a single
+ * `RewriteObjectBlocking()` call instead.
+ *
+ * Objects created by composition do not have a MD5 hash. The CRC32C checksum of
+ * the destination object is compared against the checksum of the source. If
+ * they are different this function deletes the destination object, and returns
+ * a `kDataLoss` error.
+ *
+ * You can affect how many ranges are copied concurrently by using the
+ * `MaxStreams` and `MinStreamSize` options.
+ *
+ * Stray temporary objects might be left over if there are failures. The user
+ * is expected to provide a unique @p prefix, all the temporary objects created
+ * by this function start with this prefix. Once this function returns, the user
+ * may safely remove all objects with this prefix (e.g. via `DeleteByPrefix()`).
+ *
+ * @param client the client on which to perform the operations.
+ * @param source_bucket_name the name of the bucket containing the source.
+ * @param source_object_name the name of the source object.
+ * @param destination_bucket_name the name of the bucket for the new object,
+ *     the temporary objects are also created in this bucket.
+ * @param destination_object_name the name of the new object.
+ * @param prefix the prefix with which temporary objects will be created.
+ * @param ignore_cleanup_failures treat failures to cleanup the temporary
+ *     objects as not fatal.
+ * @param options a list of optional query parameters and/or request headers.
+ *     Valid types for this operation include `DestinationPredefinedAcl`,
+ *     `IfGenerationMatch`, `IfMetagenerationMatch`, `MaxStreams`,
+ *     `MinStreamSize`, `ParallelCopyProgressCallback`, `QuotaUser`, `UserIp`,
+ *     `UserProject` and `WithObjectMetadata`. The preconditions and metadata
+ *     apply to the destination object.
+ *
+ * @return the metadata of the destination object.
+ *
+ * @par Idempotency
+ * This operation is not idempotent. While each request performed by this
+ * function is retried based on the client policies, the operation itself stops
+ * on the first request that fails.
+ */
+template <typename... Options>
+StatusOr<ObjectMetadata> ParallelCopyObject(
+    Client client, std::string const& source_bucket_name,
+    std::string const& source_object_name,
+    std::string const& destination_bucket_name,
+    std::string const& destination_object_name, std::string const& prefix,
+    bool ignore_cleanup_failures, Options&&... options) {
+  using internal::Among;
+  using internal::NotAmong;
+  using internal::StaticTupleFilter;
+
+  auto all_options = std::make_tuple(options...);
+  static_assert(
+      std::tuple_size<
+          decltype(StaticTupleFilter<
+                   NotAmong<DestinationPredefinedAcl, IfGenerationMatch,
+                            IfMetagenerationMatch, MaxStreams, MinStreamSize,
+                            ParallelCopyProgressCallback, QuotaUser, UserIp,
+                            UserProject, WithObjectMetadata>::TPred>(
+              all_options))>::value == 0,
+      "This functions accepts only options of type DestinationPredefinedAcl, "
+      "IfGenerationMatch, IfMetagenerationMatch, MaxStreams, MinStreamSize, "
+      "ParallelCopyProgressCallback, QuotaUser, UserIp, UserProject or "
+      "WithObjectMetadata.");
+  auto request_options =
+      StaticTupleFilter<Among<QuotaUser, UserIp, UserProject>::TPred>(
+          all_options);
+  auto destination_options = StaticTupleFilter<
+      Among<DestinationPredefinedAcl, IfGenerationMatch, IfMetagenerationMatch,
+            QuotaUser, UserIp, UserProject, WithObjectMetadata>::TPred>(
+      all_options);
+
+  auto source = google::cloud::internal::apply(
+      internal::GetObjectMetadataApplyHelper{client, source_bucket_name,
+                                             source_object_name},
+      request_options);
+  if (!source) return std::move(source).status();
+  auto const generation = source->generation();
+  auto callback =
+      internal::ExtractFirstOccurrenceOfType<ParallelCopyProgressCallback>(
+          all_options);
+  internal::ParallelCopyProgress progress(
+      callback ? callback->value() : nullptr, source->size());
+
+  auto split_points = internal::ComputeParallelFileUploadSplitPoints(
+      source->size(), all_options);
+  // Rewrites within a bucket rarely need to copy the data, a single rewrite is
+  // faster than composing the object.
+  if (split_points.empty() || source_bucket_name == destination_bucket_name) {
+    auto rewriter = google::cloud::internal::apply(
+        internal::RewriteObjectApplyHelper{
+            client, source_bucket_name, source_object_name,
+            destination_bucket_name, destination_object_name},
+        std::tuple_cat(std::make_tuple(SourceGeneration(generation)),
+                       destination_options));
+    return rewriter.ResultWithProgressCallback(
+        [&progress](StatusOr<RewriteProgress> const& p) {
+          if (p) progress.Set(p->total_bytes_rewritten);
+        });
+  }
+
+  internal::ScopedDeleter deleter(
+      [&](std::string const& object_name, std::int64_t object_generation) {
+        return google::cloud::internal::apply(
+            internal::DeleteApplyHelper{client, destination_bucket_name,
+                                        object_name, object_generation},
+            request_options);
+      });
+
+  auto lock = internal::LockPrefix(client, destination_bucket_name, prefix,
+                                   options...);
+  if (!lock) {
+    return Status(lock.status().code(),
+                  "Failed to lock prefix for ParallelCopyObject: " +
+                      lock.status().message());
+  }
+  deleter.Add(*lock);
+
+  split_points.push_back(source->size());
+  std::vector<StatusOr<ObjectMetadata>> parts(split_points.size());
+  std::vector<std::thread> threads;
+  threads.reserve(split_points.size());
+  std::uintmax_t begin = 0;
+  for (std::size_t i = 0; i != split_points.size(); ++i) {
+    auto const end = split_points[i];
+    threads.emplace_back([&, i, begin, end] {
+      auto const part_name = prefix + ".copy-part-" + std::to_string(i);
+      auto reader = google::cloud::internal::apply(
+          internal::ReadObjectApplyHelper{client, source_bucket_name,
+                                          source_object_name},
+          std::tuple_cat(
+              std::make_tuple(Generation(generation),
+                              ReadRange(static_cast<std::int64_t>(begin),
+                                        static_cast<std::int64_t>(end))),
+              request_options));
+      // The checksum of the destination object covers all the parts, there is
+      // no need to compute the checksums of each part.
+      auto writer = google::cloud::internal::apply(
+          internal::WriteObjectApplyHelper{client, destination_bucket_name,
+                                           part_name},
+          std::tuple_cat(std::make_tuple(IfGenerationMatch(0),
+                                         DisableCrc32cChecksum(true),
+                                         DisableMD5Hash(true)),
+                         request_options));
+      parts[i] = internal::CopyStream(std::move(reader), std::move(writer),
+                                      progress);
+    });
+    begin = end;
+  }
+  for (auto& thread : threads) thread.join();
+
+  Status status;
+  std::vector<ComposeSourceObject> sources;
+  sources.reserve(parts.size());
+  for (auto& part : parts) {
+    if (!part) {
+      if (status.ok()) status = std::move(part).status();
+      continue;
+    }
+    deleter.Add(*part);
+    sources.push_back({part->name(), part->generation(), {}});
+  }
+  if (!status.ok()) return status;
+
+  auto result = google::cloud::internal::apply(
+      internal::ComposeManyApplyHelper{client, destination_bucket_name,
+                                       std::move(sources), prefix + ".compose",
+                                       destination_object_name},
+      destination_options);
+  if (!result) return result;
+  if (!source->crc32c().empty() && result->crc32c() != source->crc32c()) {
+    // Do not leave a corrupted object behind. The precondition avoids deleting
+    // the object if another client has already replaced it. There is nothing
+    // better to do if the delete fails, the error is still `kDataLoss`.
+    (void)google::cloud::internal::apply(
+        internal::DeleteApplyHelper{client, destination_bucket_name,
+                                    destination_object_name,
+                                    result->generation()},
+        std::tuple_cat(std::make_tuple(IfGenerationMatch(result->generation())),
+                       request_options));
+    return google::cloud::internal::DataLossError(
+        "mismatched CRC32C checksum in ParallelCopyObject, source=" +
+            source->crc32c() + ", destination=" + result->crc32c(),
+        GCP_ERROR_INFO());
+  }
+  if (!ignore_cleanup_failures) {
+    auto delete_status = deleter.ExecuteDelete();
+    if (!delete_status.ok()) return delete_status;
+  }
+  return result;
+}
+
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
+}  // namespace storage
+}  // namespace cloud
+}  // namespace google
+
+#endif  // GOOGLE_CLOUD_CPP_GOOGLE_CLOUD_STORAGE_PARALLEL_COPY_H
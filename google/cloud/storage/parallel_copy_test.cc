@@ -0,0 +1,330 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/storage/parallel_copy.h"
+#include "google/cloud/storage/internal/object_metadata_parser.h"
+#include "google/cloud/storage/testing/canonical_errors.h"
+#include "google/cloud/storage/testing/mock_client.h"
+#include "google/cloud/testing_util/status_matchers.h"
+#include <gmock/gmock.h>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace google {
+namespace cloud {
+namespace storage {
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_BEGIN
+namespace {
+
+using ::google::cloud::storage::testing::canonical_errors::PermanentError;
+using ::google::cloud::testing_util::IsOkAndHolds;
+using ::google::cloud::testing_util::StatusIs;
+using ::testing::ElementsAre;
+using ::testing::HasSubstr;
+using ::testing::Pair;
+using ::testing::Property;
+using ::testing::Return;
+using ::testing::UnorderedElementsAre;
+
+std::string const kSourceBucket = "source-bucket";
+std::string const kSourceObject = "source-object";
+std::string const kDestinationBucket = "destination-bucket";
+std::string const kDestinationObject = "destination-object";
+std::string const kPrefix = "prefix";
+std::string const kContents = "0123456789ab";
+std::string const kCrc32c = "abcd==";
+std::int64_t const kSourceGeneration = 42;
+
+ObjectMetadata MockObject(std::string const& bucket_name,
+                          std::string const& object_name,
+                          std::int64_t generation, std::size_t size = 0,
+                          std::string const& crc32c = {}) {
+  return internal::ObjectMetadataParser::FromJson(
+             nlohmann::json{{"bucket", bucket_name},
+                            {"name", object_name},
+                            {"generation", generation},
+                            {"size", size},
+                            {"crc32c", crc32c}})
+      .value();
+}
+
+std::unique_ptr<internal::ObjectReadSource> MockReadSource(
+    std::string contents) {
+  auto source = std::make_unique<testing::MockObjectReadSource>();
+  EXPECT_CALL(*source, IsOpen).WillRepeatedly(Return(true));
+  EXPECT_CALL(*source, Read)
+      .WillOnce([contents](char* buf, std::size_t n) {
+        EXPECT_GE(n, contents.size());
+        std::memcpy(buf, contents.data(), contents.size());
+        return internal::ReadSourceResult{
+            contents.size(), internal::HttpResponse{200, "", {}}};
+      })
+      .WillRepeatedly(Return(internal::ReadSourceResult{
+          0, internal::HttpResponse{200, "", {}}}));
+  EXPECT_CALL(*source, Close)
+      .WillRepeatedly(Return(internal::HttpResponse{200, "", {}}));
+  return source;
+}
+
+// Sets up the expectations to lock the prefixes used by the copy and by
+// `ComposeMany()`, and to delete all the temporary objects.
+class TemporaryObjects {
+ public:
+  explicit TemporaryObjects(testing::MockClient& mock) {
+    EXPECT_CALL(mock, InsertObjectMedia)
+        .WillRepeatedly([this](internal::InsertObjectMediaRequest const& r) {
+          EXPECT_EQ(r.bucket_name(), kDestinationBucket);
+          EXPECT_TRUE(r.HasOption<IfGenerationMatch>());
+          Add(r.object_name());
+          return make_status_or(
+              MockObject(kDestinationBucket, r.object_name(), 1));
+        });
+    EXPECT_CALL(mock, DeleteObject)
+        .WillRepeatedly([this](internal::DeleteObjectRequest const& r) {
+          EXPECT_EQ(r.bucket_name(), kDestinationBucket);
+          std::lock_guard<std::mutex> lk(mu_);
+          deleted_.insert(r.object_name());
+          return make_status_or(internal::EmptyResponse{});
+        });
+  }
+
+  void Add(std::string name) {
+    std::lock_guard<std::mutex> lk(mu_);
+    created_.insert(std::move(name));
+  }
+
+  std::set<std::string> created() {
+    std::lock_guard<std::mutex> lk(mu_);
+    return created_;
+  }
+
+  std::set<std::string> deleted() {
+    std::lock_guard<std::mutex> lk(mu_);
+    return deleted_;
+  }
+
+ private:
+  std::mutex mu_;
+  std::set<std::string> created_;
+  std::set<std::string> deleted_;
+};
+
+void ExpectGetSource(testing::MockClient& mock) {
+  EXPECT_CALL(mock, GetObjectMetadata)
+      .WillOnce([](internal::GetObjectMetadataRequest const& r) {
+        EXPECT_EQ(r.bucket_name(), kSourceBucket);
+        EXPECT_EQ(r.object_name(), kSourceObject);
+        return make_status_or(MockObject(kSourceBucket, kSourceObject,
+                                         kSourceGeneration, kContents.size(),
+                                         kCrc32c));
+      });
+}
+
+// Each part contains 4 bytes of `kContents`.
+void ExpectReads(testing::MockClient& mock) {
+  EXPECT_CALL(mock, ReadObject)
+      .Times(3)
+      .WillRepeatedly([](internal::ReadObjectRangeRequest const& r) {
+        EXPECT_EQ(r.bucket_name(), kSourceBucket);
+        EXPECT_EQ(r.object_name(), kSourceObject);
+        EXPECT_EQ(r.GetOption<Generation>().value_or(0), kSourceGeneration);
+        auto const range = r.GetOption<ReadRange>().value();
+        EXPECT_EQ(range.end - range.begin, 4);
+        return make_status_or(
+            MockReadSource(kContents.substr(range.begin, 4)));
+      });
+}
+
+void ExpectPartUploads(testing::MockClient& mock, TemporaryObjects& objects) {
+  for (int i = 0; i != 3; ++i) {
+    auto const name = kPrefix + ".copy-part-" + std::to_string(i);
+    auto const contents = kContents.substr(4 * i, 4);
+    EXPECT_CALL(mock, CreateResumableUpload(Property(
+                          &internal::ResumableUploadRequest::object_name,
+                          name)))
+        .WillOnce([name](internal::ResumableUploadRequest const& r) {
+          EXPECT_EQ(r.bucket_name(), kDestinationBucket);
+          EXPECT_EQ(r.GetOption<IfGenerationMatch>().value_or(-1), 0);
+          return make_status_or(internal::CreateResumableUploadResponse{name});
+        });
+    EXPECT_CALL(mock, UploadChunk(Property(
+                          &internal::UploadChunkRequest::upload_session_url,
+                          name)))
+        .WillOnce([&objects, name, contents, i](
+                      internal::UploadChunkRequest const& r) {
+          EXPECT_THAT(r.payload(),
+                      ElementsAre(internal::ConstBuffer(contents)));
+          objects.Add(name);
+          return make_status_or(internal::QueryResumableUploadResponse{
+              r.offset() + r.payload_size(),
+              MockObject(kDestinationBucket, name, 100 + i)});
+        });
+  }
+}
+
+TEST(ParallelCopyObject, Success) {
+  auto mock = std::make_shared<testing::MockClient>();
+  TemporaryObjects objects(*mock);
+  ExpectGetSource(*mock);
+  ExpectReads(*mock);
+  ExpectPartUploads(*mock, objects);
+  EXPECT_CALL(*mock, ComposeObject)
+      .WillOnce([](internal::ComposeObjectRequest const& r) {
+        EXPECT_EQ(r.bucket_name(), kDestinationBucket);
+        EXPECT_EQ(r.object_name(), kDestinationObject);
+        EXPECT_EQ(r.GetOption<IfGenerationMatch>().value_or(-1), 0);
+        auto sources = nlohmann::json::parse(r.JsonPayload())["sourceObjects"];
+        EXPECT_EQ(sources.size(), 3);
+        for (int i = 0; i != 3; ++i) {
+          EXPECT_EQ(sources[i].value("name", ""),
+                    kPrefix + ".copy-part-" + std::to_string(i));
+          EXPECT_EQ(sources[i].value("generation", 0), 100 + i);
+        }
+        return make_status_or(MockObject(kDestinationBucket, kDestinationObject,
+                                         7, kContents.size(), kCrc32c));
+      });
+
+  std::vector<std::pair<std::uint64_t, std::uint64_t>> progress;
+  auto result = ParallelCopyObject(
+      testing::ClientFromMock(mock), kSourceBucket, kSourceObject,
+      kDestinationBucket, kDestinationObject, kPrefix, false, MaxStreams(3),
+      MinStreamSize(4), IfGenerationMatch(0),
+      ParallelCopyProgressCallback(
+          [&progress](std::uint64_t bytes_copied, std::uint64_t size) {
+            progress.emplace_back(bytes_copied, size);
+          }));
+  ASSERT_STATUS_OK(result);
+  EXPECT_EQ(result->name(), kDestinationObject);
+  EXPECT_EQ(result->crc32c(), kCrc32c);
+  EXPECT_THAT(progress, ElementsAre(Pair(4, 12), Pair(8, 12), Pair(12, 12)));
+  EXPECT_EQ(objects.deleted(), objects.created());
+  EXPECT_THAT(objects.deleted(),
+              UnorderedElementsAre(kPrefix, kPrefix + ".compose",
+                                   kPrefix + ".copy-part-0",
+                                   kPrefix + ".copy-part-1",
+                                   kPrefix + ".copy-part-2"));
+}
+
+TEST(ParallelCopyObject, ChecksumMismatch) {
+  auto mock = std::make_shared<testing::MockClient>();
+  TemporaryObjects objects(*mock);
+  ExpectGetSource(*mock);
+  ExpectReads(*mock);
+  ExpectPartUploads(*mock, objects);
+  EXPECT_CALL(*mock, ComposeObject)
+      .WillOnce(Return(MockObject(kDestinationBucket, kDestinationObject, 7,
+                                  kContents.size(), "bad-crc32c==")));
+  // The corrupted destination object is deleted, unless it has changed.
+  EXPECT_CALL(*mock, DeleteObject(Property(
+                         &internal::DeleteObjectRequest::object_name,
+                         kDestinationObject)))
+      .WillOnce([](internal::DeleteObjectRequest const& r) {
+        EXPECT_EQ(r.bucket_name(), kDestinationBucket);
+        EXPECT_EQ(r.GetOption<Generation>().value_or(0), 7);
+        EXPECT_EQ(r.GetOption<IfGenerationMatch>().value_or(0), 7);
+        return make_status_or(internal::EmptyResponse{});
+      });
+
+  auto result = ParallelCopyObject(testing::ClientFromMock(mock),
+                                   kSourceBucket, kSourceObject,
+                                   kDestinationBucket, kDestinationObject,
+                                   kPrefix, false, MaxStreams(3),
+                                   MinStreamSize(4));
+  EXPECT_THAT(result, StatusIs(StatusCode::kDataLoss, HasSubstr("CRC32C")));
+  EXPECT_EQ(objects.deleted(), objects.created());
+}
+
+TEST(ParallelCopyObject, PartFailure) {
+  auto mock = std::make_shared<testing::MockClient>();
+  TemporaryObjects objects(*mock);
+  ExpectGetSource(*mock);
+  EXPECT_CALL(*mock, ReadObject)
+      .Times(2)
+      .WillRepeatedly([](internal::ReadObjectRangeRequest const& r) {
+        auto const range = r.GetOption<ReadRange>().value();
+        return make_status_or(
+            MockReadSource(kContents.substr(range.begin, 6)));
+      });
+  // The second part fails to upload, the first part must be deleted.
+  for (int i = 0; i != 2; ++i) {
+    auto const name = kPrefix + ".copy-part-" + std::to_string(i);
+    EXPECT_CALL(*mock, CreateResumableUpload(Property(
+                           &internal::ResumableUploadRequest::object_name,
+                           name)))
+        .WillOnce(Return(internal::CreateResumableUploadResponse{name}));
+  }
+  EXPECT_CALL(*mock, UploadChunk(Property(
+                         &internal::UploadChunkRequest::upload_session_url,
+                         kPrefix + ".copy-part-0")))
+      .WillOnce([&](internal::UploadChunkRequest const& r) {
+        objects.Add(kPrefix + ".copy-part-0");
+        return make_status_or(internal::QueryResumableUploadResponse{
+            r.offset() + r.payload_size(),
+            MockObject(kDestinationBucket, kPrefix + ".copy-part-0", 100)});
+      });
+  EXPECT_CALL(*mock, UploadChunk(Property(
+                         &internal::UploadChunkRequest::upload_session_url,
+                         kPrefix + ".copy-part-1")))
+      .WillOnce(Return(PermanentError()));
+  EXPECT_CALL(*mock, ComposeObject).Times(0);
+
+  auto result = ParallelCopyObject(testing::ClientFromMock(mock),
+                                   kSourceBucket, kSourceObject,
+                                   kDestinationBucket, kDestinationObject,
+                                   kPrefix, false, MaxStreams(2),
+                                   MinStreamSize(6));
+  EXPECT_THAT(result, StatusIs(PermanentError().code()));
+  EXPECT_EQ(objects.deleted(), objects.created());
+}
+
+TEST(ParallelCopyObject, SmallObjectUsesRewrite) {
+  auto mock = std::make_shared<testing::MockClient>();
+  ExpectGetSource(*mock);
+  EXPECT_CALL(*mock, RewriteObject)
+      .WillOnce([](internal::RewriteObjectRequest const& r) {
+        EXPECT_EQ(r.source_bucket(), kSourceBucket);
+        EXPECT_EQ(r.source_object(), kSourceObject);
+        EXPECT_EQ(r.destination_bucket(), kDestinationBucket);
+        EXPECT_EQ(r.destination_object(), kDestinationObject);
+        EXPECT_EQ(r.GetOption<SourceGeneration>().value_or(0),
+                  kSourceGeneration);
+        return make_status_or(internal::RewriteObjectResponse{
+            kContents.size(), kContents.size(), true, "",
+            MockObject(kDestinationBucket, kDestinationObject, 7)});
+      });
+  EXPECT_CALL(*mock, InsertObjectMedia).Times(0);
+  EXPECT_CALL(*mock, ReadObject).Times(0);
+
+  std::vector<std::pair<std::uint64_t, std::uint64_t>> progress;
+  auto result = ParallelCopyObject(
+      testing::ClientFromMock(mock), kSourceBucket, kSourceObject,
+      kDestinationBucket, kDestinationObject, kPrefix, false,
+      ParallelCopyProgressCallback(
+          [&progress](std::uint64_t bytes_copied, std::uint64_t size) {
+            progress.emplace_back(bytes_copied, size);
+          }));
+  EXPECT_THAT(result, IsOkAndHolds(Property(&ObjectMetadata::generation, 7)));
+  EXPECT_THAT(progress, ElementsAre(Pair(12, 12)));
+}
+
+}  // namespace
+GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
+}  // namespace storage
+}  // namespace cloud
+}  // namespace google
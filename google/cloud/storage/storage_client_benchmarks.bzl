@@ -18,4 +18,5 @@
 
 storage_client_benchmarks = [
     "internal/crc32c_benchmark.cc",
+    "internal/object_metadata_sax_parser_benchmark.cc",
 ]
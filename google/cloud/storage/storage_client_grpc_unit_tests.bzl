@@ -37,6 +37,7 @@ storage_client_grpc_unit_tests = [
     "internal/async/connection_impl_test.cc",
     "internal/async/connection_impl_upload_hash_test.cc",
     "internal/async/connection_impl_upload_test.cc",
+    "internal/async/connection_read_cache_test.cc",
     "internal/async/connection_tracing_test.cc",
     "internal/async/default_options_test.cc",
     "internal/async/handle_redirect_error_test.cc",
@@ -90,5 +91,6 @@ storage_client_grpc_unit_tests = [
     "internal/grpc/stub_test.cc",
     "internal/grpc/stub_upload_chunk_test.cc",
     "internal/grpc/synthetic_self_link_test.cc",
+    "internal/grpc/write_buffer_pool_test.cc",
     "internal/storage_stub_factory_test.cc",
 ]
@@ -50,6 +50,7 @@ storage_client_unit_tests = [
     "internal/bucket_requests_test.cc",
     "internal/complex_option_test.cc",
     "internal/compute_engine_util_test.cc",
+    "internal/connection_impl_batch_test.cc",
     "internal/connection_impl_bucket_acl_test.cc",
     "internal/connection_impl_bucket_test.cc",
     "internal/connection_impl_default_object_acl_test.cc",
@@ -75,15 +76,20 @@ storage_client_unit_tests = [
     "internal/logging_stub_test.cc",
     "internal/make_jwt_assertion_test.cc",
     "internal/md5hash_test.cc",
+    "internal/memory_mapped_file_test.cc",
     "internal/metadata_parser_test.cc",
     "internal/notification_requests_test.cc",
     "internal/object_acl_requests_test.cc",
+    "internal/object_metadata_sax_parser_test.cc",
+    "internal/object_read_cache_test.cc",
     "internal/object_read_streambuf_test.cc",
     "internal/object_requests_test.cc",
     "internal/object_write_streambuf_test.cc",
     "internal/patch_builder_test.cc",
     "internal/policy_document_request_test.cc",
+    "internal/read_cache_connection_test.cc",
     "internal/request_project_id_test.cc",
+    "internal/rest/batch_multipart_test.cc",
     "internal/rest/object_read_source_test.cc",
     "internal/rest/request_builder_test.cc",
     "internal/rest/stub_test.cc",
@@ -112,6 +118,7 @@ storage_client_unit_tests = [
     "object_metadata_test.cc",
     "object_retention_test.cc",
     "object_stream_test.cc",
+    "parallel_copy_test.cc",
     "parallel_uploads_test.cc",
     "policy_document_test.cc",
     "retry_policy_test.cc",
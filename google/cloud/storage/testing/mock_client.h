@@ -172,6 +172,8 @@ class MockClient : public google::cloud::storage::internal::StorageConnection {
               (internal::GetNotificationRequest const&), (override));
   MOCK_METHOD(StatusOr<internal::EmptyResponse>, DeleteNotification,
               (internal::DeleteNotificationRequest const&), (override));
+  MOCK_METHOD(StatusOr<internal::BatchResponse>, ExecuteBatch,
+              (internal::BatchRequest const&), (override));
   MOCK_METHOD(
       StatusOr<std::string>, AuthorizationHeader,
       (std::shared_ptr<google::cloud::storage::oauth2::Credentials> const&));
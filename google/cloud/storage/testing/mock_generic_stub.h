@@ -272,6 +272,11 @@ class MockGenericStub : public storage_internal::GenericStub {
                storage::internal::DeleteNotificationRequest const&),
               (override));
 
+  MOCK_METHOD(StatusOr<storage::internal::BatchResponse>, ExecuteBatch,
+              (rest_internal::RestContext&, Options const&,
+               storage::internal::BatchRequest const&),
+              (override));
+
   MOCK_METHOD(std::vector<std::string>, InspectStackStructure, (),
               (const, override));
 };
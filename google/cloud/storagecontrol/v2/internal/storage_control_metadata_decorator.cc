@@ -79,8 +79,7 @@ Status StorageControlMetadata::DeleteFolder(
         {
             {[](google::storage::control::v2::DeleteFolderRequest const&
                     request) -> std::string const& { return request.name(); },
-             std::regex{"(projects/[^/]+/buckets/[^/]+)/.*",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate("{projects/*/buckets/*}/**")},
         }};
   }();
   bucket_matcher->AppendParam(request, params);
@@ -107,8 +106,7 @@ StorageControlMetadata::GetFolder(
         {
             {[](google::storage::control::v2::GetFolderRequest const& request)
                  -> std::string const& { return request.name(); },
-             std::regex{"(projects/[^/]+/buckets/[^/]+)/.*",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate("{projects/*/buckets/*}/**")},
         }};
   }();
   bucket_matcher->AppendParam(request, params);
@@ -157,8 +155,7 @@ StorageControlMetadata::AsyncRenameFolder(
         {
             {[](google::storage::control::v2::RenameFolderRequest const&
                     request) -> std::string const& { return request.name(); },
-             std::regex{"(projects/[^/]+/buckets/[^/]+)/.*",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate("{projects/*/buckets/*}/**")},
         }};
   }();
   bucket_matcher->AppendParam(request, params);
@@ -185,8 +182,7 @@ StatusOr<google::longrunning::Operation> StorageControlMetadata::RenameFolder(
         {
             {[](google::storage::control::v2::RenameFolderRequest const&
                     request) -> std::string const& { return request.name(); },
-             std::regex{"(projects/[^/]+/buckets/[^/]+)/.*",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate("{projects/*/buckets/*}/**")},
         }};
   }();
   bucket_matcher->AppendParam(request, params);
@@ -213,8 +209,7 @@ StorageControlMetadata::GetStorageLayout(
         {
             {[](google::storage::control::v2::GetStorageLayoutRequest const&
                     request) -> std::string const& { return request.name(); },
-             std::regex{"(projects/[^/]+/buckets/[^/]+)/.*",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate("{projects/*/buckets/*}/**")},
         }};
   }();
   bucket_matcher->AppendParam(request, params);
@@ -260,8 +255,7 @@ Status StorageControlMetadata::DeleteManagedFolder(
         {
             {[](google::storage::control::v2::DeleteManagedFolderRequest const&
                     request) -> std::string const& { return request.name(); },
-             std::regex{"(projects/[^/]+/buckets/[^/]+)/.*",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate("{projects/*/buckets/*}/**")},
         }};
   }();
   bucket_matcher->AppendParam(request, params);
@@ -288,8 +282,7 @@ StorageControlMetadata::GetManagedFolder(
         {
             {[](google::storage::control::v2::GetManagedFolderRequest const&
                     request) -> std::string const& { return request.name(); },
-             std::regex{"(projects/[^/]+/buckets/[^/]+)/.*",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate("{projects/*/buckets/*}/**")},
         }};
   }();
   bucket_matcher->AppendParam(request, params);
@@ -383,8 +376,7 @@ StorageControlMetadata::AsyncUpdateAnywhereCache(
                     request) -> std::string const& {
                return request.anywhere_cache().name();
              },
-             std::regex{"(projects/[^/]+/buckets/[^/]+)/.*",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate("{projects/*/buckets/*}/**")},
         }};
   }();
   bucket_matcher->AppendParam(request, params);
@@ -414,8 +406,7 @@ StorageControlMetadata::UpdateAnywhereCache(
                     request) -> std::string const& {
                return request.anywhere_cache().name();
              },
-             std::regex{"(projects/[^/]+/buckets/[^/]+)/.*",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate("{projects/*/buckets/*}/**")},
         }};
   }();
   bucket_matcher->AppendParam(request, params);
@@ -442,8 +433,7 @@ StorageControlMetadata::DisableAnywhereCache(
         {
             {[](google::storage::control::v2::DisableAnywhereCacheRequest const&
                     request) -> std::string const& { return request.name(); },
-             std::regex{"(projects/[^/]+/buckets/[^/]+)/.*",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate("{projects/*/buckets/*}/**")},
         }};
   }();
   bucket_matcher->AppendParam(request, params);
@@ -470,8 +460,7 @@ StorageControlMetadata::PauseAnywhereCache(
         {
             {[](google::storage::control::v2::PauseAnywhereCacheRequest const&
                     request) -> std::string const& { return request.name(); },
-             std::regex{"(projects/[^/]+/buckets/[^/]+)/.*",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate("{projects/*/buckets/*}/**")},
         }};
   }();
   bucket_matcher->AppendParam(request, params);
@@ -498,8 +487,7 @@ StorageControlMetadata::ResumeAnywhereCache(
         {
             {[](google::storage::control::v2::ResumeAnywhereCacheRequest const&
                     request) -> std::string const& { return request.name(); },
-             std::regex{"(projects/[^/]+/buckets/[^/]+)/.*",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate("{projects/*/buckets/*}/**")},
         }};
   }();
   bucket_matcher->AppendParam(request, params);
@@ -526,8 +514,7 @@ StorageControlMetadata::GetAnywhereCache(
         {
             {[](google::storage::control::v2::GetAnywhereCacheRequest const&
                     request) -> std::string const& { return request.name(); },
-             std::regex{"(projects/[^/]+/buckets/[^/]+)/.*",
-                        std::regex::optimize}},
+             internal::RoutingPathTemplate("{projects/*/buckets/*}/**")},
         }};
   }();
   bucket_matcher->AppendParam(request, params);
@@ -46,7 +46,9 @@ bool operator==(TracingOptions const& a, TracingOptions const& b) {
   return a.single_line_mode_ == b.single_line_mode_ &&
          a.use_short_repeated_primitives_ == b.use_short_repeated_primitives_ &&
          a.truncate_string_field_longer_than_ ==
-             b.truncate_string_field_longer_than_;
+             b.truncate_string_field_longer_than_ &&
+         a.max_payload_size_ == b.max_payload_size_ &&
+         a.payload_sampling_period_ == b.payload_sampling_period_;
 }
 
 TracingOptions& TracingOptions::SetOptions(std::string const& str) {
@@ -63,6 +65,10 @@ TracingOptions& TracingOptions::SetOptions(std::string const& str) {
       if (auto v = ParseBoolean(val)) use_short_repeated_primitives_ = *v;
     } else if (opt == "truncate_string_field_longer_than") {
       if (auto v = ParseInteger(val)) truncate_string_field_longer_than_ = *v;
+    } else if (opt == "max_payload_size") {
+      if (auto v = ParseInteger(val)) max_payload_size_ = *v;
+    } else if (opt == "payload_sampling_period") {
+      if (auto v = ParseInteger(val)) payload_sampling_period_ = *v;
     }
     if (comma == end) break;
     pos = comma + 1;
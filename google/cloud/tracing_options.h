@@ -29,6 +29,8 @@ GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_BEGIN
  *   single_line_mode=on
  *   use_short_repeated_primitives=on
  *   truncate_string_field_longer_than=128
+ *   max_payload_size=0
+ *   payload_sampling_period=1
  */
 class TracingOptions {
  public:
@@ -60,10 +62,30 @@ class TracingOptions {
     return truncate_string_field_longer_than_;
   }
 
+  /**
+   * If non-zero, stop formatting a message after this many bytes.
+   *
+   * Only the fields that fit within this limit are formatted, so large
+   * messages are cheap to log. `Any` payloads larger than 1 MiB are omitted.
+   */
+  std::int64_t max_payload_size() const { return max_payload_size_; }
+
+  /**
+   * Only format the request and response messages for 1 in N RPCs.
+   *
+   * The RPCs are still logged, but unsampled RPCs omit their payloads. Values
+   * smaller than 2 format the payload of all RPCs.
+   */
+  std::int64_t payload_sampling_period() const {
+    return payload_sampling_period_;
+  }
+
  private:
   bool single_line_mode_ = true;
   bool use_short_repeated_primitives_ = true;
   std::int64_t truncate_string_field_longer_than_ = 128;
+  std::int64_t max_payload_size_ = 0;
+  std::int64_t payload_sampling_period_ = 1;
 };
 
 GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
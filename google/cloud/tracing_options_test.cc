@@ -81,6 +81,17 @@ TEST(TracingOptionsTest, Override) {
   EXPECT_EQ(256, tracing_options.truncate_string_field_longer_than());
 }
 
+TEST(TracingOptionsTest, PayloadLimits) {
+  TracingOptions tracing_options;
+  EXPECT_EQ(0, tracing_options.max_payload_size());
+  EXPECT_EQ(1, tracing_options.payload_sampling_period());
+
+  tracing_options.SetOptions("max_payload_size=4096,payload_sampling_period=8");
+  EXPECT_EQ(4096, tracing_options.max_payload_size());
+  EXPECT_EQ(8, tracing_options.payload_sampling_period());
+  EXPECT_NE(tracing_options, TracingOptions{});
+}
+
 }  // namespace
 GOOGLE_CLOUD_CPP_INLINE_NAMESPACE_END
 }  // namespace cloud